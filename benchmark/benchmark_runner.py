@@ -274,7 +274,8 @@ def parse_args():
     parser.add_argument('--dataset', default='ldbc-sf100',
                         help='dataset to run benchmark')
     parser.add_argument('--thread', default=str(cpu_count),
-                        help='number of threads to run benchmark')
+                        help='number of threads to run benchmark, or a comma-separated list to '
+                             'measure scaling')
     parser.add_argument(
         '--note', default='automated benchmark run', help='note about this run')
     return parser.parse_args()
@@ -0,0 +1,64 @@
+"""Compares a run of ryu_microbenchmark against a baseline run.
+
+Both runs are Google Benchmark JSON files, e.g. written by
+    ryu_microbenchmark --benchmark_out=current.json --benchmark_out_format=json \
+        --benchmark_repetitions=5 --benchmark_report_aggregates_only=true
+Benchmarks are matched by name. The median is used if the runs have repetitions.
+Exits with status 1 if any benchmark got slower by more than the threshold.
+"""
+import argparse
+import json
+import sys
+
+
+def load_times(path, metric):
+    with open(path) as f:
+        report = json.load(f)
+    times = {}
+    medians = {}
+    for run in report["benchmarks"]:
+        if run.get("error_occurred"):
+            continue
+        name = run.get("run_name", run["name"])
+        if run.get("run_type") == "aggregate":
+            if run.get("aggregate_name") == "median":
+                medians[name] = run[metric]
+        else:
+            times[name] = run[metric]
+    times.update(medians)
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON output of the baseline run")
+    parser.add_argument("current", help="JSON output of the run to check")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="relative slowdown reported as a regression (default: 0.1)")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="cpu_time")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    current = load_times(args.current, args.metric)
+    regressions = []
+    print(f"{'Benchmark':<60} {'Baseline':>12} {'Current':>12} {'Change':>8}")
+    for name in sorted(current):
+        if name not in baseline:
+            print(f"{name:<60} {'-':>12} {current[name]:>12.1f} {'new':>8}")
+            continue
+        change = current[name] / baseline[name] - 1 if baseline[name] > 0 else 0
+        print(f"{name:<60} {baseline[name]:>12.1f} {current[name]:>12.1f} {change:>+8.1%}")
+        if change > args.threshold:
+            regressions.append((name, change))
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<60} {baseline[name]:>12.1f} {'-':>12} {'missing':>8}")
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed by more than {args.threshold:.0%}:")
+        for name, change in regressions:
+            print(f"  {name}: {change:+.1%}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,7 @@
 #include "common/in_mem_graph.h"
 
+#include "graph/graph.h"
+
 namespace ryu {
 namespace algo_extension {
 
@@ -25,5 +27,31 @@ void InMemGraph::insertNbr(const common::offset_t to, const weight_t weight) {
     numEdges++;
 }
 
+void InMemGraph::initFromGraph(graph::Graph* graph, common::table_id_t tableID) {
+    const auto nbrInfo = graph->getRelInfos(tableID)[0];
+    KU_ASSERT(nbrInfo.srcTableID == nbrInfo.dstTableID);
+    // Set randomLookup to false to enable caching during graph materialization.
+    const auto scanState = graph->prepareRelScan(*nbrInfo.relGroupEntry, nbrInfo.relTableID,
+        nbrInfo.dstTableID, {}, false /*randomLookup*/);
+    reinit(numNodes);
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        initNextNode();
+        const common::nodeID_t nextNodeId = {nodeId, tableID};
+        for (auto chunk : graph->scanFwd(nextNodeId, *scanState)) {
+            chunk.forEach([&](auto neighbors, auto, auto i) { insertNbr(neighbors[i].offset); });
+        }
+        for (auto chunk : graph->scanBwd(nextNodeId, *scanState)) {
+            chunk.forEach([&](auto neighbors, auto, auto i) {
+                auto nbrId = neighbors[i].offset;
+                if (nbrId != nodeId) {
+                    insertNbr(nbrId);
+                }
+            });
+        }
+    }
+    // Terminates the CSR offsets of the last node.
+    initNextNode();
+}
+
 } // namespace algo_extension
 } // namespace ryu
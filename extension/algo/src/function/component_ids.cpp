@@ -18,11 +18,27 @@ OffsetManager::OffsetManager(const table_id_map_t<offset_t>& maxOffsetMap) {
     }
 }
 
+void ComponentIDs::allocate(const table_id_map_t<offset_t>& maxOffsetMap,
+    storage::MemoryManager* mm) {
+    offset_t numNodes = 0;
+    for (auto [tableID, maxOffset] : maxOffsetMap) {
+        numNodes += maxOffset;
+    }
+    compact = numNodes < INVALID_COMPACT_COMPONENT_ID;
+    for (auto [tableID, maxOffset] : maxOffsetMap) {
+        if (compact) {
+            compactObjects.allocate(tableID, maxOffset, mm);
+        } else {
+            denseObjects.allocate(tableID, maxOffset, mm);
+        }
+    }
+}
+
 ComponentIDs ComponentIDs::getSequenceComponentIDs(const table_id_map_t<offset_t>& maxOffsetMap,
     const OffsetManager& offsetManager, storage::MemoryManager* mm) {
     auto result = ComponentIDs();
+    result.allocate(maxOffsetMap, mm);
     for (auto [tableID, maxOffset] : maxOffsetMap) {
-        result.denseObjects.allocate(tableID, maxOffset, mm);
         result.pinTableID(tableID);
         auto startOffset = offsetManager.getStartOffset(tableID);
         for (auto i = 0u; i < maxOffset; i++) {
@@ -35,8 +51,8 @@ ComponentIDs ComponentIDs::getSequenceComponentIDs(const table_id_map_t<offset_t
 ComponentIDs ComponentIDs::getUnvisitedComponentIDs(const table_id_map_t<offset_t>& maxOffsetMap,
     storage::MemoryManager* mm) {
     auto result = ComponentIDs();
+    result.allocate(maxOffsetMap, mm);
     for (auto [tableID, maxOffset] : maxOffsetMap) {
-        result.denseObjects.allocate(tableID, maxOffset, mm);
         result.pinTableID(tableID);
         for (auto i = 0u; i < maxOffset; i++) {
             result.setComponentID(i, INVALID_COMPONENT_ID);
@@ -45,7 +61,9 @@ ComponentIDs ComponentIDs::getUnvisitedComponentIDs(const table_id_map_t<offset_
     return result;
 }
 
-bool ComponentIDsPair::update(offset_t boundOffset, offset_t nbrOffset) {
+template<typename T>
+static bool updateMin(std::atomic<T>* curData, std::atomic<T>* nextData, offset_t boundOffset,
+    offset_t nbrOffset) {
     auto boundValue = curData[boundOffset].load(std::memory_order_relaxed);
     auto tmp = nextData[nbrOffset].load(std::memory_order_relaxed);
     while (tmp > boundValue) {
@@ -56,6 +74,13 @@ bool ComponentIDsPair::update(offset_t boundOffset, offset_t nbrOffset) {
     return false;
 }
 
+bool ComponentIDsPair::update(offset_t boundOffset, offset_t nbrOffset) {
+    if (componentIDs.isCompact()) {
+        return updateMin(curCompactData, nextCompactData, boundOffset, nbrOffset);
+    }
+    return updateMin(curData, nextData, boundOffset, nbrOffset);
+}
+
 void ComponentIDsOutputVertexCompute::vertexCompute(offset_t startOffset, offset_t endOffset,
     table_id_t tableID) {
     for (auto i = startOffset; i < endOffset; ++i) {
@@ -122,13 +122,16 @@ private:
     std::unique_ptr<ValueVector> kValueVector;
 };
 
+// Adds the remaining nodes with degree at most the current core value to the next frontier, and
+// computes the minimum degree of the other remaining nodes.
 class DegreeLessThanCoreVertexCompute : public GDSVertexCompute {
 public:
     DegreeLessThanCoreVertexCompute(Degrees& degrees, CoreValues& coreValues,
         FrontierPair* frontierPair, degree_t coreValue, std::atomic<offset_t>& numActiveNodes,
-        common::NodeOffsetMaskMap* nodeMask)
+        std::atomic<degree_t>& minRemainingDegree, common::NodeOffsetMaskMap* nodeMask)
         : GDSVertexCompute{nodeMask}, degrees{degrees}, coreValues{coreValues},
-          frontierPair{frontierPair}, coreValue{coreValue}, numActiveNodes{numActiveNodes} {}
+          frontierPair{frontierPair}, coreValue{coreValue}, numActiveNodes{numActiveNodes},
+          minRemainingDegree{minRemainingDegree} {}
 
     void beginOnTableInternal(table_id_t tableID) override {
         frontierPair->pinNextFrontier(tableID);
@@ -137,6 +140,7 @@ public:
     }
 
     void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        auto minDegree = INVALID_DEGREE;
         for (auto i = startOffset; i < endOffset; ++i) {
             if (skip(i)) {
                 continue;
@@ -149,13 +153,18 @@ public:
                 frontierPair->addNodeToNextFrontier(nodeID_t{i, tableID});
                 coreValues.setCoreValue(i, coreValue);
                 numActiveNodes.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                minDegree = std::min(minDegree, degree);
             }
         }
+        auto curMinDegree = minRemainingDegree.load(std::memory_order_relaxed);
+        while (minDegree < curMinDegree &&
+               !minRemainingDegree.compare_exchange_weak(curMinDegree, minDegree)) {}
     }
 
     std::unique_ptr<VertexCompute> copy() override {
         return std::make_unique<DegreeLessThanCoreVertexCompute>(degrees, coreValues, frontierPair,
-            coreValue, numActiveNodes, nodeMask);
+            coreValue, numActiveNodes, minRemainingDegree, nodeMask);
     }
 
 private:
@@ -164,6 +173,7 @@ private:
     FrontierPair* frontierPair;
     degree_t coreValue;
     std::atomic<offset_t>& numActiveNodes;
+    std::atomic<degree_t>& minRemainingDegree;
 };
 
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
@@ -192,12 +202,14 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto numNodesComputed = 0u;
     while (numNodes != numNodesComputed) {
         // Compute current core value
+        std::atomic<degree_t> minRemainingDegree;
         while (true) {
             std::atomic<offset_t> numActiveNodes;
             numActiveNodes.store(0);
+            minRemainingDegree.store(INVALID_DEGREE);
             // Find nodes with degree less than current core.
             auto vc = DegreeLessThanCoreVertexCompute(degrees, coreValues,
-                computeState.frontierPair.get(), coreValue, numActiveNodes,
+                computeState.frontierPair.get(), coreValue, numActiveNodes, minRemainingDegree,
                 sharedState->getGraphNodeMaskMap());
             GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE,
                 sharedState->graph.get(), vc);
@@ -214,7 +226,12 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         }
         auto progress = static_cast<double>(numNodesComputed) / numNodes;
         ProgressBar::Get(*clientContext)->updateProgress(input.context->queryID, progress);
-        coreValue++;
+        // All remaining nodes have a degree above the current core value, so the next non-empty
+        // core is the minimum remaining degree. Jumping to it skips the empty cores in between.
+        if (minRemainingDegree.load() == INVALID_DEGREE) {
+            break;
+        }
+        coreValue = minRemainingDegree.load();
     }
     // Write output
     auto vertexCompute = KCoreResultVertexCompute(mm, sharedState, coreValues);
@@ -0,0 +1,264 @@
+#include "binder/binder.h"
+#include "common/exception/runtime.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/config/convergence_threshold_config.h"
+#include "function/config/max_iterations_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/hash/hash_functions.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+using namespace ryu::processor;
+using namespace ryu::storage;
+using namespace ryu::function;
+
+// Asynchronous label propagation (Raghavan et al., "Near linear time algorithm to detect community
+// structures in large-scale networks", 2007). Every node starts with its own label and repeatedly
+// adopts the label with the largest total edge weight among its neighbors. Labels are updated in
+// place, so nodes processed later in an iteration already see the labels updated earlier in it.
+
+namespace ryu {
+namespace algo_extension {
+
+struct LabelPropagationOptionalParams final : public MaxIterationOptionalParams {
+    OptionalParam<ConvergenceThreshold> convergenceThreshold;
+
+    explicit LabelPropagationOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    LabelPropagationOptionalParams(OptionalParam<MaxIterations> maxIterations,
+        OptionalParam<ConvergenceThreshold> convergenceThreshold)
+        : MaxIterationOptionalParams{maxIterations},
+          convergenceThreshold{std::move(convergenceThreshold)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        MaxIterationOptionalParams::evaluateParams(context);
+        convergenceThreshold.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<LabelPropagationOptionalParams>(maxIterations,
+            convergenceThreshold);
+    }
+};
+
+LabelPropagationOptionalParams::LabelPropagationOptionalParams(
+    const expression_vector& optionalParams)
+    : MaxIterationOptionalParams{constructMaxIterationParam(optionalParams)} {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == ConvergenceThreshold::NAME) {
+            convergenceThreshold = function::OptionalParam<ConvergenceThreshold>(optionalParam);
+        } else if (paramName == MaxIterations::NAME) {
+            continue;
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct LabelPropagationBindData final : public GDSBindData {
+    LabelPropagationBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<LabelPropagationOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<LabelPropagationBindData>(*this);
+    }
+};
+
+class InitLabelsVC final : public InMemParallelCompute {
+public:
+    explicit InitLabelsVC(AtomicObjectArray<offset_t>& labels) : labels{labels} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            labels.set(nodeId, nodeId, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<InitLabelsVC>(labels);
+    }
+
+private:
+    AtomicObjectArray<offset_t>& labels;
+};
+
+class PropagateLabelsVC final : public InMemParallelCompute {
+public:
+    PropagateLabelsVC(const InMemGraph& graph, AtomicObjectArray<offset_t>& labels,
+        std::atomic<offset_t>& numChangedNodes)
+        : graph{graph}, labels{labels}, numChangedNodes{numChangedNodes} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        offset_t numChangedLocal = 0;
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            labelWeights.clear();
+            for (auto offset = graph.csrOffsets[nodeId]; offset < graph.csrOffsets[nodeId + 1];
+                 ++offset) {
+                const auto& nbrEntry = graph.csrEdges[offset];
+                if (nbrEntry.neighbor != nodeId) {
+                    labelWeights[labels.get(nbrEntry.neighbor, std::memory_order_relaxed)] +=
+                        nbrEntry.weight;
+                }
+            }
+            if (labelWeights.empty()) {
+                continue;
+            }
+            const auto currLabel = labels.get(nodeId, std::memory_order_relaxed);
+            const auto newLabel = findMostFrequentLabel(nodeId, currLabel);
+            if (newLabel != currLabel) {
+                labels.set(nodeId, newLabel, std::memory_order_relaxed);
+                numChangedLocal++;
+            }
+        }
+        numChangedNodes.fetch_add(numChangedLocal);
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<PropagateLabelsVC>(graph, labels, numChangedNodes);
+    }
+
+private:
+    // Ties are broken towards the current label, and otherwise by a hash of the node and the
+    // label, so that the same label doesn't win every tie and flood the graph.
+    offset_t findMostFrequentLabel(offset_t nodeId, offset_t currLabel) const {
+        auto bestLabel = currLabel;
+        weight_t bestWeight = labelWeights.contains(currLabel) ? labelWeights.at(currLabel) : 0;
+        const auto nodeHash = murmurhash64(nodeId);
+        for (const auto& [label, weight] : labelWeights) {
+            if (weight > bestWeight ||
+                (weight == bestWeight && bestLabel != currLabel &&
+                    (murmurhash64(label) ^ nodeHash) < (murmurhash64(bestLabel) ^ nodeHash))) {
+                bestLabel = label;
+                bestWeight = weight;
+            }
+        }
+        return bestLabel;
+    }
+
+private:
+    const InMemGraph& graph;
+    AtomicObjectArray<offset_t>& labels;
+    std::atomic<offset_t>& numChangedNodes;
+    std::unordered_map<offset_t, weight_t> labelWeights;
+};
+
+class WriteLabelsVC final : public GDSResultVertexCompute {
+public:
+    WriteLabelsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        AtomicObjectArray<offset_t>& labels)
+        : GDSResultVertexCompute{mm, sharedState}, labels{labels} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        labelVector = createVector(LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            labelVector->setValue<int64_t>(0, labels.get(i, std::memory_order_relaxed));
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WriteLabelsVC>(mm, sharedState, labels);
+    }
+
+private:
+    AtomicObjectArray<offset_t>& labels;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> labelVector;
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*clientContext);
+    const auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto numNodes = graph->getMaxOffset(transaction, tableID);
+    auto bindData = input.bindData->constPtrCast<LabelPropagationBindData>();
+    auto& config = bindData->optionalParams->constCast<LabelPropagationOptionalParams>();
+    auto progressBar = ProgressBar::Get(*clientContext);
+
+    InMemGraph inMemGraph(numNodes, mm);
+    inMemGraph.initFromGraph(graph, tableID);
+    AtomicObjectArray<offset_t> labels(numNodes, mm);
+    InitLabelsVC initLabels(labels);
+    InMemGDSUtils::runParallelCompute(initLabels, numNodes, input.context);
+
+    const auto maxIterations = config.maxIterations.getParamVal();
+    const auto maxNumChangedNodes = config.convergenceThreshold.getParamVal() * numNodes;
+    for (auto iter = 0u; iter < maxIterations; ++iter) {
+        std::atomic<offset_t> numChangedNodes{0};
+        PropagateLabelsVC propagateLabels(inMemGraph, labels, numChangedNodes);
+        InMemGDSUtils::runParallelCompute(propagateLabels, numNodes, input.context);
+        progressBar->updateProgress(input.context->queryID,
+            static_cast<double>(iter + 1) / maxIterations);
+        if (numChangedNodes.load() <= maxNumChangedNodes) {
+            break;
+        }
+    }
+
+    const auto writeLabels = std::make_unique<WriteLabelsVC>(mm, sharedState, labels);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *writeLabels);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char LABEL_COLUMN_NAME[] = "label";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw RuntimeException("Label propagation only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw RuntimeException("Label propagation only supports operations on one edge table.");
+    }
+    expression_vector columns;
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    columns.push_back(nodeOutput->constPtrCast<NodeExpression>()->getInternalID());
+    columns.push_back(input->binder->createVariable(LABEL_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<LabelPropagationBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput, std::make_unique<LabelPropagationOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set LabelPropagationFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace ryu
@@ -0,0 +1,566 @@
+#include <numeric>
+
+#include "binder/binder.h"
+#include "common/exception/runtime.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "common/string_utils.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/config/convergence_threshold_config.h"
+#include "function/config/louvain_config.h"
+#include "function/config/max_iterations_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+using namespace ryu::processor;
+using namespace ryu::storage;
+using namespace ryu::function;
+
+// Leiden method for community detection (Traag et al., "From Louvain to Leiden: guaranteeing
+// well-connected communities", 2019). As in Louvain (see louvain.cpp), each phase moves nodes to
+// the neighbor community that increases the modularity most and then aggregates the graph. In
+// between, each community is refined into sub-communities that are guaranteed to be connected.
+// The graph is aggregated on the refined sub-communities, and each aggregated node starts the next
+// phase in the community its sub-community is part of.
+//
+// Nodes are moved in parallel and asynchronously: the community of a node and the weighted degree
+// of the communities are updated atomically as soon as the node moves, and are visible to the
+// nodes processed after it (see Sahu, "Fast Leiden Algorithm for Community Detection in Shared
+// Memory Setting", 2024).
+
+namespace ryu {
+namespace algo_extension {
+
+struct LeidenOptionalParams final : public MaxIterationOptionalParams {
+    OptionalParam<MaxPhases> maxPhases;
+    OptionalParam<ConvergenceThreshold> convergenceThreshold;
+
+    explicit LeidenOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    LeidenOptionalParams(OptionalParam<MaxIterations> maxIterations,
+        OptionalParam<MaxPhases> maxPhases,
+        OptionalParam<ConvergenceThreshold> convergenceThreshold)
+        : MaxIterationOptionalParams{maxIterations}, maxPhases{std::move(maxPhases)},
+          convergenceThreshold{std::move(convergenceThreshold)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        MaxIterationOptionalParams::evaluateParams(context);
+        maxPhases.evaluateParam(context);
+        convergenceThreshold.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<LeidenOptionalParams>(maxIterations, maxPhases,
+            convergenceThreshold);
+    }
+};
+
+LeidenOptionalParams::LeidenOptionalParams(const expression_vector& optionalParams)
+    : MaxIterationOptionalParams{constructMaxIterationParam(optionalParams)} {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == MaxPhases::NAME) {
+            maxPhases = function::OptionalParam<MaxPhases>(optionalParam);
+        } else if (paramName == ConvergenceThreshold::NAME) {
+            convergenceThreshold = function::OptionalParam<ConvergenceThreshold>(optionalParam);
+        } else if (paramName == MaxIterations::NAME) {
+            continue;
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct LeidenBindData final : public GDSBindData {
+    LeidenBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<LeidenOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<LeidenBindData>(*this);
+    }
+};
+
+struct LeidenState {
+    InMemGraph graph;
+    // For each node, the sum of the weights of its edges.
+    ObjectArray<weight_t> nodeWeightedDegrees;
+    // Community of each node.
+    AtomicObjectArray<offset_t> comm;
+    // For each community, the sum of the weighted degrees of its nodes.
+    AtomicObjectArray<weight_t> commWeightedDegrees;
+    // Refined sub-community of each node.
+    AtomicObjectArray<offset_t> refinedComm;
+    // For each refined sub-community, the sum of the weighted degrees and the number of its nodes.
+    AtomicObjectArray<weight_t> refinedCommWeightedDegrees;
+    AtomicObjectArray<offset_t> refinedCommSizes;
+    // 2 * sum of edge weights. Unchanged by aggregation.
+    weight_t totalWeight = 0;
+
+    LeidenState(offset_t numNodes, MemoryManager* mm) : graph{numNodes, mm} {
+        reallocate(numNodes, mm);
+    }
+    DELETE_BOTH_COPY(LeidenState);
+
+    // All arrays reuse allocations because the number of nodes decreases over phases.
+    void reallocate(offset_t numNodes, MemoryManager* mm) {
+        nodeWeightedDegrees.reallocate(numNodes, mm);
+        comm.reallocate(numNodes, mm);
+        commWeightedDegrees.reallocate(numNodes, mm);
+        refinedComm.reallocate(numNodes, mm);
+        refinedCommWeightedDegrees.reallocate(numNodes, mm);
+        refinedCommSizes.reallocate(numNodes, mm);
+    }
+
+    bool hasEdges(offset_t nodeId) const {
+        return graph.csrOffsets[nodeId] != graph.csrOffsets[nodeId + 1];
+    }
+};
+
+class LeidenInitCommVC final : public InMemParallelCompute {
+public:
+    explicit LeidenInitCommVC(LeidenState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            state.comm.set(nodeId, nodeId, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenInitCommVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+class LeidenResetCommVC final : public InMemParallelCompute {
+public:
+    explicit LeidenResetCommVC(LeidenState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            state.commWeightedDegrees.set(nodeId, 0, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenResetCommVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+// Computes the weighted degrees of nodes and communities, and puts each node in its own refined
+// sub-community.
+class LeidenInitPhaseVC final : public InMemParallelCompute {
+public:
+    explicit LeidenInitPhaseVC(LeidenState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            weight_t degree = 0;
+            for (auto offset = state.graph.csrOffsets[nodeId];
+                 offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+                degree += state.graph.csrEdges[offset].weight;
+            }
+            state.nodeWeightedDegrees.set(nodeId, degree);
+            state.commWeightedDegrees.fetchAdd(state.comm.get(nodeId, std::memory_order_relaxed),
+                degree, std::memory_order_relaxed);
+            state.refinedComm.set(nodeId, nodeId, std::memory_order_relaxed);
+            state.refinedCommWeightedDegrees.set(nodeId, degree, std::memory_order_relaxed);
+            state.refinedCommSizes.set(nodeId, 1, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenInitPhaseVC>(state);
+    }
+
+private:
+    LeidenState& state;
+};
+
+// Moves each node to the neighbor community with the largest modularity gain.
+class LeidenLocalMovingVC final : public InMemParallelCompute {
+public:
+    LeidenLocalMovingVC(LeidenState& state, std::atomic<offset_t>& numMovedNodes)
+        : state{state}, numMovedNodes{numMovedNodes} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        offset_t numMovedLocal = 0;
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            if (!state.hasEdges(nodeId)) {
+                continue;
+            }
+            const auto currComm = state.comm.get(nodeId, std::memory_order_relaxed);
+            commWeights.clear();
+            commWeights[currComm] = 0;
+            for (auto offset = state.graph.csrOffsets[nodeId];
+                 offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+                const auto& nbrEntry = state.graph.csrEdges[offset];
+                // Self-loops stay within the community of the node wherever it moves.
+                if (nbrEntry.neighbor != nodeId) {
+                    commWeights[state.comm.get(nbrEntry.neighbor, std::memory_order_relaxed)] +=
+                        nbrEntry.weight;
+                }
+            }
+            const auto degree = state.nodeWeightedDegrees.get(nodeId);
+            const auto newComm = findBestComm(currComm, degree);
+            if (newComm != currComm) {
+                state.commWeightedDegrees.fetchAdd(newComm, degree);
+                state.commWeightedDegrees.fetchSub(currComm, degree);
+                state.comm.set(nodeId, newComm, std::memory_order_relaxed);
+                numMovedLocal++;
+            }
+        }
+        numMovedNodes.fetch_add(numMovedLocal);
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenLocalMovingVC>(state, numMovedNodes);
+    }
+
+private:
+    // The modularity gain of moving a node n from community c to d, multiplied by m, is
+    //   (edges_n in d) - (edges_n in c) - degree_n * (degree_d - (degree_c - degree_n)) / 2m
+    // See louvain.cpp for the derivation.
+    offset_t findBestComm(offset_t currComm, weight_t degree) const {
+        const auto currCommWeight = static_cast<double>(commWeights.at(currComm));
+        const auto currCommDegree = static_cast<double>(state.commWeightedDegrees.get(currComm,
+                                        std::memory_order_relaxed)) -
+                                    degree;
+        const auto degreeConstant = static_cast<double>(degree) / state.totalWeight;
+        auto bestComm = currComm;
+        double bestGain = 0;
+        for (const auto& [nbrComm, weight] : commWeights) {
+            if (nbrComm == currComm) {
+                continue;
+            }
+            const auto nbrCommDegree = static_cast<double>(
+                state.commWeightedDegrees.get(nbrComm, std::memory_order_relaxed));
+            const auto gain = static_cast<double>(weight) - currCommWeight -
+                              degreeConstant * (nbrCommDegree - currCommDegree);
+            if (gain > bestGain || (gain == bestGain && gain > 0 && nbrComm < bestComm)) {
+                bestGain = gain;
+                bestComm = nbrComm;
+            }
+        }
+        return bestComm;
+    }
+
+private:
+    LeidenState& state;
+    std::atomic<offset_t>& numMovedNodes;
+    std::unordered_map<offset_t, weight_t> commWeights;
+};
+
+// Merges nodes that are still alone in their refined sub-community into the refined sub-community
+// of a neighbor in the same community. A node only joins a sub-community through an edge to one
+// of its nodes, so sub-communities stay connected.
+class LeidenRefineVC final : public InMemParallelCompute {
+public:
+    explicit LeidenRefineVC(LeidenState& state) : state{state} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            if (!state.hasEdges(nodeId) ||
+                state.refinedCommSizes.get(nodeId, std::memory_order_relaxed) != 1) {
+                continue;
+            }
+            const auto currComm = state.comm.get(nodeId, std::memory_order_relaxed);
+            refinedCommWeights.clear();
+            weight_t currCommWeight = 0;
+            for (auto offset = state.graph.csrOffsets[nodeId];
+                 offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+                const auto& nbrEntry = state.graph.csrEdges[offset];
+                if (nbrEntry.neighbor == nodeId ||
+                    state.comm.get(nbrEntry.neighbor, std::memory_order_relaxed) != currComm) {
+                    continue;
+                }
+                currCommWeight += nbrEntry.weight;
+                refinedCommWeights[state.refinedComm.get(nbrEntry.neighbor,
+                    std::memory_order_relaxed)] += nbrEntry.weight;
+            }
+            const auto degree = static_cast<double>(state.nodeWeightedDegrees.get(nodeId));
+            const auto commDegree = static_cast<double>(
+                state.commWeightedDegrees.get(currComm, std::memory_order_relaxed));
+            // Only nodes that are well connected to the rest of their community are merged.
+            if (currCommWeight < degree * (commDegree - degree) / state.totalWeight) {
+                continue;
+            }
+            const auto newRefinedComm = findBestRefinedComm(nodeId, degree);
+            if (newRefinedComm == nodeId) {
+                continue;
+            }
+            // Claim the node, which fails if another node has joined its sub-community since.
+            offset_t expectedSize = 1;
+            if (!state.refinedCommSizes.compareExchange(nodeId, expectedSize, 0)) {
+                continue;
+            }
+            const auto nodeDegree = state.nodeWeightedDegrees.get(nodeId);
+            state.refinedCommSizes.fetchAdd(newRefinedComm, 1);
+            state.refinedCommWeightedDegrees.fetchAdd(newRefinedComm, nodeDegree);
+            state.refinedCommWeightedDegrees.fetchSub(nodeId, nodeDegree);
+            state.refinedComm.set(nodeId, newRefinedComm, std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenRefineVC>(state);
+    }
+
+private:
+    offset_t findBestRefinedComm(offset_t nodeId, double degree) const {
+        auto bestRefinedComm = nodeId;
+        double bestGain = 0;
+        for (const auto& [refinedComm, weight] : refinedCommWeights) {
+            if (refinedComm == nodeId) {
+                continue;
+            }
+            const auto refinedCommDegree = static_cast<double>(
+                state.refinedCommWeightedDegrees.get(refinedComm, std::memory_order_relaxed));
+            const auto gain =
+                static_cast<double>(weight) - degree * refinedCommDegree / state.totalWeight;
+            if (gain > bestGain ||
+                (gain == bestGain && gain > 0 && refinedComm < bestRefinedComm)) {
+                bestGain = gain;
+                bestRefinedComm = refinedComm;
+            }
+        }
+        return bestRefinedComm;
+    }
+
+private:
+    LeidenState& state;
+    std::unordered_map<offset_t, weight_t> refinedCommWeights;
+};
+
+// Maps each original node to the node of the current graph it has been aggregated into.
+class LeidenSaveAggregatesVC final : public InMemParallelCompute {
+public:
+    LeidenSaveAggregatesVC(std::vector<offset_t>& aggregates,
+        const std::vector<offset_t>& newNodeIds)
+        : aggregates{aggregates}, newNodeIds{newNodeIds} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            aggregates[nodeId] = newNodeIds[aggregates[nodeId]];
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<LeidenSaveAggregatesVC>(aggregates, newNodeIds);
+    }
+
+private:
+    std::vector<offset_t>& aggregates;
+    const std::vector<offset_t>& newNodeIds;
+};
+
+class LeidenWriteResultsVC final : public GDSResultVertexCompute {
+public:
+    LeidenWriteResultsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        const std::vector<offset_t>& aggregates, LeidenState& state)
+        : GDSResultVertexCompute{mm, sharedState}, aggregates{aggregates}, state{state} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        commIDVector = createVector(LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            commIDVector->setValue<int64_t>(0,
+                state.comm.get(aggregates[i], std::memory_order_relaxed));
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<LeidenWriteResultsVC>(mm, sharedState, aggregates, state);
+    }
+
+private:
+    const std::vector<offset_t>& aggregates;
+    LeidenState& state;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> commIDVector;
+};
+
+// Sequentially renumbers the refined sub-communities, each of which becomes a node of the next
+// phase. Returns the number of sub-communities.
+static offset_t renumberRefinedCommunities(LeidenState& state, std::vector<offset_t>& newNodeIds) {
+    const auto numNodes = state.graph.numNodes;
+    std::vector<offset_t> refinedCommIds(numNodes, INVALID_OFFSET);
+    offset_t numRefinedComms = 0;
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto refinedComm = state.refinedComm.get(nodeId, std::memory_order_relaxed);
+        if (refinedCommIds[refinedComm] == INVALID_OFFSET) {
+            refinedCommIds[refinedComm] = numRefinedComms++;
+        }
+        newNodeIds[nodeId] = refinedCommIds[refinedComm];
+    }
+    return numRefinedComms;
+}
+
+// Merges the nodes of each refined sub-community into a node, and sums up the weights of edges
+// within and across sub-communities. Each new node is put in the community of its nodes.
+static void aggregateRefinedCommunities(LeidenState& state,
+    const std::vector<offset_t>& newNodeIds, offset_t numNewNodes, MemoryManager* mm) {
+    const auto numNodes = state.graph.numNodes;
+    std::vector<std::unordered_map<offset_t, weight_t>> newEdges(numNewNodes);
+    std::vector<offset_t> newComms(numNewNodes);
+    std::vector<offset_t> commIds(numNodes, INVALID_OFFSET);
+    offset_t numComms = 0;
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto newNodeId = newNodeIds[nodeId];
+        const auto comm = state.comm.get(nodeId, std::memory_order_relaxed);
+        if (commIds[comm] == INVALID_OFFSET) {
+            commIds[comm] = numComms++;
+        }
+        newComms[newNodeId] = commIds[comm];
+        // Every edge is in the CSR of both of its nodes, and self-loops are in it once, so summing
+        // up the weights of all CSR entries keeps the weighted degree of each new node equal to
+        // the sum of the weighted degrees of its nodes.
+        for (auto offset = state.graph.csrOffsets[nodeId];
+             offset < state.graph.csrOffsets[nodeId + 1]; ++offset) {
+            const auto& nbrEntry = state.graph.csrEdges[offset];
+            newEdges[newNodeId][newNodeIds[nbrEntry.neighbor]] += nbrEntry.weight;
+        }
+    }
+    state.graph.reinit(numNewNodes);
+    for (auto nodeId = 0u; nodeId < numNewNodes; ++nodeId) {
+        state.graph.initNextNode();
+        for (const auto& [nbrId, weight] : newEdges[nodeId]) {
+            state.graph.insertNbr(nbrId, weight);
+        }
+    }
+    state.graph.initNextNode();
+    state.reallocate(numNewNodes, mm);
+    for (auto nodeId = 0u; nodeId < numNewNodes; ++nodeId) {
+        state.comm.set(nodeId, newComms[nodeId], std::memory_order_relaxed);
+    }
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*clientContext);
+    const auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto origNumNodes = graph->getMaxOffset(transaction, tableID);
+    auto bindData = input.bindData->constPtrCast<LeidenBindData>();
+    auto& config = bindData->optionalParams->constCast<LeidenOptionalParams>();
+    auto progressBar = ProgressBar::Get(*clientContext);
+    const auto maxPhases = config.maxPhases.getParamVal();
+    const auto maxIterations = config.maxIterations.getParamVal();
+
+    LeidenState state(origNumNodes, mm);
+    state.graph.initFromGraph(graph, tableID);
+    for (const auto& nbrEntry : state.graph.csrEdges) {
+        state.totalWeight += nbrEntry.weight;
+    }
+    LeidenInitCommVC initComm(state);
+    InMemGDSUtils::runParallelCompute(initComm, origNumNodes, input.context);
+    std::vector<offset_t> aggregates(origNumNodes);
+    std::iota(aggregates.begin(), aggregates.end(), 0);
+
+    for (auto phase = 0u; phase < maxPhases && state.totalWeight > 0; ++phase) {
+        const auto numNodes = state.graph.numNodes;
+        LeidenResetCommVC resetComm(state);
+        InMemGDSUtils::runParallelCompute(resetComm, numNodes, input.context);
+        LeidenInitPhaseVC initPhase(state);
+        InMemGDSUtils::runParallelCompute(initPhase, numNodes, input.context);
+
+        const auto maxNumMovedNodes = config.convergenceThreshold.getParamVal() * numNodes;
+        for (auto iter = 0u; iter < maxIterations; ++iter) {
+            std::atomic<offset_t> numMovedNodes{0};
+            LeidenLocalMovingVC localMoving(state, numMovedNodes);
+            InMemGDSUtils::runParallelCompute(localMoving, numNodes, input.context);
+            if (numMovedNodes.load() <= maxNumMovedNodes) {
+                break;
+            }
+        }
+
+        LeidenRefineVC refine(state);
+        InMemGDSUtils::runParallelCompute(refine, numNodes, input.context);
+        progressBar->updateProgress(input.context->queryID,
+            static_cast<double>(phase + 1) / maxPhases);
+
+        std::vector<offset_t> newNodeIds(numNodes);
+        const auto numNewNodes = renumberRefinedCommunities(state, newNodeIds);
+        if (numNewNodes == numNodes) {
+            // No node merged into a sub-community. The communities of this phase are final.
+            break;
+        }
+        LeidenSaveAggregatesVC saveAggregates(aggregates, newNodeIds);
+        InMemGDSUtils::runParallelCompute(saveAggregates, origNumNodes, input.context);
+        aggregateRefinedCommunities(state, newNodeIds, numNewNodes, mm);
+    }
+
+    const auto writeResults =
+        std::make_unique<LeidenWriteResultsVC>(mm, sharedState, aggregates, state);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *writeResults);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char LEIDEN_ID_COLUMN_NAME[] = "leiden_id";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw RuntimeException("Leiden only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw RuntimeException("Leiden only supports operations on one edge table.");
+    }
+    expression_vector columns;
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    columns.push_back(nodeOutput->constPtrCast<NodeExpression>()->getInternalID());
+    columns.push_back(input->binder->createVariable(LEIDEN_ID_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<LeidenBindData>(std::move(columns), std::move(graphEntry), nodeOutput,
+        std::make_unique<LeidenOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set LeidenFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace ryu
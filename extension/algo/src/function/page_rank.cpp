@@ -1,5 +1,7 @@
 #include "binder/binder.h"
 #include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
 #include "common/string_utils.h"
 #include "common/task_system/progress_bar.h"
 #include "function/algo_function.h"
@@ -26,26 +28,30 @@ struct PageRankOptionalParams final : public MaxIterationOptionalParams {
     OptionalParam<DampingFactor> dampingFactor;
     OptionalParam<Tolerance> tolerance;
     OptionalParam<NormalizeInitial> normalize;
+    OptionalParam<InitialRankProperty> initialRankProperty;
 
     explicit PageRankOptionalParams(const expression_vector& optionalParams);
 
     // For copy only
     PageRankOptionalParams(OptionalParam<MaxIterations> maxIterations,
         OptionalParam<DampingFactor> dampingFactor, OptionalParam<Tolerance> tolerance,
-        OptionalParam<NormalizeInitial> normalize)
+        OptionalParam<NormalizeInitial> normalize,
+        OptionalParam<InitialRankProperty> initialRankProperty)
         : MaxIterationOptionalParams{maxIterations}, dampingFactor{std::move(dampingFactor)},
-          tolerance{std::move(tolerance)}, normalize{std::move(normalize)} {}
+          tolerance{std::move(tolerance)}, normalize{std::move(normalize)},
+          initialRankProperty{std::move(initialRankProperty)} {}
 
     void evaluateParams(main::ClientContext* context) override {
         MaxIterationOptionalParams::evaluateParams(context);
         dampingFactor.evaluateParam(context);
         tolerance.evaluateParam(context);
         normalize.evaluateParam(context);
+        initialRankProperty.evaluateParam(context);
     }
 
     std::unique_ptr<function::OptionalParams> copy() override {
         return std::make_unique<PageRankOptionalParams>(maxIterations, dampingFactor, tolerance,
-            normalize);
+            normalize, initialRankProperty);
     }
 };
 
@@ -61,6 +67,8 @@ PageRankOptionalParams::PageRankOptionalParams(const expression_vector& optional
             tolerance = function::OptionalParam<Tolerance>(optionalParam);
         } else if (paramName == NormalizeInitial::NAME) {
             normalize = function::OptionalParam<NormalizeInitial>(optionalParam);
+        } else if (paramName == InitialRankProperty::NAME) {
+            initialRankProperty = function::OptionalParam<InitialRankProperty>(optionalParam);
         } else {
             throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
         }
@@ -118,37 +126,65 @@ private:
 
 class PageRankAuxiliaryState : public GDSAuxiliaryState {
 public:
-    PageRankAuxiliaryState(Degrees& degrees, PValues& pCurrent, PValues& pNext)
-        : degrees{degrees}, pCurrent{pCurrent}, pNext{pNext} {}
+    PageRankAuxiliaryState(PValues& pContribution, PValues& pNext)
+        : pContribution{pContribution}, pNext{pNext} {}
 
     void beginFrontierCompute(table_id_t fromTableID, table_id_t toTableID) override {
-        degrees.pinTable(toTableID);
-        pCurrent.pinTable(toTableID);
+        pContribution.pinTable(toTableID);
         pNext.pinTable(fromTableID);
     }
 
     void switchToDense(ExecutionContext*, Graph*) override {}
 
+private:
+    PValues& pContribution;
+    PValues& pNext;
+};
+
+// Compute the weight (current rank / degree) each node passes along its outgoing edges. Doing so
+// once per node, instead of once per edge, leaves a single random read per edge. Masked out nodes
+// are not skipped, as edges are read from them just as before.
+class PContributionVertexCompute : public GDSVertexCompute {
+public:
+    PContributionVertexCompute(Degrees& degrees, PValues& pCurrent, PValues& pContribution)
+        : GDSVertexCompute{nullptr}, degrees{degrees}, pCurrent{pCurrent},
+          pContribution{pContribution} {}
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        degrees.pinTable(tableID);
+        pCurrent.pinTable(tableID);
+        pContribution.pinTable(tableID);
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            auto degree = degrees.getValue(i);
+            pContribution.setValue(i, degree == 0 ? 0 : pCurrent.getValue(i) / degree);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<PContributionVertexCompute>(degrees, pCurrent, pContribution);
+    }
+
 private:
     Degrees& degrees;
     PValues& pCurrent;
-    PValues& pNext;
+    PValues& pContribution;
 };
 
-// Sum the weight (current rank / degree) for each incoming edge.
+// Sum the weight of each incoming edge.
 class PNextUpdateEdgeCompute : public EdgeCompute {
 public:
-    PNextUpdateEdgeCompute(Degrees& degrees, PValues& pCurrent, PValues& pNext)
-        : degrees{degrees}, pCurrent{pCurrent}, pNext{pNext} {}
+    PNextUpdateEdgeCompute(PValues& pContribution, PValues& pNext)
+        : pContribution{pContribution}, pNext{pNext} {}
 
     std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& chunk,
         bool) override {
         if (chunk.size() > 0) {
             double valToAdd = 0;
             chunk.forEach([&](auto neighbors, auto, auto i) {
-                auto nbrNodeID = neighbors[i];
-                valToAdd +=
-                    pCurrent.getValue(nbrNodeID.offset) / degrees.getValue(nbrNodeID.offset);
+                valToAdd += pContribution.getValue(neighbors[i].offset);
             });
             pNext.addValueCAS(boundNodeID.offset, valToAdd);
         }
@@ -156,12 +192,11 @@ public:
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<PNextUpdateEdgeCompute>(degrees, pCurrent, pNext);
+        return std::make_unique<PNextUpdateEdgeCompute>(pContribution, pNext);
     }
 
 private:
-    Degrees& degrees;
-    PValues& pCurrent;
+    PValues& pContribution;
     PValues& pNext;
 };
 
@@ -231,6 +266,52 @@ private:
     PValues& pNext;
 };
 
+// Warm starts ranks from a node property. Null properties keep the uniform initial rank.
+class PInitVertexCompute : public GDSVertexCompute {
+public:
+    PInitVertexCompute(PValues& pCurrent, NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, pCurrent{pCurrent} {}
+
+    void beginOnTableInternal(table_id_t tableID) override { pCurrent.pinTable(tableID); }
+
+    void vertexCompute(const VertexScanState::Chunk& chunk) override {
+        auto nodeIDs = chunk.getNodeIDs();
+        auto ranks = chunk.getProperties<double>(0);
+        for (auto i = 0u; i < chunk.size(); ++i) {
+            if (skip(nodeIDs[i].offset) || chunk.isNull(0, i)) {
+                continue;
+            }
+            pCurrent.setValue(nodeIDs[i].offset, ranks[i]);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<PInitVertexCompute>(pCurrent, nodeMask);
+    }
+
+private:
+    PValues& pCurrent;
+};
+
+static void initRanksFromProperty(ExecutionContext* context, GDSFuncSharedState* sharedState,
+    const std::string& propertyName, PValues& pCurrent) {
+    auto graph = sharedState->graph.get();
+    for (const auto& nodeInfo : graph->getGraphEntry()->nodeInfos) {
+        auto entry = nodeInfo.entry;
+        if (!entry->containsProperty(propertyName)) {
+            throw RuntimeException{stringFormat("Cannot find property: {}", propertyName)};
+        }
+        if (entry->getProperty(propertyName).getType().getLogicalTypeID() !=
+            LogicalTypeID::DOUBLE) {
+            throw RuntimeException{
+                stringFormat("Initial rank property must be of type DOUBLE: {}", propertyName)};
+        }
+        auto initVC = PInitVertexCompute(pCurrent, sharedState->getGraphNodeMaskMap());
+        GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, initVC, entry,
+            {propertyName});
+    }
+}
+
 class PageRankResultVertexCompute : public GDSResultVertexCompute {
 public:
     PageRankResultVertexCompute(storage::MemoryManager* mm, GDSFuncSharedState* sharedState,
@@ -277,8 +358,13 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto mm = MemoryManager::Get(*clientContext);
     auto p1 = PValues(maxOffsetMap, mm, initialValue);
     auto p2 = PValues(maxOffsetMap, mm, 0);
+    auto pContribution = PValues(maxOffsetMap, mm, 0);
     PValues* pCurrent = &p1;
     PValues* pNext = &p2;
+    if (!config.initialRankProperty.getParamVal().empty()) {
+        initRanksFromProperty(input.context, sharedState,
+            config.initialRankProperty.getParamVal(), *pCurrent);
+    }
     auto currentIter = 1u;
     auto currentFrontier =
         DenseFrontier::getVisitedFrontier(input.context, graph, sharedState->getGraphNodeMaskMap());
@@ -294,10 +380,11 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     while (currentIter < config.maxIterations.getParamVal()) {
         computeState.frontierPair->resetCurrentIter();
         computeState.frontierPair->setActiveNodesForNextIter();
-        computeState.edgeCompute =
-            std::make_unique<PNextUpdateEdgeCompute>(degrees, *pCurrent, *pNext);
+        auto pContributionVC = PContributionVertexCompute(degrees, *pCurrent, pContribution);
+        GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, pContributionVC);
+        computeState.edgeCompute = std::make_unique<PNextUpdateEdgeCompute>(pContribution, *pNext);
         computeState.auxiliaryState =
-            std::make_unique<PageRankAuxiliaryState>(degrees, *pCurrent, *pNext);
+            std::make_unique<PageRankAuxiliaryState>(pContribution, *pNext);
         GDSUtils::runAlgorithmEdgeCompute(input.context, computeState, graph, ExtendDirection::BWD,
             1);
         auto pNextUpdateVC = PNextUpdateVertexCompute(config.dampingFactor.getParamVal(),
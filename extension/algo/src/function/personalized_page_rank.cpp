@@ -0,0 +1,292 @@
+#include <deque>
+#include <unordered_set>
+
+#include "binder/binder.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "common/types/value/nested.h"
+#include "function/algo_function.h"
+#include "function/config/page_rank_config.h"
+#include "function/gds/gds.h"
+#include "function/table/bind_input.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::binder;
+using namespace ryu::catalog;
+using namespace ryu::common;
+using namespace ryu::processor;
+using namespace ryu::storage;
+using namespace ryu::graph;
+using namespace ryu::function;
+
+// Personalized PageRank from a set of source nodes, approximated with forward push (Andersen,
+// Chung and Lang, "Local Graph Partitioning using PageRank Vectors", FOCS 2006). Every node has an
+// estimate and a residual, and the residual mass of the sources starts at 1. Pushing a node moves
+// (1 - dampingFactor) of its residual to its estimate and spreads the rest evenly over its
+// out-neighbors. Only nodes whose residual is at least epsilon times their out-degree are pushed,
+// so the work is bounded by O(1 / ((1 - dampingFactor) * epsilon)) pushes regardless of the size
+// of the graph, and only the neighborhood of the sources is touched. As in PAGE_RANK, the residual
+// of nodes without out-neighbors is not redistributed.
+
+namespace ryu {
+namespace algo_extension {
+
+struct PersonalizedPageRankOptionalParams final : public function::OptionalParams {
+    OptionalParam<DampingFactor> dampingFactor;
+    OptionalParam<Epsilon> epsilon;
+
+    explicit PersonalizedPageRankOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    PersonalizedPageRankOptionalParams(OptionalParam<DampingFactor> dampingFactor,
+        OptionalParam<Epsilon> epsilon)
+        : dampingFactor{std::move(dampingFactor)}, epsilon{std::move(epsilon)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        dampingFactor.evaluateParam(context);
+        epsilon.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<PersonalizedPageRankOptionalParams>(dampingFactor, epsilon);
+    }
+};
+
+PersonalizedPageRankOptionalParams::PersonalizedPageRankOptionalParams(
+    const expression_vector& optionalParams) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == DampingFactor::NAME) {
+            dampingFactor = function::OptionalParam<DampingFactor>(optionalParam);
+        } else if (paramName == Epsilon::NAME) {
+            epsilon = function::OptionalParam<Epsilon>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct PersonalizedPageRankBindData final : public GDSBindData {
+    // Primary keys of the source nodes.
+    std::vector<Value> sourceKeys;
+
+    PersonalizedPageRankBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput, std::vector<Value> sourceKeys,
+        std::unique_ptr<PersonalizedPageRankOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}},
+          sourceKeys{std::move(sourceKeys)} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<PersonalizedPageRankBindData>(*this);
+    }
+};
+
+// Sparse forward push state. Out-neighbors are scanned at most once per touched node.
+class ForwardPush {
+public:
+    ForwardPush(Graph* graph, table_id_t tableID, double dampingFactor, double epsilon)
+        : graph{graph}, tableID{tableID}, dampingFactor{dampingFactor}, epsilon{epsilon} {
+        auto relInfo = graph->getRelInfos(tableID)[0];
+        KU_ASSERT(relInfo.srcTableID == relInfo.dstTableID);
+        scanState = graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+            relInfo.dstTableID, {});
+    }
+
+    void addSource(offset_t offset, double residual) { addResidual(offset, residual); }
+
+    void run(main::ClientContext* context) {
+        while (!queue.empty()) {
+            if (context->interrupted()) {
+                throw InterruptException{};
+            }
+            auto offset = queue.front();
+            queue.pop_front();
+            queued.erase(offset);
+            push(offset);
+        }
+    }
+
+    const std::unordered_map<offset_t, double>& getEstimates() const { return estimates; }
+
+private:
+    void push(offset_t offset) {
+        auto residual = residuals[offset];
+        residuals[offset] = 0;
+        estimates[offset] += (1 - dampingFactor) * residual;
+        const auto& nbrs = getNbrs(offset);
+        if (nbrs.empty()) {
+            return;
+        }
+        auto residualPerNbr = dampingFactor * residual / nbrs.size();
+        for (auto nbr : nbrs) {
+            addResidual(nbr, residualPerNbr);
+        }
+    }
+
+    void addResidual(offset_t offset, double residual) {
+        auto& nodeResidual = residuals[offset];
+        nodeResidual += residual;
+        if (queued.contains(offset)) {
+            return;
+        }
+        // Nodes without out-neighbors are pushed once to keep their share of the residual.
+        auto degree = getNbrs(offset).size();
+        if (nodeResidual >= epsilon * std::max<size_t>(degree, 1)) {
+            queue.push_back(offset);
+            queued.insert(offset);
+        }
+    }
+
+    const std::vector<offset_t>& getNbrs(offset_t offset) {
+        auto it = nbrsCache.find(offset);
+        if (it != nbrsCache.end()) {
+            return it->second;
+        }
+        std::vector<offset_t> nbrs;
+        for (auto chunk : graph->scanFwd(nodeID_t{offset, tableID}, *scanState)) {
+            chunk.forEach(
+                [&](auto neighbors, auto, auto i) { nbrs.push_back(neighbors[i].offset); });
+        }
+        return nbrsCache.emplace(offset, std::move(nbrs)).first->second;
+    }
+
+private:
+    Graph* graph;
+    table_id_t tableID;
+    double dampingFactor;
+    double epsilon;
+    std::unique_ptr<NbrScanState> scanState;
+    std::unordered_map<offset_t, double> estimates;
+    std::unordered_map<offset_t, double> residuals;
+    std::unordered_map<offset_t, std::vector<offset_t>> nbrsCache;
+    std::deque<offset_t> queue;
+    std::unordered_set<offset_t> queued;
+};
+
+static offset_t lookupSource(main::ClientContext* context, table_id_t tableID,
+    const Value& sourceKey) {
+    auto& nodeTable = StorageManager::Get(*context)->getTable(tableID)->cast<NodeTable>();
+    auto keyVector = ValueVector(sourceKey.getDataType().copy(), MemoryManager::Get(*context));
+    keyVector.state = DataChunkState::getSingleValueDataChunkState();
+    keyVector.copyFromValue(0, sourceKey);
+    offset_t offset = INVALID_OFFSET;
+    if (!nodeTable.lookupPK(transaction::Transaction::Get(*context), &keyVector, 0 /* vectorPos */,
+            offset)) {
+        throw RuntimeException{
+            stringFormat("Cannot find source node with primary key {}.", sourceKey.toString())};
+    }
+    return offset;
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    auto tableID = graph->getNodeTableIDs()[0];
+    auto bindData = input.bindData->constPtrCast<PersonalizedPageRankBindData>();
+    auto& config = bindData->optionalParams->constCast<PersonalizedPageRankOptionalParams>();
+    auto forwardPush = ForwardPush(graph, tableID, config.dampingFactor.getParamVal(),
+        config.epsilon.getParamVal());
+    for (const auto& sourceKey : bindData->sourceKeys) {
+        forwardPush.addSource(lookupSource(clientContext, tableID, sourceKey),
+            1.0 / bindData->sourceKeys.size());
+    }
+    forwardPush.run(clientContext);
+    // Only nodes reached by the push are in the output.
+    auto mm = MemoryManager::Get(*clientContext);
+    auto nodeIDVector = ValueVector(LogicalType::INTERNAL_ID(), mm);
+    auto rankVector = ValueVector(LogicalType::DOUBLE(), mm);
+    nodeIDVector.state = DataChunkState::getSingleValueDataChunkState();
+    rankVector.state = DataChunkState::getSingleValueDataChunkState();
+    std::vector<ValueVector*> vectors{&nodeIDVector, &rankVector};
+    auto localFT = sharedState->factorizedTablePool.claimLocalTable(mm);
+    for (const auto& [offset, estimate] : forwardPush.getEstimates()) {
+        nodeIDVector.setValue<nodeID_t>(0, nodeID_t{offset, tableID});
+        rankVector.setValue<double>(0, estimate);
+        localFT->append(vectors);
+    }
+    sharedState->factorizedTablePool.returnLocalTable(localFT);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char RANK_COLUMN_NAME[] = "rank";
+
+static std::vector<Value> bindSourceKeys(const TableFuncBindInput& input,
+    const NodeTableCatalogEntry& nodeEntry) {
+    auto sources = input.getValue(1);
+    if (sources.getDataType().getLogicalTypeID() != LogicalTypeID::LIST) {
+        throw BinderException{
+            "Personalized PageRank expects a list of source node primary keys."};
+    }
+    auto numSources = NestedVal::getChildrenSize(&sources);
+    if (numSources == 0) {
+        throw BinderException{"Personalized PageRank requires at least one source node."};
+    }
+    const auto& pkType = nodeEntry.getPrimaryKeyDefinition().getType();
+    std::vector<Value> sourceKeys;
+    for (auto i = 0u; i < numSources; ++i) {
+        auto sourceKey = *NestedVal::getChildVal(&sources, i);
+        if (sourceKey.isNull()) {
+            throw BinderException{"Source node primary keys cannot be null."};
+        }
+        if (sourceKey.getDataType() != pkType) {
+            throw BinderException{stringFormat("Source node primary keys must be of type {}.",
+                pkType.toString())};
+        }
+        sourceKeys.push_back(std::move(sourceKey));
+    }
+    return sourceKeys;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw BinderException(
+            "Personalized PageRank only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw BinderException(
+            "Personalized PageRank only supports operations on one edge table.");
+    }
+    auto sourceKeys =
+        bindSourceKeys(*input, graphEntry.nodeInfos[0].entry->constCast<NodeTableCatalogEntry>());
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(RANK_COLUMN_NAME, LogicalType::DOUBLE()));
+    return std::make_unique<PersonalizedPageRankBindData>(std::move(columns),
+        std::move(graphEntry), nodeOutput, std::move(sourceKeys),
+        std::make_unique<PersonalizedPageRankOptionalParams>(input->optionalParamsLegacy));
+}
+
+function_set PersonalizedPageRankFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(PersonalizedPageRankFunction::name,
+        std::vector<LogicalTypeID>{LogicalTypeID::ANY, LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace ryu
@@ -0,0 +1,294 @@
+#include <random>
+
+#include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/string_utils.h"
+#include "function/algo_function.h"
+#include "function/config/random_walk_config.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/hash/hash_functions.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+using namespace ryu::processor;
+using namespace ryu::storage;
+using namespace ryu::graph;
+using namespace ryu::function;
+
+// Generates random walks along the forward rels of the projected graph, in parallel over start
+// node morsels. Each walk is returned as one row per node, with the id of the walk and the
+// position of the node in it.
+//
+// NODE2VEC biases each step by the previous node t of the walk (Grover and Leskovec, "node2vec:
+// Scalable Feature Learning for Networks", KDD 2016): stepping back to t has weight 1/p, stepping
+// to a neighbor of t has weight 1 and stepping elsewhere has weight 1/q. Instead of precomputing
+// alias tables for every edge, steps are drawn by rejection sampling (Yang et al., "KnightKing: A
+// Fast Distributed Graph Random Walk Engine", SOSP 2019): a uniformly sampled neighbor is accepted
+// with probability weight / maxWeight, checking adjacency to t with a binary search in the sorted
+// neighbors of t.
+
+namespace ryu {
+namespace algo_extension {
+
+struct RandomWalkOptionalParams final : public function::OptionalParams {
+    OptionalParam<WalkLength> walkLength;
+    OptionalParam<WalksPerNode> walksPerNode;
+    OptionalParam<ReturnParameter> p;
+    OptionalParam<InOutParameter> q;
+    OptionalParam<RandomSeed> randomSeed;
+
+    RandomWalkOptionalParams(const expression_vector& optionalParams, bool biased);
+
+    // For copy only
+    RandomWalkOptionalParams(OptionalParam<WalkLength> walkLength,
+        OptionalParam<WalksPerNode> walksPerNode, OptionalParam<ReturnParameter> p,
+        OptionalParam<InOutParameter> q, OptionalParam<RandomSeed> randomSeed)
+        : walkLength{std::move(walkLength)}, walksPerNode{std::move(walksPerNode)},
+          p{std::move(p)}, q{std::move(q)}, randomSeed{std::move(randomSeed)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        walkLength.evaluateParam(context);
+        walksPerNode.evaluateParam(context);
+        p.evaluateParam(context);
+        q.evaluateParam(context);
+        randomSeed.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<RandomWalkOptionalParams>(walkLength, walksPerNode, p, q,
+            randomSeed);
+    }
+};
+
+RandomWalkOptionalParams::RandomWalkOptionalParams(const expression_vector& optionalParams,
+    bool biased) {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == WalkLength::NAME) {
+            walkLength = function::OptionalParam<WalkLength>(optionalParam);
+        } else if (paramName == WalksPerNode::NAME) {
+            walksPerNode = function::OptionalParam<WalksPerNode>(optionalParam);
+        } else if (paramName == RandomSeed::NAME) {
+            randomSeed = function::OptionalParam<RandomSeed>(optionalParam);
+        } else if (biased && paramName == ReturnParameter::NAME) {
+            p = function::OptionalParam<ReturnParameter>(optionalParam);
+        } else if (biased && paramName == InOutParameter::NAME) {
+            q = function::OptionalParam<InOutParameter>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
+struct RandomWalkBindData final : public GDSBindData {
+    RandomWalkBindData(expression_vector columns, graph::NativeGraphEntry graphEntry,
+        std::shared_ptr<Expression> nodeOutput,
+        std::unique_ptr<RandomWalkOptionalParams> optionalParams)
+        : GDSBindData{std::move(columns), std::move(graphEntry), expression_vector{nodeOutput}} {
+        this->optionalParams = std::move(optionalParams);
+    }
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<RandomWalkBindData>(*this);
+    }
+};
+
+struct RandomWalkConfig {
+    int64_t walkLength;
+    int64_t walksPerNode;
+    double p;
+    double q;
+    int64_t randomSeed;
+
+    explicit RandomWalkConfig(const RandomWalkOptionalParams& params)
+        : walkLength{params.walkLength.getParamVal()},
+          walksPerNode{params.walksPerNode.getParamVal()}, p{params.p.getParamVal()},
+          q{params.q.getParamVal()}, randomSeed{params.randomSeed.getParamVal()} {}
+
+    bool isBiased() const { return p != 1 || q != 1; }
+};
+
+class RandomWalkVertexCompute final : public GDSResultVertexCompute {
+public:
+    RandomWalkVertexCompute(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        const RandomWalkConfig& config)
+        : GDSResultVertexCompute{mm, sharedState}, config{config} {
+        auto graph = sharedState->graph.get();
+        auto relInfo = graph->getRelInfos(graph->getNodeTableIDs()[0])[0];
+        KU_ASSERT(relInfo.srcTableID == relInfo.dstTableID);
+        scanState = graph->prepareRelScan(*relInfo.relGroupEntry, relInfo.relTableID,
+            relInfo.dstTableID, {});
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        walkIDVector = createVector(LogicalType::INT64());
+        stepVector = createVector(LogicalType::INT64());
+    }
+
+    void beginOnTableInternal(table_id_t) override {}
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            if (skip(i)) {
+                continue;
+            }
+            for (auto j = 0; j < config.walksPerNode; ++j) {
+                walk(nodeID_t{i, tableID}, i * config.walksPerNode + j);
+            }
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<RandomWalkVertexCompute>(mm, sharedState, config);
+    }
+
+private:
+    void walk(nodeID_t startNodeID, int64_t walkID) {
+        // Seeding each walk by its id keeps walks independent of how nodes are split over threads.
+        rng.seed(murmurhash64(config.randomSeed) ^ murmurhash64(walkID));
+        auto curNodeID = startNodeID;
+        auto prevOffset = INVALID_OFFSET;
+        appendStep(walkID, 0, curNodeID);
+        for (auto step = 1; step < config.walkLength; ++step) {
+            scanNbrs(curNodeID);
+            if (curNbrs.empty()) {
+                break;
+            }
+            // The first step has no previous node to bias by.
+            auto nextOffset =
+                step > 1 && config.isBiased() ? sampleBiased(prevOffset) : sampleUniformly();
+            prevOffset = curNodeID.offset;
+            std::swap(prevNbrs, curNbrs);
+            curNodeID = nodeID_t{nextOffset, curNodeID.tableID};
+            appendStep(walkID, step, curNodeID);
+        }
+    }
+
+    void scanNbrs(nodeID_t nodeID) {
+        curNbrs.clear();
+        for (auto chunk : sharedState->graph->scanFwd(nodeID, *scanState)) {
+            chunk.forEach(
+                [&](auto neighbors, auto, auto i) { curNbrs.push_back(neighbors[i].offset); });
+        }
+        if (config.isBiased()) {
+            std::sort(curNbrs.begin(), curNbrs.end());
+        }
+    }
+
+    offset_t sampleUniformly() {
+        return curNbrs[std::uniform_int_distribution<size_t>(0, curNbrs.size() - 1)(rng)];
+    }
+
+    offset_t sampleBiased(offset_t prevOffset) {
+        const auto returnWeight = 1 / config.p;
+        const auto outWeight = 1 / config.q;
+        const auto maxWeight = std::max({returnWeight, 1.0, outWeight});
+        std::uniform_real_distribution<double> acceptDist(0, maxWeight);
+        while (true) {
+            auto candidate = sampleUniformly();
+            double weight = 0;
+            if (candidate == prevOffset) {
+                weight = returnWeight;
+            } else if (std::binary_search(prevNbrs.begin(), prevNbrs.end(), candidate)) {
+                weight = 1;
+            } else {
+                weight = outWeight;
+            }
+            if (acceptDist(rng) < weight) {
+                return candidate;
+            }
+        }
+    }
+
+    void appendStep(int64_t walkID, int64_t step, nodeID_t nodeID) {
+        nodeIDVector->setValue<nodeID_t>(0, nodeID);
+        walkIDVector->setValue<int64_t>(0, walkID);
+        stepVector->setValue<int64_t>(0, step);
+        localFT->append(vectors);
+    }
+
+private:
+    RandomWalkConfig config;
+    std::unique_ptr<NbrScanState> scanState;
+    std::mt19937_64 rng;
+    std::vector<offset_t> curNbrs;
+    std::vector<offset_t> prevNbrs;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> walkIDVector;
+    std::unique_ptr<ValueVector> stepVector;
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto clientContext = input.context->clientContext;
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto graph = sharedState->graph.get();
+    auto bindData = input.bindData->constPtrCast<RandomWalkBindData>();
+    auto config =
+        RandomWalkConfig(bindData->optionalParams->constCast<RandomWalkOptionalParams>());
+    auto vc = RandomWalkVertexCompute(MemoryManager::Get(*clientContext), sharedState, config);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, vc);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char WALK_ID_COLUMN_NAME[] = "walk_id";
+static constexpr char STEP_COLUMN_NAME[] = "step";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input, const std::string& functionName, bool biased) {
+    auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw BinderException(functionName + " only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw BinderException(functionName + " only supports operations on one edge table.");
+    }
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    expression_vector columns;
+    columns.push_back(nodeOutput->constCast<NodeExpression>().getInternalID());
+    columns.push_back(input->binder->createVariable(WALK_ID_COLUMN_NAME, LogicalType::INT64()));
+    columns.push_back(input->binder->createVariable(STEP_COLUMN_NAME, LogicalType::INT64()));
+    return std::make_unique<RandomWalkBindData>(std::move(columns), std::move(graphEntry),
+        nodeOutput,
+        std::make_unique<RandomWalkOptionalParams>(input->optionalParamsLegacy, biased));
+}
+
+static std::unique_ptr<TableFunction> getFunction(const std::string& name,
+    table_func_bind_t bindFunc) {
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = std::move(bindFunc);
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    return func;
+}
+
+static std::unique_ptr<TableFuncBindData> bindRandomWalkFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, RandomWalkFunction::name, false /* biased */);
+}
+
+static std::unique_ptr<TableFuncBindData> bindNode2VecFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindFunc(context, input, Node2VecFunction::name, true /* biased */);
+}
+
+function_set RandomWalkFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getFunction(name, bindRandomWalkFunc));
+    return result;
+}
+
+function_set Node2VecFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(getFunction(name, bindNode2VecFunc));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace ryu
@@ -0,0 +1,339 @@
+#include <algorithm>
+#include <span>
+
+#include "binder/binder.h"
+#include "common/exception/runtime.h"
+#include "common/in_mem_gds_utils.h"
+#include "common/in_mem_graph.h"
+#include "common/task_system/progress_bar.h"
+#include "function/algo_function.h"
+#include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
+#include "function/table/bind_input.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+using namespace ryu::processor;
+using namespace ryu::storage;
+using namespace ryu::function;
+
+// Triangle counting on the undirected simple graph underlying the projected graph (rel directions,
+// multi-edges and self-loops are ignored). Each edge is oriented from the endpoint of lower degree
+// to the endpoint of higher degree, so that every triangle is found exactly once, from its lowest
+// ranked node, by intersecting the sorted out-neighbors of the two endpoints of each oriented edge.
+// Orienting by degree bounds the out-degree of every node by O(sqrt(numEdges)).
+
+namespace ryu {
+namespace algo_extension {
+
+// Intersections switch from merging to galloping when one list is this many times longer.
+static constexpr offset_t GALLOPING_SIZE_RATIO = 32;
+
+// Sorts the neighbors of each node and computes its degree in the simple graph.
+class SortNeighborsVC final : public InMemParallelCompute {
+public:
+    SortNeighborsVC(InMemGraph& graph, ku_vector_t<offset_t>& degrees)
+        : graph{graph}, degrees{degrees} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            const auto begin = graph.csrEdges.begin() + graph.csrOffsets[nodeId];
+            const auto end = graph.csrEdges.begin() + graph.csrOffsets[nodeId + 1];
+            std::sort(begin, end,
+                [](const Neighbor& a, const Neighbor& b) { return a.neighbor < b.neighbor; });
+            offset_t degree = 0;
+            for (auto it = begin; it != end; ++it) {
+                if (it->neighbor != nodeId && (it == begin || it->neighbor != (it - 1)->neighbor)) {
+                    degree++;
+                }
+            }
+            degrees[nodeId] = degree;
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<SortNeighborsVC>(graph, degrees);
+    }
+
+private:
+    InMemGraph& graph;
+    ku_vector_t<offset_t>& degrees;
+};
+
+// Collects the distinct neighbors of each node that are ranked higher than the node. Runs twice:
+// first to count them (when `outNbrs` is null), then to write them at `outOffsets`.
+class OrientEdgesVC final : public InMemParallelCompute {
+public:
+    OrientEdgesVC(const InMemGraph& graph, const ku_vector_t<offset_t>& degrees,
+        ku_vector_t<offset_t>& outOffsets, ku_vector_t<offset_t>* outNbrs)
+        : graph{graph}, degrees{degrees}, outOffsets{outOffsets}, outNbrs{outNbrs} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            auto pos = outNbrs == nullptr ? 0 : outOffsets[nodeId];
+            auto prevNbr = INVALID_OFFSET;
+            for (auto offset = graph.csrOffsets[nodeId]; offset < graph.csrOffsets[nodeId + 1];
+                 ++offset) {
+                const auto nbr = graph.csrEdges[offset].neighbor;
+                if (nbr == prevNbr || !isRankedLower(nodeId, nbr)) {
+                    continue;
+                }
+                prevNbr = nbr;
+                if (outNbrs != nullptr) {
+                    (*outNbrs)[pos] = nbr;
+                }
+                pos++;
+            }
+            if (outNbrs == nullptr) {
+                outOffsets[nodeId] = pos;
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<OrientEdgesVC>(graph, degrees, outOffsets, outNbrs);
+    }
+
+private:
+    bool isRankedLower(offset_t nodeId, offset_t nbr) const {
+        return degrees[nodeId] < degrees[nbr] || (degrees[nodeId] == degrees[nbr] && nodeId < nbr);
+    }
+
+private:
+    const InMemGraph& graph;
+    const ku_vector_t<offset_t>& degrees;
+    ku_vector_t<offset_t>& outOffsets;
+    ku_vector_t<offset_t>* outNbrs;
+};
+
+class CountTrianglesVC final : public InMemParallelCompute {
+public:
+    CountTrianglesVC(const ku_vector_t<offset_t>& outOffsets, const ku_vector_t<offset_t>& outNbrs,
+        AtomicObjectArray<uint64_t>& triangleCounts)
+        : outOffsets{outOffsets}, outNbrs{outNbrs}, triangleCounts{triangleCounts} {}
+
+    void parallelCompute(const offset_t startOffset, const offset_t endOffset,
+        const std::optional<table_id_t>&) override {
+        for (auto nodeId = startOffset; nodeId < endOffset; ++nodeId) {
+            uint64_t numTriangles = 0;
+            const auto nbrs = getOutNbrs(nodeId);
+            for (const auto nbr : nbrs) {
+                uint64_t numNbrTriangles = 0;
+                intersect(nbrs, getOutNbrs(nbr), [&](offset_t third) {
+                    numNbrTriangles++;
+                    triangleCounts.fetchAdd(third, 1, std::memory_order_relaxed);
+                });
+                if (numNbrTriangles > 0) {
+                    numTriangles += numNbrTriangles;
+                    triangleCounts.fetchAdd(nbr, numNbrTriangles, std::memory_order_relaxed);
+                }
+            }
+            if (numTriangles > 0) {
+                triangleCounts.fetchAdd(nodeId, numTriangles, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::unique_ptr<InMemParallelCompute> copy() override {
+        return std::make_unique<CountTrianglesVC>(outOffsets, outNbrs, triangleCounts);
+    }
+
+private:
+    std::span<const offset_t> getOutNbrs(offset_t nodeId) const {
+        return {outNbrs.begin() + outOffsets[nodeId], outOffsets[nodeId + 1] - outOffsets[nodeId]};
+    }
+
+    template<typename Func>
+    static void intersect(std::span<const offset_t> a, std::span<const offset_t> b, Func&& func) {
+        if (a.size() > b.size()) {
+            std::swap(a, b);
+        }
+        if (a.empty()) {
+            return;
+        }
+        if (b.size() / a.size() >= GALLOPING_SIZE_RATIO) {
+            gallopingIntersect(a.data(), a.size(), b.data(), b.size(), func);
+        } else {
+            mergeIntersect(a.data(), a.size(), b.data(), b.size(), func);
+        }
+    }
+
+    // Advances both sides without data dependent branches, except on matches.
+    template<typename Func>
+    static void mergeIntersect(const offset_t* a, offset_t sizeA, const offset_t* b,
+        offset_t sizeB, Func&& func) {
+        offset_t i = 0, j = 0;
+        while (i < sizeA && j < sizeB) {
+            const auto valA = a[i];
+            const auto valB = b[j];
+            if (valA == valB) {
+                func(valA);
+            }
+            i += valA <= valB;
+            j += valB <= valA;
+        }
+    }
+
+    // Looks up each value of the short list `a` in the long list `b` with an exponential search
+    // starting from the position of the previous value.
+    template<typename Func>
+    static void gallopingIntersect(const offset_t* a, offset_t sizeA, const offset_t* b,
+        offset_t sizeB, Func&& func) {
+        offset_t lo = 0;
+        for (auto i = 0u; i < sizeA && lo < sizeB; ++i) {
+            const auto val = a[i];
+            offset_t step = 1;
+            auto hi = lo;
+            while (hi < sizeB && b[hi] < val) {
+                lo = hi + 1;
+                hi += step;
+                step <<= 1;
+            }
+            lo = std::lower_bound(b + lo, b + std::min(hi, sizeB), val) - b;
+            if (lo < sizeB && b[lo] == val) {
+                func(val);
+                lo++;
+            }
+        }
+    }
+
+private:
+    const ku_vector_t<offset_t>& outOffsets;
+    const ku_vector_t<offset_t>& outNbrs;
+    AtomicObjectArray<uint64_t>& triangleCounts;
+};
+
+class WriteTriangleCountsVC final : public GDSResultVertexCompute {
+public:
+    WriteTriangleCountsVC(MemoryManager* mm, GDSFuncSharedState* sharedState,
+        const ku_vector_t<offset_t>& degrees, AtomicObjectArray<uint64_t>& triangleCounts)
+        : GDSResultVertexCompute{mm, sharedState}, degrees{degrees},
+          triangleCounts{triangleCounts} {
+        nodeIDVector = createVector(LogicalType::INTERNAL_ID());
+        triangleCountVector = createVector(LogicalType::INT64());
+        coefficientVector = createVector(LogicalType::DOUBLE());
+    }
+
+    void beginOnTableInternal(table_id_t /*tableID*/) override {}
+
+    void vertexCompute(const offset_t startOffset, const offset_t endOffset,
+        const table_id_t tableID) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            const auto numTriangles = triangleCounts.get(i, std::memory_order_relaxed);
+            const auto degree = degrees[i];
+            // The fraction of pairs of neighbors that are connected.
+            auto coefficient = 0.0;
+            if (degree >= 2) {
+                coefficient = 2.0 * numTriangles / (static_cast<double>(degree) * (degree - 1));
+            }
+            nodeIDVector->setValue<nodeID_t>(0, nodeID_t{i, tableID});
+            triangleCountVector->setValue<int64_t>(0, numTriangles);
+            coefficientVector->setValue<double>(0, coefficient);
+            localFT->append(vectors);
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WriteTriangleCountsVC>(mm, sharedState, degrees, triangleCounts);
+    }
+
+private:
+    const ku_vector_t<offset_t>& degrees;
+    AtomicObjectArray<uint64_t>& triangleCounts;
+    std::unique_ptr<ValueVector> nodeIDVector;
+    std::unique_ptr<ValueVector> triangleCountVector;
+    std::unique_ptr<ValueVector> coefficientVector;
+};
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
+    auto mm = MemoryManager::Get(*clientContext);
+    const auto graph = sharedState->graph.get();
+    KU_ASSERT(graph->getNodeTableIDs().size() == 1);
+    const auto tableID = graph->getNodeTableIDs()[0];
+    const auto numNodes = graph->getMaxOffset(transaction, tableID);
+    auto progressBar = ProgressBar::Get(*clientContext);
+
+    InMemGraph inMemGraph(numNodes, mm);
+    inMemGraph.initFromGraph(graph, tableID);
+    ku_vector_t<offset_t> degrees(mm, numNodes);
+    SortNeighborsVC sortNeighbors(inMemGraph, degrees);
+    InMemGDSUtils::runParallelCompute(sortNeighbors, numNodes, input.context);
+
+    // Builds the CSR of the oriented graph.
+    ku_vector_t<offset_t> outOffsets(mm, numNodes + 1);
+    OrientEdgesVC countOutNbrs(inMemGraph, degrees, outOffsets, nullptr /*outNbrs*/);
+    InMemGDSUtils::runParallelCompute(countOutNbrs, numNodes, input.context);
+    offset_t numOutNbrs = 0;
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        const auto numNodeOutNbrs = outOffsets[nodeId];
+        outOffsets[nodeId] = numOutNbrs;
+        numOutNbrs += numNodeOutNbrs;
+    }
+    outOffsets[numNodes] = numOutNbrs;
+    ku_vector_t<offset_t> outNbrs(mm, numOutNbrs);
+    OrientEdgesVC writeOutNbrs(inMemGraph, degrees, outOffsets, &outNbrs);
+    InMemGDSUtils::runParallelCompute(writeOutNbrs, numNodes, input.context);
+    progressBar->updateProgress(input.context->queryID, 0.5);
+
+    AtomicObjectArray<uint64_t> triangleCounts(numNodes, mm);
+    for (auto nodeId = 0u; nodeId < numNodes; ++nodeId) {
+        triangleCounts.set(nodeId, 0, std::memory_order_relaxed);
+    }
+    CountTrianglesVC countTriangles(outOffsets, outNbrs, triangleCounts);
+    InMemGDSUtils::runParallelCompute(countTriangles, numNodes, input.context);
+    progressBar->updateProgress(input.context->queryID, 1);
+
+    const auto writeResults =
+        std::make_unique<WriteTriangleCountsVC>(mm, sharedState, degrees, triangleCounts);
+    GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *writeResults);
+    sharedState->factorizedTablePool.mergeLocalTables();
+    return 0;
+}
+
+static constexpr char TRIANGLE_COUNT_COLUMN_NAME[] = "triangle_count";
+static constexpr char COEFFICIENT_COLUMN_NAME[] = "local_clustering_coefficient";
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto graphName = input->getLiteralVal<std::string>(0);
+    auto graphEntry = GDSFunction::bindGraphEntry(*context, graphName);
+    if (graphEntry.nodeInfos.size() != 1) {
+        throw RuntimeException("Triangle count only supports operations on one node table.");
+    }
+    if (graphEntry.relInfos.size() != 1) {
+        throw RuntimeException("Triangle count only supports operations on one edge table.");
+    }
+    expression_vector columns;
+    auto nodeOutput = GDSFunction::bindNodeOutput(*input, graphEntry.getNodeEntries());
+    columns.push_back(nodeOutput->constPtrCast<NodeExpression>()->getInternalID());
+    columns.push_back(
+        input->binder->createVariable(TRIANGLE_COUNT_COLUMN_NAME, LogicalType::INT64()));
+    columns.push_back(
+        input->binder->createVariable(COEFFICIENT_COLUMN_NAME, LogicalType::DOUBLE()));
+    return std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry),
+        expression_vector{nodeOutput});
+}
+
+function_set TriangleCountFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::ANY});
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = GDSFunction::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = [] { return false; };
+    func->getLogicalPlanFunc = GDSFunction::getLogicalPlan;
+    func->getPhysicalPlanFunc = GDSFunction::getPhysicalPlan;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace algo_extension
+} // namespace ryu
@@ -1,9 +1,14 @@
 #include "binder/binder.h"
+#include "common/exception/binder.h"
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
 #include "function/algo_function.h"
 #include "function/component_ids.h"
 #include "function/config/connected_components_config.h"
 #include "function/config/max_iterations_config.h"
 #include "function/gds/gds_utils.h"
+#include "function/gds/gds_vertex_compute.h"
 #include "function/table/bind_input.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
@@ -18,6 +23,42 @@ using namespace ryu::function;
 namespace ryu {
 namespace algo_extension {
 
+struct WCCOptionalParams final : public MaxIterationOptionalParams {
+    OptionalParam<InitialComponentProperty> initialComponentProperty;
+
+    explicit WCCOptionalParams(const expression_vector& optionalParams);
+
+    // For copy only
+    WCCOptionalParams(OptionalParam<MaxIterations> maxIterations,
+        OptionalParam<InitialComponentProperty> initialComponentProperty)
+        : MaxIterationOptionalParams{maxIterations},
+          initialComponentProperty{std::move(initialComponentProperty)} {}
+
+    void evaluateParams(main::ClientContext* context) override {
+        MaxIterationOptionalParams::evaluateParams(context);
+        initialComponentProperty.evaluateParam(context);
+    }
+
+    std::unique_ptr<function::OptionalParams> copy() override {
+        return std::make_unique<WCCOptionalParams>(maxIterations, initialComponentProperty);
+    }
+};
+
+WCCOptionalParams::WCCOptionalParams(const expression_vector& optionalParams)
+    : MaxIterationOptionalParams{constructMaxIterationParam(optionalParams)} {
+    for (auto& optionalParam : optionalParams) {
+        auto paramName = StringUtils::getLower(optionalParam->getAlias());
+        if (paramName == MaxIterations::NAME) {
+            continue;
+        } else if (paramName == InitialComponentProperty::NAME) {
+            initialComponentProperty =
+                function::OptionalParam<InitialComponentProperty>(optionalParam);
+        } else {
+            throw BinderException{"Unknown optional parameter: " + optionalParam->getAlias()};
+        }
+    }
+}
+
 class WCCAuxiliaryState : public GDSAuxiliaryState {
 public:
     explicit WCCAuxiliaryState(ComponentIDsPair& componentIDsPair)
@@ -59,20 +100,143 @@ private:
     ComponentIDsPair& componentIDsPair;
 };
 
+// Keeps the previous group id of every node in its component id, and records the smallest sequence
+// id among the nodes of each previous group.
+class WCCSeedVertexCompute : public GDSVertexCompute {
+public:
+    WCCSeedVertexCompute(ComponentIDs& componentIDs, OffsetManager& offsetManager,
+        std::span<std::atomic<offset_t>> groupMinIDs, NodeOffsetMaskMap* nodeMask)
+        : GDSVertexCompute{nodeMask}, componentIDs{componentIDs}, offsetManager{offsetManager},
+          groupMinIDs{groupMinIDs} {}
+
+    void beginOnTableInternal(table_id_t tableID) override {
+        componentIDs.pinTableID(tableID);
+        offsetManager.pinTableID(tableID);
+    }
+
+    void vertexCompute(const VertexScanState::Chunk& chunk) override {
+        auto nodeIDs = chunk.getNodeIDs();
+        auto groupIDs = chunk.getProperties<int64_t>(0);
+        for (auto i = 0u; i < chunk.size(); ++i) {
+            // Ids which cannot come from a previous run are treated like nulls.
+            if (skip(nodeIDs[i].offset) || chunk.isNull(0, i) || groupIDs[i] < 0 ||
+                static_cast<uint64_t>(groupIDs[i]) >= groupMinIDs.size()) {
+                continue;
+            }
+            componentIDs.setComponentID(nodeIDs[i].offset, groupIDs[i]);
+            auto& groupMinID = groupMinIDs[groupIDs[i]];
+            auto sequenceID = offsetManager.getCurrentOffset() + nodeIDs[i].offset;
+            auto tmp = groupMinID.load(std::memory_order_relaxed);
+            while (tmp > sequenceID && !groupMinID.compare_exchange_weak(tmp, sequenceID)) {}
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WCCSeedVertexCompute>(componentIDs, offsetManager, groupMinIDs,
+            nodeMask);
+    }
+
+private:
+    ComponentIDs& componentIDs;
+    OffsetManager& offsetManager;
+    std::span<std::atomic<offset_t>> groupMinIDs;
+};
+
+// Replaces the previous group id of every node by the smallest sequence id of its group. Nodes
+// without a previous group get their own sequence id.
+class WCCSeedFinalizeVertexCompute : public VertexCompute {
+public:
+    WCCSeedFinalizeVertexCompute(ComponentIDs& componentIDs, OffsetManager& offsetManager,
+        std::span<std::atomic<offset_t>> groupMinIDs)
+        : componentIDs{componentIDs}, offsetManager{offsetManager}, groupMinIDs{groupMinIDs} {}
+
+    bool beginOnTable(table_id_t tableID) override {
+        componentIDs.pinTableID(tableID);
+        offsetManager.pinTableID(tableID);
+        return true;
+    }
+
+    void vertexCompute(offset_t startOffset, offset_t endOffset, table_id_t) override {
+        for (auto i = startOffset; i < endOffset; ++i) {
+            auto groupID = componentIDs.getComponentID(i);
+            componentIDs.setComponentID(i, groupID == INVALID_COMPONENT_ID ?
+                                               offsetManager.getCurrentOffset() + i :
+                                               groupMinIDs[groupID].load());
+        }
+    }
+
+    std::unique_ptr<VertexCompute> copy() override {
+        return std::make_unique<WCCSeedFinalizeVertexCompute>(componentIDs, offsetManager,
+            groupMinIDs);
+    }
+
+private:
+    ComponentIDs& componentIDs;
+    OffsetManager& offsetManager;
+    std::span<std::atomic<offset_t>> groupMinIDs;
+};
+
+// Every node starts from the smallest sequence id of its previous group, which is a node of the
+// same component. The smallest sequence id of each component therefore still wins, and the result
+// is the same as without the previous groups.
+static ComponentIDs getSeededComponentIDs(ExecutionContext* context,
+    GDSFuncSharedState* sharedState, const std::string& propertyName,
+    const table_id_map_t<offset_t>& maxOffsetMap, OffsetManager& offsetManager) {
+    auto graph = sharedState->graph.get();
+    auto mm = MemoryManager::Get(*context->clientContext);
+    offset_t numNodes = 0;
+    for (auto [tableID, maxOffset] : maxOffsetMap) {
+        numNodes += maxOffset;
+    }
+    auto groupMinIDsBuffer = mm->allocateBuffer(false, numNodes * sizeof(std::atomic<offset_t>));
+    auto groupMinIDs = std::span(
+        reinterpret_cast<std::atomic<offset_t>*>(groupMinIDsBuffer->getData()), numNodes);
+    for (auto& groupMinID : groupMinIDs) {
+        groupMinID.store(INVALID_COMPONENT_ID, std::memory_order_relaxed);
+    }
+    auto componentIDs = ComponentIDs::getUnvisitedComponentIDs(maxOffsetMap, mm);
+    for (const auto& nodeInfo : graph->getGraphEntry()->nodeInfos) {
+        auto entry = nodeInfo.entry;
+        if (!entry->containsProperty(propertyName)) {
+            throw RuntimeException{stringFormat("Cannot find property: {}", propertyName)};
+        }
+        if (entry->getProperty(propertyName).getType().getLogicalTypeID() !=
+            LogicalTypeID::INT64) {
+            throw RuntimeException{stringFormat(
+                "Initial component property must be of type INT64: {}", propertyName)};
+        }
+        auto seedVC = WCCSeedVertexCompute(componentIDs, offsetManager, groupMinIDs,
+            sharedState->getGraphNodeMaskMap());
+        GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, seedVC, entry,
+            {propertyName});
+    }
+    auto finalizeVC = WCCSeedFinalizeVertexCompute(componentIDs, offsetManager, groupMinIDs);
+    GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, finalizeVC);
+    return componentIDs;
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto clientContext = input.context->clientContext;
     auto sharedState = input.sharedState->ptrCast<GDSFuncSharedState>();
     auto graph = sharedState->graph.get();
-    auto currentFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
-    auto nextFrontier =
-        DenseFrontier::getVisitedFrontier(input.context, graph, sharedState->getGraphNodeMaskMap());
-    auto frontierPair =
-        std::make_unique<DenseFrontierPair>(std::move(currentFrontier), std::move(nextFrontier));
+    // Only the nodes whose component id changed in the previous iteration are active, so a
+    // bitset frontier is enough.
+    auto currentFrontier = DenseBitsetFrontier::getUnvisitedFrontier(input.context, graph);
+    auto nextFrontier = DenseBitsetFrontier::getVisitedFrontier(input.context, graph,
+        sharedState->getGraphNodeMaskMap());
+    auto frontierPair = std::make_unique<DenseBitsetFrontierPair>(std::move(currentFrontier),
+        std::move(nextFrontier));
     frontierPair->setActiveNodesForNextIter();
     auto maxOffsetMap = graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext));
     auto offsetManager = OffsetManager(maxOffsetMap);
     auto mm = MemoryManager::Get(*clientContext);
-    auto componentIDs = ComponentIDs::getSequenceComponentIDs(maxOffsetMap, offsetManager, mm);
+    auto& config = input.bindData->optionalParams->constCast<WCCOptionalParams>();
+    auto initialComponentProperty = config.initialComponentProperty.getParamVal();
+    auto componentIDs =
+        initialComponentProperty.empty() ?
+            ComponentIDs::getSequenceComponentIDs(maxOffsetMap, offsetManager, mm) :
+            getSeededComponentIDs(input.context, sharedState, initialComponentProperty,
+                maxOffsetMap, offsetManager);
     auto componentIDsPair = ComponentIDsPair(componentIDs);
     auto auxiliaryState = std::make_unique<WCCAuxiliaryState>(componentIDsPair);
     auto edgeCompute = std::make_unique<WCCEdgeCompute>(componentIDsPair);
@@ -80,10 +244,8 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         std::make_unique<ComponentIDsOutputVertexCompute>(mm, sharedState, componentIDs);
     auto computeState =
         GDSComputeState(std::move(frontierPair), std::move(edgeCompute), std::move(auxiliaryState));
-    auto maxIterations = input.bindData->optionalParams->constCast<MaxIterationOptionalParams>()
-                             .maxIterations.getParamVal();
     GDSUtils::runAlgorithmEdgeCompute(input.context, computeState, graph, ExtendDirection::BOTH,
-        maxIterations);
+        config.maxIterations.getParamVal());
     GDSUtils::runVertexCompute(input.context, GDSDensityState::DENSE, graph, *vertexCompute);
     sharedState->factorizedTablePool.mergeLocalTables();
     return 0;
@@ -99,8 +261,7 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     columns.push_back(input->binder->createVariable(GROUP_ID_COLUMN_NAME, LogicalType::INT64()));
     auto bindData = std::make_unique<GDSBindData>(std::move(columns), std::move(graphEntry),
         expression_vector{nodeOutput});
-    bindData->optionalParams =
-        std::make_unique<MaxIterationOptionalParams>(input->optionalParamsLegacy);
+    bindData->optionalParams = std::make_unique<WCCOptionalParams>(input->optionalParamsLegacy);
     return bindData;
 }
 
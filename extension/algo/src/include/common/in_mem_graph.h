@@ -5,6 +5,9 @@
 #include "function/gds/gds_object_manager.h"
 
 namespace ryu {
+namespace graph {
+class Graph;
+}
 namespace algo_extension {
 
 using weight_t = common::offset_t;
@@ -40,6 +43,10 @@ struct InMemGraph {
 
     // Inserts a neighbor of the last initialized node.
     void insertNbr(const common::offset_t to, const weight_t weight = DEFAULT_WEIGHT);
+
+    // Re-initializes to the undirected graph of the rels of `graph` between the nodes of
+    // `tableID`, which must be the only node table of `graph`. Self-loops are inserted once.
+    void initFromGraph(graph::Graph* graph, common::table_id_t tableID);
 };
 
 } // namespace algo_extension
@@ -53,6 +53,18 @@ struct PageRankAliasFunction {
     static constexpr const char* name = "PR";
 };
 
+struct PersonalizedPageRankFunction {
+    static constexpr const char* name = "PERSONALIZED_PAGE_RANK";
+
+    static function::function_set getFunctionSet();
+};
+
+struct PersonalizedPageRankAliasFunction {
+    using alias = PersonalizedPageRankFunction;
+
+    static constexpr const char* name = "PPR";
+};
+
 struct KCoreDecompositionFunction {
     static constexpr const char* name = "K_CORE_DECOMPOSITION";
 
@@ -71,6 +83,42 @@ struct LouvainFunction {
     static function::function_set getFunctionSet();
 };
 
+struct LeidenFunction {
+    static constexpr const char* name = "LEIDEN";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LabelPropagationFunction {
+    static constexpr const char* name = "LABEL_PROPAGATION";
+
+    static function::function_set getFunctionSet();
+};
+
+struct LabelPropagationAliasFunction {
+    using alias = LabelPropagationFunction;
+
+    static constexpr const char* name = "LPA";
+};
+
+struct TriangleCountFunction {
+    static constexpr const char* name = "TRIANGLE_COUNT";
+
+    static function::function_set getFunctionSet();
+};
+
+struct RandomWalkFunction {
+    static constexpr const char* name = "RANDOM_WALK";
+
+    static function::function_set getFunctionSet();
+};
+
+struct Node2VecFunction {
+    static constexpr const char* name = "NODE2VEC";
+
+    static function::function_set getFunctionSet();
+};
+
 struct SpanningForest {
     static constexpr const char* name = "SPANNING_FOREST";
 
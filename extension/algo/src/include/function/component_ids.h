@@ -26,19 +26,48 @@ private:
     common::table_id_map_t<common::offset_t> tableIDToStartOffset;
 };
 
+// Component IDs are offsets into the concatenation of all node tables of the graph. If these fit
+// into 32 bits, they are stored as uint32, which halves the memory and the bandwidth of every
+// iteration. INVALID_COMPONENT_ID is then stored as UINT32_MAX, so it still compares largest.
 class ComponentIDs {
 public:
-    std::atomic<common::offset_t>* getData(common::table_id_t tableID) {
-        return denseObjects.getData(tableID);
+    bool isCompact() const { return compact; }
+
+    template<typename T>
+    std::atomic<T>* getData(common::table_id_t tableID) {
+        if constexpr (std::is_same_v<T, uint32_t>) {
+            return compactObjects.getData(tableID);
+        } else {
+            return denseObjects.getData(tableID);
+        }
+    }
+    void pinTableID(common::table_id_t tableID) {
+        if (compact) {
+            curCompactData = compactObjects.getData(tableID);
+        } else {
+            curData = denseObjects.getData(tableID);
+        }
     }
-    void pinTableID(common::table_id_t tableID) { curData = denseObjects.getData(tableID); }
 
     void setComponentID(common::offset_t offset, common::offset_t componentID) {
+        if (compact) {
+            KU_ASSERT(curCompactData != nullptr);
+            curCompactData[offset] = componentID == INVALID_COMPONENT_ID ?
+                                         INVALID_COMPACT_COMPONENT_ID :
+                                         static_cast<uint32_t>(componentID);
+            return;
+        }
         KU_ASSERT(curData != nullptr);
         curData[offset] = componentID;
     }
 
     common::offset_t getComponentID(common::offset_t offset) const {
+        if (compact) {
+            KU_ASSERT(curCompactData != nullptr);
+            auto componentID = curCompactData[offset].load();
+            return componentID == INVALID_COMPACT_COMPONENT_ID ? INVALID_COMPONENT_ID :
+                                                                 componentID;
+        }
         KU_ASSERT(curData != nullptr);
         return curData[offset];
     }
@@ -53,8 +82,17 @@ public:
         const common::table_id_map_t<common::offset_t>& maxOffsetMap, storage::MemoryManager* mm);
 
 private:
+    static constexpr uint32_t INVALID_COMPACT_COMPONENT_ID = UINT32_MAX;
+
+    void allocate(const common::table_id_map_t<common::offset_t>& maxOffsetMap,
+        storage::MemoryManager* mm);
+
+private:
+    bool compact = false;
     std::atomic<common::offset_t>* curData = nullptr;
+    std::atomic<uint32_t>* curCompactData = nullptr;
     function::GDSDenseObjectManager<std::atomic<common::offset_t>> denseObjects;
+    function::GDSDenseObjectManager<std::atomic<uint32_t>> compactObjects;
 };
 
 class InitSequenceComponentIDsVertexCompute : public function::VertexCompute {
@@ -88,15 +126,29 @@ class ComponentIDsPair {
 public:
     explicit ComponentIDsPair(ComponentIDs& componentIDs) : componentIDs{componentIDs} {}
 
-    void pinCurTableID(common::table_id_t tableID) { curData = componentIDs.getData(tableID); }
+    void pinCurTableID(common::table_id_t tableID) {
+        if (componentIDs.isCompact()) {
+            curCompactData = componentIDs.getData<uint32_t>(tableID);
+        } else {
+            curData = componentIDs.getData<common::offset_t>(tableID);
+        }
+    }
 
-    void pinNextTableID(common::table_id_t tableID) { nextData = componentIDs.getData(tableID); }
+    void pinNextTableID(common::table_id_t tableID) {
+        if (componentIDs.isCompact()) {
+            nextCompactData = componentIDs.getData<uint32_t>(tableID);
+        } else {
+            nextData = componentIDs.getData<common::offset_t>(tableID);
+        }
+    }
 
     bool update(common::offset_t boundOffset, common::offset_t nbrOffset);
 
 private:
     std::atomic<common::offset_t>* curData = nullptr;
     std::atomic<common::offset_t>* nextData = nullptr;
+    std::atomic<uint32_t>* curCompactData = nullptr;
+    std::atomic<uint32_t>* nextCompactData = nullptr;
     ComponentIDs& componentIDs;
 };
 
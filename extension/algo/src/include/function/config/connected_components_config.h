@@ -13,5 +13,15 @@ struct CCConfig final : public function::GDSConfig {
 
 static constexpr char GROUP_ID_COLUMN_NAME[] = "group_id";
 
+struct InitialComponentProperty {
+    // An INT64 node property holding the group ids of a previous run, e.g. before rels and nodes
+    // were inserted. Nodes of a previous group are still connected, so they start in the same
+    // component, and only the changes of the graph have to be propagated. Nodes whose property is
+    // null start in their own component. Results are wrong if rels or nodes were deleted since.
+    static constexpr const char* NAME = "initialcomponentproperty";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr const char* DEFAULT_VALUE = "";
+};
+
 } // namespace algo_extension
 } // namespace ryu
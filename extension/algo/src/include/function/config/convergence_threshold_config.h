@@ -0,0 +1,23 @@
+#pragma once
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+
+namespace ryu {
+namespace algo_extension {
+
+// Iterations stop once at most this fraction of the nodes changes community in an iteration.
+struct ConvergenceThreshold {
+    static constexpr const char* NAME = "convergencethreshold";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
+    static constexpr double DEFAULT_VALUE = 0.0;
+
+    static void validate(double threshold) {
+        if (threshold < 0 || threshold > 1) {
+            throw common::BinderException{"Convergence threshold must be in [0, 1]."};
+        }
+    }
+};
+
+} // namespace algo_extension
+} // namespace ryu
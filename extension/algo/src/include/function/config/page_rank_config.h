@@ -36,5 +36,28 @@ struct NormalizeInitial {
     static constexpr bool DEFAULT_VALUE = true;
 };
 
+struct InitialRankProperty {
+    // A DOUBLE node property holding the ranks of a previous run, e.g. before a small update of
+    // the graph. Ranks are initialized from it instead of uniformly, so that fewer iterations are
+    // needed to converge. Nodes whose property is null are initialized uniformly.
+    static constexpr const char* NAME = "initialrankproperty";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr const char* DEFAULT_VALUE = "";
+};
+
+struct Epsilon {
+    // Personalized PageRank pushes the residual of a node only while it is at least epsilon times
+    // the out-degree of the node. Smaller values are more accurate but touch more of the graph.
+    static constexpr const char* NAME = "epsilon";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
+    static constexpr double DEFAULT_VALUE = 0.000001;
+
+    static void validate(double epsilon) {
+        if (epsilon <= 0 || epsilon >= 1) {
+            throw common::BinderException{"Epsilon must be in the (0, 1)."};
+        }
+    }
+};
+
 } // namespace function
 } // namespace ryu
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "common/exception/binder.h"
+#include "common/types/types.h"
+
+namespace ryu {
+namespace algo_extension {
+
+// The number of nodes of each walk, including the start node. Walks stop early at nodes without
+// out-neighbors.
+struct WalkLength {
+    static constexpr const char* NAME = "walklength";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 10;
+
+    static void validate(int64_t walkLength) {
+        if (walkLength <= 0) {
+            throw common::BinderException{"Walk length must be a positive integer."};
+        }
+    }
+};
+
+// The number of walks starting from each node.
+struct WalksPerNode {
+    static constexpr const char* NAME = "walkspernode";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 1;
+
+    static void validate(int64_t walksPerNode) {
+        if (walksPerNode <= 0) {
+            throw common::BinderException{"Walks per node must be a positive integer."};
+        }
+    }
+};
+
+// Node2vec return parameter. Larger values make walks less likely to step back to the previous
+// node.
+struct ReturnParameter {
+    static constexpr const char* NAME = "p";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
+    static constexpr double DEFAULT_VALUE = 1.0;
+
+    static void validate(double p) {
+        if (p <= 0) {
+            throw common::BinderException{"Return parameter p must be positive."};
+        }
+    }
+};
+
+// Node2vec in-out parameter. Larger values keep walks close to the previous node (BFS-like),
+// smaller values move them away from it (DFS-like).
+struct InOutParameter {
+    static constexpr const char* NAME = "q";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
+    static constexpr double DEFAULT_VALUE = 1.0;
+
+    static void validate(double q) {
+        if (q <= 0) {
+            throw common::BinderException{"In-out parameter q must be positive."};
+        }
+    }
+};
+
+// Walks are deterministic for a given seed, independently of the number of threads.
+struct RandomSeed {
+    static constexpr const char* NAME = "randomseed";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 0;
+};
+
+} // namespace algo_extension
+} // namespace ryu
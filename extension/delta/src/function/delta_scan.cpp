@@ -6,6 +6,39 @@ namespace delta_extension {
 using namespace function;
 using namespace common;
 
+std::string DeltaScanBindData::getQueryWithPushDown() const {
+    // The scan is wrapped so that its columns are named like our variables, which the column
+    // predicates refer to. DuckDB pushes the projection and predicates into the Delta and Iceberg
+    // scanners, which use them to prune files by partition values and column statistics.
+    auto columnSkips = getColumnSkips();
+    std::string columnAliases;
+    std::string columnsToSelect;
+    for (auto i = 0u; i < getNumColumns(); i++) {
+        auto columnName = stringFormat("\"{}\"", columns[i]->toString());
+        columnAliases += (i == 0 ? "" : ",") + columnName;
+        if (!columnSkips[i]) {
+            columnsToSelect += (columnsToSelect.empty() ? "" : ",") + columnName;
+        }
+    }
+    if (columnsToSelect.empty()) {
+        columnsToSelect = stringFormat("\"{}\"", columns[0]->toString());
+    }
+    auto result =
+        stringFormat("SELECT {} FROM ({}) AS scan({})", columnsToSelect, query, columnAliases);
+    auto hasPredicate = false;
+    for (auto& predicates : getColumnPredicates()) {
+        if (predicates.isEmpty()) {
+            continue;
+        }
+        result += (hasPredicate ? " AND " : " WHERE ") + predicates.toString();
+        hasPredicate = true;
+    }
+    if (getLimitNum() != INVALID_LIMIT) {
+        result += stringFormat(" LIMIT {}", getLimitNum());
+    }
+    return result;
+}
+
 static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     const TableFuncBindInput* input) {
     auto scanInput = input->extraInput->constPtrCast<ExtraScanTableFuncBindInput>();
@@ -38,7 +71,8 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
 std::unique_ptr<TableFuncSharedState> initDeltaScanSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto deltaScanBindData = input.bindData->constPtrCast<DeltaScanBindData>();
-    auto queryResult = deltaScanBindData->connector->executeQuery(deltaScanBindData->query);
+    auto queryResult =
+        deltaScanBindData->connector->executeQuery(deltaScanBindData->getQueryWithPushDown());
     return std::make_unique<duckdb_extension::DuckDBScanSharedState>(std::move(queryResult));
 }
 
@@ -56,7 +90,8 @@ offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
     if (result == nullptr) {
         return 0;
     }
-    deltaScanBindData->converter.convertDuckDBResultToVector(*result, output.dataChunk);
+    deltaScanBindData->converter.convertDuckDBResultToVector(*result, output.dataChunk,
+        deltaScanBindData->getColumnSkips());
     return output.dataChunk.state->getSelVector().getSelSize();
 }
 
@@ -30,6 +30,9 @@ struct DeltaScanBindData final : function::ScanFileBindData {
           query{std::move(query)}, connector{std::move(connector)},
           converter{std::move(converter)} {}
 
+    // Returns the query with the column skips, column predicates and limit pushed down.
+    std::string getQueryWithPushDown() const;
+
     std::unique_ptr<TableFuncBindData> copy() const override {
         return std::make_unique<DeltaScanBindData>(*this);
     }
@@ -67,6 +67,10 @@ std::unique_ptr<TableFuncSharedState> DuckDBScanFunction::initSharedState(
         }
     }
     auto finalQuery = stringFormat(scanBindData->query, columnNames) + predicatesString;
+    // A limit is only pushed down if no rows are filtered on our side after the scan.
+    if (scanBindData->getLimitNum() != INVALID_LIMIT) {
+        finalQuery += stringFormat(" LIMIT {}", scanBindData->getLimitNum());
+    }
     auto result = scanBindData->connector.executeQuery(finalQuery);
     if (result->HasError()) {
         throw RuntimeException(
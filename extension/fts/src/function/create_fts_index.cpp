@@ -173,9 +173,12 @@ std::string createFTSIndexQuery(ClientContext& context, const TableFuncBindData&
 
     // Create the terms_in_doc table which servers as a temporary table to store the
     // relationship between terms and docs.
+    // Terms are counted per doc while tokenizing. The aggregation counts into thread-local hash
+    // tables which are merged in parallel by partitions of the term hash, so the table holds one
+    // row per distinct term of a doc instead of one row per token.
     auto appearsInfoTableName = FTSUtils::getAppearsInfoTableName(tableID, indexName);
-    query += stringFormat("CREATE NODE TABLE `{}` (ID SERIAL, term string, docID INT64, primary "
-                          "key(ID));",
+    query += stringFormat("CREATE NODE TABLE `{}` (ID SERIAL, term string, docID INT64, tf UINT64, "
+                          "primary key(ID));",
         appearsInfoTableName);
     auto tableName = ftsBindData->tableName;
     auto tableEntry = catalog::Catalog::Get(context)->getTableCatalogEntry(
@@ -189,11 +192,14 @@ std::string createFTSIndexQuery(ClientContext& context, const TableFuncBindData&
                               "WITH t AS t1, id AS id1 "
                               "WHERE t1 is NOT NULL AND SIZE(t1) > 0 AND "
                               "NOT EXISTS {MATCH (s:`{}` {sw: t1})} "
-                              "RETURN STEM(t1, '{}'), id1);",
+                              "RETURN STEM(t1, '{}'), id1, CAST(count(*) AS UINT64));",
             appearsInfoTableName, tableName, FTSUtils::getTokenizeMacroName(tableID, indexName),
             propertyName, ftsBindData->createFTSConfig.stopWordsTableInfo.tableName,
             ftsBindData->createFTSConfig.stemmer);
     }
+    // With a single indexed property, each (term, doc) pair has a single row in the terms_in_doc
+    // table, so it doesn't need to be aggregated again.
+    auto hasSingleProperty = ftsBindData->propertyIDs.size() == 1;
 
     auto docsTableName = FTSUtils::getDocsTableName(tableID, indexName);
     // Create the docs table which records the number of words in each document.
@@ -201,7 +207,7 @@ std::string createFTSIndexQuery(ClientContext& context, const TableFuncBindData&
         docsTableName);
     query += stringFormat("COPY `{}` FROM "
                           "(MATCH (t:`{}`) "
-                          "RETURN t.docID, CAST(count(t) AS UINT64)); ",
+                          "RETURN t.docID, CAST(sum(t.tf) AS UINT64)); ",
         docsTableName, appearsInfoTableName);
 
     auto termsTableName = FTSUtils::getTermsTableName(tableID, indexName);
@@ -210,8 +216,9 @@ std::string createFTSIndexQuery(ClientContext& context, const TableFuncBindData&
         termsTableName);
     query += stringFormat("COPY `{}` FROM "
                           "(MATCH (t:`{}`) "
-                          "RETURN t.term, CAST(count(distinct t.docID) AS UINT64));",
-        termsTableName, appearsInfoTableName);
+                          "RETURN t.term, CAST({} AS UINT64));",
+        termsTableName, appearsInfoTableName,
+        hasSingleProperty ? "count(*)" : "count(distinct t.docID)");
 
     auto appearsInTableName = FTSUtils::getAppearsInTableName(tableID, indexName);
     // Finally, create a terms table that records the documents in which the terms appear, along
@@ -220,8 +227,9 @@ std::string createFTSIndexQuery(ClientContext& context, const TableFuncBindData&
         appearsInTableName, termsTableName, docsTableName);
     query += stringFormat("COPY `{}` FROM ("
                           "MATCH (b:`{}`) "
-                          "RETURN b.term, b.docID, CAST(count(*) as UINT64));",
-        appearsInTableName, appearsInfoTableName);
+                          "RETURN b.term, b.docID, {});",
+        appearsInTableName, appearsInfoTableName,
+        hasSingleProperty ? "b.tf" : "CAST(sum(b.tf) AS UINT64)");
 
     // Drop the intermediate terms_in_doc table.
     query += stringFormat("DROP TABLE `{}`;", appearsInfoTableName);
@@ -315,6 +323,7 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
         nodeTable->getNumTotalRows(transaction::Transaction::Get(*context.clientContext)));
     auto onDiskIndex = std::make_unique<FTSIndex>(std::move(indexInfo), std::move(storageInfo),
         std::move(ftsConfig), context.clientContext);
+    onDiskIndex->buildPostingLists(context.clientContext, transaction);
     if (!context.clientContext->isInMemory()) {
         // We currently can't support FSM reclaiming when rolling back checkpoint
         // so we don't use the optimistic allocator here
@@ -333,6 +342,9 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
             appearsInTableEntry, pageAllocator);
     }
     nodeTable->addIndex(std::move(onDiskIndex));
+    // Indexes are only checkpointed with tables that have changes. Make sure the posting lists are
+    // written to the data file by the forced checkpoint below.
+    nodeTable->setHasChanges();
     transaction->setForceCheckpoint();
     return 0;
 }
@@ -90,6 +90,13 @@ struct QFTSTopKSharedState : public QFTSSharedState {
 
     void setTopK(uint64_t topK_) { topK = topK_; }
 
+    // Docs must score above this to enter the top k.
+    double getMinCompetitiveScore() {
+        std::lock_guard guard{mtx};
+        return minHeap.size() < topK ? -std::numeric_limits<double>::infinity() :
+                                       minHeap.top().score;
+    }
+
     void addDocScore(std::vector<ValueVector*> /*vectors*/,
         processor::FactorizedTable& /*localTable*/, DocScore docScore) override {
         std::lock_guard guard{mtx};
@@ -127,6 +134,15 @@ struct ScoreInfo {
     void addEdge(uint64_t df, uint64_t tf) { scoreData.emplace_back(df, tf); }
 };
 
+// BM25 score of a term in a doc. `lenRatio` is the length of the doc over the average doc length.
+static double computeTermScore(const ScoreData& scoreData, common::idx_t numDocs, double k,
+    double b, double lenRatio) {
+    auto df = scoreData.df;
+    auto tf = scoreData.tf;
+    return log10((numDocs - df + 0.5) / (df + 0.5) + 1) *
+           ((tf * (k + 1) / (tf + k * (1 - b + b * lenRatio))));
+}
+
 struct QFTSEdgeCompute final : EdgeCompute {
     node_id_map_t<ScoreInfo>& scores;
     const std::unordered_map<offset_t, uint64_t>& dfs;
@@ -201,14 +217,8 @@ void QFTSOutputWriter::write(processor::FactorizedTable& scoreFT, nodeID_t docNo
         scoreInfo.scoreData.size() != numUniqueTerms) {
         return;
     }
-    auto auxInfo = bindData.entry.getAuxInfo().cast<FTSIndexAuxInfo>();
     for (auto& scoreData : scoreInfo.scoreData) {
-        auto numDocs = bindData.numDocs;
-        auto avgDocLen = bindData.avgDocLen;
-        auto df = scoreData.df;
-        auto tf = scoreData.tf;
-        score += log10((numDocs - df + 0.5) / (df + 0.5) + 1) *
-                 ((tf * (k + 1) / (tf + k * (1 - b + b * (len / avgDocLen)))));
+        score += computeTermScore(scoreData, bindData.numDocs, k, b, len / bindData.avgDocLen);
     }
     sharedState.addDocScore(scoreFtInsertState.vectors, scoreFT, {(uint64_t)docsID, score});
 }
@@ -368,6 +378,111 @@ static void initFrontier(FrontierPair& frontierPair, table_id_t termsTableID,
     }
 }
 
+// Collects the term frequencies of the query terms from the compressed posting lists. Conjunctive
+// queries intersect the posting lists from the shortest one, so that the skip pointers of the
+// longer lists avoid decoding blocks without candidate docs.
+static void collectPostings(const FTSPostingLists& postingLists,
+    const std::unordered_map<offset_t, uint64_t>& dfs, table_id_t docsTableID, bool intersect,
+    node_id_map_t<ScoreInfo>& scores) {
+    std::vector<std::pair<const PostingList*, uint64_t>> lists;
+    for (auto& [termOffset, df] : dfs) {
+        auto postingList = postingLists.getPostingList(termOffset);
+        if (postingList == nullptr) {
+            if (intersect) {
+                return;
+            }
+            continue;
+        }
+        lists.emplace_back(postingList, df);
+    }
+    if (!intersect) {
+        for (auto& [postingList, df] : lists) {
+            for (PostingListIterator it{*postingList}; !it.isDone(); it.next()) {
+                auto posting = it.getPosting();
+                scores[nodeID_t{posting.docOffset, docsTableID}].addEdge(df, posting.tf);
+            }
+        }
+        return;
+    }
+    if (lists.empty()) {
+        return;
+    }
+    std::ranges::sort(lists, {}, [](auto& list) { return list.first->getNumPostings(); });
+    std::vector<PostingListIterator> iters;
+    iters.reserve(lists.size());
+    for (auto& [postingList, _] : lists) {
+        iters.emplace_back(*postingList);
+    }
+    auto& leader = iters[0];
+    while (!leader.isDone()) {
+        auto docOffset = leader.getPosting().docOffset;
+        auto nextDocOffset = docOffset;
+        for (auto i = 1u; i < iters.size(); i++) {
+            iters[i].advance(docOffset);
+            if (iters[i].isDone()) {
+                return;
+            }
+            if (iters[i].getPosting().docOffset != docOffset) {
+                nextDocOffset = iters[i].getPosting().docOffset;
+                break;
+            }
+        }
+        if (nextDocOffset != docOffset) {
+            leader.advance(nextDocOffset);
+            continue;
+        }
+        auto& scoreInfo = scores[nodeID_t{docOffset, docsTableID}];
+        for (auto i = 0u; i < iters.size(); i++) {
+            scoreInfo.addEdge(lists[i].second, iters[i].getPosting().tf);
+        }
+        leader.next();
+    }
+}
+
+struct DocUpperBound {
+    nodeID_t docNodeID;
+    double score;
+};
+
+// Scores the docs in decreasing order of their score upper bounds, and stops at the first doc whose
+// upper bound can't beat the k-th best score found so far. Only the docs that may enter the top k
+// are looked up in the docs table.
+static void scoreTopKDocs(graph::Graph* graph, catalog::TableCatalogEntry* docsEntry,
+    const std::vector<std::string>& vertexPropertiesToScan, const node_id_map_t<ScoreInfo>& scores,
+    const QueryFTSBindData& bindData, uint64_t numUniqueTerms, QFTSTopKSharedState& sharedState,
+    VertexCompute& vc) {
+    auto& qFTSOptionalParams = bindData.optionalParams->constCast<QueryFTSOptionalParams>();
+    auto k = qFTSOptionalParams.k.getParamVal();
+    auto b = qFTSOptionalParams.b.getParamVal();
+    auto conjunctive = qFTSOptionalParams.conjunctive.getParamVal();
+    std::vector<DocUpperBound> upperBounds;
+    upperBounds.reserve(scores.size());
+    for (auto& [nodeID, scoreInfo] : scores) {
+        if (conjunctive && scoreInfo.scoreData.size() != numUniqueTerms) {
+            continue;
+        }
+        // The term frequency component of BM25 shrinks as the doc grows, so it is bounded by its
+        // value for an empty doc.
+        double upperBound = 0;
+        for (auto& scoreData : scoreInfo.scoreData) {
+            upperBound += computeTermScore(scoreData, bindData.numDocs, k, b, 0 /* lenRatio */);
+        }
+        upperBounds.push_back({nodeID, upperBound});
+    }
+    std::ranges::sort(upperBounds,
+        [](const DocUpperBound& l, const DocUpperBound& r) { return l.score > r.score; });
+    auto vertexScanState = graph->prepareVertexScan(docsEntry, vertexPropertiesToScan);
+    for (auto& upperBound : upperBounds) {
+        if (upperBound.score <= sharedState.getMinCompetitiveScore()) {
+            break;
+        }
+        auto offset = upperBound.docNodeID.offset;
+        for (auto chunk : graph->scanVertices(offset, offset + 1, *vertexScanState)) {
+            vc.vertexCompute(chunk);
+        }
+    }
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto& clientContext = *input.context->clientContext;
     auto transaction = transaction::Transaction::Get(clientContext);
@@ -382,37 +497,50 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     auto termsEntry = graphEntry->nodeInfos[0].entry;
     auto queryTerms = qFTSBindData.getQueryTerms(clientContext);
     auto dfs = getDFs(clientContext, input.context, graph, termsEntry, queryTerms);
-    // Do edge compute to extend terms -> docs and save the term frequency and document frequency
-    // for each term-doc pair. The reason why we store the term frequency and document frequency
-    // is that: we need the `len` property from the docs table which is only available during the
-    // vertex compute.
-    auto currentFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
-    auto nextFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
-    auto frontierPair = std::make_unique<DenseSparseDynamicFrontierPair>(std::move(currentFrontier),
-        std::move(nextFrontier));
-    auto termsTableID = termsEntry->getTableID();
-    initFrontier(*frontierPair, termsTableID, dfs);
     auto storageManager = StorageManager::Get(clientContext);
-    frontierPair->setActiveNodesForNextIter();
-
+    auto numUniqueTerms = getNumUniqueTerms(queryTerms);
+    auto docsEntry = graphEntry->nodeInfos[1].entry;
+    auto& indexEntry = qFTSBindData.entry;
+    auto index = storageManager->getTable(indexEntry.getTableID())
+                     ->cast<NodeTable>()
+                     .getIndex(indexEntry.getIndexName());
+    KU_ASSERT(index.has_value());
     node_id_map_t<ScoreInfo> scores;
-    auto edgeCompute = std::make_unique<QFTSEdgeCompute>(scores, dfs);
-    auto auxiliaryState = std::make_unique<EmptyGDSAuxiliaryState>();
-    auto compState =
-        GDSComputeState(std::move(frontierPair), std::move(edgeCompute), std::move(auxiliaryState));
-    GDSUtils::runFTSEdgeCompute(input.context, compState, graph, ExtendDirection::FWD,
-        {TERM_FREQUENCY_PROP_NAME});
+    if (auto postingLists = index.value()->cast<FTSIndex>().getPostingLists()) {
+        // Only docs with all query terms can match a conjunctive query.
+        auto intersect =
+            qFTSOptionalParams.conjunctive.getParamVal() && dfs.size() == numUniqueTerms;
+        collectPostings(*postingLists, dfs, docsEntry->getTableID(), intersect, scores);
+    } else {
+        // Do edge compute to extend terms -> docs and save the term frequency and document
+        // frequency for each term-doc pair. The reason why we store the term frequency and
+        // document frequency is that: we need the `len` property from the docs table which is
+        // only available during the vertex compute.
+        auto currentFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
+        auto nextFrontier = DenseFrontier::getUnvisitedFrontier(input.context, graph);
+        auto frontierPair = std::make_unique<DenseSparseDynamicFrontierPair>(
+            std::move(currentFrontier), std::move(nextFrontier));
+        initFrontier(*frontierPair, termsEntry->getTableID(), dfs);
+        frontierPair->setActiveNodesForNextIter();
+        auto edgeCompute = std::make_unique<QFTSEdgeCompute>(scores, dfs);
+        auto auxiliaryState = std::make_unique<EmptyGDSAuxiliaryState>();
+        auto compState = GDSComputeState(std::move(frontierPair), std::move(edgeCompute),
+            std::move(auxiliaryState));
+        GDSUtils::runFTSEdgeCompute(input.context, compState, graph, ExtendDirection::FWD,
+            {TERM_FREQUENCY_PROP_NAME});
+    }
 
     // Do vertex compute to calculate the score for doc with the length property.
     auto mm = MemoryManager::Get(clientContext);
-    auto numUniqueTerms = getNumUniqueTerms(queryTerms);
     auto writer =
         std::make_unique<QFTSOutputWriter>(scores, mm, qFTSBindData, numUniqueTerms, *sharedState);
     auto vc = std::make_unique<QFTSVertexCompute>(mm, sharedState, std::move(writer));
     auto vertexPropertiesToScan = std::vector<std::string>{DOC_LEN_PROP_NAME, DOC_ID_PROP_NAME};
-    auto docsEntry = graphEntry->nodeInfos[1].entry;
     auto numDocs = storageManager->getTable(docsEntry->getTableID())->getNumTotalRows(transaction);
-    if (scores.size() < getSparseFrontierSize(numDocs)) {
+    if (qFTSOptionalParams.topK.isSet()) {
+        scoreTopKDocs(graph, docsEntry, vertexPropertiesToScan, scores, qFTSBindData,
+            numUniqueTerms, *sharedState->ptrCast<QFTSTopKSharedState>(), *vc);
+    } else if (scores.size() < getSparseFrontierSize(numDocs)) {
         auto vertexScanState = graph->prepareVertexScan(docsEntry, vertexPropertiesToScan);
         for (auto& [nodeID, scoreInfo] : scores) {
             for (auto chunk :
@@ -1,10 +1,18 @@
 #pragma once
 
+#include <mutex>
+
 #include "function/fts_config.h"
 #include "index/fts_internal_table_info.h"
+#include "index/fts_posting_list.h"
 #include "storage/index/index.h"
+#include "storage/page_range.h"
 
 namespace ryu {
+namespace storage {
+class FileHandle;
+} // namespace storage
+
 namespace fts_extension {
 
 struct FTSInsertState;
@@ -15,6 +23,10 @@ struct FTSStorageInfo final : storage::IndexStorageInfo {
     common::idx_t numDocs = 0;
     double avgDocLen = 0;
     common::offset_t numCheckpointedNodes;
+    // Pages of the serialized compressed posting lists. Invalid if the posting lists were never
+    // checkpointed, or went stale before the last checkpoint.
+    storage::PageRange postingListsPageRange;
+    uint64_t postingListsSize = 0;
 
     FTSStorageInfo(common::idx_t numDocs, double avgDocLen, common::offset_t numCheckpointedNodes)
         : numDocs{numDocs}, avgDocLen{avgDocLen}, numCheckpointedNodes{numCheckpointedNodes} {}
@@ -54,6 +66,13 @@ public:
 
     void finalize(main::ClientContext* context) override;
     void checkpoint(main::ClientContext*, storage::PageAllocator& pageAllocator) override;
+    void rollbackCheckpoint() override;
+
+    // Builds the compressed posting lists from the appears_in table as seen by the transaction.
+    void buildPostingLists(main::ClientContext* context, transaction::Transaction* transaction);
+    // Returns nullptr if the posting lists are stale, in which case queries must read the
+    // appears_in table.
+    std::shared_ptr<const FTSPostingLists> getPostingLists() const;
 
     static storage::IndexType getIndexType() {
         static const storage::IndexType FTS_INDEX_TYPE{"FTS",
@@ -86,9 +105,21 @@ private:
     void deleteFromAppearsInTable(transaction::Transaction* transaction,
         FTSDeleteState& ftsDeleteState, common::nodeID_t docID) const;
 
+    // The posting lists are snapshots of the appears_in table, and aren't maintained on updates.
+    // Writes drop them, and the next checkpoint builds them again from the committed data, so
+    // they are also back after the writes are rolled back.
+    void invalidatePostingLists();
+    void loadPostingLists(storage::FileHandle* dataFH);
+
 private:
     FTSInternalTableInfo internalTableInfo;
     FTSConfig config;
+    // Queries may read the posting lists while a write transaction invalidates them.
+    mutable std::mutex postingListsMtx;
+    std::shared_ptr<const FTSPostingLists> postingLists;
+    // Whether the posting lists differ from the ones in the data file.
+    bool postingListsChanged;
+    std::optional<storage::PageRange> postingListsPageRangeBeforeCheckpoint;
 };
 
 } // namespace fts_extension
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "common/assert.h"
+#include "common/types/types.h"
+
+namespace ryu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace fts_extension {
+
+struct Posting {
+    common::offset_t docOffset;
+    uint64_t tf;
+};
+
+// The docs a term appears in, sorted by doc offset, with the term frequencies.
+// Postings are split into blocks of 128. Doc offsets are delta encoded within a block, and deltas
+// and term frequencies are bit-packed with the smallest bit width that fits the block. The last
+// doc offset of each block is kept uncompressed as a skip pointer, so that intersections only
+// decode the blocks that may contain a match.
+class PostingList {
+    friend class PostingListIterator;
+
+public:
+    static constexpr uint64_t BLOCK_SIZE = 128;
+
+    PostingList() : numPostings{0} {}
+    // Postings must be sorted by doc offset.
+    explicit PostingList(std::span<const Posting> postings);
+
+    uint64_t getNumPostings() const { return numPostings; }
+    uint64_t getNumBlocks() const { return blocks.size(); }
+
+    void serialize(common::Serializer& serializer) const;
+    static PostingList deserialize(common::Deserializer& deSer);
+
+private:
+    // Decodes the block into `docOffsets` and `tfs`, which must hold BLOCK_SIZE values each.
+    // Returns the number of postings in the block.
+    uint64_t decodeBlock(common::idx_t blockIdx, common::offset_t* docOffsets,
+        uint64_t* tfs) const;
+
+private:
+    struct BlockHeader {
+        common::offset_t lastDocOffset;
+        // Offset of the block in `data`, in 32-bit words.
+        uint64_t dataOffset;
+        uint8_t deltaBitWidth;
+        uint8_t tfBitWidth;
+    };
+
+    uint64_t numPostings;
+    std::vector<BlockHeader> blocks;
+    std::vector<uint32_t> data;
+};
+
+class PostingListIterator {
+public:
+    explicit PostingListIterator(const PostingList& postingList);
+
+    bool isDone() const { return blockIdx >= postingList.getNumBlocks(); }
+    Posting getPosting() const {
+        KU_ASSERT(!isDone());
+        return {docOffsets[posInBlock], tfs[posInBlock]};
+    }
+
+    void next();
+    // Moves to the first posting whose doc offset is >= `target`. Blocks whose last doc offset is
+    // smaller than `target` are skipped without being decoded.
+    void advance(common::offset_t target);
+
+private:
+    void loadBlock(common::idx_t idx);
+
+private:
+    const PostingList& postingList;
+    common::idx_t blockIdx;
+    uint64_t posInBlock;
+    uint64_t numPostingsInBlock;
+    common::offset_t docOffsets[PostingList::BLOCK_SIZE];
+    uint64_t tfs[PostingList::BLOCK_SIZE];
+};
+
+// Compressed posting lists of all terms in an FTS index, keyed by the offset of the term in the
+// terms table.
+class FTSPostingLists {
+public:
+    void addPostingList(common::offset_t termOffset, PostingList postingList) {
+        postingLists.emplace(termOffset, std::move(postingList));
+    }
+    // Returns nullptr if the term appears in no doc.
+    const PostingList* getPostingList(common::offset_t termOffset) const {
+        auto it = postingLists.find(termOffset);
+        return it == postingLists.end() ? nullptr : &it->second;
+    }
+
+    void serialize(common::Serializer& serializer) const;
+    static std::unique_ptr<FTSPostingLists> deserialize(common::Deserializer& deSer);
+
+private:
+    std::unordered_map<common::offset_t, PostingList> postingLists;
+};
+
+} // namespace fts_extension
+} // namespace ryu
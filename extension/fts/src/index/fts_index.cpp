@@ -2,8 +2,14 @@
 
 #include "catalog/catalog.h"
 #include "catalog/fts_index_catalog_entry.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/in_mem_file_writer.h"
 #include "index/fts_update_state.h"
 #include "re2.h"
+#include "storage/file_handle.h"
+#include "storage/page_allocator.h"
+#include "storage/storage_manager.h"
+#include "storage/table/rel_table.h"
 #include "utils/fts_utils.h"
 
 namespace ryu {
@@ -17,9 +23,9 @@ FTSIndex::FTSIndex(IndexInfo indexInfo, std::unique_ptr<IndexStorageInfo> storag
     FTSConfig config, main::ClientContext* context)
     : Index{indexInfo, std::move(storageInfo)},
       internalTableInfo{context, indexInfo.tableID, indexInfo.name, config.stopWordsTableName},
-      config{std::move(config)} {}
+      config{std::move(config)}, postingListsChanged{false} {}
 
-std::unique_ptr<Index> FTSIndex::load(main::ClientContext* context, StorageManager*,
+std::unique_ptr<Index> FTSIndex::load(main::ClientContext* context, StorageManager* storageManager,
     IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
     auto catalog = catalog::Catalog::Get(*context);
     auto reader =
@@ -28,8 +34,10 @@ std::unique_ptr<Index> FTSIndex::load(main::ClientContext* context, StorageManag
     auto indexEntry = catalog->getIndex(transaction::Transaction::Get(*context), indexInfo.tableID,
         indexInfo.name);
     auto ftsConfig = indexEntry->getAuxInfo().cast<FTSIndexAuxInfo>().config;
-    return std::make_unique<FTSIndex>(std::move(indexInfo), std::move(storageInfo),
+    auto index = std::make_unique<FTSIndex>(std::move(indexInfo), std::move(storageInfo),
         std::move(ftsConfig), context);
+    index->loadPostingLists(storageManager->getDataFH());
+    return index;
 }
 
 struct TermInfo {
@@ -43,6 +51,9 @@ std::shared_ptr<BufferWriter> FTSStorageInfo::serialize() const {
     serializer.write<idx_t>(numDocs);
     serializer.write<double>(avgDocLen);
     serializer.write<offset_t>(numCheckpointedNodes);
+    serializer.write<page_idx_t>(postingListsPageRange.startPageIdx);
+    serializer.write<page_idx_t>(postingListsPageRange.numPages);
+    serializer.write<uint64_t>(postingListsSize);
     return bufferWriter;
 }
 
@@ -55,7 +66,11 @@ std::unique_ptr<IndexStorageInfo> FTSStorageInfo::deserialize(
     deSer.deserializeValue<idx_t>(numDocs);
     deSer.deserializeValue<double>(avgDocLen);
     deSer.deserializeValue<offset_t>(numCheckpointedNodes);
-    return std::make_unique<FTSStorageInfo>(numDocs, avgDocLen, numCheckpointedNodes);
+    auto storageInfo = std::make_unique<FTSStorageInfo>(numDocs, avgDocLen, numCheckpointedNodes);
+    deSer.deserializeValue<page_idx_t>(storageInfo->postingListsPageRange.startPageIdx);
+    deSer.deserializeValue<page_idx_t>(storageInfo->postingListsPageRange.numPages);
+    deSer.deserializeValue<uint64_t>(storageInfo->postingListsSize);
+    return storageInfo;
 }
 
 std::unique_ptr<Index::InsertState> FTSIndex::initInsertState(main::ClientContext* context,
@@ -111,6 +126,7 @@ void FTSIndex::insert(Transaction* transaction, const ValueVector& nodeIDVector,
     const std::vector<ValueVector*>& indexVectors, InsertState& insertState) {
     auto totalInsertedDocLen = 0u;
     auto& ftsInsertState = insertState.cast<FTSInsertState>();
+    invalidatePostingLists();
     for (auto i = 0u; i < nodeIDVector.state->getSelSize(); i++) {
         auto pos = nodeIDVector.state->getSelVector()[i];
         DocInfo docInfo{transaction, config, internalTableInfo.stopWordsTable, indexVectors, pos,
@@ -172,6 +188,7 @@ void FTSIndex::delete_(Transaction* transaction, const ValueVector& nodeIDVector
     DeleteState& deleteState) {
     auto& ftsDeleteState = deleteState.cast<FTSDeleteState>();
     auto& ftsStorageInfo = storageInfo->cast<FTSStorageInfo>();
+    invalidatePostingLists();
     double totalDocLen = ftsStorageInfo.avgDocLen * ftsStorageInfo.numDocs;
     for (auto i = 0u; i < nodeIDVector.state->getSelSize(); i++) {
         auto pos = nodeIDVector.state->getSelVector()[i];
@@ -240,6 +257,112 @@ void FTSIndex::checkpoint(main::ClientContext* context, storage::PageAllocator&
     auto appearsInTableEntry =
         catalog->getTableCatalogEntry(&DUMMY_CHECKPOINT_TRANSACTION, appearsInTableName);
     internalTableInfo.appearsInfoTable->checkpoint(context, appearsInTableEntry, pageAllocator);
+    postingListsPageRangeBeforeCheckpoint.reset();
+    if (getPostingLists() == nullptr) {
+        // The posting lists were dropped by writes, which are all committed by now.
+        buildPostingLists(context, &DUMMY_CHECKPOINT_TRANSACTION);
+    }
+    if (!postingListsChanged) {
+        return;
+    }
+    auto& ftsStorageInfo = storageInfo->cast<FTSStorageInfo>();
+    postingListsPageRangeBeforeCheckpoint = ftsStorageInfo.postingListsPageRange;
+    if (ftsStorageInfo.postingListsPageRange.startPageIdx != INVALID_PAGE_IDX) {
+        pageAllocator.freePageRange(ftsStorageInfo.postingListsPageRange);
+    }
+    ftsStorageInfo.postingListsPageRange = PageRange{};
+    ftsStorageInfo.postingListsSize = 0;
+    if (auto lists = getPostingLists()) {
+        auto writer = std::make_shared<InMemFileWriter>(*MemoryManager::Get(*context));
+        Serializer serializer{writer};
+        lists->serialize(serializer);
+        ftsStorageInfo.postingListsPageRange =
+            writer->flush(pageAllocator, StorageManager::Get(*context)->getShadowFile());
+        ftsStorageInfo.postingListsSize = writer->getSize();
+    }
+    postingListsChanged = false;
+}
+
+void FTSIndex::rollbackCheckpoint() {
+    if (!postingListsPageRangeBeforeCheckpoint.has_value()) {
+        return;
+    }
+    auto& ftsStorageInfo = storageInfo->cast<FTSStorageInfo>();
+    ftsStorageInfo.postingListsPageRange = *postingListsPageRangeBeforeCheckpoint;
+    postingListsPageRangeBeforeCheckpoint.reset();
+    postingListsChanged = true;
+}
+
+std::shared_ptr<const FTSPostingLists> FTSIndex::getPostingLists() const {
+    std::lock_guard lck{postingListsMtx};
+    return postingLists;
+}
+
+void FTSIndex::invalidatePostingLists() {
+    std::lock_guard lck{postingListsMtx};
+    if (postingLists != nullptr) {
+        postingLists.reset();
+        postingListsChanged = true;
+    }
+}
+
+void FTSIndex::buildPostingLists(main::ClientContext* context, Transaction* transaction) {
+    auto catalog = catalog::Catalog::Get(*context);
+    auto appearsInEntry = catalog->getTableCatalogEntry(transaction,
+        FTSUtils::getAppearsInTableName(indexInfo.tableID, indexInfo.name));
+    auto mm = MemoryManager::Get(*context);
+    auto termsTableID = internalTableInfo.termsTable->getTableID();
+    auto appearsInTable = internalTableInfo.appearsInfoTable;
+    ValueVector termIDVector{LogicalType::INTERNAL_ID(), mm,
+        DataChunkState::getSingleValueDataChunkState()};
+    auto outState = std::make_shared<DataChunkState>();
+    ValueVector docIDVector{LogicalType::INTERNAL_ID(), mm, outState};
+    ValueVector tfVector{LogicalType::UINT64(), mm, outState};
+    RelTableScanState scanState{*mm, &termIDVector, {&docIDVector, &tfVector}, outState};
+    scanState.setToTable(transaction, appearsInTable,
+        {NBR_ID_COLUMN_ID, appearsInEntry->getColumnID("tf")}, {}, RelDataDirection::FWD);
+    auto newPostingLists = std::make_shared<FTSPostingLists>();
+    std::vector<Posting> postings;
+    auto numTerms = internalTableInfo.termsTable->getNumTotalRows(transaction);
+    for (auto termOffset = 0u; termOffset < numTerms; termOffset++) {
+        postings.clear();
+        termIDVector.setValue(0, nodeID_t{termOffset, termsTableID});
+        appearsInTable->initScanState(transaction, scanState);
+        while (appearsInTable->scan(transaction, scanState)) {
+            const auto& selVector = outState->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                const auto pos = selVector[i];
+                postings.push_back({docIDVector.getValue<nodeID_t>(pos).offset,
+                    tfVector.getValue<uint64_t>(pos)});
+            }
+        }
+        if (postings.empty()) {
+            continue;
+        }
+        std::ranges::sort(postings, {}, &Posting::docOffset);
+        newPostingLists->addPostingList(termOffset, PostingList{postings});
+    }
+    std::lock_guard lck{postingListsMtx};
+    postingLists = std::move(newPostingLists);
+    postingListsChanged = true;
+}
+
+void FTSIndex::loadPostingLists(FileHandle* dataFH) {
+    auto& ftsStorageInfo = storageInfo->cast<FTSStorageInfo>();
+    auto pageRange = ftsStorageInfo.postingListsPageRange;
+    if (pageRange.startPageIdx == INVALID_PAGE_IDX) {
+        return;
+    }
+    std::vector<uint8_t> buffer(pageRange.numPages * RYU_PAGE_SIZE);
+    for (auto i = 0u; i < pageRange.numPages; i++) {
+        dataFH->optimisticReadPage(pageRange.startPageIdx + i, [&](const uint8_t* frame) {
+            memcpy(buffer.data() + i * RYU_PAGE_SIZE, frame, RYU_PAGE_SIZE);
+        });
+    }
+    Deserializer deSer{
+        std::make_unique<BufferReader>(buffer.data(), ftsStorageInfo.postingListsSize)};
+    std::lock_guard lck{postingListsMtx};
+    postingLists = FTSPostingLists::deserialize(deSer);
 }
 
 nodeID_t FTSIndex::insertToDocTable(Transaction* transaction, FTSInsertState& insertState,
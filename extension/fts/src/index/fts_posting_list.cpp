@@ -0,0 +1,170 @@
+#include "index/fts_posting_list.h"
+
+#include <bit>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "fastpfor/bitpackinghelpers.h"
+
+namespace ryu {
+namespace fts_extension {
+
+using namespace ryu::common;
+
+// FastPFor packs values in groups of 32.
+static constexpr uint64_t PACK_GROUP_SIZE = 32;
+
+static uint8_t getBitWidth(const uint64_t* values, uint64_t numValues) {
+    uint64_t maxValue = 0;
+    for (auto i = 0u; i < numValues; i++) {
+        maxValue |= values[i];
+    }
+    return static_cast<uint8_t>(64 - std::countl_zero(maxValue));
+}
+
+// Packs BLOCK_SIZE values, i.e. `bitWidth` words for each group of 32 values.
+static void packBlock(const uint64_t* values, uint64_t numValues, uint8_t bitWidth,
+    std::vector<uint32_t>& data) {
+    for (auto i = 0u; i < numValues; i += PACK_GROUP_SIZE) {
+        const auto pos = data.size();
+        data.resize(pos + bitWidth);
+        FastPForLib::fastpack(values + i, data.data() + pos, bitWidth);
+    }
+}
+
+static void unpackBlock(const uint32_t* data, uint64_t numValues, uint8_t bitWidth,
+    uint64_t* values) {
+    for (auto i = 0u; i < numValues; i += PACK_GROUP_SIZE) {
+        FastPForLib::fastunpack(data, values + i, bitWidth);
+        data += bitWidth;
+    }
+}
+
+static uint64_t getNumValuesToPack(uint64_t numPostings) {
+    return (numPostings + PACK_GROUP_SIZE - 1) / PACK_GROUP_SIZE * PACK_GROUP_SIZE;
+}
+
+PostingList::PostingList(std::span<const Posting> postings) : numPostings{postings.size()} {
+    uint64_t deltas[BLOCK_SIZE];
+    uint64_t tfs[BLOCK_SIZE];
+    offset_t prevDocOffset = 0;
+    for (auto start = 0u; start < postings.size(); start += BLOCK_SIZE) {
+        const auto numPostingsInBlock = std::min<uint64_t>(BLOCK_SIZE, postings.size() - start);
+        // Unused slots are packed as zeros.
+        std::fill(std::begin(deltas), std::end(deltas), 0);
+        std::fill(std::begin(tfs), std::end(tfs), 0);
+        for (auto i = 0u; i < numPostingsInBlock; i++) {
+            const auto& posting = postings[start + i];
+            KU_ASSERT(start + i == 0 || posting.docOffset > prevDocOffset);
+            deltas[i] = posting.docOffset - prevDocOffset;
+            tfs[i] = posting.tf;
+            prevDocOffset = posting.docOffset;
+        }
+        const auto numValues = getNumValuesToPack(numPostingsInBlock);
+        BlockHeader header{prevDocOffset, data.size(), getBitWidth(deltas, numValues),
+            getBitWidth(tfs, numValues)};
+        packBlock(deltas, numValues, header.deltaBitWidth, data);
+        packBlock(tfs, numValues, header.tfBitWidth, data);
+        blocks.push_back(header);
+    }
+}
+
+uint64_t PostingList::decodeBlock(idx_t blockIdx, offset_t* docOffsets, uint64_t* tfs) const {
+    KU_ASSERT(blockIdx < blocks.size());
+    const auto& header = blocks[blockIdx];
+    const auto numPostingsInBlock =
+        blockIdx + 1 == blocks.size() ? numPostings - blockIdx * BLOCK_SIZE : BLOCK_SIZE;
+    const auto numValues = getNumValuesToPack(numPostingsInBlock);
+    const auto deltaData = data.data() + header.dataOffset;
+    unpackBlock(deltaData, numValues, header.deltaBitWidth, docOffsets);
+    unpackBlock(deltaData + numValues / PACK_GROUP_SIZE * header.deltaBitWidth, numValues,
+        header.tfBitWidth, tfs);
+    auto docOffset = blockIdx == 0 ? 0 : blocks[blockIdx - 1].lastDocOffset;
+    for (auto i = 0u; i < numPostingsInBlock; i++) {
+        docOffset += docOffsets[i];
+        docOffsets[i] = docOffset;
+    }
+    return numPostingsInBlock;
+}
+
+void PostingList::serialize(Serializer& serializer) const {
+    serializer.write<uint64_t>(numPostings);
+    serializer.write<uint64_t>(blocks.size());
+    serializer.write(reinterpret_cast<const uint8_t*>(blocks.data()),
+        blocks.size() * sizeof(BlockHeader));
+    serializer.write<uint64_t>(data.size());
+    serializer.write(reinterpret_cast<const uint8_t*>(data.data()), data.size() * sizeof(uint32_t));
+}
+
+PostingList PostingList::deserialize(Deserializer& deSer) {
+    PostingList postingList;
+    uint64_t numBlocks = 0;
+    uint64_t dataSize = 0;
+    deSer.deserializeValue<uint64_t>(postingList.numPostings);
+    deSer.deserializeValue<uint64_t>(numBlocks);
+    postingList.blocks.resize(numBlocks);
+    deSer.read(reinterpret_cast<uint8_t*>(postingList.blocks.data()),
+        numBlocks * sizeof(BlockHeader));
+    deSer.deserializeValue<uint64_t>(dataSize);
+    postingList.data.resize(dataSize);
+    deSer.read(reinterpret_cast<uint8_t*>(postingList.data.data()), dataSize * sizeof(uint32_t));
+    return postingList;
+}
+
+PostingListIterator::PostingListIterator(const PostingList& postingList)
+    : postingList{postingList}, blockIdx{0}, posInBlock{0}, numPostingsInBlock{0} {
+    loadBlock(0);
+}
+
+void PostingListIterator::loadBlock(idx_t idx) {
+    blockIdx = idx;
+    posInBlock = 0;
+    if (!isDone()) {
+        numPostingsInBlock = postingList.decodeBlock(blockIdx, docOffsets, tfs);
+    }
+}
+
+void PostingListIterator::next() {
+    KU_ASSERT(!isDone());
+    if (++posInBlock == numPostingsInBlock) {
+        loadBlock(blockIdx + 1);
+    }
+}
+
+void PostingListIterator::advance(offset_t target) {
+    if (isDone() || postingList.blocks[blockIdx].lastDocOffset < target) {
+        auto idx = blockIdx;
+        while (idx < postingList.getNumBlocks() && postingList.blocks[idx].lastDocOffset < target) {
+            idx++;
+        }
+        if (idx != blockIdx || isDone()) {
+            loadBlock(idx);
+        }
+    }
+    while (!isDone() && docOffsets[posInBlock] < target) {
+        next();
+    }
+}
+
+void FTSPostingLists::serialize(Serializer& serializer) const {
+    serializer.write<uint64_t>(postingLists.size());
+    for (auto& [termOffset, postingList] : postingLists) {
+        serializer.write<offset_t>(termOffset);
+        postingList.serialize(serializer);
+    }
+}
+
+std::unique_ptr<FTSPostingLists> FTSPostingLists::deserialize(Deserializer& deSer) {
+    auto postingLists = std::make_unique<FTSPostingLists>();
+    uint64_t numPostingLists = 0;
+    deSer.deserializeValue<uint64_t>(numPostingLists);
+    for (auto i = 0u; i < numPostingLists; i++) {
+        offset_t termOffset = INVALID_OFFSET;
+        deSer.deserializeValue<offset_t>(termOffset);
+        postingLists->addPostingList(termOffset, PostingList::deserialize(deSer));
+    }
+    return postingLists;
+}
+
+} // namespace fts_extension
+} // namespace ryu
@@ -1,6 +1,9 @@
 #include "cached_file_manager.h"
 
+#include <future>
+
 #include "common/string_utils.h"
+#include "http_config.h"
 #include "httpfs.h"
 #include "httpfs_extension.h"
 
@@ -10,60 +13,122 @@ namespace httpfs_extension {
 using namespace common;
 
 CachedFileManager::CachedFileManager(main::ClientContext* context)
-    : vfs{VirtualFileSystem::GetUnsafe(*context)} {
-    cacheDir = common::stringFormat("{}/{}",
+    : vfs{VirtualFileSystem::GetUnsafe(*context)}, numSlotsUsed{0} {
+    auto cacheDir = common::stringFormat("{}/{}",
         extension::ExtensionUtils::getLocalDirForExtension(context,
             StringUtils::getLower(HttpfsExtension::EXTENSION_NAME)),
         ".cached_files");
     if (!vfs->fileOrPathExists(cacheDir, context)) {
         vfs->createDir(cacheDir);
     }
-    downloadBuffer = std::make_unique<uint8_t[]>(MAX_SEGMENT_SIZE);
+    // The index of cached blocks is kept in memory, so blocks of a previous run are dropped.
+    cacheFileInfo = vfs->openFile(common::stringFormat("{}/blocks", cacheDir),
+        FileOpenFlags(FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS | FileFlags::READ_ONLY |
+                      FileFlags::WRITE));
+    auto maxCacheSize =
+        context->getCurrentSetting(HTTPCacheFileConfig::HTTP_CACHE_MAX_SIZE_OPTION)
+            .getValue<int64_t>();
+    maxNumBlocks = std::max<uint64_t>(1, maxCacheSize / BLOCK_SIZE);
 }
 
-std::unique_ptr<FileInfo> CachedFileManager::getCachedFileInfo(HTTPFileInfo* httpFileInfo,
-    common::transaction_t transactionID) {
-    std::unique_lock<std::mutex> lck{mtx};
-    auto cachePathForTrx = getCachedDirForTrx(transactionID);
-    if (!vfs->fileOrPathExists(cachePathForTrx)) {
-        vfs->createDir(cachePathForTrx);
+void CachedFileManager::read(HTTPFileInfo* fileInfo, uint8_t* buffer, uint64_t numBytes,
+    uint64_t position) {
+    if (numBytes == 0) {
+        return;
     }
-    auto fileName = FileSystem::getFileName(httpFileInfo->path);
-    auto cacheFilePath = getCachedFilePath(fileName, transactionID);
-    if (!vfs->fileOrPathExists(cacheFilePath)) {
-        auto cacheFileInfo =
-            vfs->openFile(cacheFilePath, FileOpenFlags(FileFlags::CREATE_IF_NOT_EXISTS |
-                                                       FileFlags::READ_ONLY | FileFlags::WRITE));
-        downloadFile(httpFileInfo, cacheFileInfo.get());
+    auto firstBlockIdx = position / BLOCK_SIZE;
+    auto lastBlockIdx = (position + numBytes - 1) / BLOCK_SIZE;
+    auto lastBlockIdxToFetch =
+        std::min(lastBlockIdx + NUM_READ_AHEAD_BLOCKS, (fileInfo->length - 1) / BLOCK_SIZE);
+    std::vector<BlockRange> missingRanges;
+    {
+        std::unique_lock<std::mutex> lck{mtx};
+        for (auto blockIdx = firstBlockIdx; blockIdx <= lastBlockIdxToFetch; blockIdx++) {
+            auto it = blocks.find(getBlockKey(fileInfo, blockIdx));
+            if (it == blocks.end()) {
+                if (!missingRanges.empty() &&
+                    missingRanges.back().startBlockIdx + missingRanges.back().numBlocks ==
+                        blockIdx &&
+                    missingRanges.back().numBlocks < MAX_BLOCKS_PER_REQUEST) {
+                    missingRanges.back().numBlocks++;
+                } else {
+                    missingRanges.push_back({blockIdx, 1});
+                }
+                continue;
+            }
+            auto& block = it->second;
+            lruList.splice(lruList.begin(), lruList, block.lruIterator);
+            if (blockIdx > lastBlockIdx) {
+                continue;
+            }
+            auto blockStart = blockIdx * BLOCK_SIZE;
+            auto copyStart = std::max(blockStart, position);
+            auto copyEnd = std::min(blockStart + block.size, position + numBytes);
+            cacheFileInfo->readFromFile(buffer + (copyStart - position), copyEnd - copyStart,
+                block.slotIdx * BLOCK_SIZE + (copyStart - blockStart));
+        }
+    }
+    if (missingRanges.empty()) {
+        return;
+    }
+    // Requests on the client of the file are serialized, so every other range borrows a client.
+    std::vector<std::future<void>> fetches;
+    for (auto i = 1u; i < missingRanges.size(); i++) {
+        fetches.push_back(std::async(std::launch::async, [&, range = missingRanges[i]]() {
+            PooledHTTPClient client{*fileInfo};
+            fetchRange(fileInfo, range, buffer, numBytes, position, client.get());
+        }));
+    }
+    fetchRange(fileInfo, missingRanges[0], buffer, numBytes, position, nullptr /* client */);
+    for (auto& fetch : fetches) {
+        fetch.get();
     }
-    return vfs->openFile(cacheFilePath, FileOpenFlags(FileFlags::READ_ONLY));
-}
-
-void CachedFileManager::cleanUP(main::ClientContext* context) {
-    auto cacheDirForTrx = getCachedDirForTrx(transaction::Transaction::Get(*context)->getID());
-    vfs->removeFileIfExists(cacheDirForTrx, context);
 }
 
-std::string CachedFileManager::getCachedFilePath(const std::string& originalFileName,
-    common::transaction_t transactionID) {
-    return common::stringFormat("{}/{}/{}", cacheDir, transactionID, originalFileName);
+std::string CachedFileManager::getBlockKey(const HTTPFileInfo* fileInfo, uint64_t blockIdx) {
+    return common::stringFormat("{}|{}|{}", fileInfo->path, fileInfo->etag, blockIdx);
 }
 
-std::string CachedFileManager::getCachedDirForTrx(common::transaction_t transactionID) {
-    return common::stringFormat("{}/{}", cacheDir, transactionID);
+void CachedFileManager::fetchRange(HTTPFileInfo* fileInfo, BlockRange range, uint8_t* buffer,
+    uint64_t numBytes, uint64_t position, httplib::Client* client) {
+    auto rangeStart = range.startBlockIdx * BLOCK_SIZE;
+    auto rangeEnd =
+        std::min((range.startBlockIdx + range.numBlocks) * BLOCK_SIZE, fileInfo->length);
+    auto data = std::make_unique<uint8_t[]>(rangeEnd - rangeStart);
+    auto hfs = fileInfo->fileSystem->ptrCast<HTTPFileSystem>();
+    hfs->getRangeRequest(fileInfo, fileInfo->path, {}, rangeStart,
+        reinterpret_cast<char*>(data.get()), rangeEnd - rangeStart, client);
+    auto copyStart = std::max(rangeStart, position);
+    auto copyEnd = std::min(rangeEnd, position + numBytes);
+    if (copyStart < copyEnd) {
+        memcpy(buffer + (copyStart - position), data.get() + (copyStart - rangeStart),
+            copyEnd - copyStart);
+    }
+    std::unique_lock<std::mutex> lck{mtx};
+    for (auto i = 0u; i < range.numBlocks; i++) {
+        auto blockStart = (range.startBlockIdx + i) * BLOCK_SIZE;
+        addBlock(getBlockKey(fileInfo, range.startBlockIdx + i),
+            data.get() + (blockStart - rangeStart), std::min(BLOCK_SIZE, rangeEnd - blockStart));
+    }
 }
 
-void CachedFileManager::downloadFile(HTTPFileInfo* fileToDownload, FileInfo* cacheFileInfo) {
-    fileToDownload->initMetadata();
-    uint64_t numBytesRead = 0;
-    uint64_t offsetToWrite = 0;
-    do {
-        numBytesRead = fileToDownload->readFile(downloadBuffer.get(), MAX_SEGMENT_SIZE);
-        cacheFileInfo->writeFile(downloadBuffer.get(), numBytesRead, offsetToWrite);
-        offsetToWrite += numBytesRead;
-    } while (numBytesRead != 0);
-    fileToDownload->seek(0, SEEK_SET /* whence is unused by http filesystem seek */);
-    cacheFileInfo->syncFile();
+void CachedFileManager::addBlock(const std::string& key, const uint8_t* data, uint64_t size) {
+    // Another reader may have fetched the same block concurrently.
+    if (blocks.contains(key)) {
+        return;
+    }
+    uint64_t slotIdx = 0;
+    if (numSlotsUsed < maxNumBlocks) {
+        slotIdx = numSlotsUsed++;
+    } else {
+        auto& evictedKey = lruList.back();
+        slotIdx = blocks.at(evictedKey).slotIdx;
+        blocks.erase(evictedKey);
+        lruList.pop_back();
+    }
+    cacheFileInfo->writeFile(data, size, slotIdx * BLOCK_SIZE);
+    lruList.push_front(key);
+    blocks.emplace(key, CachedBlock{slotIdx, size, lruList.begin()});
 }
 
 } // namespace httpfs_extension
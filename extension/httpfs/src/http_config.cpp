@@ -10,6 +10,9 @@ HTTPConfig::HTTPConfig(main::ClientContext* context) {
     KU_ASSERT(context != nullptr);
     cacheFile =
         context->getCurrentSetting(HTTPCacheFileConfig::HTTP_CACHE_FILE_OPTION).getValue<bool>();
+    maxConcurrentRequests = std::max<int64_t>(1,
+        context->getCurrentSetting(HTTPConcurrencyConfig::HTTP_MAX_CONCURRENT_REQUESTS_OPTION)
+            .getValue<int64_t>());
 }
 
 void HTTPConfigEnvProvider::setOptionValue(main::ClientContext* context) {
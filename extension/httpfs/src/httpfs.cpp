@@ -1,9 +1,10 @@
 #include "httpfs.h"
 
+#include <future>
+
 #include "common/cast.h"
 #include "common/exception/io.h"
 #include "common/exception/not_implemented.h"
-#include "transaction/transaction.h"
 
 namespace ryu {
 namespace httpfs_extension {
@@ -21,7 +22,7 @@ HTTPFileInfo::HTTPFileInfo(std::string path, FileSystem* fileSystem, int flags,
     main::ClientContext* context)
     : FileInfo{std::move(path), fileSystem}, flags{flags}, length{0}, availableBuffer{0},
       bufferIdx{0}, fileOffset{0}, bufferStartPos{0}, bufferEndPos{0}, httpConfig{context},
-      cachedFileInfo{nullptr} {}
+      cachedFileManager{nullptr} {}
 
 void HTTPFileInfo::initMetadata() {
     auto hfs = fileSystem->ptrCast<HTTPFileSystem>();
@@ -76,6 +77,10 @@ void HTTPFileInfo::initMetadata() {
         }
     }
 
+    if (res->headers.contains("ETag")) {
+        etag = res->headers["ETag"];
+    }
+
     // Initialize the read buffer now that we know the file exists
     if (flags & FileFlags::READ_ONLY) {
         readBuffer = std::make_unique<uint8_t[]>(READ_BUFFER_LEN);
@@ -108,19 +113,27 @@ void HTTPFileInfo::initMetadata() {
     }
 }
 
-void HTTPFileInfo::initialize(main::ClientContext* context) {
-    if (httpConfig.cacheFile && !VirtualFileSystem::GetUnsafe(*context)->isCompressedFile(path)) {
-        auto hfs = fileSystem->ptrCast<HTTPFileSystem>();
-        cachedFileInfo = hfs->getCachedFileManager().getCachedFileInfo(this,
-            transaction::Transaction::Get(*context)->getID());
-        return;
-    }
+void HTTPFileInfo::initialize(main::ClientContext* /*context*/) {
     initMetadata();
+    if (httpConfig.cacheFile && !(flags & FileFlags::WRITE)) {
+        cachedFileManager = &fileSystem->ptrCast<HTTPFileSystem>()->getCachedFileManager();
+    }
 }
 
 void HTTPFileInfo::initializeClient() {
-    auto [host, hostPath] = HTTPFileSystem::parseUrl(path);
-    httpClient = HTTPFileSystem::getClient(host.c_str());
+    httpClient = HTTPFileSystem::getClient(getHost());
+}
+
+std::string HTTPFileInfo::getHost() const {
+    return HTTPFileSystem::parseUrl(path).first;
+}
+
+PooledHTTPClient::PooledHTTPClient(const HTTPFileInfo& fileInfo)
+    : fileSystem{fileInfo.fileSystem->constPtrCast<HTTPFileSystem>()}, host{fileInfo.getHost()},
+      client{fileSystem->acquireClient(host)} {}
+
+PooledHTTPClient::~PooledHTTPClient() {
+    fileSystem->releaseClient(host, std::move(client));
 }
 
 std::unique_ptr<common::FileInfo> HTTPFileSystem::openFile(const std::string& path,
@@ -149,9 +162,6 @@ bool HTTPFileSystem::fileOrPathExists(const std::string& path, main::ClientConte
     try {
         auto fileInfo = openFile(path, flags, context);
         auto httpFileInfo = fileInfo->constPtrCast<HTTPFileInfo>();
-        if (httpFileInfo->cachedFileInfo != nullptr) {
-            return true;
-        }
         if (httpFileInfo->length == 0) {
             return false;
         }
@@ -161,19 +171,14 @@ bool HTTPFileSystem::fileOrPathExists(const std::string& path, main::ClientConte
     }
 }
 
-void HTTPFileSystem::cleanUP(main::ClientContext* context) {
-    if (cachedFileManager != nullptr) {
-        cachedFileManager->cleanUP(context);
-    }
-}
-
 void HTTPFileSystem::readFromFile(common::FileInfo& fileInfo, void* buffer, uint64_t numBytes,
     uint64_t position) const {
     auto& httpFileInfo = fileInfo.cast<HTTPFileInfo>();
     auto numBytesToRead = numBytes;
     auto bufferOffset = 0;
-    if (httpFileInfo.cachedFileInfo != nullptr) {
-        httpFileInfo.cachedFileInfo->readFromFile(buffer, numBytes, position);
+    if (httpFileInfo.cachedFileManager != nullptr) {
+        httpFileInfo.cachedFileManager->read(&httpFileInfo, static_cast<uint8_t*>(buffer),
+            numBytes, position);
         httpFileInfo.fileOffset = position + numBytes;
         return;
     }
@@ -209,7 +214,7 @@ void HTTPFileSystem::readFromFile(common::FileInfo& fileInfo, void* buffer, uint
 
             // Bypass buffer if we read more than buffer size.
             if (numBytesToRead > newBufferAvailableSize) {
-                getRangeRequest(&httpFileInfo, httpFileInfo.path, {}, position + bufferOffset,
+                getRangeConcurrently(httpFileInfo, position + bufferOffset,
                     (char*)buffer + bufferOffset, numBytesToRead);
                 httpFileInfo.availableBuffer = 0;
                 httpFileInfo.bufferIdx = 0;
@@ -229,9 +234,6 @@ void HTTPFileSystem::readFromFile(common::FileInfo& fileInfo, void* buffer, uint
 
 int64_t HTTPFileSystem::readFile(common::FileInfo& fileInfo, void* buf, size_t numBytes) const {
     auto& httpFileInfo = fileInfo.constCast<HTTPFileInfo>();
-    if (httpFileInfo.cachedFileInfo != nullptr) {
-        return httpFileInfo.cachedFileInfo->readFile(buf, numBytes);
-    }
     auto maxNumBytesToRead = httpFileInfo.length - httpFileInfo.fileOffset;
     numBytes = std::min<uint64_t>(maxNumBytesToRead, numBytes);
     if (httpFileInfo.fileOffset > httpFileInfo.getFileSize()) {
@@ -245,21 +247,15 @@ void HTTPFileSystem::syncFile(const common::FileInfo&) const {
     throw NotImplementedException("syncFile is not supported in HTTPFileSystem");
 }
 
-int64_t HTTPFileSystem::seek(common::FileInfo& fileInfo, uint64_t offset, int whence) const {
+int64_t HTTPFileSystem::seek(common::FileInfo& fileInfo, uint64_t offset,
+    int /*whence*/) const {
     auto& httpFileInfo = fileInfo.cast<HTTPFileInfo>();
-    if (httpFileInfo.cachedFileInfo != nullptr) {
-        httpFileInfo.cachedFileInfo->seek(offset, whence);
-        return offset;
-    }
     httpFileInfo.fileOffset = offset;
     return offset;
 }
 
 uint64_t HTTPFileSystem::getFileSize(const common::FileInfo& fileInfo) const {
     auto& httpFileInfo = fileInfo.constCast<HTTPFileInfo>();
-    if (httpFileInfo.cachedFileInfo != nullptr) {
-        return httpFileInfo.cachedFileInfo->getFileSize();
-    }
     return httpFileInfo.length;
 }
 
@@ -277,6 +273,28 @@ std::unique_ptr<httplib::Client> HTTPFileSystem::getClient(const std::string& ho
     return client;
 }
 
+std::unique_ptr<httplib::Client> HTTPFileSystem::acquireClient(const std::string& host) const {
+    {
+        std::unique_lock<std::mutex> lck{clientPoolMtx};
+        auto& clients = clientPool[host];
+        if (!clients.empty()) {
+            auto client = std::move(clients.back());
+            clients.pop_back();
+            return client;
+        }
+    }
+    return getClient(host);
+}
+
+void HTTPFileSystem::releaseClient(const std::string& host,
+    std::unique_ptr<httplib::Client> client) const {
+    std::unique_lock<std::mutex> lck{clientPoolMtx};
+    auto& clients = clientPool[host];
+    if (clients.size() < HTTPParams::MAX_NUM_IDLE_CLIENTS_PER_HOST) {
+        clients.push_back(std::move(client));
+    }
+}
+
 std::unique_ptr<httplib::Headers> HTTPFileSystem::getHTTPHeaders(HeaderMap& headerMap) {
     auto headers = std::make_unique<httplib::Headers>();
     for (auto& entry : headerMap) {
@@ -386,7 +404,7 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::headRequest(FileInfo* fileInfo,
 
 std::unique_ptr<HTTPResponse> HTTPFileSystem::getRangeRequest(FileInfo* fileInfo,
     const std::string& url, HeaderMap headerMap, uint64_t fileOffset, char* buffer,
-    uint64_t bufferLen) const {
+    uint64_t bufferLen, httplib::Client* client) const {
     auto httpFileInfo = ku_dynamic_cast<HTTPFileInfo*>(fileInfo);
     auto parsedURL = parseUrl(url);
     auto host = parsedURL.first;
@@ -399,7 +417,8 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::getRangeRequest(FileInfo* fileInfo
     uint64_t bufferOffset = 0;
 
     std::function<httplib::Result(void)> request([&]() {
-        return httpFileInfo->httpClient->Get(
+        auto requestClient = client != nullptr ? client : httpFileInfo->httpClient.get();
+        return requestClient->Get(
             hostPath.c_str(), *headers,
             [&](const httplib::Response& response) {
                 if (response.status >= 400) {
@@ -443,10 +462,36 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::getRangeRequest(FileInfo* fileInfo
                 return true;
             });
     });
-    std::function<void(void)> retryFunc([&]() { httpFileInfo->httpClient = getClient(host); });
+    std::function<void(void)> retryFunc([&]() {
+        if (client == nullptr) {
+            httpFileInfo->httpClient = getClient(host);
+        }
+    });
     return runRequestWithRetry(request, url, "GET Range", retryFunc);
 }
 
+void HTTPFileSystem::getRangeConcurrently(HTTPFileInfo& fileInfo, uint64_t fileOffset,
+    char* buffer, uint64_t bufferLen) const {
+    auto numRequests = std::clamp<uint64_t>(bufferLen / HTTPParams::MIN_CONCURRENT_REQUEST_SIZE,
+        1, fileInfo.httpConfig.maxConcurrentRequests);
+    auto requestSize = (bufferLen + numRequests - 1) / numRequests;
+    std::vector<std::future<void>> requests;
+    for (auto i = 1u; i < numRequests; i++) {
+        auto start = i * requestSize;
+        auto size = std::min(requestSize, bufferLen - start);
+        requests.push_back(std::async(std::launch::async, [&, start, size]() {
+            PooledHTTPClient client{fileInfo};
+            getRangeRequest(&fileInfo, fileInfo.path, {}, fileOffset + start, buffer + start,
+                size, client.get());
+        }));
+    }
+    getRangeRequest(&fileInfo, fileInfo.path, {}, fileOffset, buffer,
+        std::min(requestSize, bufferLen));
+    for (auto& request : requests) {
+        request.get();
+    }
+}
+
 std::unique_ptr<HTTPResponse> HTTPFileSystem::postRequest(common::FileInfo* fileInfo,
     const std::string& url, HeaderMap headerMap, std::unique_ptr<uint8_t[]>& outputBuffer,
     uint64_t& outputBufferLen, const uint8_t* inputBuffer, uint64_t inputBufferLen,
@@ -485,14 +530,14 @@ std::unique_ptr<HTTPResponse> HTTPFileSystem::postRequest(common::FileInfo* file
 
 std::unique_ptr<HTTPResponse> HTTPFileSystem::putRequest(common::FileInfo* fileInfo,
     const std::string& url, HeaderMap headerMap, const uint8_t* inputBuffer,
-    uint64_t inputBufferLen, std::string /*params*/) const {
+    uint64_t inputBufferLen, std::string /*params*/, httplib::Client* client) const {
     auto httpFileInfo = ku_dynamic_cast<HTTPFileInfo*>(fileInfo);
     auto hostPath = parseUrl(url).second;
     auto headers = getHTTPHeaders(headerMap);
     std::function<httplib::Result(void)> request([&]() {
-        auto client = httpFileInfo->httpClient.get();
-        return client->Put(hostPath.c_str(), *headers, reinterpret_cast<const char*>(inputBuffer),
-            inputBufferLen, "application/octet-stream");
+        auto requestClient = client != nullptr ? client : httpFileInfo->httpClient.get();
+        return requestClient->Put(hostPath.c_str(), *headers,
+            reinterpret_cast<const char*>(inputBuffer), inputBufferLen, "application/octet-stream");
     });
 
     return runRequestWithRetry(request, url, "PUT");
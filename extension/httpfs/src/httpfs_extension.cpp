@@ -22,6 +22,11 @@ static void registerExtensionOptions(main::Database* db) {
         common::Value{static_cast<int64_t>(50)});
     db->addExtensionOption(HTTPCacheFileConfig::HTTP_CACHE_FILE_OPTION, common::LogicalTypeID::BOOL,
         common::Value{HTTPCacheFileConfig::DEFAULT_CACHE_FILE});
+    db->addExtensionOption(HTTPCacheFileConfig::HTTP_CACHE_MAX_SIZE_OPTION,
+        common::LogicalTypeID::INT64, common::Value{HTTPCacheFileConfig::DEFAULT_CACHE_MAX_SIZE});
+    db->addExtensionOption(HTTPConcurrencyConfig::HTTP_MAX_CONCURRENT_REQUESTS_OPTION,
+        common::LogicalTypeID::INT64,
+        common::Value{HTTPConcurrencyConfig::DEFAULT_MAX_CONCURRENT_REQUESTS});
 }
 
 static void registerFileSystem(main::Database* db) {
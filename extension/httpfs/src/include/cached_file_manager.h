@@ -1,50 +1,71 @@
 #pragma once
 
+#include <list>
 #include <mutex>
+#include <unordered_map>
 
-#include "common/case_insensitive_map.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/types/types.h"
 
+namespace httplib {
+class Client;
+} // namespace httplib
+
 namespace ryu {
 namespace httpfs_extension {
 
 struct HTTPFileInfo;
 
-struct CachedFile {
-    uint64_t counter;
-    std::unique_ptr<common::FileInfo> fileInfo;
-
-    explicit CachedFile(std::unique_ptr<common::FileInfo> fileInfo)
-        : counter{0}, fileInfo{std::move(fileInfo)} {}
-
-    common::FileInfo* getFileInfo() const { return fileInfo.get(); }
+struct CachedBlock {
+    uint64_t slotIdx;
+    // The last block of a file may be shorter than BLOCK_SIZE.
+    uint64_t size;
+    std::list<std::string>::iterator lruIterator;
 };
 
+/**
+ * CachedFileManager caches fixed-size blocks of remote files in a single local cache file that is
+ * shared by all connections and transactions of the database. Blocks are keyed by the URL, the
+ * ETag of the file and the block index, so a file modified on the server is never served from
+ * stale blocks. Only blocks covering the requested ranges are fetched: adjacent missing blocks are
+ * coalesced into a single range request, a few blocks after each read are fetched ahead, and
+ * disjoint ranges are requested in parallel. Once the cache reaches its maximum size, the least
+ * recently used block is evicted.
+ */
 class CachedFileManager {
 public:
-    static constexpr uint64_t MAX_SEGMENT_SIZE = 50000000; // 50MB
+    static constexpr uint64_t BLOCK_SIZE = 1048576; // 1MB
+    static constexpr uint64_t NUM_READ_AHEAD_BLOCKS = 4;
+    static constexpr uint64_t MAX_BLOCKS_PER_REQUEST = 16;
 
 public:
     explicit CachedFileManager(main::ClientContext* context);
 
-    std::unique_ptr<common::FileInfo> getCachedFileInfo(HTTPFileInfo* httpFileInfo,
-        common::transaction_t transactionID);
-
-    void cleanUP(main::ClientContext* context);
+    void read(HTTPFileInfo* fileInfo, uint8_t* buffer, uint64_t numBytes, uint64_t position);
 
 private:
-    std::string getCachedFilePath(const std::string& originalFileName,
-        common::transaction_t transactionID);
-    std::string getCachedDirForTrx(common::transaction_t transactionID);
-    void downloadFile(HTTPFileInfo* fileToDownload, common::FileInfo* cacheFileInfo);
+    struct BlockRange {
+        uint64_t startBlockIdx;
+        uint64_t numBlocks;
+    };
+
+    static std::string getBlockKey(const HTTPFileInfo* fileInfo, uint64_t blockIdx);
+
+    // Fetches the blocks of the range, copies the part overlapping the requested range into the
+    // buffer and adds the blocks to the cache.
+    void fetchRange(HTTPFileInfo* fileInfo, BlockRange range, uint8_t* buffer, uint64_t numBytes,
+        uint64_t position, httplib::Client* client);
+    void addBlock(const std::string& key, const uint8_t* data, uint64_t size);
 
 private:
-    common::case_insensitive_map_t<std::unique_ptr<CachedFile>> cachedFiles;
     common::VirtualFileSystem* vfs;
-    std::string cacheDir;
+    std::unique_ptr<common::FileInfo> cacheFileInfo;
+    uint64_t maxNumBlocks;
+    uint64_t numSlotsUsed;
+    std::unordered_map<std::string, CachedBlock> blocks;
+    // Keys of cached blocks from the most to the least recently used.
+    std::list<std::string> lruList;
     std::mutex mtx;
-    std::unique_ptr<uint8_t[]> downloadBuffer;
 };
 
 } // namespace httpfs_extension
@@ -9,12 +9,23 @@ struct HTTPConfig {
     explicit HTTPConfig(main::ClientContext* context);
 
     bool cacheFile;
+    uint64_t maxConcurrentRequests;
+};
+
+struct HTTPConcurrencyConfig {
+    static constexpr const char* HTTP_MAX_CONCURRENT_REQUESTS_OPTION =
+        "http_max_concurrent_requests";
+    static constexpr int64_t DEFAULT_MAX_CONCURRENT_REQUESTS = 4;
 };
 
 struct HTTPCacheFileConfig {
     static constexpr const char* HTTP_CACHE_FILE_ENV_VAR = "HTTP_CACHE_FILE";
     static constexpr const char* HTTP_CACHE_FILE_OPTION = "http_cache_file";
     static constexpr bool DEFAULT_CACHE_FILE = false;
+    // Only read when the cache is created, i.e. when the first remote file is opened with the
+    // cache enabled.
+    static constexpr const char* HTTP_CACHE_MAX_SIZE_OPTION = "http_cache_max_size";
+    static constexpr int64_t DEFAULT_CACHE_MAX_SIZE = 1073741824; // 1GB
 };
 
 struct HTTPConfigEnvProvider {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "cached_file_manager.h"
+#include "common/copy_constructors.h"
 #include "common/file_system/local_file_system.h"
 #include "http_config.h"
 #include "httplib.h"
@@ -32,6 +33,9 @@ struct HTTPParams {
     static constexpr uint64_t DEFAULT_RETRY_WAIT_MS = 100;
     static constexpr float DEFAULT_RETRY_BACKOFF = 4;
     static constexpr bool DEFAULT_KEEP_ALIVE = true;
+    // Reads are split into concurrent range requests of at least this size.
+    static constexpr uint64_t MIN_CONCURRENT_REQUEST_SIZE = 4194304; // 4MB
+    static constexpr uint64_t MAX_NUM_IDLE_CLIENTS_PER_HOST = 32;
 };
 
 struct HTTPFileInfo : public common::FileInfo {
@@ -40,7 +44,10 @@ struct HTTPFileInfo : public common::FileInfo {
 
     virtual void initialize(main::ClientContext* context);
 
-    virtual void initializeClient();
+    void initializeClient();
+
+    // Returns the protocol, host and port requests for the file are sent to.
+    virtual std::string getHost() const;
 
     void initMetadata();
 
@@ -49,6 +56,8 @@ struct HTTPFileInfo : public common::FileInfo {
 
     int flags;
     uint64_t length;
+    // Empty if the server does not return an ETag.
+    std::string etag;
     uint64_t availableBuffer;
     uint64_t bufferIdx;
     uint64_t fileOffset;
@@ -57,11 +66,13 @@ struct HTTPFileInfo : public common::FileInfo {
     std::unique_ptr<uint8_t[]> readBuffer;
     constexpr static uint64_t READ_BUFFER_LEN = 1000000;
     HTTPConfig httpConfig;
-    std::unique_ptr<common::FileInfo> cachedFileInfo;
+    // Set if reads go through the block cache.
+    CachedFileManager* cachedFileManager;
 };
 
 class HTTPFileSystem : public common::FileSystem {
     friend struct HTTPFileInfo;
+    friend class CachedFileManager;
 
 public:
     std::unique_ptr<common::FileInfo> openFile(const std::string& path, common::FileOpenFlags flags,
@@ -76,6 +87,11 @@ public:
 
     static std::unique_ptr<httplib::Client> getClient(const std::string& host);
 
+    // Clients are pooled by host so that requests sent concurrently for the same file, or one
+    // after another for different files, reuse kept-alive connections.
+    std::unique_ptr<httplib::Client> acquireClient(const std::string& host) const;
+    void releaseClient(const std::string& host, std::unique_ptr<httplib::Client> client) const;
+
     static std::unique_ptr<httplib::Headers> getHTTPHeaders(HeaderMap& headerMap);
 
     void syncFile(const common::FileInfo& fileInfo) const override;
@@ -84,8 +100,6 @@ public:
 
     CachedFileManager& getCachedFileManager() { return *cachedFileManager; }
 
-    void cleanUP(main::ClientContext* context) override;
-
 protected:
     void readFromFile(common::FileInfo& fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const override;
@@ -103,9 +117,10 @@ protected:
     virtual std::unique_ptr<HTTPResponse> headRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap) const;
 
+    // Sends the request with the given client instead of the one of the file if it is set.
     virtual std::unique_ptr<HTTPResponse> getRangeRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, uint64_t fileOffset, char* buffer,
-        uint64_t bufferLen) const;
+        uint64_t bufferLen, httplib::Client* client = nullptr) const;
 
     virtual std::unique_ptr<HTTPResponse> postRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, std::unique_ptr<uint8_t[]>& outputBuffer,
@@ -114,13 +129,36 @@ protected:
 
     virtual std::unique_ptr<HTTPResponse> putRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, const uint8_t* inputBuffer,
-        uint64_t inputBufferLen, std::string params = "") const;
+        uint64_t inputBufferLen, std::string params = "", httplib::Client* client = nullptr) const;
+
+    // Splits the range into up to maxConcurrentRequests range requests sent in parallel.
+    void getRangeConcurrently(HTTPFileInfo& fileInfo, uint64_t fileOffset, char* buffer,
+        uint64_t bufferLen) const;
 
     void initCachedFileManager(main::ClientContext* context);
 
 private:
     std::unique_ptr<CachedFileManager> cachedFileManager;
     std::mutex cachedFileManagerMtx;
+    mutable std::mutex clientPoolMtx;
+    mutable std::unordered_map<std::string, std::vector<std::unique_ptr<httplib::Client>>>
+        clientPool;
+};
+
+// Borrows a client for the host of the file from the pool of its file system and returns it on
+// destruction.
+class PooledHTTPClient {
+public:
+    explicit PooledHTTPClient(const HTTPFileInfo& fileInfo);
+    DELETE_COPY_AND_MOVE(PooledHTTPClient);
+    ~PooledHTTPClient();
+
+    httplib::Client* get() const { return client.get(); }
+
+private:
+    const HTTPFileSystem* fileSystem;
+    std::string host;
+    std::unique_ptr<httplib::Client> client;
 };
 
 } // namespace httpfs_extension
@@ -37,7 +37,7 @@ struct S3FileInfo final : public HTTPFileInfo {
 
     void initialize(main::ClientContext* context) override;
 
-    void initializeClient() override;
+    std::string getHost() const override;
 
     std::shared_ptr<S3WriteBuffer> getBuffer(uint16_t writeBufferIdx);
 
@@ -106,7 +106,7 @@ public:
 
     static std::string decodeURL(std::string input);
 
-    ParsedS3URL parseS3URL(std::string url, S3AuthParams& params) const;
+    ParsedS3URL parseS3URL(std::string url, const S3AuthParams& params) const;
 
     std::string initializeMultiPartUpload(S3FileInfo* fileInfo) const;
 
@@ -130,7 +130,7 @@ protected:
 
     std::unique_ptr<HTTPResponse> getRangeRequest(common::FileInfo* fileInfo,
         const std::string& url, HeaderMap headerMap, uint64_t fileOffset, char* buffer,
-        uint64_t bufferLen) const override;
+        uint64_t bufferLen, httplib::Client* client = nullptr) const override;
 
     std::unique_ptr<HTTPResponse> postRequest(common::FileInfo* fileInfo, const std::string& url,
         HeaderMap headerMap, std::unique_ptr<uint8_t[]>& outputBuffer, uint64_t& outputBufferLen,
@@ -138,7 +138,7 @@ protected:
 
     std::unique_ptr<HTTPResponse> putRequest(common::FileInfo* fileInfo, const std::string& url,
         HeaderMap headerMap, const uint8_t* inputBuffer, uint64_t inputBufferLen,
-        std::string httpParams = "") const override;
+        std::string httpParams = "", httplib::Client* client = nullptr) const override;
 
 private:
     static std::string getPayloadHash(const uint8_t* buffer, uint64_t bufferLen);
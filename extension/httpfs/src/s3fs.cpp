@@ -47,10 +47,9 @@ void S3FileInfo::initialize(main::ClientContext* context) {
     }
 }
 
-void S3FileInfo::initializeClient() {
+std::string S3FileInfo::getHost() const {
     auto parsedURL = fileSystem->constPtrCast<S3FileSystem>()->parseS3URL(path, authParams);
-    auto protoHostPort = parsedURL.httpProto + parsedURL.host;
-    httpClient = HTTPFileSystem::getClient(protoHostPort);
+    return parsedURL.httpProto + parsedURL.host;
 }
 
 std::shared_ptr<S3WriteBuffer> S3FileInfo::getBuffer(uint16_t writeBufferIdx) {
@@ -353,7 +352,7 @@ bool S3FileSystem::canHandleFile(const std::string_view path) const {
     return val == 0;
 }
 
-ParsedS3URL S3FileSystem::parseS3URL(std::string url, S3AuthParams& params) const {
+ParsedS3URL S3FileSystem::parseS3URL(std::string url, const S3AuthParams& params) const {
     std::string prefix, host, bucket, path, queryParameters, trimmedS3URL;
 
     prefix = getPrefix(url, fsConfig.prefixes);
@@ -586,13 +585,13 @@ std::unique_ptr<HTTPResponse> S3FileSystem::headRequest(common::FileInfo* fileIn
 
 std::unique_ptr<HTTPResponse> S3FileSystem::getRangeRequest(common::FileInfo* fileInfo,
     const std::string& url, HeaderMap /*headerMap*/, uint64_t fileOffset, char* buffer,
-    uint64_t bufferLen) const {
+    uint64_t bufferLen, httplib::Client* client) const {
     auto& authParams = fileInfo->ptrCast<S3FileInfo>()->authParams;
     auto parsedS3URL = parseS3URL(url, authParams);
     auto s3HTTPUrl = parsedS3URL.getHTTPURL();
     auto headers = createS3Header(parsedS3URL.path, "", parsedS3URL.host, "s3", "GET", authParams);
     return HTTPFileSystem::getRangeRequest(fileInfo, s3HTTPUrl, headers, fileOffset, buffer,
-        bufferLen);
+        bufferLen, client);
 }
 
 std::unique_ptr<HTTPResponse> S3FileSystem::postRequest(common::FileInfo* fileInfo,
@@ -611,14 +610,16 @@ std::unique_ptr<HTTPResponse> S3FileSystem::postRequest(common::FileInfo* fileIn
 
 std::unique_ptr<HTTPResponse> S3FileSystem::putRequest(common::FileInfo* fileInfo,
     const std::string& url, ryu::httpfs_extension::HeaderMap /*headerMap*/,
-    const uint8_t* inputBuffer, uint64_t inputBufferLen, std::string httpParams) const {
+    const uint8_t* inputBuffer, uint64_t inputBufferLen, std::string httpParams,
+    httplib::Client* client) const {
     auto& authParams = fileInfo->ptrCast<S3FileInfo>()->authParams;
     auto parsedS3URL = parseS3URL(url, authParams);
     auto httpURL = parsedS3URL.getHTTPURL(httpParams);
     auto payloadHash = getPayloadHash(inputBuffer, inputBufferLen);
     auto headers = createS3Header(parsedS3URL.path, httpParams, parsedS3URL.host, "s3", "PUT",
         authParams, payloadHash, "application/octet-stream");
-    return HTTPFileSystem::putRequest(fileInfo, httpURL, headers, inputBuffer, inputBufferLen);
+    return HTTPFileSystem::putRequest(fileInfo, httpURL, headers, inputBuffer, inputBufferLen,
+        "" /* params */, client);
 }
 
 std::string S3FileSystem::getPayloadHash(const uint8_t* buffer, uint64_t bufferLen) {
@@ -668,8 +669,10 @@ void S3FileSystem::uploadBuffer(S3FileInfo* fileInfo,
     std::unique_ptr<HTTPResponse> res;
     case_insensitive_map_t<std::string>::iterator etagIter;
     try {
+        // Parts are uploaded concurrently, so each upload borrows its own connection.
+        PooledHTTPClient client{*fileInfo};
         res = s3FileSystem->putRequest(fileInfo, fileInfo->path, {} /* headerMap */,
-            bufferToUpload->getData(), bufferToUpload->numBytesWritten, queryParam);
+            bufferToUpload->getData(), bufferToUpload->numBytesWritten, queryParam, client.get());
         if (res->code != 200) {
             throw IOException(stringFormat("Unable to connect to URL {} {} (HTTP code {})",
                 res->url, res->error, std::to_string(res->code)));
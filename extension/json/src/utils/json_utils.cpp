@@ -288,6 +288,14 @@ common::LogicalType jsonSchema(const JsonWrapper& wrapper, int64_t depth, int64_
     return jsonSchema(yyjson_doc_get_root(wrapper.ptr), depth, breadth);
 }
 
+// Serializes the value straight into the string vector without an intermediate std::string.
+static void readJsonText(yyjson_val* val, common::ValueVector& vec, uint64_t pos) {
+    size_t len = 0;
+    auto tmp = yyjson_val_write(val, 0 /* flg */, &len);
+    StringVector::addString(&vec, pos, tmp ? tmp : "", tmp ? len : 0);
+    free(tmp); // call free to avoid alloc-dealloc mismatch
+}
+
 static void readFromJsonArr(yyjson_val* val, common::ValueVector& vec, uint64_t pos) {
     const auto& outputType = vec.dataType;
     vec.setNull(pos, false);
@@ -314,8 +322,7 @@ static void readFromJsonArr(yyjson_val* val, common::ValueVector& vec, uint64_t
         }
     } break;
     case LogicalTypeID::STRING: {
-        auto str = jsonToString(val);
-        StringVector::addString(&vec, pos, str);
+        readJsonText(val, vec, pos);
     } break;
     case LogicalTypeID::UNION: {
         // find column that is of type array or list
@@ -348,10 +355,14 @@ static void readFromJsonObj(yyjson_val* val, common::ValueVector& vec, uint64_t
     switch (outputType.getLogicalTypeID()) {
     case LogicalTypeID::STRUCT: {
         vec.setValue<int64_t>(pos, pos);
-        auto names = StructType::getFieldNames(outputType);
-        for (auto i = 0u; i < StructType::getNumFields(outputType); i++) {
+        const auto& fields = StructType::getFields(outputType);
+        // Objects usually list their keys in the same order as the struct fields, so looking them
+        // up through one iterator avoids rescanning the object for every field.
+        auto objIter = yyjson_obj_iter_with(val);
+        for (auto i = 0u; i < fields.size(); i++) {
             auto childVec = StructVector::getFieldVector(&vec, i);
-            auto childObj = yyjson_obj_get(val, names[i].c_str());
+            const auto& name = fields[i].getName();
+            auto childObj = yyjson_obj_iter_getn(&objIter, name.data(), name.size());
             if (childObj == nullptr) {
                 childVec->setNull(pos, true);
             } else {
@@ -371,13 +382,12 @@ static void readFromJsonObj(yyjson_val* val, common::ValueVector& vec, uint64_t
             key = yyjson_obj_iter_next(&it);
             value = yyjson_obj_iter_get_val(key);
             StringVector::addString(keyBuffer, listEntry.offset + i,
-                std::string_view(yyjson_get_str(key)));
+                std::string_view(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key)));
             readJsonToValueVector(value, *valBuffer, listEntry.offset + i);
         }
     } break;
     case LogicalTypeID::STRING: {
-        auto str = jsonToString(val);
-        StringVector::addString(&vec, pos, str);
+        readJsonText(val, vec, pos);
     } break;
     case LogicalTypeID::UNION: {
         // find column that is of type array or list
@@ -566,7 +576,8 @@ void readJsonToValueVector(yyjson_val* val, common::ValueVector& vec, uint64_t p
         }
         break;
     case YYJSON_TYPE_STR:
-        readFromJsonStr(yyjson_get_str(val), vec, pos);
+        readFromJsonStr(std::string_view(unsafe_yyjson_get_str(val), unsafe_yyjson_get_len(val)),
+            vec, pos);
         break;
     default:
         KU_UNREACHABLE;
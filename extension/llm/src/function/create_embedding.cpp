@@ -1,8 +1,15 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "binder/expression/expression_util.h"
 #include "common/exception/binder.h"
 #include "common/exception/connection.h"
 #include "common/string_utils.h"
 #include "function/built_in_function_utils.h"
+#include "function/embedding_cache.h"
 #include "function/llm_functions.h"
 #include "function/scalar_function.h"
 #include "httplib.h"
@@ -50,50 +57,220 @@ public:
     };
 };
 
+// Clients shared by all threads evaluating the function in a query. Their connections are kept
+// alive between requests, and their number bounds the requests in flight.
+class EmbeddingClientPool {
+public:
+    static constexpr uint64_t MAX_CONCURRENT_REQUESTS = 16;
+    static constexpr uint64_t TIMEOUT_IN_SECONDS = 30;
+
+    explicit EmbeddingClientPool(std::string host) : host{std::move(host)} {}
+
+    std::unique_ptr<httplib::Client> acquire() {
+        std::unique_lock lck{mtx};
+        cv.wait(lck,
+            [&] { return !idleClients.empty() || numClients < MAX_CONCURRENT_REQUESTS; });
+        if (!idleClients.empty()) {
+            auto client = std::move(idleClients.back());
+            idleClients.pop_back();
+            return client;
+        }
+        numClients++;
+        lck.unlock();
+        auto client = std::make_unique<httplib::Client>(host);
+        client->set_keep_alive(true);
+        client->set_connection_timeout(TIMEOUT_IN_SECONDS);
+        client->set_read_timeout(TIMEOUT_IN_SECONDS);
+        client->set_write_timeout(TIMEOUT_IN_SECONDS);
+        return client;
+    }
+
+    void release(std::unique_ptr<httplib::Client> client) {
+        {
+            std::unique_lock lck{mtx};
+            idleClients.push_back(std::move(client));
+        }
+        cv.notify_one();
+    }
+
+private:
+    std::string host;
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t numClients = 0;
+    std::vector<std::unique_ptr<httplib::Client>> idleClients;
+};
+
 struct CreateEmbeddingBindData : public FunctionBindData {
     std::shared_ptr<EmbeddingProvider> provider;
     std::string model;
+    std::shared_ptr<EmbeddingClientPool> clientPool;
+    // Null if the embedding cache is disabled.
+    std::shared_ptr<EmbeddingCache> cache;
 
     CreateEmbeddingBindData(std::vector<common::LogicalType> paramTypes,
         common::LogicalType resultType, std::shared_ptr<EmbeddingProvider> provider,
-        std::string model)
+        std::string model, std::shared_ptr<EmbeddingClientPool> clientPool,
+        std::shared_ptr<EmbeddingCache> cache)
         : FunctionBindData{std::move(paramTypes), std::move(resultType)},
-          provider{std::move(provider)}, model{std::move(model)} {}
+          provider{std::move(provider)}, model{std::move(model)},
+          clientPool{std::move(clientPool)}, cache{std::move(cache)} {}
 
     std::unique_ptr<FunctionBindData> copy() const override {
         return std::make_unique<CreateEmbeddingBindData>(common::LogicalType::copy(paramTypes),
-            resultType.copy(), provider, model);
+            resultType.copy(), provider, model, clientPool, cache);
     }
 };
 
+static constexpr uint64_t MAX_RETRIES = 5;
+static constexpr std::chrono::milliseconds INITIAL_BACKOFF{500};
+static constexpr std::chrono::milliseconds MAX_BACKOFF{8000};
+
+static bool shouldRetry(const httplib::Result& res) {
+    if (!res) {
+        // The server can't be reached at all, e.g. because the endpoint is wrong.
+        return res.error() != httplib::Error::Connection;
+    }
+    // Rate limited or temporarily unavailable.
+    return res->status == 429 || res->status >= 500;
+}
+
+static std::chrono::milliseconds getRetryDelay(const httplib::Result& res,
+    std::chrono::milliseconds backoff) {
+    if (res && res->has_header("Retry-After")) {
+        try {
+            return std::chrono::seconds{std::stoll(res->get_header_value("Retry-After"))};
+        } catch (std::exception&) {
+            // The header can also be an HTTP date, in which case the backoff is used.
+        }
+    }
+    return backoff;
+}
+
+static std::vector<std::vector<float>> embedBatch(const CreateEmbeddingBindData& bindData,
+    const std::vector<std::string>& texts) {
+    auto& provider = *bindData.provider;
+    const auto path = provider.getBatchPath(bindData.model);
+    const auto payload = provider.getBatchPayload(bindData.model, texts);
+    const auto body = payload.dump();
+    auto client = bindData.clientPool->acquire();
+    httplib::Result res;
+    auto backoff = INITIAL_BACKOFF;
+    for (auto attempt = 0u;; attempt++) {
+        // Signed headers contain a timestamp, so they are created for each attempt.
+        httplib::Headers headers;
+        try {
+            headers = provider.getHeaders(bindData.model, payload);
+        } catch (...) {
+            bindData.clientPool->release(std::move(client));
+            throw;
+        }
+        res = client->Post(path, headers, body, "application/json");
+        if (attempt == MAX_RETRIES || !shouldRetry(res)) {
+            break;
+        }
+        std::this_thread::sleep_for(getRetryDelay(res, backoff));
+        backoff = std::min(backoff * 2, MAX_BACKOFF);
+    }
+    bindData.clientPool->release(std::move(client));
+    if (!res) {
+        throw ConnectionException("Request failed: Could not connect to server <" +
+                                  provider.getClient() + "> \n" +
+                                  std::string(EmbeddingProvider::referenceRyuDocs));
+    } else if (res->status != 200) {
+        throw ConnectionException("Request failed with status " + std::to_string(res->status) +
+                                  "\n Body: " + res->body + "\n" +
+                                  std::string(EmbeddingProvider::referenceRyuDocs));
+    }
+    auto embeddings = provider.parseBatchResponse(res);
+    if (embeddings.size() != texts.size()) {
+        throw ConnectionException(stringFormat("Request returned {} embeddings for {} texts.\n{}",
+            embeddings.size(), texts.size(), std::string(EmbeddingProvider::referenceRyuDocs)));
+    }
+    return embeddings;
+}
+
+// Texts which aren't cached are embedded in batches of the provider's batch size, with up to
+// MAX_CONCURRENT_REQUESTS batches in flight, so throughput isn't bound by round trips.
 static void execFunc(const std::vector<std::shared_ptr<common::ValueVector>>& parameters,
     const std::vector<common::SelectionVector*>& /*parameterSelVectors*/,
     common::ValueVector& result, common::SelectionVector* resultSelVector, void* dataPtr) {
     auto& bindData = ((FunctionBindData*)(dataPtr))->cast<CreateEmbeddingBindData>();
-    auto& provider = bindData.provider;
-    auto model = bindData.model;
-    httplib::Client client(provider->getClient());
-    client.set_connection_timeout(30);
-    client.set_read_timeout(30);
-    client.set_write_timeout(30);
-    std::string path = provider->getPath(model);
-
-    result.resetAuxiliaryBuffer();
-    for (auto selectedPos = 0u; selectedPos < resultSelVector->getSelSize(); ++selectedPos) {
+    auto& provider = *bindData.provider;
+    const auto numTexts = resultSelVector->getSelSize();
+    std::vector<std::vector<float>> embeddings(numTexts);
+    std::vector<EmbeddingCache::key_t> cacheKeys;
+    // Positions of the texts to request.
+    std::vector<uint64_t> missingPositions;
+    std::vector<std::string> texts;
+    for (auto selectedPos = 0u; selectedPos < numTexts; ++selectedPos) {
         auto text = parameters[0]->getValue<ku_string_t>(selectedPos).getAsString();
-        nlohmann::json payload = provider->getPayload(model, text);
-        httplib::Headers headers = provider->getHeaders(model, payload);
-        auto res = client.Post(path, headers, payload.dump(), "application/json");
-        if (!res) {
-            throw ConnectionException("Request failed: Could not connect to server <" +
-                                      provider->getClient() + "> \n" +
-                                      std::string(EmbeddingProvider::referenceRyuDocs));
-        } else if (res->status != 200) {
-            throw ConnectionException("Request failed with status " + std::to_string(res->status) +
-                                      "\n Body: " + res->body + "\n" +
-                                      std::string(EmbeddingProvider::referenceRyuDocs));
+        if (bindData.cache != nullptr) {
+            auto& key = cacheKeys.emplace_back(EmbeddingCache::getKey(provider.getClient(),
+                bindData.model, provider.getPayload(bindData.model, text).dump()));
+            if (auto embedding = bindData.cache->lookup(key)) {
+                embeddings[selectedPos] = std::move(*embedding);
+                continue;
+            }
+        }
+        missingPositions.push_back(selectedPos);
+        texts.push_back(std::move(text));
+    }
+    const auto batchSize = provider.getMaxBatchSize();
+    const auto numBatches = (texts.size() + batchSize - 1) / batchSize;
+    auto embedBatchAt = [&](uint64_t batchIdx) {
+        const auto start = batchIdx * batchSize;
+        const auto end = std::min<uint64_t>(start + batchSize, texts.size());
+        auto batchEmbeddings = embedBatch(bindData,
+            std::vector<std::string>{texts.begin() + start, texts.begin() + end});
+        for (auto i = start; i < end; i++) {
+            embeddings[missingPositions[i]] = std::move(batchEmbeddings[i - start]);
         }
-        auto embeddingVec = provider->parseResponse(res);
+    };
+    if (numBatches == 1) {
+        embedBatchAt(0);
+    } else if (numBatches > 1) {
+        std::atomic<uint64_t> nextBatch = 0;
+        std::mutex errorMtx;
+        std::exception_ptr error;
+        auto embedBatches = [&]() {
+            for (auto i = nextBatch++; i < numBatches; i = nextBatch++) {
+                try {
+                    embedBatchAt(i);
+                } catch (...) {
+                    std::unique_lock lck{errorMtx};
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    // Remaining batches are skipped.
+                    nextBatch = numBatches;
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        const auto numThreads =
+            std::min<uint64_t>(numBatches, EmbeddingClientPool::MAX_CONCURRENT_REQUESTS);
+        for (auto i = 0u; i < numThreads; i++) {
+            threads.emplace_back(embedBatches);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    if (bindData.cache != nullptr && !missingPositions.empty()) {
+        std::vector<std::pair<EmbeddingCache::key_t, const std::vector<float>*>> newEntries;
+        for (const auto pos : missingPositions) {
+            newEntries.emplace_back(cacheKeys[pos], &embeddings[pos]);
+        }
+        bindData.cache->insert(newEntries);
+    }
+
+    result.resetAuxiliaryBuffer();
+    for (auto selectedPos = 0u; selectedPos < numTexts; ++selectedPos) {
+        auto& embeddingVec = embeddings[selectedPos];
         auto pos = (*resultSelVector)[selectedPos];
         auto resultEntry = ListVector::addList(&result, embeddingVec.size());
         result.setValue(pos, resultEntry);
@@ -171,9 +348,14 @@ static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& inp
                 ExpressionUtil::getDataTypes(input.arguments), supportedInputs)) +
             '\n' + EmbeddingProvider::referenceRyuDocs));
     }
+    auto clientPool = std::make_shared<EmbeddingClientPool>(provider->getClient());
+    std::shared_ptr<EmbeddingCache> cache;
+    if (clientContext->getCurrentSetting(EmbeddingCache::EMBEDDING_CACHE_OPTION).getValue<bool>()) {
+        cache = EmbeddingCache::get(clientContext);
+    }
     return std::make_unique<CreateEmbeddingBindData>(ExpressionUtil::getDataTypes(input.arguments),
         LogicalType::LIST(LogicalType(LogicalTypeID::FLOAT)), std::move(provider),
-        std::move(modelName));
+        std::move(modelName), std::move(clientPool), std::move(cache));
 }
 
 function_set CreateEmbedding::getFunctionSet() {
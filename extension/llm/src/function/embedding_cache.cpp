@@ -0,0 +1,113 @@
+#include "function/embedding_cache.h"
+
+#include <cstring>
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_utils.h"
+#include "crypto.h"
+#include "extension/extension.h"
+#include "main/client_context.h"
+#include "main/llm_extension.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace llm_extension {
+
+EmbeddingCache::EmbeddingCache(std::unique_ptr<FileInfo> fileInfo)
+    : fileInfo{std::move(fileInfo)}, fileSize{0} {
+    const auto size = this->fileInfo->getFileSize();
+    std::vector<uint8_t> data(size);
+    if (size > 0) {
+        this->fileInfo->readFromFile(data.data(), size, 0);
+    }
+    constexpr auto headerSize = sizeof(key_t) + sizeof(uint32_t);
+    // A record which was only partially written is dropped, and overwritten by the next insert.
+    while (fileSize + headerSize <= size) {
+        key_t key;
+        uint32_t numDimensions = 0;
+        memcpy(key.data(), data.data() + fileSize, sizeof(key_t));
+        memcpy(&numDimensions, data.data() + fileSize + sizeof(key_t), sizeof(uint32_t));
+        const auto recordSize = headerSize + numDimensions * sizeof(float);
+        if (fileSize + recordSize > size) {
+            break;
+        }
+        std::vector<float> embedding(numDimensions);
+        memcpy(embedding.data(), data.data() + fileSize + headerSize,
+            numDimensions * sizeof(float));
+        embeddings.insert_or_assign(key, std::move(embedding));
+        fileSize += recordSize;
+    }
+}
+
+std::shared_ptr<EmbeddingCache> EmbeddingCache::get(main::ClientContext* context) {
+    static std::mutex cachesMtx;
+    static std::unordered_map<std::string, std::weak_ptr<EmbeddingCache>> caches;
+    const auto cacheDir = extension::ExtensionUtils::getLocalDirForExtension(context,
+        StringUtils::getLower(LlmExtension::EXTENSION_NAME));
+    const auto path = stringFormat("{}/embedding_cache", cacheDir);
+    std::unique_lock lck{cachesMtx};
+    if (auto cache = caches[path].lock()) {
+        return cache;
+    }
+    auto vfs = VirtualFileSystem::GetUnsafe(*context);
+    if (!vfs->fileOrPathExists(cacheDir, context)) {
+        vfs->createDir(cacheDir);
+    }
+    auto cache = std::make_shared<EmbeddingCache>(vfs->openFile(path,
+        FileOpenFlags(FileFlags::CREATE_IF_NOT_EXISTS | FileFlags::READ_ONLY | FileFlags::WRITE),
+        context));
+    caches[path] = cache;
+    return cache;
+}
+
+EmbeddingCache::key_t EmbeddingCache::getKey(std::string_view host, std::string_view model,
+    std::string_view payload) {
+    std::string input;
+    input.reserve(host.size() + model.size() + payload.size() + 2);
+    input.append(host).append(1, '\0').append(model).append(1, '\0').append(payload);
+    httpfs_extension::hash_bytes hash;
+    httpfs_extension::sha256(input.data(), input.size(), hash);
+    key_t key;
+    memcpy(key.data(), hash, sizeof(key_t));
+    return key;
+}
+
+std::optional<std::vector<float>> EmbeddingCache::lookup(const key_t& key) {
+    std::unique_lock lck{mtx};
+    const auto it = embeddings.find(key);
+    if (it == embeddings.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void EmbeddingCache::insert(
+    const std::vector<std::pair<key_t, const std::vector<float>*>>& entries) {
+    std::vector<uint8_t> data;
+    for (auto& [key, embedding] : entries) {
+        const auto numDimensions = static_cast<uint32_t>(embedding->size());
+        const auto offset = data.size();
+        data.resize(offset + sizeof(key_t) + sizeof(uint32_t) + numDimensions * sizeof(float));
+        memcpy(data.data() + offset, key.data(), sizeof(key_t));
+        memcpy(data.data() + offset + sizeof(key_t), &numDimensions, sizeof(uint32_t));
+        memcpy(data.data() + offset + sizeof(key_t) + sizeof(uint32_t), embedding->data(),
+            numDimensions * sizeof(float));
+    }
+    std::unique_lock lck{mtx};
+    fileInfo->writeFile(data.data(), data.size(), fileSize);
+    fileSize += data.size();
+    for (auto& [key, embedding] : entries) {
+        embeddings.insert_or_assign(key, *embedding);
+    }
+}
+
+size_t EmbeddingCache::KeyHash::operator()(const key_t& key) const {
+    // The key is a cryptographic hash, so any of its words is uniformly distributed.
+    size_t hash = 0;
+    memcpy(&hash, key.data(), sizeof(hash));
+    return hash;
+}
+
+} // namespace llm_extension
+} // namespace ryu
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/file_system/file_info.h"
+
+namespace ryu {
+namespace main {
+class ClientContext;
+}
+
+namespace llm_extension {
+
+/**
+ * Embeddings of previous CREATE_EMBEDDING calls, persisted in the local directory of the extension
+ * so that re-embedding mostly unchanged texts only requests the new or changed ones. Entries are
+ * keyed by the SHA-256 of the provider's host, the model and the request payload of the text,
+ * which also covers configuration such as dimensions. The file is an append-only log of
+ * (key, uint32 number of dimensions, float values) records, which is read into memory when the
+ * cache is first used.
+ */
+class EmbeddingCache {
+public:
+    static constexpr const char* EMBEDDING_CACHE_OPTION = "llm_embedding_cache";
+    static constexpr bool DEFAULT_EMBEDDING_CACHE = false;
+
+    using key_t = std::array<uint8_t, 32>;
+
+    explicit EmbeddingCache(std::unique_ptr<common::FileInfo> fileInfo);
+
+    // Returns the cache of the extension directory of the context, which is shared by databases.
+    static std::shared_ptr<EmbeddingCache> get(main::ClientContext* context);
+
+    static key_t getKey(std::string_view host, std::string_view model, std::string_view payload);
+
+    std::optional<std::vector<float>> lookup(const key_t& key);
+    void insert(const std::vector<std::pair<key_t, const std::vector<float>*>>& entries);
+
+private:
+    struct KeyHash {
+        size_t operator()(const key_t& key) const;
+    };
+
+    std::mutex mtx;
+    std::unique_ptr<common::FileInfo> fileInfo;
+    uint64_t fileSize;
+    std::unordered_map<key_t, std::vector<float>, KeyHash> embeddings;
+};
+
+} // namespace llm_extension
+} // namespace ryu
@@ -20,6 +20,11 @@ public:
         const nlohmann::json& payload) const override;
     nlohmann::json getPayload(const std::string& model, const std::string& text) const override;
     std::vector<float> parseResponse(const httplib::Result& res) const override;
+    uint64_t getMaxBatchSize() const override;
+    std::string getBatchPath(const std::string& model) const override;
+    nlohmann::json getBatchPayload(const std::string& model,
+        const std::vector<std::string>& texts) const override;
+    std::vector<std::vector<float>> parseBatchResponse(const httplib::Result& res) const override;
     void configure(const std::optional<uint64_t>& dimensions,
         const std::optional<std::string>& endpoint) override;
 
@@ -19,6 +19,18 @@ public:
         const nlohmann::json& payload) const = 0;
     virtual nlohmann::json getPayload(const std::string& model, const std::string& text) const = 0;
     virtual std::vector<float> parseResponse(const httplib::Result& res) const = 0;
+    // Providers whose API embeds several texts in one request override the batch functions. By
+    // default, a batch is a single text.
+    virtual uint64_t getMaxBatchSize() const { return 1; }
+    virtual std::string getBatchPath(const std::string& model) const { return getPath(model); }
+    virtual nlohmann::json getBatchPayload(const std::string& model,
+        const std::vector<std::string>& texts) const {
+        return getPayload(model, texts[0]);
+    }
+    // Returns the embeddings in the order of the texts of the batch.
+    virtual std::vector<std::vector<float>> parseBatchResponse(const httplib::Result& res) const {
+        return {parseResponse(res)};
+    }
     virtual void configure(const std::optional<uint64_t>& dimensions,
         const std::optional<std::string>& regionOrEndpoint) = 0;
 };
@@ -1,5 +1,6 @@
 #include "main/llm_extension.h"
 
+#include "function/embedding_cache.h"
 #include "function/llm_functions.h"
 #include "main/client_context.h"
 
@@ -18,6 +19,8 @@ void LlmExtension::load(main::ClientContext* context) {
     auto& db = *context->getDatabase();
 
     extension::ExtensionUtils::addScalarFunc<CreateEmbedding>(db);
+    db.addExtensionOption(EmbeddingCache::EMBEDDING_CACHE_OPTION, common::LogicalTypeID::BOOL,
+        common::Value{EmbeddingCache::DEFAULT_EMBEDDING_CACHE});
 }
 
 } // namespace llm_extension
@@ -1,6 +1,7 @@
 #include "providers/google-gemini.h"
 
 #include "common/exception/runtime.h"
+#include "common/string_utils.h"
 #include "function/llm_functions.h"
 #include "main/client_context.h"
 
@@ -42,6 +43,34 @@ std::vector<float> GoogleGeminiEmbedding::parseResponse(const httplib::Result& r
     return nlohmann::json::parse(res->body)["embedding"]["values"].get<std::vector<float>>();
 }
 
+uint64_t GoogleGeminiEmbedding::getMaxBatchSize() const {
+    return 100;
+}
+
+std::string GoogleGeminiEmbedding::getBatchPath(const std::string& model) const {
+    auto path = getPath(model);
+    StringUtils::replaceAll(path, ":embedContent?", ":batchEmbedContents?");
+    return path;
+}
+
+nlohmann::json GoogleGeminiEmbedding::getBatchPayload(const std::string& model,
+    const std::vector<std::string>& texts) const {
+    auto requests = nlohmann::json::array();
+    for (auto& text : texts) {
+        requests.push_back(getPayload(model, text));
+    }
+    return nlohmann::json{{"requests", requests}};
+}
+
+std::vector<std::vector<float>> GoogleGeminiEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    std::vector<std::vector<float>> embeddings;
+    for (auto& embedding : nlohmann::json::parse(res->body)["embeddings"]) {
+        embeddings.push_back(embedding["values"].get<std::vector<float>>());
+    }
+    return embeddings;
+}
+
 void GoogleGeminiEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& region) {
     if (dimensions.has_value() || region.has_value()) {
@@ -55,6 +55,33 @@ std::vector<float> GoogleVertexEmbedding::parseResponse(const httplib::Result& r
         .get<std::vector<float>>();
 }
 
+uint64_t GoogleVertexEmbedding::getMaxBatchSize() const {
+    // The API accepts up to 250 instances, but at most 20000 tokens per request.
+    return 64;
+}
+
+nlohmann::json GoogleVertexEmbedding::getBatchPayload(const std::string& /*model*/,
+    const std::vector<std::string>& texts) const {
+    auto instances = nlohmann::json::array();
+    for (auto& text : texts) {
+        instances.push_back({{"content", text}, {"task_type", "RETRIEVAL_DOCUMENT"}});
+    }
+    nlohmann::json payload{{"instances", instances}};
+    if (dimensions.has_value()) {
+        payload["parameters"] = {{"outputDimensionality", dimensions.value()}};
+    }
+    return payload;
+}
+
+std::vector<std::vector<float>> GoogleVertexEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    std::vector<std::vector<float>> embeddings;
+    for (auto& prediction : nlohmann::json::parse(res->body)["predictions"]) {
+        embeddings.push_back(prediction["embeddings"]["values"].get<std::vector<float>>());
+    }
+    return embeddings;
+}
+
 void GoogleVertexEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& region) {
     if (!region.has_value()) {
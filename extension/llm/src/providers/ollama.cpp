@@ -34,6 +34,25 @@ std::vector<float> OllamaEmbedding::parseResponse(const httplib::Result& res) co
     return nlohmann::json::parse(res->body)["embedding"].get<std::vector<float>>();
 }
 
+uint64_t OllamaEmbedding::getMaxBatchSize() const {
+    return 64;
+}
+
+std::string OllamaEmbedding::getBatchPath(const std::string& /*model*/) const {
+    // Unlike /api/embeddings, this endpoint accepts a list of inputs.
+    return "/api/embed";
+}
+
+nlohmann::json OllamaEmbedding::getBatchPayload(const std::string& model,
+    const std::vector<std::string>& texts) const {
+    return nlohmann::json{{"model", model}, {"input", texts}};
+}
+
+std::vector<std::vector<float>> OllamaEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    return nlohmann::json::parse(res->body)["embeddings"].get<std::vector<std::vector<float>>>();
+}
+
 void OllamaEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& endpoint) {
     static const std::string envVarOllamaUrl = "OLLAMA_URL";
@@ -46,6 +46,31 @@ std::vector<float> OpenAIEmbedding::parseResponse(const httplib::Result& res) co
     return nlohmann::json::parse(res->body)["data"][0]["embedding"].get<std::vector<float>>();
 }
 
+uint64_t OpenAIEmbedding::getMaxBatchSize() const {
+    // The API accepts up to 2048 inputs, but also limits the number of tokens per request.
+    return 256;
+}
+
+nlohmann::json OpenAIEmbedding::getBatchPayload(const std::string& model,
+    const std::vector<std::string>& texts) const {
+    nlohmann::json payload{{"model", model}, {"input", texts}};
+    if (dimensions.has_value()) {
+        payload["dimensions"] = dimensions.value();
+    }
+    return payload;
+}
+
+std::vector<std::vector<float>> OpenAIEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    auto data = nlohmann::json::parse(res->body)["data"];
+    std::vector<std::vector<float>> embeddings(data.size());
+    for (auto& entry : data) {
+        embeddings.at(entry["index"].get<uint64_t>()) =
+            entry["embedding"].get<std::vector<float>>();
+    }
+    return embeddings;
+}
+
 void OpenAIEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& region) {
     if (region.has_value()) {
@@ -46,6 +46,31 @@ std::vector<float> VoyageAIEmbedding::parseResponse(const httplib::Result& res)
     return nlohmann::json::parse(res->body)["data"][0]["embedding"].get<std::vector<float>>();
 }
 
+uint64_t VoyageAIEmbedding::getMaxBatchSize() const {
+    // The API accepts up to 1000 inputs, but some models accept fewer tokens per request.
+    return 128;
+}
+
+nlohmann::json VoyageAIEmbedding::getBatchPayload(const std::string& model,
+    const std::vector<std::string>& texts) const {
+    nlohmann::json payload = {{"model", model}, {"input", texts}};
+    if (dimensions.has_value()) {
+        payload["output_dimension"] = dimensions.value();
+    }
+    return payload;
+}
+
+std::vector<std::vector<float>> VoyageAIEmbedding::parseBatchResponse(
+    const httplib::Result& res) const {
+    auto data = nlohmann::json::parse(res->body)["data"];
+    std::vector<std::vector<float>> embeddings(data.size());
+    for (auto& entry : data) {
+        embeddings.at(entry["index"].get<uint64_t>()) =
+            entry["embedding"].get<std::vector<float>>();
+    }
+    return embeddings;
+}
+
 void VoyageAIEmbedding::configure(const std::optional<uint64_t>& dimensions,
     const std::optional<std::string>& region) {
     if (region.has_value()) {
@@ -1,9 +1,13 @@
 #include "function/neo4j_migrate.h"
 
+#include <atomic>
+#include <thread>
+
 #include "binder/ddl/property_definition.h"
 #include "binder/expression/literal_expression.h"
 #include "common/enums/table_type.h"
 #include "common/exception/runtime.h"
+#include "common/string_utils.h"
 #include "common/types/value/nested.h"
 #include "function/table/bind_data.h"
 #include "function/table/bind_input.h"
@@ -19,22 +23,41 @@ using namespace ryu::common;
 using namespace ryu::main;
 using namespace ryu::function;
 
+struct Neo4jConnectionInfo {
+    std::string url;
+    std::string userName;
+    std::string password;
+
+    std::shared_ptr<httplib::Client> createClient() const {
+        auto cli = std::make_shared<httplib::Client>(url);
+        cli->set_basic_auth(userName, password);
+        cli->set_connection_timeout(std::chrono::seconds(1000));
+        cli->set_read_timeout(std::chrono::seconds(1000));
+        return cli;
+    }
+};
+
 struct Neo4jMigrateBindData final : TableFuncBindData {
-    std::shared_ptr<httplib::Client> client;
+    Neo4jConnectionInfo connectionInfo;
     std::vector<std::string> nodesToImport;
     std::vector<std::string> relsToImport;
+    // Number of labels and rel types exported from Neo4j concurrently.
+    uint64_t parallelism;
 
-    Neo4jMigrateBindData(std::shared_ptr<httplib::Client> client,
-        std::vector<std::string> nodesToImport, std::vector<std::string> relsToImport)
+    Neo4jMigrateBindData(Neo4jConnectionInfo connectionInfo,
+        std::vector<std::string> nodesToImport, std::vector<std::string> relsToImport,
+        uint64_t parallelism)
         : TableFuncBindData{binder::expression_vector{}, 0 /* maxOffset */},
-          client{std::move(client)}, nodesToImport{std::move(nodesToImport)},
-          relsToImport{std::move(relsToImport)} {}
+          connectionInfo{std::move(connectionInfo)}, nodesToImport{std::move(nodesToImport)},
+          relsToImport{std::move(relsToImport)}, parallelism{parallelism} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
         return std::make_unique<Neo4jMigrateBindData>(*this);
     }
 };
 
+static constexpr uint64_t DEFAULT_PARALLELISM = 4;
+
 nlohmann::json executeNeo4jQuery(httplib::Client& cli, std::string neo4jQuery) {
     std::string requestBody = R"({"statements":[{"statement":"{}"}]})";
     requestBody = common::stringFormat(requestBody, neo4jQuery);
@@ -139,20 +162,34 @@ static std::vector<std::string> getNodeOrRels(httplib::Client& cli, common::Tabl
     return labels;
 }
 
+static uint64_t bindParallelism(const optional_params_t& optionalParams) {
+    auto parallelism = DEFAULT_PARALLELISM;
+    for (auto& [name, value] : optionalParams) {
+        if (StringUtils::getLower(name) != "parallelism") {
+            throw common::RuntimeException{
+                common::stringFormat("Unrecognized optional parameter: {}.", name)};
+        }
+        value.validateType(LogicalTypeID::INT64);
+        const auto parallelismVal = value.getValue<int64_t>();
+        if (parallelismVal <= 0) {
+            throw common::RuntimeException{"Parallelism must be a positive integer."};
+        }
+        parallelism = parallelismVal;
+    }
+    return parallelism;
+}
+
 static std::unique_ptr<TableFuncBindData> bindFunc(ClientContext* /*context*/,
     const TableFuncBindInput* input) {
-    auto url = input->getLiteralVal<std::string>(0);
-    auto userName = input->getLiteralVal<std::string>(1);
-    auto password = input->getLiteralVal<std::string>(2);
-    auto cli = std::make_shared<httplib::Client>(url);
-    cli->set_basic_auth(userName, password);
-    cli->set_connection_timeout(std::chrono::seconds(1000));
-    cli->set_read_timeout(std::chrono::seconds(1000));
+    auto parallelism = bindParallelism(input->optionalParams);
+    Neo4jConnectionInfo connectionInfo{input->getLiteralVal<std::string>(0),
+        input->getLiteralVal<std::string>(1), input->getLiteralVal<std::string>(2)};
+    auto cli = connectionInfo.createClient();
     validateConnectionString(*cli);
     auto nodes = getNodeOrRels(*cli, TableType::NODE, input->getParam(3));
     auto rels = getNodeOrRels(*cli, TableType::REL, input->getParam(4));
-    return std::make_unique<Neo4jMigrateBindData>(std::move(cli), std::move(nodes),
-        std::move(rels));
+    return std::make_unique<Neo4jMigrateBindData>(std::move(connectionInfo), std::move(nodes),
+        std::move(rels), parallelism);
 }
 
 void exportNeo4jNodeToCSV(std::string nodeName, httplib::Client& cli) {
@@ -372,20 +409,63 @@ std::string getCreateRelTableQuery(httplib::Client& cli, const std::string& relN
            copyQuery;
 }
 
+// Runs func for each task on up to parallelism threads. Every thread sends its requests through
+// its own client, since a client can only send one request at a time.
+static void runConcurrently(const Neo4jMigrateBindData& bindData, uint64_t numTasks,
+    const std::function<void(httplib::Client&, uint64_t)>& func) {
+    std::atomic<uint64_t> nextTask = 0;
+    std::vector<std::exception_ptr> errors(numTasks);
+    auto worker = [&]() {
+        auto cli = bindData.connectionInfo.createClient();
+        for (auto task = nextTask++; task < numTasks; task = nextTask++) {
+            try {
+                func(*cli, task);
+            } catch (...) {
+                errors[task] = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (auto i = 1u; i < std::min(bindData.parallelism, numTasks); i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // Report the error of the first failed label, as a sequential migration would.
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 std::string migrateQuery(ClientContext& /*context*/, const TableFuncBindData& bindData) {
+    auto neo4jMigrateBindData = bindData.constPtrCast<Neo4jMigrateBindData>();
+    auto& nodes = neo4jMigrateBindData->nodesToImport;
+    auto& rels = neo4jMigrateBindData->relsToImport;
+    // Labels and rel types are exported concurrently, and their queries are collected per task so
+    // that the rewritten query doesn't depend on the order in which the exports finish.
+    std::vector<std::string> queries(nodes.size() + rels.size());
+    std::vector<std::vector<std::string>> outputTablesPerTask(queries.size());
+    runConcurrently(*neo4jMigrateBindData, queries.size(), [&](httplib::Client& cli, uint64_t i) {
+        if (i < nodes.size()) {
+            exportNeo4jNodeToCSV(nodes[i], cli);
+            auto [ddl, copyQuery] = getCreateNodeTableQuery(cli, nodes[i], outputTablesPerTask[i]);
+            queries[i] = ddl + copyQuery;
+        } else {
+            queries[i] = getCreateRelTableQuery(cli, rels[i - nodes.size()], nodes,
+                outputTablesPerTask[i]);
+        }
+    });
     std::string result;
     std::vector<std::string> outputTables;
-    auto neo4jMigrateBindData = bindData.constPtrCast<Neo4jMigrateBindData>();
-    for (auto node : neo4jMigrateBindData->nodesToImport) {
-        exportNeo4jNodeToCSV(node, *neo4jMigrateBindData->client);
-        auto [ddl, copyQuery] =
-            getCreateNodeTableQuery(*neo4jMigrateBindData->client, node, outputTables);
-        result += ddl;
-        result += copyQuery;
-    }
-    for (auto rel : neo4jMigrateBindData->relsToImport) {
-        result += getCreateRelTableQuery(*neo4jMigrateBindData->client, rel,
-            neo4jMigrateBindData->nodesToImport, outputTables);
+    for (auto i = 0u; i < queries.size(); i++) {
+        result += queries[i];
+        for (auto& outputTable : outputTablesPerTask[i]) {
+            outputTables.push_back(std::move(outputTable));
+        }
     }
     std::string outputQuery;
     outputQuery.append("UNWIND [");
@@ -0,0 +1,46 @@
+#include "catalog/diskann_index_catalog_entry.h"
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/serializer/deserializer.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::catalog;
+
+namespace ryu {
+namespace vector_extension {
+
+std::shared_ptr<common::BufferWriter> DiskANNIndexAuxInfo::serialize() const {
+    auto bufferWriter = std::make_shared<common::BufferWriter>();
+    auto serializer = common::Serializer(bufferWriter);
+    config.serialize(serializer);
+    return bufferWriter;
+}
+
+std::unique_ptr<DiskANNIndexAuxInfo> DiskANNIndexAuxInfo::deserialize(
+    std::unique_ptr<common::BufferReader> reader) {
+    common::Deserializer deSer{std::move(reader)};
+    auto config = DiskANNIndexConfig::deserialize(deSer);
+    return std::make_unique<DiskANNIndexAuxInfo>(std::move(config));
+}
+
+std::string DiskANNIndexAuxInfo::toCypher(const IndexCatalogEntry& indexEntry,
+    const ToCypherInfo& info) const {
+    auto& indexToCypherInfo = info.constCast<IndexToCypherInfo>();
+    auto context = indexToCypherInfo.context;
+    auto catalog = Catalog::Get(*context);
+    auto tableEntry = catalog->getTableCatalogEntry(transaction::Transaction::Get(*context),
+        indexEntry.getTableID());
+    auto tableName = tableEntry->getName();
+    auto propertyName = tableEntry->getProperty(indexEntry.getPropertyIDs()[0]).getName();
+    auto metricName = HNSWIndexConfig::metricToString(config.metric);
+    return common::stringFormat("CALL CREATE_DISKANN_INDEX('{}', '{}', '{}', degree := {}, "
+                                "l := {}, alpha := {}, metric := '{}');",
+        tableName, indexEntry.getIndexName(), propertyName, config.degree, config.searchListSize,
+        config.alpha, metricName);
+}
+
+} // namespace vector_extension
+} // namespace ryu
@@ -0,0 +1,128 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
+#include "function/hnsw_index_functions.h"
+#include "function/table/bind_data.h"
+#include "index/diskann_index.h"
+#include "index/hnsw_index_utils.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::common;
+using namespace ryu::function;
+
+namespace ryu {
+namespace vector_extension {
+
+static std::unique_ptr<TableFuncBindData> createDiskANNBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    const auto indexName = input->getLiteralVal<std::string>(1);
+    const auto columnName = input->getLiteralVal<std::string>(2);
+    auto config = DiskANNIndexConfig{input->optionalParams};
+    const auto nodeTableEntry = HNSWIndexUtils::bindNodeTable(*context, tableName);
+    if (HNSWIndexUtils::validateIndexExistence(*context, nodeTableEntry, indexName,
+            HNSWIndexUtils::IndexOperation::CREATE, config.conflictAction)) {
+        return std::make_unique<CreateDiskANNIndexBindData>(indexName, nullptr, 0,
+            std::move(config),
+            true); // Placeholders for nodeTableEntry, propertyID - WILL NOT BE ACCESSED
+    }
+    HNSWIndexUtils::validateColumnType(*nodeTableEntry, columnName);
+    const auto propertyID = nodeTableEntry->getPropertyID(columnName);
+    const auto& columnType = nodeTableEntry->getProperty(propertyID).getType();
+    DiskANNIndex::validateBlockSize(config.degree, ArrayType::getNumElements(columnType));
+    return std::make_unique<CreateDiskANNIndexBindData>(indexName, nodeTableEntry, propertyID,
+        std::move(config));
+}
+
+static offset_t createDiskANNTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    const auto bindData = input.bindData->constPtrCast<CreateDiskANNIndexBindData>();
+    const auto transaction = transaction::Transaction::Get(*clientContext);
+    const auto catalog = catalog::Catalog::Get(*clientContext);
+    const auto nodeTableID = bindData->tableEntry->getTableID();
+    auto auxInfo = std::make_unique<DiskANNIndexAuxInfo>(bindData->config.copy());
+    auto indexEntry = std::make_unique<catalog::IndexCatalogEntry>(
+        DiskANNIndexCatalogEntry::TYPE_NAME, nodeTableID, bindData->indexName,
+        std::vector{bindData->propertyID}, std::move(auxInfo));
+    catalog->createIndex(transaction, std::move(indexEntry));
+    const auto columnID = bindData->tableEntry->getColumnID(bindData->propertyID);
+    const auto diskANNIndexType = DiskANNIndex::getIndexType();
+    storage::IndexInfo indexInfo{bindData->indexName, diskANNIndexType.typeName, nodeTableID,
+        {columnID}, {PhysicalTypeID::ARRAY},
+        diskANNIndexType.constraintType == storage::IndexConstraintType::PRIMARY,
+        diskANNIndexType.definitionType == storage::IndexDefinitionType::BUILTIN};
+    auto index = std::make_unique<DiskANNIndex>(clientContext, indexInfo,
+        std::make_unique<DiskANNStorageInfo>(), bindData->config.copy());
+    index->build(transaction);
+    const auto nodeTable = storage::StorageManager::Get(*clientContext)
+                               ->getTable(nodeTableID)
+                               ->ptrCast<storage::NodeTable>();
+    nodeTable->addIndex(std::move(index));
+    // Indexes are only checkpointed with tables that have changes. Make sure the blocks are
+    // written to the data file by the forced checkpoint below.
+    nodeTable->setHasChanges();
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set InternalCreateDiskANNIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    std::vector inputTypes = {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING};
+    auto func = std::make_unique<TableFunction>(name, inputTypes);
+    func->bindFunc = createDiskANNBindFunc;
+    func->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->tableFunc = createDiskANNTableFunc;
+    func->canParallelFunc = [] { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    HNSWIndexUtils::validateAutoTransaction(*context, CreateDiskANNIndexFunction::name);
+    return createDiskANNBindFunc(context, input);
+}
+
+static std::string rewriteCreateDiskANNQuery(main::ClientContext& context,
+    const TableFuncBindData& bindData) {
+    context.setUseInternalCatalogEntry(true /* useInternalCatalogEntry */);
+    const auto diskANNBindData = bindData.constPtrCast<CreateDiskANNIndexBindData>();
+    if (diskANNBindData->skipAfterBind) {
+        return "";
+    }
+    const auto& config = diskANNBindData->config;
+    const auto tableName = diskANNBindData->tableEntry->getName();
+    const auto columnName =
+        diskANNBindData->tableEntry->getProperty(diskANNBindData->propertyID).getName();
+    std::string query = "BEGIN TRANSACTION;";
+    query += stringFormat("CALL _CREATE_DISKANN_INDEX('{}', '{}', '{}', degree := {}, l := {}, "
+                          "alpha := {}, metric := '{}');",
+        tableName, diskANNBindData->indexName, columnName, config.degree, config.searchListSize,
+        config.alpha, HNSWIndexConfig::metricToString(config.metric));
+    query +=
+        stringFormat("RETURN 'Index {} has been created.' as result;", diskANNBindData->indexName);
+    query += "COMMIT;";
+    return query;
+}
+
+function_set CreateDiskANNIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    std::vector inputTypes = {LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING};
+    auto func = std::make_unique<TableFunction>(name, inputTypes);
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->tableFunc = TableFunction::emptyTableFunc;
+    func->rewriteFunc = rewriteCreateDiskANNQuery;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace vector_extension
+} // namespace ryu
@@ -288,10 +288,15 @@ static void finalizeHNSWTableFinalizeFunc(const ExecutionContext* context,
     auto storageInfo = std::make_unique<HNSWStorageInfo>(upperTableID, lowerTableID,
         index->getUpperEntryPoint(), index->getLowerEntryPoint(), bindData->numRows);
     auto onDiskIndex = std::make_unique<OnDiskHNSWIndex>(context->clientContext, indexInfo,
-        std::move(storageInfo), bindData->config.copy());
+        std::move(storageInfo), bindData->config.copy(), index->moveQuantizedStore());
     auto storageManager = storage::StorageManager::Get(*clientContext);
     auto nodeTable = storageManager->getTable(nodeTableID)->ptrCast<storage::NodeTable>();
     nodeTable->addIndex(std::move(onDiskIndex));
+    if (bindData->config.quantization != QuantizationType::NONE) {
+        // Indexes are only checkpointed with tables that have changes. Make sure the quantized
+        // codes are persisted by the forced checkpoint below.
+        nodeTable->setHasChanges();
+    }
     index->moveToPartitionState(*hnswSharedState->partitionerSharedState);
     transaction->setForceCheckpoint();
 }
@@ -352,6 +357,8 @@ static std::string rewriteCreateHNSWQuery(main::ClientContext& context,
     params += stringFormat("metric := '{}', ", HNSWIndexConfig::metricToString(config.metric));
     params += stringFormat("alpha := {}, ", config.alpha);
     params += stringFormat("pu := {}, ", config.pu);
+    params += stringFormat("quantization := '{}', ",
+        HNSWIndexConfig::quantizationToString(config.quantization));
     params +=
         stringFormat("cache_embeddings := {}", config.cacheEmbeddingsColumn ? "true" : "false");
     auto columnName = hnswBindData->tableEntry->getProperty(hnswBindData->propertyID).getName();
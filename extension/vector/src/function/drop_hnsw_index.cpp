@@ -1,5 +1,6 @@
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "function/hnsw_index_functions.h"
 #include "function/table/bind_data.h"
@@ -7,6 +8,7 @@
 #include "main/client_context.h"
 #include "processor/execution_context.h"
 #include "storage/storage_manager.h"
+#include "transaction/transaction.h"
 #include "transaction/transaction_context.h"
 
 using namespace ryu::function;
@@ -17,15 +19,18 @@ namespace vector_extension {
 struct DropHNSWIndexBindData final : TableFuncBindData {
     catalog::NodeTableCatalogEntry* tableEntry;
     std::string indexName;
+    // DiskANN indexes keep their graph in the data file rather than in rel tables.
+    bool hasGraphTables;
     bool skipAfterBind;
 
     DropHNSWIndexBindData(catalog::NodeTableCatalogEntry* tableEntry, std::string indexName,
-        bool skipAfterBind = false)
+        bool hasGraphTables, bool skipAfterBind = false)
         : TableFuncBindData{0}, tableEntry{tableEntry}, indexName{std::move(indexName)},
-          skipAfterBind{skipAfterBind} {}
+          hasGraphTables{hasGraphTables}, skipAfterBind{skipAfterBind} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<DropHNSWIndexBindData>(tableEntry, indexName, skipAfterBind);
+        return std::make_unique<DropHNSWIndexBindData>(tableEntry, indexName, hasGraphTables,
+            skipAfterBind);
     }
 };
 
@@ -37,9 +42,12 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     const auto nodeTableEntry = HNSWIndexUtils::bindNodeTable(*context, tableName);
     if (!HNSWIndexUtils::validateIndexExistence(*context, nodeTableEntry, indexName,
             HNSWIndexUtils::IndexOperation::DROP, config.conflictAction)) {
-        return std::make_unique<DropHNSWIndexBindData>(nullptr, indexName, true);
+        return std::make_unique<DropHNSWIndexBindData>(nullptr, indexName, false, true);
     }
-    return std::make_unique<DropHNSWIndexBindData>(nodeTableEntry, indexName);
+    const auto indexEntry = catalog::Catalog::Get(*context)->getIndex(
+        transaction::Transaction::Get(*context), nodeTableEntry->getTableID(), indexName);
+    const auto hasGraphTables = indexEntry->getIndexType() != DiskANNIndexCatalogEntry::TYPE_NAME;
+    return std::make_unique<DropHNSWIndexBindData>(nodeTableEntry, indexName, hasGraphTables);
 }
 
 static common::offset_t internalTableFunc(const TableFuncInput& input, TableFuncOutput&) {
@@ -69,10 +77,12 @@ static std::string dropHNSWIndexTables(main::ClientContext& context,
     auto nodeTableID = dropHNSWIndexBindData->tableEntry->getTableID();
     query += common::stringFormat("CALL _DROP_HNSW_INDEX('{}', '{}');",
         dropHNSWIndexBindData->tableEntry->getName(), dropHNSWIndexBindData->indexName);
-    query += common::stringFormat("DROP TABLE {};",
-        HNSWIndexUtils::getUpperGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
-    query += common::stringFormat("DROP TABLE {};",
-        HNSWIndexUtils::getLowerGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
+    if (dropHNSWIndexBindData->hasGraphTables) {
+        query += common::stringFormat("DROP TABLE {};",
+            HNSWIndexUtils::getUpperGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
+        query += common::stringFormat("DROP TABLE {};",
+            HNSWIndexUtils::getLowerGraphTableName(nodeTableID, dropHNSWIndexBindData->indexName));
+    }
     if (requireNewTransaction) {
         query += "COMMIT;";
     }
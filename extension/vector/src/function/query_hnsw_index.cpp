@@ -3,6 +3,7 @@
 #include "binder/expression/literal_expression.h"
 #include "binder/query/reading_clause/bound_table_function_call.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
 #include "catalog/hnsw_index_catalog_entry.h"
 #include "common/exception/binder.h"
 #include "common/mask.h"
@@ -69,8 +70,8 @@ std::unique_ptr<TableFuncBindData> QueryHNSWIndexBindData::copy() const {
     return bindData;
 }
 
-static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
-    const TableFuncBindInput* input) {
+static std::unique_ptr<QueryHNSWIndexBindData> bindQueryVectorIndex(main::ClientContext* context,
+    const TableFuncBindInput* input, std::vector<std::string> columnNames) {
     auto catalog = Catalog::Get(*context);
     auto transaction = transaction::Transaction::Get(*context);
     context->setUseInternalCatalogEntry(true /* useInternalCatalogEntry */);
@@ -137,14 +138,15 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     (void)HNSWIndexUtils::validateIndexExistence(*context, nodeTableEntry, indexName,
         HNSWIndexUtils::IndexOperation::QUERY);
     // Bind columns
-    auto columnNames = std::vector<std::string>{QueryVectorIndexFunction::nnColumnName,
-        QueryVectorIndexFunction::distanceColumnName};
     columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
     auto outputNode = input->binder->createQueryNode(columnNames[0], {nodeTableEntry});
     input->binder->addToScope(outputNode->toString(), outputNode);
     expression_vector columns;
     columns.push_back(outputNode->getInternalID());
     columns.push_back(input->binder->createVariable(columnNames[1], LogicalType::DOUBLE()));
+    if (columnNames.size() > 2) {
+        columns.push_back(input->binder->createVariable(columnNames[2], LogicalType::INT64()));
+    }
     // Fill bind data
     auto bindData = std::make_unique<QueryHNSWIndexBindData>(columns);
     bindData->nodeTableEntry = nodeTableEntry;
@@ -164,6 +166,12 @@ static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
     return bindData;
 }
 
+static std::unique_ptr<TableFuncBindData> bindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindQueryVectorIndex(context, input,
+        {QueryVectorIndexFunction::nnColumnName, QueryVectorIndexFunction::distanceColumnName});
+}
+
 template<VectorElementType T>
 static std::vector<T> convertQueryVector(const Value& value) {
     std::vector<T> queryVector;
@@ -209,6 +217,7 @@ struct HNSWQueryVector : GetEmbeddingsScanState {
     HNSWQueryVector(main::ClientContext* context, std::shared_ptr<Expression> queryExpression,
         const LogicalType& indexType, uint64_t dimension)
         : data(getQueryVector<T>(context, std::move(queryExpression), indexType, dimension)) {}
+    explicit HNSWQueryVector(std::vector<T> data) : data(std::move(data)) {}
 
     void* getEmbeddingPtr([[maybe_unused]] const EmbeddingHandle& handle) override {
         KU_ASSERT(!handle.isNull());
@@ -222,30 +231,69 @@ struct HNSWQueryVector : GetEmbeddingsScanState {
     std::vector<T> data;
 };
 
+template<typename T>
+static std::vector<NodeWithDistance> searchIndex(main::ClientContext* context,
+    storage::Index& index, HNSWQueryVector<T>& queryVector,
+    QueryHNSWLocalState& localState) {
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto queryVectorHandle = EmbeddingHandle{0, &queryVector};
+    if (localState.diskANNSearchState) {
+        return index.cast<DiskANNIndex>().search(transaction, queryVectorHandle,
+            *localState.diskANNSearchState);
+    }
+    return index.cast<OnDiskHNSWIndex>().search(transaction, queryVectorHandle,
+        *localState.searchState);
+}
+
+static storage::Index& getIndex(main::ClientContext* context,
+    const QueryHNSWIndexBindData& bindData) {
+    const auto nodeTable = storage::StorageManager::Get(*context)
+                               ->getTable(bindData.nodeTableEntry->getTableID())
+                               ->ptrCast<storage::NodeTable>();
+    auto indexOpt = nodeTable->getIndex(bindData.indexEntry->getIndexName());
+    KU_ASSERT(indexOpt.has_value());
+    return *indexOpt.value();
+}
+
+// Writes the pending result rows of the local state to the output, starting at `outputPos`.
+// Returns the number of rows written.
+static offset_t writeResult(const QueryHNSWIndexBindData& bindData,
+    QueryHNSWLocalState& localState, TableFuncOutput& output, offset_t outputPos) {
+    const auto numToOutput = std::min(localState.result->size() - localState.numRowsOutput,
+        DEFAULT_VECTOR_CAPACITY - outputPos);
+    const auto tableID = bindData.nodeTableEntry->getTableID();
+    for (auto i = 0u; i < numToOutput; i++) {
+        const auto& [nodeOffset, distance] =
+            localState.result.value()[i + localState.numRowsOutput];
+        output.dataChunk.getValueVectorMutable(0).setValue<internalID_t>(outputPos + i,
+            internalID_t{nodeOffset, tableID});
+        output.dataChunk.getValueVectorMutable(1).setValue<double>(outputPos + i, distance);
+        if (output.dataChunk.getNumValueVectors() > 2) {
+            output.dataChunk.getValueVectorMutable(2).setValue<int64_t>(outputPos + i,
+                localState.queryIdx);
+        }
+    }
+    localState.numRowsOutput += numToOutput;
+    return numToOutput;
+}
+
 static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
     const auto localState = input.localState->ptrCast<QueryHNSWLocalState>();
     const auto bindData = input.bindData->constPtrCast<QueryHNSWIndexBindData>();
+    const auto context = input.context->clientContext;
     // As `k` can be larger than the default vector capacity, we run the actual search in the first
     // call, and output the rest of the query result in chunks in the following calls.
     if (!localState->hasResultToOutput()) {
-        const auto nodeTable = storage::StorageManager::Get(*input.context->clientContext)
-                                   ->getTable(bindData->nodeTableEntry->getTableID())
-                                   ->ptrCast<storage::NodeTable>();
-        auto indexOpt = nodeTable->getIndex(bindData->indexEntry->getIndexName());
-        KU_ASSERT(indexOpt.has_value());
-        auto& index = indexOpt.value()->cast<OnDiskHNSWIndex>();
-        const auto dimension = ArrayType::getNumElements(
-            getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry));
-        auto indexType = index.getElementType();
+        auto& index = getIndex(context, *bindData);
+        const auto& columnType =
+            getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry);
+        const auto& elementType = ArrayType::getChildType(columnType);
         TypeUtils::visit(
-            indexType,
+            elementType,
             [&]<VectorElementType T>(T) {
-                auto queryVector = HNSWQueryVector<T>(input.context->clientContext,
-                    bindData->queryExpression, index.getElementType(), dimension);
-                auto queryVectorHandle = EmbeddingHandle{0, &queryVector};
-                localState->result =
-                    index.search(transaction::Transaction::Get(*input.context->clientContext),
-                        queryVectorHandle, localState->searchState);
+                auto queryVector = HNSWQueryVector<T>(context, bindData->queryExpression,
+                    elementType, ArrayType::getNumElements(columnType));
+                localState->result = searchIndex(context, index, queryVector, *localState);
             },
             [&](auto) { KU_UNREACHABLE; });
     }
@@ -253,16 +301,7 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output)
     if (localState->numRowsOutput >= localState->result->size()) {
         return 0;
     }
-    const auto numToOutput =
-        std::min(localState->result->size() - localState->numRowsOutput, DEFAULT_VECTOR_CAPACITY);
-    for (auto i = 0u; i < numToOutput; i++) {
-        const auto& [nodeOffset, distance] =
-            localState->result.value()[i + localState->numRowsOutput];
-        output.dataChunk.getValueVectorMutable(0).setValue<internalID_t>(i,
-            internalID_t{nodeOffset, bindData->nodeTableEntry->getTableID()});
-        output.dataChunk.getValueVectorMutable(1).setValue<double>(i, distance);
-    }
-    localState->numRowsOutput += numToOutput;
+    const auto numToOutput = writeResult(*bindData, *localState, output, 0 /* outputPos */);
     output.dataChunk.state->getSelVectorUnsafe().setToUnfiltered(numToOutput);
     return numToOutput;
 }
@@ -278,18 +317,29 @@ static std::unique_ptr<TableFuncSharedState> initQueryHNSWSharedState(
     return std::make_unique<QueryHNSWIndexSharedState>(nodeTable, numNodes);
 }
 
-std::unique_ptr<TableFuncLocalState> initQueryHNSWLocalState(
-    const TableFuncInitLocalStateInput& input) {
-    const auto hnswBindData = input.bindData.constPtrCast<QueryHNSWIndexBindData>();
-    const auto hnswSharedState = input.sharedState.ptrCast<QueryHNSWIndexSharedState>();
-    auto context = input.clientContext;
-    auto val = evaluateParamExpr(hnswBindData->kExpression, context, LogicalType::INT64());
-    auto k = ExpressionUtil::getExpressionVal<int64_t>(*hnswBindData->kExpression, val,
+static std::unique_ptr<QueryHNSWLocalState> initSearchState(main::ClientContext* context,
+    const QueryHNSWIndexBindData& bindData, TableFuncSharedState& sharedState,
+    storage::NodeTable& nodeTable, offset_t numNodes) {
+    auto val = evaluateParamExpr(bindData.kExpression, context, LogicalType::INT64());
+    auto k = ExpressionUtil::getExpressionVal<int64_t>(*bindData.kExpression, val,
         LogicalType::INT64(), validateK);
-    auto upperRelTableName = HNSWIndexUtils::getUpperGraphTableName(
-        hnswBindData->nodeTableEntry->getTableID(), hnswBindData->indexEntry->getIndexName());
-    auto lowerRelTableName = HNSWIndexUtils::getLowerGraphTableName(
-        hnswBindData->nodeTableEntry->getTableID(), hnswBindData->indexEntry->getIndexName());
+    const auto tableID = bindData.nodeTableEntry->getTableID();
+    auto& semiMasks = sharedState.semiMasks;
+    common::SemiMask* semiMask = nullptr;
+    if (semiMasks.containsTableID(tableID)) {
+        semiMasks.pin(tableID);
+        semiMask = semiMasks.getPinnedMask();
+    }
+    if (bindData.indexEntry->getIndexType() == DiskANNIndexCatalogEntry::TYPE_NAME) {
+        auto searchState = std::make_unique<DiskANNSearchState>(context, nodeTable,
+            bindData.indexColumnID, static_cast<uint64_t>(k), bindData.config);
+        searchState->semiMask = semiMask;
+        return std::make_unique<QueryHNSWLocalState>(std::move(searchState));
+    }
+    auto upperRelTableName =
+        HNSWIndexUtils::getUpperGraphTableName(tableID, bindData.indexEntry->getIndexName());
+    auto lowerRelTableName =
+        HNSWIndexUtils::getLowerGraphTableName(tableID, bindData.indexEntry->getIndexName());
     auto catalog = Catalog::Get(*context);
     auto upperRelTableEntry =
         catalog
@@ -299,18 +349,21 @@ std::unique_ptr<TableFuncLocalState> initQueryHNSWLocalState(
         catalog
             ->getTableCatalogEntry(transaction::Transaction::Get(*context), lowerRelTableName, true)
             ->ptrCast<RelGroupCatalogEntry>();
-    HNSWSearchState searchState{context, hnswBindData->nodeTableEntry, upperRelTableEntry,
-        lowerRelTableEntry, *hnswSharedState->nodeTable, hnswBindData->indexColumnID,
-        hnswSharedState->numNodes, static_cast<uint64_t>(k), hnswBindData->config};
-    const auto tableID = hnswBindData->nodeTableEntry->getTableID();
-    auto& semiMasks = hnswSharedState->semiMasks;
-    if (semiMasks.containsTableID(tableID)) {
-        semiMasks.pin(tableID);
-        searchState.semiMask = semiMasks.getPinnedMask();
-    }
+    auto searchState = std::make_unique<HNSWSearchState>(context, bindData.nodeTableEntry,
+        upperRelTableEntry, lowerRelTableEntry, nodeTable, bindData.indexColumnID, numNodes,
+        static_cast<uint64_t>(k), bindData.config);
+    searchState->semiMask = semiMask;
     return std::make_unique<QueryHNSWLocalState>(std::move(searchState));
 }
 
+std::unique_ptr<TableFuncLocalState> initQueryHNSWLocalState(
+    const TableFuncInitLocalStateInput& input) {
+    const auto hnswBindData = input.bindData.constPtrCast<QueryHNSWIndexBindData>();
+    const auto hnswSharedState = input.sharedState.ptrCast<QueryHNSWIndexSharedState>();
+    return initSearchState(input.clientContext, *hnswBindData, *hnswSharedState,
+        *hnswSharedState->nodeTable, hnswSharedState->numNodes);
+}
+
 static void getLogicalPlan(Planner* planner, const BoundReadingClause& readingClause,
     const expression_vector& predicates, LogicalPlan& plan) {
     auto& call = readingClause.constCast<BoundTableFunctionCall>();
@@ -375,6 +428,102 @@ static std::unique_ptr<PhysicalOperator> getPhysicalPlan(PlanMapper* planMapper,
     return op;
 }
 
+static std::vector<LogicalType> inferBatchInputTypes(const expression_vector& params) {
+    const auto inputQueriesExpression = params[2];
+    std::vector<LogicalType> inputTypes;
+    inputTypes.push_back(LogicalType::STRING());
+    inputTypes.push_back(LogicalType::STRING());
+    if (inputQueriesExpression->expressionType == ExpressionType::LITERAL) {
+        const auto val = inputQueriesExpression->constCast<LiteralExpression>().getValue();
+        if (val.getChildrenSize() > 0) {
+            const auto dimension = NestedVal::getChildVal(&val, 0)->getChildrenSize();
+            inputTypes.push_back(
+                LogicalType::LIST(LogicalType::ARRAY(LogicalType::FLOAT(), dimension)));
+        } else {
+            inputTypes.push_back(LogicalType::ANY());
+        }
+    } else {
+        inputTypes.push_back(LogicalType::ANY());
+    }
+    inputTypes.push_back(LogicalType::INT64());
+    return inputTypes;
+}
+
+static std::unique_ptr<TableFuncBindData> batchBindFunc(main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    return bindQueryVectorIndex(context, input,
+        {QueryVectorIndexFunction::nnColumnName, QueryVectorIndexFunction::distanceColumnName,
+            QueryVectorIndexBatchFunction::queryIdxColumnName});
+}
+
+static std::unique_ptr<TableFuncSharedState> initBatchSharedState(
+    const TableFuncInitSharedStateInput& input) {
+    const auto bindData = input.bindData->constPtrCast<QueryHNSWIndexBindData>();
+    auto context = input.context->clientContext;
+    auto nodeTable = storage::StorageManager::Get(*context)
+                         ->getTable(bindData->nodeTableEntry->getTableID())
+                         ->ptrCast<storage::NodeTable>();
+    auto numNodes = nodeTable->getStats(transaction::Transaction::Get(*context)).getTableCard();
+    // Query vectors are evaluated once here, instead of once per worker.
+    const auto& columnType = getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry);
+    auto queries = evaluateParamExpr(bindData->queryExpression, context,
+        LogicalType::LIST(columnType.copy()));
+    if (queries.isNull()) {
+        queries = Value::createDefaultValue(LogicalType::LIST(columnType.copy()));
+    }
+    return std::make_unique<QueryVectorIndexBatchSharedState>(nodeTable, numNodes,
+        std::move(queries));
+}
+
+static std::unique_ptr<TableFuncLocalState> initBatchLocalState(
+    const TableFuncInitLocalStateInput& input) {
+    const auto bindData = input.bindData.constPtrCast<QueryHNSWIndexBindData>();
+    const auto sharedState = input.sharedState.ptrCast<QueryVectorIndexBatchSharedState>();
+    // Each worker owns its search state, so the visited buffers and embedding scan states are
+    // reused across all the queries the worker runs.
+    return initSearchState(input.clientContext, *bindData, *sharedState,
+        *sharedState->nodeTable, sharedState->numNodes);
+}
+
+static offset_t batchTableFunc(const TableFuncInput& input, TableFuncOutput& output) {
+    const auto localState = input.localState->ptrCast<QueryHNSWLocalState>();
+    const auto sharedState = input.sharedState->ptrCast<QueryVectorIndexBatchSharedState>();
+    const auto bindData = input.bindData->constPtrCast<QueryHNSWIndexBindData>();
+    const auto context = input.context->clientContext;
+    auto& index = getIndex(context, *bindData);
+    const auto& elementType = ArrayType::getChildType(
+        getIndexColumnType(*bindData->nodeTableEntry, *bindData->indexEntry));
+    // Results of consecutive queries are packed into the same output chunk.
+    offset_t numOutput = 0;
+    while (numOutput < DEFAULT_VECTOR_CAPACITY) {
+        if (localState->hasResultToOutput() &&
+            localState->numRowsOutput < localState->result->size()) {
+            numOutput += writeResult(*bindData, *localState, output, numOutput);
+            continue;
+        }
+        const auto queryIdx = sharedState->getNextQueryIdx();
+        if (queryIdx == INVALID_ROW_IDX) {
+            break;
+        }
+        localState->queryIdx = queryIdx;
+        localState->numRowsOutput = 0;
+        const auto query = NestedVal::getChildVal(&sharedState->queries, queryIdx);
+        if (query->isNull()) {
+            localState->result = std::vector<NodeWithDistance>{};
+            continue;
+        }
+        TypeUtils::visit(
+            elementType,
+            [&]<VectorElementType T>(T) {
+                auto queryVector = HNSWQueryVector<T>(convertQueryVector<T>(*query));
+                localState->result = searchIndex(context, index, queryVector, *localState);
+            },
+            [&](auto) { KU_UNREACHABLE; });
+    }
+    output.dataChunk.state->getSelVectorUnsafe().setToUnfiltered(numOutput);
+    return numOutput;
+}
+
 function_set QueryVectorIndexFunction::getFunctionSet() {
     function_set functionSet;
     std::vector inputTypes{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::ARRAY,
@@ -392,5 +541,22 @@ function_set QueryVectorIndexFunction::getFunctionSet() {
     return functionSet;
 }
 
+function_set QueryVectorIndexBatchFunction::getFunctionSet() {
+    function_set functionSet;
+    std::vector inputTypes{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::LIST,
+        LogicalTypeID::INT64};
+    auto tableFunction = std::make_unique<TableFunction>(name, inputTypes);
+    tableFunction->tableFunc = batchTableFunc;
+    tableFunction->bindFunc = batchBindFunc;
+    tableFunction->initSharedStateFunc = initBatchSharedState;
+    tableFunction->initLocalStateFunc = initBatchLocalState;
+    tableFunction->canParallelFunc = [] { return true; };
+    tableFunction->getLogicalPlanFunc = getLogicalPlan;
+    tableFunction->getPhysicalPlanFunc = getPhysicalPlan;
+    tableFunction->inferInputTypes = inferBatchInputTypes;
+    functionSet.push_back(std::move(tableFunction));
+    return functionSet;
+}
+
 } // namespace vector_extension
 } // namespace ryu
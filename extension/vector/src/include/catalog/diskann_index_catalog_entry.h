@@ -0,0 +1,38 @@
+#pragma once
+
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "index/diskann_config.h"
+
+namespace ryu::common {
+struct BufferReader;
+} // namespace ryu::common
+
+namespace ryu {
+namespace vector_extension {
+
+struct DiskANNIndexAuxInfo final : catalog::IndexAuxInfo {
+
+    DiskANNIndexConfig config;
+
+    explicit DiskANNIndexAuxInfo(DiskANNIndexConfig config) : config{std::move(config)} {}
+
+    DiskANNIndexAuxInfo(const DiskANNIndexAuxInfo& other) : config{other.config.copy()} {}
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+    static std::unique_ptr<DiskANNIndexAuxInfo> deserialize(
+        std::unique_ptr<common::BufferReader> reader);
+
+    std::unique_ptr<IndexAuxInfo> copy() override {
+        return std::make_unique<DiskANNIndexAuxInfo>(*this);
+    }
+
+    std::string toCypher(const catalog::IndexCatalogEntry& indexEntry,
+        const catalog::ToCypherInfo& info) const override;
+};
+
+struct DiskANNIndexCatalogEntry {
+    static constexpr char TYPE_NAME[] = "DISKANN";
+};
+
+} // namespace vector_extension
+} // namespace ryu
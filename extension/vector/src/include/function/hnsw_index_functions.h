@@ -5,6 +5,7 @@
 #include "function/table/bind_data.h"
 #include "function/table/simple_table_function.h"
 #include "function/table/table_function.h"
+#include "index/diskann_index.h"
 #include "index/hnsw_index.h"
 #include "index/hnsw_rel_batch_insert.h"
 
@@ -68,6 +69,24 @@ struct FinalizeHNSWSharedState final : function::SimpleTableFuncSharedState {
     }
 };
 
+struct CreateDiskANNIndexBindData final : function::TableFuncBindData {
+    std::string indexName;
+    catalog::TableCatalogEntry* tableEntry;
+    common::property_id_t propertyID;
+    DiskANNIndexConfig config;
+    bool skipAfterBind;
+
+    CreateDiskANNIndexBindData(std::string indexName, catalog::TableCatalogEntry* tableEntry,
+        common::property_id_t propertyID, DiskANNIndexConfig config, bool skipAfterBind = false)
+        : TableFuncBindData{0}, indexName{std::move(indexName)}, tableEntry{tableEntry},
+          propertyID{propertyID}, config{std::move(config)}, skipAfterBind{skipAfterBind} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<CreateDiskANNIndexBindData>(indexName, tableEntry, propertyID,
+            config.copy(), skipAfterBind);
+    }
+};
+
 struct QueryHNSWIndexBindData final : function::TableFuncBindData {
     catalog::NodeTableCatalogEntry* nodeTableEntry = nullptr;
     catalog::IndexCatalogEntry* indexEntry = nullptr;
@@ -93,13 +112,41 @@ struct QueryHNSWIndexSharedState final : function::TableFuncSharedState {
         : TableFuncSharedState{1 /* maxOffset */}, nodeTable{nodeTable}, numNodes{numNodes} {}
 };
 
+// Query vectors of QUERY_VECTOR_INDEX_BATCH. They are evaluated once, and handed out to workers one
+// at a time.
+struct QueryVectorIndexBatchSharedState final : function::TableFuncSharedState {
+    storage::NodeTable* nodeTable;
+    common::offset_t numNodes;
+    common::Value queries;
+    uint64_t numQueries;
+    std::atomic<uint64_t> nextQueryIdx;
+
+    QueryVectorIndexBatchSharedState(storage::NodeTable* nodeTable, common::offset_t numNodes,
+        common::Value queries)
+        : TableFuncSharedState{1 /* maxOffset */}, nodeTable{nodeTable}, numNodes{numNodes},
+          queries{std::move(queries)}, numQueries{this->queries.getChildrenSize()},
+          nextQueryIdx{0} {}
+
+    // Returns INVALID_ROW_IDX once all queries are taken.
+    common::row_idx_t getNextQueryIdx() {
+        const auto queryIdx = nextQueryIdx.fetch_add(1);
+        return queryIdx < numQueries ? queryIdx : common::INVALID_ROW_IDX;
+    }
+};
+
 struct QueryHNSWLocalState final : function::TableFuncLocalState {
     std::optional<std::vector<NodeWithDistance>> result;
-    HNSWSearchState searchState;
+    // Only the state of the queried index type is set.
+    std::unique_ptr<HNSWSearchState> searchState;
+    std::unique_ptr<DiskANNSearchState> diskANNSearchState;
     uint64_t numRowsOutput;
+    // Position of the query vector in the batch of QUERY_VECTOR_INDEX_BATCH.
+    uint64_t queryIdx = 0;
 
-    explicit QueryHNSWLocalState(HNSWSearchState searchState)
+    explicit QueryHNSWLocalState(std::unique_ptr<HNSWSearchState> searchState)
         : searchState{std::move(searchState)}, numRowsOutput{0} {}
+    explicit QueryHNSWLocalState(std::unique_ptr<DiskANNSearchState> diskANNSearchState)
+        : diskANNSearchState{std::move(diskANNSearchState)}, numRowsOutput{0} {}
 
     bool hasResultToOutput() const { return result.has_value(); }
 };
@@ -128,6 +175,26 @@ struct CreateVectorIndexFunction final {
     static function::function_set getFunctionSet();
 };
 
+struct QueryVectorIndexBatchFunction final {
+    static constexpr const char* name = "QUERY_VECTOR_INDEX_BATCH";
+
+    static constexpr const char* queryIdxColumnName = "query_idx";
+
+    static function::function_set getFunctionSet();
+};
+
+struct InternalCreateDiskANNIndexFunction final {
+    static constexpr const char* name = "_CREATE_DISKANN_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
+struct CreateDiskANNIndexFunction final {
+    static constexpr const char* name = "CREATE_DISKANN_INDEX";
+
+    static function::function_set getFunctionSet();
+};
+
 struct DropVectorIndexFunction final {
     static constexpr const char* name = "DROP_VECTOR_INDEX";
 
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "index/hnsw_config.h"
+
+namespace ryu {
+namespace vector_extension {
+
+// Max degree of the DiskANN graph.
+struct Degree {
+    static constexpr const char* NAME = "degree";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 64;
+
+    static void validate(int64_t value);
+};
+
+// Size of the candidate list when searching for the neighbors of a node during construction.
+struct SearchListSize {
+    static constexpr const char* NAME = "l";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 100;
+
+    static void validate(int64_t value);
+};
+
+struct DiskANNIndexConfig {
+    // DiskANN prunes less aggressively than our HNSW by default, which keeps the graph navigable
+    // with fewer hops, and thus fewer page reads.
+    static constexpr double DEFAULT_ALPHA = 1.2;
+
+    int64_t degree = Degree::DEFAULT_VALUE;
+    int64_t searchListSize = SearchListSize::DEFAULT_VALUE;
+    double alpha = DEFAULT_ALPHA;
+    MetricType metric = Metric::DEFAULT_VALUE;
+    common::ConflictAction conflictAction = SkipIfExists::DEFAULT_VALUE;
+
+    DiskANNIndexConfig() = default;
+
+    explicit DiskANNIndexConfig(const function::optional_params_t& optionalParams);
+
+    EXPLICIT_COPY_DEFAULT_MOVE(DiskANNIndexConfig);
+
+    void serialize(common::Serializer& ser) const;
+
+    static DiskANNIndexConfig deserialize(common::Deserializer& deSer);
+
+private:
+    DiskANNIndexConfig(const DiskANNIndexConfig& other)
+        : degree{other.degree}, searchListSize{other.searchListSize}, alpha{other.alpha},
+          metric{other.metric}, conflictAction{other.conflictAction} {}
+};
+
+} // namespace vector_extension
+} // namespace ryu
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "common/serializer/in_mem_file_writer.h"
+#include "index/diskann_config.h"
+#include "index/hnsw_index.h"
+
+namespace ryu {
+namespace storage {
+class FileHandle;
+} // namespace storage
+
+namespace vector_extension {
+
+// Each node of a DiskANN graph owns a fixed-size block laid out as
+// [number of neighbors (uint32_t)][padding (uint32_t)][degree x neighbor offset][int8 code].
+// Blocks are packed by node offset and never straddle pages, so the neighbors and the code of a
+// node are read together with a single page read.
+struct DiskANNBlockLayout {
+    static constexpr uint64_t NEIGHBORS_OFFSET = 2 * sizeof(uint32_t);
+
+    common::length_t degree;
+    uint64_t codeOffset;
+    uint64_t blockSize;
+    uint64_t numBlocksPerPage;
+
+    DiskANNBlockLayout(common::length_t degree, common::length_t dimension);
+
+    // Block sizes are rounded up to 8 bytes to keep neighbor offsets aligned.
+    static uint64_t getBlockSize(common::length_t degree, common::length_t dimension);
+
+    common::page_idx_t getPageIdx(common::offset_t offset) const {
+        return offset / numBlocksPerPage;
+    }
+    uint64_t getPosInPage(common::offset_t offset) const {
+        return (offset % numBlocksPerPage) * blockSize;
+    }
+    common::page_idx_t getNumPages(common::offset_t numNodes) const {
+        return (numNodes + numBlocksPerPage - 1) / numBlocksPerPage;
+    }
+
+    static std::span<const common::offset_t> getNeighbors(const uint8_t* block) {
+        uint32_t numNeighbors = 0;
+        memcpy(&numNeighbors, block, sizeof(uint32_t));
+        return {reinterpret_cast<const common::offset_t*>(block + NEIGHBORS_OFFSET), numNeighbors};
+    }
+    const uint8_t* getCode(const uint8_t* block) const { return block + codeOffset; }
+};
+
+struct DiskANNStorageInfo final : storage::IndexStorageInfo {
+    common::offset_t entryPoint;
+    // Nodes with larger offsets were inserted after the graph was built, and are searched
+    // exhaustively.
+    common::offset_t numIndexedNodes;
+    // Pages of the blocks. Invalid until the index is checkpointed.
+    storage::PageRange blocksPageRange;
+
+    DiskANNStorageInfo() : entryPoint{common::INVALID_OFFSET}, numIndexedNodes{0} {}
+    DiskANNStorageInfo(common::offset_t entryPoint, common::offset_t numIndexedNodes,
+        storage::PageRange blocksPageRange)
+        : entryPoint{entryPoint}, numIndexedNodes{numIndexedNodes},
+          blocksPageRange{blocksPageRange} {}
+
+    std::shared_ptr<common::BufferWriter> serialize() const override;
+
+    static std::unique_ptr<storage::IndexStorageInfo> deserialize(
+        std::unique_ptr<common::BufferReader> reader);
+};
+
+struct DiskANNSearchState {
+    std::unique_ptr<HNSWIndexEmbeddings> embeddings;
+    OnDiskEmbeddingScanState embeddingScanState;
+    uint64_t k;
+    // Number of candidates kept during the search. They are all re-ranked with exact embeddings.
+    uint64_t searchListSize;
+    uint64_t beamWidth;
+    common::SemiMask* semiMask;
+
+    DiskANNSearchState(main::ClientContext* context, storage::NodeTable& nodeTable,
+        common::column_id_t columnID, uint64_t k, const QueryHNSWConfig& config);
+
+    bool isMasked(common::offset_t offset) const {
+        return semiMask == nullptr || semiMask->isMasked(offset);
+    }
+};
+
+// A Vamana graph whose blocks live in the data file and are read through the buffer manager, so
+// that only the pages touched by a search need to be in memory.
+// The graph is built once over the nodes in the table. Nodes inserted afterwards are searched
+// exhaustively until the index is recreated.
+class DiskANNIndex final : public storage::Index {
+public:
+    DiskANNIndex(const main::ClientContext* context, storage::IndexInfo indexInfo,
+        std::unique_ptr<storage::IndexStorageInfo> storageInfo, DiskANNIndexConfig config);
+
+    // Throws if a block doesn't fit in a page.
+    static void validateBlockSize(common::length_t degree, common::length_t dimension);
+
+    void build(transaction::Transaction* transaction);
+
+    std::vector<NodeWithDistance> search(transaction::Transaction* transaction,
+        const EmbeddingHandle& queryVector, DiskANNSearchState& searchState) const;
+
+    common::LogicalType getElementType() const { return typeInfo.getChildType().copy(); }
+
+    static std::unique_ptr<Index> load(main::ClientContext* context,
+        storage::StorageManager* storageManager, storage::IndexInfo indexInfo,
+        std::span<uint8_t> storageInfoBuffer);
+
+    static storage::IndexType getIndexType() {
+        static const storage::IndexType DISKANN_INDEX_TYPE{"DISKANN",
+            storage::IndexConstraintType::SECONDARY_NON_UNIQUE,
+            storage::IndexDefinitionType::EXTENSION, load};
+        return DISKANN_INDEX_TYPE;
+    }
+
+    std::unique_ptr<InsertState> initInsertState(main::ClientContext*,
+        storage::visible_func) override {
+        return std::make_unique<InsertState>();
+    }
+    std::unique_ptr<UpdateState> initUpdateState(main::ClientContext* /*context*/,
+        common::column_id_t /*columnID*/, storage::visible_func /*isVisible*/) override {
+        throw common::RuntimeException{"Cannot update a property used in a DiskANN index. Try "
+                                       "delete and then insert."};
+    }
+    std::unique_ptr<DeleteState> initDeleteState(const transaction::Transaction* /*transaction*/,
+        storage::MemoryManager* /*mm*/, storage::visible_func /*isVisible*/) override {
+        return std::make_unique<DeleteState>();
+    }
+    void delete_(transaction::Transaction* /*transaction*/,
+        const common::ValueVector& /*nodeIDVector*/, DeleteState& /*deleteState*/) override {
+        // DO NOTHING.
+        // Deleted nodes stay in the graph to route searches, and are filtered out when re-ranking.
+    }
+
+    void checkpoint(main::ClientContext* context, storage::PageAllocator& pageAllocator) override;
+    void rollbackCheckpoint() override;
+
+private:
+    // Calls `func` on the block of each offset. Offsets are grouped by page, so that each page is
+    // read once, and the pages of the batch are prefetched together.
+    void readBlocks(std::vector<common::offset_t>& offsets,
+        const std::function<void(common::offset_t, const uint8_t*)>& func) const;
+    std::vector<NodeWithDistance> beamSearch(const uint8_t* queryCode,
+        const DiskANNSearchState& searchState) const;
+    void rerankWithExactEmbeddings(const EmbeddingHandle& queryVector,
+        DiskANNSearchState& searchState, std::vector<NodeWithDistance>& candidates) const;
+    void searchFromUnIndexed(transaction::Transaction* transaction,
+        const EmbeddingHandle& queryVector, DiskANNSearchState& searchState,
+        std::vector<NodeWithDistance>& result) const;
+
+private:
+    DiskANNIndexConfig config;
+    common::ArrayTypeInfo typeInfo;
+    DiskANNBlockLayout layout;
+    metric_func_t metricFunc;
+    metric_func_t quantizedMetricFunc;
+    storage::MemoryManager* mm;
+    storage::NodeTable& nodeTable;
+    storage::FileHandle* dataFH;
+    // Blocks of a graph built in this session. They are written to the data file at checkpoint,
+    // and read from there once the database is reloaded.
+    std::unique_ptr<common::InMemFileWriter> inMemBlocks;
+    bool hasUnflushedBlocks;
+    std::optional<storage::PageRange> blocksPageRangeBeforeCheckpoint;
+};
+
+} // namespace vector_extension
+} // namespace ryu
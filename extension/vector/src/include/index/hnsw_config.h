@@ -11,6 +11,8 @@ namespace vector_extension {
 
 enum class MetricType : uint8_t { Cosine = 0, L2 = 1, L2_SQUARE = 2, DotProduct = 3 };
 
+enum class QuantizationType : uint8_t { NONE = 0, INT8 = 1 };
+
 // We use this ratio to calculate the max degree of the upper/lower graph based on the user provided
 // max degree value for the upper/lower graph, respectively.
 static constexpr double DEFAULT_DEGREE_THRESHOLD_RATIO = 1.25;
@@ -50,6 +52,16 @@ struct Metric {
     static void validate(const std::string& metric);
 };
 
+// Quantization of the embeddings used to traverse the graph. Results are re-ranked with the exact
+// embeddings.
+struct Quantization {
+    static constexpr const char* NAME = "quantization";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::STRING;
+    static constexpr QuantizationType DEFAULT_VALUE = QuantizationType::NONE;
+
+    static void validate(const std::string& quantization);
+};
+
 struct Alpha {
     static constexpr const char* NAME = "alpha";
     static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
@@ -102,6 +114,15 @@ struct BlindSearchUpSelThreshold {
     static void validate(double value);
 };
 
+// Number of candidates whose neighbors are read together in one step of a DiskANN search.
+struct BeamWidth {
+    static constexpr const char* NAME = "beam_width";
+    static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::INT64;
+    static constexpr int64_t DEFAULT_VALUE = 4;
+
+    static void validate(int64_t value);
+};
+
 struct DirectedSearchUpSelThreshold {
     static constexpr const char* NAME = "directed_search_up_sel";
     static constexpr common::LogicalTypeID TYPE = common::LogicalTypeID::DOUBLE;
@@ -118,6 +139,7 @@ struct HNSWIndexConfig {
     double alpha = Alpha::DEFAULT_VALUE;
     int64_t efc = Efc::DEFAULT_VALUE;
     bool cacheEmbeddingsColumn = CacheEmbeddings::DEFAULT_VALUE;
+    QuantizationType quantization = Quantization::DEFAULT_VALUE;
     common::ConflictAction conflictAction = SkipIfExists::DEFAULT_VALUE;
 
     HNSWIndexConfig() = default;
@@ -131,14 +153,16 @@ struct HNSWIndexConfig {
     static HNSWIndexConfig deserialize(common::Deserializer& deSer);
 
     static std::string metricToString(MetricType metric);
+    static std::string quantizationToString(QuantizationType quantization);
+    static MetricType getMetricType(const std::string& metricName);
 
 private:
     HNSWIndexConfig(const HNSWIndexConfig& other)
         : mu{other.mu}, ml{other.ml}, pu{other.pu}, metric{other.metric}, alpha{other.alpha},
           efc{other.efc}, cacheEmbeddingsColumn(other.cacheEmbeddingsColumn),
-          conflictAction(other.conflictAction) {}
+          quantization(other.quantization), conflictAction(other.conflictAction) {}
 
-    static MetricType getMetricType(const std::string& metricName);
+    static QuantizationType getQuantizationType(const std::string& quantizationName);
 };
 
 struct DropHNSWConfig {
@@ -153,6 +177,7 @@ struct QueryHNSWConfig {
     int64_t efs = Efs::DEFAULT_VALUE;
     double blindSearchUpSelThreshold = BlindSearchUpSelThreshold::DEFAULT_VALUE;
     double directedSearchUpSelThreshold = DirectedSearchUpSelThreshold::DEFAULT_VALUE;
+    int64_t beamWidth = BeamWidth::DEFAULT_VALUE;
 
     QueryHNSWConfig() = default;
 
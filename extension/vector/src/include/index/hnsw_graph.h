@@ -214,6 +214,12 @@ public:
     void setNodeOffsetToInvalid(common::offset_t csrOffset) {
         setNodeOffset(csrOffset, view->getInvalidOffset());
     }
+    // Invalid offsets are the max value of the compressed type, i.e. all bits set.
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const function.
+    void setAllNodeOffsetsToInvalid() {
+        const auto data = buffer->getBuffer();
+        memset(data.data(), 0xFF, data.size());
+    }
     common::offset_t getNodeOffset(common::offset_t csrOffset) const {
         return view->getNodeOffsetAtomic(csrOffset);
     }
@@ -239,8 +245,23 @@ struct NodeToHNSWGraphOffsetMap {
     std::unique_ptr<common::offset_t[]> graphToNodeMap;
 };
 
+// A test-and-test-and-set spinlock. Appending to a neighbor list is short and rarely contended, so
+// spinning is cheaper than parking threads on a mutex.
+struct alignas(64) NbrListLock {
+    void lock() {
+        while (locked.exchange(true, std::memory_order_acquire)) {
+            while (locked.load(std::memory_order_relaxed)) {}
+        }
+    }
+    void unlock() { locked.store(false, std::memory_order_release); }
+
+    std::atomic<bool> locked{false};
+};
+
 class InMemHNSWGraph {
 public:
+    static constexpr uint64_t MAX_NUM_NBR_LIST_LOCKS = 1 << 14;
+
     InMemHNSWGraph(storage::MemoryManager* mm, common::offset_t numNodes,
         common::length_t maxDegree);
 
@@ -265,16 +286,10 @@ public:
         KU_ASSERT(length <= maxDegree);
         csrLengths[nodeOffset].store(length);
     }
-    // Note: when the incremented csr length hits maxDegree, this function will block until there is
-    // a shrink happening.
-    uint16_t incrementCSRLength(common::offset_t nodeOffset) {
-        KU_ASSERT(nodeOffset < numNodes);
-        while (true) {
-            auto val = csrLengths[nodeOffset].load();
-            if (val < maxDegree && csrLengths[nodeOffset].compare_exchange_strong(val, val + 1)) {
-                return val;
-            }
-        }
+    // Writers of a node's neighbor list (appending and shrinking) must hold its lock. Readers don't
+    // lock, as the csr length is only published after the appended neighbor is written.
+    NbrListLock& getNbrListLock(common::offset_t nodeOffset) const {
+        return nbrListLocks[nodeOffset & (numNbrListLocks - 1)];
     }
     void setDstNode(common::offset_t csrOffset, common::offset_t dstNode) {
         KU_ASSERT(csrOffset < numNodes * maxDegree);
@@ -286,8 +301,6 @@ public:
     }
 
 private:
-    void resetCSRLengthAndDstNodes();
-
     common::offset_t getDstNode(common::offset_t csrOffset) const {
         return dstNodes.getNodeOffset(csrOffset);
     }
@@ -297,6 +310,9 @@ private:
     std::unique_ptr<storage::MemoryBuffer> csrLengthBuffer;
     std::atomic<uint16_t>* csrLengths;
     CompressedNodeOffsetBuffer dstNodes;
+    // Neighbor list locks are striped by node offset.
+    uint64_t numNbrListLocks;
+    std::unique_ptr<NbrListLock[]> nbrListLocks;
     // Max allowed degree of a node in the graph before shrinking.
     common::length_t maxDegree;
 };
@@ -7,7 +7,9 @@
 #include "index/hnsw_config.h"
 #include "index/hnsw_graph.h"
 #include "index/hnsw_index_utils.h"
+#include "index/hnsw_quantization.h"
 #include "storage/index/index.h"
+#include "storage/page_range.h"
 
 namespace ryu {
 namespace catalog {
@@ -63,6 +65,9 @@ struct HNSWStorageInfo final : storage::IndexStorageInfo {
     common::offset_t upperEntryPoint;
     common::offset_t lowerEntryPoint;
     common::offset_t numCheckpointedNodes;
+    // Pages of the quantized codes. Invalid if the index isn't quantized or hasn't been
+    // checkpointed yet.
+    storage::PageRange quantizedCodesPageRange;
 
     HNSWStorageInfo()
         : upperRelTableID{common::INVALID_TABLE_ID}, lowerRelTableID{common::INVALID_TABLE_ID},
@@ -70,10 +75,12 @@ struct HNSWStorageInfo final : storage::IndexStorageInfo {
           numCheckpointedNodes{0} {}
     HNSWStorageInfo(common::table_id_t upperRelTableID, common::table_id_t lowerRelTableID,
         common::offset_t upperEntryPoint, common::offset_t lowerEntryPoint,
-        common::offset_t numCheckpointedNodes)
+        common::offset_t numCheckpointedNodes,
+        storage::PageRange quantizedCodesPageRange = storage::PageRange{})
         : upperRelTableID{upperRelTableID}, lowerRelTableID{lowerRelTableID},
           upperEntryPoint{upperEntryPoint}, lowerEntryPoint{lowerEntryPoint},
-          numCheckpointedNodes{numCheckpointedNodes} {}
+          numCheckpointedNodes{numCheckpointedNodes},
+          quantizedCodesPageRange{quantizedCodesPageRange} {}
 
     std::shared_ptr<common::BufferWriter> serialize() const override;
 
@@ -234,10 +241,16 @@ public:
         return embeddings->constructScanState();
     }
 
+    std::unique_ptr<QuantizedEmbeddingStore> moveQuantizedStore() {
+        return std::move(quantizedStore);
+    }
+
 private:
     std::unique_ptr<InMemHNSWLayer> upperLayer;
     std::unique_ptr<InMemHNSWLayer> lowerLayer;
     std::unique_ptr<HNSWIndexEmbeddings> embeddings;
+    // Codes of the embeddings if the index is quantized. Filled when finalizing node groups.
+    std::unique_ptr<QuantizedEmbeddingStore> quantizedStore;
 
     std::unique_ptr<NodeToHNSWGraphOffsetMap> lowerGraphSelectionMap; // this mapping is trivial
     std::unique_ptr<NodeToHNSWGraphOffsetMap> upperGraphSelectionMap;
@@ -249,6 +262,8 @@ enum class SearchType : uint8_t {
     DIRECTED_TWO_HOP = 1,
     ONE_HOP_FILTERED = 2,
     UNFILTERED = 3,
+    // Computes exact distances to all masked nodes without traversing the graph.
+    BRUTE_FORCE = 4,
 };
 
 struct HNSWSearchState {
@@ -268,6 +283,11 @@ struct HNSWSearchState {
     std::unique_ptr<graph::NbrScanState> nbrScanState;
     std::unique_ptr<graph::NbrScanState> secondHopNbrScanState;
 
+    // Set if the index is quantized. The graph is then traversed on the quantized codes, and
+    // `embeddings` is only read to re-rank the candidates.
+    std::unique_ptr<QuantizedEmbeddings> quantizedEmbeddings;
+    std::unique_ptr<GetEmbeddingsScanState> quantizedScanState;
+
     HNSWSearchState(main::ClientContext* context, catalog::TableCatalogEntry* nodeTableEntry,
         catalog::TableCatalogEntry* upperRelTableEntry,
         catalog::TableCatalogEntry* lowerRelTableEntry, storage::NodeTable& nodeTable,
@@ -278,6 +298,17 @@ struct HNSWSearchState {
         return !hasMask() || semiMask->isMasked(offset);
     }
     bool hasMask() const { return semiMask != nullptr; }
+
+    bool isQuantized() const { return quantizedEmbeddings != nullptr; }
+    // Returns the embedding used to traverse the graph.
+    EmbeddingHandle getSearchEmbedding(common::offset_t offset) {
+        return isQuantized() ? quantizedEmbeddings->getEmbedding(offset, *quantizedScanState) :
+                               embeddings->getEmbedding(offset, embeddingScanState);
+    }
+    std::vector<EmbeddingHandle> getSearchEmbeddings(std::span<const common::offset_t> offsets) {
+        return isQuantized() ? quantizedEmbeddings->getEmbeddings(offsets, *quantizedScanState) :
+                               embeddings->getEmbeddings(offsets, embeddingScanState);
+    }
 };
 
 class OnDiskHNSWIndex final : public HNSWIndex {
@@ -302,7 +333,8 @@ public:
     };
 
     OnDiskHNSWIndex(const main::ClientContext* context, storage::IndexInfo indexInfo,
-        std::unique_ptr<storage::IndexStorageInfo> storageInfo, HNSWIndexConfig config);
+        std::unique_ptr<storage::IndexStorageInfo> storageInfo, HNSWIndexConfig config,
+        std::unique_ptr<QuantizedEmbeddingStore> quantizedStore = nullptr);
 
     std::vector<NodeWithDistance> search(transaction::Transaction* transaction,
         const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const;
@@ -315,6 +347,11 @@ public:
     bool needCommitInsert() const override { return true; }
     void commitInsert(transaction::Transaction*, const common::ValueVector&,
         const std::vector<common::ValueVector*>&, InsertState&) override;
+    // Deleted nodes are left in the graph as tombstones. They keep routing searches, and are
+    // filtered out once their embeddings turn invisible. Their edges are compacted in bulk once
+    // enough of them accumulate.
+    void delete_(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        DeleteState& deleteState) override;
 
     static storage::IndexType getIndexType() {
         static const storage::IndexType HNSW_INDEX_TYPE{"HNSW",
@@ -325,13 +362,31 @@ public:
 
     void finalize(main::ClientContext*) override;
     void checkpoint(main::ClientContext* context, storage::PageAllocator& pageAllocator) override;
+    void rollbackCheckpoint() override;
 
 private:
+    // Sets up traversal on the quantized codes if the index is quantized.
+    void initQuantizedSearchState(const transaction::Transaction* transaction,
+        HNSWSearchState& searchState) const;
+    const metric_func_t& getSearchMetricFunc(const HNSWSearchState& searchState) const {
+        return searchState.isQuantized() ? quantizedMetricFunc : metricFunc;
+    }
+    void rerankWithExactEmbeddings(const EmbeddingHandle& queryVector,
+        HNSWSearchState& searchState, std::vector<NodeWithDistance>& candidates) const;
+    // Compares the estimated number of distance computations of a filtered graph search with the
+    // ones of a brute force search over the masked nodes.
+    bool shouldSearchBruteForce(transaction::Transaction* transaction,
+        const HNSWSearchState& searchState) const;
+    std::vector<NodeWithDistance> searchBruteForce(const EmbeddingHandle& queryVector,
+        HNSWSearchState& searchState) const;
+    void quantizeEmbeddings(transaction::Transaction* transaction, common::offset_t startOffset,
+        common::offset_t endOffset);
+
     common::offset_t searchNNInUpperLayer(const EmbeddingHandle& queryVector,
         HNSWSearchState& searchState) const;
     std::vector<NodeWithDistance> searchKNNInLayer(transaction::Transaction* transaction,
         const EmbeddingHandle& queryVector, common::offset_t entryNode,
-        HNSWSearchState& searchState, bool isUpperLayer) const;
+        HNSWSearchState& searchState, bool isUpperLayer, common::length_t k) const;
     std::vector<NodeWithDistance> searchFromCheckpointed(transaction::Transaction* transaction,
         const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const;
     void searchFromUnCheckpointed(transaction::Transaction* transaction,
@@ -351,13 +406,35 @@ private:
         min_node_priority_queue_t& candidates, max_node_priority_queue_t& results) const;
     void insertInternal(transaction::Transaction* transaction, common::offset_t offset,
         const EmbeddingHandle& vector, HNSWInsertState& insertState);
+    // Inserts nodes in [startOffset, endOffset). Their neighbors are searched in parallel over the
+    // graph as it was before the batch, and the rels are then created one node at a time.
+    void batchInsert(main::ClientContext* context, common::offset_t startOffset,
+        common::offset_t endOffset, HNSWInsertState& insertState);
     void insertToLayer(transaction::Transaction* transaction, common::offset_t offset,
         common::offset_t entryPoint, const EmbeddingHandle& queryVector,
         HNSWInsertState& insertState, bool isUpperLayer);
+    // Links the node with its neighbors in both directions. The node becomes the entry point if
+    // the layer is empty.
+    void linkToNbrs(transaction::Transaction* transaction, common::offset_t offset,
+        const std::vector<NodeWithDistance>& nbrs, HNSWInsertState& insertState,
+        bool isUpperLayer);
     void createRels(transaction::Transaction* transaction, common::offset_t offset,
         const std::vector<NodeWithDistance>& nbrs, bool isUpperLayer, HNSWInsertState& insertState);
     void shrinkForNode(transaction::Transaction* transaction, common::offset_t offset,
         bool isUpperLayer, common::length_t maxDegree, HNSWInsertState& insertState);
+    // Replaces the rels of the node with the pruned subset of `nbrOffsets`.
+    void rewriteRels(transaction::Transaction* transaction, common::offset_t offset,
+        const std::vector<common::offset_t>& nbrOffsets, bool isUpperLayer,
+        common::length_t maxDegree, HNSWInsertState& insertState);
+    std::vector<common::offset_t> getNbrOffsets(common::offset_t offset, bool isUpperLayer,
+        const HNSWSearchState& searchState) const;
+
+    bool shouldCompactTombstones() const;
+    // Relinks the neighbors of deleted nodes through the deleted nodes' own neighbors, and then
+    // removes the rels of deleted nodes.
+    void compactTombstones(transaction::Transaction* transaction, HNSWInsertState& insertState);
+    void compactLayer(transaction::Transaction* transaction, const std::vector<bool>& isTombstone,
+        bool isUpperLayer, HNSWInsertState& insertState);
 
     void processSecondHopCandidates(const EmbeddingHandle& queryVector,
         HNSWSearchState& searchState, int64_t& numVisitedNbrs,
@@ -389,12 +466,28 @@ private:
 
 private:
     static constexpr uint64_t FILTERED_SEARCH_INITIAL_CANDIDATES = 10;
+    // Cost of checking a neighbor against the semi mask, relative to a distance computation.
+    static constexpr double NBR_CHECK_COST = 1.0 / 32;
+    // Appends smaller than this are inserted one node at a time. Larger ones are inserted in
+    // batches once the graph holds this many nodes.
     static constexpr uint64_t INSERTION_BATCH_MERGE_THRESHOLD = 2000;
+    // Nodes of a batch are not linked with each other directly, so a batch is never larger than
+    // the graph it is inserted into.
+    static constexpr uint64_t MAX_INSERTION_BATCH_SIZE = 16384;
+    // Tombstones are compacted once they make up this fraction of the indexed nodes.
+    static constexpr double TOMBSTONE_RATIO_TO_COMPACT = 0.1;
 
     storage::MemoryManager* mm;
     storage::NodeTable& nodeTable;
     storage::RelTable* upperRelTable;
     storage::RelTable* lowerRelTable;
+    std::unique_ptr<QuantizedEmbeddingStore> quantizedStore;
+    metric_func_t quantizedMetricFunc;
+    // Page range of the quantized codes before the ongoing checkpoint, restored on rollback.
+    std::optional<storage::PageRange> quantizedCodesPageRangeBeforeCheckpoint;
+    // Number of indexed nodes deleted since the last compaction. It is only used to decide when to
+    // compact, so it isn't persisted or rolled back.
+    std::atomic<uint64_t> numTombstones;
 };
 
 } // namespace vector_extension
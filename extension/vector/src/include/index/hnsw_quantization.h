@@ -0,0 +1,126 @@
+#pragma once
+
+#include <shared_mutex>
+
+#include "index/hnsw_config.h"
+#include "index/hnsw_graph.h"
+#include "index/hnsw_index_utils.h"
+
+namespace ryu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace vector_extension {
+
+// Int8 scalar quantization of embeddings. Each vector is scaled by its own max absolute value, so
+// codes are computed independently of each other and vectors inserted after the index is created
+// are encoded the same way as the ones at creation.
+// A code is laid out as [scale (float)][squared norm (float)][dimension x int8].
+struct ScalarQuantizer {
+    static constexpr uint64_t HEADER_SIZE = 2 * sizeof(float);
+    // Marks the slot of a vector that has no code (e.g. NULL vectors).
+    static constexpr float EMPTY_SCALE = -1.0f;
+
+    static uint64_t getCodeSize(common::length_t dimension) { return HEADER_SIZE + dimension; }
+
+    static void encode(const void* vector, const common::LogicalType& elementType,
+        common::length_t dimension, uint8_t* code);
+
+    // Distance functions on codes, matching the ones on full vectors up to quantization errors.
+    static metric_func_t getMetricsFunction(MetricType metric);
+};
+
+// Holds the quantized codes of an HNSW index, indexed by node offset. Codes are kept in fixed-size
+// chunks, so pointers to codes stay valid while new chunks are appended.
+class QuantizedEmbeddingStore {
+public:
+    static constexpr uint64_t CHUNK_CAPACITY = common::DEFAULT_VECTOR_CAPACITY;
+
+    QuantizedEmbeddingStore(storage::MemoryManager* mm, common::length_t dimension);
+
+    common::length_t getDimension() const { return dimension; }
+
+    // Pre-allocates chunks for `numVectors` codes, so that codes can be set concurrently.
+    void resize(common::offset_t numVectors);
+    void set(common::offset_t offset, const void* vector, const common::LogicalType& elementType);
+    // Returns nullptr if no code is stored for the offset.
+    const uint8_t* getCode(common::offset_t offset) const;
+
+    bool hasChanges() const { return changed; }
+    void resetChanges() { changed = false; }
+    void setChanges() { changed = true; }
+
+    void serialize(common::Serializer& ser) const;
+    static std::unique_ptr<QuantizedEmbeddingStore> deserialize(common::Deserializer& deSer,
+        storage::MemoryManager* mm);
+
+private:
+    void appendChunksNoLock(uint64_t numChunksToAppend);
+
+private:
+    storage::MemoryManager* mm;
+    common::length_t dimension;
+    uint64_t codeSize;
+    mutable std::shared_mutex mtx;
+    std::vector<std::unique_ptr<storage::MemoryBuffer>> chunks;
+    std::atomic<bool> changed;
+};
+
+class QuantizedEmbeddingScanState final : public GetEmbeddingsScanState {
+public:
+    explicit QuantizedEmbeddingScanState(const QuantizedEmbeddingStore& store) : store{store} {}
+
+    void* getEmbeddingPtr(const EmbeddingHandle& handle) override;
+    void addEmbedding(const EmbeddingHandle&) override {}
+    void reclaimEmbedding(const EmbeddingHandle&) override {}
+
+private:
+    const QuantizedEmbeddingStore& store;
+};
+
+// Quantized codes of nodes visible to the transaction. Used in place of the embedding column to
+// traverse the graph.
+class QuantizedEmbeddings final : public HNSWIndexEmbeddings {
+public:
+    QuantizedEmbeddings(const transaction::Transaction* transaction,
+        common::ArrayTypeInfo typeInfo, const storage::NodeTable& nodeTable,
+        const QuantizedEmbeddingStore& store)
+        : HNSWIndexEmbeddings{std::move(typeInfo)}, transaction{transaction},
+          nodeTable{nodeTable}, store{store} {}
+
+    EmbeddingHandle getEmbedding(common::offset_t offset,
+        GetEmbeddingsScanState& scanState) const override;
+    std::vector<EmbeddingHandle> getEmbeddings(std::span<const common::offset_t> offsets,
+        GetEmbeddingsScanState& scanState) const override;
+    std::unique_ptr<GetEmbeddingsScanState> constructScanState() const override {
+        return std::make_unique<QuantizedEmbeddingScanState>(store);
+    }
+
+private:
+    const transaction::Transaction* transaction;
+    const storage::NodeTable& nodeTable;
+    const QuantizedEmbeddingStore& store;
+};
+
+// Wraps the code of a vector that is not (yet) in the store, e.g. the query vector.
+struct QuantizedQueryVector final : GetEmbeddingsScanState {
+    QuantizedQueryVector(const EmbeddingHandle& vector, const common::LogicalType& elementType,
+        common::length_t dimension)
+        : code(ScalarQuantizer::getCodeSize(dimension)) {
+        ScalarQuantizer::encode(vector.getPtr(), elementType, dimension, code.data());
+    }
+
+    void* getEmbeddingPtr([[maybe_unused]] const EmbeddingHandle& handle) override {
+        KU_ASSERT(!handle.isNull() && handle.offsetInData == 0);
+        return code.data();
+    }
+    void addEmbedding(const EmbeddingHandle&) override {}
+    void reclaimEmbedding(const EmbeddingHandle&) override {}
+
+    std::vector<uint8_t> code;
+};
+
+} // namespace vector_extension
+} // namespace ryu
@@ -0,0 +1,90 @@
+#include "index/diskann_config.h"
+
+#include "common/exception/binder.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/string_utils.h"
+#include "function/hnsw_index_functions.h"
+
+namespace ryu {
+namespace vector_extension {
+
+// Neighbor lists are stored inline in fixed-size blocks, so the degree is bounded well below the
+// degree of HNSW graphs.
+static constexpr int64_t MAX_DISKANN_DEGREE = 256;
+
+void Degree::validate(int64_t value) {
+    if (value < 1 || value > MAX_DISKANN_DEGREE) {
+        throw common::BinderException{common::stringFormat(
+            "Degree must be a positive integer between 1 and {}.", MAX_DISKANN_DEGREE)};
+    }
+}
+
+void SearchListSize::validate(int64_t value) {
+    if (value < 1) {
+        throw common::BinderException{"L must be a positive integer."};
+    }
+}
+
+DiskANNIndexConfig::DiskANNIndexConfig(const function::optional_params_t& optionalParams) {
+    for (auto& [name, value] : optionalParams) {
+        auto lowerCaseName = common::StringUtils::getLower(name);
+        if (Degree::NAME == lowerCaseName) {
+            value.validateType(Degree::TYPE);
+            degree = value.getValue<int64_t>();
+            Degree::validate(degree);
+        } else if (SearchListSize::NAME == lowerCaseName) {
+            value.validateType(SearchListSize::TYPE);
+            searchListSize = value.getValue<int64_t>();
+            SearchListSize::validate(searchListSize);
+        } else if (Alpha::NAME == lowerCaseName) {
+            value.validateType(Alpha::TYPE);
+            alpha = value.getValue<double>();
+            Alpha::validate(alpha);
+        } else if (Metric::NAME == lowerCaseName) {
+            value.validateType(Metric::TYPE);
+            auto funcName = value.getValue<std::string>();
+            Metric::validate(funcName);
+            metric = HNSWIndexConfig::getMetricType(funcName);
+        } else if (SkipIfExists::NAME == lowerCaseName) {
+            value.validateType(SkipIfExists::TYPE);
+            conflictAction = value.getValue<bool>() ?
+                                 common::ConflictAction::ON_CONFLICT_DO_NOTHING :
+                                 common::ConflictAction::ON_CONFLICT_THROW;
+        } else {
+            throw common::BinderException{
+                common::stringFormat("Unrecognized optional parameter {} in {}.", name,
+                    CreateDiskANNIndexFunction::name)};
+        }
+    }
+}
+
+void DiskANNIndexConfig::serialize(common::Serializer& ser) const {
+    ser.writeDebuggingInfo("degree");
+    ser.serializeValue(degree);
+    ser.writeDebuggingInfo("searchListSize");
+    ser.serializeValue(searchListSize);
+    ser.writeDebuggingInfo("alpha");
+    ser.serializeValue(alpha);
+    ser.writeDebuggingInfo("metric");
+    ser.serializeValue<uint8_t>(static_cast<uint8_t>(metric));
+}
+
+DiskANNIndexConfig DiskANNIndexConfig::deserialize(common::Deserializer& deSer) {
+    auto config = DiskANNIndexConfig{};
+    std::string debuggingInfo;
+    deSer.validateDebuggingInfo(debuggingInfo, "degree");
+    deSer.deserializeValue(config.degree);
+    deSer.validateDebuggingInfo(debuggingInfo, "searchListSize");
+    deSer.deserializeValue(config.searchListSize);
+    deSer.validateDebuggingInfo(debuggingInfo, "alpha");
+    deSer.deserializeValue(config.alpha);
+    deSer.validateDebuggingInfo(debuggingInfo, "metric");
+    uint8_t metric = 0;
+    deSer.deserializeValue(metric);
+    config.metric = static_cast<MetricType>(metric);
+    return config;
+}
+
+} // namespace vector_extension
+} // namespace ryu
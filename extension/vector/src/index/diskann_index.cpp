@@ -0,0 +1,599 @@
+#include "index/diskann_index.h"
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/index_catalog_entry.h"
+#include "catalog/diskann_index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/serializer/buffer_reader.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "storage/file_handle.h"
+#include "storage/page_allocator.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::storage;
+using namespace ryu::transaction;
+
+namespace ryu {
+namespace vector_extension {
+
+DiskANNBlockLayout::DiskANNBlockLayout(common::length_t degree, common::length_t dimension)
+    : degree{degree}, codeOffset{NEIGHBORS_OFFSET + degree * sizeof(common::offset_t)},
+      blockSize{getBlockSize(degree, dimension)},
+      numBlocksPerPage{std::max<uint64_t>(common::RYU_PAGE_SIZE / blockSize, 1)} {}
+
+uint64_t DiskANNBlockLayout::getBlockSize(common::length_t degree, common::length_t dimension) {
+    const auto size = NEIGHBORS_OFFSET + degree * sizeof(common::offset_t) +
+                      ScalarQuantizer::getCodeSize(dimension);
+    return (size + sizeof(common::offset_t) - 1) / sizeof(common::offset_t) *
+           sizeof(common::offset_t);
+}
+
+std::shared_ptr<common::BufferWriter> DiskANNStorageInfo::serialize() const {
+    auto bufferWriter = std::make_shared<common::BufferWriter>();
+    auto serializer = common::Serializer(bufferWriter);
+    serializer.write<common::offset_t>(entryPoint);
+    serializer.write<common::offset_t>(numIndexedNodes);
+    serializer.write<common::page_idx_t>(blocksPageRange.startPageIdx);
+    serializer.write<common::page_idx_t>(blocksPageRange.numPages);
+    return bufferWriter;
+}
+
+std::unique_ptr<IndexStorageInfo> DiskANNStorageInfo::deserialize(
+    std::unique_ptr<common::BufferReader> reader) {
+    common::offset_t entryPoint = common::INVALID_OFFSET;
+    common::offset_t numIndexedNodes = 0;
+    PageRange blocksPageRange;
+    common::Deserializer deSer{std::move(reader)};
+    deSer.deserializeValue<common::offset_t>(entryPoint);
+    deSer.deserializeValue<common::offset_t>(numIndexedNodes);
+    deSer.deserializeValue<common::page_idx_t>(blocksPageRange.startPageIdx);
+    deSer.deserializeValue<common::page_idx_t>(blocksPageRange.numPages);
+    return std::make_unique<DiskANNStorageInfo>(entryPoint, numIndexedNodes, blocksPageRange);
+}
+
+static common::ArrayTypeInfo getArrayTypeInfo(NodeTable& table, common::column_id_t columnID) {
+    const auto& columnType = table.getColumn(columnID).getDataType();
+    KU_ASSERT(columnType.getLogicalTypeID() == common::LogicalTypeID::ARRAY);
+    const auto typeInfo = columnType.getExtraTypeInfo()->constPtrCast<common::ArrayTypeInfo>();
+    return common::ArrayTypeInfo{typeInfo->getChildType().copy(), typeInfo->getNumElements()};
+}
+
+DiskANNSearchState::DiskANNSearchState(main::ClientContext* context, NodeTable& nodeTable,
+    common::column_id_t columnID, uint64_t k, const QueryHNSWConfig& config)
+    : embeddings{std::make_unique<OnDiskEmbeddings>(Transaction::Get(*context),
+          MemoryManager::Get(*context), getArrayTypeInfo(nodeTable, columnID), nodeTable,
+          columnID)},
+      embeddingScanState{Transaction::Get(*context), MemoryManager::Get(*context), nodeTable,
+          columnID, embeddings->getDimension()},
+      k{k}, searchListSize{std::max(k, static_cast<uint64_t>(config.efs))},
+      beamWidth{static_cast<uint64_t>(config.beamWidth)}, semiMask{nullptr} {}
+
+namespace {
+
+// Candidates of a greedy search, sorted by distance and bounded by the search list size.
+class CandidateList {
+public:
+    explicit CandidateList(uint64_t capacity) : capacity{capacity} {}
+
+    // Returns false if the candidate is not close enough to be kept.
+    bool insert(common::offset_t offset, double distance) {
+        if (candidates.size() == capacity && distance >= candidates.back().distance) {
+            return false;
+        }
+        const auto pos = std::ranges::upper_bound(candidates, distance, std::less{},
+            [](const Candidate& candidate) { return candidate.distance; });
+        candidates.insert(pos, Candidate{offset, distance, false /* expanded */});
+        if (candidates.size() > capacity) {
+            candidates.pop_back();
+        }
+        return true;
+    }
+
+    // Marks the (up to) `beamWidth` closest unexpanded candidates as expanded and returns them.
+    std::vector<common::offset_t> expandNext(uint64_t beamWidth) {
+        std::vector<common::offset_t> beam;
+        for (auto& candidate : candidates) {
+            if (beam.size() == beamWidth) {
+                break;
+            }
+            if (!candidate.expanded) {
+                candidate.expanded = true;
+                beam.push_back(candidate.offset);
+            }
+        }
+        return beam;
+    }
+
+    std::vector<NodeWithDistance> getNodes() const {
+        std::vector<NodeWithDistance> nodes;
+        nodes.reserve(candidates.size());
+        for (const auto& candidate : candidates) {
+            nodes.emplace_back(candidate.offset, candidate.distance);
+        }
+        return nodes;
+    }
+
+private:
+    struct Candidate {
+        common::offset_t offset;
+        double distance;
+        bool expanded;
+    };
+
+    uint64_t capacity;
+    std::vector<Candidate> candidates;
+};
+
+// Builds a Vamana graph in memory over the exact embeddings, inserting nodes one by one from the
+// medoid as in FreshDiskANN.
+class VamanaGraphBuilder {
+public:
+    VamanaGraphBuilder(MemoryManager* mm, const DiskANNIndexConfig& config,
+        const common::ArrayTypeInfo& typeInfo, const metric_func_t& metricFunc,
+        common::offset_t numNodes)
+        : mm{mm}, config{config}, typeInfo{typeInfo}, metricFunc{metricFunc},
+          dimension{typeInfo.getNumElements()},
+          embeddingSize{common::PhysicalTypeUtils::getFixedTypeSize(
+                            typeInfo.getChildType().getPhysicalType()) *
+                        dimension},
+          numNodes{numNodes}, hasEmbedding(numNodes, false), neighbors(numNodes),
+          visitedEpochs(numNodes, 0), epoch{0}, entryPoint{common::INVALID_OFFSET} {}
+
+    common::offset_t getEntryPoint() const { return entryPoint; }
+
+    void loadEmbeddings(Transaction* transaction, NodeTable& nodeTable,
+        common::column_id_t columnID) {
+        if (numNodes == 0) {
+            return;
+        }
+        embeddings = mm->allocateBuffer(false /* initializeToZero */, numNodes * embeddingSize);
+        const OnDiskEmbeddings onDiskEmbeddings{transaction, mm,
+            common::ArrayTypeInfo{typeInfo.getChildType().copy(), dimension}, nodeTable,
+            columnID};
+        OnDiskEmbeddingScanState scanState{transaction, mm, nodeTable, columnID, dimension};
+        common::offset_vec_t offsets;
+        for (auto startOffset = 0u; startOffset < numNodes;
+             startOffset += common::DEFAULT_VECTOR_CAPACITY) {
+            const auto endOffset =
+                std::min<common::offset_t>(startOffset + common::DEFAULT_VECTOR_CAPACITY, numNodes);
+            offsets.clear();
+            for (auto offset = startOffset; offset < endOffset; offset++) {
+                offsets.push_back(offset);
+            }
+            const auto vectors = onDiskEmbeddings.getEmbeddings(offsets, scanState);
+            for (auto i = 0u; i < offsets.size(); i++) {
+                if (vectors[i].isNull()) {
+                    continue;
+                }
+                memcpy(getEmbeddingData(offsets[i]), vectors[i].getPtr(), embeddingSize);
+                hasEmbedding[offsets[i]] = true;
+            }
+        }
+    }
+
+    void build() {
+        entryPoint = findMedoid();
+        if (entryPoint == common::INVALID_OFFSET) {
+            return;
+        }
+        for (auto offset = 0u; offset < numNodes; offset++) {
+            if (hasEmbedding[offset] && offset != entryPoint) {
+                insert(offset);
+            }
+        }
+    }
+
+    void writeBlocks(const DiskANNBlockLayout& layout, common::InMemFileWriter& writer) const {
+        std::vector<uint8_t> page(common::RYU_PAGE_SIZE);
+        for (auto pageIdx = 0u; pageIdx < layout.getNumPages(numNodes); pageIdx++) {
+            std::fill(page.begin(), page.end(), 0);
+            const auto startOffset = pageIdx * layout.numBlocksPerPage;
+            const auto endOffset = std::min(startOffset + layout.numBlocksPerPage, numNodes);
+            for (auto offset = startOffset; offset < endOffset; offset++) {
+                const auto block = page.data() + layout.getPosInPage(offset);
+                const auto numNeighbors = static_cast<uint32_t>(neighbors[offset].size());
+                memcpy(block, &numNeighbors, sizeof(uint32_t));
+                memcpy(block + DiskANNBlockLayout::NEIGHBORS_OFFSET, neighbors[offset].data(),
+                    numNeighbors * sizeof(common::offset_t));
+                if (hasEmbedding[offset]) {
+                    ScalarQuantizer::encode(getEmbeddingData(offset), typeInfo.getChildType(),
+                        dimension, block + layout.codeOffset);
+                } else {
+                    memcpy(block + layout.codeOffset, &ScalarQuantizer::EMPTY_SCALE,
+                        sizeof(float));
+                }
+            }
+            writer.write(page.data(), common::RYU_PAGE_SIZE);
+        }
+    }
+
+private:
+    uint8_t* getEmbeddingData(common::offset_t offset) const {
+        return embeddings->getData() + offset * embeddingSize;
+    }
+    double computeDistance(const void* query, common::offset_t offset) const {
+        return metricFunc(query, getEmbeddingData(offset), dimension);
+    }
+
+    common::offset_t findMedoid() const {
+        std::vector<double> centroid(dimension, 0.0);
+        common::offset_t numEmbeddings = 0;
+        common::TypeUtils::visit(
+            typeInfo.getChildType(),
+            [&]<VectorElementType T>(T) {
+                for (auto offset = 0u; offset < numNodes; offset++) {
+                    if (!hasEmbedding[offset]) {
+                        continue;
+                    }
+                    const auto embedding = reinterpret_cast<const T*>(getEmbeddingData(offset));
+                    for (auto i = 0u; i < dimension; i++) {
+                        centroid[i] += embedding[i];
+                    }
+                    numEmbeddings++;
+                }
+            },
+            [&](auto) { KU_UNREACHABLE; });
+        if (numEmbeddings == 0) {
+            return common::INVALID_OFFSET;
+        }
+        std::vector<uint8_t> centroidData(embeddingSize);
+        common::TypeUtils::visit(
+            typeInfo.getChildType(),
+            [&]<VectorElementType T>(T) {
+                const auto data = reinterpret_cast<T*>(centroidData.data());
+                for (auto i = 0u; i < dimension; i++) {
+                    data[i] = static_cast<T>(centroid[i] / numEmbeddings);
+                }
+            },
+            [&](auto) { KU_UNREACHABLE; });
+        auto medoid = common::INVALID_OFFSET;
+        auto minDistance = std::numeric_limits<double>::max();
+        for (auto offset = 0u; offset < numNodes; offset++) {
+            if (!hasEmbedding[offset]) {
+                continue;
+            }
+            const auto distance = computeDistance(centroidData.data(), offset);
+            if (distance < minDistance) {
+                minDistance = distance;
+                medoid = offset;
+            }
+        }
+        return medoid;
+    }
+
+    // Returns the nodes expanded by a greedy search from the entry point. They form the candidate
+    // neighbors of the query node.
+    std::vector<NodeWithDistance> greedySearch(const void* query) {
+        epoch++;
+        std::vector<NodeWithDistance> expanded;
+        CandidateList candidates{static_cast<uint64_t>(config.searchListSize)};
+        candidates.insert(entryPoint, computeDistance(query, entryPoint));
+        visitedEpochs[entryPoint] = epoch;
+        while (true) {
+            const auto beam = candidates.expandNext(1 /* beamWidth */);
+            if (beam.empty()) {
+                break;
+            }
+            const auto offset = beam[0];
+            expanded.emplace_back(offset, computeDistance(query, offset));
+            for (const auto nbr : neighbors[offset]) {
+                if (visitedEpochs[nbr] == epoch) {
+                    continue;
+                }
+                visitedEpochs[nbr] = epoch;
+                candidates.insert(nbr, computeDistance(query, nbr));
+            }
+        }
+        return expanded;
+    }
+
+    // Keeps the closest candidates that are not covered by an already kept neighbor, i.e. a
+    // candidate is dropped if it is alpha times closer to a kept neighbor than to the node.
+    std::vector<common::offset_t> robustPrune(common::offset_t offset,
+        std::vector<NodeWithDistance> candidates) const {
+        std::ranges::sort(candidates, [](const NodeWithDistance& l, const NodeWithDistance& r) {
+            return l.distance < r.distance;
+        });
+        std::vector<common::offset_t> result;
+        for (const auto& candidate : candidates) {
+            if (result.size() == static_cast<uint64_t>(config.degree)) {
+                break;
+            }
+            if (candidate.nodeOffset == offset ||
+                std::ranges::find(result, candidate.nodeOffset) != result.end()) {
+                continue;
+            }
+            bool keep = true;
+            for (const auto kept : result) {
+                const auto distance =
+                    computeDistance(getEmbeddingData(kept), candidate.nodeOffset);
+                if (config.alpha * distance < candidate.distance) {
+                    keep = false;
+                    break;
+                }
+            }
+            if (keep) {
+                result.push_back(candidate.nodeOffset);
+            }
+        }
+        return result;
+    }
+
+    void insert(common::offset_t offset) {
+        const auto embedding = getEmbeddingData(offset);
+        neighbors[offset] = robustPrune(offset, greedySearch(embedding));
+        for (const auto nbr : neighbors[offset]) {
+            auto& nbrNeighbors = neighbors[nbr];
+            if (std::ranges::find(nbrNeighbors, offset) != nbrNeighbors.end()) {
+                continue;
+            }
+            if (nbrNeighbors.size() < static_cast<uint64_t>(config.degree)) {
+                nbrNeighbors.push_back(offset);
+                continue;
+            }
+            std::vector<NodeWithDistance> candidates;
+            candidates.reserve(nbrNeighbors.size() + 1);
+            const auto nbrEmbedding = getEmbeddingData(nbr);
+            for (const auto nbrNbr : nbrNeighbors) {
+                candidates.emplace_back(nbrNbr, computeDistance(nbrEmbedding, nbrNbr));
+            }
+            candidates.emplace_back(offset, computeDistance(nbrEmbedding, offset));
+            nbrNeighbors = robustPrune(nbr, std::move(candidates));
+        }
+    }
+
+private:
+    MemoryManager* mm;
+    const DiskANNIndexConfig& config;
+    const common::ArrayTypeInfo& typeInfo;
+    const metric_func_t& metricFunc;
+    common::length_t dimension;
+    uint64_t embeddingSize;
+    common::offset_t numNodes;
+    std::unique_ptr<MemoryBuffer> embeddings;
+    std::vector<bool> hasEmbedding;
+    std::vector<std::vector<common::offset_t>> neighbors;
+    // Nodes visited by the current greedy search are marked with the current epoch, which saves
+    // clearing the visited states between searches.
+    std::vector<uint32_t> visitedEpochs;
+    uint32_t epoch;
+    common::offset_t entryPoint;
+};
+
+} // namespace
+
+DiskANNIndex::DiskANNIndex(const main::ClientContext* context, IndexInfo indexInfo,
+    std::unique_ptr<IndexStorageInfo> storageInfo, DiskANNIndexConfig config)
+    : Index{indexInfo, std::move(storageInfo)}, config{std::move(config)},
+      typeInfo{getArrayTypeInfo(
+          StorageManager::Get(*context)->getTable(indexInfo.tableID)->cast<NodeTable>(),
+          indexInfo.columnIDs[0])},
+      layout{static_cast<common::length_t>(this->config.degree), typeInfo.getNumElements()},
+      mm{MemoryManager::Get(*context)},
+      nodeTable{StorageManager::Get(*context)->getTable(indexInfo.tableID)->cast<NodeTable>()},
+      dataFH{StorageManager::Get(*context)->getDataFH()}, hasUnflushedBlocks{false} {
+    KU_ASSERT(this->indexInfo.columnIDs.size() == 1);
+    metricFunc = HNSWIndexUtils::getMetricsFunction(this->config.metric, typeInfo.getChildType());
+    quantizedMetricFunc = ScalarQuantizer::getMetricsFunction(this->config.metric);
+}
+
+void DiskANNIndex::validateBlockSize(common::length_t degree, common::length_t dimension) {
+    const auto blockSize = DiskANNBlockLayout::getBlockSize(degree, dimension);
+    if (blockSize > common::RYU_PAGE_SIZE) {
+        throw common::BinderException{common::stringFormat(
+            "The DiskANN block of a node with degree {} and dimension {} takes {} bytes, which "
+            "exceeds the page size of {} bytes. Try a smaller degree.",
+            degree, dimension, blockSize, common::RYU_PAGE_SIZE)};
+    }
+}
+
+void DiskANNIndex::build(Transaction* transaction) {
+    const auto numNodes = nodeTable.getNumTotalRows(transaction);
+    VamanaGraphBuilder builder{mm, config, typeInfo, metricFunc, numNodes};
+    builder.loadEmbeddings(transaction, nodeTable, indexInfo.columnIDs[0]);
+    builder.build();
+    inMemBlocks = std::make_unique<common::InMemFileWriter>(*mm);
+    builder.writeBlocks(layout, *inMemBlocks);
+    hasUnflushedBlocks = true;
+    auto& diskANNStorageInfo = storageInfo->cast<DiskANNStorageInfo>();
+    diskANNStorageInfo.entryPoint = builder.getEntryPoint();
+    diskANNStorageInfo.numIndexedNodes = numNodes;
+}
+
+std::unique_ptr<Index> DiskANNIndex::load(main::ClientContext* context, StorageManager*,
+    IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
+    auto reader =
+        std::make_unique<common::BufferReader>(storageInfoBuffer.data(), storageInfoBuffer.size());
+    auto storageInfo = DiskANNStorageInfo::deserialize(std::move(reader));
+    const auto catalog = catalog::Catalog::Get(*context);
+    const auto transaction = Transaction::Get(*context);
+    const auto indexEntry = catalog->getIndex(transaction, indexInfo.tableID, indexInfo.name);
+    const auto auxInfo = indexEntry->getAuxInfo().cast<DiskANNIndexAuxInfo>();
+    const auto blocksPageRange = storageInfo->cast<DiskANNStorageInfo>().blocksPageRange;
+    auto index = std::make_unique<DiskANNIndex>(context, std::move(indexInfo),
+        std::move(storageInfo), auxInfo.config.copy());
+    if (blocksPageRange.startPageIdx == common::INVALID_PAGE_IDX) {
+        // The blocks were never checkpointed, e.g. the database is in memory. Rebuild the graph.
+        index->build(transaction);
+    }
+    return index;
+}
+
+void DiskANNIndex::readBlocks(std::vector<common::offset_t>& offsets,
+    const std::function<void(common::offset_t, const uint8_t*)>& func) const {
+    // Blocks are laid out by node offset, so sorting the offsets groups them by page.
+    std::ranges::sort(offsets);
+    const auto startPageIdx =
+        storageInfo->constCast<DiskANNStorageInfo>().blocksPageRange.startPageIdx;
+    if (!inMemBlocks) {
+        // Hint the file system to read all pages of the batch, merging adjacent pages into runs.
+        for (auto i = 0u; i < offsets.size();) {
+            const auto runStartPageIdx = layout.getPageIdx(offsets[i]);
+            auto runEndPageIdx = runStartPageIdx;
+            while (i < offsets.size() && layout.getPageIdx(offsets[i]) <= runEndPageIdx + 1) {
+                runEndPageIdx = layout.getPageIdx(offsets[i]);
+                i++;
+            }
+            dataFH->prefetchPagesAsync(PageRange{startPageIdx + runStartPageIdx,
+                runEndPageIdx - runStartPageIdx + 1});
+        }
+    }
+    std::vector<uint8_t> blocks;
+    for (auto i = 0u; i < offsets.size();) {
+        const auto pageIdx = layout.getPageIdx(offsets[i]);
+        auto end = i;
+        while (end < offsets.size() && layout.getPageIdx(offsets[end]) == pageIdx) {
+            end++;
+        }
+        blocks.resize((end - i) * layout.blockSize);
+        // Blocks are copied out of the page, as optimistic reads can be retried.
+        const auto copyBlocks = [&](const uint8_t* page) {
+            for (auto j = i; j < end; j++) {
+                memcpy(blocks.data() + (j - i) * layout.blockSize,
+                    page + layout.getPosInPage(offsets[j]), layout.blockSize);
+            }
+        };
+        if (inMemBlocks) {
+            copyBlocks(inMemBlocks->getPage(pageIdx).data());
+        } else {
+            dataFH->optimisticReadPage(startPageIdx + pageIdx, copyBlocks);
+        }
+        for (auto j = i; j < end; j++) {
+            func(offsets[j], blocks.data() + (j - i) * layout.blockSize);
+        }
+        i = end;
+    }
+}
+
+std::vector<NodeWithDistance> DiskANNIndex::beamSearch(const uint8_t* queryCode,
+    const DiskANNSearchState& searchState) const {
+    const auto& diskANNStorageInfo = storageInfo->constCast<DiskANNStorageInfo>();
+    CandidateList candidates{searchState.searchListSize};
+    std::unordered_set<common::offset_t> visited{diskANNStorageInfo.entryPoint};
+    // Neighbors of the candidates that are not expanded yet. They are read along with the codes,
+    // so expanding a candidate doesn't need another read.
+    std::unordered_map<common::offset_t, std::vector<common::offset_t>> neighbors;
+    const auto dimension = typeInfo.getNumElements();
+    std::vector<common::offset_t> offsetsToRead{diskANNStorageInfo.entryPoint};
+    while (!offsetsToRead.empty()) {
+        readBlocks(offsetsToRead, [&](common::offset_t offset, const uint8_t* block) {
+            const auto distance = quantizedMetricFunc(queryCode, layout.getCode(block), dimension);
+            if (candidates.insert(offset, distance)) {
+                const auto blockNeighbors = DiskANNBlockLayout::getNeighbors(block);
+                neighbors[offset] = {blockNeighbors.begin(), blockNeighbors.end()};
+            }
+        });
+        offsetsToRead.clear();
+        for (const auto offset : candidates.expandNext(searchState.beamWidth)) {
+            const auto itr = neighbors.find(offset);
+            KU_ASSERT(itr != neighbors.end());
+            for (const auto nbr : itr->second) {
+                if (visited.insert(nbr).second) {
+                    offsetsToRead.push_back(nbr);
+                }
+            }
+            neighbors.erase(itr);
+        }
+    }
+    return candidates.getNodes();
+}
+
+void DiskANNIndex::rerankWithExactEmbeddings(const EmbeddingHandle& queryVector,
+    DiskANNSearchState& searchState, std::vector<NodeWithDistance>& candidates) const {
+    std::vector<NodeWithDistance> reranked;
+    reranked.reserve(candidates.size());
+    for (auto i = 0u; i < candidates.size(); i += common::DEFAULT_VECTOR_CAPACITY) {
+        const auto numCandidates =
+            std::min<uint64_t>(common::DEFAULT_VECTOR_CAPACITY, candidates.size() - i);
+        common::offset_vec_t offsets;
+        offsets.reserve(numCandidates);
+        for (auto j = 0u; j < numCandidates; j++) {
+            if (searchState.isMasked(candidates[i + j].nodeOffset)) {
+                offsets.push_back(candidates[i + j].nodeOffset);
+            }
+        }
+        const auto vectors =
+            searchState.embeddings->getEmbeddings(offsets, searchState.embeddingScanState);
+        for (auto j = 0u; j < offsets.size(); j++) {
+            if (vectors[j].isNull()) {
+                continue; // Skip null or deleted values.
+            }
+            const auto dist = metricFunc(queryVector.getPtr(), vectors[j].getPtr(),
+                searchState.embeddings->getDimension());
+            reranked.emplace_back(offsets[j], dist);
+        }
+    }
+    candidates = std::move(reranked);
+}
+
+void DiskANNIndex::searchFromUnIndexed(Transaction* transaction,
+    const EmbeddingHandle& queryVector, DiskANNSearchState& searchState,
+    std::vector<NodeWithDistance>& result) const {
+    const auto numTotalRows = nodeTable.getNumTotalRows(transaction);
+    const auto& diskANNStorageInfo = storageInfo->constCast<DiskANNStorageInfo>();
+    for (auto offset = diskANNStorageInfo.numIndexedNodes; offset < numTotalRows; offset++) {
+        if (!searchState.isMasked(offset)) {
+            continue;
+        }
+        const auto vector =
+            searchState.embeddings->getEmbedding(offset, searchState.embeddingScanState);
+        if (vector.isNull()) {
+            continue; // Skip null or deleted values.
+        }
+        auto dist = metricFunc(queryVector.getPtr(), vector.getPtr(),
+            searchState.embeddings->getDimension());
+        result.emplace_back(offset, dist);
+    }
+}
+
+std::vector<NodeWithDistance> DiskANNIndex::search(Transaction* transaction,
+    const EmbeddingHandle& queryVector, DiskANNSearchState& searchState) const {
+    std::vector<NodeWithDistance> result;
+    if (storageInfo->constCast<DiskANNStorageInfo>().entryPoint != common::INVALID_OFFSET) {
+        // The graph is traversed on the codes stored in the blocks, and the candidates are then
+        // re-ranked with the exact embeddings.
+        QuantizedQueryVector queryCode{queryVector, typeInfo.getChildType(),
+            typeInfo.getNumElements()};
+        result = beamSearch(queryCode.code.data(), searchState);
+        rerankWithExactEmbeddings(queryVector, searchState, result);
+    }
+    searchFromUnIndexed(transaction, queryVector, searchState, result);
+    std::ranges::sort(result, [](const NodeWithDistance& l, const NodeWithDistance& r) {
+        return l.distance < r.distance;
+    });
+    if (result.size() > searchState.k) {
+        result.resize(searchState.k);
+    }
+    return result;
+}
+
+void DiskANNIndex::checkpoint(main::ClientContext* context, PageAllocator& pageAllocator) {
+    blocksPageRangeBeforeCheckpoint.reset();
+    if (!hasUnflushedBlocks) {
+        return;
+    }
+    auto& diskANNStorageInfo = storageInfo->cast<DiskANNStorageInfo>();
+    blocksPageRangeBeforeCheckpoint = diskANNStorageInfo.blocksPageRange;
+    if (diskANNStorageInfo.blocksPageRange.startPageIdx != common::INVALID_PAGE_IDX) {
+        pageAllocator.freePageRange(diskANNStorageInfo.blocksPageRange);
+    }
+    diskANNStorageInfo.blocksPageRange =
+        inMemBlocks->flush(pageAllocator, StorageManager::Get(*context)->getShadowFile());
+    hasUnflushedBlocks = false;
+}
+
+void DiskANNIndex::rollbackCheckpoint() {
+    if (!blocksPageRangeBeforeCheckpoint.has_value()) {
+        return;
+    }
+    storageInfo->cast<DiskANNStorageInfo>().blocksPageRange = *blocksPageRangeBeforeCheckpoint;
+    blocksPageRangeBeforeCheckpoint.reset();
+    hasUnflushedBlocks = true;
+}
+
+} // namespace vector_extension
+} // namespace ryu
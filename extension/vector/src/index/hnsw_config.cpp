@@ -48,6 +48,13 @@ void Metric::validate(const std::string& metric) {
     }
 }
 
+void Quantization::validate(const std::string& quantization) {
+    const auto lowerCaseQuantization = common::StringUtils::getLower(quantization);
+    if (lowerCaseQuantization != "none" && lowerCaseQuantization != "int8") {
+        throw common::BinderException{"Quantization must be one of NONE or INT8."};
+    }
+}
+
 void Efc::validate(int64_t value) {
     if (value < 1) {
         throw common::BinderException{"Efc must be a positive integer."};
@@ -73,6 +80,12 @@ void BlindSearchUpSelThreshold::validate(double value) {
     }
 }
 
+void BeamWidth::validate(int64_t value) {
+    if (value < 1) {
+        throw common::BinderException{"Beam width must be a positive integer."};
+    }
+}
+
 void DirectedSearchUpSelThreshold::validate(double value) {
     if (value < 0 || value > 1) {
         throw common::BinderException{
@@ -100,6 +113,11 @@ HNSWIndexConfig::HNSWIndexConfig(const function::optional_params_t& optionalPara
             auto funcName = value.getValue<std::string>();
             Metric::validate(funcName);
             metric = getMetricType(funcName);
+        } else if (Quantization::NAME == lowerCaseName) {
+            value.validateType(Quantization::TYPE);
+            auto quantizationName = value.getValue<std::string>();
+            Quantization::validate(quantizationName);
+            quantization = getQuantizationType(quantizationName);
         } else if (Alpha::NAME == lowerCaseName) {
             value.validateType(Alpha::TYPE);
             alpha = value.getValue<double>();
@@ -145,6 +163,21 @@ std::string HNSWIndexConfig::metricToString(MetricType metric) {
     }
 }
 
+std::string HNSWIndexConfig::quantizationToString(QuantizationType quantization) {
+    switch (quantization) {
+    case QuantizationType::NONE: {
+        return "none";
+    }
+    case QuantizationType::INT8: {
+        return "int8";
+    }
+    default: {
+        throw common::RuntimeException(common::stringFormat("Unknown quantization type {}.",
+            static_cast<int64_t>(quantization)));
+    }
+    }
+}
+
 void HNSWIndexConfig::serialize(common::Serializer& ser) const {
     ser.writeDebuggingInfo("degreeInUpperLayer");
     ser.serializeValue(mu);
@@ -156,6 +189,8 @@ void HNSWIndexConfig::serialize(common::Serializer& ser) const {
     ser.serializeValue(alpha);
     ser.writeDebuggingInfo("efc");
     ser.serializeValue(efc);
+    ser.writeDebuggingInfo("quantization");
+    ser.serializeValue<uint8_t>(static_cast<uint8_t>(quantization));
 }
 
 HNSWIndexConfig HNSWIndexConfig::deserialize(common::Deserializer& deSer) {
@@ -173,6 +208,10 @@ HNSWIndexConfig HNSWIndexConfig::deserialize(common::Deserializer& deSer) {
     deSer.deserializeValue(config.alpha);
     deSer.validateDebuggingInfo(debuggingInfo, "efc");
     deSer.deserializeValue(config.efc);
+    deSer.validateDebuggingInfo(debuggingInfo, "quantization");
+    uint8_t quantization = 0;
+    deSer.deserializeValue(quantization);
+    config.quantization = static_cast<QuantizationType>(quantization);
     return config;
 }
 
@@ -193,6 +232,17 @@ MetricType HNSWIndexConfig::getMetricType(const std::string& metricName) {
     KU_UNREACHABLE;
 }
 
+QuantizationType HNSWIndexConfig::getQuantizationType(const std::string& quantizationName) {
+    const auto lowerQuantizationName = common::StringUtils::getLower(quantizationName);
+    if (lowerQuantizationName == "none") {
+        return QuantizationType::NONE;
+    }
+    if (lowerQuantizationName == "int8") {
+        return QuantizationType::INT8;
+    }
+    KU_UNREACHABLE;
+}
+
 DropHNSWConfig::DropHNSWConfig(const function::optional_params_t& optionalParams) {
     for (auto& [name, value] : optionalParams) {
         auto lowerCaseName = common::StringUtils::getLower(name);
@@ -223,6 +273,10 @@ QueryHNSWConfig::QueryHNSWConfig(const function::optional_params_t& optionalPara
             value.validateType(DirectedSearchUpSelThreshold::TYPE);
             directedSearchUpSelThreshold = value.getValue<double>();
             DirectedSearchUpSelThreshold::validate(directedSearchUpSelThreshold);
+        } else if (BeamWidth::NAME == lowerCaseName) {
+            value.validateType(BeamWidth::TYPE);
+            beamWidth = value.getValue<int64_t>();
+            BeamWidth::validate(beamWidth);
         } else {
             throw common::BinderException{common::stringFormat(
                 "Unrecognized optional parameter {} in {}.", name, QueryVectorIndexFunction::name)};
@@ -329,19 +329,14 @@ compressed_offsets_t CompressedNodeOffsetBuffer::getNeighbors(common::offset_t n
 
 InMemHNSWGraph::InMemHNSWGraph(MemoryManager* mm, common::offset_t numNodes,
     common::length_t maxDegree)
-    : numNodes{numNodes}, dstNodes(mm, numNodes, maxDegree), maxDegree{maxDegree} {
+    : numNodes{numNodes}, dstNodes(mm, numNodes, maxDegree), maxDegree{maxDegree},
+      numNbrListLocks{std::min(std::bit_ceil(std::max<uint64_t>(numNodes, 1)),
+          MAX_NUM_NBR_LIST_LOCKS)},
+      nbrListLocks{std::make_unique<NbrListLock[]>(numNbrListLocks)} {
+    // The buffer is zero-initialized, so all csr lengths start at 0.
     csrLengthBuffer = mm->allocateBuffer(true, numNodes * sizeof(std::atomic<uint16_t>));
     csrLengths = reinterpret_cast<std::atomic<uint16_t>*>(csrLengthBuffer->getData());
-    resetCSRLengthAndDstNodes();
-}
-
-void InMemHNSWGraph::resetCSRLengthAndDstNodes() {
-    for (common::offset_t i = 0; i < numNodes; i++) {
-        setCSRLength(i, 0);
-    }
-    for (common::offset_t i = 0; i < numNodes * maxDegree; i++) {
-        setDstNodeInvalid(i);
-    }
+    dstNodes.setAllNodeOffsetsToInvalid();
 }
 
 NodeToHNSWGraphOffsetMap::NodeToHNSWGraphOffsetMap(common::offset_t numNodesInTable,
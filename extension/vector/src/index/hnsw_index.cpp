@@ -4,6 +4,11 @@
 #include "catalog/hnsw_index_catalog_entry.h"
 #include "function/hnsw_index_functions.h"
 #include "index/hnsw_rel_batch_insert.h"
+#include "common/serializer/buffered_file.h"
+#include "common/serializer/in_mem_file_writer.h"
+#include "common/task_system/task_scheduler.h"
+#include "main/client_context.h"
+#include "processor/execution_context.h"
 #include "storage/storage_manager.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
@@ -98,11 +103,13 @@ common::offset_t InMemHNSWLayer::searchNN(const EmbeddingHandle& queryVector,
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const function.
 void InMemHNSWLayer::insertRel(common::offset_t srcNode, common::offset_t dstNode,
     GetEmbeddingsScanState& scanState) {
-    const auto currentLen = graph->incrementCSRLength(srcNode);
     KU_ASSERT(srcNode < info.numNodes);
+    std::lock_guard lck{graph->getNbrListLock(srcNode)};
+    const auto currentLen = graph->getCSRLength(srcNode);
     graph->setDstNode(srcNode * info.degreeThresholdToShrink + currentLen, dstNode);
-    if (currentLen == info.degreeThresholdToShrink - 1) {
-        shrinkForNode(info, graph.get(), srcNode, currentLen, scanState);
+    graph->setCSRLength(srcNode, currentLen + 1);
+    if (currentLen + 1 == info.degreeThresholdToShrink) {
+        shrinkForNode(info, graph.get(), srcNode, currentLen + 1, scanState);
     }
 }
 
@@ -347,6 +354,11 @@ InMemHNSWIndex::InMemHNSWIndex(const main::ClientContext* context, IndexInfo ind
         InMemHNSWLayerInfo{upperLayerSelectionMask->countNulls(), embeddings.get(),
             this->metricFunc, getDegreeThresholdToShrink(this->config.mu), this->config.mu,
             this->config.alpha, this->config.efc, *upperGraphSelectionMap});
+    if (this->config.quantization != QuantizationType::NONE) {
+        quantizedStore = std::make_unique<QuantizedEmbeddingStore>(MemoryManager::Get(*context),
+            typeInfo.getNumElements());
+        quantizedStore->resize(numNodes);
+    }
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const function.
@@ -375,6 +387,17 @@ void InMemHNSWIndex::finalizeNodeGroup(common::node_group_idx_t nodeGroupIdx) {
         *scanState);
     lowerLayer->finalizeNodeGroup(nodeGroupIdx, numNodesInTable, *lowerGraphSelectionMap,
         *scanState);
+    if (quantizedStore) {
+        const auto startOffset = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+        const auto endOffset =
+            std::min(numNodesInTable, startOffset + common::StorageConfig::NODE_GROUP_SIZE);
+        for (auto offset = startOffset; offset < endOffset; offset++) {
+            const auto embedding = embeddings->getEmbedding(offset, *scanState);
+            if (!embedding.isNull()) {
+                quantizedStore->set(offset, embedding.getPtr(), typeInfo.getChildType());
+            }
+        }
+    }
 }
 
 std::shared_ptr<common::BufferWriter> HNSWStorageInfo::serialize() const {
@@ -385,6 +408,8 @@ std::shared_ptr<common::BufferWriter> HNSWStorageInfo::serialize() const {
     serializer.write<common::offset_t>(upperEntryPoint);
     serializer.write<common::offset_t>(lowerEntryPoint);
     serializer.write<common::offset_t>(numCheckpointedNodes);
+    serializer.write<common::page_idx_t>(quantizedCodesPageRange.startPageIdx);
+    serializer.write<common::page_idx_t>(quantizedCodesPageRange.numPages);
     return bufferWriter;
 }
 
@@ -401,8 +426,11 @@ std::unique_ptr<IndexStorageInfo> HNSWStorageInfo::deserialize(
     deSer.deserializeValue<common::offset_t>(upperEntryPoint);
     deSer.deserializeValue<common::offset_t>(lowerEntryPoint);
     deSer.deserializeValue<common::offset_t>(checkpointedNodeOffset);
+    PageRange quantizedCodesPageRange;
+    deSer.deserializeValue<common::page_idx_t>(quantizedCodesPageRange.startPageIdx);
+    deSer.deserializeValue<common::page_idx_t>(quantizedCodesPageRange.numPages);
     return std::make_unique<HNSWStorageInfo>(upperRelTableID, lowerRelTableID, upperEntryPoint,
-        lowerEntryPoint, checkpointedNodeOffset);
+        lowerEntryPoint, checkpointedNodeOffset, quantizedCodesPageRange);
 }
 
 HNSWSearchState::HNSWSearchState(main::ClientContext* context,
@@ -451,13 +479,15 @@ OnDiskHNSWIndex::HNSWInsertState::HNSWInsertState(main::ClientContext* context,
 }
 
 OnDiskHNSWIndex::OnDiskHNSWIndex(const main::ClientContext* context, IndexInfo indexInfo,
-    std::unique_ptr<IndexStorageInfo> storageInfo, HNSWIndexConfig config)
+    std::unique_ptr<IndexStorageInfo> storageInfo, HNSWIndexConfig config,
+    std::unique_ptr<QuantizedEmbeddingStore> quantizedStore)
     : HNSWIndex{indexInfo, std::move(storageInfo), std::move(config),
           getArrayTypeInfo(
               StorageManager::Get(*context)->getTable(indexInfo.tableID)->cast<NodeTable>(),
               indexInfo.columnIDs[0])},
       mm{MemoryManager::Get(*context)},
-      nodeTable{StorageManager::Get(*context)->getTable(indexInfo.tableID)->cast<NodeTable>()} {
+      nodeTable{StorageManager::Get(*context)->getTable(indexInfo.tableID)->cast<NodeTable>()},
+      quantizedStore{std::move(quantizedStore)}, numTombstones{0} {
     KU_ASSERT(this->indexInfo.columnIDs.size() == 1);
     KU_ASSERT(nodeTable.getColumn(this->indexInfo.columnIDs[0]).getDataType().getLogicalTypeID() ==
               common::LogicalTypeID::ARRAY);
@@ -465,10 +495,17 @@ OnDiskHNSWIndex::OnDiskHNSWIndex(const main::ClientContext* context, IndexInfo i
     const auto& hnswStorageInfo = this->storageInfo->cast<HNSWStorageInfo>();
     lowerRelTable = storageManager->getTable(hnswStorageInfo.lowerRelTableID)->ptrCast<RelTable>();
     upperRelTable = storageManager->getTable(hnswStorageInfo.upperRelTableID)->ptrCast<RelTable>();
+    if (this->config.quantization != QuantizationType::NONE) {
+        quantizedMetricFunc = ScalarQuantizer::getMetricsFunction(this->config.metric);
+        if (!this->quantizedStore) {
+            this->quantizedStore =
+                std::make_unique<QuantizedEmbeddingStore>(mm, typeInfo.getNumElements());
+        }
+    }
 }
 
-std::unique_ptr<Index> OnDiskHNSWIndex::load(main::ClientContext* context, StorageManager*,
-    IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
+std::unique_ptr<Index> OnDiskHNSWIndex::load(main::ClientContext* context,
+    StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer) {
     auto reader =
         std::make_unique<common::BufferReader>(storageInfoBuffer.data(), storageInfoBuffer.size());
     auto storageInfo = HNSWStorageInfo::deserialize(std::move(reader));
@@ -476,18 +513,167 @@ std::unique_ptr<Index> OnDiskHNSWIndex::load(main::ClientContext* context, Stora
     const auto transaction = Transaction::Get(*context);
     const auto indexEntry = catalog->getIndex(transaction, indexInfo.tableID, indexInfo.name);
     const auto auxInfo = indexEntry->getAuxInfo().cast<HNSWIndexAuxInfo>();
-    return std::make_unique<OnDiskHNSWIndex>(context, std::move(indexInfo), std::move(storageInfo),
-        auxInfo.config.copy());
+    if (auxInfo.config.quantization == QuantizationType::NONE) {
+        return std::make_unique<OnDiskHNSWIndex>(context, std::move(indexInfo),
+            std::move(storageInfo), auxInfo.config.copy());
+    }
+    const auto codesPageRange = storageInfo->cast<HNSWStorageInfo>().quantizedCodesPageRange;
+    std::unique_ptr<QuantizedEmbeddingStore> quantizedStore;
+    if (codesPageRange.startPageIdx != common::INVALID_PAGE_IDX) {
+        auto fileReader = std::make_unique<common::BufferedFileReader>(
+            *storageManager->getDataFH()->getFileInfo());
+        fileReader->resetReadOffset(codesPageRange.startPageIdx * common::RYU_PAGE_SIZE);
+        common::Deserializer deSer{std::move(fileReader)};
+        quantizedStore = QuantizedEmbeddingStore::deserialize(deSer, MemoryManager::Get(*context));
+    }
+    auto index = std::make_unique<OnDiskHNSWIndex>(context, std::move(indexInfo),
+        std::move(storageInfo), auxInfo.config.copy(), std::move(quantizedStore));
+    if (codesPageRange.startPageIdx == common::INVALID_PAGE_IDX) {
+        // The codes were never checkpointed (e.g. the database was closed before the first
+        // checkpoint after index creation). Rebuild them from the embedding column.
+        const auto numCheckpointedNodes =
+            index->storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes;
+        index->quantizeEmbeddings(transaction, 0 /* startOffset */, numCheckpointedNodes);
+    }
+    return index;
 }
 
 std::vector<NodeWithDistance> OnDiskHNSWIndex::search(Transaction* transaction,
     const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
-    auto result = searchFromCheckpointed(transaction, queryVector, searchState);
+    initQuantizedSearchState(transaction, searchState);
+    std::vector<NodeWithDistance> result;
+    if (shouldSearchBruteForce(transaction, searchState)) {
+        searchState.searchType = SearchType::BRUTE_FORCE;
+        result = searchBruteForce(queryVector, searchState);
+    } else if (searchState.isQuantized()) {
+        QuantizedQueryVector quantizedQuery{queryVector, typeInfo.getChildType(),
+            typeInfo.getNumElements()};
+        const EmbeddingHandle quantizedQueryVector{0, &quantizedQuery};
+        result = searchFromCheckpointed(transaction, quantizedQueryVector, searchState);
+        rerankWithExactEmbeddings(queryVector, searchState, result);
+    } else {
+        result = searchFromCheckpointed(transaction, queryVector, searchState);
+    }
     searchFromUnCheckpointed(transaction, queryVector, searchState, result);
     result.resize(searchState.k);
     return result;
 }
 
+bool OnDiskHNSWIndex::shouldSearchBruteForce(Transaction* transaction,
+    const HNSWSearchState& searchState) const {
+    if (!searchState.hasMask()) {
+        return false;
+    }
+    const auto numNodes = searchState.lowerGraph->getNumNodes(transaction);
+    const auto numMaskedNodes = searchState.semiMask->getNumMaskedNodes();
+    if (numNodes == 0 || numMaskedNodes == 0) {
+        return true;
+    }
+    const auto selectivity = 1.0 * numMaskedNodes / numNodes;
+    // A graph search computes distances to about ef * ml nodes before it converges. Under a filter
+    // it has to check 1 / selectivity times more neighbors to find as many masked ones.
+    const auto numDistanceComputations =
+        std::min<double>(numMaskedNodes, searchState.ef * config.ml);
+    const auto numNbrChecks = std::min<double>(numNodes, searchState.ef * config.ml / selectivity);
+    const auto graphSearchCost = numDistanceComputations + numNbrChecks * NBR_CHECK_COST;
+    return numMaskedNodes <= graphSearchCost;
+}
+
+std::vector<NodeWithDistance> OnDiskHNSWIndex::searchBruteForce(
+    const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
+    // Nodes that are not in the graph yet are searched by searchFromUnCheckpointed.
+    const auto numCheckpointedNodes = storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes;
+    const auto maskedOffsets =
+        searchState.semiMask->collectMaskedNodes(searchState.semiMask->getNumMaskedNodes());
+    max_node_priority_queue_t results;
+    common::offset_vec_t offsets;
+    offsets.reserve(common::DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < maskedOffsets.size(); i += common::DEFAULT_VECTOR_CAPACITY) {
+        offsets.clear();
+        const auto numOffsets =
+            std::min<uint64_t>(common::DEFAULT_VECTOR_CAPACITY, maskedOffsets.size() - i);
+        for (auto j = 0u; j < numOffsets; j++) {
+            if (maskedOffsets[i + j] < numCheckpointedNodes) {
+                offsets.push_back(maskedOffsets[i + j]);
+            }
+        }
+        const auto vectors =
+            searchState.embeddings->getEmbeddings(offsets, searchState.embeddingScanState);
+        for (auto j = 0u; j < offsets.size(); j++) {
+            if (vectors[j].isNull()) {
+                continue; // Skip null or deleted values.
+            }
+            const auto dist = metricFunc(queryVector.getPtr(), vectors[j].getPtr(),
+                searchState.embeddings->getDimension());
+            if (results.size() < searchState.k) {
+                results.push({offsets[j], dist});
+            } else if (dist < results.top().distance) {
+                results.pop();
+                results.push({offsets[j], dist});
+            }
+        }
+    }
+    return popTopK(results, searchState.k);
+}
+
+void OnDiskHNSWIndex::initQuantizedSearchState(const Transaction* transaction,
+    HNSWSearchState& searchState) const {
+    if (!quantizedStore || searchState.isQuantized()) {
+        return;
+    }
+    searchState.quantizedEmbeddings = std::make_unique<QuantizedEmbeddings>(transaction,
+        common::ArrayTypeInfo{typeInfo.getChildType().copy(), typeInfo.getNumElements()},
+        nodeTable, *quantizedStore);
+    searchState.quantizedScanState = searchState.quantizedEmbeddings->constructScanState();
+}
+
+void OnDiskHNSWIndex::rerankWithExactEmbeddings(const EmbeddingHandle& queryVector,
+    HNSWSearchState& searchState, std::vector<NodeWithDistance>& candidates) const {
+    std::vector<NodeWithDistance> reranked;
+    reranked.reserve(candidates.size());
+    for (auto i = 0u; i < candidates.size(); i += common::DEFAULT_VECTOR_CAPACITY) {
+        const auto numCandidates =
+            std::min<uint64_t>(common::DEFAULT_VECTOR_CAPACITY, candidates.size() - i);
+        common::offset_vec_t offsets;
+        offsets.reserve(numCandidates);
+        for (auto j = 0u; j < numCandidates; j++) {
+            offsets.push_back(candidates[i + j].nodeOffset);
+        }
+        const auto vectors =
+            searchState.embeddings->getEmbeddings(offsets, searchState.embeddingScanState);
+        for (auto j = 0u; j < numCandidates; j++) {
+            if (vectors[j].isNull()) {
+                continue;
+            }
+            const auto dist = metricFunc(queryVector.getPtr(), vectors[j].getPtr(),
+                searchState.embeddings->getDimension());
+            reranked.emplace_back(offsets[j], dist);
+        }
+    }
+    std::ranges::sort(reranked, [](const NodeWithDistance& l, const NodeWithDistance& r) {
+        return l.distance < r.distance;
+    });
+    candidates = std::move(reranked);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const function.
+void OnDiskHNSWIndex::quantizeEmbeddings(Transaction* transaction, common::offset_t startOffset,
+    common::offset_t endOffset) {
+    KU_ASSERT(quantizedStore);
+    const OnDiskEmbeddings embeddings{transaction, mm,
+        common::ArrayTypeInfo{typeInfo.getChildType().copy(), typeInfo.getNumElements()},
+        nodeTable, indexInfo.columnIDs[0]};
+    OnDiskEmbeddingScanState scanState{transaction, mm, nodeTable, indexInfo.columnIDs[0],
+        typeInfo.getNumElements()};
+    quantizedStore->resize(endOffset);
+    for (auto offset = startOffset; offset < endOffset; offset++) {
+        const auto vector = embeddings.getEmbedding(offset, scanState);
+        if (!vector.isNull()) {
+            quantizedStore->set(offset, vector.getPtr(), typeInfo.getChildType());
+        }
+    }
+}
+
 std::vector<NodeWithDistance> OnDiskHNSWIndex::searchFromCheckpointed(Transaction* transaction,
     const EmbeddingHandle& queryVector, HNSWSearchState& searchState) const {
     auto entryPoint = searchNNInUpperLayer(queryVector, searchState);
@@ -499,7 +685,10 @@ std::vector<NodeWithDistance> OnDiskHNSWIndex::searchFromCheckpointed(Transactio
         }
         entryPoint = hnswStorageInfo.lowerEntryPoint;
     }
-    return searchKNNInLayer(transaction, queryVector, entryPoint, searchState, false);
+    // When traversing on quantized codes, keep ef candidates so that re-ranking with the exact
+    // embeddings can recover the ones that quantization placed out of the top k.
+    const auto k = searchState.isQuantized() ? searchState.ef : searchState.k;
+    return searchKNNInLayer(transaction, queryVector, entryPoint, searchState, false, k);
 }
 
 void OnDiskHNSWIndex::searchFromUnCheckpointed(Transaction* transaction,
@@ -550,8 +739,10 @@ std::unique_ptr<Index::InsertState> OnDiskHNSWIndex::initInsertState(main::Clien
     auto transaction = Transaction::Get(*context);
     auto [nodeTableEntry, upperRelTableEntry, lowerRelTableEntry] =
         getIndexTableCatalogEntries(catalog::Catalog::Get(*context), transaction, indexInfo);
-    return std::make_unique<HNSWInsertState>(context, nodeTableEntry, upperRelTableEntry,
-        lowerRelTableEntry, nodeTable, indexInfo.columnIDs[0], config.ml);
+    auto insertState = std::make_unique<HNSWInsertState>(context, nodeTableEntry,
+        upperRelTableEntry, lowerRelTableEntry, nodeTable, indexInfo.columnIDs[0], config.ml);
+    initQuantizedSearchState(transaction, insertState->searchState);
+    return insertState;
 }
 
 class CommitInsertEmbeddingScanState final : public GetEmbeddingsScanState {
@@ -588,6 +779,9 @@ void OnDiskHNSWIndex::commitInsert(Transaction* transaction,
     KU_ASSERT(dataVectors.size() == 1);
     KU_ASSERT(nodeIDVector.state->getSelSize() == dataVectors[0]->state->getSelSize());
     auto& hnswInsertState = insertState.cast<HNSWInsertState>();
+    if (shouldCompactTombstones()) {
+        compactTombstones(transaction, hnswInsertState);
+    }
     auto commitInsertScanState = std::make_unique<CommitInsertEmbeddingScanState>(dataVectors[0]);
     for (size_t i = 0; i < nodeIDVector.state->getSelSize(); ++i) {
         auto pos = nodeIDVector.state->getSelVector()[i];
@@ -617,14 +811,30 @@ void OnDiskHNSWIndex::finalize(main::ClientContext* context) {
         indexInfo.columnIDs[0], embeddingDim);
     const auto insertState = std::make_unique<HNSWInsertState>(context, nodeTableEntry,
         upperRelTableEntry, lowerRelTableEntry, nodeTable, indexInfo.columnIDs[0], config.ml);
+    initQuantizedSearchState(transaction, insertState->searchState);
+    if (shouldCompactTombstones()) {
+        compactTombstones(transaction, *insertState);
+    }
+    auto offset = hnswStorageInfo.numCheckpointedNodes;
+    // Small appends, and the first nodes of the graph, are inserted one node at a time.
+    const auto sequentialEndOffset =
+        numTotalRows - offset < INSERTION_BATCH_MERGE_THRESHOLD ?
+            numTotalRows :
+            std::clamp<common::offset_t>(INSERTION_BATCH_MERGE_THRESHOLD, offset, numTotalRows);
     // TODO(Guodong): Perhaps should switch to scan instead of lookup here.
-    for (auto offset = hnswStorageInfo.numCheckpointedNodes; offset < numTotalRows; offset++) {
+    for (; offset < sequentialEndOffset; offset++) {
         const auto vector = insertState->searchState.embeddings->getEmbedding(offset, *scanState);
         if (vector.isNull()) {
             continue;
         }
         insertInternal(transaction, offset, vector, *insertState);
     }
+    while (offset < numTotalRows) {
+        const auto batchSize =
+            std::min<common::offset_t>({offset, MAX_INSERTION_BATCH_SIZE, numTotalRows - offset});
+        batchInsert(context, offset, offset + batchSize, *insertState);
+        offset += batchSize;
+    }
     for (const auto offset : insertState->upperNodesToShrink) {
         shrinkForNode(transaction, offset, true, config.mu, *insertState);
     }
@@ -634,16 +844,140 @@ void OnDiskHNSWIndex::finalize(main::ClientContext* context) {
     hnswStorageInfo.numCheckpointedNodes = numTotalRows;
 }
 
+void OnDiskHNSWIndex::delete_(Transaction* /*transaction*/,
+    const common::ValueVector& nodeIDVector, DeleteState& /*deleteState*/) {
+    const auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    for (auto i = 0u; i < nodeIDVector.state->getSelSize(); i++) {
+        const auto pos = nodeIDVector.state->getSelVector()[i];
+        if (nodeIDVector.isNull(pos)) {
+            continue;
+        }
+        // Nodes that are not in the graph yet are skipped by the brute force search anyway.
+        if (nodeIDVector.readNodeOffset(pos) < hnswStorageInfo.numCheckpointedNodes) {
+            numTombstones++;
+        }
+    }
+}
+
+bool OnDiskHNSWIndex::shouldCompactTombstones() const {
+    const auto numIndexedNodes = storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes;
+    return numTombstones > 0 &&
+           static_cast<double>(numTombstones) >= TOMBSTONE_RATIO_TO_COMPACT * numIndexedNodes;
+}
+
+void OnDiskHNSWIndex::compactTombstones(Transaction* transaction, HNSWInsertState& insertState) {
+    const auto numNodes = storageInfo->cast<HNSWStorageInfo>().numCheckpointedNodes;
+    std::vector<bool> isTombstone(numNodes);
+    for (auto offset = 0u; offset < numNodes; offset++) {
+        isTombstone[offset] = !nodeTable.isVisible(transaction, offset);
+    }
+    compactLayer(transaction, isTombstone, true /*isUpperLayer*/, insertState);
+    compactLayer(transaction, isTombstone, false /*isUpperLayer*/, insertState);
+    numTombstones = 0;
+}
+
+void OnDiskHNSWIndex::compactLayer(Transaction* transaction, const std::vector<bool>& isTombstone,
+    bool isUpperLayer, HNSWInsertState& insertState) {
+    const auto isDeleted = [&](common::offset_t offset) {
+        return offset < isTombstone.size() && isTombstone[offset];
+    };
+    const auto maxDegree = isUpperLayer ? config.mu : config.ml;
+    for (auto offset = 0u; offset < isTombstone.size(); offset++) {
+        if (isTombstone[offset]) {
+            continue;
+        }
+        const auto nbrOffsets = getNbrOffsets(offset, isUpperLayer, insertState.searchState);
+        if (std::ranges::none_of(nbrOffsets, isDeleted)) {
+            continue;
+        }
+        // Deleted neighbors are replaced by their own live neighbors before pruning.
+        std::vector<common::offset_t> candidates;
+        for (const auto nbr : nbrOffsets) {
+            if (!isDeleted(nbr)) {
+                candidates.push_back(nbr);
+                continue;
+            }
+            for (const auto secondHopNbr :
+                getNbrOffsets(nbr, isUpperLayer, insertState.searchState)) {
+                if (secondHopNbr != offset && !isDeleted(secondHopNbr)) {
+                    candidates.push_back(secondHopNbr);
+                }
+            }
+        }
+        std::ranges::sort(candidates);
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        rewriteRels(transaction, offset, candidates, isUpperLayer, maxDegree, insertState);
+    }
+    auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    auto& entryPoint =
+        isUpperLayer ? hnswStorageInfo.upperEntryPoint : hnswStorageInfo.lowerEntryPoint;
+    if (isDeleted(entryPoint)) {
+        // Move the entry point to a live neighbor. If there is none, the deleted entry point keeps
+        // its rels to route searches.
+        for (const auto nbr : getNbrOffsets(entryPoint, isUpperLayer, insertState.searchState)) {
+            if (!isDeleted(nbr)) {
+                entryPoint = nbr;
+                break;
+            }
+        }
+    }
+    auto& relTable = isUpperLayer ? *upperRelTable : *lowerRelTable;
+    insertState.relDeleteState->detachDeleteDirection = common::RelDataDirection::FWD;
+    for (auto offset = 0u; offset < isTombstone.size(); offset++) {
+        if (!isTombstone[offset] || offset == entryPoint) {
+            continue;
+        }
+        insertState.relDeleteState->srcNodeIDVector.setValue(0,
+            common::nodeID_t{offset, indexInfo.tableID});
+        relTable.detachDelete(transaction, insertState.relDeleteState.get());
+    }
+}
+
 void OnDiskHNSWIndex::checkpoint(main::ClientContext* context,
     storage::PageAllocator& pageAllocator) {
+    quantizedCodesPageRangeBeforeCheckpoint.reset();
     auto [nodeTableEntry, upperRelTableEntry, lowerRelTableEntry] = getIndexTableCatalogEntries(
         catalog::Catalog::Get(*context), &DUMMY_CHECKPOINT_TRANSACTION, indexInfo);
     upperRelTable->checkpoint(context, upperRelTableEntry, pageAllocator);
     lowerRelTable->checkpoint(context, lowerRelTableEntry, pageAllocator);
+    if (quantizedStore && quantizedStore->hasChanges()) {
+        auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+        quantizedCodesPageRangeBeforeCheckpoint = hnswStorageInfo.quantizedCodesPageRange;
+        if (hnswStorageInfo.quantizedCodesPageRange.startPageIdx != common::INVALID_PAGE_IDX) {
+            pageAllocator.freePageRange(hnswStorageInfo.quantizedCodesPageRange);
+        }
+        const auto writer = std::make_shared<common::InMemFileWriter>(*mm);
+        common::Serializer ser{writer};
+        quantizedStore->serialize(ser);
+        hnswStorageInfo.quantizedCodesPageRange =
+            writer->flush(pageAllocator, StorageManager::Get(*context)->getShadowFile());
+        quantizedStore->resetChanges();
+    }
+}
+
+void OnDiskHNSWIndex::rollbackCheckpoint() {
+    if (!quantizedCodesPageRangeBeforeCheckpoint.has_value()) {
+        return;
+    }
+    storageInfo->cast<HNSWStorageInfo>().quantizedCodesPageRange =
+        *quantizedCodesPageRangeBeforeCheckpoint;
+    quantizedCodesPageRangeBeforeCheckpoint.reset();
+    quantizedStore->setChanges();
 }
 
 void OnDiskHNSWIndex::insertInternal(Transaction* transaction, common::offset_t offset,
-    const EmbeddingHandle& vector, HNSWInsertState& insertState) {
+    const EmbeddingHandle& exactVector, HNSWInsertState& insertState) {
+    std::unique_ptr<QuantizedQueryVector> quantizedVector;
+    auto quantizedHandle = EmbeddingHandle::createNullHandle();
+    if (insertState.searchState.isQuantized()) {
+        // The new node's code is stored first, so that it can be compared with its neighbors
+        // when shrinking them.
+        quantizedStore->set(offset, exactVector.getPtr(), typeInfo.getChildType());
+        quantizedVector = std::make_unique<QuantizedQueryVector>(exactVector,
+            typeInfo.getChildType(), typeInfo.getNumElements());
+        quantizedHandle = EmbeddingHandle{0, quantizedVector.get()};
+    }
+    const auto& vector = quantizedVector ? quantizedHandle : exactVector;
     // Search fow lower layer entry point.
     const auto entryPoint = searchNNInUpperLayer(vector, insertState.searchState);
     insertToLayer(transaction, offset, entryPoint, vector, insertState, false /*isUpperLayer*/);
@@ -656,6 +990,113 @@ void OnDiskHNSWIndex::insertInternal(Transaction* transaction, common::offset_t
     }
 }
 
+// Runs the same search function on every thread registered to the task.
+class HNSWBatchSearchTask final : public common::Task {
+public:
+    HNSWBatchSearchTask(uint64_t maxNumThreads, std::function<void()> searchFunc)
+        : Task{maxNumThreads}, searchFunc{std::move(searchFunc)} {}
+
+    void run() override { searchFunc(); }
+
+private:
+    std::function<void()> searchFunc;
+};
+
+struct BatchInsertNbrs {
+    bool isNull = true;
+    std::vector<NodeWithDistance> lowerNbrs;
+    std::vector<NodeWithDistance> upperNbrs;
+};
+
+void OnDiskHNSWIndex::batchInsert(main::ClientContext* context, common::offset_t startOffset,
+    common::offset_t endOffset, HNSWInsertState& insertState) {
+    static constexpr uint64_t SEARCH_MORSEL_SIZE = 64;
+    const auto transaction = Transaction::Get(*context);
+    if (insertState.searchState.isQuantized()) {
+        // Codes of the batch are stored up front, so that threads only read from the store.
+        quantizeEmbeddings(transaction, startOffset, endOffset);
+    }
+    const auto numNodes = endOffset - startOffset;
+    // Upper layer memberships are drawn up front, as the random engine is not thread-safe.
+    std::vector<bool> insertToUpperLayer(numNodes);
+    for (auto i = 0u; i < numNodes; i++) {
+        const auto rand = randomEngine.nextRandomInteger(INSERT_TO_UPPER_LAYER_RAND_UPPER_BOUND);
+        insertToUpperLayer[i] = rand <= INSERT_TO_UPPER_LAYER_RAND_UPPER_BOUND * config.pu;
+    }
+    auto [nodeTableEntry, upperRelTableEntry, lowerRelTableEntry] =
+        getIndexTableCatalogEntries(catalog::Catalog::Get(*context), transaction, indexInfo);
+    const auto numTotalRows = nodeTable.getNumTotalRows(transaction);
+    const auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    std::vector<BatchInsertNbrs> batchNbrs(numNodes);
+    std::atomic<common::offset_t> nextOffset{startOffset};
+    auto searchFunc = [&]() {
+        HNSWSearchState searchState{context, nodeTableEntry, upperRelTableEntry,
+            lowerRelTableEntry, nodeTable, indexInfo.columnIDs[0], numTotalRows, config.ml,
+            QueryHNSWConfig{}};
+        initQuantizedSearchState(transaction, searchState);
+        // Inserted vectors are read with their own scan state, as the search state's one is
+        // reused while traversing the graph.
+        OnDiskEmbeddingScanState scanState{transaction, mm, nodeTable, indexInfo.columnIDs[0],
+            typeInfo.getNumElements()};
+        while (true) {
+            const auto morselStartOffset = nextOffset.fetch_add(SEARCH_MORSEL_SIZE);
+            if (morselStartOffset >= endOffset) {
+                break;
+            }
+            const auto morselEndOffset =
+                std::min(morselStartOffset + SEARCH_MORSEL_SIZE, endOffset);
+            for (auto offset = morselStartOffset; offset < morselEndOffset; offset++) {
+                const auto exactVector = searchState.embeddings->getEmbedding(offset, scanState);
+                if (exactVector.isNull()) {
+                    continue;
+                }
+                auto& nbrs = batchNbrs[offset - startOffset];
+                nbrs.isNull = false;
+                std::unique_ptr<QuantizedQueryVector> quantizedVector;
+                auto quantizedHandle = EmbeddingHandle::createNullHandle();
+                if (searchState.isQuantized()) {
+                    quantizedVector = std::make_unique<QuantizedQueryVector>(exactVector,
+                        typeInfo.getChildType(), typeInfo.getNumElements());
+                    quantizedHandle = EmbeddingHandle{0, quantizedVector.get()};
+                }
+                const auto& vector = quantizedVector ? quantizedHandle : exactVector;
+                auto entryPoint = searchNNInUpperLayer(vector, searchState);
+                if (entryPoint == common::INVALID_OFFSET) {
+                    entryPoint = hnswStorageInfo.lowerEntryPoint;
+                }
+                if (entryPoint != common::INVALID_OFFSET) {
+                    nbrs.lowerNbrs = searchKNNInLayer(transaction, vector, entryPoint,
+                        searchState, false /*isUpperLayer*/, searchState.k);
+                }
+                if (insertToUpperLayer[offset - startOffset] &&
+                    hnswStorageInfo.upperEntryPoint != common::INVALID_OFFSET) {
+                    nbrs.upperNbrs = searchKNNInLayer(transaction, vector,
+                        hnswStorageInfo.upperEntryPoint, searchState, true /*isUpperLayer*/,
+                        searchState.k);
+                }
+            }
+        }
+    };
+    const auto task =
+        std::make_shared<HNSWBatchSearchTask>(context->getMaxNumThreadForExec(), searchFunc);
+    processor::ExecutionContext executionContext{nullptr /*profiler*/, context, 0 /*queryID*/};
+    common::TaskScheduler::Get(*context)->scheduleTaskAndWaitOrError(task, &executionContext,
+        true /* launchNewWorkerThread */);
+    // Rel tables are not thread-safe to insert into, so the rels are created sequentially.
+    for (auto i = 0u; i < numNodes; i++) {
+        if (batchNbrs[i].isNull) {
+            continue;
+        }
+        const auto offset = startOffset + i;
+        linkToNbrs(transaction, offset, batchNbrs[i].lowerNbrs, insertState,
+            false /*isUpperLayer*/);
+        if (insertToUpperLayer[i]) {
+            linkToNbrs(transaction, offset, batchNbrs[i].upperNbrs, insertState,
+                true /*isUpperLayer*/);
+        }
+    }
+}
+
 common::offset_t OnDiskHNSWIndex::searchNNInUpperLayer(const EmbeddingHandle& queryVector,
     HNSWSearchState& searchState) const {
     const auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
@@ -665,8 +1106,8 @@ common::offset_t OnDiskHNSWIndex::searchNNInUpperLayer(const EmbeddingHandle& qu
     }
     double lastMinDist = std::numeric_limits<float>::max();
     const auto& embeddings = searchState.embeddings;
-    const auto currNodeVector =
-        embeddings->getEmbedding(currentNodeOffset, searchState.embeddingScanState);
+    const auto& metricFunc = getSearchMetricFunc(searchState);
+    const auto currNodeVector = searchState.getSearchEmbedding(currentNodeOffset);
     double minDist = 0.0;
     if (!currNodeVector.isNull()) {
         minDist =
@@ -681,8 +1122,7 @@ common::offset_t OnDiskHNSWIndex::searchNNInUpperLayer(const EmbeddingHandle& qu
         for (const auto neighborChunk : neighborItr) {
             neighborChunk.forEach([&](auto neighbors, auto, auto i) {
                 auto neighbor = neighbors[i];
-                const auto nbrVector =
-                    embeddings->getEmbedding(neighbor.offset, searchState.embeddingScanState);
+                const auto nbrVector = searchState.getSearchEmbedding(neighbor.offset);
                 if (!nbrVector.isNull()) {
                     const auto dist = metricFunc(queryVector.getPtr(), nbrVector.getPtr(),
                         embeddings->getDimension());
@@ -718,16 +1158,15 @@ void OnDiskHNSWIndex::initLayerSearchState(Transaction* transaction, HNSWSearchS
 
 std::vector<NodeWithDistance> OnDiskHNSWIndex::searchKNNInLayer(Transaction* transaction,
     const EmbeddingHandle& queryVector, common::offset_t entryNode, HNSWSearchState& searchState,
-    bool isUpperLayer) const {
+    bool isUpperLayer, common::length_t k) const {
     min_node_priority_queue_t candidates;
     max_node_priority_queue_t results;
     initLayerSearchState(transaction, searchState, isUpperLayer);
 
-    const auto entryVector =
-        searchState.embeddings->getEmbedding(entryNode, searchState.embeddingScanState);
+    const auto entryVector = searchState.getSearchEmbedding(entryNode);
     if (!entryVector.isNull()) {
-        auto dist = metricFunc(queryVector.getPtr(), entryVector.getPtr(),
-            searchState.embeddings->getDimension());
+        auto dist = getSearchMetricFunc(searchState)(queryVector.getPtr(),
+            entryVector.getPtr(), searchState.embeddings->getDimension());
         candidates.push({entryNode, dist});
         if (searchState.isMasked(entryNode)) {
             results.push({entryNode, dist});
@@ -766,7 +1205,7 @@ std::vector<NodeWithDistance> OnDiskHNSWIndex::searchKNNInLayer(Transaction* tra
         }
         }
     }
-    return popTopK(results, searchState.k);
+    return popTopK(results, k);
 }
 
 SearchType OnDiskHNSWIndex::getFilteredSearchType(Transaction* transaction,
@@ -799,12 +1238,12 @@ void OnDiskHNSWIndex::initSearchCandidates(const EmbeddingHandle& queryVector,
             }
             searchState.visited.add(candidate);
             const auto candidateVector =
-                searchState.embeddings->getEmbedding(candidate, searchState.embeddingScanState);
+                searchState.getSearchEmbedding(candidate);
             if (candidateVector.isNull()) {
                 continue;
             }
-            auto candidateDist = metricFunc(queryVector.getPtr(), candidateVector.getPtr(),
-                searchState.embeddings->getDimension());
+            auto candidateDist = getSearchMetricFunc(searchState)(queryVector.getPtr(),
+                candidateVector.getPtr(), searchState.embeddings->getDimension());
             candidates.push({candidate, candidateDist});
             results.push({candidate, candidateDist});
         }
@@ -822,11 +1261,10 @@ void OnDiskHNSWIndex::oneHopSearch(const EmbeddingHandle& queryVector,
         neighborChunk.forEach([&](auto neighbors, auto, auto i) {
             const auto nbr = neighbors[i];
             if (!searchState.visited.contains(nbr.offset) && searchState.isMasked(nbr.offset)) {
-                const auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                    searchState.embeddingScanState);
+                const auto nbrVector = searchState.getSearchEmbedding(nbr.offset);
                 processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, searchState.ef,
-                    searchState.visited, metricFunc, searchState.embeddings->getDimension(),
-                    candidates, results);
+                    searchState.visited, getSearchMetricFunc(searchState),
+                    searchState.embeddings->getDimension(), candidates, results);
             }
         });
     }
@@ -853,10 +1291,10 @@ min_node_priority_queue_t OnDiskHNSWIndex::collectFirstHopNbrsDirected(
             auto nbrOffset = neighbor.offset;
             if (!searchState.visited.contains(nbrOffset)) {
                 const auto nbrVector =
-                    searchState.embeddings->getEmbedding(nbrOffset, searchState.embeddingScanState);
+                    searchState.getSearchEmbedding(nbrOffset);
                 if (!nbrVector.isNull()) {
-                    auto dist = metricFunc(queryVector.getPtr(), nbrVector.getPtr(),
-                        searchState.embeddings->getDimension());
+                    auto dist = getSearchMetricFunc(searchState)(queryVector.getPtr(),
+                        nbrVector.getPtr(), searchState.embeddings->getDimension());
                     candidatesForSecHop.push({nbrOffset, dist});
                     if (searchState.isMasked(nbrOffset)) {
                         if (results.size() < searchState.ef || dist < results.top().distance) {
@@ -899,11 +1337,10 @@ common::offset_vec_t OnDiskHNSWIndex::collectFirstHopNbrsBlind(const EmbeddingHa
                 secondHopCandidates.push_back(nbr.offset);
                 if (searchState.isMasked(nbr.offset)) {
                     numVisitedNbrs++;
-                    auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                        searchState.embeddingScanState);
+                    auto nbrVector = searchState.getSearchEmbedding(nbr.offset);
                     processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, searchState.ef,
-                        searchState.visited, metricFunc, searchState.embeddings->getDimension(),
-                        candidates, results);
+                        searchState.visited, getSearchMetricFunc(searchState),
+                        searchState.embeddings->getDimension(), candidates, results);
                 }
             }
         });
@@ -927,9 +1364,21 @@ void OnDiskHNSWIndex::insertToLayer(Transaction* transaction, common::offset_t o
         entryPoint = entryPointToSet;
     }
     const auto closest = searchKNNInLayer(transaction, queryVector, entryPoint,
-        insertState.searchState, isUpperLayer);
-    createRels(transaction, offset, closest, isUpperLayer, insertState);
-    for (const auto& n : closest) {
+        insertState.searchState, isUpperLayer, insertState.searchState.k);
+    linkToNbrs(transaction, offset, closest, insertState, isUpperLayer);
+}
+
+void OnDiskHNSWIndex::linkToNbrs(Transaction* transaction, common::offset_t offset,
+    const std::vector<NodeWithDistance>& nbrs, HNSWInsertState& insertState, bool isUpperLayer) {
+    auto& hnswStorageInfo = storageInfo->cast<HNSWStorageInfo>();
+    auto& entryPoint =
+        isUpperLayer ? hnswStorageInfo.upperEntryPoint : hnswStorageInfo.lowerEntryPoint;
+    if (entryPoint == common::INVALID_OFFSET) {
+        entryPoint = offset;
+        return;
+    }
+    createRels(transaction, offset, nbrs, isUpperLayer, insertState);
+    for (const auto& n : nbrs) {
         createRels(transaction, n.nodeOffset, {{offset, std::numeric_limits<double>::max()}},
             isUpperLayer, insertState);
     }
@@ -977,11 +1426,12 @@ void OnDiskHNSWIndex::createRels(Transaction* transaction, common::offset_t offs
 
 void OnDiskHNSWIndex::shrinkForNode(Transaction* transaction, common::offset_t offset,
     bool isUpperLayer, common::length_t maxDegree, HNSWInsertState& insertState) {
-    const auto& embeddings = *insertState.searchState.embeddings;
-    auto& embeddingScanState = insertState.searchState.embeddingScanState;
-    const auto vector = embeddings.getEmbedding(offset, embeddingScanState);
-    KU_ASSERT(!vector.isNull());
-    const auto& searchState = insertState.searchState;
+    const auto nbrOffsets = getNbrOffsets(offset, isUpperLayer, insertState.searchState);
+    rewriteRels(transaction, offset, nbrOffsets, isUpperLayer, maxDegree, insertState);
+}
+
+std::vector<common::offset_t> OnDiskHNSWIndex::getNbrOffsets(common::offset_t offset,
+    bool isUpperLayer, const HNSWSearchState& searchState) const {
     const auto& graph = isUpperLayer ? searchState.upperGraph : searchState.lowerGraph;
     const auto relTableID = isUpperLayer ? storageInfo->cast<HNSWStorageInfo>().upperRelTableID :
                                            storageInfo->cast<HNSWStorageInfo>().lowerRelTableID;
@@ -1000,7 +1450,25 @@ void OnDiskHNSWIndex::shrinkForNode(Transaction* transaction, common::offset_t o
             return true;
         });
     }
+    return nbrOffsets;
+}
 
+void OnDiskHNSWIndex::rewriteRels(Transaction* transaction, common::offset_t offset,
+    const std::vector<common::offset_t>& nbrOffsets, bool isUpperLayer,
+    common::length_t maxDegree, HNSWInsertState& insertState) {
+    const auto& searchState = insertState.searchState;
+    // Neighbors are pruned with the same embeddings that are used to traverse the graph.
+    const auto& embeddings = searchState.isQuantized() ?
+                                 static_cast<const HNSWIndexEmbeddings&>(
+                                     *searchState.quantizedEmbeddings) :
+                                 *searchState.embeddings;
+    auto& embeddingScanState = searchState.isQuantized() ?
+                                   *searchState.quantizedScanState :
+                                   static_cast<GetEmbeddingsScanState&>(
+                                       insertState.searchState.embeddingScanState);
+    const auto vector = embeddings.getEmbedding(offset, embeddingScanState);
+    KU_ASSERT(!vector.isNull());
+    const auto& metricFunc = getSearchMetricFunc(searchState);
     std::vector<NodeWithDistanceAndEmbedding> nbrs;
     nbrs.reserve(nbrOffsets.size());
     {
@@ -1096,11 +1564,10 @@ bool OnDiskHNSWIndex::searchOverSecondHopNbrs(const EmbeddingHandle& queryVector
         secondHopNbrChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) -> bool {
             auto nbr = neighbors[i];
             if (!searchState.visited.contains(nbr.offset) && searchState.isMasked(nbr.offset)) {
-                auto nbrVector = searchState.embeddings->getEmbedding(nbr.offset,
-                    searchState.embeddingScanState);
+                auto nbrVector = searchState.getSearchEmbedding(nbr.offset);
                 processNbrNodeInKNNSearch(queryVector, nbrVector, nbr.offset, ef,
-                    searchState.visited, metricFunc, searchState.embeddings->getDimension(),
-                    candidates, results);
+                    searchState.visited, getSearchMetricFunc(searchState),
+                    searchState.embeddings->getDimension(), candidates, results);
                 numVisitedNbrs++;
                 if (numVisitedNbrs >= config.ml) {
                     return false;
@@ -0,0 +1,218 @@
+#include "index/hnsw_quantization.h"
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
+#include "simsimd.h"
+#include "storage/table/node_table.h"
+
+using namespace ryu::storage;
+
+namespace ryu {
+namespace vector_extension {
+
+static constexpr double MAX_CODE_VALUE = std::numeric_limits<int8_t>::max();
+
+template<VectorElementType T>
+static void encodeInternal(const T* vector, common::length_t dimension, uint8_t* code) {
+    double maxAbsValue = 0.0;
+    double squaredNorm = 0.0;
+    for (auto i = 0u; i < dimension; i++) {
+        const auto value = static_cast<double>(vector[i]);
+        maxAbsValue = std::max(maxAbsValue, std::abs(value));
+        squaredNorm += value * value;
+    }
+    const auto scale = maxAbsValue / MAX_CODE_VALUE;
+    const auto values = reinterpret_cast<int8_t*>(code + ScalarQuantizer::HEADER_SIZE);
+    for (auto i = 0u; i < dimension; i++) {
+        const auto quantized = scale == 0.0 ? 0.0 : std::round(vector[i] / scale);
+        values[i] = static_cast<int8_t>(std::clamp(quantized, -MAX_CODE_VALUE, MAX_CODE_VALUE));
+    }
+    const auto header = std::array{static_cast<float>(scale), static_cast<float>(squaredNorm)};
+    memcpy(code, header.data(), ScalarQuantizer::HEADER_SIZE);
+}
+
+void ScalarQuantizer::encode(const void* vector, const common::LogicalType& elementType,
+    common::length_t dimension, uint8_t* code) {
+    common::TypeUtils::visit(
+        elementType,
+        [&]<VectorElementType T>(T) {
+            encodeInternal<T>(static_cast<const T*>(vector), dimension, code);
+        },
+        [&](auto) { KU_UNREACHABLE; });
+}
+
+static float getScale(const void* code) {
+    float scale = 0;
+    memcpy(&scale, code, sizeof(float));
+    return scale;
+}
+
+static float getSquaredNorm(const void* code) {
+    float squaredNorm = 0;
+    memcpy(&squaredNorm, static_cast<const uint8_t*>(code) + sizeof(float), sizeof(float));
+    return squaredNorm;
+}
+
+static const simsimd_i8_t* getValues(const void* code) {
+    return reinterpret_cast<const simsimd_i8_t*>(
+        static_cast<const uint8_t*>(code) + ScalarQuantizer::HEADER_SIZE);
+}
+
+static double computeCosine(const void* left, const void* right, uint32_t dimension) {
+    // Cosine distance is invariant to the scale of each vector.
+    simsimd_distance_t distance = 0;
+    simsimd_cos_i8(getValues(left), getValues(right), dimension, &distance);
+    return distance;
+}
+
+static double computeDotProduct(const void* left, const void* right, uint32_t dimension) {
+    simsimd_distance_t distance = 0;
+    simsimd_dot_i8(getValues(left), getValues(right), dimension, &distance);
+    return static_cast<double>(getScale(left)) * getScale(right) * distance;
+}
+
+static double computeL2Square(const void* left, const void* right, uint32_t dimension) {
+    // Codes of different vectors have different scales, so expand |l - r|^2 with the exact norms.
+    const auto distance = static_cast<double>(getSquaredNorm(left)) + getSquaredNorm(right) -
+                          2 * computeDotProduct(left, right, dimension);
+    return std::max(distance, 0.0);
+}
+
+static double computeL2(const void* left, const void* right, uint32_t dimension) {
+    return std::sqrt(computeL2Square(left, right, dimension));
+}
+
+metric_func_t ScalarQuantizer::getMetricsFunction(MetricType metric) {
+    switch (metric) {
+    case MetricType::Cosine: {
+        return computeCosine;
+    }
+    case MetricType::DotProduct: {
+        return computeDotProduct;
+    }
+    case MetricType::L2: {
+        return computeL2;
+    }
+    case MetricType::L2_SQUARE: {
+        return computeL2Square;
+    }
+    default: {
+        KU_UNREACHABLE;
+    }
+    }
+}
+
+QuantizedEmbeddingStore::QuantizedEmbeddingStore(MemoryManager* mm, common::length_t dimension)
+    : mm{mm}, dimension{dimension}, codeSize{ScalarQuantizer::getCodeSize(dimension)},
+      changed{false} {}
+
+void QuantizedEmbeddingStore::appendChunksNoLock(uint64_t numChunksToAppend) {
+    for (auto i = 0u; i < numChunksToAppend; i++) {
+        auto chunk = mm->allocateBuffer(false /* initializeToZero */, CHUNK_CAPACITY * codeSize);
+        const auto data = chunk->getData();
+        for (auto j = 0u; j < CHUNK_CAPACITY; j++) {
+            memcpy(data + j * codeSize, &ScalarQuantizer::EMPTY_SCALE, sizeof(float));
+        }
+        chunks.push_back(std::move(chunk));
+    }
+}
+
+void QuantizedEmbeddingStore::resize(common::offset_t numVectors) {
+    std::unique_lock lck{mtx};
+    const auto numChunks = (numVectors + CHUNK_CAPACITY - 1) / CHUNK_CAPACITY;
+    if (numChunks > chunks.size()) {
+        appendChunksNoLock(numChunks - chunks.size());
+    }
+}
+
+void QuantizedEmbeddingStore::set(common::offset_t offset, const void* vector,
+    const common::LogicalType& elementType) {
+    const auto chunkIdx = offset / CHUNK_CAPACITY;
+    const auto offsetInChunk = (offset % CHUNK_CAPACITY) * codeSize;
+    uint8_t* code = nullptr;
+    {
+        std::shared_lock lck{mtx};
+        if (chunkIdx < chunks.size()) {
+            code = chunks[chunkIdx]->getData() + offsetInChunk;
+        }
+    }
+    if (code == nullptr) {
+        std::unique_lock lck{mtx};
+        if (chunkIdx >= chunks.size()) {
+            appendChunksNoLock(chunkIdx + 1 - chunks.size());
+        }
+        code = chunks[chunkIdx]->getData() + offsetInChunk;
+    }
+    ScalarQuantizer::encode(vector, elementType, dimension, code);
+    changed = true;
+}
+
+const uint8_t* QuantizedEmbeddingStore::getCode(common::offset_t offset) const {
+    const auto chunkIdx = offset / CHUNK_CAPACITY;
+    const uint8_t* code = nullptr;
+    {
+        std::shared_lock lck{mtx};
+        if (chunkIdx >= chunks.size()) {
+            return nullptr;
+        }
+        code = chunks[chunkIdx]->getData() + (offset % CHUNK_CAPACITY) * codeSize;
+    }
+    return getScale(code) == ScalarQuantizer::EMPTY_SCALE ? nullptr : code;
+}
+
+void QuantizedEmbeddingStore::serialize(common::Serializer& ser) const {
+    std::shared_lock lck{mtx};
+    ser.writeDebuggingInfo("dimension");
+    ser.write<common::length_t>(dimension);
+    ser.writeDebuggingInfo("num_chunks");
+    ser.write<uint64_t>(chunks.size());
+    for (const auto& chunk : chunks) {
+        ser.write(chunk->getData(), CHUNK_CAPACITY * codeSize);
+    }
+}
+
+std::unique_ptr<QuantizedEmbeddingStore> QuantizedEmbeddingStore::deserialize(
+    common::Deserializer& deSer, MemoryManager* mm) {
+    std::string key;
+    common::length_t dimension = 0;
+    uint64_t numChunks = 0;
+    deSer.validateDebuggingInfo(key, "dimension");
+    deSer.deserializeValue<common::length_t>(dimension);
+    deSer.validateDebuggingInfo(key, "num_chunks");
+    deSer.deserializeValue<uint64_t>(numChunks);
+    auto store = std::make_unique<QuantizedEmbeddingStore>(mm, dimension);
+    store->appendChunksNoLock(numChunks);
+    for (const auto& chunk : store->chunks) {
+        deSer.read(chunk->getData(), CHUNK_CAPACITY * store->codeSize);
+    }
+    return store;
+}
+
+void* QuantizedEmbeddingScanState::getEmbeddingPtr(const EmbeddingHandle& handle) {
+    KU_ASSERT(!handle.isNull());
+    const auto code = store.getCode(handle.offsetInData);
+    KU_ASSERT(code != nullptr);
+    return const_cast<uint8_t*>(code);
+}
+
+EmbeddingHandle QuantizedEmbeddings::getEmbedding(common::offset_t offset,
+    GetEmbeddingsScanState& scanState) const {
+    if (!nodeTable.isVisibleNoLock(transaction, offset) || store.getCode(offset) == nullptr) {
+        return EmbeddingHandle::createNullHandle();
+    }
+    return EmbeddingHandle{offset, &scanState};
+}
+
+std::vector<EmbeddingHandle> QuantizedEmbeddings::getEmbeddings(
+    std::span<const common::offset_t> offsets, GetEmbeddingsScanState& scanState) const {
+    std::vector<EmbeddingHandle> ret;
+    ret.reserve(offsets.size());
+    for (const auto offset : offsets) {
+        ret.push_back(getEmbedding(offset, scanState));
+    }
+    return ret;
+}
+
+} // namespace vector_extension
+} // namespace ryu
@@ -1,5 +1,6 @@
 #include "main/vector_extension.h"
 
+#include "catalog/diskann_index_catalog_entry.h"
 #include "catalog/hnsw_index_catalog_entry.h"
 #include "function/hnsw_index_functions.h"
 #include "main/client_context.h"
@@ -13,31 +14,43 @@ static void initHNSWEntries(main::ClientContext* context) {
     auto storageManager = storage::StorageManager::Get(*context);
     auto catalog = catalog::Catalog::Get(*context);
     for (auto& indexEntry : catalog->getIndexEntries(transaction::Transaction::Get(*context))) {
-        if (indexEntry->getIndexType() == HNSWIndexCatalogEntry::TYPE_NAME &&
-            !indexEntry->isLoaded()) {
+        if (indexEntry->isLoaded()) {
+            continue;
+        }
+        if (indexEntry->getIndexType() == HNSWIndexCatalogEntry::TYPE_NAME) {
             indexEntry->setAuxInfo(HNSWIndexAuxInfo::deserialize(indexEntry->getAuxBufferReader()));
-            // Should load the index in storage side as well.
-            auto& nodeTable =
-                storageManager->getTable(indexEntry->getTableID())->cast<storage::NodeTable>();
-            auto optionalIndex = nodeTable.getIndexHolder(indexEntry->getIndexName());
-            KU_ASSERT_UNCONDITIONAL(
-                optionalIndex.has_value() && !optionalIndex.value().get().isLoaded());
-            auto& unloadedIndex = optionalIndex.value().get();
-            unloadedIndex.load(context, storageManager);
+        } else if (indexEntry->getIndexType() == DiskANNIndexCatalogEntry::TYPE_NAME) {
+            indexEntry->setAuxInfo(
+                DiskANNIndexAuxInfo::deserialize(indexEntry->getAuxBufferReader()));
+        } else {
+            continue;
         }
+        // Should load the index in storage side as well.
+        auto& nodeTable =
+            storageManager->getTable(indexEntry->getTableID())->cast<storage::NodeTable>();
+        auto optionalIndex = nodeTable.getIndexHolder(indexEntry->getIndexName());
+        KU_ASSERT_UNCONDITIONAL(
+            optionalIndex.has_value() && !optionalIndex.value().get().isLoaded());
+        auto& unloadedIndex = optionalIndex.value().get();
+        unloadedIndex.load(context, storageManager);
     }
 }
 
 void VectorExtension::load(main::ClientContext* context) {
     auto& db = *context->getDatabase();
     extension::ExtensionUtils::addTableFunc<QueryVectorIndexFunction>(db);
+    extension::ExtensionUtils::addTableFunc<QueryVectorIndexBatchFunction>(db);
     extension::ExtensionUtils::addInternalStandaloneTableFunc<InternalCreateHNSWIndexFunction>(db);
     extension::ExtensionUtils::addInternalStandaloneTableFunc<InternalFinalizeHNSWIndexFunction>(
         db);
     extension::ExtensionUtils::addStandaloneTableFunc<CreateVectorIndexFunction>(db);
     extension::ExtensionUtils::addInternalStandaloneTableFunc<InternalDropHNSWIndexFunction>(db);
     extension::ExtensionUtils::addStandaloneTableFunc<DropVectorIndexFunction>(db);
+    extension::ExtensionUtils::addInternalStandaloneTableFunc<InternalCreateDiskANNIndexFunction>(
+        db);
+    extension::ExtensionUtils::addStandaloneTableFunc<CreateDiskANNIndexFunction>(db);
     extension::ExtensionUtils::registerIndexType(db, OnDiskHNSWIndex::getIndexType());
+    extension::ExtensionUtils::registerIndexType(db, DiskANNIndex::getIndexType());
     initHNSWEntries(context);
 }
 
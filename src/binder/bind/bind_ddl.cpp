@@ -12,6 +12,7 @@
 #include "common/exception/binder.h"
 #include "common/exception/message.h"
 #include "common/string_format.h"
+#include "common/string_utils.h"
 #include "common/system_config.h"
 #include "common/types/types.h"
 #include "function/cast/functions/cast_from_string_functions.h"
@@ -176,6 +177,44 @@ static ExtendDirection getStorageDirection(const case_insensitive_map_t<Value>&
     return DEFAULT_EXTEND_DIRECTION;
 }
 
+// Rels are compared on the physical values of the sort property, so only types whose order matches
+// the order of their integer values are allowed.
+static bool canSortRelsBy(const LogicalType& type) {
+    if (LogicalTypeUtils::isDate(type) || LogicalTypeUtils::isTimestamp(type)) {
+        return true;
+    }
+    return LogicalTypeUtils::isIntegral(type) && type.getPhysicalType() != PhysicalTypeID::INT128 &&
+           type.getPhysicalType() != PhysicalTypeID::UINT128;
+}
+
+static std::string getSortPropertyName(const case_insensitive_map_t<Value>& options,
+    const std::vector<PropertyDefinition>& propertyDefinitions, const std::string& tableName) {
+    if (!options.contains(TableOptionConstants::REL_SORT_BY_OPTION)) {
+        return "";
+    }
+    auto& option = options.at(TableOptionConstants::REL_SORT_BY_OPTION);
+    if (option.isNull() || option.getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+        throw BinderException(stringFormat("{} option expects a property name.",
+            TableOptionConstants::REL_SORT_BY_OPTION));
+    }
+    auto propertyName = option.getValue<std::string>();
+    for (auto& definition : propertyDefinitions) {
+        if (!StringUtils::caseInsensitiveEquals(definition.getName(), propertyName) ||
+            definition.getName() == InternalKeyword::ID) {
+            continue;
+        }
+        if (!canSortRelsBy(definition.getType())) {
+            throw BinderException(
+                stringFormat("Cannot sort rels of table {} by property {} of type {}. Only "
+                             "integer, date and timestamp properties can be used as sort property.",
+                    tableName, definition.getName(), definition.getType().toString()));
+        }
+        return definition.getName();
+    }
+    throw BinderException(
+        stringFormat("Table {} doesn't have a property with name {}.", tableName, propertyName));
+}
+
 std::vector<PropertyDefinition> Binder::bindRelPropertyDefinitions(const CreateTableInfo& info) {
     std::vector<PropertyDefinition> propertyDefinitions;
     propertyDefinitions.emplace_back(
@@ -193,6 +232,7 @@ BoundCreateTableInfo Binder::bindCreateRelTableGroupInfo(const CreateTableInfo*
     auto dstMultiplicity = RelMultiplicityUtils::getBwd(extraInfo.relMultiplicity);
     auto boundOptions = bindParsingOptions(extraInfo.options);
     auto storageDirection = getStorageDirection(boundOptions);
+    auto sortPropertyName = getSortPropertyName(boundOptions, propertyDefinitions, info->tableName);
     // Bind from to pairs
     node_table_id_pair_set_t nodePairsSet;
     std::vector<NodeTableIDPair> nodePairs;
@@ -211,7 +251,8 @@ BoundCreateTableInfo Binder::bindCreateRelTableGroupInfo(const CreateTableInfo*
     }
     auto boundExtraInfo =
         std::make_unique<BoundExtraCreateRelTableGroupInfo>(std::move(propertyDefinitions),
-            srcMultiplicity, dstMultiplicity, storageDirection, std::move(nodePairs));
+            srcMultiplicity, dstMultiplicity, storageDirection, std::move(nodePairs),
+            std::move(sortPropertyName));
     return BoundCreateTableInfo(CatalogEntryType::REL_GROUP_ENTRY, info->tableName,
         info->onConflict, std::move(boundExtraInfo), clientContext->useInternalCatalogEntry());
 }
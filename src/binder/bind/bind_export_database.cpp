@@ -118,6 +118,21 @@ static std::vector<ExportedTableData> getExportInfo(const Catalog& catalog,
     return exportData;
 }
 
+static uint64_t getParallelism(case_insensitive_map_t<Value>& options) {
+    if (!options.contains(PortDBConstants::PARALLELISM_OPTION)) {
+        return PortDBConstants::DEFAULT_PARALLELISM;
+    }
+    auto& value = options.at(PortDBConstants::PARALLELISM_OPTION);
+    if (value.getDataType().getLogicalTypeID() != LogicalTypeID::INT64 ||
+        value.getValue<int64_t>() <= 0) {
+        throw BinderException(stringFormat("The '{}' option must be a positive integer.",
+            PortDBConstants::PARALLELISM_OPTION));
+    }
+    const auto parallelism = value.getValue<int64_t>();
+    options.erase(PortDBConstants::PARALLELISM_OPTION);
+    return parallelism;
+}
+
 static bool schemaOnly(case_insensitive_map_t<Value>& parsedOptions,
     const parser::ExportDB& exportDB) {
     auto isSchemaOnlyOption = [](const std::pair<std::string, Value>& option) -> bool {
@@ -146,6 +161,7 @@ std::unique_ptr<BoundStatement> Binder::bindExportDatabaseClause(const Statement
     auto& exportDB = statement.constCast<ExportDB>();
     auto parsedOptions = bindParsingOptions(exportDB.getParsingOptionsRef());
     auto fileTypeInfo = getFileType(parsedOptions);
+    auto parallelism = getParallelism(parsedOptions);
     switch (fileTypeInfo.fileType) {
     case FileType::CSV:
     case FileType::PARQUET:
@@ -162,7 +178,7 @@ std::unique_ptr<BoundStatement> Binder::bindExportDatabaseClause(const Statement
     auto boundFilePath = VirtualFileSystem::GetUnsafe(*clientContext)
                              ->expandPath(clientContext, exportDB.getFilePath());
     return std::make_unique<BoundExportDatabase>(boundFilePath, fileTypeInfo, std::move(exportData),
-        std::move(parsedOptions), exportSchemaOnly);
+        std::move(parsedOptions), exportSchemaOnly, parallelism);
 }
 
 } // namespace binder
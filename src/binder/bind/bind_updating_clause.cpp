@@ -13,6 +13,7 @@
 #include "common/assert.h"
 #include "common/exception/binder.h"
 #include "common/string_format.h"
+#include "common/string_utils.h"
 #include "parser/query/updating_clause/delete_clause.h"
 #include "parser/query/updating_clause/insert_clause.h"
 #include "parser/query/updating_clause/merge_clause.h"
@@ -327,6 +328,18 @@ BoundSetPropertyInfo Binder::bindSetPropertyInfo(const ParsedExpression* column,
         }
         return BoundSetPropertyInfo(TableType::NODE, expr, boundColumn, boundColumnData);
     }
+    // Check sort property constraint
+    for (auto entry : nodeOrRel.getEntries()) {
+        auto& relGroupEntry = entry->constCast<RelGroupCatalogEntry>();
+        if (relGroupEntry.hasSortProperty() &&
+            StringUtils::caseInsensitiveEquals(relGroupEntry.getSortPropertyName(),
+                property.getPropertyName())) {
+            throw BinderException(
+                stringFormat("Cannot set property {} in table {} because it is used as sort "
+                             "property. Try delete and then insert.",
+                    property.getPropertyName(), entry->getName()));
+        }
+    }
     return BoundSetPropertyInfo(TableType::REL, expr, boundColumn, boundColumnData);
 }
 
@@ -1,5 +1,6 @@
 #include "binder/binder.h"
 #include "binder/copy/bound_copy_from.h"
+#include "binder/expression/literal_expression.h"
 #include "catalog/catalog.h"
 #include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
@@ -143,6 +144,51 @@ BoundCopyFromInfo Binder::bindCopyNodeFromInfo(std::string tableName,
         std::move(columns), std::move(evaluateTypes), nullptr /* extraInfo */);
 }
 
+static bool bindUpdateOnConflict(const Expression& expr) {
+    if (expr.expressionType == ExpressionType::LITERAL &&
+        expr.getDataType().getLogicalTypeID() == LogicalTypeID::STRING) {
+        const auto action = StringUtils::getUpper(
+            expr.constCast<LiteralExpression>().getValue().getValue<std::string>());
+        if (action == "UPDATE") {
+            return true;
+        }
+        if (action == "ERROR") {
+            return false;
+        }
+    }
+    throw BinderException(stringFormat("The value of {} must be either 'ERROR' or 'UPDATE'.",
+        CopyConstants::ON_CONFLICT_OPTION_NAME));
+}
+
+static std::string bindClusterByProperty(const Expression& expr,
+    const NodeTableCatalogEntry& nodeTableEntry) {
+    if (expr.expressionType != ExpressionType::LITERAL ||
+        expr.getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+        throw BinderException(stringFormat("The value of {} must be a property name.",
+            CopyConstants::CLUSTER_BY_OPTION_NAME));
+    }
+    const auto propertyName =
+        expr.constCast<LiteralExpression>().getValue().getValue<std::string>();
+    if (!nodeTableEntry.containsProperty(propertyName)) {
+        throw BinderException(stringFormat("Cannot cluster by {}, which is not a property of {}.",
+            propertyName, nodeTableEntry.getName()));
+    }
+    return propertyName;
+}
+
+// Rows are sorted by the source column as it is read, so the key has to be one of the columns of
+// the source rather than a default value.
+static std::shared_ptr<Expression> findClusterKey(const expression_vector& sourceColumns,
+    const std::string& propertyName) {
+    for (auto& column : sourceColumns) {
+        if (column->toString() == propertyName) {
+            return column;
+        }
+    }
+    throw BinderException(
+        stringFormat("Cannot cluster by {}, which is not a column of the source.", propertyName));
+}
+
 std::unique_ptr<BoundStatement> Binder::bindCopyNodeFrom(const Statement& statement,
     NodeTableCatalogEntry& nodeTableEntry) {
     auto& copyStatement = statement.constCast<CopyFrom>();
@@ -161,10 +207,35 @@ std::unique_ptr<BoundStatement> Binder::bindCopyNodeFrom(const Statement& statem
     std::vector<LogicalType> expectedColumnTypes;
     bindExpectedNodeColumns(nodeTableEntry, copyStatement.getCopyColumnInfo(), expectedColumnNames,
         expectedColumnTypes);
-    auto boundCopyFromInfo =
-        bindCopyNodeFromInfo(nodeTableEntry.getName(), nodeTableEntry.getProperties(),
-            copyStatement.getSource(), copyStatement.getParsingOptions(), expectedColumnNames,
-            expectedColumnTypes, copyStatement.byColumn());
+    options_t scanSourceOptions;
+    std::optional<bool> updateOnConflict;
+    std::optional<std::string> clusterByProperty;
+    for (auto& option : copyStatement.getParsingOptions()) {
+        if (StringUtils::caseInsensitiveEquals(option.first,
+                CopyConstants::ON_CONFLICT_OPTION_NAME)) {
+            const auto expr = expressionBinder.bindExpression(*option.second);
+            updateOnConflict = bindUpdateOnConflict(*expr);
+            continue;
+        }
+        if (StringUtils::caseInsensitiveEquals(option.first,
+                CopyConstants::CLUSTER_BY_OPTION_NAME)) {
+            clusterByProperty = bindClusterByProperty(
+                *expressionBinder.bindExpression(*option.second), nodeTableEntry);
+            continue;
+        }
+        scanSourceOptions.emplace(option.first, option.second->copy());
+    }
+    auto boundCopyFromInfo = bindCopyNodeFromInfo(nodeTableEntry.getName(),
+        nodeTableEntry.getProperties(), copyStatement.getSource(), scanSourceOptions,
+        expectedColumnNames, expectedColumnTypes, copyStatement.byColumn());
+    std::shared_ptr<Expression> clusterKey;
+    if (clusterByProperty.has_value()) {
+        clusterKey = findClusterKey(boundCopyFromInfo.source->getColumns(), *clusterByProperty);
+    }
+    if (updateOnConflict.has_value() || clusterKey) {
+        boundCopyFromInfo.extraInfo = std::make_unique<ExtraBoundCopyNodeInfo>(
+            updateOnConflict.value_or(false), std::move(clusterKey));
+    }
     return std::make_unique<BoundCopyFrom>(std::move(boundCopyFromInfo));
 }
 
@@ -1,4 +1,5 @@
 #include "binder/binder.h"
+#include "binder/expression/expression_util.h"
 #include "binder/query/reading_clause/bound_match_clause.h"
 #include "common/exception/binder.h"
 #include "parser/query/reading_clause/match_clause.h"
@@ -119,7 +120,90 @@ void Binder::rewriteMatchPattern(BoundGraphPattern& boundGraphPattern) {
             }
         }
     }
-    boundGraphPattern.where = std::move(where);
+    boundGraphPattern.where = inferTransitivePredicates(std::move(where));
+}
+
+static bool isConstantComparisonOperand(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::LITERAL:
+    case ExpressionType::PARAMETER:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Adds the predicates implied by equalities between properties, so that comparisons with constants
+// reach the scans on both sides of a join. E.g. a.x = b.y AND a.x > 100 implies b.y > 100. The
+// inferred predicates are implied by the predicate, so adding them doesn't change its result.
+std::shared_ptr<Expression> Binder::inferTransitivePredicates(std::shared_ptr<Expression> where) {
+    if (where == nullptr) {
+        return where;
+    }
+    auto predicates = where->splitOnAND();
+    // Properties of the same type which are compared for equality form an equivalence class.
+    expression_map<std::shared_ptr<expression_vector>> equivalenceClasses;
+    for (auto& predicate : predicates) {
+        if (predicate->expressionType != ExpressionType::EQUALS) {
+            continue;
+        }
+        auto left = predicate->getChild(0);
+        auto right = predicate->getChild(1);
+        if (left->expressionType != ExpressionType::PROPERTY ||
+            right->expressionType != ExpressionType::PROPERTY ||
+            left->getDataType() != right->getDataType() || *left == *right) {
+            continue;
+        }
+        for (auto& property : {left, right}) {
+            if (!equivalenceClasses.contains(property)) {
+                equivalenceClasses.emplace(property,
+                    std::make_shared<expression_vector>(expression_vector{property}));
+            }
+        }
+        auto leftClass = equivalenceClasses.at(left);
+        auto rightClass = equivalenceClasses.at(right);
+        if (leftClass == rightClass) {
+            continue;
+        }
+        for (auto& property : *rightClass) {
+            leftClass->push_back(property);
+            equivalenceClasses[property] = leftClass;
+        }
+    }
+    if (equivalenceClasses.empty()) {
+        return where;
+    }
+    expression_set existingPredicates{predicates.begin(), predicates.end()};
+    expression_vector inferredPredicates;
+    for (auto& predicate : predicates) {
+        if (!ExpressionTypeUtil::isComparison(predicate->expressionType)) {
+            continue;
+        }
+        auto comparisonType = predicate->expressionType;
+        auto property = predicate->getChild(0);
+        auto constant = predicate->getChild(1);
+        if (isConstantComparisonOperand(*property)) {
+            std::swap(property, constant);
+            comparisonType = ExpressionTypeUtil::reverseComparisonDirection(comparisonType);
+        }
+        if (!isConstantComparisonOperand(*constant) || !equivalenceClasses.contains(property)) {
+            continue;
+        }
+        for (auto& equivalentProperty : *equivalenceClasses.at(property)) {
+            if (*equivalentProperty == *property) {
+                continue;
+            }
+            auto inferredPredicate = expressionBinder.bindComparisonExpression(comparisonType,
+                expression_vector{equivalentProperty, constant});
+            if (existingPredicates.insert(inferredPredicate).second) {
+                inferredPredicates.push_back(std::move(inferredPredicate));
+            }
+        }
+    }
+    for (auto& predicate : inferredPredicates) {
+        where = expressionBinder.combineBooleanExpressions(ExpressionType::AND, where, predicate);
+    }
+    return where;
 }
 
 } // namespace binder
@@ -1,3 +1,4 @@
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/scalar_function_expression.h"
 #include "binder/expression_binder.h"
 #include "function/boolean/vector_boolean_functions.h"
@@ -15,7 +16,27 @@ std::shared_ptr<Expression> ExpressionBinder::bindBooleanExpression(
     for (auto i = 0u; i < parsedExpression.getNumChildren(); ++i) {
         children.push_back(bindExpression(*parsedExpression.getChild(i)));
     }
-    return bindBooleanExpression(parsedExpression.getExpressionType(), children);
+    auto expressionType = parsedExpression.getExpressionType();
+    auto expression = bindBooleanExpression(expressionType, children);
+    // A false operand decides an AND and a true operand decides an OR, even if the other operand
+    // is NULL, so the other operand does not need to be evaluated.
+    if (expressionType == ExpressionType::AND || expressionType == ExpressionType::OR) {
+        auto decidingValue = expressionType == ExpressionType::OR;
+        for (auto& child : expression->getChildren()) {
+            if (child->expressionType != ExpressionType::LITERAL) {
+                continue;
+            }
+            auto value = child->constCast<LiteralExpression>().getValue();
+            if (value.getDataType().getLogicalTypeID() == LogicalTypeID::BOOL && !value.isNull() &&
+                value.getValue<bool>() == decidingValue) {
+                // Like folding, keep the original string to avoid an identifier conflict.
+                auto result = createLiteralExpression(Value(decidingValue));
+                result->setAlias(expression->toString());
+                return result;
+            }
+        }
+    }
+    return expression;
 }
 
 std::shared_ptr<Expression> ExpressionBinder::bindBooleanExpression(ExpressionType expressionType,
@@ -9,6 +9,7 @@
 #include "binder/expression/subquery_expression.h"
 #include "common/exception/not_implemented.h"
 #include "function/arithmetic/vector_arithmetic_functions.h"
+#include "function/date/vector_date_functions.h"
 #include "function/sequence/sequence_functions.h"
 #include "function/uuid/vector_uuid_functions.h"
 
@@ -200,6 +201,28 @@ bool ExpressionVisitor::isRandom(const Expression& expression) {
     return false;
 }
 
+bool ExpressionVisitor::isNonDeterministicFunction(const std::string& functionName) {
+    return functionName == function::RandFunction::name ||
+           functionName == function::GenRandomUUIDFunction::name ||
+           functionName == function::NextValFunction::name ||
+           functionName == function::CurrentTimestampFunction::name ||
+           functionName == function::CurrentDateFunction::name;
+}
+
+bool ExpressionVisitor::isNonDeterministic(const Expression& expression) {
+    if (expression.expressionType == ExpressionType::FUNCTION &&
+        isNonDeterministicFunction(
+            expression.constCast<ScalarFunctionExpression>().getFunction().name)) {
+        return true;
+    }
+    for (auto& child : ExpressionChildrenCollector::collectChildren(expression)) {
+        if (isNonDeterministic(*child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void DependentVarNameCollector::visitSubqueryExpr(std::shared_ptr<Expression> expr) {
     auto& subqueryExpr = expr->constCast<SubqueryExpression>();
     for (auto& node : subqueryExpr.getQueryGraphCollection()->getQueryNodes()) {
@@ -252,30 +275,34 @@ void PropertyExprCollector::visitNodeRelExpr(std::shared_ptr<Expression> expr) {
 }
 
 bool ConstantExpressionVisitor::needFold(const Expression& expr) {
-    if (expr.expressionType == common::ExpressionType::LITERAL) {
-        return false; // No need to fold a literal.
+    switch (expr.expressionType) {
+    case ExpressionType::LITERAL:
+    case ExpressionType::PARAMETER:
+        return false; // No need to fold a literal or a single parameter.
+    default:
+        return isConstant(expr, true /* allowParameter */);
     }
-    return isConstant(expr);
 }
 
-bool ConstantExpressionVisitor::isConstant(const Expression& expr) {
+bool ConstantExpressionVisitor::isConstant(const Expression& expr, bool allowParameter) {
     switch (expr.expressionType) {
     case ExpressionType::LITERAL:
         return true;
+    case ExpressionType::PARAMETER:
+        return allowParameter;
     case ExpressionType::AGGREGATE_FUNCTION:
     case ExpressionType::PROPERTY:
     case ExpressionType::VARIABLE:
     case ExpressionType::PATH:
     case ExpressionType::PATTERN:
-    case ExpressionType::PARAMETER:
     case ExpressionType::SUBQUERY:
     case ExpressionType::GRAPH:
     case ExpressionType::LAMBDA:
         return false;
     case ExpressionType::FUNCTION:
-        return visitFunction(expr);
+        return visitFunction(expr, allowParameter);
     case ExpressionType::CASE_ELSE:
-        return visitCase(expr);
+        return visitCase(expr, allowParameter);
     case ExpressionType::OR:
     case ExpressionType::XOR:
     case ExpressionType::AND:
@@ -288,7 +315,7 @@ bool ConstantExpressionVisitor::isConstant(const Expression& expr) {
     case ExpressionType::LESS_THAN_EQUALS:
     case ExpressionType::IS_NULL:
     case ExpressionType::IS_NOT_NULL:
-        return visitChildren(expr);
+        return visitChildren(expr, allowParameter);
         // LCOV_EXCL_START
     default:
         throw NotImplementedException("ConstantExpressionVisitor::isConstant");
@@ -296,7 +323,7 @@ bool ConstantExpressionVisitor::isConstant(const Expression& expr) {
     }
 }
 
-bool ConstantExpressionVisitor::visitFunction(const Expression& expr) {
+bool ConstantExpressionVisitor::visitFunction(const Expression& expr, bool allowParameter) {
     auto& funcExpr = expr.constCast<ScalarFunctionExpression>();
     if (funcExpr.getFunction().name == function::NextValFunction::name) {
         return false;
@@ -307,26 +334,26 @@ bool ConstantExpressionVisitor::visitFunction(const Expression& expr) {
     if (funcExpr.getFunction().name == function::RandFunction::name) {
         return false;
     }
-    return visitChildren(expr);
+    return visitChildren(expr, allowParameter);
 }
 
-bool ConstantExpressionVisitor::visitCase(const Expression& expr) {
+bool ConstantExpressionVisitor::visitCase(const Expression& expr, bool allowParameter) {
     auto& caseExpr = expr.constCast<CaseExpression>();
     for (auto i = 0u; i < caseExpr.getNumCaseAlternatives(); ++i) {
         auto caseAlternative = caseExpr.getCaseAlternative(i);
-        if (!isConstant(*caseAlternative->whenExpression)) {
+        if (!isConstant(*caseAlternative->whenExpression, allowParameter)) {
             return false;
         }
-        if (!isConstant(*caseAlternative->thenExpression)) {
+        if (!isConstant(*caseAlternative->thenExpression, allowParameter)) {
             return false;
         }
     }
-    return isConstant(*caseExpr.getElseExpression());
+    return isConstant(*caseExpr.getElseExpression(), allowParameter);
 }
 
-bool ConstantExpressionVisitor::visitChildren(const Expression& expr) {
+bool ConstantExpressionVisitor::visitChildren(const Expression& expr, bool allowParameter) {
     for (auto& child : expr.getChildren()) {
-        if (!isConstant(*child)) {
+        if (!isConstant(*child, allowParameter)) {
             return false;
         }
     }
@@ -96,6 +96,8 @@ ryu_state ryu_connection_prepare(ryu_connection* connection, const char* query,
         out_prepared_statement->_prepared_statement = prepared_statement;
         out_prepared_statement->_bound_values =
             new std::unordered_map<std::string, std::unique_ptr<Value>>;
+        out_prepared_statement->_batched_values =
+            new std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>>;
         return RyuSuccess;
     } catch (Exception& e) {
         return RyuError;
@@ -140,6 +142,39 @@ ryu_state ryu_connection_execute(ryu_connection* connection,
         return RyuError;
     }
 }
+
+ryu_state ryu_connection_execute_batch(ryu_connection* connection,
+    ryu_prepared_statement* prepared_statement, ryu_query_result* out_query_result) {
+    if (connection == nullptr || connection->_connection == nullptr ||
+        prepared_statement == nullptr || prepared_statement->_prepared_statement == nullptr ||
+        prepared_statement->_batched_values == nullptr) {
+        return RyuError;
+    }
+    try {
+        auto prepared_statement_ptr =
+            static_cast<PreparedStatement*>(prepared_statement->_prepared_statement);
+        auto batched_values =
+            static_cast<std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>>*>(
+                prepared_statement->_batched_values);
+        auto batch = std::move(*batched_values);
+        batched_values->clear();
+        auto query_result = static_cast<Connection*>(connection->_connection)
+                                ->executeBatch(prepared_statement_ptr, std::move(batch))
+                                .release();
+        if (query_result == nullptr) {
+            return RyuError;
+        }
+        out_query_result->_query_result = query_result;
+        out_query_result->_is_owned_by_cpp = false;
+        if (!query_result->isSuccess()) {
+            return RyuError;
+        }
+        return RyuSuccess;
+    } catch (Exception& e) {
+        return RyuError;
+    }
+}
+
 void ryu_connection_interrupt(ryu_connection* connection) {
     static_cast<Connection*>(connection->_connection)->interrupt();
 }
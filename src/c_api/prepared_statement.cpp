@@ -26,6 +26,10 @@ void ryu_prepared_statement_destroy(ryu_prepared_statement* prepared_statement)
         delete static_cast<std::unordered_map<std::string, std::unique_ptr<Value>>*>(
             prepared_statement->_bound_values);
     }
+    if (prepared_statement->_batched_values != nullptr) {
+        delete static_cast<std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>>*>(
+            prepared_statement->_batched_values);
+    }
 }
 
 bool ryu_prepared_statement_is_success(ryu_prepared_statement* prepared_statement) {
@@ -261,3 +265,21 @@ ryu_state ryu_prepared_statement_bind_value(ryu_prepared_statement* prepared_sta
         return RyuError;
     }
 }
+
+ryu_state ryu_prepared_statement_add_batch(ryu_prepared_statement* prepared_statement) {
+    if (prepared_statement == nullptr || prepared_statement->_bound_values == nullptr ||
+        prepared_statement->_batched_values == nullptr) {
+        return RyuError;
+    }
+    auto* bound_values = static_cast<std::unordered_map<std::string, std::unique_ptr<Value>>*>(
+        prepared_statement->_bound_values);
+    auto* batched_values =
+        static_cast<std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>>*>(
+            prepared_statement->_batched_values);
+    std::unordered_map<std::string, std::unique_ptr<Value>> copied_bound_values;
+    for (auto& [name, value] : *bound_values) {
+        copied_bound_values.emplace(name, value->copy());
+    }
+    batched_values->push_back(std::move(copied_bound_values));
+    return RyuSuccess;
+}
@@ -0,0 +1,86 @@
+#include <atomic>
+#include <future>
+
+#include "c_api/ryu.h"
+#include "common/exception/exception.h"
+#include "main/ryu.h"
+
+using namespace ryu::common;
+using namespace ryu::main;
+
+// The result is published through ready before the callback is called, so the callback may
+// retrieve it without waiting for the thread to finish.
+struct QueryFuture {
+    std::future<void> done;
+    std::unique_ptr<QueryResult> result;
+    std::atomic<bool> ready{false};
+    bool retrieved = false;
+};
+
+ryu_state ryu_connection_query_async(ryu_connection* connection, const char* query,
+    ryu_query_callback callback, void* user_data, ryu_query_future* out_query_future) {
+    if (connection == nullptr || connection->_connection == nullptr || query == nullptr) {
+        return RyuError;
+    }
+    try {
+        auto conn = static_cast<Connection*>(connection->_connection);
+        auto query_future = std::make_unique<QueryFuture>();
+        auto query_future_ptr = query_future.get();
+        query_future->done = std::async(std::launch::async,
+            [conn, query_future_ptr, query = std::string(query), callback, user_data]() {
+                try {
+                    query_future_ptr->result = conn->query(query);
+                } catch (Exception& e) {
+                    query_future_ptr->result = QueryResult::getQueryResultWithError(e.what());
+                }
+                query_future_ptr->ready.store(true, std::memory_order_release);
+                if (callback != nullptr) {
+                    callback(user_data);
+                }
+            });
+        out_query_future->_query_future = query_future.release();
+        return RyuSuccess;
+    } catch (std::exception& e) {
+        return RyuError;
+    }
+}
+
+void ryu_query_future_destroy(ryu_query_future* query_future) {
+    if (query_future == nullptr || query_future->_query_future == nullptr) {
+        return;
+    }
+    auto query_future_ptr = static_cast<QueryFuture*>(query_future->_query_future);
+    query_future_ptr->done.wait();
+    delete query_future_ptr;
+    query_future->_query_future = nullptr;
+}
+
+bool ryu_query_future_is_ready(ryu_query_future* query_future) {
+    if (query_future == nullptr || query_future->_query_future == nullptr) {
+        return false;
+    }
+    return static_cast<QueryFuture*>(query_future->_query_future)
+        ->ready.load(std::memory_order_acquire);
+}
+
+ryu_state ryu_query_future_get(ryu_query_future* query_future,
+    ryu_query_result* out_query_result) {
+    if (query_future == nullptr || query_future->_query_future == nullptr) {
+        return RyuError;
+    }
+    auto query_future_ptr = static_cast<QueryFuture*>(query_future->_query_future);
+    if (!query_future_ptr->ready.load(std::memory_order_acquire)) {
+        query_future_ptr->done.wait();
+    }
+    if (query_future_ptr->retrieved) {
+        return RyuError;
+    }
+    query_future_ptr->retrieved = true;
+    auto query_result = query_future_ptr->result.release();
+    out_query_result->_query_result = query_result;
+    out_query_result->_is_owned_by_cpp = false;
+    if (!query_result->isSuccess()) {
+        return RyuError;
+    }
+    return RyuSuccess;
+}
@@ -134,3 +134,14 @@ ryu_state ryu_query_result_get_next_arrow_chunk(ryu_query_result* query_result,
         return RyuError;
     }
 }
+
+ryu_state ryu_query_result_get_arrow_array_stream(ryu_query_result* query_result,
+    int64_t chunk_size, ArrowArrayStream* out_stream) {
+    try {
+        *out_stream = *static_cast<QueryResult*>(query_result->_query_result)
+                           ->getArrowArrayStream(chunk_size);
+        return RyuSuccess;
+    } catch (Exception& e) {
+        return RyuError;
+    }
+}
@@ -745,6 +745,18 @@ ryu_state ryu_value_get_blob(ryu_value* value, uint8_t** out_result) {
     return RyuSuccess;
 }
 
+ryu_state ryu_value_get_string_view(ryu_value* value, const char** out_data,
+    uint64_t* out_length) {
+    auto logical_type_id = static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID();
+    if (logical_type_id != LogicalTypeID::STRING && logical_type_id != LogicalTypeID::BLOB) {
+        return RyuError;
+    }
+    auto& str = static_cast<Value*>(value->_value)->strVal;
+    *out_data = str.data();
+    *out_length = str.size();
+    return RyuSuccess;
+}
+
 ryu_state ryu_value_get_uuid(ryu_value* value, char** out_result) {
     auto logical_type_id = static_cast<Value*>(value->_value)->getDataType().getLogicalTypeID();
     if (logical_type_id != LogicalTypeID::UUID) {
@@ -5,6 +5,7 @@
 #include "catalog/catalog_entry/function_catalog_entry.h"
 #include "catalog/catalog_entry/index_catalog_entry.h"
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
@@ -192,7 +193,8 @@ CatalogEntry* Catalog::createRelGroupEntry(Transaction* transaction,
     }
     auto relGroupEntry =
         std::make_unique<RelGroupCatalogEntry>(info.tableName, extraInfo->srcMultiplicity,
-            extraInfo->dstMultiplicity, extraInfo->storageDirection, std::move(relTableInfos));
+            extraInfo->dstMultiplicity, extraInfo->storageDirection, std::move(relTableInfos),
+            extraInfo->sortPropertyName);
     for (auto& definition : extraInfo->propertyDefinitions) {
         relGroupEntry->addProperty(definition);
     }
@@ -292,7 +294,7 @@ static std::string getTypeDoesNotExistMessage(std::string_view entryName) {
 }
 
 LogicalType Catalog::getType(const Transaction* transaction, const std::string& name) const {
-    if (!types->containsEntry(transaction, name)) {
+    if (!containsType(transaction, name)) {
         throw CatalogException{getTypeDoesNotExistMessage(name)};
     }
     return types->getEntry(transaction, name)
@@ -302,7 +304,12 @@ LogicalType Catalog::getType(const Transaction* transaction, const std::string&
 }
 
 bool Catalog::containsType(const Transaction* transaction, const std::string& typeName) const {
-    return types->containsEntry(transaction, typeName);
+    if (types->containsEntry(transaction, typeName)) {
+        return true;
+    }
+    return extensionManager != nullptr &&
+           extensionManager->loadLazyExtensionByTypeName(typeName) &&
+           types->containsEntry(transaction, typeName);
 }
 
 void Catalog::createIndex(Transaction* transaction,
@@ -399,7 +406,11 @@ bool Catalog::containsFunction(const Transaction* transaction, const std::string
     bool useInternal) const {
     auto hasEntry = functions->containsEntry(transaction, name);
     if (!hasEntry && useInternal) {
-        return internalFunctions->containsEntry(transaction, name);
+        hasEntry = internalFunctions->containsEntry(transaction, name);
+    }
+    if (!hasEntry && extensionManager != nullptr &&
+        extensionManager->loadLazyExtensionByFunctionName(name)) {
+        hasEntry = functions->containsEntry(transaction, name);
     }
     return hasEntry;
 }
@@ -440,6 +451,12 @@ CatalogEntry* Catalog::getFunctionEntry(const Transaction* transaction, const st
         result = functions->getEntry(transaction, name);
     } else if (macros->containsEntry(transaction, name)) {
         result = macros->getEntry(transaction, name);
+    } else if (useInternal && internalFunctions->containsEntry(transaction, name)) {
+        result = internalFunctions->getEntry(transaction, name);
+    } else if (extensionManager != nullptr &&
+               extensionManager->loadLazyExtensionByFunctionName(name) &&
+               functions->containsEntry(transaction, name)) {
+        result = functions->getEntry(transaction, name);
     } else if (useInternal) {
         result = internalFunctions->getEntry(transaction, name);
     } else {
@@ -601,6 +618,12 @@ void Catalog::deserialize(Deserializer& deSer) {
     internalTables = CatalogSet::deserialize(deSer);
     internalSequences = CatalogSet::deserialize(deSer);
     internalFunctions = CatalogSet::deserialize(deSer);
+    // Built-in indexes don't wait for an extension to provide their auxiliary info.
+    for (auto indexEntry : getIndexEntries(&DUMMY_TRANSACTION)) {
+        if (indexEntry->getIndexType() == PropertyIndexCatalogEntry::TYPE_NAME) {
+            indexEntry->setAuxInfo(std::make_unique<PropertyIndexAuxInfo>());
+        }
+    }
 }
 
 } // namespace catalog
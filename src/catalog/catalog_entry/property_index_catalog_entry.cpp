@@ -0,0 +1,27 @@
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
+
+#include "catalog/catalog.h"
+#include "transaction/transaction.h"
+
+namespace ryu {
+namespace catalog {
+
+std::string PropertyIndexAuxInfo::toCypher(const IndexCatalogEntry& indexEntry,
+    const ToCypherInfo& info) const {
+    auto& indexToCypherInfo = info.constCast<IndexToCypherInfo>();
+    auto catalog = Catalog::Get(*indexToCypherInfo.context);
+    auto transaction = transaction::Transaction::Get(*indexToCypherInfo.context);
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, indexEntry.getTableID());
+    KU_ASSERT(indexEntry.getPropertyIDs().size() == 1);
+    std::string propertyName;
+    for (auto& property : tableEntry->getProperties()) {
+        if (tableEntry->getPropertyID(property.getName()) == indexEntry.getPropertyIDs()[0]) {
+            propertyName = property.getName();
+        }
+    }
+    return common::stringFormat("CALL CREATE_PROPERTY_INDEX('{}', '{}', '{}');",
+        tableEntry->getName(), indexEntry.getIndexName(), propertyName);
+}
+
+} // namespace catalog
+} // namespace ryu
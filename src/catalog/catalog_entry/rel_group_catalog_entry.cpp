@@ -4,7 +4,9 @@
 
 #include "binder/ddl/bound_create_table_info.h"
 #include "catalog/catalog.h"
+#include "common/constants.h"
 #include "common/serializer/deserializer.h"
+#include "common/string_utils.h"
 #include "transaction/transaction.h"
 
 using namespace ryu::common;
@@ -30,6 +32,14 @@ void RelGroupCatalogEntry::dropFromToConnection(table_id_t srcTableID, table_id_
     }
 }
 
+void RelGroupCatalogEntry::renameProperty(const std::string& propertyName,
+    const std::string& newName) {
+    TableCatalogEntry::renameProperty(propertyName, newName);
+    if (StringUtils::caseInsensitiveEquals(propertyName, sortPropertyName)) {
+        sortPropertyName = newName;
+    }
+}
+
 void RelTableCatalogInfo::serialize(Serializer& ser) const {
     ser.writeDebuggingInfo("nodePair");
     nodePair.serialize(ser);
@@ -97,6 +107,8 @@ void RelGroupCatalogEntry::serialize(Serializer& serializer) const {
     serializer.serializeValue(storageDirection);
     serializer.writeDebuggingInfo("relTableInfos");
     serializer.serializeVector(relTableInfos);
+    serializer.writeDebuggingInfo("sortPropertyName");
+    serializer.serializeValue(sortPropertyName);
 }
 
 std::unique_ptr<RelGroupCatalogEntry> RelGroupCatalogEntry::deserialize(
@@ -106,6 +118,7 @@ std::unique_ptr<RelGroupCatalogEntry> RelGroupCatalogEntry::deserialize(
     auto dstMultiplicity = RelMultiplicity::MANY;
     auto storageDirection = ExtendDirection::BOTH;
     std::vector<RelTableCatalogInfo> relTableInfos;
+    std::string sortPropertyName;
     deserializer.validateDebuggingInfo(debuggingInfo, "srcMultiplicity");
     deserializer.deserializeValue(srcMultiplicity);
     deserializer.validateDebuggingInfo(debuggingInfo, "dstMultiplicity");
@@ -114,11 +127,14 @@ std::unique_ptr<RelGroupCatalogEntry> RelGroupCatalogEntry::deserialize(
     deserializer.deserializeValue(storageDirection);
     deserializer.validateDebuggingInfo(debuggingInfo, "relTableInfos");
     deserializer.deserializeVector(relTableInfos);
+    deserializer.validateDebuggingInfo(debuggingInfo, "sortPropertyName");
+    deserializer.deserializeValue(sortPropertyName);
     auto relGroupEntry = std::make_unique<RelGroupCatalogEntry>();
     relGroupEntry->srcMultiplicity = srcMultiplicity;
     relGroupEntry->dstMultiplicity = dstMultiplicity;
     relGroupEntry->storageDirection = storageDirection;
     relGroupEntry->relTableInfos = relTableInfos;
+    relGroupEntry->sortPropertyName = std::move(sortPropertyName);
     return relGroupEntry;
 }
 
@@ -141,7 +157,12 @@ std::string RelGroupCatalogEntry::toCypher(const ToCypherInfo& info) const {
         ss << stringFormat(", {}", getFromToStr(relTableInfos[i].nodePair, catalog, transaction));
     }
     ss << ", " << propertyCollection.toCypher() << RelMultiplicityUtils::toString(srcMultiplicity)
-       << "_" << RelMultiplicityUtils::toString(dstMultiplicity) << ");";
+       << "_" << RelMultiplicityUtils::toString(dstMultiplicity) << ")";
+    if (hasSortProperty()) {
+        ss << stringFormat(" WITH ({} = '{}')", TableOptionConstants::REL_SORT_BY_OPTION,
+            sortPropertyName);
+    }
+    ss << ";";
     return ss.str();
 }
 
@@ -168,6 +189,7 @@ std::unique_ptr<TableCatalogEntry> RelGroupCatalogEntry::copy() const {
     other->dstMultiplicity = dstMultiplicity;
     other->storageDirection = storageDirection;
     other->relTableInfos = relTableInfos;
+    other->sortPropertyName = sortPropertyName;
     other->copyFrom(*this);
     return other;
 }
@@ -180,7 +202,7 @@ RelGroupCatalogEntry::getBoundExtraCreateInfo(transaction::Transaction*) const {
     }
     return std::make_unique<binder::BoundExtraCreateRelTableGroupInfo>(
         copyVector(propertyCollection.getDefinitions()), srcMultiplicity, dstMultiplicity,
-        storageDirection, std::move(nodePairs));
+        storageDirection, std::move(nodePairs), sortPropertyName);
 }
 
 } // namespace catalog
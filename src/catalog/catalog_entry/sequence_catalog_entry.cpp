@@ -6,6 +6,7 @@
 #include "common/serializer/deserializer.h"
 #include "common/vector/value_vector.h"
 #include "function/arithmetic/add.h"
+#include "function/arithmetic/multiply.h"
 #include "transaction/transaction.h"
 
 using namespace ryu::binder;
@@ -66,33 +67,78 @@ void SequenceCatalogEntry::nextValNoLock() {
     sequenceData.usageCount++;
 }
 
+int64_t SequenceCatalogEntry::reserveRangeNoLock(uint64_t count) {
+    KU_ASSERT(!sequenceData.cycle);
+    // The first value of a sequence is its start value.
+    const auto numIncrements = static_cast<int64_t>(
+        sequenceData.usageCount == 0 ? count - 1 : count);
+    bool overflow = false;
+    auto last = sequenceData.currVal;
+    try {
+        auto increment = sequenceData.increment;
+        auto delta = numIncrements;
+        function::Multiply::operation(delta, increment, delta);
+        function::Add::operation(last, delta, last);
+    } catch (const OverflowException&) {
+        overflow = true;
+    }
+    // Values are monotonic, so they are all in range if the last one is.
+    if (overflow ? sequenceData.increment < 0 : last < sequenceData.minValue) {
+        throw CatalogException("nextval: reached minimum value of sequence \"" + name + "\" " +
+                               std::to_string(sequenceData.minValue));
+    }
+    if (overflow ? sequenceData.increment > 0 : last > sequenceData.maxValue) {
+        throw CatalogException("nextval: reached maximum value of sequence \"" + name + "\" " +
+                               std::to_string(sequenceData.maxValue));
+    }
+    const auto first = sequenceData.usageCount == 0 ? sequenceData.currVal :
+                                                      sequenceData.currVal + sequenceData.increment;
+    sequenceData.currVal = last;
+    sequenceData.usageCount += count;
+    return first;
+}
+
 // referenced from DuckDB
 void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const uint64_t& count) {
     KU_ASSERT(count > 0);
-    SequenceRollbackData rollbackData{};
-    {
-        std::lock_guard lck(mtx);
-        rollbackData = SequenceRollbackData{sequenceData.usageCount, sequenceData.currVal};
+    std::lock_guard lck(mtx);
+    const SequenceRollbackData rollbackData{sequenceData.usageCount, sequenceData.currVal};
+    if (sequenceData.cycle) {
         for (auto i = 0ul; i < count; i++) {
             nextValNoLock();
         }
+    } else {
+        reserveRangeNoLock(count);
     }
+    // Pushed under the lock, so that the first change of a transaction has the earliest state.
     transaction->pushSequenceChange(this, count, rollbackData);
 }
 
 void SequenceCatalogEntry::nextKVal(transaction::Transaction* transaction, const uint64_t& count,
     ValueVector& resultVector) {
     KU_ASSERT(count > 0);
-    SequenceRollbackData rollbackData{};
+    int64_t first = 0;
+    int64_t increment = 0;
     {
         std::lock_guard lck(mtx);
-        rollbackData = SequenceRollbackData{sequenceData.usageCount, sequenceData.currVal};
-        for (auto i = 0ul; i < count; i++) {
-            nextValNoLock();
-            resultVector.setValue(i, sequenceData.currVal);
+        const SequenceRollbackData rollbackData{sequenceData.usageCount, sequenceData.currVal};
+        if (sequenceData.cycle) {
+            for (auto i = 0ul; i < count; i++) {
+                nextValNoLock();
+                resultVector.setValue(i, sequenceData.currVal);
+            }
+            transaction->pushSequenceChange(this, count, rollbackData);
+            return;
         }
+        // Without cycles, the values form an arithmetic range, which is reserved in constant time
+        // and written to the result outside the lock.
+        first = reserveRangeNoLock(count);
+        increment = sequenceData.increment;
+        transaction->pushSequenceChange(this, count, rollbackData);
+    }
+    for (auto i = 0ul; i < count; i++) {
+        resultVector.setValue<int64_t>(i, first + static_cast<int64_t>(i) * increment);
     }
-    transaction->pushSequenceChange(this, count, rollbackData);
 }
 
 void SequenceCatalogEntry::rollbackVal(const uint64_t& usageCount, const int64_t& currVal) {
@@ -118,18 +118,38 @@ static void scanArrowArrayMonthDayNanoInterval(const ArrowArray* array, ValueVec
     }
 }
 
+// Values are stored back to back in the data buffer, so the data from the first long value to the
+// end is copied into the overflow buffer at once and long values point into the copy, instead of
+// allocating and copying each value separately.
 template<typename offsetsT>
 static void scanArrowArrayBLOB(const ArrowArray* array, ValueVector& outputVector,
     ArrowNullMaskTree* mask, uint64_t srcOffset, uint64_t dstOffset, uint64_t count) {
     auto offsets = ((const offsetsT*)array->buffers[1]) + srcOffset;
     auto arrayBuffer = (const uint8_t*)array->buffers[2];
     mask->copyToValueVector(&outputVector, dstOffset, count);
+    uint8_t* overflowData = nullptr;
+    offsetsT overflowStartOffset = 0;
     for (uint64_t i = 0; i < count; i++) {
         if (!mask->isNull(i)) {
             auto curOffset = offsets[i], nextOffset = offsets[i + 1];
-            const uint8_t* data = arrayBuffer + curOffset;
+            auto data = reinterpret_cast<const char*>(arrayBuffer + curOffset);
             auto length = nextOffset - curOffset;
-            BlobVector::addBlob(&outputVector, i + dstOffset, data, length);
+            auto& dstStr = outputVector.getValue<ku_string_t>(i + dstOffset);
+            if (ku_string_t::isShortString(length)) {
+                dstStr.setShortString(data, length);
+                continue;
+            }
+            if (overflowData == nullptr) {
+                overflowStartOffset = curOffset;
+                auto numBytes = offsets[count] - curOffset;
+                overflowData =
+                    StringVector::getInMemOverflowBuffer(&outputVector)->allocateSpace(numBytes);
+                memcpy(overflowData, data, numBytes);
+            }
+            dstStr.len = length;
+            memcpy(dstStr.prefix, data, ku_string_t::PREFIX_LENGTH);
+            dstStr.overflowPtr =
+                reinterpret_cast<uint64_t>(overflowData + (curOffset - overflowStartOffset));
         }
     }
 }
@@ -6,6 +6,9 @@
 
 #include "common/checksum.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "common/types/types.h"
 
 namespace ryu::common {
@@ -85,4 +88,37 @@ uint64_t checksum(uint8_t* buffer, size_t size) {
     return result;
 }
 
+void IncrementalChecksum::update(const uint8_t* data, size_t size) {
+    if (numPending > 0) {
+        const auto numToCopy = std::min(size, sizeof(pending) - numPending);
+        memcpy(pending + numPending, data, numToCopy);
+        numPending += numToCopy;
+        data += numToCopy;
+        size -= numToCopy;
+        if (numPending < sizeof(pending)) {
+            return;
+        }
+        uint64_t value = 0;
+        memcpy(&value, pending, sizeof(value));
+        result ^= checksum(value);
+        numPending = 0;
+    }
+    for (; size >= sizeof(uint64_t); data += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+        uint64_t value = 0;
+        memcpy(&value, data, sizeof(value));
+        result ^= checksum(value);
+    }
+    memcpy(pending, data, size);
+    numPending = size;
+}
+
+uint64_t IncrementalChecksum::finish() const {
+    if (numPending == 0) {
+        return result;
+    }
+    uint8_t tail[sizeof(pending)];
+    memcpy(tail, pending, numPending);
+    return result ^ checksumRemainder(tail, numPending);
+}
+
 } // namespace ryu::common
@@ -2,6 +2,11 @@
 
 #include <string.h>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "common/exception/io.h"
 
 namespace ryu {
@@ -15,6 +20,8 @@ int64_t CompressedFileSystem::readFile(ryu::common::FileInfo& fileInfo, void* bu
 
 void CompressedFileSystem::reset(ryu::common::FileInfo& fileInfo) {
     auto& compressedFileInfo = fileInfo.cast<CompressedFileInfo>();
+    // The prefetcher reads from the child file, so it must be stopped before the file is reset.
+    compressedFileInfo.close();
     compressedFileInfo.childFileInfo->reset();
     compressedFileInfo.initialize();
 }
@@ -34,6 +41,129 @@ void CompressedFileSystem::readFromFile(FileInfo& /*fileInfo*/, void* /*buffer*/
     throw IOException("Only sequential read is allowed in compressed file system.");
 }
 
+// Decompresses blocks of the file on a separate thread ahead of the reader, so that decompression
+// overlaps with parsing the data decompressed before. Compressed streams can only be decompressed
+// sequentially, so a single thread decompresses the whole file.
+class DecompressionPrefetcher {
+    static constexpr idx_t BLOCK_SIZE = 1u << 18; // 256 KB
+    // Bounds the memory used by blocks which have been decompressed but not read yet
+    static constexpr idx_t MAX_NUM_BUFFERED_BLOCKS = 4;
+
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        idx_t size = 0;
+        idx_t offset = 0;
+    };
+
+public:
+    explicit DecompressionPrefetcher(CompressedFileInfo& fileInfo) : fileInfo{fileInfo} {
+#ifndef __SINGLE_THREADED__
+        decompressorThread = std::thread([this] { decompressBlocks(); });
+#endif
+    }
+    DELETE_COPY_AND_MOVE(DecompressionPrefetcher);
+
+    ~DecompressionPrefetcher() {
+#ifndef __SINGLE_THREADED__
+        {
+            std::unique_lock lck{mtx};
+            stopped = true;
+        }
+        cv.notify_all();
+        decompressorThread.join();
+#endif
+    }
+
+    int64_t read(void* buffer, size_t numBytes) {
+#ifdef __SINGLE_THREADED__
+        return fileInfo.decompress(buffer, numBytes);
+#else
+        idx_t totalNumBytesRead = 0;
+        while (numBytes > 0) {
+            if (currentBlock.offset == currentBlock.size && !nextBlock()) {
+                break;
+            }
+            auto available = std::min<idx_t>(numBytes, currentBlock.size - currentBlock.offset);
+            memcpy(reinterpret_cast<uint8_t*>(buffer) + totalNumBytesRead,
+                currentBlock.data.get() + currentBlock.offset, available);
+            currentBlock.offset += available;
+            totalNumBytesRead += available;
+            numBytes -= available;
+        }
+        return totalNumBytesRead;
+#endif
+    }
+
+private:
+#ifndef __SINGLE_THREADED__
+    bool nextBlock() {
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return !blocks.empty() || finished; });
+        if (blocks.empty()) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return false;
+        }
+        currentBlock = std::move(blocks.front());
+        blocks.pop_front();
+        cv.notify_all();
+        return true;
+    }
+
+    void decompressBlocks() {
+        try {
+            while (true) {
+                Block block;
+                block.data = std::make_unique<uint8_t[]>(BLOCK_SIZE);
+                block.size = fileInfo.decompress(block.data.get(), BLOCK_SIZE);
+                auto isLastBlock = block.size < BLOCK_SIZE;
+                std::unique_lock lck{mtx};
+                cv.wait(lck, [&] { return blocks.size() < MAX_NUM_BUFFERED_BLOCKS || stopped; });
+                if (stopped) {
+                    return;
+                }
+                if (block.size > 0) {
+                    blocks.push_back(std::move(block));
+                    cv.notify_all();
+                }
+                if (isLastBlock) {
+                    break;
+                }
+            }
+        } catch (...) {
+            std::unique_lock lck{mtx};
+            exception = std::current_exception();
+        }
+        std::unique_lock lck{mtx};
+        finished = true;
+        cv.notify_all();
+    }
+#endif
+
+private:
+    CompressedFileInfo& fileInfo;
+#ifndef __SINGLE_THREADED__
+    std::thread decompressorThread;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<Block> blocks;
+    Block currentBlock;
+    bool finished = false;
+    bool stopped = false;
+    std::exception_ptr exception;
+#endif
+};
+
+CompressedFileInfo::CompressedFileInfo(CompressedFileSystem& compressedFS,
+    std::unique_ptr<FileInfo> childFileInfo)
+    : FileInfo{childFileInfo->path, &compressedFS}, compressedFS{compressedFS},
+      childFileInfo{std::move(childFileInfo)} {}
+
+CompressedFileInfo::~CompressedFileInfo() {
+    close();
+}
+
 void CompressedFileInfo::initialize() {
     close();
     streamData.inputBufSize = compressedFS.getInputBufSize();
@@ -50,6 +180,13 @@ void CompressedFileInfo::initialize() {
 }
 
 int64_t CompressedFileInfo::readData(void* buffer, size_t numBytes) {
+    if (!prefetcher) {
+        prefetcher = std::make_unique<DecompressionPrefetcher>(*this);
+    }
+    return prefetcher->read(buffer, numBytes);
+}
+
+int64_t CompressedFileInfo::decompress(void* buffer, size_t numBytes) {
     common::idx_t totalNumBytesRead = 0;
     while (true) {
         if (streamData.outputBufStart != streamData.outputBufEnd) {
@@ -104,6 +241,8 @@ int64_t CompressedFileInfo::readData(void* buffer, size_t numBytes) {
 }
 
 void CompressedFileInfo::close() {
+    // The prefetcher decompresses from the stream, so it is stopped first.
+    prefetcher.reset();
     if (stream_wrapper) {
         stream_wrapper->close();
         stream_wrapper.reset();
@@ -19,10 +19,26 @@ void FileInfo::readFromFile(void* buffer, uint64_t numBytes, uint64_t position)
     fileSystem->readFromFile(*this, buffer, numBytes, position);
 }
 
+void FileInfo::readFromFileBatch(std::span<const FileReadRequest> requests) {
+    fileSystem->readFromFileBatch(*this, requests);
+}
+
 int64_t FileInfo::readFile(void* buf, size_t nbyte) {
     return fileSystem->readFile(*this, buf, nbyte);
 }
 
+void FileInfo::prefetch(uint64_t position, uint64_t numBytes) {
+    fileSystem->prefetch(*this, position, numBytes);
+}
+
+void FileInfo::punchHole(uint64_t position, uint64_t numBytes) {
+    fileSystem->punchHole(*this, position, numBytes);
+}
+
+bool FileInfo::tryLock(FileLockType lockType) {
+    return fileSystem->tryLock(*this, lockType);
+}
+
 void FileInfo::writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset) {
     fileSystem->writeFile(*this, buffer, numBytes, offset);
 }
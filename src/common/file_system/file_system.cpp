@@ -50,6 +50,13 @@ std::string FileSystem::getFileName(const std::filesystem::path& path) {
     return path.filename().string();
 }
 
+void FileSystem::readFromFileBatch(FileInfo& fileInfo,
+    std::span<const FileReadRequest> requests) const {
+    for (auto& request : requests) {
+        readFromFile(fileInfo, request.buffer, request.numBytes, request.position);
+    }
+}
+
 void FileSystem::writeFile(FileInfo& /*fileInfo*/, const uint8_t* /*buffer*/, uint64_t /*numBytes*/,
     uint64_t /*offset*/) const {
     KU_UNREACHABLE;
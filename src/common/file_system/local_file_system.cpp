@@ -1,6 +1,7 @@
 #include "common/file_system/local_file_system.h"
 
 #include "common/assert.h"
+#include "common/copy_constructors.h"
 #include "common/exception/io.h"
 #include "common/string_format.h"
 #include "common/string_utils.h"
@@ -19,6 +20,17 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__)
+#include <linux/falloc.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define RYU_IO_URING 1
+#endif
+#endif
+
 #include <fcntl.h>
 
 #include <cstring>
@@ -40,6 +52,28 @@ LocalFileInfo::~LocalFileInfo() {
 #endif
 }
 
+#if defined(_WIN32)
+static bool lockFile(HANDLE handle, FileLockType lockType) {
+    DWORD dwFlags = lockType == FileLockType::READ_LOCK ?
+                        LOCKFILE_FAIL_IMMEDIATELY :
+                        LOCKFILE_FAIL_IMMEDIATELY | LOCKFILE_EXCLUSIVE_LOCK;
+    OVERLAPPED overlapped = {0};
+    overlapped.Offset = 0;
+    return LockFileEx(handle, dwFlags, 0 /*reserved*/, 1 /*numBytesLow*/, 0 /*numBytesHigh*/,
+        &overlapped);
+}
+#else
+static bool lockFile(int fd, FileLockType lockType) {
+    struct flock fl {};
+    memset(&fl, 0, sizeof fl);
+    fl.l_type = lockType == FileLockType::READ_LOCK ? F_RDLCK : F_WRLCK;
+    fl.l_whence = SEEK_SET;
+    fl.l_start = 0;
+    fl.l_len = 0;
+    return fcntl(fd, F_SETLK, &fl) != -1;
+}
+#endif
+
 static void validateFileFlags(uint8_t flags) {
     const bool isRead = flags & FileFlags::READ_ONLY;
     const bool isWrite = flags & FileFlags::WRITE;
@@ -113,14 +147,7 @@ std::unique_ptr<FileInfo> LocalFileSystem::openFile(const std::string& path, Fil
             GetLastError(), std::system_category().message(GetLastError())));
     }
     if (flags.lockType != FileLockType::NO_LOCK) {
-        DWORD dwFlags = flags.lockType == FileLockType::READ_LOCK ?
-                            LOCKFILE_FAIL_IMMEDIATELY :
-                            LOCKFILE_FAIL_IMMEDIATELY | LOCKFILE_EXCLUSIVE_LOCK;
-        OVERLAPPED overlapped = {0};
-        overlapped.Offset = 0;
-        BOOL rc = LockFileEx(handle, dwFlags, 0 /*reserved*/, 1 /*numBytesLow*/, 0 /*numBytesHigh*/,
-            &overlapped);
-        if (!rc) {
+        if (!lockFile(handle, flags.lockType)) {
             throw IOException(
                 "Could not set lock on file : " + fullPath + "\n" +
                 "See the docs: https://docs.ryugraph.io/concurrency for more information.");
@@ -133,14 +160,7 @@ std::unique_ptr<FileInfo> LocalFileSystem::openFile(const std::string& path, Fil
         throw IOException(stringFormat("Cannot open file {}: {}", fullPath, posixErrMessage()));
     }
     if (flags.lockType != FileLockType::NO_LOCK) {
-        struct flock fl {};
-        memset(&fl, 0, sizeof fl);
-        fl.l_type = flags.lockType == FileLockType::READ_LOCK ? F_RDLCK : F_WRLCK;
-        fl.l_whence = SEEK_SET;
-        fl.l_start = 0;
-        fl.l_len = 0;
-        int rc = fcntl(fd, F_SETLK, &fl);
-        if (rc == -1) {
+        if (!lockFile(fd, flags.lockType)) {
             throw IOException(
                 "Could not set lock on file : " + fullPath + "\n" +
                 "See the docs: https://docs.ryugraph.io/concurrency for more information.");
@@ -390,6 +410,200 @@ void LocalFileSystem::readFromFile(FileInfo& fileInfo, void* buffer, uint64_t nu
 #endif
 }
 
+#if RYU_IO_URING
+// A minimal io_uring submission/completion ring used to submit batches of reads with a single
+// system call. It uses the raw system calls so that we don't depend on liburing. Each thread has
+// its own ring, so no synchronisation between threads is needed.
+class IOUring {
+public:
+    static constexpr uint32_t QUEUE_DEPTH = 64;
+
+    IOUring() {
+        io_uring_params params{};
+        ringFd = static_cast<int>(syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params));
+        if (ringFd < 0) {
+            // io_uring is not supported by the kernel or is blocked (e.g. by seccomp).
+            ringFd = -1;
+            return;
+        }
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+#ifdef IORING_FEAT_SINGLE_MMAP
+        singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+#endif
+        if (singleMmap) {
+            sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+        }
+        sqRing = mapRing(sqRingSize, IORING_OFF_SQ_RING);
+        cqRing = singleMmap ? sqRing : mapRing(cqRingSize, IORING_OFF_CQ_RING);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(mapRing(sqesSize, IORING_OFF_SQES));
+        if (sqRing == nullptr || cqRing == nullptr || sqes == nullptr) {
+            release();
+            return;
+        }
+        auto sqBase = static_cast<uint8_t*>(sqRing);
+        sqTail = reinterpret_cast<uint32_t*>(sqBase + params.sq_off.tail);
+        sqMask = *reinterpret_cast<uint32_t*>(sqBase + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<uint32_t*>(sqBase + params.sq_off.array);
+        auto cqBase = static_cast<uint8_t*>(cqRing);
+        cqHead = reinterpret_cast<uint32_t*>(cqBase + params.cq_off.head);
+        cqTail = reinterpret_cast<uint32_t*>(cqBase + params.cq_off.tail);
+        cqMask = *reinterpret_cast<uint32_t*>(cqBase + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cqBase + params.cq_off.cqes);
+        numEntries = std::min(params.sq_entries, QUEUE_DEPTH);
+    }
+    DELETE_COPY_AND_MOVE(IOUring);
+    ~IOUring() { release(); }
+
+    bool isValid() const { return ringFd != -1; }
+
+    // Reads all requests, keeping up to numEntries of them in flight. onComplete is called with
+    // the index of each request and the result of its read (number of bytes read or -errno). If
+    // onComplete throws, no more reads are submitted and the exception is rethrown once the reads
+    // in flight have completed, since the kernel may still be writing into their buffers.
+    template<typename FUNC>
+    void read(int fd, std::span<const FileReadRequest> requests, FUNC onComplete) {
+        std::vector<iovec> iovecs(requests.size());
+        std::exception_ptr exception;
+        uint64_t numSubmitted = 0, numInFlight = 0;
+        while ((!exception && numSubmitted < requests.size()) || numInFlight > 0) {
+            uint32_t numToSubmit = 0;
+            auto tail = *sqTail;
+            while (!exception && numSubmitted < requests.size() &&
+                   numInFlight + numToSubmit < numEntries) {
+                auto& request = requests[numSubmitted];
+                iovecs[numSubmitted] = {request.buffer, request.numBytes};
+                auto idx = tail & sqMask;
+                auto& sqe = sqes[idx];
+                memset(&sqe, 0, sizeof(io_uring_sqe));
+                sqe.opcode = IORING_OP_READV;
+                sqe.fd = fd;
+                sqe.addr = reinterpret_cast<uint64_t>(&iovecs[numSubmitted]);
+                sqe.len = 1;
+                sqe.off = request.position;
+                sqe.user_data = numSubmitted;
+                sqArray[idx] = idx;
+                tail++;
+                numSubmitted++;
+                numToSubmit++;
+            }
+            __atomic_store_n(sqTail, tail, __ATOMIC_RELEASE);
+            numInFlight += numToSubmit;
+            enter(numToSubmit);
+            auto head = *cqHead;
+            while (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+                auto& cqe = cqes[head & cqMask];
+                if (!exception) {
+                    try {
+                        onComplete(cqe.user_data, cqe.res);
+                    } catch (...) {
+                        exception = std::current_exception();
+                    }
+                }
+                head++;
+                numInFlight--;
+                __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+            }
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    void* mapRing(size_t size, uint64_t offset) const {
+        auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd,
+            static_cast<off_t>(offset));
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    // Submits the new entries and waits for at least one completion.
+    void enter(uint32_t numToSubmit) const {
+        while (true) {
+            auto result = syscall(__NR_io_uring_enter, ringFd, numToSubmit, 1,
+                IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (result >= 0) {
+                return;
+            }
+            if (errno != EINTR) {
+                // LCOV_EXCL_START
+                throw IOException(stringFormat("io_uring_enter failed: {}", posixErrMessage()));
+                // LCOV_EXCL_STOP
+            }
+            numToSubmit = 0;
+        }
+    }
+
+    void release() {
+        if (sqes != nullptr) {
+            munmap(sqes, sqesSize);
+        }
+        if (cqRing != nullptr && !singleMmap) {
+            munmap(cqRing, cqRingSize);
+        }
+        if (sqRing != nullptr) {
+            munmap(sqRing, sqRingSize);
+        }
+        sqes = nullptr;
+        sqRing = cqRing = nullptr;
+        if (ringFd != -1) {
+            close(ringFd);
+            ringFd = -1;
+        }
+    }
+
+private:
+    int ringFd = -1;
+    bool singleMmap = false;
+    void* sqRing = nullptr;
+    size_t sqRingSize = 0;
+    void* cqRing = nullptr;
+    size_t cqRingSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+    uint32_t* sqTail = nullptr;
+    uint32_t sqMask = 0;
+    uint32_t* sqArray = nullptr;
+    uint32_t* cqHead = nullptr;
+    uint32_t* cqTail = nullptr;
+    uint32_t cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+    uint32_t numEntries = 0;
+};
+#endif
+
+void LocalFileSystem::readFromFileBatch(FileInfo& fileInfo,
+    std::span<const FileReadRequest> requests) const {
+#if RYU_IO_URING
+    if (requests.size() > 1) {
+        static thread_local IOUring ring;
+        if (ring.isValid()) {
+            auto fd = fileInfo.constPtrCast<LocalFileInfo>()->fd;
+            ring.read(fd, requests, [&](uint64_t idx, int32_t result) {
+                auto& request = requests[idx];
+                if (result < 0) {
+                    // LCOV_EXCL_START
+                    throw IOException(stringFormat("Cannot read from file: {} fileDescriptor: {} "
+                                                   "numBytesToRead: {} position: {}. Error: {}",
+                        fileInfo.path, fd, request.numBytes, request.position, strerror(-result)));
+                    // LCOV_EXCL_STOP
+                }
+                auto numBytesRead = static_cast<uint64_t>(result);
+                if (numBytesRead < request.numBytes) {
+                    // Short reads are rare; read the remainder synchronously, which also checks
+                    // that the short read was caused by reaching the end of the file.
+                    readFromFile(fileInfo, static_cast<uint8_t*>(request.buffer) + numBytesRead,
+                        request.numBytes - numBytesRead, request.position + numBytesRead);
+                }
+            });
+            return;
+        }
+    }
+#endif
+    FileSystem::readFromFileBatch(fileInfo, requests);
+}
+
 int64_t LocalFileSystem::readFile(FileInfo& fileInfo, void* buf, size_t nbyte) const {
     auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
 #if defined(_WIN32)
@@ -401,6 +615,33 @@ int64_t LocalFileSystem::readFile(FileInfo& fileInfo, void* buf, size_t nbyte) c
 #endif
 }
 
+void LocalFileSystem::prefetch(FileInfo& fileInfo [[maybe_unused]],
+    uint64_t position [[maybe_unused]], uint64_t numBytes [[maybe_unused]]) const {
+#if !defined(_WIN32) && !defined(__APPLE__)
+    // This is only a hint, so failures are ignored.
+    posix_fadvise(fileInfo.constPtrCast<LocalFileInfo>()->fd, static_cast<off_t>(position),
+        static_cast<off_t>(numBytes), POSIX_FADV_WILLNEED);
+#endif
+}
+
+bool LocalFileSystem::tryLock(FileInfo& fileInfo, FileLockType lockType) const {
+#if defined(_WIN32)
+    return lockFile((HANDLE)fileInfo.constPtrCast<LocalFileInfo>()->handle, lockType);
+#else
+    return lockFile(fileInfo.constPtrCast<LocalFileInfo>()->fd, lockType);
+#endif
+}
+
+void LocalFileSystem::punchHole(FileInfo& fileInfo [[maybe_unused]],
+    uint64_t position [[maybe_unused]], uint64_t numBytes [[maybe_unused]]) const {
+#if defined(__linux__)
+    // Releasing the space is best effort, since not all file systems support holes.
+    fallocate(fileInfo.constPtrCast<LocalFileInfo>()->fd,
+        FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, static_cast<off_t>(position),
+        static_cast<off_t>(numBytes));
+#endif
+}
+
 void LocalFileSystem::writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
     uint64_t offset) const {
     auto localFileInfo = fileInfo.constPtrCast<LocalFileInfo>();
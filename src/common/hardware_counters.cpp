@@ -0,0 +1,86 @@
+#include "common/hardware_counters.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <initializer_list>
+#endif
+
+namespace ryu {
+namespace common {
+
+#if defined(__linux__)
+static int openCounter(uint64_t config, int groupFD) {
+    perf_event_attr attr{};
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = groupFD == -1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0 /* calling thread */,
+        -1 /* any cpu */, groupFD, 0 /* flags */));
+}
+#endif
+
+HardwareCounters::HardwareCounters() : groupFD{-1}, instructionsFD{-1}, llcMissesFD{-1} {
+#if defined(__linux__)
+    groupFD = openCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (groupFD < 0) {
+        return;
+    }
+    instructionsFD = openCounter(PERF_COUNT_HW_INSTRUCTIONS, groupFD);
+    llcMissesFD = openCounter(PERF_COUNT_HW_CACHE_MISSES, groupFD);
+    if (instructionsFD < 0 || llcMissesFD < 0) {
+        closeCounters();
+        return;
+    }
+    ioctl(groupFD, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(groupFD, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+HardwareCounters::~HardwareCounters() {
+    closeCounters();
+}
+
+void HardwareCounters::closeCounters() {
+#if defined(__linux__)
+    for (const auto fd : {llcMissesFD, instructionsFD, groupFD}) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+    groupFD = instructionsFD = llcMissesFD = -1;
+}
+
+HardwareCounters* HardwareCounters::getThreadLocal() {
+    thread_local HardwareCounters counters;
+    return counters.isAvailable() ? &counters : nullptr;
+}
+
+HardwareCounterValues HardwareCounters::read() const {
+    HardwareCounterValues values;
+#if defined(__linux__)
+    struct {
+        uint64_t numCounters;
+        uint64_t values[3];
+    } group{};
+    if (::read(groupFD, &group, sizeof(group)) == sizeof(group)) {
+        values.numCycles = group.values[0];
+        values.numInstructions = group.values[1];
+        values.numLLCMisses = group.values[2];
+    }
+#endif
+    return values;
+}
+
+} // namespace common
+} // namespace ryu
@@ -34,6 +34,14 @@ uint8_t* InMemOverflowBuffer::allocateSpace(uint64_t size) {
     return data;
 }
 
+uint64_t InMemOverflowBuffer::getMemoryUsage() const {
+    uint64_t memoryUsage = 0;
+    for (auto& block : blocks) {
+        memoryUsage += block->size();
+    }
+    return memoryUsage;
+}
+
 void InMemOverflowBuffer::resetBuffer() {
     if (!blocks.empty()) {
         // Last block is usually the largest
@@ -0,0 +1,53 @@
+#include "common/memory_tracker.h"
+
+namespace ryu {
+namespace common {
+
+thread_local MemoryTracker* MemoryTracker::threadLocalTracker = nullptr;
+
+void MemoryTracker::allocate(uint64_t size) {
+    const auto newUsage = usage.fetch_add(size, std::memory_order_relaxed) + size;
+    auto peak = peakUsage.load(std::memory_order_relaxed);
+    while (newUsage > peak &&
+           !peakUsage.compare_exchange_weak(peak, newUsage, std::memory_order_relaxed)) {}
+    if (parent != nullptr) {
+        parent->allocate(size);
+    }
+}
+
+void MemoryTracker::free(uint64_t size) {
+    usage.fetch_sub(size, std::memory_order_relaxed);
+    if (parent != nullptr) {
+        parent->free(size);
+    }
+}
+
+MemoryTracker* QueryMemoryTracker::getOperatorTracker(uint32_t operatorID,
+    const std::string& operatorName) {
+    std::unique_lock lck{mtx};
+    auto& operatorTracker = operatorTrackers[operatorID];
+    if (operatorTracker.tracker == nullptr) {
+        operatorTracker.operatorName = operatorName;
+        operatorTracker.tracker = std::make_shared<MemoryTracker>(shared_from_this());
+    }
+    return operatorTracker.tracker.get();
+}
+
+uint64_t QueryMemoryTracker::getOperatorPeakUsage(uint32_t operatorID) const {
+    std::unique_lock lck{mtx};
+    const auto it = operatorTrackers.find(operatorID);
+    return it == operatorTrackers.end() ? 0 : it->second.tracker->getPeakUsage();
+}
+
+std::vector<OperatorMemoryUsage> QueryMemoryTracker::getOperatorUsages() const {
+    std::unique_lock lck{mtx};
+    std::vector<OperatorMemoryUsage> result;
+    for (auto& [operatorID, operatorTracker] : operatorTrackers) {
+        result.push_back({operatorID, operatorTracker.operatorName,
+            operatorTracker.tracker->getUsage(), operatorTracker.tracker->getPeakUsage()});
+    }
+    return result;
+}
+
+} // namespace common
+} // namespace ryu
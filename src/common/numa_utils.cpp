@@ -0,0 +1,71 @@
+#include "common/numa_utils.h"
+
+#if defined(__linux__)
+#include <sched.h>
+
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#endif
+
+namespace ryu {
+namespace common {
+
+#if defined(__linux__)
+// Parses a sysfs cpu list, e.g. "0-3,8-11".
+static std::vector<uint64_t> parseCPUList(const std::string& cpuList) {
+    std::vector<uint64_t> cpus;
+    std::stringstream ss{cpuList};
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || !std::isdigit(range[0])) {
+            continue;
+        }
+        auto dashPos = range.find('-');
+        auto begin = std::stoull(range.substr(0, dashPos));
+        auto end = dashPos == std::string::npos ? begin : std::stoull(range.substr(dashPos + 1));
+        for (auto cpu = begin; cpu <= end; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+#endif
+
+std::vector<std::vector<uint64_t>> NUMAUtils::getNodeCPUs() {
+    std::vector<std::vector<uint64_t>> nodeCPUs;
+#if defined(__linux__)
+    std::error_code ec;
+    for (auto nodeIdx = 0u;; nodeIdx++) {
+        auto path = "/sys/devices/system/node/node" + std::to_string(nodeIdx) + "/cpulist";
+        if (!std::filesystem::exists(path, ec)) {
+            break;
+        }
+        std::ifstream file{path};
+        std::string cpuList;
+        std::getline(file, cpuList);
+        auto cpus = parseCPUList(cpuList);
+        if (!cpus.empty()) {
+            nodeCPUs.push_back(std::move(cpus));
+        }
+    }
+    if (nodeCPUs.size() <= 1) {
+        nodeCPUs.clear();
+    }
+#endif
+    return nodeCPUs;
+}
+
+uint64_t NUMAUtils::getCurrentCPU() {
+#if defined(__linux__)
+    auto cpu = sched_getcpu();
+    return cpu < 0 ? INVALID_CPU : cpu;
+#else
+    return INVALID_CPU;
+#endif
+}
+
+} // namespace common
+} // namespace ryu
@@ -1,8 +1,122 @@
 #include "common/roaring_mask.h"
 
+#include <algorithm>
+#include <bit>
+
 namespace ryu {
 namespace common {
 
+SemiMaskRepresentation SemiMaskReadView::chooseRepresentation(uint64_t numMasked,
+    offset_t maxOffset) {
+    if (numMasked <= MAX_SORTED_ARRAY_SIZE) {
+        return SemiMaskRepresentation::SORTED_ARRAY;
+    }
+    if (numMasked * MIN_BITSET_DENSITY_RECIPROCAL >= maxOffset) {
+        return SemiMaskRepresentation::BITSET;
+    }
+    return SemiMaskRepresentation::ROARING;
+}
+
+template<typename ROARING>
+void SemiMaskReadView::build(const ROARING& roaring, offset_t maxOffset) {
+    reset();
+    const auto numMasked = roaring.cardinality();
+    if (numMasked == 0) {
+        representation = SemiMaskRepresentation::SORTED_ARRAY;
+        return;
+    }
+    // Masked offsets are expected below maxOffset, but the bitset must cover all of them.
+    const auto numOffsets = std::max<offset_t>(maxOffset, roaring.maximum() + 1);
+    representation = chooseRepresentation(numMasked, numOffsets);
+    switch (representation) {
+    case SemiMaskRepresentation::SORTED_ARRAY: {
+        offsets.reserve(numMasked);
+        for (auto it = roaring.begin(); it != roaring.end(); it++) {
+            offsets.push_back(*it);
+        }
+    } break;
+    case SemiMaskRepresentation::BITSET: {
+        bits.resize((numOffsets + 63) / 64);
+        for (auto it = roaring.begin(); it != roaring.end(); it++) {
+            const offset_t offset = *it;
+            bits[offset / 64] |= uint64_t{1} << (offset % 64);
+        }
+    } break;
+    default:
+        break;
+    }
+}
+
+template void SemiMaskReadView::build<roaring::Roaring>(const roaring::Roaring& roaring,
+    offset_t maxOffset);
+template void SemiMaskReadView::build<roaring::Roaring64Map>(const roaring::Roaring64Map& roaring,
+    offset_t maxOffset);
+
+void SemiMaskReadView::reset() {
+    if (representation == SemiMaskRepresentation::ROARING) {
+        return;
+    }
+    representation = SemiMaskRepresentation::ROARING;
+    offsets = offset_vec_t{};
+    bits = std::vector<uint64_t>{};
+}
+
+bool SemiMaskReadView::contains(offset_t offset) const {
+    switch (representation) {
+    case SemiMaskRepresentation::SORTED_ARRAY:
+        return std::binary_search(offsets.begin(), offsets.end(), offset);
+    case SemiMaskRepresentation::BITSET:
+        return offset / 64 < bits.size() && ((bits[offset / 64] >> (offset % 64)) & 1);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+offset_t SemiMaskReadView::nextMaskedOffset(offset_t offset) const {
+    switch (representation) {
+    case SemiMaskRepresentation::SORTED_ARRAY: {
+        const auto it = std::lower_bound(offsets.begin(), offsets.end(), offset);
+        return it == offsets.end() ? INVALID_OFFSET : *it;
+    }
+    case SemiMaskRepresentation::BITSET: {
+        auto wordIdx = offset / 64;
+        if (wordIdx >= bits.size()) {
+            return INVALID_OFFSET;
+        }
+        // Clear the bits of the offsets before the given one in the first word.
+        auto word = bits[wordIdx] & (~uint64_t{0} << (offset % 64));
+        while (word == 0) {
+            if (++wordIdx == bits.size()) {
+                return INVALID_OFFSET;
+            }
+            word = bits[wordIdx];
+        }
+        return wordIdx * 64 + std::countr_zero(word);
+    }
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+offset_vec_t SemiMaskReadView::range(offset_t start, offset_t end) const {
+    offset_vec_t result;
+    switch (representation) {
+    case SemiMaskRepresentation::SORTED_ARRAY: {
+        result.assign(std::lower_bound(offsets.begin(), offsets.end(), start),
+            std::lower_bound(offsets.begin(), offsets.end(), end));
+    } break;
+    case SemiMaskRepresentation::BITSET: {
+        for (auto offset = nextMaskedOffset(start); offset < end;
+             offset = nextMaskedOffset(offset + 1)) {
+            result.push_back(offset);
+        }
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return result;
+}
+
 offset_vec_t Roaring32BitmapSemiMask::collectMaskedNodes(uint64_t size) const {
     offset_vec_t result;
     result.reserve(size);
@@ -17,10 +131,16 @@ offset_vec_t Roaring32BitmapSemiMask::collectMaskedNodes(uint64_t size) const {
     return result;
 }
 
-offset_vec_t Roaring32BitmapSemiMask::range(uint32_t start, uint32_t end) {
+offset_vec_t Roaring32BitmapSemiMask::range(offset_t start, offset_t end) {
+    if (readView.getRepresentation() != SemiMaskRepresentation::ROARING) {
+        return readView.range(start, end);
+    }
+    offset_vec_t ans;
+    if (start > std::numeric_limits<uint32_t>::max()) {
+        return ans;
+    }
     auto it = roaring->begin();
     it.equalorlarger(start);
-    offset_vec_t ans;
     for (; it != roaring->end(); it++) {
         auto value = *it;
         if (value >= end) {
@@ -31,6 +151,18 @@ offset_vec_t Roaring32BitmapSemiMask::range(uint32_t start, uint32_t end) {
     return ans;
 }
 
+offset_t Roaring32BitmapSemiMask::nextMaskedOffset(offset_t offset) const {
+    if (readView.getRepresentation() != SemiMaskRepresentation::ROARING) {
+        return readView.nextMaskedOffset(offset);
+    }
+    if (offset > std::numeric_limits<uint32_t>::max()) {
+        return INVALID_OFFSET;
+    }
+    auto it = roaring->begin();
+    it.equalorlarger(offset);
+    return it == roaring->end() ? INVALID_OFFSET : *it;
+}
+
 offset_vec_t Roaring64BitmapSemiMask::collectMaskedNodes(uint64_t size) const {
     offset_vec_t result;
     result.reserve(size);
@@ -45,7 +177,10 @@ offset_vec_t Roaring64BitmapSemiMask::collectMaskedNodes(uint64_t size) const {
     return result;
 }
 
-offset_vec_t Roaring64BitmapSemiMask::range(uint32_t start, uint32_t end) {
+offset_vec_t Roaring64BitmapSemiMask::range(offset_t start, offset_t end) {
+    if (readView.getRepresentation() != SemiMaskRepresentation::ROARING) {
+        return readView.range(start, end);
+    }
     auto it = roaring->begin();
     it.move(start);
     offset_vec_t ans;
@@ -59,5 +194,16 @@ offset_vec_t Roaring64BitmapSemiMask::range(uint32_t start, uint32_t end) {
     return ans;
 }
 
+offset_t Roaring64BitmapSemiMask::nextMaskedOffset(offset_t offset) const {
+    if (readView.getRepresentation() != SemiMaskRepresentation::ROARING) {
+        return readView.nextMaskedOffset(offset);
+    }
+    auto it = roaring->begin();
+    if (!it.move(offset)) {
+        return INVALID_OFFSET;
+    }
+    return *it;
+}
+
 } // namespace common
 } // namespace ryu
@@ -46,6 +46,8 @@ void ProgressBar::finishPipeline(uint64_t queryID) {
     if (!trackProgress) {
         return;
     }
+    // Independent pipelines can finish concurrently.
+    std::lock_guard<std::mutex> lock(progressBarLock);
     numPipelinesFinished++;
     updateProgress(queryID, 0.0);
 }
@@ -0,0 +1,60 @@
+#include "common/task_system/query_tracer.h"
+
+#include "common/string_format.h"
+
+namespace ryu {
+namespace common {
+
+void QueryTracer::addEvent(std::string name, const char* category, clock_t::time_point start,
+    clock_t::time_point end) {
+    auto toUs = [&](clock_t::time_point time) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(time - startTime).count();
+    };
+    std::lock_guard lck{mtx};
+    auto [it, inserted] = threadIdxes.emplace(std::this_thread::get_id(), threadIdxes.size());
+    events.push_back(Event{std::move(name), category, it->second, toUs(start),
+        toUs(end) - toUs(start)});
+}
+
+uint64_t QueryTracer::getNumEvents() const {
+    std::lock_guard lck{mtx};
+    return events.size();
+}
+
+static std::string escapeJson(const std::string& str) {
+    std::string result;
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+std::string QueryTracer::toJson() const {
+    std::lock_guard lck{mtx};
+    std::string result = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    auto first = true;
+    auto append = [&](const std::string& event) {
+        result += first ? "\n" : ",\n";
+        result += event;
+        first = false;
+    };
+    for (auto i = 0u; i < threadIdxes.size(); i++) {
+        append(stringFormat("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},"
+                            "\"args\":{\"name\":\"Thread {}\"}}",
+            i, i));
+    }
+    for (auto& event : events) {
+        append(stringFormat("{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},"
+                            "\"ts\":{},\"dur\":{}}",
+            escapeJson(event.name), event.category, event.threadIdx, event.startInUs,
+            event.durationInUs));
+    }
+    result += "\n]}\n";
+    return result;
+}
+
+} // namespace common
+} // namespace ryu
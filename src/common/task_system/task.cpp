@@ -1,8 +1,15 @@
 #include "common/task_system/task.h"
 
+#include "common/task_system/query_tracer.h"
+
 namespace ryu {
 namespace common {
 
+void Task::execute() {
+    TraceScope scope{tracer, "task", tracer == nullptr ? std::string() : getTraceName()};
+    run();
+}
+
 bool Task::registerThread() {
     lock_t lck{taskMtx};
     if (!hasExceptionNoLock() && canRegisterNoLock()) {
@@ -17,6 +24,8 @@ void Task::deRegisterThreadAndFinalizeTask() {
     ++numThreadsFinished;
     if (!hasExceptionNoLock() && isCompletedNoLock()) {
         try {
+            TraceScope scope{tracer, "finalize",
+                tracer == nullptr ? std::string() : getTraceName()};
             finalize();
         } catch (std::exception& e) {
             setExceptionNoLock(std::current_exception());
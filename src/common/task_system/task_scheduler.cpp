@@ -1,5 +1,9 @@
 #include "common/task_system/task_scheduler.h"
 
+#include <unordered_map>
+
+#include "common/numa_utils.h"
+#include "common/vector/vector_buffer.h"
 #include "main/client_context.h"
 #include "main/database.h"
 #include "processor/processor.h"
@@ -10,23 +14,58 @@
 #include <pthread/qos.h>
 #endif
 
+#if defined(__linux__) && !defined(__SINGLE_THREADED__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace ryu {
 namespace common {
 
 #ifndef __SINGLE_THREADED__
 
+#if defined(__linux__)
+static void pinThreadToCPUs(std::thread& thread, const std::vector<uint64_t>& cpus) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    // Pinning is best effort, e.g. the process might be restricted to a subset of CPUs.
+    auto status = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+    KU_UNUSED(status);
+}
+#endif
+
 #if defined(__APPLE__)
-TaskScheduler::TaskScheduler(uint64_t numWorkerThreads, uint32_t threadQos)
+TaskScheduler::TaskScheduler(uint64_t numWorkerThreads, bool enableWorkStealing,
+    uint32_t threadQos)
 #else
-TaskScheduler::TaskScheduler(uint64_t numWorkerThreads)
+TaskScheduler::TaskScheduler(uint64_t numWorkerThreads, bool enableWorkStealing)
 #endif
-    : stopWorkerThreads{false}, nextScheduledTaskID{0} {
+    : stopWorkerThreads{false}, nextScheduledTaskID{0},
+      enableWorkStealing{enableWorkStealing && numWorkerThreads > 0}, queueEpoch{0} {
 #if defined(__APPLE__)
     this->threadQos = threadQos;
 #endif
+    if (this->enableWorkStealing) {
+        for (auto n = 0u; n < numWorkerThreads; ++n) {
+            workerQueues.push_back(std::make_unique<WorkerQueue>());
+        }
+    }
     for (auto n = 0u; n < numWorkerThreads; ++n) {
-        workerThreads.emplace_back([&] { runWorkerThread(); });
+        workerThreads.emplace_back([this, n] { runWorkerThread(n); });
     }
+#if defined(__linux__)
+    if (this->enableWorkStealing) {
+        auto nodeCPUs = NUMAUtils::getNodeCPUs();
+        for (auto n = 0u; n < workerThreads.size() && !nodeCPUs.empty(); ++n) {
+            pinThreadToCPUs(workerThreads[n], nodeCPUs[n % nodeCPUs.size()]);
+        }
+    }
+#endif
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -41,12 +80,36 @@ TaskScheduler::~TaskScheduler() {
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
     processor::ExecutionContext* context, bool launchNewWorkerThread) {
-    for (auto& dependency : task->children) {
-        scheduleTaskAndWaitOrError(dependency, context);
-        if (dependency->terminate()) {
-            return;
+    task->setTracer(context->tracer);
+    if (task->hasIndependentChildren() && task->children.size() > 1 &&
+        task->getMaxNumConcurrentChildren() > 1 && !workerThreads.empty()) {
+        scheduleIndependentTasksAndWaitOrError(task->children, context,
+            task->getMaxNumConcurrentChildren());
+        for (auto& dependency : task->children) {
+            if (dependency->terminate()) {
+                return;
+            }
+        }
+    } else {
+        for (auto& dependency : task->children) {
+            scheduleTaskAndWaitOrError(dependency, context);
+            if (dependency->terminate()) {
+                return;
+            }
         }
     }
+    if (!launchNewWorkerThread && task->canRunOnCallingThread() &&
+        !context->clientContext->hasTimeout()) {
+        // A single-threaded task of a point query would keep this thread waiting while one worker
+        // runs it, so it is run here instead to avoid the hand-off to a worker. Tasks with a
+        // timeout still go through the queue because the waiting thread enforces it.
+        task->registerThread();
+        runTask(task.get());
+        if (task->hasException()) {
+            std::rethrow_exception(task->getExceptionPtr());
+        }
+        return;
+    }
     std::thread newWorkerThread;
     if (launchNewWorkerThread) {
         // Note that newWorkerThread is not executing yet. However, we still call
@@ -57,8 +120,8 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
         task->registerThread();
         newWorkerThread = std::thread(runTask, task.get());
     }
-    auto scheduledTask = pushTaskIntoQueue(task);
-    cv.notify_all();
+    auto scheduledTask = pushTaskIntoQueue(task, *context);
+    notifyWorkerThreads();
     std::unique_lock<std::mutex> taskLck{task->taskMtx, std::defer_lock};
     while (true) {
         taskLck.lock();
@@ -98,7 +161,79 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
     }
 }
 
-void TaskScheduler::runWorkerThread() {
+std::shared_ptr<ScheduledTask> TaskScheduler::scheduleTask(const std::shared_ptr<Task>& task,
+    processor::ExecutionContext* context) {
+    KU_ASSERT(task->children.empty());
+    task->setTracer(context->tracer);
+    auto scheduledTask = pushTaskIntoQueue(task, *context);
+    notifyWorkerThreads();
+    return scheduledTask;
+}
+
+void TaskScheduler::runOrWaitTaskOrError(const std::shared_ptr<ScheduledTask>& scheduledTask) {
+    auto& task = scheduledTask->task;
+    while (task->registerThread()) {
+        runTask(task.get());
+    }
+    {
+        lock_t taskLck{task->taskMtx};
+        task->cv.wait(taskLck, [&] { return task->isCompletedNoLock(); });
+    }
+    if (task->hasException()) {
+        removeErroringTask(scheduledTask->ID);
+        std::rethrow_exception(task->getExceptionPtr());
+    }
+}
+
+void TaskScheduler::notifyWorkerThreads() {
+    if (enableWorkStealing) {
+        // Take the global lock so that a worker that is about to sleep either sees the new epoch
+        // or is already waiting and receives the notification.
+        lock_t lck{taskSchedulerMtx};
+        queueEpoch.fetch_add(1);
+    }
+    cv.notify_all();
+}
+
+void TaskScheduler::scheduleIndependentTasksAndWaitOrError(
+    const std::vector<std::shared_ptr<Task>>& tasks, processor::ExecutionContext* context,
+    uint64_t maxNumConcurrentTasks) {
+    std::atomic<uint64_t> nextTaskIdx{0};
+    std::atomic<bool> hasError{false};
+    std::vector<std::exception_ptr> exceptions(tasks.size());
+    auto scheduleTasks = [&]() {
+        while (!hasError) {
+            const auto taskIdx = nextTaskIdx.fetch_add(1);
+            if (taskIdx >= tasks.size()) {
+                return;
+            }
+            try {
+                scheduleTaskAndWaitOrError(tasks[taskIdx], context);
+            } catch (std::exception&) {
+                exceptions[taskIdx] = std::current_exception();
+                hasError = true;
+            }
+        }
+    };
+    // The calling thread schedules tasks as well.
+    const auto numThreads =
+        std::min<uint64_t>({tasks.size(), workerThreads.size(), maxNumConcurrentTasks});
+    std::vector<std::thread> threads;
+    for (auto i = 1u; i < numThreads; ++i) {
+        threads.emplace_back(scheduleTasks);
+    }
+    scheduleTasks();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& exception : exceptions) {
+        if (exception != nullptr) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+void TaskScheduler::runWorkerThread(uint64_t workerID) {
 #if defined(__APPLE__)
     qos_class_t qosClass = (qos_class_t)threadQos;
     if (qosClass != QOS_CLASS_DEFAULT && qosClass != QOS_CLASS_UNSPECIFIED) {
@@ -106,6 +241,11 @@ void TaskScheduler::runWorkerThread() {
         KU_UNUSED(pthreadQosStatus);
     }
 #endif
+    VectorBufferCache::enableThreadCache();
+    if (enableWorkStealing) {
+        runWorkStealingWorkerThread(workerID);
+        return;
+    }
     std::unique_lock<std::mutex> lck{taskSchedulerMtx, std::defer_lock};
     std::exception_ptr exceptionPtr = nullptr;
     std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
@@ -128,24 +268,82 @@ void TaskScheduler::runWorkerThread() {
             scheduledTask->task->deRegisterThreadAndFinalizeTask();
             scheduledTask = nullptr;
         }
-        cv.wait(lck, [&] {
-            scheduledTask = getTaskAndRegister();
-            return scheduledTask != nullptr || stopWorkerThreads;
-        });
+        scheduledTask = getTaskAndRegister();
+        if (scheduledTask == nullptr) {
+            // The thread is about to go idle, so it doesn't keep the vector buffers of the
+            // queries it worked on.
+            lck.unlock();
+            VectorBufferCache::releaseThreadCache();
+            lck.lock();
+            cv.wait(lck, [&] {
+                scheduledTask = getTaskAndRegister();
+                return scheduledTask != nullptr || stopWorkerThreads;
+            });
+        }
         lck.unlock();
         if (stopWorkerThreads) {
             return;
         }
         try {
-            scheduledTask->task->run();
+            scheduledTask->task->execute();
         } catch (std::exception& e) {
             exceptionPtr = std::current_exception();
         }
     }
 }
+
+void TaskScheduler::runWorkStealingWorkerThread(uint64_t workerID) {
+    std::exception_ptr exceptionPtr = nullptr;
+    std::shared_ptr<ScheduledTask> scheduledTask = nullptr;
+    while (true) {
+        // Unlike the global queue mode, threads do not grab a global lock before deregistering.
+        // Writes done by threads in Task_j are still visible to Task_{j+1} that depends on Task_j:
+        // deregistering happens under Task_j's lock, and Task_{j+1} is only pushed by the user
+        // thread after it observed under the same lock that Task_j is completed.
+        if (scheduledTask != nullptr) {
+            if (exceptionPtr != nullptr) {
+                scheduledTask->task->setException(exceptionPtr);
+                exceptionPtr = nullptr;
+            }
+            scheduledTask->task->deRegisterThreadAndFinalizeTask();
+            scheduledTask = nullptr;
+        }
+        while (true) {
+            auto epoch = queueEpoch.load();
+            scheduledTask = stealTaskAndRegister(workerID);
+            if (scheduledTask != nullptr) {
+                break;
+            }
+            VectorBufferCache::releaseThreadCache();
+            lock_t lck{taskSchedulerMtx};
+            cv.wait(lck, [&] { return stopWorkerThreads || queueEpoch.load() != epoch; });
+            if (stopWorkerThreads) {
+                return;
+            }
+        }
+        try {
+            scheduledTask->task->execute();
+        } catch (std::exception& e) {
+            exceptionPtr = std::current_exception();
+        }
+    }
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::stealTaskAndRegister(uint64_t workerID) {
+    auto numQueues = workerQueues.size();
+    for (auto i = 0u; i < numQueues; ++i) {
+        auto& workerQueue = *workerQueues[(workerID + i) % numQueues];
+        lock_t lck{workerQueue.mtx};
+        auto scheduledTask = getTaskAndRegister(workerQueue.taskQueue);
+        if (scheduledTask != nullptr) {
+            return scheduledTask;
+        }
+    }
+    return nullptr;
+}
 #else
 // Single-threaded version of TaskScheduler
-TaskScheduler::TaskScheduler(uint64_t) : stopWorkerThreads{false}, nextScheduledTaskID{0} {}
+TaskScheduler::TaskScheduler(uint64_t, bool) : stopWorkerThreads{false}, nextScheduledTaskID{0} {}
 
 TaskScheduler::~TaskScheduler() {
     stopWorkerThreads = true;
@@ -153,6 +351,7 @@ TaskScheduler::~TaskScheduler() {
 
 void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
     processor::ExecutionContext* context, bool) {
+    task->setTracer(context->tracer);
     for (auto& dependency : task->children) {
         scheduleTaskAndWaitOrError(dependency, context);
         if (dependency->terminate()) {
@@ -169,40 +368,109 @@ void TaskScheduler::scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task
 }
 #endif
 
-std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task) {
+uint64_t TaskScheduler::getNumQueuedTasks() {
+    uint64_t numTasks = 0;
+    {
+        lock_t lck{taskSchedulerMtx};
+        numTasks = taskQueue.size();
+    }
+#ifndef __SINGLE_THREADED__
+    for (auto& workerQueue : workerQueues) {
+        lock_t lck{workerQueue->mtx};
+        numTasks += workerQueue->taskQueue.size();
+    }
+#endif
+    return numTasks;
+}
+
+uint64_t TaskScheduler::getNumScheduledTasks() {
+    lock_t lck{taskSchedulerMtx};
+    return nextScheduledTaskID;
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+    const processor::ExecutionContext& context) {
+    const auto maxNumQueryThreads = context.clientContext->getMaxNumThreadForExec();
+#ifndef __SINGLE_THREADED__
+    if (enableWorkStealing) {
+        uint64_t scheduledTaskID = 0;
+        {
+            lock_t lck{taskSchedulerMtx};
+            scheduledTaskID = nextScheduledTaskID++;
+        }
+        auto scheduledTask = std::make_shared<ScheduledTask>(task, scheduledTaskID,
+            context.queryID, maxNumQueryThreads);
+        auto& workerQueue = *workerQueues[scheduledTaskID % workerQueues.size()];
+        lock_t lck{workerQueue.mtx};
+        workerQueue.taskQueue.push_back(scheduledTask);
+        return scheduledTask;
+    }
+#endif
     lock_t lck{taskSchedulerMtx};
-    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
+    auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++,
+        context.queryID, maxNumQueryThreads);
     taskQueue.push_back(scheduledTask);
     return scheduledTask;
 }
 
 std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    if (taskQueue.empty()) {
+    return getTaskAndRegister(taskQueue);
+}
+
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister(
+    std::deque<std::shared_ptr<ScheduledTask>>& queue) {
+    // Tasks that have completed without an exception are removed. Tasks that are not completed
+    // yet or have an exception are kept. Recall erroring tasks need to be manually removed.
+    std::erase_if(queue, [](const std::shared_ptr<ScheduledTask>& scheduledTask) {
+        return scheduledTask->task->isCompletedSuccessfully();
+    });
+    if (queue.empty()) {
         return nullptr;
     }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
-        auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
-            // (i) maximum number of threads have registered for task and the task is completed
-            // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
-            if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
-                ++it;
-            }
-        } else {
-            return *it;
+    // Workers go to a task of the query with the fewest active threads, so that a query scheduled
+    // behind a long running one is picked up by the next free worker instead of all workers piling
+    // onto the query at the front. Ties are broken in FIFO order. Queries with as many active
+    // threads as their connection allows are skipped.
+    std::unordered_map<uint64_t, uint64_t> numActiveThreadsPerQuery;
+    for (auto& scheduledTask : queue) {
+        numActiveThreadsPerQuery[scheduledTask->queryID] +=
+            scheduledTask->task->getNumActiveThreads();
+    }
+    std::shared_ptr<ScheduledTask> leastLoadedTask = nullptr;
+    auto minNumActiveThreads = UINT64_MAX;
+    for (auto& scheduledTask : queue) {
+        const auto numActiveThreads = numActiveThreadsPerQuery.at(scheduledTask->queryID);
+        if (numActiveThreads >= scheduledTask->maxNumQueryThreads ||
+            numActiveThreads >= minNumActiveThreads || !scheduledTask->task->canRegister()) {
+            continue;
+        }
+        leastLoadedTask = scheduledTask;
+        minNumActiveThreads = numActiveThreads;
+        if (numActiveThreads == 0) {
+            break;
         }
     }
+    // Registering can only fail if the task completed or errored in the meantime.
+    if (leastLoadedTask != nullptr && leastLoadedTask->task->registerThread()) {
+        return leastLoadedTask;
+    }
     return nullptr;
 }
 
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
+#ifndef __SINGLE_THREADED__
+    if (enableWorkStealing) {
+        auto& workerQueue = *workerQueues[scheduledTaskID % workerQueues.size()];
+        lock_t lck{workerQueue.mtx};
+        for (auto it = workerQueue.taskQueue.begin(); it != workerQueue.taskQueue.end(); ++it) {
+            if (scheduledTaskID == (*it)->ID) {
+                workerQueue.taskQueue.erase(it);
+                return;
+            }
+        }
+        return;
+    }
+#endif
     lock_t lck{taskSchedulerMtx};
     for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
         if (scheduledTaskID == (*it)->ID) {
@@ -214,7 +482,7 @@ void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
 
 void TaskScheduler::runTask(Task* task) {
     try {
-        task->run();
+        task->execute();
         task->deRegisterThreadAndFinalizeTask();
     } catch (std::exception& e) {
         task->setException(std::current_exception());
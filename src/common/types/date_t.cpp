@@ -260,6 +260,47 @@ bool Date::parseDoubleDigit(const char* buf, uint64_t len, uint64_t& pos, int32_
     return false;
 }
 
+static bool tryFinishDate(const char* buf, uint64_t len, uint64_t& pos, int32_t year,
+    int32_t month, int32_t day, date_t& result, bool allowTrailing) {
+    // skip trailing spaces
+    while (pos < len && StringUtils::isSpace((unsigned char)buf[pos])) {
+        pos++;
+    }
+    // check position. if end was not reached, non-space chars remaining
+    if (pos < len && !allowTrailing) {
+        return false;
+    }
+    if (!Date::isValid(year, month, day)) {
+        return false;
+    }
+    result = Date::fromDate(year, month, day);
+    return true;
+}
+
+// Parses the fixed-width ISO-8601 form YYYY-MM-DD, which is what almost all ingested dates look
+// like, without the loops of the general parser. Returns false if buf does not start with it.
+static bool tryParseISODate(const char* buf, uint64_t len, uint64_t& pos, int32_t& year,
+    int32_t& month, int32_t& day) {
+    static constexpr uint64_t ISO_DATE_LENGTH = 10;
+    if (len - pos < ISO_DATE_LENGTH) {
+        return false;
+    }
+    const auto date = buf + pos;
+    if (date[4] != '-' || date[7] != '-') {
+        return false;
+    }
+    for (auto i : {0, 1, 2, 3, 5, 6, 8, 9}) {
+        if (!StringUtils::CharacterIsDigit(date[i])) {
+            return false;
+        }
+    }
+    year = (date[0] - '0') * 1000 + (date[1] - '0') * 100 + (date[2] - '0') * 10 + (date[3] - '0');
+    month = (date[5] - '0') * 10 + (date[6] - '0');
+    day = (date[8] - '0') * 10 + (date[9] - '0');
+    pos += ISO_DATE_LENGTH;
+    return true;
+}
+
 // Checks if the date std::string given in buf complies with the YYYY:MM:DD format. Ignores leading
 // and trailing spaces. Removes from the original DuckDB code the following features:
 // 1) we don't parse "negative years", i.e., date formats that start with -.
@@ -283,6 +324,10 @@ bool Date::tryConvertDate(const char* buf, uint64_t len, uint64_t& pos, date_t&
         return false;
     }
 
+    if (tryParseISODate(buf, len, pos, year, month, day)) {
+        return tryFinishDate(buf, len, pos, year, month, day, result, allowTrailing);
+    }
+
     if (!StringUtils::CharacterIsDigit(buf[pos])) {
         return false;
     }
@@ -323,22 +368,7 @@ bool Date::tryConvertDate(const char* buf, uint64_t len, uint64_t& pos, date_t&
     if (!Date::parseDoubleDigit(buf, len, pos, day)) {
         return false;
     }
-
-    // skip trailing spaces
-    while (pos < len && StringUtils::isSpace((unsigned char)buf[pos])) {
-        pos++;
-    }
-    // check position. if end was not reached, non-space chars remaining
-    if (pos < len && !allowTrailing) {
-        return false;
-    }
-
-    try {
-        result = Date::fromDate(year, month, day);
-    } catch (ConversionException& exc) {
-        return false;
-    }
-    return true;
+    return tryFinishDate(buf, len, pos, year, month, day, result, allowTrailing);
 }
 
 date_t Date::fromCString(const char* str, uint64_t len) {
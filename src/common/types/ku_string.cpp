@@ -54,6 +54,10 @@ bool ku_string_t::operator==(const ku_string_t& rhs) const {
         sizeof(uint32_t) +
         std::min((uint64_t)len, static_cast<uint64_t>(ku_string_t::PREFIX_LENGTH));
     if (!memcmp(this, &rhs, numBytesOfLenAndPrefix)) {
+        // Duplicated strings scanned from a dictionary share their overflow data.
+        if (!isShortString(len) && overflowPtr == rhs.overflowPtr) {
+            return true;
+        }
         // If length and prefix of a and b are equal, we compare the overflow buffer.
         return !memcmp(getData(), rhs.getData(), len);
     }
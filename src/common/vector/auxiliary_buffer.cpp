@@ -52,8 +52,18 @@ void ListAuxiliaryBuffer::resize(uint64_t numValues) {
     size = numValues;
 }
 
+void ListAuxiliaryBuffer::reserve(uint64_t numValues) {
+    if (numValues <= capacity) {
+        return;
+    }
+    while (numValues > capacity) {
+        capacity *= CHUNK_RESIZE_RATIO;
+    }
+    resizeDataVector(dataVector.get());
+}
+
 void ListAuxiliaryBuffer::resizeDataVector(ValueVector* dataVector) {
-    auto buffer = std::make_unique<uint8_t[]>(capacity * dataVector->getNumBytesPerValue());
+    auto buffer = VectorBufferCache::allocate(capacity * dataVector->getNumBytesPerValue());
     memcpy(buffer.get(), dataVector->valueBuffer.get(), size * dataVector->getNumBytesPerValue());
     dataVector->valueBuffer = std::move(buffer);
     dataVector->nullMask.resize(capacity);
@@ -370,7 +370,7 @@ uint32_t ValueVector::getDataTypeSize(const LogicalType& type) {
 }
 
 void ValueVector::initializeValueBuffer() {
-    valueBuffer = std::make_unique<uint8_t[]>(numBytesPerValue * DEFAULT_VECTOR_CAPACITY);
+    valueBuffer = VectorBufferCache::allocate(numBytesPerValue * DEFAULT_VECTOR_CAPACITY);
     if (dataType.getPhysicalType() == PhysicalTypeID::STRUCT) {
         // For struct valueVectors, each struct_entry_t stores its current position in the
         // valueVector.
@@ -566,7 +566,10 @@ void ListVector::copyListEntryAndBufferMetaData(ValueVector& vector,
             vector.setValue(pos, other.getValue<list_entry_t>(otherPos));
         }
     }
-    // Copy buffer metadata
+    copyBufferMetaData(vector, other);
+}
+
+void ListVector::copyBufferMetaData(ValueVector& vector, const ValueVector& other) {
     auto& buffer = getAuxBufferUnsafe(vector);
     auto& otherBuffer = getAuxBuffer(other);
     buffer.capacity = otherBuffer.capacity;
@@ -0,0 +1,105 @@
+#include "common/vector/vector_buffer.h"
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <vector>
+
+#include "common/system_config.h"
+
+namespace ryu {
+namespace common {
+
+namespace {
+
+// Buffers of DEFAULT_VECTOR_CAPACITY values of 1, 2, 4, 8 and 16 bytes.
+constexpr uint64_t NUM_SIZE_CLASSES = 5;
+
+constexpr uint64_t INVALID_SIZE_CLASS = UINT64_MAX;
+
+uint64_t getSizeClass(uint64_t size) {
+    if (size % DEFAULT_VECTOR_CAPACITY != 0) {
+        return INVALID_SIZE_CLASS;
+    }
+    const auto numBytesPerValue = size / DEFAULT_VECTOR_CAPACITY;
+    if (!std::has_single_bit(numBytesPerValue) ||
+        numBytesPerValue >= (uint64_t{1} << NUM_SIZE_CLASSES)) {
+        return INVALID_SIZE_CLASS;
+    }
+    return std::countr_zero(numBytesPerValue);
+}
+
+struct ThreadBufferCache {
+    std::array<std::vector<uint8_t*>, NUM_SIZE_CLASSES> buffers;
+    uint64_t numCachedBytes = 0;
+    bool enabled = false;
+
+    ~ThreadBufferCache();
+
+    void release();
+};
+
+// Vectors may still be freed by destructors that run after the cache of the thread, e.g. those of
+// static objects.
+thread_local bool threadCacheDestroyed = false;
+thread_local ThreadBufferCache threadCache;
+
+ThreadBufferCache::~ThreadBufferCache() {
+    threadCacheDestroyed = true;
+    release();
+}
+
+void ThreadBufferCache::release() {
+    for (auto& sizeClassBuffers : buffers) {
+        for (const auto buffer : sizeClassBuffers) {
+            delete[] buffer;
+        }
+        sizeClassBuffers.clear();
+    }
+    numCachedBytes = 0;
+}
+
+} // namespace
+
+void VectorBufferDeleter::operator()(uint8_t* buffer) const {
+    const auto sizeClass = getSizeClass(size);
+    if (sizeClass == INVALID_SIZE_CLASS || threadCacheDestroyed || !threadCache.enabled ||
+        threadCache.numCachedBytes + size > VectorBufferCache::MAX_CACHED_BYTES) {
+        delete[] buffer;
+        return;
+    }
+    threadCache.buffers[sizeClass].push_back(buffer);
+    threadCache.numCachedBytes += size;
+}
+
+vector_buffer_t VectorBufferCache::allocate(uint64_t size) {
+    const auto sizeClass = getSizeClass(size);
+    if (sizeClass != INVALID_SIZE_CLASS && !threadCacheDestroyed &&
+        !threadCache.buffers[sizeClass].empty()) {
+        const auto buffer = threadCache.buffers[sizeClass].back();
+        threadCache.buffers[sizeClass].pop_back();
+        threadCache.numCachedBytes -= size;
+        memset(buffer, 0, size);
+        return vector_buffer_t{buffer, VectorBufferDeleter{size}};
+    }
+    return vector_buffer_t{new uint8_t[size](), VectorBufferDeleter{size}};
+}
+
+void VectorBufferCache::enableThreadCache() {
+    if (!threadCacheDestroyed) {
+        threadCache.enabled = true;
+    }
+}
+
+void VectorBufferCache::releaseThreadCache() {
+    if (!threadCacheDestroyed) {
+        threadCache.release();
+    }
+}
+
+uint64_t VectorBufferCache::getNumThreadCachedBytes() {
+    return threadCacheDestroyed ? 0 : threadCache.numCachedBytes;
+}
+
+} // namespace common
+} // namespace ryu
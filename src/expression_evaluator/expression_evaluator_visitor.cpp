@@ -13,6 +13,9 @@ void ExpressionEvaluatorVisitor::visitSwitch(ExpressionEvaluator* evaluator) {
     case EvaluatorType::FUNCTION: {
         visitFunction(evaluator);
     } break;
+    case EvaluatorType::FUSED: {
+        visitFused(evaluator);
+    } break;
     case EvaluatorType::LAMBDA_PARAM: {
         visitLambdaParam(evaluator);
     } break;
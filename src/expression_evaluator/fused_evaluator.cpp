@@ -0,0 +1,312 @@
+#include "expression_evaluator/fused_evaluator.h"
+
+#include <cmath>
+
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "common/system_config.h"
+#include "common/type_utils.h"
+#include "function/arithmetic/add.h"
+#include "function/arithmetic/divide.h"
+#include "function/arithmetic/modulo.h"
+#include "function/arithmetic/multiply.h"
+#include "function/arithmetic/subtract.h"
+#include "function/arithmetic/vector_arithmetic_functions.h"
+#include "function/comparison/comparison_functions.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+using namespace ryu::function;
+using namespace ryu::processor;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace evaluator {
+
+// Decimals share physical types with integers but have their own arithmetic, so they are
+// excluded by logical type.
+static bool isFusableType(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::FLOAT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static std::optional<FusedOperator> getFusedOperator(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::EQUALS:
+        return FusedOperator::EQUALS;
+    case ExpressionType::NOT_EQUALS:
+        return FusedOperator::NOT_EQUALS;
+    case ExpressionType::GREATER_THAN:
+        return FusedOperator::GREATER_THAN;
+    case ExpressionType::GREATER_THAN_EQUALS:
+        return FusedOperator::GREATER_THAN_EQUALS;
+    case ExpressionType::LESS_THAN:
+        return FusedOperator::LESS_THAN;
+    case ExpressionType::LESS_THAN_EQUALS:
+        return FusedOperator::LESS_THAN_EQUALS;
+    case ExpressionType::FUNCTION: {
+        auto& name = expression.constCast<ScalarFunctionExpression>().getFunction().name;
+        if (name == AddFunction::name) {
+            return FusedOperator::ADD;
+        } else if (name == SubtractFunction::name) {
+            return FusedOperator::SUBTRACT;
+        } else if (name == MultiplyFunction::name) {
+            return FusedOperator::MULTIPLY;
+        } else if (name == DivideFunction::name) {
+            return FusedOperator::DIVIDE;
+        } else if (name == ModuloFunction::name) {
+            return FusedOperator::MODULO;
+        }
+        return std::nullopt;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+std::optional<FusedStep> FusedStep::get(const Expression& expression, bool isRoot) {
+    auto op = getFusedOperator(expression);
+    if (!op.has_value() || expression.getNumChildren() != 2) {
+        return std::nullopt;
+    }
+    auto isComparison = *op >= FusedOperator::EQUALS;
+    // Comparisons return booleans, so they can only end a chain.
+    if (isComparison && !isRoot) {
+        return std::nullopt;
+    }
+    auto& function = expression.constCast<ScalarFunctionExpression>().getFunction();
+    auto& type = expression.getChild(0)->getDataType();
+    if (!isFusableType(type) || expression.getChild(1)->getDataType() != type ||
+        function.parameterTypeIDs.size() != 2 ||
+        function.parameterTypeIDs[0] != type.getLogicalTypeID() ||
+        function.parameterTypeIDs[1] != type.getLogicalTypeID() ||
+        (!isComparison && expression.getDataType() != type)) {
+        return std::nullopt;
+    }
+    auto isLeftLiteral = expression.getChild(0)->expressionType == ExpressionType::LITERAL;
+    auto isRightLiteral = expression.getChild(1)->expressionType == ExpressionType::LITERAL;
+    if (isLeftLiteral == isRightLiteral) {
+        return std::nullopt;
+    }
+    auto& literal = expression.getChild(isLeftLiteral ? 0 : 1)->constCast<LiteralExpression>();
+    if (literal.getValue().isNull()) {
+        return std::nullopt;
+    }
+    return FusedStep{*op, literal.getValue(), isLeftLiteral};
+}
+
+template<typename T>
+concept FusableTypes = (std::integral<T> && !std::is_same_v<T, bool>) || std::floating_point<T>;
+
+template<typename T, typename FUNC>
+static void applyArithmetic(T* values, sel_t numValues, T constant, bool isConstantLeft) {
+    if (isConstantLeft) {
+        for (sel_t i = 0; i < numValues; i++) {
+            auto value = values[i];
+            FUNC::operation(constant, value, values[i]);
+        }
+    } else {
+        for (sel_t i = 0; i < numValues; i++) {
+            auto value = values[i];
+            FUNC::operation(value, constant, values[i]);
+        }
+    }
+}
+
+template<typename T, typename FUNC>
+static void applyComparison(const T* values, sel_t numValues, T constant, bool isConstantLeft,
+    uint8_t* results) {
+    if (isConstantLeft) {
+        for (sel_t i = 0; i < numValues; i++) {
+            FUNC::operation(constant, values[i], results[i], nullptr /* leftVector */,
+                nullptr /* rightVector */);
+        }
+    } else {
+        for (sel_t i = 0; i < numValues; i++) {
+            FUNC::operation(values[i], constant, results[i], nullptr /* leftVector */,
+                nullptr /* rightVector */);
+        }
+    }
+}
+
+template<typename T>
+static void applyStep(const FusedStep& step, T* values, sel_t numValues, uint8_t* results) {
+    auto constant = step.constant.getValue<T>();
+    switch (step.op) {
+    case FusedOperator::ADD: {
+        applyArithmetic<T, Add>(values, numValues, constant, step.isConstantLeft);
+    } break;
+    case FusedOperator::SUBTRACT: {
+        applyArithmetic<T, Subtract>(values, numValues, constant, step.isConstantLeft);
+    } break;
+    case FusedOperator::MULTIPLY: {
+        applyArithmetic<T, Multiply>(values, numValues, constant, step.isConstantLeft);
+    } break;
+    case FusedOperator::DIVIDE: {
+        applyArithmetic<T, Divide>(values, numValues, constant, step.isConstantLeft);
+    } break;
+    case FusedOperator::MODULO: {
+        applyArithmetic<T, Modulo>(values, numValues, constant, step.isConstantLeft);
+    } break;
+    case FusedOperator::EQUALS: {
+        applyComparison<T, Equals>(values, numValues, constant, step.isConstantLeft, results);
+    } break;
+    case FusedOperator::NOT_EQUALS: {
+        applyComparison<T, NotEquals>(values, numValues, constant, step.isConstantLeft, results);
+    } break;
+    case FusedOperator::GREATER_THAN: {
+        applyComparison<T, GreaterThan>(values, numValues, constant, step.isConstantLeft,
+            results);
+    } break;
+    case FusedOperator::GREATER_THAN_EQUALS: {
+        applyComparison<T, GreaterThanEquals>(values, numValues, constant, step.isConstantLeft,
+            results);
+    } break;
+    case FusedOperator::LESS_THAN: {
+        applyComparison<T, LessThan>(values, numValues, constant, step.isConstantLeft, results);
+    } break;
+    case FusedOperator::LESS_THAN_EQUALS: {
+        applyComparison<T, LessThanEquals>(values, numValues, constant, step.isConstantLeft,
+            results);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+FusedExpressionEvaluator::FusedExpressionEvaluator(std::shared_ptr<Expression> expression,
+    std::unique_ptr<ExpressionEvaluator> input, std::vector<FusedStep> steps)
+    : ExpressionEvaluator{type_, std::move(expression), evaluator_vector_t{}},
+      steps{std::move(steps)} {
+    children.push_back(std::move(input));
+}
+
+std::unique_ptr<ExpressionEvaluator> FusedExpressionEvaluator::copy() {
+    return std::make_unique<FusedExpressionEvaluator>(expression, children[0]->copy(), steps);
+}
+
+void FusedExpressionEvaluator::resolveResultVector(const ResultSet& /*resultSet*/,
+    MemoryManager* memoryManager) {
+    resultVector = std::make_shared<ValueVector>(expression->dataType.copy(), memoryManager);
+    resolveResultStateFromChildren({children[0].get()});
+}
+
+// Gathers the non-null input values and their positions without branches and applies all steps
+// to them. Only the last step can be a comparison, whose results are written to results.
+template<typename T>
+sel_t FusedExpressionEvaluator::evaluateSteps(const ValueVector& input, T* values,
+    sel_t* positions, uint8_t* results) const {
+    auto data = reinterpret_cast<const T*>(input.getData());
+    sel_t numValues = 0;
+    if (input.hasNoNullsGuarantee()) {
+        input.state->getSelVector().forEach([&](auto pos) {
+            positions[numValues] = pos;
+            values[numValues++] = data[pos];
+        });
+    } else {
+        input.state->getSelVector().forEach([&](auto pos) {
+            positions[numValues] = pos;
+            values[numValues] = data[pos];
+            numValues += !input.isNull(pos);
+        });
+    }
+    for (auto& step : steps) {
+        applyStep<T>(step, values, numValues, results);
+    }
+    return numValues;
+}
+
+template<typename T>
+void FusedExpressionEvaluator::evaluateInternal(const ValueVector& input) {
+    T values[DEFAULT_VECTOR_CAPACITY];
+    sel_t positions[DEFAULT_VECTOR_CAPACITY];
+    uint8_t results[DEFAULT_VECTOR_CAPACITY];
+    auto numValues = evaluateSteps<T>(input, values, positions, results);
+    auto isComparison = steps.back().isComparison();
+    if (isResultFlat_) {
+        auto pos = resultVector->state->getSelVector()[0];
+        resultVector->setNull(pos, numValues == 0);
+        if (numValues > 0) {
+            if (isComparison) {
+                resultVector->setValue<bool>(pos, results[0]);
+            } else {
+                resultVector->setValue<T>(pos, values[0]);
+            }
+        }
+        return;
+    }
+    // The result shares the state of the input, so non-null positions are the same.
+    if (input.hasNoNullsGuarantee()) {
+        resultVector->setAllNonNull();
+    } else {
+        input.state->getSelVector().forEach(
+            [&](auto pos) { resultVector->setNull(pos, input.isNull(pos)); });
+    }
+    if (isComparison) {
+        auto resultData = reinterpret_cast<bool*>(resultVector->getData());
+        for (sel_t i = 0; i < numValues; i++) {
+            resultData[positions[i]] = results[i];
+        }
+    } else {
+        auto resultData = reinterpret_cast<T*>(resultVector->getData());
+        for (sel_t i = 0; i < numValues; i++) {
+            resultData[positions[i]] = values[i];
+        }
+    }
+}
+
+void FusedExpressionEvaluator::evaluate() {
+    children[0]->evaluate();
+    auto& input = *children[0]->resultVector;
+    TypeUtils::visit(
+        input.dataType.getPhysicalType(),
+        [&]<FusableTypes T>(T) { evaluateInternal<T>(input); }, [](auto) { KU_UNREACHABLE; });
+}
+
+template<typename T>
+bool FusedExpressionEvaluator::selectValues(const ValueVector& input, SelectionVector& selVector) {
+    T values[DEFAULT_VECTOR_CAPACITY];
+    sel_t positions[DEFAULT_VECTOR_CAPACITY];
+    uint8_t results[DEFAULT_VECTOR_CAPACITY];
+    auto numValues = evaluateSteps<T>(input, values, positions, results);
+    if (isResultFlat_) {
+        return numValues > 0 && results[0];
+    }
+    // Positions were copied out, so the selection vector may be the one of the input.
+    auto selectedPositionsBuffer = selVector.getMutableBuffer();
+    sel_t numSelectedValues = 0;
+    for (sel_t i = 0; i < numValues; i++) {
+        selectedPositionsBuffer[numSelectedValues] = positions[i];
+        numSelectedValues += results[i];
+    }
+    selVector.setSelSize(numSelectedValues);
+    return numSelectedValues > 0;
+}
+
+bool FusedExpressionEvaluator::selectInternal(SelectionVector& selVector) {
+    KU_ASSERT(steps.back().isComparison());
+    children[0]->evaluate();
+    auto& input = *children[0]->resultVector;
+    bool result = false;
+    TypeUtils::visit(
+        input.dataType.getPhysicalType(),
+        [&]<FusableTypes T>(T) { result = selectValues<T>(input, selVector); },
+        [](auto) { KU_UNREACHABLE; });
+    return result;
+}
+
+} // namespace evaluator
+} // namespace ryu
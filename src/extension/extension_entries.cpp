@@ -15,7 +15,7 @@ static constexpr std::array ftsExtensionFunctions = {"STEM", "QUERY_FTS_INDEX",
 static constexpr std::array jsonExtensionFunctions = {"TO_JSON", "JSON_QUOTE", "ARRAY_TO_JSON",
     "ROW_TO_JSON", "CAST_TO_JSON", "JSON_ARRAY", "JSON_OBJECT", "JSON_MERGE_PATCH", "COPY_JSON",
     "JSON_EXTRACT", "JSON_ARRAY_LENGTH", "JSON_CONTAINS", "JSON_KEYS", "JSON_STRUCTURE",
-    "JSON_TYPE", "JSON_VALID", "JSON"};
+    "JSON_TYPE", "JSON_VALID", "JSON", "JSON_SCAN"};
 static constexpr std::array duckdbExtensionFunctions = {"CLEAR_ATTACHED_DB_CACHE"};
 static constexpr std::array deltaExtensionFunctions = {"DELTA_SCAN"};
 static constexpr std::array icebergExtensionFunctions = {"ICEBERG_SCAN", "ICEBERG_METADATA",
@@ -25,9 +25,11 @@ static constexpr std::array vectorExtensionFunctions = {"QUERY_VECTOR_INDEX", "C
     "DROP_VECTOR_INDEX"};
 static constexpr std::array llmExtensionFunctions = {"CREATE_EMBEDDING"};
 static constexpr std::array neo4jExtensionFunctions = {"NEO4J_MIGRATE"};
-static constexpr std::array algoExtensionFunctions = {"K_CORE_DECOMPOSITION", "PAGE_RANK",
-    "STRONGLY_CONNECTED_COMPONENTS_KOSARAJU", "STRONGLY_CONNECTED_COMPONENTS",
-    "WEAKLY_CONNECTED_COMPONENTS"};
+static constexpr std::array algoExtensionFunctions = {"K_CORE_DECOMPOSITION", "KCORE",
+    "PAGE_RANK", "PR", "PERSONALIZED_PAGE_RANK", "PPR", "STRONGLY_CONNECTED_COMPONENTS_KOSARAJU",
+    "SCC_KO", "STRONGLY_CONNECTED_COMPONENTS", "SCC", "WEAKLY_CONNECTED_COMPONENTS", "WCC",
+    "LOUVAIN", "LEIDEN", "LABEL_PROPAGATION", "LPA", "TRIANGLE_COUNT", "RANDOM_WALK", "NODE2VEC",
+    "SPANNING_FOREST", "SF"};
 
 static constexpr EntriesForExtension functionsForExtensionsRaw[] = {
     {"FTS", ftsExtensionFunctions, ftsExtensionFunctions.size()},
@@ -47,6 +49,10 @@ static constexpr std::array jsonExtensionTypes = {"JSON"};
 static constexpr std::array<EntriesForExtension, 1> typesForExtensions = {
     EntriesForExtension{"JSON", jsonExtensionTypes, jsonExtensionTypes.size()}};
 
+// Extensions whose load function only registers the entries listed above. Others also register
+// file systems, storage extensions, index types or options, which are needed before any lookup.
+static constexpr std::array lazyLoadedExtensions = {"JSON", "ALGO", "NEO4J"};
+
 static std::optional<ExtensionEntry> lookupExtensionsByEntryName(std::string_view functionName,
     std::span<const EntriesForExtension> entriesForExtensions) {
     std::vector<ExtensionEntry> ret;
@@ -71,5 +77,11 @@ std::optional<ExtensionEntry> ExtensionManager::lookupExtensionsByTypeName(
     return lookupExtensionsByEntryName(common::StringUtils::getUpper(typeName), typesForExtensions);
 }
 
+bool ExtensionManager::canLoadLazily(std::string_view extensionName) {
+    const auto upperName = common::StringUtils::getUpper(extensionName);
+    return std::any_of(lazyLoadedExtensions.begin(), lazyLoadedExtensions.end(),
+        [&](const char* name) { return name == upperName; });
+}
+
 } // namespace extension
 } // namespace ryu
@@ -4,12 +4,16 @@
 #include "common/string_utils.h"
 #include "extension/extension.h"
 #include "generated_extension_loader.h"
+#include "main/client_context.h"
 #include "storage/wal/local_wal.h"
 #include "transaction/transaction_context.h"
 
 namespace ryu {
 namespace extension {
 
+// Set while a lazily loaded extension registers its entries, whose lookups must not load it again.
+static thread_local bool loadingLazyExtension = false;
+
 static void executeExtensionLoader(main::ClientContext* context, const std::string& extensionName) {
     auto loaderPath = ExtensionUtils::getLocalPathForExtensionLoader(context, extensionName);
     if (common::VirtualFileSystem::GetUnsafe(*context)->fileOrPathExists(loaderPath)) {
@@ -38,6 +42,8 @@ void ExtensionManager::loadExtension(const std::string& path, main::ClientContex
     if (std::any_of(loadedExtensions.begin(), loadedExtensions.end(),
             [&](const LoadedExtension& ext) { return ext.getExtensionName() == extensionName; })) {
         libLoader.unload();
+        // The extension is linked, but may not have registered its entries yet.
+        loadLazyExtension(extensionName);
         return;
     }
     auto init = libLoader.getInitFunc();
@@ -90,10 +96,110 @@ std::vector<storage::StorageExtension*> ExtensionManager::getStorageExtensions()
     return storageExtensionsToReturn;
 }
 
+bool ExtensionManager::loadLazyExtensionByFunctionName(std::string_view functionName) {
+    const auto entry = lookupExtensionsByFunctionName(functionName);
+    return entry.has_value() && loadLazyExtension(entry->extensionName);
+}
+
+bool ExtensionManager::loadLazyExtensionByTypeName(std::string_view typeName) {
+    const auto entry = lookupExtensionsByTypeName(typeName);
+    return entry.has_value() && loadLazyExtension(entry->extensionName);
+}
+
+void ExtensionManager::loadLazyExtensions() {
+    std::vector<LazyExtension*> extensionsToLoad;
+    {
+        std::unique_lock lck{lazyExtensionsMtx};
+        for (auto& lazyExtension : lazyExtensions) {
+            extensionsToLoad.push_back(lazyExtension.get());
+        }
+    }
+    for (const auto lazyExtension : extensionsToLoad) {
+        loadLazyExtension(*lazyExtension);
+    }
+}
+
+bool ExtensionManager::loadLazyExtension(std::string_view extensionName) {
+    if (loadingLazyExtension) {
+        return false;
+    }
+    LazyExtension* extensionToLoad = nullptr;
+    {
+        std::unique_lock lck{lazyExtensionsMtx};
+        for (auto& lazyExtension : lazyExtensions) {
+            if (lazyExtension->extension.name == extensionName) {
+                extensionToLoad = lazyExtension.get();
+                break;
+            }
+        }
+    }
+    if (extensionToLoad == nullptr) {
+        return false;
+    }
+    loadLazyExtension(*extensionToLoad);
+    return true;
+}
+
+void ExtensionManager::loadLazyExtension(LazyExtension& lazyExtension) {
+    // Lookups of other connections wait until all entries of the extension are registered.
+    std::call_once(lazyExtension.loadFlag, [&]() {
+        loadingLazyExtension = true;
+        // Entries are created with the dummy transaction, so the context isn't used otherwise.
+        main::ClientContext context{&database};
+        try {
+            (*lazyExtension.extension.load)(&context);
+        } catch (...) {
+            loadingLazyExtension = false;
+            throw;
+        }
+        loadingLazyExtension = false;
+    });
+}
+
 void ExtensionManager::autoLoadLinkedExtensions(main::ClientContext* context) {
     auto trxContext = transaction::TransactionContext::Get(*context);
     trxContext->beginRecoveryTransaction();
-    loadLinkedExtensions(context, loadedExtensions);
+    for (auto& linkedExtension : getLinkedExtensions()) {
+        if (canLoadLazily(linkedExtension.name)) {
+            auto lazyExtension = std::make_unique<LazyExtension>();
+            lazyExtension->extension = linkedExtension;
+            std::unique_lock lck{lazyExtensionsMtx};
+            lazyExtensions.push_back(std::move(lazyExtension));
+        } else {
+            (*linkedExtension.load)(context);
+        }
+        loadedExtensions.push_back(
+            LoadedExtension(linkedExtension.name, " ", ExtensionSource::STATIC_LINKED));
+    }
+    trxContext->commit();
+}
+
+void ExtensionManager::reloadExtensions(main::ClientContext* context) {
+    auto trxContext = transaction::TransactionContext::Get(*context);
+    trxContext->beginRecoveryTransaction();
+    // Entries of lazily loaded extensions were dropped with the catalog, so they are registered
+    // again by their next lookup.
+    {
+        std::unique_lock lck{lazyExtensionsMtx};
+        for (auto& lazyExtension : lazyExtensions) {
+            const auto linkedExtension = lazyExtension->extension;
+            lazyExtension = std::make_unique<LazyExtension>();
+            lazyExtension->extension = linkedExtension;
+        }
+    }
+    for (auto& linkedExtension : getLinkedExtensions()) {
+        if (!canLoadLazily(linkedExtension.name)) {
+            (*linkedExtension.load)(context);
+        }
+    }
+    for (auto& extension : loadedExtensions) {
+        if (extension.getSource() == ExtensionSource::STATIC_LINKED) {
+            continue;
+        }
+        auto libLoader = ExtensionLibLoader(extension.getExtensionName(), extension.getFullPath());
+        auto init = libLoader.getInitFunc();
+        (*init)(context);
+    }
     trxContext->commit();
 }
 
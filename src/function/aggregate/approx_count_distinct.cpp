@@ -0,0 +1,92 @@
+#include "binder/expression/expression_util.h"
+#include "binder/expression/node_expression.h"
+#include "binder/expression/rel_expression.h"
+#include "common/exception/binder.h"
+#include "function/aggregate/approx.h"
+#include "storage/stats/hyperloglog.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace function {
+
+// Estimates the number of distinct values with a HyperLogLog sketch instead of the distinct hash
+// table built for COUNT(DISTINCT x). Duplicates don't change the sketch, so the multiplicity is
+// ignored.
+struct ApproxCountDistinctState : public AggregateState {
+    uint32_t getStateSize() const override { return sizeof(*this); }
+    void writeToVector(ValueVector* outputVector, uint64_t pos) override {
+        outputVector->setValue<int64_t>(pos, hll.count());
+    }
+
+    HyperLogLog hll;
+};
+
+static std::unique_ptr<AggregateState> initialize() {
+    return std::make_unique<ApproxCountDistinctState>();
+}
+
+static void updateAll(uint8_t* state_, ValueVector* input, uint64_t /*multiplicity*/,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+    auto& inputSelVector = input->state->getSelVector();
+    for (auto i = 0u; i < inputSelVector.getSelSize(); ++i) {
+        auto pos = inputSelVector[i];
+        if (!input->isNull(pos)) {
+            state->hll.insertElement(ApproxAggregateUtils::hash(*input, pos));
+        }
+    }
+}
+
+static void updatePos(uint8_t* state_, ValueVector* input, uint64_t /*multiplicity*/, uint32_t pos,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+    state->hll.insertElement(ApproxAggregateUtils::hash(*input, pos));
+}
+
+static void combine(uint8_t* state_, uint8_t* otherState_,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+    auto otherState = reinterpret_cast<ApproxCountDistinctState*>(otherState_);
+    state->hll.merge(otherState->hll);
+}
+
+static void finalize(uint8_t* /*state_*/) {}
+
+static void paramRewriteFunc(expression_vector& arguments) {
+    KU_ASSERT(arguments.size() == 1);
+    if (ExpressionUtil::isNodePattern(*arguments[0])) {
+        arguments[0] = arguments[0]->constCast<NodeExpression>().getInternalID();
+    } else if (ExpressionUtil::isRelPattern(*arguments[0])) {
+        arguments[0] = arguments[0]->constCast<RelExpression>().getInternalID();
+    }
+}
+
+static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& input) {
+    KU_ASSERT(input.arguments.size() == 1);
+    auto& type = input.arguments[0]->getDataType();
+    if (!ApproxAggregateUtils::isHashable(type)) {
+        throw BinderException(stringFormat("{} does not support values of type {}.",
+            ApproxCountDistinctFunction::name, type.toString()));
+    }
+    auto aggFuncDefinition = reinterpret_cast<AggregateFunction*>(input.definition);
+    aggFuncDefinition->parameterTypeIDs[0] = type.getLogicalTypeID();
+    return std::make_unique<FunctionBindData>(LogicalType::INT64());
+}
+
+function_set ApproxCountDistinctFunction::getFunctionSet() {
+    function_set result;
+    auto func = std::make_unique<AggregateFunction>(name,
+        std::vector<LogicalTypeID>{LogicalTypeID::ANY}, LogicalTypeID::INT64, initialize,
+        updateAll, updatePos, combine, finalize, false /* isDistinct */, bindFunc,
+        paramRewriteFunc);
+    // An empty input has zero distinct values rather than a NULL count.
+    func->needToHandleNulls = true;
+    result.push_back(std::move(func));
+    return result;
+}
+
+} // namespace function
+} // namespace ryu
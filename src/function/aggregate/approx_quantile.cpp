@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "binder/expression/literal_expression.h"
+#include "common/exception/binder.h"
+#include "function/aggregate/approx.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+/**
+ * Estimates a quantile with a merging t-digest. Values are buffered as centroids of weight
+ * <multiplicity> and, once the buffer is full, sorted and merged greedily into fewer centroids.
+ * A centroid may only grow while its quantile range spans at most one unit of the scale function
+ * k(q) = COMPRESSION / (2 * pi) * asin(2q - 1), so centroids close to the tails stay small and
+ * extreme quantiles remain accurate. At most COMPRESSION + 1 centroids survive a compression.
+ */
+struct TDigestCentroid {
+    double mean;
+    double weight;
+};
+
+struct ApproxQuantileState : public AggregateStateWithNull {
+    static constexpr double COMPRESSION = 50;
+    static constexpr uint32_t CAPACITY = 128;
+
+    explicit ApproxQuantileState(double quantile) : quantile{quantile} {}
+
+    uint32_t getStateSize() const override { return sizeof(*this); }
+    void writeToVector(ValueVector* outputVector, uint64_t pos) override;
+
+    void add(double mean, double weight);
+    void compress();
+    double estimate() const;
+
+    static double scale(double q) {
+        return COMPRESSION / (2 * std::numbers::pi) * std::asin(2 * q - 1);
+    }
+    static double inverseScale(double k) {
+        if (k >= COMPRESSION / 4) {
+            return 1;
+        }
+        return (std::sin(k * 2 * std::numbers::pi / COMPRESSION) + 1) / 2;
+    }
+
+    double quantile;
+    double min = 0;
+    double max = 0;
+    double totalWeight = 0;
+    uint32_t numCentroids = 0;
+    TDigestCentroid centroids[CAPACITY];
+};
+
+void ApproxQuantileState::add(double mean, double weight) {
+    if (numCentroids == CAPACITY) {
+        compress();
+    }
+    if (isNull) {
+        min = mean;
+        max = mean;
+        isNull = false;
+    } else {
+        min = std::min(min, mean);
+        max = std::max(max, mean);
+    }
+    centroids[numCentroids++] = {mean, weight};
+    totalWeight += weight;
+}
+
+void ApproxQuantileState::compress() {
+    if (numCentroids <= 1) {
+        return;
+    }
+    std::sort(centroids, centroids + numCentroids,
+        [](const auto& a, const auto& b) { return a.mean < b.mean; });
+    auto numMerged = 0u;
+    auto current = centroids[0];
+    auto weightSoFar = 0.0;
+    auto quantileLimit = inverseScale(scale(0) + 1);
+    for (auto i = 1u; i < numCentroids; i++) {
+        auto& next = centroids[i];
+        if ((weightSoFar + current.weight + next.weight) / totalWeight <= quantileLimit) {
+            auto weight = current.weight + next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / weight;
+            current.weight = weight;
+        } else {
+            weightSoFar += current.weight;
+            centroids[numMerged++] = current;
+            quantileLimit = inverseScale(scale(weightSoFar / totalWeight) + 1);
+            current = next;
+        }
+    }
+    centroids[numMerged++] = current;
+    numCentroids = numMerged;
+}
+
+double ApproxQuantileState::estimate() const {
+    KU_ASSERT(numCentroids > 0);
+    // Each centroid represents its weight spread evenly around its mean, so the target rank is
+    // interpolated between the centers of neighbouring centroids, and between the first/last
+    // center and the exact minimum/maximum at the tails.
+    auto target = quantile * totalWeight;
+    auto center = centroids[0].weight / 2;
+    if (target <= center) {
+        return min + (centroids[0].mean - min) * target / center;
+    }
+    for (auto i = 0u; i + 1 < numCentroids; i++) {
+        auto nextCenter = center + (centroids[i].weight + centroids[i + 1].weight) / 2;
+        if (target <= nextCenter) {
+            auto fraction = (target - center) / (nextCenter - center);
+            return centroids[i].mean + (centroids[i + 1].mean - centroids[i].mean) * fraction;
+        }
+        center = nextCenter;
+    }
+    auto& last = centroids[numCentroids - 1];
+    auto remaining = totalWeight - center;
+    return last.mean + (max - last.mean) * (target - center) / remaining;
+}
+
+void ApproxQuantileState::writeToVector(ValueVector* outputVector, uint64_t pos) {
+    compress();
+    outputVector->setValue<double>(pos, estimate());
+}
+
+static void updateSingleValue(ApproxQuantileState* state, const ValueVector& input, uint32_t pos,
+    uint64_t multiplicity) {
+    TypeUtils::visit(
+        input.dataType.getPhysicalType(),
+        [&]<NumericTypes T>(
+            T) { state->add(static_cast<double>(input.getValue<T>(pos)), multiplicity); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+static void updateAll(uint8_t* state_, ValueVector* input, uint64_t multiplicity,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<ApproxQuantileState*>(state_);
+    input->forEachNonNull([&](auto pos) { updateSingleValue(state, *input, pos, multiplicity); });
+}
+
+static void updatePos(uint8_t* state_, ValueVector* input, uint64_t multiplicity, uint32_t pos,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto state = reinterpret_cast<ApproxQuantileState*>(state_);
+    updateSingleValue(state, *input, pos, multiplicity);
+}
+
+static void combine(uint8_t* state_, uint8_t* otherState_,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto otherState = reinterpret_cast<ApproxQuantileState*>(otherState_);
+    if (otherState->isNull) {
+        return;
+    }
+    auto state = reinterpret_cast<ApproxQuantileState*>(state_);
+    for (auto i = 0u; i < otherState->numCentroids; i++) {
+        state->add(otherState->centroids[i].mean, otherState->centroids[i].weight);
+    }
+    // The extremes of the other state may have been merged into its centroids already.
+    state->min = std::min(state->min, otherState->min);
+    state->max = std::max(state->max, otherState->max);
+}
+
+static void finalize(uint8_t* /*state_*/) {}
+
+static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& input) {
+    KU_ASSERT(input.arguments.size() == 2);
+    if (input.arguments[1]->expressionType != ExpressionType::LITERAL) {
+        throw BinderException(
+            stringFormat("Expected literal input as the second argument for {}().",
+                ApproxQuantileFunction::name));
+    }
+    auto quantile =
+        input.arguments[1]->constPtrCast<LiteralExpression>()->getValue().getValue<double>();
+    if (!(quantile >= 0 && quantile <= 1)) {
+        throw BinderException(
+            stringFormat("{} expects a quantile between 0 and 1.", ApproxQuantileFunction::name));
+    }
+    // The quantile is only known at bind time, so it is kept in the state.
+    auto aggFuncDefinition = reinterpret_cast<AggregateFunction*>(input.definition);
+    aggFuncDefinition->initializeFunc = [quantile]() -> std::unique_ptr<AggregateState> {
+        return std::make_unique<ApproxQuantileState>(quantile);
+    };
+    aggFuncDefinition->initialNullAggregateState =
+        aggFuncDefinition->createInitialNullAggregateState();
+    return std::make_unique<FunctionBindData>(LogicalType::DOUBLE());
+}
+
+function_set ApproxQuantileFunction::getFunctionSet() {
+    function_set result;
+    auto initialize = []() -> std::unique_ptr<AggregateState> {
+        return std::make_unique<ApproxQuantileState>(0.5);
+    };
+    for (auto typeID : LogicalTypeUtils::getNumericalLogicalTypeIDs()) {
+        result.push_back(std::make_unique<AggregateFunction>(name,
+            std::vector<LogicalTypeID>{typeID, LogicalTypeID::DOUBLE}, LogicalTypeID::DOUBLE,
+            initialize, updateAll, updatePos, combine, finalize, false /* isDistinct */,
+            bindFunc));
+    }
+    return result;
+}
+
+} // namespace function
+} // namespace ryu
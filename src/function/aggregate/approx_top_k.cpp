@@ -0,0 +1,180 @@
+#include <algorithm>
+
+#include "binder/expression/expression_util.h"
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/node_expression.h"
+#include "binder/expression/rel_expression.h"
+#include "common/exception/binder.h"
+#include "function/aggregate/approx.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+/**
+ * Finds the most frequent values with the space-saving algorithm. The state monitors up to
+ * CAPACITY values with their estimated count. A value that is not monitored once all counters are
+ * taken replaces the value with the smallest count and inherits that count as its error, so counts
+ * are overestimated by at most the error. Values are compared by hash and copied into the counter
+ * itself, only long strings are stored in the overflow buffer.
+ */
+struct TopKCounter {
+    static constexpr uint32_t VALUE_SIZE = 16;
+
+    hash_t hash;
+    uint64_t count;
+    uint64_t error;
+    uint8_t value[VALUE_SIZE];
+};
+
+struct ApproxTopKState : public AggregateStateWithNull {
+    static constexpr uint32_t CAPACITY = 32;
+    // Counters with a small count are the least accurate, so fewer values than monitored are
+    // returned.
+    static constexpr uint64_t MAX_K = CAPACITY / 2;
+
+    explicit ApproxTopKState(uint64_t k) : k{k} {}
+
+    uint32_t getStateSize() const override { return sizeof(*this); }
+    void writeToVector(ValueVector* outputVector, uint64_t pos) override;
+
+    // Returns the counter to copy the value into if the value wasn't monitored before.
+    TopKCounter* add(hash_t hash, uint64_t count, uint64_t error);
+
+    uint64_t k;
+    uint32_t numCounters = 0;
+    TopKCounter counters[CAPACITY];
+};
+
+TopKCounter* ApproxTopKState::add(hash_t hash, uint64_t count, uint64_t error) {
+    isNull = false;
+    for (auto i = 0u; i < numCounters; i++) {
+        if (counters[i].hash == hash) {
+            counters[i].count += count;
+            counters[i].error += error;
+            return nullptr;
+        }
+    }
+    if (numCounters < CAPACITY) {
+        counters[numCounters] = {hash, count, error, {}};
+        return &counters[numCounters++];
+    }
+    auto minCounter = std::min_element(counters, counters + numCounters,
+        [](const auto& a, const auto& b) { return a.count < b.count; });
+    *minCounter = {hash, minCounter->count + count, minCounter->count + error, {}};
+    return minCounter;
+}
+
+void ApproxTopKState::writeToVector(ValueVector* outputVector, uint64_t pos) {
+    std::stable_sort(counters, counters + numCounters,
+        [](const auto& a, const auto& b) { return a.count > b.count; });
+    auto listEntry = ListVector::addList(outputVector, std::min<uint64_t>(k, numCounters));
+    outputVector->setValue<list_entry_t>(pos, listEntry);
+    auto outputDataVector = ListVector::getDataVector(outputVector);
+    for (auto i = 0u; i < listEntry.size; i++) {
+        outputDataVector->copyFromRowData(listEntry.offset + i, counters[i].value);
+    }
+}
+
+static void updateSingleValue(ApproxTopKState* state, ValueVector* input, uint32_t pos,
+    uint64_t multiplicity, InMemOverflowBuffer* overflowBuffer) {
+    auto counter = state->add(ApproxAggregateUtils::hash(*input, pos), multiplicity, 0);
+    if (counter != nullptr) {
+        input->copyToRowData(pos, counter->value, overflowBuffer);
+    }
+}
+
+static void updateAll(uint8_t* state_, ValueVector* input, uint64_t multiplicity,
+    InMemOverflowBuffer* overflowBuffer) {
+    auto state = reinterpret_cast<ApproxTopKState*>(state_);
+    input->forEachNonNull(
+        [&](auto pos) { updateSingleValue(state, input, pos, multiplicity, overflowBuffer); });
+}
+
+static void updatePos(uint8_t* state_, ValueVector* input, uint64_t multiplicity, uint32_t pos,
+    InMemOverflowBuffer* overflowBuffer) {
+    auto state = reinterpret_cast<ApproxTopKState*>(state_);
+    updateSingleValue(state, input, pos, multiplicity, overflowBuffer);
+}
+
+static void combine(uint8_t* state_, uint8_t* otherState_,
+    InMemOverflowBuffer* /*overflowBuffer*/) {
+    auto otherState = reinterpret_cast<ApproxTopKState*>(otherState_);
+    if (otherState->isNull) {
+        return;
+    }
+    auto state = reinterpret_cast<ApproxTopKState*>(state_);
+    for (auto i = 0u; i < otherState->numCounters; i++) {
+        auto& other = otherState->counters[i];
+        auto counter = state->add(other.hash, other.count, other.error);
+        if (counter != nullptr) {
+            // Long strings keep pointing into the overflow buffer of the other state, which
+            // outlives the merged state like for COLLECT.
+            memcpy(counter->value, other.value, TopKCounter::VALUE_SIZE);
+        }
+    }
+}
+
+static void finalize(uint8_t* /*state_*/) {}
+
+static void paramRewriteFunc(expression_vector& arguments) {
+    if (ExpressionUtil::isNodePattern(*arguments[0])) {
+        arguments[0] = arguments[0]->constCast<NodeExpression>().getInternalID();
+    } else if (ExpressionUtil::isRelPattern(*arguments[0])) {
+        arguments[0] = arguments[0]->constCast<RelExpression>().getInternalID();
+    }
+}
+
+static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& input) {
+    auto& type = input.arguments[0]->getDataType();
+    if (!ApproxAggregateUtils::isHashable(type)) {
+        throw BinderException(stringFormat("{} does not support values of type {}.",
+            ApproxTopKFunction::name, type.toString()));
+    }
+    auto k = ApproxTopKFunction::DEFAULT_K;
+    if (input.arguments.size() == 2) {
+        if (input.arguments[1]->expressionType != ExpressionType::LITERAL) {
+            throw BinderException(
+                stringFormat("Expected literal input as the second argument for {}().",
+                    ApproxTopKFunction::name));
+        }
+        auto value = input.arguments[1]->constPtrCast<LiteralExpression>()->getValue();
+        if (value.getValue<int64_t>() <= 0 ||
+            static_cast<uint64_t>(value.getValue<int64_t>()) > ApproxTopKState::MAX_K) {
+            throw BinderException(stringFormat("{} expects k between 1 and {}.",
+                ApproxTopKFunction::name, ApproxTopKState::MAX_K));
+        }
+        k = value.getValue<int64_t>();
+    }
+    auto aggFuncDefinition = reinterpret_cast<AggregateFunction*>(input.definition);
+    aggFuncDefinition->parameterTypeIDs[0] = type.getLogicalTypeID();
+    aggFuncDefinition->initializeFunc = [k]() -> std::unique_ptr<AggregateState> {
+        return std::make_unique<ApproxTopKState>(k);
+    };
+    aggFuncDefinition->initialNullAggregateState =
+        aggFuncDefinition->createInitialNullAggregateState();
+    return std::make_unique<FunctionBindData>(LogicalType::LIST(type.copy()));
+}
+
+function_set ApproxTopKFunction::getFunctionSet() {
+    static_assert(sizeof(ku_string_t) <= TopKCounter::VALUE_SIZE &&
+                  sizeof(int128_t) <= TopKCounter::VALUE_SIZE &&
+                  sizeof(interval_t) <= TopKCounter::VALUE_SIZE &&
+                  sizeof(internalID_t) <= TopKCounter::VALUE_SIZE);
+    function_set result;
+    auto initialize = []() -> std::unique_ptr<AggregateState> {
+        return std::make_unique<ApproxTopKState>(DEFAULT_K);
+    };
+    for (auto parameterTypeIDs : std::vector<std::vector<LogicalTypeID>>{{LogicalTypeID::ANY},
+             {LogicalTypeID::ANY, LogicalTypeID::INT64}}) {
+        result.push_back(std::make_unique<AggregateFunction>(name, std::move(parameterTypeIDs),
+            LogicalTypeID::LIST, initialize, updateAll, updatePos, combine, finalize,
+            false /* isDistinct */, bindFunc, paramRewriteFunc));
+    }
+    return result;
+}
+
+} // namespace function
+} // namespace ryu
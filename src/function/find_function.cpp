@@ -62,32 +62,27 @@ int64_t Find::genericFind(const uint8_t* haystack, uint32_t haystackLen, const u
     if (needLen > haystackLen) {
         return -1;
     }
-    // This implementation is inspired by Raphael Javaux's faststrstr
-    // (https://github.com/RaphaelJ/fast_strstr) generic contains; note that we can't use strstr
-    // because we don't have null-terminated strings anymore we keep track of a shifting window
-    // sum of all characters with window size equal to needle_size this shifting sum is used to
-    // avoid calling into memcmp; we only need to call into memcmp when the window sum is equal
-    // to the needle sum when that happens, the characters are potentially the same and we call
-    // into memcmp to check if they are.
-    auto sumsDiff = 0u;
-    for (auto i = 0u; i < needLen; i++) {
-        sumsDiff += haystack[i];
-        sumsDiff -= needle[i];
-    }
-    auto offset = 0u;
-    while (true) {
-        if (sumsDiff == 0 && haystack[offset] == needle[0]) {
-            if (memcmp(haystack + offset, needle, needLen) == 0) {
-                return firstMatchCharOffset + offset;
-            }
-        }
-        if (offset >= haystackLen - needLen) {
+    // Candidates are found by jumping between occurrences of the first needle character with
+    // memchr, which the C library vectorizes. The last and the first eight characters are compared
+    // before the rest, so most false candidates are rejected without calling into memcmp.
+    auto lastCharOffset = needLen - 1;
+    auto needlePrefix = *reinterpret_cast<const uint64_t*>(needle);
+    auto end = haystack + haystackLen - lastCharOffset;
+    auto candidate = haystack;
+    while (candidate < end) {
+        candidate = static_cast<const uint8_t*>(memchr(candidate, needle[0], end - candidate));
+        if (candidate == nullptr) {
             return -1;
         }
-        sumsDiff -= haystack[offset];
-        sumsDiff += haystack[offset + needLen];
-        offset++;
+        if (candidate[lastCharOffset] == needle[lastCharOffset] &&
+            *reinterpret_cast<const uint64_t*>(candidate) == needlePrefix &&
+            memcmp(candidate + sizeof(uint64_t), needle + sizeof(uint64_t),
+                needLen - sizeof(uint64_t)) == 0) {
+            return firstMatchCharOffset + (candidate - haystack);
+        }
+        candidate++;
     }
+    return -1;
 }
 
 // Returns the position of the first occurrence of needle in the haystack. If haystack doesn't
@@ -1,5 +1,6 @@
 #include "function/function_collection.h"
 
+#include "function/aggregate/approx.h"
 #include "function/aggregate/count.h"
 #include "function/aggregate/count_star.h"
 #include "function/arithmetic/vector_arithmetic_functions.h"
@@ -98,7 +99,8 @@ FunctionCollection* FunctionCollection::getFunctions() {
         SCALAR_FUNCTION(RegexpSplitToArrayFunction), SCALAR_FUNCTION(InitCapFunction),
         SCALAR_FUNCTION(StringSplitFunction), SCALAR_FUNCTION_ALIAS(StrSplitFunction),
         SCALAR_FUNCTION_ALIAS(StringToArrayFunction), SCALAR_FUNCTION(SplitPartFunction),
-        SCALAR_FUNCTION(InternalIDCreationFunction), SCALAR_FUNCTION(ConcatWSFunction),
+        SCALAR_FUNCTION(InternalIDCreationFunction), SCALAR_FUNCTION(NodeGroupPartitionFunction),
+        SCALAR_FUNCTION(ConcatWSFunction),
 
         // Array Functions
         SCALAR_FUNCTION(ArrayValueFunction), SCALAR_FUNCTION(ArrayCrossProductFunction),
@@ -218,7 +220,8 @@ FunctionCollection* FunctionCollection::getFunctions() {
         AGGREGATE_FUNCTION(CountStarFunction), AGGREGATE_FUNCTION(CountFunction),
         AGGREGATE_FUNCTION(AggregateSumFunction), AGGREGATE_FUNCTION(AggregateAvgFunction),
         AGGREGATE_FUNCTION(AggregateMinFunction), AGGREGATE_FUNCTION(AggregateMaxFunction),
-        AGGREGATE_FUNCTION(CollectFunction),
+        AGGREGATE_FUNCTION(CollectFunction), AGGREGATE_FUNCTION(ApproxCountDistinctFunction),
+        AGGREGATE_FUNCTION(ApproxQuantileFunction), AGGREGATE_FUNCTION(ApproxTopKFunction),
 
         // Table functions
         TABLE_FUNCTION(CurrentSettingFunction), TABLE_FUNCTION(CatalogVersionFunction),
@@ -231,7 +234,8 @@ FunctionCollection* FunctionCollection::getFunctions() {
         TABLE_FUNCTION(FileInfoFunction), TABLE_FUNCTION(ShowLoadedExtensionsFunction),
         TABLE_FUNCTION(ShowOfficialExtensionsFunction), TABLE_FUNCTION(ShowIndexesFunction),
         TABLE_FUNCTION(ShowProjectedGraphsFunction), TABLE_FUNCTION(ProjectedGraphInfoFunction),
-        TABLE_FUNCTION(ShowMacrosFunction),
+        TABLE_FUNCTION(ShowMacrosFunction), TABLE_FUNCTION(MetricsFunction),
+        TABLE_FUNCTION(QueryMemoryUsageFunction),
 
         // Standalone Table functions
         STANDALONE_TABLE_FUNCTION(LocalCacheArrayColumnFunction),
@@ -239,6 +243,14 @@ FunctionCollection* FunctionCollection::getFunctions() {
         STANDALONE_TABLE_FUNCTION(ProjectGraphNativeFunction),
         STANDALONE_TABLE_FUNCTION(ProjectGraphCypherFunction),
         STANDALONE_TABLE_FUNCTION(DropProjectedGraphFunction),
+        STANDALONE_TABLE_FUNCTION(CreatePropertyIndexFunction),
+        STANDALONE_TABLE_FUNCTION(DropPropertyIndexFunction),
+        STANDALONE_TABLE_FUNCTION(AnalyzeFunction), STANDALONE_TABLE_FUNCTION(PrewarmFunction),
+        STANDALONE_TABLE_FUNCTION(SnapshotDatabaseFunction),
+        STANDALONE_TABLE_FUNCTION(CreateMaterializedViewFunction),
+        STANDALONE_TABLE_FUNCTION(RefreshMaterializedViewFunction),
+        STANDALONE_TABLE_FUNCTION(BeginMaterializedViewRefreshFunction),
+        STANDALONE_TABLE_FUNCTION(FinishMaterializedViewRefreshFunction),
 
         // Scan functions
         TABLE_FUNCTION(ParquetScanFunction), TABLE_FUNCTION(NpyScanFunction),
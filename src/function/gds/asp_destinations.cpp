@@ -193,6 +193,7 @@ public:
         : RJOutputWriter{context, outputNodeMask, sourceNodeID}, frontier{frontier},
           multiplicities{multiplicities} {
         lengthVector = createVector(LogicalType::UINT16());
+        multiplicityVector = createVector(LogicalType::UINT64());
     }
 
     void beginWritingInternal(table_id_t tableID) override {
@@ -220,10 +221,11 @@ public:
         }
         dstNodeIDVector->setValue<nodeID_t>(0, dstNodeID);
         lengthVector->setValue<uint16_t>(0, iter);
+        // Each destination is written once along with its number of shortest paths instead of
+        // once per path, which is exponential in the path length on dense graphs.
         auto multiplicity = multiplicities->getMultiplicity(dstNodeID.offset);
-        for (auto i = 0u; i < multiplicity; ++i) {
-            fTable.append(vectors);
-        }
+        multiplicityVector->setValue<multiplicity_t>(0, multiplicity);
+        fTable.append(vectors);
         if (counter != nullptr) {
             counter->increase(multiplicity);
         }
@@ -236,6 +238,7 @@ public:
 
 private:
     std::unique_ptr<ValueVector> lengthVector;
+    std::unique_ptr<ValueVector> multiplicityVector;
     Frontier* frontier;
     Multiplicities* multiplicities;
 };
@@ -271,6 +274,29 @@ public:
         return activeNodes;
     }
 
+    bool canPull() const override { return true; }
+
+    bool shouldPull(offset_t offset) override {
+        auto val = frontierPair->getNextFrontierValue(offset);
+        return val == FRONTIER_UNVISITED || val == frontierPair->getCurrentIter();
+    }
+
+    bool pullCompute(nodeID_t boundNodeID, NbrScanState::Chunk& resultChunk,
+        bool& reached) override {
+        // The multiplicity of boundNodeID is the sum over all its neighbors in the current
+        // frontier, so all neighbors are scanned.
+        resultChunk.forEach([&](auto neighbors, auto, auto i) {
+            auto nbrOffset = neighbors[i].offset;
+            if (!frontierPair->isActiveOnCurrentFrontier(nbrOffset)) {
+                return;
+            }
+            auto nbrMultiplicity = multiplicitiesPair->getCurrentMultiplicity(nbrOffset);
+            multiplicitiesPair->increaseNextMultiplicity(boundNodeID.offset, nbrMultiplicity);
+            reached = true;
+        });
+        return true;
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<ASPDestinationsEdgeCompute>(frontierPair, multiplicitiesPair);
     }
@@ -292,6 +318,8 @@ public:
         return columns;
     }
 
+    bool writeMultiplicity() const override { return true; }
+
     std::unique_ptr<RJAlgorithm> copy() const override {
         return std::make_unique<AllSPDestinationsAlgorithm>(*this);
     }
@@ -18,8 +18,8 @@ namespace function {
 template<typename T>
 class AWSPPathsEdgeCompute : public EdgeCompute {
 public:
-    explicit AWSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager)
-        : bfsGraphManager{bfsGraphManager} {
+    AWSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager, DeltaSteppingBuckets* buckets)
+        : bfsGraphManager{bfsGraphManager}, buckets{buckets} {
         block = bfsGraphManager->getCurrentGraph()->addNewBlock();
     }
 
@@ -34,20 +34,26 @@ public:
             if (!block->hasSpace()) {
                 block = bfsGraphManager->getCurrentGraph()->addNewBlock();
             }
-            if (bfsGraphManager->getCurrentGraph()->tryAddParentWithWeight(boundNodeID, edgeID,
+            auto bfsGraph = bfsGraphManager->getCurrentGraph();
+            if (bfsGraph->tryAddParentWithWeight(boundNodeID, edgeID,
                     nbrNodeID, fwdEdge, static_cast<double>(weight), block)) {
-                result.push_back(nbrNodeID);
+                if (buckets == nullptr ||
+                    buckets->isInCurrentBucket(nbrNodeID,
+                        bfsGraph->getParentListHead(nbrNodeID.offset)->getCost())) {
+                    result.push_back(nbrNodeID);
+                }
             }
         });
         return result;
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraphManager);
+        return std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraphManager, buckets);
     }
 
 private:
     BFSGraphManager* bfsGraphManager;
+    DeltaSteppingBuckets* buckets;
     ObjectBlock<ParentList>* block = nullptr;
 };
 
@@ -153,11 +159,15 @@ private:
             std::move(curDenseFrontier), std::move(nextDenseFrontier));
         auto bfsGraph = std::make_unique<BFSGraphManager>(
             sharedState->graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext)), mm);
+        auto buckets = DeltaSteppingBuckets::create(*clientContext);
+        auto bucketsPtr = buckets.get();
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(AllWeightedSPPathsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraph.get());
-                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph));
+                auto edgeCompute =
+                    std::make_unique<AWSPPathsEdgeCompute<T>>(bfsGraph.get(), bucketsPtr);
+                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph),
+                    std::move(buckets));
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
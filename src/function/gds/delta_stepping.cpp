@@ -0,0 +1,58 @@
+#include "function/gds/delta_stepping.h"
+
+#include <cmath>
+
+#include "function/gds/gds_frontier.h"
+#include "main/client_context.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+std::unique_ptr<DeltaSteppingBuckets> DeltaSteppingBuckets::create(
+    const main::ClientContext& context) {
+    const auto delta = context.getClientConfig()->wspDelta;
+    if (delta == 0) {
+        return nullptr;
+    }
+    return std::make_unique<DeltaSteppingBuckets>(delta);
+}
+
+bool DeltaSteppingBuckets::isInCurrentBucket(nodeID_t nodeID, double cost) {
+    if (cost < bucketUpperBound) {
+        return true;
+    }
+    std::unique_lock lck{mtx};
+    deferredNodes.push_back({nodeID, cost});
+    return false;
+}
+
+bool DeltaSteppingBuckets::activateNextBucket(FrontierPair& frontierPair,
+    const std::function<double(nodeID_t)>& getCost) {
+    // A node is deferred again each time its cost improves. Only its entry with the current cost
+    // is kept.
+    std::erase_if(deferredNodes,
+        [&](const DeferredNode& node) { return getCost(node.nodeID) < node.cost; });
+    if (deferredNodes.empty()) {
+        return false;
+    }
+    auto minCost = deferredNodes[0].cost;
+    for (auto& node : deferredNodes) {
+        minCost = std::min(minCost, node.cost);
+    }
+    bucketUpperBound = (std::floor(minCost / delta) + 1) * delta;
+    std::erase_if(deferredNodes, [&](const DeferredNode& node) {
+        if (node.cost >= bucketUpperBound) {
+            return false;
+        }
+        frontierPair.pinNextFrontier(node.nodeID.tableID);
+        frontierPair.addNodeToNextFrontier(node.nodeID);
+        return true;
+    });
+    frontierPair.setActiveNodesForNextIter();
+    return true;
+}
+
+} // namespace function
+} // namespace ryu
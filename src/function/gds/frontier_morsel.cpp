@@ -19,14 +19,24 @@ void FrontierMorselDispatcher::init(offset_t _maxOffset) {
     auto idealMorselSize =
         maxOffset / std::max(MIN_NUMBER_OF_FRONTIER_MORSELS, maxThreads * maxThreads);
     morselSize = std::max(MIN_FRONTIER_MORSEL_SIZE, idealMorselSize);
+    // Align morsels to 64 nodes so that they don't share words of bitset frontiers.
+    morselSize = (morselSize + 63) / 64 * 64;
 }
 
 bool FrontierMorselDispatcher::getNextRangeMorsel(FrontierMorsel& frontierMorsel) {
-    auto beginOffset = nextOffset.fetch_add(morselSize, std::memory_order_acq_rel);
-    if (beginOffset >= maxOffset) {
-        return false;
-    }
-    auto endOffset = beginOffset + morselSize > maxOffset ? maxOffset : beginOffset + morselSize;
+    auto beginOffset = nextOffset.load(std::memory_order_acquire);
+    offset_t endOffset = 0;
+    do {
+        if (beginOffset >= maxOffset) {
+            return false;
+        }
+        // Morsels shrink once less than morselSize is left per morsel and thread, so that a thread
+        // which draws a morsel of high-degree nodes near the end doesn't leave the others idle.
+        auto size = std::min(morselSize,
+            (maxOffset - beginOffset) / (maxThreads * NUM_MORSELS_PER_THREAD_AT_END));
+        size = std::max(MIN_FRONTIER_MORSEL_SIZE, (size + 63) / 64 * 64);
+        endOffset = std::min(maxOffset, beginOffset + size);
+    } while (!nextOffset.compare_exchange_weak(beginOffset, endOffset, std::memory_order_acq_rel));
     frontierMorsel.init(beginOffset, endOffset);
     return true;
 }
@@ -8,6 +8,7 @@
 #include "common/exception/binder.h"
 #include "function/table/bind_input.h"
 #include "graph/graph_entry_set.h"
+#include "graph/in_mem_graph.h"
 #include "graph/on_disk_graph.h"
 #include "parser/parser.h"
 #include "planner/operator/logical_table_function_call.h"
@@ -28,8 +29,7 @@ namespace ryu {
 namespace function {
 
 void GDSFuncSharedState::setGraphNodeMask(std::unique_ptr<NodeOffsetMaskMap> maskMap) {
-    auto onDiskGraph = ku_dynamic_cast<OnDiskGraph*>(graph.get());
-    onDiskGraph->setNodeOffsetMask(maskMap.get());
+    graph->setNodeOffsetMask(maskMap.get());
     graphNodeMask = std::move(maskMap);
 }
 
@@ -138,6 +138,7 @@ NativeGraphEntry GDSFunction::bindGraphEntry(ClientContext& context,
             throw BinderException(stringFormat("{} is not a REL table.", relInfo.tableName));
         }
     }
+    result.inMemory = entry.inMemory;
     return result;
 }
 
@@ -186,8 +187,14 @@ std::string GDSFunction::bindColumnName(const parser::YieldVariable& yieldVariab
 std::unique_ptr<TableFuncSharedState> GDSFunction::initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto bindData = input.bindData->constPtrCast<GDSBindData>();
-    auto graph =
-        std::make_unique<OnDiskGraph>(input.context->clientContext, bindData->graphEntry.copy());
+    std::unique_ptr<Graph> graph;
+    if (bindData->graphEntry.inMemory) {
+        graph = std::make_unique<InMemGraph>(input.context->clientContext,
+            bindData->graphEntry.copy());
+    } else {
+        graph = std::make_unique<OnDiskGraph>(input.context->clientContext,
+            bindData->graphEntry.copy());
+    }
     return std::make_unique<GDSFuncSharedState>(bindData->getResultTable(), std::move(graph));
 }
 
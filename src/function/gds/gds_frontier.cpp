@@ -1,5 +1,7 @@
 #include "function/gds/gds_frontier.h"
 
+#include <bit>
+
 #include "function/gds/gds_utils.h"
 #include "processor/execution_context.h"
 #include "transaction/transaction.h"
@@ -211,6 +213,106 @@ iteration_t DenseFrontierReference::getIteration(offset_t offset) const {
     return curData[offset].load(std::memory_order_relaxed);
 }
 
+void DenseBitsetFrontier::init(ExecutionContext* context) {
+    auto mm = storage::MemoryManager::Get(*context->clientContext);
+    for (const auto& [tableID, maxOffset] : nodeMaxOffsetMap) {
+        denseObjects.allocate(tableID, getNumWords(maxOffset), mm);
+    }
+    reset(FRONTIER_UNVISITED);
+}
+
+void DenseBitsetFrontier::reset(iteration_t iter_) {
+    iter = iter_;
+    for (const auto& [tableID, maxOffset] : nodeMaxOffsetMap) {
+        auto data = denseObjects.getData(tableID);
+        for (auto i = 0u; i < getNumWords(maxOffset); ++i) {
+            data[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void DenseBitsetFrontier::pinTableID(table_id_t tableID) {
+    curData = denseObjects.getData(tableID);
+}
+
+void DenseBitsetFrontier::addNode(nodeID_t nodeID, iteration_t iter_) {
+    addNode(nodeID.offset, iter_);
+}
+
+void DenseBitsetFrontier::addNode(offset_t offset, iteration_t iter_) {
+    KU_ASSERT(curData && iter_ == iter);
+    (void)iter_;
+    curData[offset / NUM_BITS_PER_WORD].fetch_or(1ull << (offset % NUM_BITS_PER_WORD),
+        std::memory_order_relaxed);
+}
+
+void DenseBitsetFrontier::addNodes(const std::vector<nodeID_t>& nodeIDs, iteration_t iter_) {
+    for (auto nodeID : nodeIDs) {
+        addNode(nodeID.offset, iter_);
+    }
+}
+
+iteration_t DenseBitsetFrontier::getIteration(offset_t offset) const {
+    KU_ASSERT(curData);
+    auto word = curData[offset / NUM_BITS_PER_WORD].load(std::memory_order_relaxed);
+    return (word >> (offset % NUM_BITS_PER_WORD)) & 1 ? iter : FRONTIER_UNVISITED;
+}
+
+offset_t DenseBitsetFrontier::getNextOffset(offset_t beginOffset, offset_t endOffset) const {
+    KU_ASSERT(curData);
+    if (beginOffset >= endOffset) {
+        return endOffset;
+    }
+    auto wordIdx = beginOffset / NUM_BITS_PER_WORD;
+    // Drop the bits before beginOffset in the first word.
+    auto word = curData[wordIdx].load(std::memory_order_relaxed) >>
+                (beginOffset % NUM_BITS_PER_WORD) << (beginOffset % NUM_BITS_PER_WORD);
+    auto lastWordIdx = (endOffset - 1) / NUM_BITS_PER_WORD;
+    while (word == 0) {
+        if (++wordIdx > lastWordIdx) {
+            return endOffset;
+        }
+        word = curData[wordIdx].load(std::memory_order_relaxed);
+    }
+    auto offset = wordIdx * NUM_BITS_PER_WORD + std::countr_zero(word);
+    return std::min(offset, endOffset);
+}
+
+std::unique_ptr<DenseBitsetFrontier> DenseBitsetFrontier::getUnvisitedFrontier(
+    ExecutionContext* context, Graph* graph) {
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    auto frontier = std::make_unique<DenseBitsetFrontier>(graph->getMaxOffsetMap(transaction));
+    frontier->init(context);
+    return frontier;
+}
+
+std::unique_ptr<DenseBitsetFrontier> DenseBitsetFrontier::getVisitedFrontier(
+    ExecutionContext* context, Graph* graph, NodeOffsetMaskMap* maskMap) {
+    auto frontier = getUnvisitedFrontier(context, graph);
+    frontier->iter = FRONTIER_INITIAL_VISITED;
+    for (const auto& [tableID, maxOffset] : frontier->nodeMaxOffsetMap) {
+        frontier->pinTableID(tableID);
+        if (maskMap != nullptr && maskMap->containsTableID(tableID)) {
+            auto mask = maskMap->getOffsetMask(tableID);
+            for (auto i = 0u; i < maxOffset; ++i) {
+                if (mask->isMasked(i)) {
+                    frontier->addNode(i, FRONTIER_INITIAL_VISITED);
+                }
+            }
+            continue;
+        }
+        auto numFullWords = maxOffset / NUM_BITS_PER_WORD;
+        for (auto i = 0u; i < numFullWords; ++i) {
+            frontier->curData[i].store(UINT64_MAX, std::memory_order_relaxed);
+        }
+        if (maxOffset % NUM_BITS_PER_WORD) {
+            frontier->curData[numFullWords].store((1ull << (maxOffset % NUM_BITS_PER_WORD)) - 1,
+                std::memory_order_relaxed);
+        }
+    }
+    return frontier;
+}
+
 void FrontierPair::beginNewIteration() {
     std::unique_lock<std::mutex> lck{mtx};
     curIter++;
@@ -252,6 +354,14 @@ bool FrontierPair::isActiveOnCurrentFrontier(offset_t offset) {
     return currentFrontier->getIteration(offset) == curIter - 1;
 }
 
+offset_t FrontierPair::getNextActiveOffset(offset_t beginOffset, offset_t endOffset) {
+    auto offset = beginOffset;
+    while (offset < endOffset && !isActiveOnCurrentFrontier(offset)) {
+        offset++;
+    }
+    return offset;
+}
+
 Frontier* SPFrontierPair::getFrontier() {
     switch (state) {
     case GDSDensityState::SPARSE: {
@@ -407,6 +517,22 @@ void DenseFrontierPair::resetValue(ExecutionContext* context, Graph* graph, iter
     nextDenseFrontier->resetValue(context, graph, val);
 }
 
+DenseBitsetFrontierPair::DenseBitsetFrontierPair(
+    std::unique_ptr<DenseBitsetFrontier> curDenseFrontier,
+    std::unique_ptr<DenseBitsetFrontier> nextDenseFrontier)
+    : curDenseFrontier{std::move(curDenseFrontier)},
+      nextDenseFrontier{std::move(nextDenseFrontier)} {
+    currentFrontier = this->curDenseFrontier.get();
+    nextFrontier = this->nextDenseFrontier.get();
+}
+
+void DenseBitsetFrontierPair::beginNewIterationInternalNoLock() {
+    std::swap(curDenseFrontier, nextDenseFrontier);
+    nextDenseFrontier->reset(curIter);
+    currentFrontier = curDenseFrontier.get();
+    nextFrontier = nextDenseFrontier.get();
+}
+
 static constexpr uint64_t EARLY_TERM_NUM_NODES_THRESHOLD = 100;
 
 bool SPEdgeCompute::terminate(NodeOffsetMaskMap& maskMap) {
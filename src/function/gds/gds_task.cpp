@@ -2,6 +2,7 @@
 
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
+#include "common/task_system/query_tracer.h"
 #include "function/gds/frontier_morsel.h"
 #include "graph/graph.h"
 
@@ -39,22 +40,30 @@ oid_t FrontierTaskInfo::getRelTableID() const {
 }
 
 void FrontierTask::run() {
+    if (info.pull) {
+        runPull();
+        return;
+    }
     FrontierMorsel morsel;
     auto numActiveNodes = 0u;
+    auto numScannedRels = 0u;
     auto graph = info.graph;
     auto scanState = graph->prepareRelScan(*info.relGroupEntry, info.getRelTableID(),
         info.getNbrTableID(), info.propertiesToScan);
     auto ec = info.edgeCompute.copy();
     auto boundTableID = info.getBoundTableID();
+    auto& frontierPair = sharedState->frontierPair;
     switch (info.direction) {
     case ExtendDirection::FWD: {
         while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
-            for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); ++offset) {
-                if (!sharedState->frontierPair.isActiveOnCurrentFrontier(offset)) {
-                    continue;
-                }
+            TraceScope morselScope{tracer, "morsel", "FrontierMorsel"};
+            auto endOffset = morsel.getEndOffset();
+            auto offset = frontierPair.getNextActiveOffset(morsel.getBeginOffset(), endOffset);
+            for (; offset < endOffset;
+                 offset = frontierPair.getNextActiveOffset(offset + 1, endOffset)) {
                 nodeID_t nodeID = {offset, boundTableID};
                 for (auto chunk : graph->scanFwd(nodeID, *scanState)) {
+                    numScannedRels += chunk.size();
                     auto activeNodes = ec->edgeCompute(nodeID, chunk, true);
                     sharedState->frontierPair.addNodesToNextFrontier(activeNodes);
                     numActiveNodes += activeNodes.size();
@@ -64,12 +73,14 @@ void FrontierTask::run() {
     } break;
     case ExtendDirection::BWD: {
         while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
-            for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); ++offset) {
-                if (!sharedState->frontierPair.isActiveOnCurrentFrontier(offset)) {
-                    continue;
-                }
+            TraceScope morselScope{tracer, "morsel", "FrontierMorsel"};
+            auto endOffset = morsel.getEndOffset();
+            auto offset = frontierPair.getNextActiveOffset(morsel.getBeginOffset(), endOffset);
+            for (; offset < endOffset;
+                 offset = frontierPair.getNextActiveOffset(offset + 1, endOffset)) {
                 nodeID_t nodeID = {offset, boundTableID};
                 for (auto chunk : graph->scanBwd(nodeID, *scanState)) {
+                    numScannedRels += chunk.size();
                     auto activeNodes = ec->edgeCompute(nodeID, chunk, false);
                     sharedState->frontierPair.addNodesToNextFrontier(activeNodes);
                     numActiveNodes += activeNodes.size();
@@ -80,6 +91,8 @@ void FrontierTask::run() {
     default:
         KU_UNREACHABLE;
     }
+    sharedState->numActiveNodes.fetch_add(numActiveNodes);
+    sharedState->numScannedRels.fetch_add(numScannedRels);
     if (numActiveNodes) {
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
@@ -87,6 +100,7 @@ void FrontierTask::run() {
 
 void FrontierTask::runSparse() {
     auto numActiveNodes = 0u;
+    auto numScannedRels = 0u;
     auto graph = info.graph;
     auto scanState = graph->prepareRelScan(*info.relGroupEntry, info.getRelTableID(),
         info.getNbrTableID(), info.propertiesToScan);
@@ -97,6 +111,7 @@ void FrontierTask::runSparse() {
         for (const auto offset : sharedState->frontierPair.getActiveNodesOnCurrentFrontier()) {
             auto nodeID = nodeID_t{offset, boundTableID};
             for (auto chunk : graph->scanFwd(nodeID, *scanState)) {
+                numScannedRels += chunk.size();
                 auto activeNodes = ec->edgeCompute(nodeID, chunk, true);
                 sharedState->frontierPair.addNodesToNextFrontier(activeNodes);
                 numActiveNodes += activeNodes.size();
@@ -107,6 +122,7 @@ void FrontierTask::runSparse() {
         for (auto& offset : sharedState->frontierPair.getActiveNodesOnCurrentFrontier()) {
             auto nodeID = nodeID_t{offset, boundTableID};
             for (auto chunk : graph->scanBwd(nodeID, *scanState)) {
+                numScannedRels += chunk.size();
                 auto activeNodes = ec->edgeCompute(nodeID, chunk, false);
                 sharedState->frontierPair.addNodesToNextFrontier(activeNodes);
                 numActiveNodes += activeNodes.size();
@@ -116,6 +132,46 @@ void FrontierTask::runSparse() {
     default:
         KU_UNREACHABLE;
     }
+    sharedState->numActiveNodes.fetch_add(numActiveNodes);
+    sharedState->numScannedRels.fetch_add(numScannedRels);
+    if (numActiveNodes) {
+        sharedState->frontierPair.setActiveNodesForNextIter();
+    }
+}
+
+void FrontierTask::runPull() {
+    FrontierMorsel morsel;
+    auto numActiveNodes = 0u;
+    auto numScannedRels = 0u;
+    auto graph = info.graph;
+    auto scanState = graph->prepareRelScan(*info.relGroupEntry, info.getRelTableID(),
+        info.getNbrTableID(), info.propertiesToScan);
+    auto ec = info.edgeCompute.copy();
+    auto boundTableID = info.getBoundTableID();
+    auto isFwd = info.direction == ExtendDirection::FWD;
+    while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
+        TraceScope morselScope{tracer, "morsel", "FrontierMorsel"};
+        for (auto offset = morsel.getBeginOffset(); offset < morsel.getEndOffset(); ++offset) {
+            if (!ec->shouldPull(offset)) {
+                continue;
+            }
+            nodeID_t nodeID = {offset, boundTableID};
+            auto reached = false;
+            for (auto chunk : isFwd ? graph->scanFwd(nodeID, *scanState) :
+                                      graph->scanBwd(nodeID, *scanState)) {
+                numScannedRels += chunk.size();
+                if (!ec->pullCompute(nodeID, chunk, reached)) {
+                    break;
+                }
+            }
+            if (reached) {
+                sharedState->frontierPair.addNodeToNextFrontier(offset);
+                numActiveNodes++;
+            }
+        }
+    }
+    sharedState->numActiveNodes.fetch_add(numActiveNodes);
+    sharedState->numScannedRels.fetch_add(numScannedRels);
     if (numActiveNodes) {
         sharedState->frontierPair.setActiveNodesForNextIter();
     }
@@ -128,6 +184,7 @@ void VertexComputeTask::run() {
     if (info.hasPropertiesToScan()) {
         auto scanState = graph->prepareVertexScan(info.tableEntry, info.propertiesToScan);
         while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
+            TraceScope morselScope{tracer, "morsel", "VertexMorsel"};
             for (auto chunk :
                 graph->scanVertices(morsel.getBeginOffset(), morsel.getEndOffset(), *scanState)) {
                 localVc->vertexCompute(chunk);
@@ -135,6 +192,7 @@ void VertexComputeTask::run() {
         }
     } else {
         while (sharedState->morselDispatcher.getNextRangeMorsel(morsel)) {
+            TraceScope morselScope{tracer, "morsel", "VertexMorsel"};
             localVc->vertexCompute(morsel.getBeginOffset(), morsel.getEndOffset(),
                 info.tableEntry->getTableID());
         }
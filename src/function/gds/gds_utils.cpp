@@ -19,12 +19,24 @@ using namespace ryu::graph;
 namespace ryu {
 namespace function {
 
+// Number of nodes put in the next frontier and number of rels scanned in one iteration.
+struct IterationStats {
+    uint64_t numActiveNodes = 0;
+    uint64_t numScannedRels = 0;
+};
+
 static std::shared_ptr<FrontierTask> getFrontierTask(const main::ClientContext* context,
     const GraphRelInfo& relInfo, Graph* graph, ExtendDirection extendDirection,
-    const GDSComputeState& computeState, std::vector<std::string> propertiesToScan) {
+    const GDSComputeState& computeState, std::vector<std::string> propertiesToScan, bool pull) {
     auto info = FrontierTaskInfo(relInfo.srcTableID, relInfo.dstTableID, relInfo.relGroupEntry,
         graph, extendDirection, *computeState.edgeCompute, std::move(propertiesToScan));
-    computeState.beginFrontierCompute(info.getBoundTableID(), info.getNbrTableID());
+    info.pull = pull;
+    if (pull) {
+        // Bound nodes pull from their neighbors, so the neighbors are in the current frontier.
+        computeState.beginFrontierCompute(info.getNbrTableID(), info.getBoundTableID());
+    } else {
+        computeState.beginFrontierCompute(info.getBoundTableID(), info.getNbrTableID());
+    }
     auto numThreads = context->getMaxNumThreadForExec();
     auto sharedState =
         std::make_shared<FrontierTaskSharedState>(numThreads, *computeState.frontierPair);
@@ -36,30 +48,36 @@ static std::shared_ptr<FrontierTask> getFrontierTask(const main::ClientContext*
 
 static void scheduleFrontierTask(ExecutionContext* context, const GraphRelInfo& relInfo,
     Graph* graph, ExtendDirection extendDirection, const GDSComputeState& computeState,
-    std::vector<std::string> propertiesToScan) {
+    std::vector<std::string> propertiesToScan, bool pull, IterationStats& stats) {
     auto clientContext = context->clientContext;
     auto task = getFrontierTask(clientContext, relInfo, graph, extendDirection, computeState,
-        std::move(propertiesToScan));
-    if (computeState.frontierPair->getState() == GDSDensityState::SPARSE) {
+        std::move(propertiesToScan), pull);
+    auto sharedState = task->getSharedState();
+    if (!pull && computeState.frontierPair->getState() == GDSDensityState::SPARSE) {
         task->runSparse();
-        return;
+    } else {
+        // GDSUtils::runFrontiersUntilConvergence is called from a GDSCall operator, which is
+        // already executed by a worker thread Tm of the task scheduler. So this function is
+        // executed by Tm. Because this function will monitor the task and wait for it to
+        // complete, running GDS algorithms effectively "loses" Tm. This can even lead to the
+        // query processor to halt, e.g., if there is a single worker thread in the system, and
+        // more generally decrease the number of worker threads by 1. Therefore, we instruct
+        // scheduleTaskAndWaitOrError to start a new thread by passing true as the last
+        // argument.
+        TaskScheduler::Get(*context->clientContext)
+            ->scheduleTaskAndWaitOrError(task, context, true /* launchNewWorkerThread */);
     }
-
-    // GDSUtils::runFrontiersUntilConvergence is called from a GDSCall operator, which is
-    // already executed by a worker thread Tm of the task scheduler. So this function is
-    // executed by Tm. Because this function will monitor the task and wait for it to
-    // complete, running GDS algorithms effectively "loses" Tm. This can even lead to the
-    // query processor to halt, e.g., if there is a single worker thread in the system, and
-    // more generally decrease the number of worker threads by 1. Therefore, we instruct
-    // scheduleTaskAndWaitOrError to start a new thread by passing true as the last
-    // argument.
-    TaskScheduler::Get(*context->clientContext)
-        ->scheduleTaskAndWaitOrError(task, context, true /* launchNewWorkerThread */);
+    stats.numActiveNodes += sharedState->numActiveNodes.load();
+    stats.numScannedRels += sharedState->numScannedRels.load();
 }
 
-static void runOneIteration(ExecutionContext* context, Graph* graph,
+// In pull iterations, rels are scanned in the opposite direction of the extension.
+static IterationStats runOneIteration(ExecutionContext* context, Graph* graph,
     ExtendDirection extendDirection, const GDSComputeState& compState,
-    const std::vector<std::string>& propertiesToScan) {
+    const std::vector<std::string>& propertiesToScan, bool pull = false) {
+    auto fwdDirection = pull ? ExtendDirection::BWD : ExtendDirection::FWD;
+    auto bwdDirection = pull ? ExtendDirection::FWD : ExtendDirection::BWD;
+    IterationStats stats;
     for (auto info : graph->getGraphEntry()->nodeInfos) {
         for (const auto& relInfo : graph->getRelInfos(info.entry->getTableID())) {
             if (context->clientContext->interrupted()) {
@@ -67,26 +85,72 @@ static void runOneIteration(ExecutionContext* context, Graph* graph,
             }
             switch (extendDirection) {
             case ExtendDirection::FWD: {
-                scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
+                scheduleFrontierTask(context, relInfo, graph, fwdDirection, compState,
+                    propertiesToScan, pull, stats);
             } break;
             case ExtendDirection::BWD: {
-                scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                scheduleFrontierTask(context, relInfo, graph, bwdDirection, compState,
+                    propertiesToScan, pull, stats);
             } break;
             case ExtendDirection::BOTH: {
-                scheduleFrontierTask(context, relInfo, graph, ExtendDirection::FWD, compState,
-                    propertiesToScan);
-                scheduleFrontierTask(context, relInfo, graph, ExtendDirection::BWD, compState,
-                    propertiesToScan);
+                scheduleFrontierTask(context, relInfo, graph, fwdDirection, compState,
+                    propertiesToScan, pull, stats);
+                scheduleFrontierTask(context, relInfo, graph, bwdDirection, compState,
+                    propertiesToScan, pull, stats);
             } break;
             default:
                 KU_UNREACHABLE;
             }
         }
     }
+    return stats;
 }
 
+// Chooses between push (top-down) and pull (bottom-up) iterations of BFS-like edge computes with
+// the heuristic of direction-optimizing BFS (Beamer et al.). Pulling pays off once the rels of the
+// frontier outnumber a fraction of the rels of the unvisited nodes, because an unvisited node
+// stops scanning as soon as it is reached. Once the frontier becomes small again, pushing is
+// cheaper since the unvisited nodes are still scanned in full in pull iterations.
+// Node degrees are estimated from the rels scanned in push iterations.
+class BFSDirectionOptimizer {
+    static constexpr double ALPHA = 14;
+    static constexpr double BETA = 24;
+
+public:
+    explicit BFSDirectionOptimizer(offset_t numNodes)
+        : numNodes{numNodes}, numUnvisitedNodes{numNodes == 0 ? 0 : numNodes - 1} {}
+
+    bool isPull() const { return pull; }
+
+    void update(const IterationStats& stats) {
+        auto numNextNodes = stats.numActiveNodes;
+        numUnvisitedNodes -= std::min(numUnvisitedNodes, numNextNodes);
+        if (pull) {
+            pull = !(numNextNodes < numFrontierNodes && numNextNodes < numNodes / BETA);
+        } else {
+            numExpandedNodes += numFrontierNodes;
+            numExpandedRels += stats.numScannedRels;
+            auto frontierDegree =
+                (double)stats.numScannedRels / (double)std::max<offset_t>(numFrontierNodes, 1);
+            auto avgDegree =
+                (double)numExpandedRels / (double)std::max<offset_t>(numExpandedNodes, 1);
+            auto numFrontierRels = numNextNodes * frontierDegree;
+            auto numUnvisitedRels = numUnvisitedNodes * avgDegree;
+            pull = numNextNodes > numFrontierNodes && numFrontierRels > numUnvisitedRels / ALPHA;
+        }
+        numFrontierNodes = numNextNodes;
+    }
+
+private:
+    offset_t numNodes;
+    offset_t numUnvisitedNodes;
+    // Number of nodes in the current frontier. Recursive joins start from a single source node.
+    offset_t numFrontierNodes = 1;
+    offset_t numExpandedNodes = 0;
+    uint64_t numExpandedRels = 0;
+    bool pull = false;
+};
+
 void GDSUtils::runAlgorithmEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
     Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration) {
     auto frontierPair = compState.frontierPair.get();
@@ -105,15 +169,35 @@ void GDSUtils::runFTSEdgeCompute(ExecutionContext* context, GDSComputeState& com
 
 void GDSUtils::runRecursiveJoinEdgeCompute(ExecutionContext* context, GDSComputeState& compState,
     Graph* graph, ExtendDirection extendDirection, uint64_t maxIteration,
-    NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan) {
+    NodeOffsetMaskMap* outputNodeMask, const std::vector<std::string>& propertiesToScan,
+    uint64_t minOutputIteration, offset_t numOutputsToStop) {
     auto frontierPair = compState.frontierPair.get();
     compState.edgeCompute->resetSingleThreadState();
+    auto canPull = compState.edgeCompute->canPull();
+    auto optimizer = BFSDirectionOptimizer(
+        canPull ? graph->getNumNodes(transaction::Transaction::Get(*context->clientContext)) : 0);
+    offset_t numOutputs = 0;
     while (frontierPair->continueNextIter(maxIteration)) {
         frontierPair->beginNewIteration();
         if (outputNodeMask != nullptr && compState.edgeCompute->terminate(*outputNodeMask)) {
             break;
         }
-        runOneIteration(context, graph, extendDirection, compState, propertiesToScan);
+        // Pull iterations need the current frontier to be dense.
+        auto pull = optimizer.isPull() && frontierPair->getState() == GDSDensityState::DENSE;
+        auto stats =
+            runOneIteration(context, graph, extendDirection, compState, propertiesToScan, pull);
+        if (canPull) {
+            optimizer.update(stats);
+        }
+        if (frontierPair->getCurrentIter() >= minOutputIteration) {
+            numOutputs += stats.numActiveNodes;
+            if (numOutputs >= numOutputsToStop) {
+                break;
+            }
+        }
+        if (!frontierPair->hasActiveNodesForNextIter()) {
+            compState.auxiliaryState->activateDeferredNodes(*frontierPair);
+        }
         if (frontierPair->needSwitchToDense(
                 context->clientContext->getClientConfig()->sparseFrontierThreshold)) {
             compState.switchToDense(context, graph);
@@ -0,0 +1,105 @@
+#include "function/gds/multi_source_bfs.h"
+
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::common;
+using namespace ryu::graph;
+using namespace ryu::processor;
+
+namespace ryu {
+namespace function {
+
+static void clear(const GDSDenseObjectManager<std::atomic<msbfs_lanes_t>>& objects,
+    const table_id_map_t<offset_t>& nodeMaxOffsetMap) {
+    for (const auto& [tableID, maxOffset] : nodeMaxOffsetMap) {
+        auto data = objects.getData(tableID);
+        for (auto i = 0u; i < maxOffset; ++i) {
+            data[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+MSBFSLanes::MSBFSLanes(const table_id_map_t<offset_t>& nodeMaxOffsetMap,
+    storage::MemoryManager* mm)
+    : nodeMaxOffsetMap{nodeMaxOffsetMap} {
+    for (const auto& [tableID, maxOffset] : nodeMaxOffsetMap) {
+        seenObjects.allocate(tableID, maxOffset, mm);
+        for (auto& objects : laneObjects) {
+            objects.allocate(tableID, maxOffset, mm);
+        }
+    }
+    clear(seenObjects, nodeMaxOffsetMap);
+    for (auto& objects : laneObjects) {
+        clear(objects, nodeMaxOffsetMap);
+    }
+}
+
+void MSBFSLanes::initSource(nodeID_t sourceNodeID) {
+    KU_ASSERT(numSources < MAX_NUM_SOURCES);
+    auto lane = (msbfs_lanes_t)1 << numSources++;
+    pinNextTableID(sourceNodeID.tableID);
+    nextSeen[sourceNodeID.offset].fetch_or(lane, std::memory_order_relaxed);
+    nextLanes[sourceNodeID.offset].fetch_or(lane, std::memory_order_relaxed);
+}
+
+void MSBFSLanes::beginFrontierCompute(table_id_t curTableID, table_id_t nextTableID) {
+    curLanes = laneObjects[curLanesIdx].getData(curTableID);
+    pinNextTableID(nextTableID);
+}
+
+void MSBFSLanes::beginNewIteration() {
+    curIter++;
+    curLanesIdx ^= 1;
+    clear(laneObjects[curLanesIdx ^ 1], nodeMaxOffsetMap);
+}
+
+msbfs_lanes_t MSBFSLanes::addLanesToNextFrontier(offset_t offset, msbfs_lanes_t lanes) {
+    auto newLanes = lanes & ~nextSeen[offset].load(std::memory_order_relaxed);
+    if (newLanes == 0) {
+        return 0;
+    }
+    newLanes &= ~nextSeen[offset].fetch_or(newLanes, std::memory_order_relaxed);
+    if (newLanes != 0) {
+        nextLanes[offset].fetch_or(newLanes, std::memory_order_relaxed);
+    }
+    return newLanes;
+}
+
+void MSBFSLanes::pinNextTableID(table_id_t tableID) {
+    nextLanes = laneObjects[curLanesIdx ^ 1].getData(tableID);
+    nextSeen = seenObjects.getData(tableID);
+}
+
+std::unique_ptr<GDSComputeState> MSBFSLanes::getComputeState(ExecutionContext* context,
+    Graph* graph) {
+    auto clientContext = context->clientContext;
+    auto maxOffsetMap = graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext));
+    auto curFrontier = DenseBitsetFrontier::getUnvisitedFrontier(context, graph);
+    auto nextFrontier = DenseBitsetFrontier::getUnvisitedFrontier(context, graph);
+    // Sources are added to the next frontier before the first iteration.
+    nextFrontier->reset(FRONTIER_INITIAL_VISITED);
+    auto frontierPair = std::make_unique<DenseBitsetFrontierPair>(std::move(curFrontier),
+        std::move(nextFrontier));
+    auto lanes =
+        std::make_unique<MSBFSLanes>(maxOffsetMap, storage::MemoryManager::Get(*clientContext));
+    auto edgeCompute = std::make_unique<MSBFSEdgeCompute>(lanes.get());
+    return std::make_unique<GDSComputeState>(std::move(frontierPair), std::move(edgeCompute),
+        std::move(lanes));
+}
+
+std::vector<nodeID_t> MSBFSEdgeCompute::edgeCompute(nodeID_t boundNodeID,
+    NbrScanState::Chunk& resultChunk, bool) {
+    std::vector<nodeID_t> activeNodes;
+    auto boundLanes = lanes->getCurrentLanes(boundNodeID.offset);
+    resultChunk.forEach([&](auto neighbors, auto, auto i) {
+        auto nbrNodeID = neighbors[i];
+        if (lanes->addLanesToNextFrontier(nbrNodeID.offset, boundLanes) != 0) {
+            activeNodes.push_back(nbrNodeID);
+        }
+    });
+    return activeNodes;
+}
+
+} // namespace function
+} // namespace ryu
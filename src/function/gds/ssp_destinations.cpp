@@ -1,3 +1,5 @@
+#include <bit>
+
 #include "binder/expression/node_expression.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
@@ -58,6 +60,53 @@ private:
     std::unique_ptr<ValueVector> lengthVector;
 };
 
+// Writes the destinations reached in the current iteration of a multi-source BFS, for all sources
+// of the batch.
+class MSBFSDestinationsOutputWriter : public RJOutputWriter {
+public:
+    MSBFSDestinationsOutputWriter(ClientContext* context, NodeOffsetMaskMap* outputNodeMask,
+        std::vector<nodeID_t> sourceNodeIDs, MSBFSLanes& lanes)
+        : RJOutputWriter{context, outputNodeMask, sourceNodeIDs[0]},
+          sourceNodeIDs{std::move(sourceNodeIDs)}, lanes{lanes} {
+        lengthVector = createVector(LogicalType::UINT16());
+    }
+
+    void beginWritingInternal(table_id_t tableID) override { lanes.pinNextTableID(tableID); }
+
+    void write(FactorizedTable&, table_id_t, LimitCounter*) override {
+        // Multi-source BFS only runs with dense frontiers.
+        KU_UNREACHABLE;
+    }
+
+    void write(FactorizedTable& fTable, nodeID_t dstNodeID, LimitCounter* counter) override {
+        auto nodeLanes = lanes.getNextLanes(dstNodeID.offset);
+        if (nodeLanes == 0 || !inOutputNodeMask(dstNodeID.offset)) {
+            return;
+        }
+        dstNodeIDVector->setValue<nodeID_t>(0, dstNodeID);
+        lengthVector->setValue<uint16_t>(0, lanes.getCurrentIter());
+        while (nodeLanes != 0) {
+            auto lane = std::countr_zero(nodeLanes);
+            nodeLanes &= nodeLanes - 1;
+            srcNodeIDVector->setValue<nodeID_t>(0, sourceNodeIDs[lane]);
+            fTable.append(vectors);
+            if (counter != nullptr) {
+                counter->increase(1);
+            }
+        }
+    }
+
+    std::unique_ptr<RJOutputWriter> copy() override {
+        return std::make_unique<MSBFSDestinationsOutputWriter>(context, outputNodeMask,
+            sourceNodeIDs, lanes);
+    }
+
+private:
+    std::vector<nodeID_t> sourceNodeIDs;
+    MSBFSLanes& lanes;
+    std::unique_ptr<ValueVector> lengthVector;
+};
+
 class SSPDestinationsEdgeCompute : public SPEdgeCompute {
 public:
     explicit SSPDestinationsEdgeCompute(SPFrontierPair* frontierPair)
@@ -75,6 +124,22 @@ public:
         return activeNodes;
     }
 
+    bool canPull() const override { return true; }
+
+    bool shouldPull(offset_t offset) override {
+        return frontierPair->getNextFrontierValue(offset) == FRONTIER_UNVISITED;
+    }
+
+    bool pullCompute(nodeID_t, NbrScanState::Chunk& resultChunk, bool& reached) override {
+        // A node is reached through any of its neighbors in the current frontier, so the rest of
+        // its neighbors are skipped.
+        resultChunk.forEachBreakWhenFalse([&](auto neighbors, auto i) {
+            reached = frontierPair->isActiveOnCurrentFrontier(neighbors[i].offset);
+            return !reached;
+        });
+        return !reached;
+    }
+
     std::unique_ptr<EdgeCompute> copy() override {
         return std::make_unique<SSPDestinationsEdgeCompute>(frontierPair);
     }
@@ -98,6 +163,15 @@ public:
         return std::make_unique<SingleSPDestinationsAlgorithm>(*this);
     }
 
+    bool supportMultiSource() const override { return true; }
+
+    std::unique_ptr<RJOutputWriter> getMultiSourceOutputWriter(ExecutionContext* context,
+        MSBFSLanes& lanes, std::vector<nodeID_t> sourceNodeIDs,
+        RecursiveExtendSharedState* sharedState) override {
+        return std::make_unique<MSBFSDestinationsOutputWriter>(context->clientContext,
+            sharedState->getOutputNodeMaskMap(), std::move(sourceNodeIDs), lanes);
+    }
+
 private:
     std::unique_ptr<GDSComputeState> getComputeState(ExecutionContext* context, const RJBindData&,
         RecursiveExtendSharedState* sharedState) override {
@@ -1,6 +1,7 @@
 #include "binder/expression/node_expression.h"
 #include "function/gds/auxiliary_state/path_auxiliary_state.h"
 #include "function/gds/gds_function_collection.h"
+#include "function/gds/gds_utils.h"
 #include "function/gds/rec_joins.h"
 // #include "main/client_context.h"
 #include "processor/execution_context.h"
@@ -48,6 +49,128 @@ private:
     ObjectBlock<ParentList>* block = nullptr;
 };
 
+// State shared by the two searches of a bidirectional search, one from the source in the extend
+// direction and one from the destination in the opposite direction.
+struct BidirectionalSearchState {
+    std::mutex mtx;
+    std::atomic<bool> met = false;
+    // A node reached by both searches.
+    nodeID_t meetingNodeID;
+
+    void setMeetingNode(nodeID_t nodeID) {
+        std::unique_lock lck{mtx};
+        if (!met.load(std::memory_order_relaxed)) {
+            meetingNodeID = nodeID;
+            met.store(true, std::memory_order_relaxed);
+        }
+    }
+};
+
+class BidirectionalPathAuxiliaryState : public PathAuxiliaryState {
+public:
+    BidirectionalPathAuxiliaryState(std::unique_ptr<BFSGraphManager> bfsGraphManager,
+        std::shared_ptr<BidirectionalSearchState> searchState)
+        : PathAuxiliaryState{std::move(bfsGraphManager)}, searchState{std::move(searchState)} {}
+
+    BidirectionalSearchState* getSearchState() const { return searchState.get(); }
+    void setOtherFrontierPair(std::shared_ptr<FrontierPair> frontierPair) {
+        otherFrontierPair = std::move(frontierPair);
+    }
+
+    void beginFrontierCompute(table_id_t fromTableID, table_id_t toTableID) override {
+        PathAuxiliaryState::beginFrontierCompute(fromTableID, toTableID);
+        otherFrontier = otherFrontierPair->ptrCast<SPFrontierPair>()->getFrontier();
+        otherFrontier->pinTableID(toTableID);
+    }
+
+    bool isReachedByOtherSearch(offset_t offset) const {
+        return otherFrontier->getIteration(offset) != FRONTIER_UNVISITED;
+    }
+
+    void addNumNodesReached(uint64_t numNodes) {
+        numNodesReached.fetch_add(numNodes, std::memory_order_relaxed);
+    }
+    // Returns the number of nodes reached since the last call.
+    uint64_t popNumNodesReached() { return numNodesReached.exchange(0); }
+
+private:
+    std::shared_ptr<BidirectionalSearchState> searchState;
+    std::shared_ptr<FrontierPair> otherFrontierPair;
+    Frontier* otherFrontier = nullptr;
+    std::atomic<uint64_t> numNodesReached = 0;
+};
+
+class BidirectionalSSPPathsEdgeCompute : public SSPPathsEdgeCompute {
+public:
+    BidirectionalSSPPathsEdgeCompute(SPFrontierPair* frontierPair,
+        BidirectionalPathAuxiliaryState* auxiliaryState)
+        : SSPPathsEdgeCompute{frontierPair, auxiliaryState->getBFSGraphManager()},
+          auxiliaryState{auxiliaryState} {}
+
+    std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& resultChunk,
+        bool isFwd) override {
+        auto activeNodes = SSPPathsEdgeCompute::edgeCompute(boundNodeID, resultChunk, isFwd);
+        auxiliaryState->addNumNodesReached(activeNodes.size());
+        for (auto& nodeID : activeNodes) {
+            if (auxiliaryState->isReachedByOtherSearch(nodeID.offset)) {
+                auxiliaryState->getSearchState()->setMeetingNode(nodeID);
+            }
+        }
+        return activeNodes;
+    }
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<BidirectionalSSPPathsEdgeCompute>(frontierPair, auxiliaryState);
+    }
+
+private:
+    BidirectionalPathAuxiliaryState* auxiliaryState;
+};
+
+static ExtendDirection getReverseDirection(ExtendDirection direction) {
+    switch (direction) {
+    case ExtendDirection::FWD:
+        return ExtendDirection::BWD;
+    case ExtendDirection::BWD:
+        return ExtendDirection::FWD;
+    case ExtendDirection::BOTH:
+        return ExtendDirection::BOTH;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+// Appends the path from the meeting node to the destination, found by the search from the
+// destination, to the BFS graph of the search from the source.
+static void stitchPaths(SPFrontierPair& fwdFrontierPair, BaseBFSGraph& fwdGraph,
+    BaseBFSGraph& bwdGraph, nodeID_t meetingNodeID) {
+    auto fwdFrontier = fwdFrontierPair.getFrontier();
+    auto block = fwdGraph.addNewBlock();
+    auto nodeID = meetingNodeID;
+    fwdFrontier->pinTableID(nodeID.tableID);
+    auto iter = fwdFrontier->getIteration(nodeID.offset);
+    auto parent = bwdGraph.getParentListHead(nodeID);
+    while (parent != nullptr) {
+        auto nextNodeID = parent->getNodeID();
+        fwdFrontier->pinTableID(nextNodeID.tableID);
+        auto nextIter = fwdFrontier->getIteration(nextNodeID.offset);
+        // Nodes already reached from the source keep their parent, which is on a path that is at
+        // least as short.
+        if (nextIter == FRONTIER_UNVISITED) {
+            nextIter = iter + 1;
+            if (!block->hasSpace()) {
+                block = fwdGraph.addNewBlock();
+            }
+            fwdGraph.pinTableID(nextNodeID.tableID);
+            fwdGraph.addSingleParent(nextIter, nodeID, parent->getEdgeID(), nextNodeID,
+                !parent->isFwdEdge(), block);
+        }
+        nodeID = nextNodeID;
+        iter = nextIter;
+        parent = bwdGraph.getParentListHead(nodeID);
+    }
+}
+
 // Single shortest path algorithm. Paths are tracked.
 // If there are multiple path to a destination. Only one of the path is tracked.
 class SingleSPPathsAlgorithm : public RJAlgorithm {
@@ -71,6 +194,56 @@ public:
         return std::make_unique<SingleSPPathsAlgorithm>(*this);
     }
 
+    bool supportBidirectional() const override { return true; }
+    // Searches from the source and the destination in turns, extending the search with the
+    // smaller frontier by one iteration, until the searches meet. The first meeting found is on a
+    // shortest path, which is added to the BFS graph of the search from the source.
+    std::unique_ptr<GDSComputeState> runBidirectional(ExecutionContext* context,
+        const RJBindData& bindData, RecursiveExtendSharedState* sharedState,
+        nodeID_t sourceNodeID, nodeID_t dstNodeID,
+        const std::vector<std::string>& propertiesToScan) override {
+        auto graph = sharedState->graph.get();
+        auto searchState = std::make_shared<BidirectionalSearchState>();
+        auto fwdState = getBidirectionalComputeState(context, graph, searchState);
+        auto bwdState = getBidirectionalComputeState(context, graph, searchState);
+        auto fwdAuxState = fwdState->auxiliaryState->ptrCast<BidirectionalPathAuxiliaryState>();
+        auto bwdAuxState = bwdState->auxiliaryState->ptrCast<BidirectionalPathAuxiliaryState>();
+        fwdAuxState->setOtherFrontierPair(bwdState->frontierPair);
+        bwdAuxState->setOtherFrontierPair(fwdState->frontierPair);
+        fwdState->initSource(sourceNodeID);
+        bwdState->initSource(dstNodeID);
+        if (sourceNodeID == dstNodeID) {
+            return fwdState;
+        }
+        auto fwdFrontierPair = fwdState->frontierPair->ptrCast<SPFrontierPair>();
+        auto bwdFrontierPair = bwdState->frontierPair->ptrCast<SPFrontierPair>();
+        uint64_t fwdFrontierSize = 1, bwdFrontierSize = 1;
+        while (!searchState->met.load(std::memory_order_relaxed) &&
+               fwdFrontierPair->getCurrentIter() + bwdFrontierPair->getCurrentIter() <
+                   bindData.upperBound) {
+            auto isFwd = fwdFrontierSize <= bwdFrontierSize;
+            auto& computeState = isFwd ? *fwdState : *bwdState;
+            auto frontierPair = computeState.frontierPair.get();
+            if (!frontierPair->hasActiveNodesForNextIter()) {
+                break;
+            }
+            auto direction =
+                isFwd ? bindData.extendDirection : getReverseDirection(bindData.extendDirection);
+            GDSUtils::runRecursiveJoinEdgeCompute(context, computeState, graph, direction,
+                frontierPair->getCurrentIter() + 1 /* maxIteration */,
+                nullptr /* outputNodeMask */, propertiesToScan);
+            auto numNodesReached = computeState.auxiliaryState
+                                       ->ptrCast<BidirectionalPathAuxiliaryState>()
+                                       ->popNumNodesReached();
+            (isFwd ? fwdFrontierSize : bwdFrontierSize) = numNodesReached;
+        }
+        if (searchState->met.load(std::memory_order_relaxed)) {
+            stitchPaths(*fwdFrontierPair, *fwdAuxState->getBFSGraphManager()->getCurrentGraph(),
+                *bwdAuxState->getBFSGraphManager()->getCurrentGraph(), searchState->meetingNodeID);
+        }
+        return fwdState;
+    }
+
 private:
     std::unique_ptr<GDSComputeState> getComputeState(ExecutionContext* context, const RJBindData&,
         RecursiveExtendSharedState* sharedState) override {
@@ -88,6 +261,23 @@ private:
             std::move(auxiliaryState));
     }
 
+    static std::unique_ptr<GDSComputeState> getBidirectionalComputeState(
+        ExecutionContext* context, graph::Graph* graph,
+        std::shared_ptr<BidirectionalSearchState> searchState) {
+        auto clientContext = context->clientContext;
+        auto frontier = DenseFrontier::getUninitializedFrontier(context, graph);
+        auto frontierPair = std::make_unique<SPFrontierPair>(std::move(frontier));
+        auto transaction = transaction::Transaction::Get(*clientContext);
+        auto bfsGraph = std::make_unique<BFSGraphManager>(graph->getMaxOffsetMap(transaction),
+            storage::MemoryManager::Get(*clientContext));
+        auto auxiliaryState = std::make_unique<BidirectionalPathAuxiliaryState>(std::move(bfsGraph),
+            std::move(searchState));
+        auto edgeCompute = std::make_unique<BidirectionalSSPPathsEdgeCompute>(frontierPair.get(),
+            auxiliaryState.get());
+        return std::make_unique<GDSComputeState>(std::move(frontierPair), std::move(edgeCompute),
+            std::move(auxiliaryState));
+    }
+
     std::unique_ptr<RJOutputWriter> getOutputWriter(ExecutionContext* context,
         const RJBindData& bindData, GDSComputeState& computeState, nodeID_t sourceNodeID,
         RecursiveExtendSharedState* sharedState) override {
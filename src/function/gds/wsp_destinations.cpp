@@ -1,4 +1,5 @@
 #include "binder/expression/node_expression.h"
+#include "function/gds/delta_stepping.h"
 #include "function/gds/gds_function_collection.h"
 #include "function/gds/rec_joins.h"
 #include "function/gds/weight_utils.h"
@@ -141,9 +142,9 @@ public:
     }
 
     // CAS update nbrOffset if new path from boundOffset has a smaller cost.
-    bool update(offset_t boundOffset, offset_t nbrOffset, double val) {
+    bool update(offset_t boundOffset, offset_t nbrOffset, double val, double& newCost) {
         KU_ASSERT(curCosts && nextCosts);
-        auto newCost = curCosts->getCost(boundOffset) + val;
+        newCost = curCosts->getCost(boundOffset) + val;
         return nextCosts->tryReplaceWithMinCost(nbrOffset, newCost);
     }
 
@@ -183,7 +184,8 @@ private:
 template<typename T>
 class WSPDestinationsEdgeCompute : public EdgeCompute {
 public:
-    explicit WSPDestinationsEdgeCompute(CostsPair* costsPair) : costsPair{costsPair} {}
+    WSPDestinationsEdgeCompute(CostsPair* costsPair, DeltaSteppingBuckets* buckets)
+        : costsPair{costsPair}, buckets{buckets} {}
 
     std::vector<nodeID_t> edgeCompute(nodeID_t boundNodeID, graph::NbrScanState::Chunk& chunk,
         bool) override {
@@ -192,8 +194,10 @@ public:
             auto nbrNodeID = neighbors[i];
             auto weight = propertyVectors[0]->template getValue<T>(i);
             WeightUtils::checkWeight(WeightedSPDestinationsFunction::name, weight);
+            double newCost = 0;
             if (costsPair->update(boundNodeID.offset, nbrNodeID.offset,
-                    static_cast<double>(weight))) {
+                    static_cast<double>(weight), newCost) &&
+                (buckets == nullptr || buckets->isInCurrentBucket(nbrNodeID, newCost))) {
                 result.push_back(nbrNodeID);
             }
         });
@@ -201,17 +205,19 @@ public:
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<WSPDestinationsEdgeCompute<T>>(costsPair);
+        return std::make_unique<WSPDestinationsEdgeCompute<T>>(costsPair, buckets);
     }
 
 private:
     CostsPair* costsPair;
+    DeltaSteppingBuckets* buckets;
 };
 
 class WSPDestinationsAuxiliaryState : public GDSAuxiliaryState {
 public:
-    explicit WSPDestinationsAuxiliaryState(std::unique_ptr<CostsPair> costsPair)
-        : costsPair{std::move(costsPair)} {}
+    WSPDestinationsAuxiliaryState(std::unique_ptr<CostsPair> costsPair,
+        std::unique_ptr<DeltaSteppingBuckets> buckets)
+        : costsPair{std::move(costsPair)}, buckets{std::move(buckets)} {}
 
     Costs* getCosts() { return costsPair->getCurrentCosts(); }
 
@@ -229,8 +235,20 @@ public:
         costsPair->switchToDense(context);
     }
 
+    bool activateDeferredNodes(FrontierPair& frontierPair) override {
+        if (buckets == nullptr) {
+            return false;
+        }
+        return buckets->activateNextBucket(frontierPair, [&](nodeID_t nodeID) {
+            costsPair->pinCurTableID(nodeID.tableID);
+            return costsPair->getCurrentCosts()->getCost(nodeID.offset);
+        });
+    }
+
 private:
     std::unique_ptr<CostsPair> costsPair;
+    // Null unless weighted shortest paths are computed with delta-stepping.
+    std::unique_ptr<DeltaSteppingBuckets> buckets;
 };
 
 class WSPDestinationsOutputWriter : public RJOutputWriter {
@@ -309,11 +327,15 @@ private:
         auto costsPair = std::make_unique<CostsPair>(
             graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext)));
         auto costPairPtr = costsPair.get();
-        auto auxiliaryState = std::make_unique<WSPDestinationsAuxiliaryState>(std::move(costsPair));
+        auto buckets = DeltaSteppingBuckets::create(*clientContext);
+        auto bucketsPtr = buckets.get();
+        auto auxiliaryState = std::make_unique<WSPDestinationsAuxiliaryState>(std::move(costsPair),
+            std::move(buckets));
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPDestinationsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<WSPDestinationsEdgeCompute<T>>(costPairPtr);
+                auto edgeCompute =
+                    std::make_unique<WSPDestinationsEdgeCompute<T>>(costPairPtr, bucketsPtr);
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
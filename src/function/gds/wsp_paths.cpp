@@ -17,8 +17,8 @@ namespace function {
 template<typename T>
 class WSPPathsEdgeCompute : public EdgeCompute {
 public:
-    explicit WSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager)
-        : bfsGraphManager{bfsGraphManager} {
+    WSPPathsEdgeCompute(BFSGraphManager* bfsGraphManager, DeltaSteppingBuckets* buckets)
+        : bfsGraphManager{bfsGraphManager}, buckets{buckets} {
         block = bfsGraphManager->getCurrentGraph()->addNewBlock();
     }
 
@@ -33,20 +33,26 @@ public:
             if (!block->hasSpace()) {
                 block = bfsGraphManager->getCurrentGraph()->addNewBlock();
             }
-            if (bfsGraphManager->getCurrentGraph()->tryAddSingleParentWithWeight(boundNodeID,
+            auto bfsGraph = bfsGraphManager->getCurrentGraph();
+            if (bfsGraph->tryAddSingleParentWithWeight(boundNodeID,
                     edgeID, nbrNodeID, fwdEdge, static_cast<double>(weight), block)) {
-                result.push_back(nbrNodeID);
+                if (buckets == nullptr ||
+                    buckets->isInCurrentBucket(nbrNodeID,
+                        bfsGraph->getParentListHead(nbrNodeID.offset)->getCost())) {
+                    result.push_back(nbrNodeID);
+                }
             }
         });
         return result;
     }
 
     std::unique_ptr<EdgeCompute> copy() override {
-        return std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphManager);
+        return std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraphManager, buckets);
     }
 
 private:
     BFSGraphManager* bfsGraphManager;
+    DeltaSteppingBuckets* buckets;
     ObjectBlock<ParentList>* block = nullptr;
 };
 
@@ -124,11 +130,15 @@ private:
         auto bfsGraph = std::make_unique<BFSGraphManager>(
             sharedState->graph->getMaxOffsetMap(transaction::Transaction::Get(*clientContext)),
             MemoryManager::Get(*clientContext));
+        auto buckets = DeltaSteppingBuckets::create(*clientContext);
+        auto bucketsPtr = buckets.get();
         std::unique_ptr<GDSComputeState> gdsState;
         WeightUtils::visit(WeightedSPPathsFunction::name,
             bindData.weightPropertyExpr->getDataType(), [&]<typename T>(T) {
-                auto edgeCompute = std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraph.get());
-                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph));
+                auto edgeCompute =
+                    std::make_unique<WSPPathsEdgeCompute<T>>(bfsGraph.get(), bucketsPtr);
+                auto auxiliaryState = std::make_unique<WSPPathsAuxiliaryState>(std::move(bfsGraph),
+                    std::move(buckets));
                 gdsState = std::make_unique<GDSComputeState>(std::move(frontierPair),
                     std::move(edgeCompute), std::move(auxiliaryState));
             });
@@ -0,0 +1,36 @@
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "function/internal_id/vector_internal_id_functions.h"
+#include "function/scalar_function.h"
+#include "storage/storage_utils.h"
+
+namespace ryu {
+namespace function {
+
+using namespace common;
+
+struct NodeGroupPartition {
+    static void operation(internalID_t& nodeID, int64_t& partitionIdx, int64_t& numPartitions,
+        bool& result) {
+        if (numPartitions <= 0 || partitionIdx < 0 || partitionIdx >= numPartitions) {
+            throw RuntimeException(stringFormat("Invalid partition {} of {} partitions.",
+                partitionIdx, numPartitions));
+        }
+        result = storage::StorageUtils::getNodeGroupIdx(nodeID.offset) % numPartitions ==
+                 static_cast<uint64_t>(partitionIdx);
+    }
+};
+
+function_set NodeGroupPartitionFunction::getFunctionSet() {
+    function_set result;
+    result.push_back(std::make_unique<ScalarFunction>(name,
+        std::vector<LogicalTypeID>{LogicalTypeID::INTERNAL_ID, LogicalTypeID::INT64,
+            LogicalTypeID::INT64},
+        LogicalTypeID::BOOL,
+        ScalarFunction::TernaryExecFunction<internalID_t, int64_t, int64_t, bool,
+            NodeGroupPartition>));
+    return result;
+}
+
+} // namespace function
+} // namespace ryu
@@ -1,5 +1,8 @@
+#include <unordered_set>
+
 #include "binder/expression/expression_util.h"
 #include "common/exception/binder.h"
+#include "common/string_utils.h"
 #include "common/type_utils.h"
 #include "function/list/functions/list_position_function.h"
 #include "function/list/vector_list_functions.h"
@@ -22,6 +25,70 @@ struct ListContains {
     }
 };
 
+template<typename T>
+struct ListElementSet {
+    using element_t = std::conditional_t<std::is_same_v<T, ku_string_t>, std::string, T>;
+    using set_t = std::conditional_t<std::is_same_v<T, ku_string_t>,
+        std::unordered_set<std::string, StringUtils::string_hash, std::equal_to<>>,
+        std::unordered_set<T>>;
+
+    set_t elements;
+
+    static auto getKey(const T& element) {
+        if constexpr (std::is_same_v<T, ku_string_t>) {
+            return element.getAsStringView();
+        } else {
+            return element;
+        }
+    }
+};
+
+// Bind data of list_contains with a constant list. Its elements are hashed the first time the
+// function is evaluated, when the list has been cast to the type of the element, so that each
+// element is probed in constant time instead of scanning the list.
+template<typename T>
+struct ListContainsConstantBindData final : FunctionBindData {
+    std::unique_ptr<ListElementSet<T>> elementSet;
+
+    explicit ListContainsConstantBindData(std::vector<LogicalType> paramTypes)
+        : FunctionBindData{std::move(paramTypes), LogicalType::BOOL()} {}
+
+    std::unique_ptr<FunctionBindData> copy() const override {
+        return std::make_unique<ListContainsConstantBindData>(copyVector(paramTypes));
+    }
+};
+
+struct ListContainsConstant {
+    template<typename T>
+    static void operation(list_entry_t& list, T& element, uint8_t& result,
+        ValueVector& listVector, ValueVector& /*elementVector*/, ValueVector& /*resultVector*/,
+        void* dataPtr) {
+        auto bindData = static_cast<ListContainsConstantBindData<T>*>(dataPtr);
+        if (bindData->elementSet == nullptr) {
+            bindData->elementSet = std::make_unique<ListElementSet<T>>();
+            auto dataVector = ListVector::getDataVector(&listVector);
+            auto listElements = reinterpret_cast<T*>(ListVector::getListValues(&listVector, list));
+            for (auto i = 0u; i < list.size; i++) {
+                if (!dataVector->isNull(list.offset + i)) {
+                    bindData->elementSet->elements.emplace(
+                        ListElementSet<T>::getKey(listElements[i]));
+                }
+            }
+        }
+        result = bindData->elementSet->elements.contains(ListElementSet<T>::getKey(element));
+    }
+};
+
+template<typename T>
+static constexpr bool isHashable() {
+    return std::is_arithmetic_v<T> || std::is_same_v<T, ku_string_t>;
+}
+
+static bool isConstant(const binder::Expression& expression) {
+    return expression.expressionType == ExpressionType::LITERAL ||
+           expression.expressionType == ExpressionType::PARAMETER;
+}
+
 static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& input) {
     auto scalarFunction = input.definition->ptrCast<ScalarFunction>();
     // for list_contains(list, input), we expect input and list child have the same type, if list
@@ -48,11 +115,23 @@ static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& inp
     auto listType = LogicalType::LIST(childType.copy());
     paramTypes.push_back(listType.copy());
     paramTypes.push_back(childType.copy());
-    TypeUtils::visit(childType.getPhysicalType(), [&scalarFunction]<typename T>(T) {
+    std::unique_ptr<FunctionBindData> bindData;
+    TypeUtils::visit(childType.getPhysicalType(), [&]<typename T>(T) {
+        // A constant list, e.g. a literal or the parameter of `x IN $list`, is the same for all
+        // rows, so its elements are only hashed once.
+        if constexpr (isHashable<T>()) {
+            if (isConstant(*listExpr)) {
+                scalarFunction->execFunc = ScalarFunction::BinaryExecWithBindData<list_entry_t, T,
+                    uint8_t, ListContainsConstant>;
+                bindData = std::make_unique<ListContainsConstantBindData<T>>(std::move(paramTypes));
+                return;
+            }
+        }
         scalarFunction->execFunc =
             ScalarFunction::BinaryExecListStructFunction<list_entry_t, T, uint8_t, ListContains>;
+        bindData = std::make_unique<FunctionBindData>(std::move(paramTypes), LogicalType::BOOL());
     });
-    return std::make_unique<FunctionBindData>(std::move(paramTypes), LogicalType::BOOL());
+    return bindData;
 }
 
 function_set ListContainsFunction::getFunctionSet() {
@@ -28,22 +28,7 @@ static void normalizeIndices(int64_t& startIdx, int64_t& endIdx, uint64_t size)
 
 struct ListSlice {
     // Note: this function takes in a 1-based begin/end index (The index of the first value in the
-    // listEntry is 1).
-    static void operation(list_entry_t& listEntry, int64_t& begin, int64_t& end,
-        list_entry_t& result, ValueVector& listVector, ValueVector& resultVector) {
-        auto startIdx = begin;
-        auto endIdx = end;
-        normalizeIndices(startIdx, endIdx, listEntry.size);
-        result = ListVector::addList(&resultVector, endIdx - startIdx + 1);
-        auto srcDataVector = ListVector::getDataVector(&listVector);
-        auto srcPos = listEntry.offset + startIdx - 1;
-        auto dstDataVector = ListVector::getDataVector(&resultVector);
-        auto dstPos = result.offset;
-        for (; startIdx <= endIdx; startIdx++) {
-            dstDataVector->copyFromVectorData(dstPos++, srcDataVector, srcPos++);
-        }
-    }
-
+    // string is 1).
     static void operation(ku_string_t& str, int64_t& begin, int64_t& end, ku_string_t& result,
         ValueVector&, ValueVector& resultValueVector) {
         auto startIdx = begin;
@@ -53,6 +38,39 @@ struct ListSlice {
     }
 };
 
+// Slices of a list are ranges of its elements, so the result shares the data vector of the input
+// and only its list entries are computed. Begin and end indices are 1-based.
+static void sliceListExecFunc(const std::vector<std::shared_ptr<ValueVector>>& params,
+    const std::vector<SelectionVector*>& paramSelVectors, ValueVector& result,
+    SelectionVector* resultSelVector, void* /*dataPtr*/) {
+    KU_ASSERT(params.size() == 3);
+    auto& listVector = *params[0];
+    ListVector::setDataVector(&result, ListVector::getSharedDataVector(&listVector));
+    ListVector::copyBufferMetaData(result, listVector);
+    for (auto i = 0u; i < resultSelVector->getSelSize(); i++) {
+        auto resultPos = (*resultSelVector)[i];
+        auto getParamPos = [&](uint32_t paramIdx) {
+            return params[paramIdx]->state->isFlat() ? (*paramSelVectors[paramIdx])[0] :
+                                                       (*paramSelVectors[paramIdx])[i];
+        };
+        auto listPos = getParamPos(0);
+        auto beginPos = getParamPos(1);
+        auto endPos = getParamPos(2);
+        if (listVector.isNull(listPos) || params[1]->isNull(beginPos) ||
+            params[2]->isNull(endPos)) {
+            result.setNull(resultPos, true);
+            continue;
+        }
+        result.setNull(resultPos, false);
+        auto listEntry = listVector.getValue<list_entry_t>(listPos);
+        auto startIdx = params[1]->getValue<int64_t>(beginPos);
+        auto endIdx = params[2]->getValue<int64_t>(endPos);
+        normalizeIndices(startIdx, endIdx, listEntry.size);
+        result.setValue(resultPos, list_entry_t{listEntry.offset + startIdx - 1,
+                                       static_cast<list_size_t>(endIdx - startIdx + 1)});
+    }
+}
+
 static std::unique_ptr<FunctionBindData> bindFunc(const ScalarBindFuncInput& input) {
     KU_ASSERT(input.arguments.size() == 3);
     std::vector<LogicalType> paramTypes;
@@ -83,18 +101,14 @@ function_set ListSliceFunction::getFunctionSet() {
     // List slice
     func = std::make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::LIST, LogicalTypeID::INT64, LogicalTypeID::INT64},
-        LogicalTypeID::LIST,
-        ScalarFunction::TernaryExecListStructFunction<list_entry_t, int64_t, int64_t, list_entry_t,
-            ListSlice>);
+        LogicalTypeID::LIST, sliceListExecFunc);
     func->bindFunc = bindFunc;
     result.push_back(std::move(func));
     // Array slice
     func = std::make_unique<ScalarFunction>(name,
         std::vector<LogicalTypeID>{LogicalTypeID::ARRAY, LogicalTypeID::INT64,
             LogicalTypeID::INT64},
-        LogicalTypeID::LIST,
-        ScalarFunction::TernaryExecListStructFunction<list_entry_t, int64_t, int64_t, list_entry_t,
-            ListSlice>);
+        LogicalTypeID::LIST, sliceListExecFunc);
     func->bindFunc = bindFunc;
     result.push_back(std::move(func));
     // Substr
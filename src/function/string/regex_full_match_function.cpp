@@ -42,13 +42,25 @@ static std::unique_ptr<FunctionBindData> regexFullMatchBindFunc(const ScalarBind
     if (input.arguments[1]->expressionType == ExpressionType::LITERAL) {
         auto value = evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(
             input.arguments[1], input.context);
+        auto patternInStr = value.getValue<std::string>();
+        // A pattern without regular expression syntax fully matches only its literal.
+        if (auto literal = BaseRegexpOperation::getLiteral(
+                BaseRegexpOperation::parseCypherPattern(patternInStr))) {
+            input.definition->ptrCast<ScalarFunction>()->execFunc =
+                ScalarFunction::BinaryExecWithBindData<ku_string_t, ku_string_t, uint8_t,
+                    RegexpLiteralMatch<RegexpLiteralEquals>>;
+            input.definition->ptrCast<ScalarFunction>()->selectFunc =
+                ScalarFunction::BinarySelectWithBindData<ku_string_t, ku_string_t,
+                    RegexpLiteralMatch<RegexpLiteralEquals>>;
+            return std::make_unique<RegexpLiteralBindData>(
+                binder::ExpressionUtil::getDataTypes(input.arguments), std::move(literal->text));
+        }
         input.definition->ptrCast<ScalarFunction>()->execFunc =
             ScalarFunction::BinaryExecWithBindData<ku_string_t, ku_string_t, uint8_t,
                 RegexpFullMatchStaticPattern>;
         input.definition->ptrCast<ScalarFunction>()->selectFunc =
             ScalarFunction::BinarySelectWithBindData<ku_string_t, ku_string_t,
                 RegexpFullMatchStaticPattern>;
-        auto patternInStr = value.getValue<std::string>();
         return std::make_unique<RegexFullMatchBindData>(
             binder::ExpressionUtil::getDataTypes(input.arguments),
             BaseRegexpOperation::parseCypherPattern(patternInStr));
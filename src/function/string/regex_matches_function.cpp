@@ -0,0 +1,88 @@
+#include "binder/expression/expression_util.h"
+#include "expression_evaluator/expression_evaluator_utils.h"
+#include "function/string/functions/base_regexp_function.h"
+#include "function/string/functions/contains_function.h"
+#include "function/string/functions/ends_with_function.h"
+#include "function/string/functions/regexp_matches_function.h"
+#include "function/string/functions/starts_with_function.h"
+#include "function/string/vector_string_functions.h"
+#include "re2.h"
+
+namespace ryu {
+namespace function {
+
+using namespace common;
+
+struct RegexMatchesBindData : public FunctionBindData {
+    regex::RE2 pattern;
+
+    RegexMatchesBindData(common::logical_type_vec_t paramTypes, std::string patternInStr)
+        : FunctionBindData{std::move(paramTypes), common::LogicalType::BOOL()},
+          pattern{patternInStr} {}
+
+    std::unique_ptr<FunctionBindData> copy() const override {
+        return std::make_unique<RegexMatchesBindData>(copyVector(paramTypes), pattern.pattern());
+    }
+};
+
+struct RegexpMatchesStaticPattern {
+    static void operation(common::ku_string_t& left, common::ku_string_t& /*right*/,
+        uint8_t& result, common::ValueVector& /*leftValueVector*/,
+        common::ValueVector& /*rightValueVector*/, common::ValueVector& /*resultValueVector*/,
+        void* dataPtr) {
+        auto regexMatchesBindData = reinterpret_cast<RegexMatchesBindData*>(dataPtr);
+        result = RE2::PartialMatch(
+            regex::StringPiece(reinterpret_cast<const char*>(left.getData()), left.len),
+            regexMatchesBindData->pattern);
+    }
+};
+
+template<typename OP>
+static void setFunctions(ScalarFunction* function) {
+    function->execFunc = ScalarFunction::BinaryExecWithBindData<ku_string_t, ku_string_t, uint8_t,
+        OP>;
+    function->selectFunc = ScalarFunction::BinarySelectWithBindData<ku_string_t, ku_string_t, OP>;
+}
+
+static std::unique_ptr<FunctionBindData> regexMatchesBindFunc(const ScalarBindFuncInput& input) {
+    if (input.arguments[1]->expressionType != ExpressionType::LITERAL) {
+        return FunctionBindData::getSimpleBindData(input.arguments, LogicalType::BOOL());
+    }
+    auto value = evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(
+        input.arguments[1], input.context);
+    auto function = input.definition->ptrCast<ScalarFunction>();
+    auto paramTypes = binder::ExpressionUtil::getDataTypes(input.arguments);
+    auto pattern = BaseRegexpOperation::parseCypherPattern(value.getValue<std::string>());
+    // Patterns without regular expression syntax are matched with string functions.
+    if (auto literal = BaseRegexpOperation::getLiteral(pattern)) {
+        if (literal->anchoredAtStart && literal->anchoredAtEnd) {
+            setFunctions<RegexpLiteralMatch<RegexpLiteralEquals>>(function);
+        } else if (literal->anchoredAtStart) {
+            setFunctions<RegexpLiteralMatch<StartsWith>>(function);
+        } else if (literal->anchoredAtEnd) {
+            setFunctions<RegexpLiteralMatch<EndsWith>>(function);
+        } else {
+            setFunctions<RegexpLiteralMatch<Contains>>(function);
+        }
+        return std::make_unique<RegexpLiteralBindData>(std::move(paramTypes),
+            std::move(literal->text));
+    }
+    // Otherwise the pattern is compiled once instead of for every string.
+    setFunctions<RegexpMatchesStaticPattern>(function);
+    return std::make_unique<RegexMatchesBindData>(std::move(paramTypes), std::move(pattern));
+}
+
+function_set RegexpMatchesFunction::getFunctionSet() {
+    function_set functionSet;
+    auto scalarFunc = make_unique<ScalarFunction>(name,
+        std::vector<LogicalTypeID>{LogicalTypeID::STRING, LogicalTypeID::STRING},
+        LogicalTypeID::BOOL,
+        ScalarFunction::BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, RegexpMatches>,
+        ScalarFunction::BinarySelectFunction<ku_string_t, ku_string_t, RegexpMatches>);
+    scalarFunc->bindFunc = regexMatchesBindFunc;
+    functionSet.emplace_back(std::move(scalarFunc));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
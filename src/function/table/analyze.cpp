@@ -0,0 +1,245 @@
+#include <cmath>
+
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/simple_table_function.h"
+#include "function/table/standalone_call_function.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::catalog;
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+struct AnalyzeBindData final : TableFuncBindData {
+    std::vector<NodeTableCatalogEntry*> tableEntries;
+    // Fraction of the node groups of each table that stats are collected from.
+    double sampleFraction;
+
+    AnalyzeBindData(std::vector<NodeTableCatalogEntry*> tableEntries, double sampleFraction)
+        : TableFuncBindData{0}, tableEntries{std::move(tableEntries)},
+          sampleFraction{sampleFraction} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<AnalyzeBindData>(tableEntries, sampleFraction);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto transaction = transaction::Transaction::Get(*context);
+    std::vector<NodeTableCatalogEntry*> tableEntries;
+    if (input->params.empty()) {
+        tableEntries = Catalog::Get(*context)->getNodeTableEntries(transaction, false);
+    } else {
+        const auto tableName = input->getLiteralVal<std::string>(0);
+        binder::Binder::validateTableExistence(*context, tableName);
+        const auto tableEntry =
+            Catalog::Get(*context)->getTableCatalogEntry(transaction, tableName);
+        binder::Binder::validateNodeTableType(tableEntry);
+        tableEntries.push_back(tableEntry->ptrCast<NodeTableCatalogEntry>());
+    }
+    auto sampleFraction = 1.0;
+    if (input->params.size() > 1) {
+        sampleFraction = input->getLiteralVal<double>(1);
+        if (!(sampleFraction > 0 && sampleFraction <= 1)) {
+            throw BinderException{stringFormat(
+                "The sample fraction of {} must be in (0, 1].", AnalyzeFunction::name)};
+        }
+    }
+    return std::make_unique<AnalyzeBindData>(std::move(tableEntries), sampleFraction);
+}
+
+struct AnalyzeTableState {
+    storage::NodeTable& table;
+    std::vector<column_id_t> columnIDs;
+    std::vector<LogicalType> columnTypes;
+    // Rows in the committed node groups of the table and in the sampled ones, including deleted
+    // rows.
+    row_idx_t numRows = 0;
+    row_idx_t numSampledRows = 0;
+    std::mutex mtx;
+    storage::TableStats stats;
+
+    AnalyzeTableState(storage::NodeTable& table, const NodeTableCatalogEntry& tableEntry)
+        : table{table}, stats{std::span<const LogicalType>{}} {
+        for (auto& property : tableEntry.getProperties()) {
+            columnIDs.push_back(tableEntry.getColumnID(property.getName()));
+            columnTypes.push_back(property.getType().copy());
+        }
+        stats = storage::TableStats{columnTypes};
+    }
+
+    void merge(const storage::TableStats& nodeGroupStats) {
+        std::unique_lock lck{mtx};
+        stats.merge(nodeGroupStats);
+    }
+};
+
+struct AnalyzeTask {
+    idx_t tableIdx;
+    node_group_idx_t nodeGroupIdx;
+};
+
+struct AnalyzeSharedState final : SimpleTableFuncSharedState {
+    std::vector<std::unique_ptr<AnalyzeTableState>> tables;
+    std::vector<AnalyzeTask> tasks;
+    std::atomic<uint64_t> numTasksDone{0};
+
+    AnalyzeSharedState(std::vector<std::unique_ptr<AnalyzeTableState>> tables,
+        std::vector<AnalyzeTask> tasks)
+        : SimpleTableFuncSharedState{tasks.size(), 1 /*maxMorselSize*/}, tables{std::move(tables)},
+          tasks{std::move(tasks)} {}
+};
+
+// Picks evenly spaced node groups, so that the sample covers the whole table. Whole node groups
+// are sampled, since they are the unit in which the table is stored and scanned.
+static std::vector<node_group_idx_t> sampleNodeGroups(node_group_idx_t numNodeGroups,
+    double sampleFraction) {
+    if (numNodeGroups == 0) {
+        return {};
+    }
+    const auto numSampled = std::max<node_group_idx_t>(1,
+        static_cast<node_group_idx_t>(std::ceil(numNodeGroups * sampleFraction)));
+    std::vector<node_group_idx_t> nodeGroupIdxes;
+    for (auto i = 0u; i < numSampled; i++) {
+        nodeGroupIdxes.push_back(i * numNodeGroups / numSampled);
+    }
+    return nodeGroupIdxes;
+}
+
+static std::unique_ptr<TableFuncSharedState> initSharedState(
+    const TableFuncInitSharedStateInput& input) {
+    const auto bindData = input.bindData->constPtrCast<AnalyzeBindData>();
+    const auto storageManager = storage::StorageManager::Get(*input.context->clientContext);
+    std::vector<std::unique_ptr<AnalyzeTableState>> tables;
+    std::vector<AnalyzeTask> tasks;
+    for (const auto tableEntry : bindData->tableEntries) {
+        auto& table =
+            storageManager->getTable(tableEntry->getTableID())->cast<storage::NodeTable>();
+        auto tableState = std::make_unique<AnalyzeTableState>(table, *tableEntry);
+        const auto numNodeGroups = table.getNumCommittedNodeGroups();
+        for (auto i = 0u; i < numNodeGroups; i++) {
+            tableState->numRows += table.getNumTuplesInNodeGroup(i);
+        }
+        for (const auto nodeGroupIdx : sampleNodeGroups(numNodeGroups, bindData->sampleFraction)) {
+            tableState->numSampledRows += table.getNumTuplesInNodeGroup(nodeGroupIdx);
+            tasks.push_back({tables.size(), nodeGroupIdx});
+        }
+        tables.push_back(std::move(tableState));
+    }
+    return std::make_unique<AnalyzeSharedState>(std::move(tables), std::move(tasks));
+}
+
+struct AnalyzeScanState {
+    DataChunk dataChunk;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+
+    AnalyzeScanState(transaction::Transaction* transaction, const AnalyzeTableState& tableState)
+        : dataChunk{tableState.columnIDs.size() + 1, std::make_shared<DataChunkState>()} {
+        dataChunk.insert(0, std::make_shared<ValueVector>(LogicalType::INTERNAL_ID()));
+        std::vector<ValueVector*> outputVectors;
+        for (auto i = 0u; i < tableState.columnTypes.size(); i++) {
+            dataChunk.insert(i + 1,
+                std::make_shared<ValueVector>(tableState.columnTypes[i].copy()));
+            outputVectors.push_back(&dataChunk.getValueVectorMutable(i + 1));
+        }
+        scanState = std::make_unique<storage::NodeTableScanState>(
+            &dataChunk.getValueVectorMutable(0), std::move(outputVectors), dataChunk.state);
+        scanState->source = storage::TableScanSource::COMMITTED;
+        scanState->setToTable(transaction, &tableState.table, tableState.columnIDs, {});
+    }
+};
+
+struct AnalyzeLocalState final : TableFuncLocalState {
+    // Scan states are created on the first node group scanned from each table.
+    std::vector<std::unique_ptr<AnalyzeScanState>> scanStates;
+};
+
+static std::unique_ptr<TableFuncLocalState> initLocalState(const TableFuncInitLocalStateInput&) {
+    return std::make_unique<AnalyzeLocalState>();
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto sharedState = input.sharedState->ptrCast<AnalyzeSharedState>();
+    const auto localState = input.localState->ptrCast<AnalyzeLocalState>();
+    const auto morsel = sharedState->getMorsel();
+    if (morsel.isInvalid()) {
+        return 0;
+    }
+    const auto transaction = transaction::Transaction::Get(*input.context->clientContext);
+    localState->scanStates.resize(sharedState->tables.size());
+    for (auto i = morsel.startOffset; i < morsel.endOffset; i++) {
+        const auto& task = sharedState->tasks[i];
+        auto& tableState = *sharedState->tables[task.tableIdx];
+        auto& tableScanState = localState->scanStates[task.tableIdx];
+        if (tableScanState == nullptr) {
+            tableScanState = std::make_unique<AnalyzeScanState>(transaction, tableState);
+        }
+        auto& scanState = *tableScanState->scanState;
+        storage::TableStats nodeGroupStats{tableState.columnTypes};
+        scanState.nodeGroupIdx = task.nodeGroupIdx;
+        tableState.table.initScanState(transaction, scanState);
+        while (tableState.table.scan(transaction, scanState)) {
+            nodeGroupStats.update(scanState.outputVectors);
+        }
+        tableState.merge(nodeGroupStats);
+        sharedState->numTasksDone++;
+    }
+    return morsel.endOffset - morsel.startOffset;
+}
+
+static double progressFunc(TableFuncSharedState* sharedState) {
+    const auto analyzeSharedState = sharedState->ptrCast<AnalyzeSharedState>();
+    if (analyzeSharedState->tasks.empty()) {
+        return 1.0;
+    }
+    return static_cast<double>(analyzeSharedState->numTasksDone.load()) /
+           analyzeSharedState->tasks.size();
+}
+
+static void finalizeFunc(const processor::ExecutionContext* context,
+    TableFuncSharedState* sharedState) {
+    const auto analyzeSharedState = sharedState->ptrCast<AnalyzeSharedState>();
+    for (auto& tableState : analyzeSharedState->tables) {
+        if (tableState->numSampledRows < tableState->numRows) {
+            tableState->stats.extrapolate(
+                static_cast<double>(tableState->numRows) / tableState->numSampledRows);
+        }
+        tableState->table.replaceStats(tableState->columnIDs, std::move(tableState->stats));
+    }
+    // Stats are only persisted by checkpoints.
+    transaction::Transaction::Get(*context->clientContext)->setForceCheckpoint();
+}
+
+static std::unique_ptr<TableFunction> getFunction(std::vector<LogicalTypeID> inputTypes) {
+    auto func = std::make_unique<TableFunction>(AnalyzeFunction::name, std::move(inputTypes));
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = initSharedState;
+    func->initLocalStateFunc = initLocalState;
+    func->tableFunc = tableFunc;
+    func->finalizeFunc = finalizeFunc;
+    func->progressFunc = progressFunc;
+    func->canParallelFunc = [] { return true; };
+    func->isReadOnly = false;
+    return func;
+}
+
+function_set AnalyzeFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(getFunction({}));
+    functionSet.push_back(getFunction({LogicalTypeID::STRING}));
+    functionSet.push_back(getFunction({LogicalTypeID::STRING, LogicalTypeID::DOUBLE}));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
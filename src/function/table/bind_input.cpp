@@ -24,6 +24,7 @@ template RYU_API std::string TableFuncBindInput::getLiteralVal<std::string>(
     common::idx_t idx) const;
 template RYU_API int64_t TableFuncBindInput::getLiteralVal<int64_t>(common::idx_t idx) const;
 template RYU_API uint64_t TableFuncBindInput::getLiteralVal<uint64_t>(common::idx_t idx) const;
+template RYU_API double TableFuncBindInput::getLiteralVal<double>(common::idx_t idx) const;
 template RYU_API uint32_t TableFuncBindInput::getLiteralVal<uint32_t>(common::idx_t idx) const;
 template RYU_API uint8_t* TableFuncBindInput::getLiteralVal<uint8_t*>(common::idx_t idx) const;
 
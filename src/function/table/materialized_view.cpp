@@ -0,0 +1,249 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "common/string_utils.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/materialized_views.h"
+#include "parser/parser.h"
+#include "parser/query/regular_query.h"
+#include "parser/visitor/statement_read_write_analyzer.h"
+#include "processor/execution_context.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_context.h"
+
+using namespace ryu::catalog;
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+struct MaterializedViewBindData final : TableFuncBindData {
+    std::string viewName;
+    // Empty for refreshes, which use the defining query of the view.
+    std::string query;
+
+    MaterializedViewBindData(std::string viewName, std::string query)
+        : TableFuncBindData{0}, viewName{std::move(viewName)}, query{std::move(query)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<MaterializedViewBindData>(viewName, query);
+    }
+};
+
+// Views are created and refreshed by several statements, which each commit their own transaction.
+static void validateAutoTransaction(const main::ClientContext& context,
+    const std::string& funcName) {
+    if (!transaction::TransactionContext::Get(context)->isAutoTransaction()) {
+        throw BinderException{
+            stringFormat("{} is only supported in auto transaction mode.", funcName)};
+    }
+}
+
+static NodeTableCatalogEntry* bindView(const main::ClientContext& context,
+    const std::string& viewName) {
+    binder::Binder::validateTableExistence(context, viewName);
+    const auto tableEntry = Catalog::Get(context)->getTableCatalogEntry(
+        transaction::Transaction::Get(context), viewName);
+    if (!main::MaterializedViews::isView(*tableEntry)) {
+        throw BinderException{stringFormat("{} is not a materialized view.", viewName)};
+    }
+    return tableEntry->ptrCast<NodeTableCatalogEntry>();
+}
+
+static std::string escapeStringLiteral(std::string str) {
+    StringUtils::replaceAll(str, "\\", "\\\\");
+    StringUtils::replaceAll(str, "'", "\\'");
+    return str;
+}
+
+// Statements which replace the rows of the view with the result of the defining query, and mark
+// the view fresh. The view is marked stale first, so that it isn't read while it is replaced.
+static std::string getRefreshQuery(const std::string& viewName, const std::string& query) {
+    const auto viewNameLiteral = escapeStringLiteral(viewName);
+    return stringFormat("CALL {}('{}');"
+                        "MATCH (v:`{}`) DELETE v;"
+                        "COPY `{}` FROM ({});"
+                        "CALL {}('{}');",
+        BeginMaterializedViewRefreshFunction::name, viewNameLiteral, viewName, viewName, query,
+        FinishMaterializedViewRefreshFunction::name, viewNameLiteral);
+}
+
+static std::unique_ptr<TableFuncBindData> bindCreateFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, CreateMaterializedViewFunction::name);
+    auto viewName = input->getLiteralVal<std::string>(0);
+    if (viewName.find('`') != std::string::npos) {
+        throw BinderException{
+            stringFormat("Materialized view name {} must not contain backticks.", viewName)};
+    }
+    if (Catalog::Get(*context)->containsTable(transaction::Transaction::Get(*context), viewName)) {
+        throw BinderException{stringFormat("Table {} already exists.", viewName)};
+    }
+    auto query = main::MaterializedViews::normalizeQuery(input->getLiteralVal<std::string>(1));
+    return std::make_unique<MaterializedViewBindData>(std::move(viewName), std::move(query));
+}
+
+// Checks that the defining query is a single read-only query whose result can be stored in the
+// properties of a node table, and returns the definitions of these properties.
+static std::string bindDefiningQuery(main::ClientContext& context, const std::string& query) {
+    const auto statements = parser::Parser::parseQuery(query);
+    if (statements.size() != 1 || statements[0]->getStatementType() != StatementType::QUERY) {
+        throw BinderException{"The defining query of a materialized view must be a single query."};
+    }
+    parser::StatementReadWriteAnalyzer readWriteAnalyzer{&context};
+    readWriteAnalyzer.visit(*statements[0]);
+    if (!readWriteAnalyzer.isReadOnly()) {
+        throw BinderException{"The defining query of a materialized view must be read-only."};
+    }
+    // Rows of the view are not kept in the order of the query.
+    const auto& regularQuery = statements[0]->constCast<parser::RegularQuery>();
+    for (auto i = 0u; i < regularQuery.getNumSingleQueries(); i++) {
+        const auto singleQuery = regularQuery.getSingleQuery(i);
+        if (singleQuery->hasReturnClause() &&
+            singleQuery->getReturnClause()->getProjectionBody()->hasOrderByExpressions()) {
+            throw BinderException{
+                "The defining query of a materialized view must not have an ORDER BY."};
+        }
+    }
+    binder::Binder binder{&context};
+    const auto boundStatement = binder.bind(*statements[0]);
+    const auto statementResult = boundStatement->getStatementResult();
+    const auto columnNames = statementResult->getColumnNames();
+    const auto columnTypes = statementResult->getColumnTypes();
+    std::string propertyDefinitions;
+    for (auto i = 0u; i < columnNames.size(); i++) {
+        switch (columnTypes[i].getLogicalTypeID()) {
+        case LogicalTypeID::NODE:
+        case LogicalTypeID::REL:
+        case LogicalTypeID::RECURSIVE_REL:
+        case LogicalTypeID::INTERNAL_ID:
+        case LogicalTypeID::ANY: {
+            throw BinderException{stringFormat("Column {} of type {} can't be stored in a "
+                                               "materialized view.",
+                columnNames[i], columnTypes[i].toString())};
+        }
+        default:
+            break;
+        }
+        if (columnNames[i].find('`') != std::string::npos) {
+            throw BinderException{stringFormat(
+                "Column name {} of a materialized view must not contain backticks.",
+                columnNames[i])};
+        }
+        propertyDefinitions += stringFormat(", `{}` {}", columnNames[i], columnTypes[i].toString());
+    }
+    return propertyDefinitions;
+}
+
+static std::string rewriteCreateFunc(main::ClientContext& context,
+    const TableFuncBindData& bindData) {
+    const auto& viewBindData = *bindData.constPtrCast<MaterializedViewBindData>();
+    const auto propertyDefinitions = bindDefiningQuery(context, viewBindData.query);
+    // The comment marks the table as a view before its first refresh, so that the refresh doesn't
+    // count the view as one of its base tables.
+    return stringFormat("CREATE NODE TABLE `{}`(`_row_id` SERIAL{}, PRIMARY KEY(`_row_id`));"
+                        "COMMENT ON TABLE `{}` IS '{}{}';"
+                        "{}"
+                        "RETURN 'Materialized view {} has been created.' AS result;",
+        viewBindData.viewName, propertyDefinitions, viewBindData.viewName,
+        main::MaterializedViews::COMMENT_PREFIX, escapeStringLiteral(viewBindData.query),
+        getRefreshQuery(viewBindData.viewName, viewBindData.query),
+        escapeStringLiteral(viewBindData.viewName));
+}
+
+static std::unique_ptr<TableFuncBindData> bindRefreshFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, RefreshMaterializedViewFunction::name);
+    const auto viewEntry = bindView(*context, input->getLiteralVal<std::string>(0));
+    return std::make_unique<MaterializedViewBindData>(viewEntry->getName(),
+        main::MaterializedViews::getDefiningQuery(*viewEntry));
+}
+
+static std::string rewriteRefreshFunc(main::ClientContext&, const TableFuncBindData& bindData) {
+    const auto& viewBindData = *bindData.constPtrCast<MaterializedViewBindData>();
+    return stringFormat("{}"
+                        "RETURN 'Materialized view {} has been refreshed.' AS result;",
+        getRefreshQuery(viewBindData.viewName, viewBindData.query),
+        escapeStringLiteral(viewBindData.viewName));
+}
+
+static std::unique_ptr<TableFuncBindData> bindInternalFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto viewEntry = bindView(*context, input->getLiteralVal<std::string>(0));
+    return std::make_unique<MaterializedViewBindData>(viewEntry->getName(), "" /* query */);
+}
+
+static NodeTableCatalogEntry* getViewEntry(const TableFuncInput& input) {
+    const auto& viewBindData = *input.bindData->constPtrCast<MaterializedViewBindData>();
+    const auto clientContext = input.context->clientContext;
+    return Catalog::Get(*clientContext)
+        ->getTableCatalogEntry(transaction::Transaction::Get(*clientContext), viewBindData.viewName)
+        ->ptrCast<NodeTableCatalogEntry>();
+}
+
+static offset_t beginRefreshTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto clientContext = input.context->clientContext;
+    clientContext->getDatabase()->getMaterializedViews()->beginRefresh(*clientContext,
+        transaction::Transaction::Get(*clientContext), *getViewEntry(input));
+    return 0;
+}
+
+static offset_t finishRefreshTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    input.context->clientContext->getDatabase()->getMaterializedViews()->finishRefresh(
+        getViewEntry(input)->getTableID());
+    return 0;
+}
+
+static std::unique_ptr<TableFunction> getFunction(const std::string& name,
+    std::vector<LogicalTypeID> inputTypes, table_func_bind_t bindFunc, table_func_t tableFunc) {
+    auto func = std::make_unique<TableFunction>(name, std::move(inputTypes));
+    func->bindFunc = bindFunc;
+    func->tableFunc = tableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    return func;
+}
+
+function_set CreateMaterializedViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = getFunction(name, {LogicalTypeID::STRING, LogicalTypeID::STRING}, bindCreateFunc,
+        TableFunction::emptyTableFunc);
+    func->rewriteFunc = rewriteCreateFunc;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+function_set RefreshMaterializedViewFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func =
+        getFunction(name, {LogicalTypeID::STRING}, bindRefreshFunc, TableFunction::emptyTableFunc);
+    func->rewriteFunc = rewriteRefreshFunc;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+function_set BeginMaterializedViewRefreshFunction::getFunctionSet() {
+    function_set functionSet;
+    // Runs in a write transaction, so that no uncommitted write is hidden from the refresh.
+    functionSet.push_back(
+        getFunction(name, {LogicalTypeID::STRING}, bindInternalFunc, beginRefreshTableFunc));
+    return functionSet;
+}
+
+function_set FinishMaterializedViewRefreshFunction::getFunctionSet() {
+    function_set functionSet;
+    functionSet.push_back(
+        getFunction(name, {LogicalTypeID::STRING}, bindInternalFunc, finishRefreshTableFunc));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
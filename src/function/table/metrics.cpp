@@ -0,0 +1,69 @@
+#include "binder/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "main/database.h"
+#include "main/database_metrics.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+struct MetricsBindData final : TableFuncBindData {
+    std::vector<main::MetricSample> samples;
+
+    MetricsBindData(std::vector<main::MetricSample> samples, binder::expression_vector columns,
+        offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, samples{std::move(samples)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<MetricsBindData>(samples, columns, numRows);
+    }
+};
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto& samples = input.bindData->constPtrCast<MetricsBindData>()->samples;
+    const auto numSamplesToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numSamplesToOutput; i++) {
+        const auto& sample = samples[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue(i, sample.name);
+        output.getValueVectorMutable(1).setValue(i, sample.labels);
+        output.getValueVectorMutable(2).setValue(i, sample.type);
+        output.getValueVectorMutable(3).setValue(i, sample.value);
+        output.getValueVectorMutable(4).setValue(i, sample.help);
+    }
+    return numSamplesToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames{"name", "labels", "type", "value", "description"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::DOUBLE());
+    columnTypes.push_back(LogicalType::STRING());
+    auto database = context->getDatabase();
+    auto samples = database->getMetrics()->collect(*database);
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    const auto numSamples = samples.size();
+    return std::make_unique<MetricsBindData>(std::move(samples), columns, numSamples);
+}
+
+function_set MetricsFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
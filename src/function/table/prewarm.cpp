@@ -0,0 +1,78 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/storage_manager.h"
+#include "transaction/transaction.h"
+#include "transaction/transaction_manager.h"
+
+using namespace ryu::catalog;
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+struct PrewarmBindData final : TableFuncBindData {
+    // Rel groups are stored in one table per pair of node tables.
+    std::vector<table_id_t> tableIDs;
+
+    explicit PrewarmBindData(std::vector<table_id_t> tableIDs)
+        : TableFuncBindData{0}, tableIDs{std::move(tableIDs)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<PrewarmBindData>(tableIDs);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    const auto tableName = input->getLiteralVal<std::string>(0);
+    binder::Binder::validateTableExistence(*context, tableName);
+    const auto tableEntry = Catalog::Get(*context)->getTableCatalogEntry(
+        transaction::Transaction::Get(*context), tableName);
+    std::vector<table_id_t> tableIDs;
+    if (tableEntry->getTableType() == TableType::REL) {
+        for (auto& info : tableEntry->constCast<RelGroupCatalogEntry>().getRelEntryInfos()) {
+            tableIDs.push_back(info.oid);
+        }
+    } else {
+        binder::Binder::validateNodeTableType(tableEntry);
+        tableIDs.push_back(tableEntry->getTableID());
+    }
+    return std::make_unique<PrewarmBindData>(std::move(tableIDs));
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = input.bindData->constPtrCast<PrewarmBindData>();
+    const auto clientContext = input.context->clientContext;
+    const auto storageManager = storage::StorageManager::Get(*clientContext);
+    // Vacuuming replaces the chunks whose updates it prunes, which must not happen while their
+    // pages are collected.
+    transaction::TransactionManager::Get(*clientContext)->runWithoutCheckpoint([&] {
+        for (const auto tableID : bindData->tableIDs) {
+            if (!storageManager->prewarmTable(tableID)) {
+                break;
+            }
+        }
+    });
+    return 0;
+}
+
+function_set PrewarmFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->tableFunc = tableFunc;
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
@@ -1,4 +1,5 @@
 #include "common/exception/binder.h"
+#include "common/string_utils.h"
 #include "common/types/value/nested.h"
 #include "function/gds/gds.h"
 #include "function/table/bind_data.h"
@@ -16,19 +17,24 @@ using namespace ryu::graph;
 namespace ryu {
 namespace function {
 
+// Algorithms on the graph scan rels from an in-memory CSR copy, which is built once per call.
+static constexpr char IN_MEMORY_OPTION[] = "in_memory";
+
 struct ProjectGraphNativeBindData final : TableFuncBindData {
     std::string graphName;
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    bool inMemory;
 
     ProjectGraphNativeBindData(std::string graphName,
         std::vector<ParsedNativeGraphTableInfo> nodeInfos,
-        std::vector<ParsedNativeGraphTableInfo> relInfos)
+        std::vector<ParsedNativeGraphTableInfo> relInfos, bool inMemory)
         : TableFuncBindData{0}, graphName{std::move(graphName)}, nodeInfos{std::move(nodeInfos)},
-          relInfos{std::move(relInfos)} {}
+          relInfos{std::move(relInfos)}, inMemory{inMemory} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
-        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+        return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+            inMemory);
     }
 };
 
@@ -36,7 +42,8 @@ static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
     const auto bindData = ku_dynamic_cast<ProjectGraphNativeBindData*>(input.bindData);
     auto graphEntrySet = GraphEntrySet::Get(*input.context->clientContext);
     graphEntrySet->validateGraphNotExist(bindData->graphName);
-    auto entry = std::make_unique<ParsedNativeGraphEntry>(bindData->nodeInfos, bindData->relInfos);
+    auto entry = std::make_unique<ParsedNativeGraphEntry>(bindData->nodeInfos, bindData->relInfos,
+        bindData->inMemory);
     // bind graph entry to check if input is valid or not. Ignore bind result.
     GDSFunction::bindGraphEntry(*input.context->clientContext, *entry);
     graphEntrySet->addGraph(bindData->graphName, std::move(entry));
@@ -78,7 +85,18 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext*,
     auto graphName = input->getLiteralVal<std::string>(0);
     auto nodeInfos = extractGraphEntryTableInfos(input->getValue(1));
     auto relInfos = extractGraphEntryTableInfos(input->getValue(2));
-    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos);
+    auto inMemory = false;
+    for (auto& [name, value] : input->optionalParams) {
+        if (StringUtils::getLower(name) == IN_MEMORY_OPTION) {
+            value.validateType(LogicalTypeID::BOOL);
+            inMemory = value.getValue<bool>();
+        } else {
+            throw BinderException{stringFormat("Unrecognized optional parameter {} in {}.", name,
+                ProjectGraphNativeFunction::name)};
+        }
+    }
+    return std::make_unique<ProjectGraphNativeBindData>(graphName, nodeInfos, relInfos,
+        inMemory);
 }
 
 function_set ProjectGraphNativeFunction::getFunctionSet() {
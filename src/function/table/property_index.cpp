@@ -0,0 +1,170 @@
+#include "binder/binder.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
+#include "common/exception/binder.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/index/property_index.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction_context.h"
+
+using namespace ryu::catalog;
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+struct PropertyIndexBindData final : TableFuncBindData {
+    table_id_t tableID;
+    std::string indexName;
+    std::string propertyName;
+
+    PropertyIndexBindData(table_id_t tableID, std::string indexName, std::string propertyName)
+        : TableFuncBindData{0}, tableID{tableID}, indexName{std::move(indexName)},
+          propertyName{std::move(propertyName)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<PropertyIndexBindData>(tableID, indexName, propertyName);
+    }
+};
+
+// Indexes are added to the storage outside of the undo buffer, so they can't be rolled back.
+static void validateAutoTransaction(const main::ClientContext& context,
+    const std::string& funcName) {
+    if (!transaction::TransactionContext::Get(context)->isAutoTransaction()) {
+        throw BinderException{
+            stringFormat("{} is only supported in auto transaction mode.", funcName)};
+    }
+}
+
+static NodeTableCatalogEntry* bindNodeTable(const main::ClientContext& context,
+    const std::string& tableName) {
+    binder::Binder::validateTableExistence(context, tableName);
+    const auto tableEntry = Catalog::Get(context)->getTableCatalogEntry(
+        transaction::Transaction::Get(context), tableName);
+    binder::Binder::validateNodeTableType(tableEntry);
+    return tableEntry->ptrCast<NodeTableCatalogEntry>();
+}
+
+static std::unique_ptr<TableFuncBindData> bindCreateFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, CreatePropertyIndexFunction::name);
+    const auto tableEntry = bindNodeTable(*context, input->getLiteralVal<std::string>(0));
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto propertyName = input->getLiteralVal<std::string>(2);
+    if (Catalog::Get(*context)->containsIndex(transaction::Transaction::Get(*context),
+            tableEntry->getTableID(), indexName)) {
+        throw BinderException{stringFormat("Index {} already exists in table {}.", indexName,
+            tableEntry->getName())};
+    }
+    if (!tableEntry->containsProperty(propertyName)) {
+        throw BinderException{stringFormat("Table {} doesn't have a property with name {}.",
+            tableEntry->getName(), propertyName)};
+    }
+    if (propertyName == tableEntry->getPrimaryKeyName()) {
+        throw BinderException{stringFormat(
+            "Property {} is the primary key of table {}, which is already indexed.", propertyName,
+            tableEntry->getName())};
+    }
+    auto& propertyType = tableEntry->getProperty(propertyName).getType();
+    if (!storage::PropertyIndex::isIndexable(propertyType.getPhysicalType())) {
+        throw BinderException{stringFormat("Cannot create a property index on property {} of "
+                                           "type {}. Only boolean, integer and string properties "
+                                           "can be indexed.",
+            propertyName, propertyType.toString())};
+    }
+    return std::make_unique<PropertyIndexBindData>(tableEntry->getTableID(), std::move(indexName),
+        std::move(propertyName));
+}
+
+static offset_t createTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto& bindData = *input.bindData->constPtrCast<PropertyIndexBindData>();
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    auto catalog = Catalog::Get(*clientContext);
+    auto tableEntry = catalog->getTableCatalogEntry(transaction, bindData.tableID);
+    catalog->createIndex(transaction,
+        std::make_unique<IndexCatalogEntry>(PropertyIndexCatalogEntry::TYPE_NAME, bindData.tableID,
+            bindData.indexName, std::vector{tableEntry->getPropertyID(bindData.propertyName)},
+            std::make_unique<PropertyIndexAuxInfo>()));
+    auto nodeTable = storage::StorageManager::Get(*clientContext)
+                         ->getTable(bindData.tableID)
+                         ->ptrCast<storage::NodeTable>();
+    auto indexType = storage::PropertyIndex::getIndexType();
+    storage::IndexInfo indexInfo{bindData.indexName, indexType.typeName, bindData.tableID,
+        {tableEntry->getColumnID(bindData.propertyName)},
+        {tableEntry->getProperty(bindData.propertyName).getType().getPhysicalType()},
+        indexType.constraintType == storage::IndexConstraintType::PRIMARY,
+        indexType.definitionType == storage::IndexDefinitionType::BUILTIN};
+    auto index = std::make_unique<storage::PropertyIndex>(std::move(indexInfo), *nodeTable);
+    index->build(clientContext, transaction);
+    nodeTable->addIndex(std::move(index));
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+static std::unique_ptr<TableFuncBindData> bindDropFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    validateAutoTransaction(*context, DropPropertyIndexFunction::name);
+    const auto tableEntry = bindNodeTable(*context, input->getLiteralVal<std::string>(0));
+    auto indexName = input->getLiteralVal<std::string>(1);
+    auto transaction = transaction::Transaction::Get(*context);
+    auto catalog = Catalog::Get(*context);
+    if (!catalog->containsIndex(transaction, tableEntry->getTableID(), indexName) ||
+        catalog->getIndex(transaction, tableEntry->getTableID(), indexName)->getIndexType() !=
+            PropertyIndexCatalogEntry::TYPE_NAME) {
+        throw BinderException{stringFormat("Table {} doesn't have a property index with name {}.",
+            tableEntry->getName(), indexName)};
+    }
+    return std::make_unique<PropertyIndexBindData>(tableEntry->getTableID(), std::move(indexName),
+        "" /* propertyName */);
+}
+
+static offset_t dropTableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    auto& bindData = *input.bindData->constPtrCast<PropertyIndexBindData>();
+    auto clientContext = input.context->clientContext;
+    auto transaction = transaction::Transaction::Get(*clientContext);
+    Catalog::Get(*clientContext)->dropIndex(transaction, bindData.tableID, bindData.indexName);
+    storage::StorageManager::Get(*clientContext)
+        ->getTable(bindData.tableID)
+        ->cast<storage::NodeTable>()
+        .dropIndex(bindData.indexName);
+    transaction->setForceCheckpoint();
+    return 0;
+}
+
+function_set CreatePropertyIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindCreateFunc;
+    func->tableFunc = createTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+function_set DropPropertyIndexFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name,
+        std::vector{LogicalTypeID::STRING, LogicalTypeID::STRING});
+    func->bindFunc = bindDropFunc;
+    func->tableFunc = dropTableFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    func->isReadOnly = false;
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
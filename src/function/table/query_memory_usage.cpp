@@ -0,0 +1,91 @@
+#include "binder/binder.h"
+#include "common/memory_tracker.h"
+#include "function/table/bind_data.h"
+#include "function/table/simple_table_function.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+struct MemoryUsageRow {
+    uint64_t queryID;
+    // Not set for the row of the whole query.
+    std::optional<OperatorMemoryUsage> operatorUsage;
+    uint64_t usage;
+    uint64_t peakUsage;
+};
+
+struct QueryMemoryUsageBindData final : TableFuncBindData {
+    std::vector<MemoryUsageRow> rows;
+
+    QueryMemoryUsageBindData(std::vector<MemoryUsageRow> rows, binder::expression_vector columns,
+        offset_t maxOffset)
+        : TableFuncBindData{std::move(columns), maxOffset}, rows{std::move(rows)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<QueryMemoryUsageBindData>(rows, columns, numRows);
+    }
+};
+
+static offset_t internalTableFunc(const TableFuncMorsel& morsel, const TableFuncInput& input,
+    DataChunk& output) {
+    const auto& rows = input.bindData->constPtrCast<QueryMemoryUsageBindData>()->rows;
+    const auto numRowsToOutput = morsel.endOffset - morsel.startOffset;
+    for (auto i = 0u; i < numRowsToOutput; i++) {
+        const auto& row = rows[morsel.startOffset + i];
+        output.getValueVectorMutable(0).setValue<uint64_t>(i, row.queryID);
+        if (row.operatorUsage.has_value()) {
+            output.getValueVectorMutable(1).setNull(i, false);
+            output.getValueVectorMutable(1).setValue<uint64_t>(i, row.operatorUsage->operatorID);
+            output.getValueVectorMutable(2).setValue(i, row.operatorUsage->operatorName);
+        } else {
+            output.getValueVectorMutable(1).setNull(i, true);
+            output.getValueVectorMutable(2).setValue(i, std::string("QUERY"));
+        }
+        output.getValueVectorMutable(3).setValue<uint64_t>(i, row.usage);
+        output.getValueVectorMutable(4).setValue<uint64_t>(i, row.peakUsage);
+    }
+    return numRowsToOutput;
+}
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    std::vector<std::string> columnNames{"query_id", "operator_id", "operator_name",
+        "memory_usage", "peak_memory_usage"};
+    std::vector<LogicalType> columnTypes;
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::STRING());
+    columnTypes.push_back(LogicalType::UINT64());
+    columnTypes.push_back(LogicalType::UINT64());
+    std::vector<MemoryUsageRow> rows;
+    for (auto& tracker : storage::MemoryManager::Get(*context)->getQueryMemoryTrackers()) {
+        rows.push_back(MemoryUsageRow{tracker->getQueryID(), std::nullopt, tracker->getUsage(),
+            tracker->getPeakUsage()});
+        for (auto& operatorUsage : tracker->getOperatorUsages()) {
+            rows.push_back(MemoryUsageRow{tracker->getQueryID(), operatorUsage,
+                operatorUsage.usage, operatorUsage.peakUsage});
+        }
+    }
+    columnNames = TableFunction::extractYieldVariables(columnNames, input->yieldVariables);
+    auto columns = input->binder->createVariables(columnNames, columnTypes);
+    const auto numRows = rows.size();
+    return std::make_unique<QueryMemoryUsageBindData>(std::move(rows), columns, numRows);
+}
+
+function_set QueryMemoryUsageFunction::getFunctionSet() {
+    function_set functionSet;
+    auto function = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
+    function->tableFunc = SimpleTableFunc::getTableFunc(internalTableFunc);
+    function->bindFunc = bindFunc;
+    function->initSharedStateFunc = SimpleTableFunc::initSharedState;
+    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    functionSet.push_back(std::move(function));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
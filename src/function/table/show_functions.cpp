@@ -1,5 +1,6 @@
 #include "binder/binder.h"
 #include "catalog/catalog.h"
+#include "extension/extension_manager.h"
 #include "function/table/bind_data.h"
 #include "function/table/bind_input.h"
 #include "function/table/simple_table_function.h"
@@ -56,6 +57,8 @@ static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* co
     columnNames.emplace_back("signature");
     columnTypes.emplace_back(LogicalType::STRING());
     std::vector<FunctionInfo> FunctionInfos;
+    // Functions of lazily loaded extensions are only in the catalog once they are loaded.
+    extension::ExtensionManager::Get(*context)->loadLazyExtensions();
     for (const auto& entry :
         Catalog::Get(*context)->getFunctionEntries(transaction::Transaction::Get(*context))) {
         const auto& functionSet = entry->getFunctionSet();
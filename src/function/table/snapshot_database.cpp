@@ -0,0 +1,78 @@
+#include "common/exception/runtime.h"
+#include "common/file_system/virtual_file_system.h"
+#include "common/string_format.h"
+#include "function/table/bind_data.h"
+#include "function/table/bind_input.h"
+#include "function/table/standalone_call_function.h"
+#include "function/table/table_function.h"
+#include "processor/execution_context.h"
+#include "storage/cold_storage.h"
+#include "storage/file_handle.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+#include "storage/wal/wal.h"
+#include "transaction/transaction_manager.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace function {
+
+struct SnapshotDatabaseBindData final : TableFuncBindData {
+    std::string path;
+
+    explicit SnapshotDatabaseBindData(std::string path)
+        : TableFuncBindData{0}, path{std::move(path)} {}
+
+    std::unique_ptr<TableFuncBindData> copy() const override {
+        return std::make_unique<SnapshotDatabaseBindData>(path);
+    }
+};
+
+static std::unique_ptr<TableFuncBindData> bindFunc(const main::ClientContext* context,
+    const TableFuncBindInput* input) {
+    if (storage::StorageManager::Get(*context)->isInMemory()) {
+        throw RuntimeException("Cannot snapshot an in-memory database.");
+    }
+    return std::make_unique<SnapshotDatabaseBindData>(input->getLiteralVal<std::string>(0));
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput&) {
+    const auto bindData = input.bindData->constPtrCast<SnapshotDatabaseBindData>();
+    const auto clientContext = input.context->clientContext;
+    const auto storageManager = storage::StorageManager::Get(*clientContext);
+    const auto vfs = VirtualFileSystem::GetUnsafe(*clientContext);
+    const auto path = vfs->expandPath(clientContext, bindData->path);
+    if (vfs->fileOrPathExists(path, clientContext)) {
+        throw RuntimeException(stringFormat("Snapshot path {} already exists.", path));
+    }
+    // Pages of the data file are only overwritten by checkpoints, which also truncate the WAL. As
+    // long as no checkpoint runs, the data file holds the last checkpoint, and the WAL copied after
+    // it holds all commits since, which are replayed once the snapshot is opened. The copies are
+    // taken as they are, so nothing is decompressed and no index is rebuilt. Pages offloaded to
+    // the cold storage are holes in the data file and are read from the shared segments through
+    // a copy of the map, which is also only changed by checkpoints.
+    transaction::TransactionManager::Get(*clientContext)->runWithoutCheckpoint([&] {
+        if (const auto coldStorage = storageManager->getDataFH()->getColdStorage()) {
+            coldStorage->copyMapTo(path, clientContext);
+        }
+        vfs->copyFile(storageManager->getDatabasePath(), path);
+        storageManager->getWAL().copyTo(storage::StorageUtils::getWALFilePath(path));
+    });
+    return 0;
+}
+
+function_set SnapshotDatabaseFunction::getFunctionSet() {
+    function_set functionSet;
+    auto func = std::make_unique<TableFunction>(name, std::vector{LogicalTypeID::STRING});
+    func->tableFunc = tableFunc;
+    func->bindFunc = bindFunc;
+    func->initSharedStateFunc = TableFunction::initEmptySharedState;
+    func->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    func->canParallelFunc = []() { return false; };
+    functionSet.push_back(std::move(func));
+    return functionSet;
+}
+
+} // namespace function
+} // namespace ryu
@@ -18,11 +18,36 @@ static void executeOnValue(const ValueVector& operand, sel_t operandPos, ValueVe
         result.getValue<RESULT_TYPE>(resultPos));
 }
 
+// Hashes the values of an unfiltered operand into an unfiltered result as a single loop over both
+// arrays, which the compiler unrolls and vectorizes. Null positions are hashed like any other value
+// and overwritten afterwards, so nulls do not add a branch to the loop.
+template<typename OPERAND_TYPE, typename RESULT_TYPE>
+static void executeOnUnfiltered(const ValueVector& operand, uint64_t numValues,
+    ValueVector& result) {
+    const auto operandValues = reinterpret_cast<const OPERAND_TYPE*>(operand.getData());
+    const auto resultValues = reinterpret_cast<RESULT_TYPE*>(result.getData());
+    for (auto i = 0u; i < numValues; i++) {
+        Hash::operation(operandValues[i], resultValues[i]);
+    }
+    if (!operand.hasNoNullsGuarantee()) {
+        for (auto i = 0u; i < numValues; i++) {
+            if (operand.isNull(i)) {
+                resultValues[i] = NULL_HASH;
+            }
+        }
+    }
+}
+
 template<typename OPERAND_TYPE, typename RESULT_TYPE>
 void UnaryHashFunctionExecutor::execute(const ValueVector& operand,
     const SelectionView& operandSelectVec, ValueVector& result,
     const SelectionView& resultSelectVec) {
     auto resultValues = (RESULT_TYPE*)result.getData();
+    if (operandSelectVec.isUnfiltered() && resultSelectVec.isUnfiltered()) {
+        executeOnUnfiltered<OPERAND_TYPE, RESULT_TYPE>(operand, operandSelectVec.getSelSize(),
+            result);
+        return;
+    }
     if (operand.hasNoNullsGuarantee()) {
         if (operandSelectVec.isUnfiltered()) {
             for (auto i = 0u; i < operandSelectVec.getSelSize(); i++) {
@@ -120,6 +145,53 @@ void BinaryHashFunctionExecutor::execute(const common::ValueVector& left,
     }
 }
 
+// Strings scanned from a dictionary column share the data of duplicated dictionary entries, so the
+// hash of a long string is cached by its data pointer and each distinct entry is hashed once per
+// vector. The operand is not modified while its hashes are computed, which keeps the data a
+// pointer refers to the same.
+class StringHashCache {
+    static constexpr uint64_t NUM_SLOTS = 256;
+
+    struct Slot {
+        uint64_t overflowPtr = 0;
+        uint32_t len = 0;
+        hash_t hash = 0;
+    };
+
+public:
+    void hash(const ku_string_t& key, hash_t& result) {
+        if (ku_string_t::isShortString(key.len)) {
+            Hash::operation(key, result);
+            return;
+        }
+        auto& slot = slots[murmurhash64(key.overflowPtr) % NUM_SLOTS];
+        if (slot.overflowPtr == key.overflowPtr && slot.len == key.len) {
+            result = slot.hash;
+            return;
+        }
+        Hash::operation(key, result);
+        slot = {key.overflowPtr, key.len, result};
+    }
+
+private:
+    Slot slots[NUM_SLOTS];
+};
+
+static void computeStringVecHash(const ValueVector& operand, const SelectionView& operandSelVec,
+    ValueVector& result, const SelectionView& resultSelVec) {
+    auto resultValues = reinterpret_cast<hash_t*>(result.getData());
+    StringHashCache cache;
+    for (auto i = 0u; i < operandSelVec.getSelSize(); i++) {
+        auto operandPos = operandSelVec[i];
+        auto resultPos = resultSelVec[i];
+        if (operand.isNull(operandPos)) {
+            resultValues[resultPos] = NULL_HASH;
+        } else {
+            cache.hash(operand.getValue<ku_string_t>(operandPos), resultValues[resultPos]);
+        }
+    }
+}
+
 static std::unique_ptr<ValueVector> computeDataVecHash(const ValueVector& operand) {
     auto hashVector = std::make_unique<ValueVector>(LogicalType::LIST(LogicalType::HASH()));
     auto numValuesInDataVec = ListVector::getDataVectorSize(&operand);
@@ -212,6 +284,9 @@ void VectorHashFunction::computeHash(const ValueVector& operand,
             UnaryHashFunctionExecutor::execute<T, hash_t>(operand, operandSelectVec, result,
                 resultSelectVec);
         },
+        [&](ku_string_t) {
+            computeStringVecHash(operand, operandSelectVec, result, resultSelectVec);
+        },
         [&](struct_entry_t) {
             computeStructVecHash(operand, operandSelectVec, result, resultSelectVec);
         },
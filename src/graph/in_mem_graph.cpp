@@ -0,0 +1,221 @@
+#include "graph/in_mem_graph.h"
+
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/exception/interrupt.h"
+#include "main/client_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::catalog;
+using namespace ryu::common;
+using namespace ryu::main;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace graph {
+
+static bool isFixedSize(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::BOOL:
+    case PhysicalTypeID::INT64:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::UINT64:
+    case PhysicalTypeID::UINT32:
+    case PhysicalTypeID::UINT16:
+    case PhysicalTypeID::UINT8:
+    case PhysicalTypeID::INT128:
+    case PhysicalTypeID::UINT128:
+    case PhysicalTypeID::DOUBLE:
+    case PhysicalTypeID::FLOAT:
+    case PhysicalTypeID::INTERVAL:
+    case PhysicalTypeID::INTERNAL_ID:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void appendProperty(InMemAdjList::PropertyColumn& column, const ValueVector& vector,
+    sel_t pos, uint64_t relIdx) {
+    auto value = vector.getData() + pos * column.numBytesPerValue;
+    column.data.insert(column.data.end(), value, value + column.numBytesPerValue);
+    if (vector.isNull(pos)) {
+        if (column.nulls.empty()) {
+            column.nulls.resize(relIdx, false);
+        }
+        column.nulls.push_back(true);
+    } else if (!column.nulls.empty()) {
+        column.nulls.push_back(false);
+    }
+}
+
+InMemGraphNbrScanState::InMemGraphNbrScanState(ClientContext* context,
+    const TableCatalogEntry& entry, oid_t relTableID, table_id_t nbrTableID,
+    std::vector<std::string> relProperties, bool randomLookup)
+    : entry{entry}, relTableID{relTableID}, nbrTableID{nbrTableID},
+      srcTableID{INVALID_TABLE_ID}, dstTableID{INVALID_TABLE_ID},
+      relProperties{std::move(relProperties)}, randomLookup{randomLookup},
+      nbrNodes{std::make_unique<nodeID_t[]>(DEFAULT_VECTOR_CAPACITY)},
+      selVector{DEFAULT_VECTOR_CAPACITY} {
+    for (auto& info : entry.constCast<RelGroupCatalogEntry>().getRelEntryInfos()) {
+        if (info.oid == relTableID) {
+            srcTableID = info.nodePair.srcTableID;
+            dstTableID = info.nodePair.dstTableID;
+        }
+    }
+    KU_ASSERT(srcTableID != INVALID_TABLE_ID && dstTableID != INVALID_TABLE_ID);
+    auto mm = MemoryManager::Get(*context);
+    auto state = std::make_shared<DataChunkState>();
+    for (auto& propertyName : this->relProperties) {
+        auto vector =
+            std::make_shared<ValueVector>(entry.getProperty(propertyName).getType().copy(), mm);
+        vector->state = state;
+        propertyVectors.push_back(std::move(vector));
+    }
+}
+
+void InMemGraphNbrScanState::startScan(const InMemAdjList* adjList_, offset_t boundOffset) {
+    adjList = adjList_;
+    curPos = adjList->csrOffsets[boundOffset];
+    endPos = adjList->csrOffsets[boundOffset + 1];
+    scanBatch();
+}
+
+bool InMemGraphNbrScanState::next() {
+    if (curPos >= endPos) {
+        return false;
+    }
+    scanBatch();
+    return true;
+}
+
+void InMemGraphNbrScanState::scanBatch() {
+    auto numRels = std::min<uint32_t>(endPos - curPos, DEFAULT_VECTOR_CAPACITY);
+    for (auto i = 0u; i < numRels; ++i) {
+        nbrNodes[i] = nodeID_t{adjList->nbrOffsets[curPos + i], adjList->nbrTableID};
+    }
+    for (auto i = 0u; i < propertyVectors.size(); ++i) {
+        auto& column = adjList->propertyColumns[i];
+        auto& vector = *propertyVectors[i];
+        memcpy(vector.getData(), column.data.data() + curPos * column.numBytesPerValue,
+            numRels * column.numBytesPerValue);
+        if (column.nulls.empty()) {
+            vector.setAllNonNull();
+        } else {
+            for (auto j = 0u; j < numRels; ++j) {
+                vector.setNull(j, column.nulls[curPos + j]);
+            }
+        }
+    }
+    selVector.setToUnfiltered(numRels);
+    curPos += numRels;
+}
+
+InMemGraph::InMemGraph(ClientContext* context, NativeGraphEntry entry)
+    : context{context}, onDiskGraph{context, std::move(entry)} {}
+
+std::unique_ptr<NbrScanState> InMemGraph::prepareRelScan(const TableCatalogEntry& entry,
+    oid_t relTableID, table_id_t nbrTableID, std::vector<std::string> relProperties,
+    bool randomLookup) {
+    return std::make_unique<InMemGraphNbrScanState>(context, entry, relTableID, nbrTableID,
+        std::move(relProperties), randomLookup);
+}
+
+Graph::EdgeIterator InMemGraph::scanFwd(nodeID_t nodeID, NbrScanState& state) {
+    return scan(nodeID, ku_dynamic_cast<InMemGraphNbrScanState&>(state), RelDataDirection::FWD);
+}
+
+Graph::EdgeIterator InMemGraph::scanBwd(nodeID_t nodeID, NbrScanState& state) {
+    return scan(nodeID, ku_dynamic_cast<InMemGraphNbrScanState&>(state), RelDataDirection::BWD);
+}
+
+Graph::EdgeIterator InMemGraph::scan(nodeID_t nodeID, InMemGraphNbrScanState& state,
+    RelDataDirection direction) {
+    auto idx = RelDirectionUtils::relDirectionToKeyIdx(direction);
+    if (!state.adjListsFetched[idx]) {
+        state.adjLists[idx] = getAdjList(state, direction);
+        state.adjListsFetched[idx] = true;
+    }
+    if (state.adjLists[idx] == nullptr) {
+        if (state.onDiskScanState == nullptr) {
+            state.onDiskScanState = onDiskGraph.prepareRelScan(state.entry, state.relTableID,
+                state.nbrTableID, state.relProperties, state.randomLookup);
+        }
+        return direction == RelDataDirection::FWD ?
+                   onDiskGraph.scanFwd(nodeID, *state.onDiskScanState) :
+                   onDiskGraph.scanBwd(nodeID, *state.onDiskScanState);
+    }
+    state.startScan(state.adjLists[idx], nodeID.offset);
+    return EdgeIterator(&state);
+}
+
+const InMemAdjList* InMemGraph::getAdjList(const InMemGraphNbrScanState& state,
+    RelDataDirection direction) {
+    auto key = stringFormat("{}_{}", state.relTableID,
+        RelDirectionUtils::relDirectionToString(direction));
+    for (auto& propertyName : state.relProperties) {
+        key += "_" + propertyName;
+    }
+    std::unique_lock lck{mtx};
+    if (!adjLists.contains(key)) {
+        adjLists.emplace(key, buildAdjList(state, direction));
+    }
+    return adjLists.at(key).get();
+}
+
+std::unique_ptr<InMemAdjList> InMemGraph::buildAdjList(const InMemGraphNbrScanState& state,
+    RelDataDirection direction) {
+    auto transaction = transaction::Transaction::Get(*context);
+    auto isFwd = direction == RelDataDirection::FWD;
+    auto boundTableID = isFwd ? state.srcTableID : state.dstTableID;
+    auto nbrTableID = isFwd ? state.dstTableID : state.srcTableID;
+    auto numBoundNodes = onDiskGraph.getMaxOffset(transaction, boundTableID);
+    if (numBoundNodes >= UINT32_MAX || onDiskGraph.getMaxOffset(transaction, nbrTableID) >
+                                           UINT32_MAX) {
+        return nullptr;
+    }
+    auto adjList = std::make_unique<InMemAdjList>();
+    adjList->nbrTableID = nbrTableID;
+    for (auto& propertyName : state.relProperties) {
+        auto& type = state.entry.getProperty(propertyName).getType();
+        if (!isFixedSize(type.getPhysicalType())) {
+            return nullptr;
+        }
+        InMemAdjList::PropertyColumn column;
+        column.type = type.copy();
+        column.numBytesPerValue = PhysicalTypeUtils::getFixedTypeSize(type.getPhysicalType());
+        adjList->propertyColumns.push_back(std::move(column));
+    }
+    auto scanState = onDiskGraph.prepareRelScan(state.entry, state.relTableID, nbrTableID,
+        state.relProperties, false /* randomLookup */);
+    adjList->csrOffsets.reserve(numBoundNodes + 1);
+    adjList->csrOffsets.push_back(0);
+    for (auto offset = 0u; offset < numBoundNodes; ++offset) {
+        if (context->interrupted()) {
+            throw InterruptException{};
+        }
+        auto nodeID = nodeID_t{offset, boundTableID};
+        auto iter = isFwd ? onDiskGraph.scanFwd(nodeID, *scanState) :
+                            onDiskGraph.scanBwd(nodeID, *scanState);
+        for (const auto chunk : iter) {
+            chunk.forEach([&](auto neighbors, auto propertyVectors, auto i) {
+                auto relIdx = adjList->nbrOffsets.size();
+                adjList->nbrOffsets.push_back(neighbors[i].offset);
+                for (auto j = 0u; j < adjList->propertyColumns.size(); ++j) {
+                    appendProperty(adjList->propertyColumns[j], *propertyVectors[j], i, relIdx);
+                }
+            });
+        }
+        if (adjList->nbrOffsets.size() >= UINT32_MAX) {
+            return nullptr;
+        }
+        adjList->csrOffsets.push_back(adjList->nbrOffsets.size());
+    }
+    return adjList;
+}
+
+} // namespace graph
+} // namespace ryu
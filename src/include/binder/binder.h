@@ -214,6 +214,7 @@ public:
         const QueryGraphCollection& queryGraphCollection, const parser::JoinHintNode& joinHintNode);
     std::shared_ptr<BoundJoinHintNode> bindJoinNode(const parser::JoinHintNode& joinHintNode);
     void rewriteMatchPattern(BoundGraphPattern& boundGraphPattern);
+    std::shared_ptr<Expression> inferTransitivePredicates(std::shared_ptr<Expression> where);
     std::unique_ptr<BoundReadingClause> bindUnwindClause(
         const parser::ReadingClause& readingClause);
     std::unique_ptr<BoundReadingClause> bindInQueryCall(const parser::ReadingClause& readingClause);
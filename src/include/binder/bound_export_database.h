@@ -24,11 +24,12 @@ class BoundExportDatabase final : public BoundStatement {
 public:
     BoundExportDatabase(std::string filePath, common::FileTypeInfo fileTypeInfo,
         std::vector<ExportedTableData> exportData,
-        common::case_insensitive_map_t<common::Value> csvOption, bool schemaOnly)
+        common::case_insensitive_map_t<common::Value> csvOption, bool schemaOnly,
+        uint64_t parallelism)
         : BoundStatement{type_, BoundStatementResult::createSingleStringColumnResult()},
           exportData(std::move(exportData)),
           boundFileInfo(std::move(fileTypeInfo), std::vector{std::move(filePath)}),
-          schemaOnly{schemaOnly} {
+          schemaOnly{schemaOnly}, parallelism{parallelism} {
         boundFileInfo.options = std::move(csvOption);
     }
 
@@ -40,11 +41,13 @@ public:
     const common::FileScanInfo* getBoundFileInfo() const { return &boundFileInfo; }
     const std::vector<ExportedTableData>* getExportData() const { return &exportData; }
     bool exportSchemaOnly() const { return schemaOnly; }
+    uint64_t getParallelism() const { return parallelism; }
 
 private:
     std::vector<ExportedTableData> exportData;
     common::FileScanInfo boundFileInfo;
     bool schemaOnly;
+    uint64_t parallelism;
 };
 
 } // namespace binder
@@ -83,6 +83,21 @@ struct ExtraBoundCopyRelInfo final : ExtraBoundCopyFromInfo {
     }
 };
 
+struct ExtraBoundCopyNodeInfo final : ExtraBoundCopyFromInfo {
+    // Rows whose primary key already exists update the existing node instead of being reported as
+    // duplicates.
+    bool updateOnConflict;
+    // Column of the source the rows are sorted by before they are copied, if any.
+    std::shared_ptr<Expression> clusterKey;
+
+    ExtraBoundCopyNodeInfo(bool updateOnConflict, std::shared_ptr<Expression> clusterKey)
+        : updateOnConflict{updateOnConflict}, clusterKey{std::move(clusterKey)} {}
+
+    std::unique_ptr<ExtraBoundCopyFromInfo> copy() const override {
+        return std::make_unique<ExtraBoundCopyNodeInfo>(*this);
+    }
+};
+
 class BoundCopyFrom final : public BoundStatement {
     static constexpr common::StatementType statementType_ = common::StatementType::COPY_FROM;
 
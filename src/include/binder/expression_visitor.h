@@ -26,6 +26,9 @@ public:
     void visit(std::shared_ptr<Expression> expr);
 
     static bool isRandom(const Expression& expression);
+    // Functions whose result may change between two calls with the same arguments.
+    static bool isNonDeterministicFunction(const std::string& functionName);
+    static bool isNonDeterministic(const Expression& expression);
 
 protected:
     void visitSwitch(std::shared_ptr<Expression> expr);
@@ -89,12 +92,14 @@ private:
 class ConstantExpressionVisitor {
 public:
     static bool needFold(const Expression& expr);
-    static bool isConstant(const Expression& expr);
+    // Parameters are known when a statement is bound for execution, so they can be folded into
+    // the functions that take them.
+    static bool isConstant(const Expression& expr, bool allowParameter = false);
 
 private:
-    static bool visitFunction(const Expression& expr);
-    static bool visitCase(const Expression& expr);
-    static bool visitChildren(const Expression& expr);
+    static bool visitFunction(const Expression& expr, bool allowParameter);
+    static bool visitCase(const Expression& expr, bool allowParameter);
+    static bool visitChildren(const Expression& expr, bool allowParameter);
 };
 
 } // namespace binder
@@ -96,6 +96,27 @@ struct ArrowArray {
 
 #endif // ARROW_C_DATA_INTERFACE
 
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+// The Arrow C stream interface.
+// https://arrow.apache.org/docs/format/CStreamInterface.html
+struct ArrowArrayStream {
+    // Callback to get the stream type
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    // Callback to get the next array, or to mark the end of the stream by releasing out
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    // Callback to get the error message of the last failed call
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+
+    // Release callback
+    void (*release)(struct ArrowArrayStream*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
@@ -163,6 +184,7 @@ typedef struct {
 typedef struct {
     void* _prepared_statement;
     void* _bound_values;
+    void* _batched_values;
 } ryu_prepared_statement;
 
 /**
@@ -173,6 +195,19 @@ typedef struct {
     bool _is_owned_by_cpp;
 } ryu_query_result;
 
+/**
+ * @brief ryu_query_future is the pending result of a query that is executed asynchronously.
+ */
+typedef struct {
+    void* _query_future;
+} ryu_query_future;
+
+/**
+ * @brief Callback of an asynchronous query. It is called on the thread that executes the query
+ * once the result is ready, so it should only notify the caller, e.g. an event loop.
+ */
+typedef void (*ryu_query_callback)(void* user_data);
+
 /**
  * @brief ryu_flat_tuple stores a vector of values.
  */
@@ -390,6 +425,18 @@ RYU_C_API ryu_state ryu_connection_get_max_num_thread_for_exec(ryu_connection* c
  */
 RYU_C_API ryu_state ryu_connection_query(ryu_connection* connection, const char* query,
     ryu_query_result* out_query_result);
+/**
+ * @brief Executes the given query on a separate thread without blocking the caller. The query can
+ * be cancelled with ryu_connection_interrupt. The connection must outlive the query future.
+ * @param connection The connection instance to execute the query.
+ * @param query The query to execute.
+ * @param callback The callback to call once the result is ready, or NULL.
+ * @param user_data The argument passed to the callback.
+ * @param[out] out_query_future The output parameter that will hold the query future.
+ * @return The state indicating the success or failure of the operation.
+ */
+RYU_C_API ryu_state ryu_connection_query_async(ryu_connection* connection, const char* query,
+    ryu_query_callback callback, void* user_data, ryu_query_future* out_query_future);
 /**
  * @brief Prepares the given query and returns the prepared statement.
  * @param connection The connection instance to prepare the query.
@@ -408,6 +455,18 @@ RYU_C_API ryu_state ryu_connection_prepare(ryu_connection* connection, const cha
  */
 RYU_C_API ryu_state ryu_connection_execute(ryu_connection* connection,
     ryu_prepared_statement* prepared_statement, ryu_query_result* out_query_result);
+/**
+ * @brief Executes the prepared_statement once for each parameter set added with
+ * ryu_prepared_statement_add_batch and clears the added parameter sets. Unless there is an active
+ * transaction, all executions run in a single transaction that is rolled back if any of them fails.
+ * @param connection The connection instance to execute the prepared_statement.
+ * @param prepared_statement The prepared statement to execute.
+ * @param[out] out_query_result The output parameter that will hold the results of the executions
+ * chained in order, or the error of the first failing execution.
+ * @return The state indicating the success or failure of the operation.
+ */
+RYU_C_API ryu_state ryu_connection_execute_batch(ryu_connection* connection,
+    ryu_prepared_statement* prepared_statement, ryu_query_result* out_query_result);
 /**
  * @brief Interrupts the current query execution in the connection.
  * @param connection The connection instance to interrupt.
@@ -622,6 +681,14 @@ RYU_C_API ryu_state ryu_prepared_statement_bind_string(ryu_prepared_statement* p
  */
 RYU_C_API ryu_state ryu_prepared_statement_bind_value(ryu_prepared_statement* prepared_statement,
     const char* param_name, ryu_value* value);
+/**
+ * @brief Adds a copy of the currently bound values as a parameter set to the batch of the prepared
+ * statement, which is executed with ryu_connection_execute_batch. The bound values are kept, so
+ * only the values that change need to be bound again for the next parameter set.
+ * @param prepared_statement The prepared statement instance to add the parameter set to.
+ * @return The state indicating the success or failure of the operation.
+ */
+RYU_C_API ryu_state ryu_prepared_statement_add_batch(ryu_prepared_statement* prepared_statement);
 
 // QueryResult
 /**
@@ -747,6 +814,20 @@ RYU_C_API ryu_state ryu_query_result_get_arrow_schema(ryu_query_result* query_re
 RYU_C_API ryu_state ryu_query_result_get_next_arrow_chunk(ryu_query_result* query_result,
     int64_t chunk_size, struct ArrowArray* out_arrow_array);
 
+/**
+ * @brief Returns the remaining tuples of the query result as ArrowArrayStream.
+ * @param query_result The query result instance to return.
+ * @param chunk_size The number of tuples in each arrow array of the stream.
+ * @param[out] out_stream The output parameter that will hold the arrow array stream. Each call to
+ * its get_next function converts the next chunk_size tuples of the query result.
+ * @return The state indicating the success or failure of the operation.
+ *
+ * The query result must outlive the stream. It is the caller's responsibility to call the release
+ * function of the stream and of each array returned by it.
+ */
+RYU_C_API ryu_state ryu_query_result_get_arrow_array_stream(ryu_query_result* query_result,
+    int64_t chunk_size, struct ArrowArrayStream* out_stream);
+
 // FlatTuple
 /**
  * @brief Destroys the given flat tuple instance.
@@ -1296,6 +1377,19 @@ RYU_C_API ryu_state ryu_value_get_string(ryu_value* value, char** out_result);
  * @return The state indicating the success or failure of the operation.
  */
 RYU_C_API ryu_state ryu_value_get_blob(ryu_value* value, uint8_t** out_result);
+/**
+ * @brief Returns a view of the bytes of the given value without copying them. The value must be of
+ * type STRING or BLOB. Unlike ryu_value_get_string and ryu_value_get_blob, nothing is allocated, so
+ * this is the preferred accessor when iterating over large results.
+ * @param value The value to return.
+ * @param[out] out_data The output parameter that will point to the bytes of the value. The bytes
+ * are owned by the value and are only valid until the value is destroyed or, for values of a flat
+ * tuple, until the next tuple is fetched from the query result.
+ * @param[out] out_length The output parameter that will hold the number of bytes.
+ * @return The state indicating the success or failure of the operation.
+ */
+RYU_C_API ryu_state ryu_value_get_string_view(ryu_value* value, const char** out_data,
+    uint64_t* out_length);
 /**
  * @brief Returns the uuid value of the given value.
  * to a string. The value must be of type UUID.
@@ -1450,6 +1544,27 @@ RYU_C_API double ryu_query_summary_get_compiling_time(ryu_query_summary* query_s
  */
 RYU_C_API double ryu_query_summary_get_execution_time(ryu_query_summary* query_summary);
 
+// QueryFuture
+/**
+ * @brief Destroys the given query future. Waits for the query to finish if it is still running.
+ * @param query_future The query future to destroy.
+ */
+RYU_C_API void ryu_query_future_destroy(ryu_query_future* query_future);
+/**
+ * @brief Returns true if the result of the query is ready.
+ * @param query_future The query future instance.
+ */
+RYU_C_API bool ryu_query_future_is_ready(ryu_query_future* query_future);
+/**
+ * @brief Waits for the result of the query and moves it out of the query future. The result can
+ * only be retrieved once.
+ * @param query_future The query future instance.
+ * @param[out] out_query_result The output parameter that will hold the result of the query.
+ * @return The state indicating the success or failure of the operation.
+ */
+RYU_C_API ryu_state ryu_query_future_get(ryu_query_future* query_future,
+    ryu_query_result* out_query_result);
+
 // Utility functions
 /**
  * @brief Convert timestamp_ns to corresponding tm struct.
@@ -1580,6 +1695,7 @@ typedef ryu_database ryu_database;
 typedef ryu_connection ryu_connection;
 typedef ryu_prepared_statement ryu_prepared_statement;
 typedef ryu_query_result ryu_query_result;
+typedef ryu_query_future ryu_query_future;
 typedef ryu_flat_tuple ryu_flat_tuple;
 typedef ryu_logical_type ryu_logical_type;
 typedef ryu_value ryu_value;
@@ -1645,8 +1761,10 @@ typedef ryu_state ryu_state;
 #define ryu_connection_set_max_num_thread_for_exec ryu_connection_set_max_num_thread_for_exec
 #define ryu_connection_get_max_num_thread_for_exec ryu_connection_get_max_num_thread_for_exec
 #define ryu_connection_query ryu_connection_query
+#define ryu_connection_query_async ryu_connection_query_async
 #define ryu_connection_prepare ryu_connection_prepare
 #define ryu_connection_execute ryu_connection_execute
+#define ryu_connection_execute_batch ryu_connection_execute_batch
 #define ryu_connection_interrupt ryu_connection_interrupt
 #define ryu_connection_set_query_timeout ryu_connection_set_query_timeout
 #define ryu_prepared_statement_destroy ryu_prepared_statement_destroy
@@ -1672,6 +1790,7 @@ typedef ryu_state ryu_state;
 #define ryu_prepared_statement_bind_interval ryu_prepared_statement_bind_interval
 #define ryu_prepared_statement_bind_string ryu_prepared_statement_bind_string
 #define ryu_prepared_statement_bind_value ryu_prepared_statement_bind_value
+#define ryu_prepared_statement_add_batch ryu_prepared_statement_add_batch
 #define ryu_query_result_destroy ryu_query_result_destroy
 #define ryu_query_result_is_success ryu_query_result_is_success
 #define ryu_query_result_get_error_message ryu_query_result_get_error_message
@@ -1765,6 +1884,7 @@ typedef ryu_state ryu_state;
 #define ryu_value_get_decimal_as_string ryu_value_get_decimal_as_string
 #define ryu_value_get_string ryu_value_get_string
 #define ryu_value_get_blob ryu_value_get_blob
+#define ryu_value_get_string_view ryu_value_get_string_view
 #define ryu_value_get_uuid ryu_value_get_uuid
 #define ryu_value_to_string ryu_value_to_string
 #define ryu_node_val_get_id_val ryu_node_val_get_id_val
@@ -1786,6 +1906,9 @@ typedef ryu_state ryu_state;
 #define ryu_query_summary_destroy ryu_query_summary_destroy
 #define ryu_query_summary_get_compiling_time ryu_query_summary_get_compiling_time
 #define ryu_query_summary_get_execution_time ryu_query_summary_get_execution_time
+#define ryu_query_future_destroy ryu_query_future_destroy
+#define ryu_query_future_is_ready ryu_query_future_is_ready
+#define ryu_query_future_get ryu_query_future_get
 #define ryu_timestamp_ns_to_tm ryu_timestamp_ns_to_tm
 #define ryu_timestamp_ms_to_tm ryu_timestamp_ms_to_tm
 #define ryu_timestamp_sec_to_tm ryu_timestamp_sec_to_tm
@@ -25,6 +25,10 @@ namespace common {
 class VirtualFileSystem;
 } // namespace common
 
+namespace extension {
+class ExtensionManager;
+} // namespace extension
+
 namespace function {
 struct ScalarMacroFunction;
 } // namespace function
@@ -58,6 +62,9 @@ public:
 
     static Catalog* Get(const main::ClientContext& context);
 
+    // Functions and types of lazily loaded extensions are registered by their first lookup.
+    void setExtensionManager(extension::ExtensionManager* manager) { extensionManager = manager; }
+
     // ----------------------------- Tables ----------------------------
 
     // Check if table entry exists.
@@ -244,6 +251,7 @@ private:
     // incremented whenever a change is made to the catalog
     // reset to 0 at the end of each checkpoint
     uint64_t version;
+    extension::ExtensionManager* extensionManager = nullptr;
 };
 
 } // namespace catalog
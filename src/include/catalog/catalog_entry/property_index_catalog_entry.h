@@ -0,0 +1,23 @@
+#pragma once
+
+#include "catalog/catalog_entry/index_catalog_entry.h"
+
+namespace ryu {
+namespace catalog {
+
+// The property index has no options, so its auxiliary info only knows how to export itself.
+struct RYU_API PropertyIndexAuxInfo final : IndexAuxInfo {
+    std::unique_ptr<IndexAuxInfo> copy() override {
+        return std::make_unique<PropertyIndexAuxInfo>();
+    }
+
+    std::string toCypher(const IndexCatalogEntry& indexEntry,
+        const ToCypherInfo& info) const override;
+};
+
+struct PropertyIndexCatalogEntry {
+    static constexpr char TYPE_NAME[] = "PROPERTY";
+};
+
+} // namespace catalog
+} // namespace ryu
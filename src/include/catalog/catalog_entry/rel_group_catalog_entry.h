@@ -34,10 +34,10 @@ public:
     RelGroupCatalogEntry() = default;
     RelGroupCatalogEntry(std::string tableName, common::RelMultiplicity srcMultiplicity,
         common::RelMultiplicity dstMultiplicity, common::ExtendDirection storageDirection,
-        std::vector<RelTableCatalogInfo> relTableInfos)
+        std::vector<RelTableCatalogInfo> relTableInfos, std::string sortPropertyName = "")
         : TableCatalogEntry{type_, std::move(tableName)}, srcMultiplicity{srcMultiplicity},
           dstMultiplicity{dstMultiplicity}, storageDirection{storageDirection},
-          relTableInfos{std::move(relTableInfos)} {
+          relTableInfos{std::move(relTableInfos)}, sortPropertyName{std::move(sortPropertyName)} {
         propertyCollection =
             PropertyDefinitionCollection{1}; // Skip NBR_NODE_ID column as the first one.
     }
@@ -54,6 +54,13 @@ public:
 
     common::ExtendDirection getStorageDirection() const { return storageDirection; }
 
+    // Rels of a sorted rel group are kept ordered by the sort property within each CSR list.
+    bool hasSortProperty() const { return !sortPropertyName.empty(); }
+    const std::string& getSortPropertyName() const { return sortPropertyName; }
+    common::column_id_t getSortColumnID() const {
+        return hasSortProperty() ? getColumnID(sortPropertyName) : common::INVALID_COLUMN_ID;
+    }
+
     common::idx_t getNumRelTables() const { return relTableInfos.size(); }
     const std::vector<RelTableCatalogInfo>& getRelEntryInfos() const { return relTableInfos; }
     const RelTableCatalogInfo& getSingleRelEntryInfo() const;
@@ -81,6 +88,7 @@ public:
     void addFromToConnection(common::table_id_t srcTableID, common::table_id_t dstTableID,
         common::oid_t oid);
     void dropFromToConnection(common::table_id_t srcTableID, common::table_id_t dstTableID);
+    void renameProperty(const std::string& propertyName, const std::string& newName) override;
     void serialize(common::Serializer& serializer) const override;
     static std::unique_ptr<RelGroupCatalogEntry> deserialize(common::Deserializer& deserializer);
     std::string toCypher(const ToCypherInfo& info) const override;
@@ -97,6 +105,7 @@ private:
     // TODO(Guodong): Avoid using extend direction for storage direction
     common::ExtendDirection storageDirection = common::ExtendDirection::BOTH;
     std::vector<RelTableCatalogInfo> relTableInfos;
+    std::string sortPropertyName;
 };
 
 } // namespace catalog
@@ -85,6 +85,8 @@ public:
 
 private:
     void nextValNoLock();
+    // Advances a sequence without cycle by count values at once and returns the first of them.
+    int64_t reserveRangeNoLock(uint64_t count);
 
 private:
     std::mutex mtx;
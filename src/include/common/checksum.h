@@ -7,4 +7,18 @@ namespace ryu::common {
 //! Compute a checksum over a buffer of size size
 uint64_t checksum(uint8_t* buffer, size_t size);
 
+//! Computes the same checksum as checksum() over data which is passed in any number of pieces, so
+//! that it does not need to be copied into one buffer first
+class IncrementalChecksum {
+public:
+    void update(const uint8_t* data, size_t size);
+    uint64_t finish() const;
+
+private:
+    uint64_t result = 5381;
+    // Bytes which don't fill a uint64_t yet
+    uint8_t pending[8]{};
+    size_t numPending = 0;
+};
+
 } // namespace ryu::common
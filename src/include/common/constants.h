@@ -21,6 +21,8 @@ constexpr double DEFAULT_HT_LOAD_FACTOR = 1.5;
 constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS = 5000000;
+// Interval at which update versions no longer needed by any transaction are pruned.
+constexpr uint64_t UPDATE_VACUUM_INTERVAL_IN_MICROS = 1000000;
 
 // Note that some places use std::bit_ceil to calculate resizes,
 // which won't work for values other than 2. If this is changed, those will need to be updated
@@ -70,6 +72,10 @@ struct StorageConstants {
     static constexpr char WAL_FILE_SUFFIX[] = "wal";
     static constexpr char SHADOWING_SUFFIX[] = "shadow";
     static constexpr char TEMP_FILE_SUFFIX[] = "tmp";
+    static constexpr char COLD_STORAGE_MAP_SUFFIX[] = "cold";
+    static constexpr char COLD_SEGMENT_SUFFIX[] = "ryu_segment";
+    static constexpr char CHECKPOINT_LOCK_FILE_SUFFIX[] = "lock";
+    static constexpr char BUFFER_POOL_SNAPSHOT_SUFFIX[] = "bufferpool";
 
     // The number of pages that we add at one time when we need to grow a file.
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
@@ -77,6 +83,12 @@ struct StorageConstants {
     static constexpr uint64_t PAGE_IDX_IN_GROUP_MASK =
         (static_cast<uint64_t>(1) << PAGE_GROUP_SIZE_LOG2) - 1;
 
+    // Checkpoints move column chunks from the end of the data file into free pages before it once
+    // this share of the file is free, so that the end of the file can be truncated.
+    static constexpr double MIN_FREE_PAGE_RATIO_TO_COMPACT = 0.25;
+    // Bounds the time a single checkpoint spends on moving chunks.
+    static constexpr page_idx_t MAX_NUM_PAGES_TO_COMPACT_PER_CHECKPOINT = 1 << 16;
+
     static constexpr double PACKED_CSR_DENSITY = 0.8;
     static constexpr double LEAF_HIGH_CSR_DENSITY = 1.0;
 
@@ -85,6 +97,7 @@ struct StorageConstants {
 
 struct TableOptionConstants {
     static constexpr char REL_STORAGE_DIRECTION_OPTION[] = "STORAGE_DIRECTION";
+    static constexpr char REL_SORT_BY_OPTION[] = "SORT_BY";
 };
 
 // Hash Index Configurations
@@ -107,6 +120,13 @@ struct CopyConstants {
     static constexpr const char* FROM_OPTION_NAME = "FROM";
     static constexpr const char* TO_OPTION_NAME = "TO";
 
+    // Whether rows whose primary key already exists in a node table are reported as errors
+    // ('ERROR') or update the existing nodes ('UPDATE').
+    static constexpr const char* ON_CONFLICT_OPTION_NAME = "ON_CONFLICT";
+    // Property by which the rows copied into a node table are sorted before they are written, so
+    // that each node group, and thus its zone maps, covers a narrow range of the property.
+    static constexpr const char* CLUSTER_BY_OPTION_NAME = "CLUSTER_BY";
+
     static constexpr const char* BOOL_CSV_PARSING_OPTIONS[] = {"HEADER", "PARALLEL",
         "LIST_UNBRACED", "AUTODETECT", "AUTO_DETECT", CopyConstants::IGNORE_ERRORS_OPTION_NAME};
     static constexpr bool DEFAULT_CSV_HAS_HEADER = false;
@@ -164,11 +184,18 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t SIP_RATIO = 5;
+    // Cost of looking up the properties of a single node relative to scanning them, per node.
+    static constexpr uint64_t NODE_LOOKUP_PENALTY = 10;
 };
 
 struct OrderByConstants {
     static constexpr uint64_t NUM_BYTES_FOR_PAYLOAD_IDX = 8;
     static constexpr uint64_t MIN_LIMIT_RATIO_TO_REDUCE = 2;
+    static constexpr uint64_t MAX_STRING_PREFIX_LENGTH = 256;
+    // Ranges of encoded keys that are wider or shorter than these are sorted by comparing keys
+    // rather than by radix sort, which needs a counting pass per byte.
+    static constexpr uint64_t MAX_NUM_BYTES_TO_RADIX_SORT = 16;
+    static constexpr uint64_t MIN_NUM_TUPLES_TO_RADIX_SORT = 24;
 };
 
 struct ParquetConstants {
@@ -203,6 +230,9 @@ struct PortDBConstants {
     static constexpr const char* SCHEMA_ONLY_OPTION = "SCHEMA_ONLY";
     static constexpr const char* EXPORT_FORMAT_OPTION = "FORMAT";
     static constexpr const char* DEFAULT_EXPORT_FORMAT_OPTION = "PARQUET";
+    // Number of tables exported concurrently.
+    static constexpr const char* PARALLELISM_OPTION = "PARALLELISM";
+    static constexpr uint64_t DEFAULT_PARALLELISM = 4;
 };
 
 struct WarningConstants {
@@ -17,6 +17,11 @@ public:
 
     bool exceedLimit() const { return counter.load() >= limitNumber; }
 
+    common::offset_t getNumRemaining() const {
+        auto count = counter.load();
+        return count >= limitNumber ? 0 : limitNumber - count;
+    }
+
 private:
     common::offset_t limitNumber;
     std::atomic<common::offset_t> counter;
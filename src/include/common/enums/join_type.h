@@ -10,6 +10,10 @@ enum class JoinType : uint8_t {
     LEFT = 1,
     MARK = 2,
     COUNT = 3,
+    // Keeps the probe tuples which have (SEMI) or don't have (ANTI) a match, without reading the
+    // build side.
+    SEMI = 4,
+    ANTI = 5,
 };
 
 } // namespace common
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "common/api.h"
+#include "common/types/types.h"
+#include "exception.h"
+
+namespace ryu {
+namespace common {
+
+// Thrown by an operator which observed a cardinality far off the estimate its plan was chosen for.
+// The statement is then planned again with the observed cardinality and executed from scratch.
+class RYU_API ReoptimizeException : public Exception {
+public:
+    ReoptimizeException(std::string subgraphKey, cardinality_t cardinality)
+        : Exception("Statement needs to be re-optimized."), subgraphKey{std::move(subgraphKey)},
+          cardinality{cardinality} {}
+
+    const std::string& getSubgraphKey() const { return subgraphKey; }
+    cardinality_t getCardinality() const { return cardinality; }
+
+private:
+    std::string subgraphKey;
+    cardinality_t cardinality;
+};
+
+} // namespace common
+} // namespace ryu
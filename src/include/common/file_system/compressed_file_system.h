@@ -19,6 +19,7 @@ struct StreamData {
 };
 
 struct CompressedFileInfo;
+class DecompressionPrefetcher;
 
 struct StreamWrapper {
     virtual ~StreamWrapper() = default;
@@ -70,13 +71,17 @@ struct CompressedFileInfo : public FileInfo {
     idx_t currentPos = 0;
     std::unique_ptr<StreamWrapper> stream_wrapper;
 
-    CompressedFileInfo(CompressedFileSystem& compressedFS, std::unique_ptr<FileInfo> childFileInfo)
-        : FileInfo{childFileInfo->path, &compressedFS}, compressedFS{compressedFS},
-          childFileInfo{std::move(childFileInfo)} {}
-    ~CompressedFileInfo() override { close(); }
+    // Decompresses ahead of the reader once the file is read from.
+    std::unique_ptr<DecompressionPrefetcher> prefetcher;
+
+    CompressedFileInfo(CompressedFileSystem& compressedFS, std::unique_ptr<FileInfo> childFileInfo);
+    ~CompressedFileInfo() override;
 
     void initialize();
     int64_t readData(void* buffer, size_t numBytes);
+    // Decompresses up to numBytes into the buffer. Fewer bytes are only returned at the end of the
+    // stream.
+    int64_t decompress(void* buffer, size_t numBytes);
     void close();
 };
 
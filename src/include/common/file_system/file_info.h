@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 
 #include "common/api.h"
@@ -11,6 +12,14 @@ namespace ryu {
 namespace common {
 
 class FileSystem;
+enum class FileLockType : uint8_t;
+
+// A read of numBytes bytes at the given position of a file into buffer.
+struct FileReadRequest {
+    void* buffer;
+    uint64_t numBytes;
+    uint64_t position;
+};
 
 struct RYU_API FileInfo {
     FileInfo(std::string path, FileSystem* fileSystem)
@@ -22,8 +31,17 @@ struct RYU_API FileInfo {
 
     void readFromFile(void* buffer, uint64_t numBytes, uint64_t position);
 
+    // Performs all reads, possibly concurrently. Returns once all of them have completed.
+    void readFromFileBatch(std::span<const FileReadRequest> requests);
+
     int64_t readFile(void* buf, size_t nbyte);
 
+    void prefetch(uint64_t position, uint64_t numBytes);
+
+    void punchHole(uint64_t position, uint64_t numBytes);
+
+    bool tryLock(FileLockType lockType);
+
     void writeFile(const uint8_t* buffer, uint64_t numBytes, uint64_t offset);
 
     void syncFile() const;
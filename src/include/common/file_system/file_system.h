@@ -112,8 +112,27 @@ protected:
     virtual void readFromFile(FileInfo& fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const = 0;
 
+    // The default implementation performs the reads one after the other with readFromFile.
+    virtual void readFromFileBatch(FileInfo& fileInfo,
+        std::span<const FileReadRequest> requests) const;
+
     virtual int64_t readFile(FileInfo& fileInfo, void* buf, size_t numBytes) const = 0;
 
+    // Hints that the given range of the file will be read soon. Does nothing by default.
+    virtual void prefetch(FileInfo& /*fileInfo*/, uint64_t /*position*/,
+        uint64_t /*numBytes*/) const {}
+
+    // Locks the whole file without waiting. Returns false if another process holds a conflicting
+    // lock. The lock is released when the file is closed.
+    virtual bool tryLock(FileInfo& /*fileInfo*/, FileLockType /*lockType*/) const {
+        KU_UNREACHABLE;
+    }
+
+    // Releases the disk space of the given range without changing the size of the file. Does
+    // nothing by default.
+    virtual void punchHole(FileInfo& /*fileInfo*/, uint64_t /*position*/,
+        uint64_t /*numBytes*/) const {}
+
     virtual void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const;
 
@@ -58,8 +58,21 @@ protected:
     void readFromFile(FileInfo& fileInfo, void* buffer, uint64_t numBytes,
         uint64_t position) const override;
 
+    // On Linux, the reads are submitted together through io_uring when it is available.
+    void readFromFileBatch(FileInfo& fileInfo,
+        std::span<const FileReadRequest> requests) const override;
+
     int64_t readFile(FileInfo& fileInfo, void* buf, size_t nbyte) const override;
 
+    // Asks the OS to start reading the range into the page cache in the background.
+    void prefetch(FileInfo& fileInfo, uint64_t position, uint64_t numBytes) const override;
+
+    bool tryLock(FileInfo& fileInfo, FileLockType lockType) const override;
+
+    // Deallocates the range on Linux file systems that support sparse files. Reads of the range
+    // return zeros afterwards.
+    void punchHole(FileInfo& fileInfo, uint64_t position, uint64_t numBytes) const override;
+
     void writeFile(FileInfo& fileInfo, const uint8_t* buffer, uint64_t numBytes,
         uint64_t offset) const override;
 
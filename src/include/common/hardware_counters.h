@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ryu {
+namespace common {
+
+struct HardwareCounterValues {
+    uint64_t numCycles = 0;
+    uint64_t numInstructions = 0;
+    uint64_t numLLCMisses = 0;
+};
+
+// Cpu cycles, retired instructions and last level cache misses of the calling thread, counted in
+// user space through perf events. Only Linux exposes these counters, and only if the kernel allows
+// it (see /proc/sys/kernel/perf_event_paranoid).
+class HardwareCounters {
+public:
+    HardwareCounters();
+    ~HardwareCounters();
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    // Returns the counters of the calling thread, which are opened on first use, or nullptr if
+    // they are not available.
+    static HardwareCounters* getThreadLocal();
+
+    bool isAvailable() const { return groupFD >= 0; }
+    HardwareCounterValues read() const;
+
+private:
+    void closeCounters();
+
+private:
+    // The counters are opened as one group so that they are read together with a single syscall.
+    int groupFD;
+    int instructionsFD;
+    int llcMissesFD;
+};
+
+} // namespace common
+} // namespace ryu
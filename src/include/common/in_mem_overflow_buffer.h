@@ -59,6 +59,9 @@ public:
 
     storage::MemoryManager* getMemoryManager() { return memoryManager; }
 
+    // Total size of the blocks allocated by the buffer.
+    uint64_t getMemoryUsage() const;
+
 private:
     bool requireNewBlock(uint64_t sizeToAllocate) {
         return blocks.empty() ||
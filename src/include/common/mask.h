@@ -18,7 +18,14 @@ public:
     virtual bool isMasked(offset_t startNodeOffset) = 0;
 
     // include&exclude
-    virtual offset_vec_t range(uint32_t start, uint32_t end) = 0;
+    virtual offset_vec_t range(offset_t start, offset_t end) = 0;
+    // Returns the first masked offset that is not smaller than the given one, or INVALID_OFFSET, so
+    // that scans can skip to the next masked node group or vector instead of probing each offset.
+    virtual offset_t nextMaskedOffset(offset_t offset) const = 0;
+
+    // Called once masking is done. Masks may switch to a representation chosen by their density,
+    // which is dropped again if more offsets are masked afterwards.
+    virtual void finalize() {}
 
     virtual uint64_t getNumMaskedNodes() const = 0;
 
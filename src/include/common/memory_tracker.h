@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ryu {
+namespace common {
+
+// Current and peak memory allocated through the memory manager on behalf of an owner, i.e. a query
+// or one of its operators. Allocations are also added to the parent's usage.
+//
+// Memory buffers keep a reference to the tracker they were allocated for, so that they can be
+// freed after the query, e.g. when they hold its result.
+class MemoryTracker : public std::enable_shared_from_this<MemoryTracker> {
+public:
+    explicit MemoryTracker(std::shared_ptr<MemoryTracker> parent = nullptr)
+        : parent{std::move(parent)} {}
+    virtual ~MemoryTracker() = default;
+
+    void allocate(uint64_t size);
+    void free(uint64_t size);
+
+    uint64_t getUsage() const { return usage.load(std::memory_order_relaxed); }
+    uint64_t getPeakUsage() const { return peakUsage.load(std::memory_order_relaxed); }
+
+    // Returns the tracker which the memory allocated by the calling thread is accounted to, or
+    // nullptr if the allocations are not tracked.
+    static MemoryTracker* getThreadLocal() { return threadLocalTracker; }
+
+private:
+    friend class MemoryTrackerScope;
+    static thread_local MemoryTracker* threadLocalTracker;
+
+    std::shared_ptr<MemoryTracker> parent;
+    std::atomic<uint64_t> usage{0};
+    std::atomic<uint64_t> peakUsage{0};
+};
+
+// Accounts the memory allocated by the calling thread to the given tracker until the scope ends.
+// Scopes nest, e.g. while an operator pulls tuples from its child.
+class MemoryTrackerScope {
+public:
+    explicit MemoryTrackerScope(MemoryTracker* tracker)
+        : previousTracker{MemoryTracker::threadLocalTracker} {
+        MemoryTracker::threadLocalTracker = tracker;
+    }
+    ~MemoryTrackerScope() { MemoryTracker::threadLocalTracker = previousTracker; }
+    MemoryTrackerScope(const MemoryTrackerScope&) = delete;
+    MemoryTrackerScope& operator=(const MemoryTrackerScope&) = delete;
+
+private:
+    MemoryTracker* previousTracker;
+};
+
+struct OperatorMemoryUsage {
+    uint32_t operatorID;
+    std::string operatorName;
+    uint64_t usage;
+    uint64_t peakUsage;
+};
+
+// Memory tracker of a query, which has one child tracker per physical operator.
+class QueryMemoryTracker final : public MemoryTracker {
+public:
+    explicit QueryMemoryTracker(uint64_t queryID) : queryID{queryID} {}
+
+    uint64_t getQueryID() const { return queryID; }
+
+    // Returns the tracker of the operator, which is created on first use. Clones of an operator
+    // share its tracker.
+    MemoryTracker* getOperatorTracker(uint32_t operatorID, const std::string& operatorName);
+    // Returns 0 if the operator has not allocated any memory.
+    uint64_t getOperatorPeakUsage(uint32_t operatorID) const;
+    std::vector<OperatorMemoryUsage> getOperatorUsages() const;
+
+private:
+    struct OperatorTracker {
+        std::string operatorName;
+        std::shared_ptr<MemoryTracker> tracker;
+    };
+
+    uint64_t queryID;
+    mutable std::mutex mtx;
+    std::map<uint32_t, OperatorTracker> operatorTrackers;
+};
+
+} // namespace common
+} // namespace ryu
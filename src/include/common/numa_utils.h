@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ryu {
+namespace common {
+
+struct NUMAUtils {
+    static constexpr uint64_t INVALID_CPU = UINT64_MAX;
+
+    // Returns the CPUs of each NUMA node. Empty if the machine has a single NUMA node or the
+    // topology is not exposed (only Linux exposes it).
+    static std::vector<std::vector<uint64_t>> getNodeCPUs();
+    // Returns the CPU the calling thread is currently running on, or INVALID_CPU if unknown.
+    static uint64_t getCurrentCPU();
+};
+
+} // namespace common
+} // namespace ryu
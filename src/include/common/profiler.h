@@ -9,6 +9,7 @@
 
 namespace ryu {
 namespace common {
+class QueryMemoryTracker;
 
 class Profiler {
 
@@ -27,6 +28,11 @@ private:
 public:
     std::mutex mtx;
     bool enabled = false;
+    // If operators also profile cpu cycles, instructions and LLC misses.
+    bool enableHardwareCounters = false;
+    // Memory used by the query and its operators. Tracked even if profiling is disabled. Null if
+    // the plan is not executed, e.g. for EXPLAIN.
+    std::shared_ptr<QueryMemoryTracker> memoryTracker;
     std::unordered_map<std::string, std::vector<std::unique_ptr<Metric>>> metrics;
 };
 
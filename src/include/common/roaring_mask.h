@@ -6,26 +6,78 @@
 namespace ryu {
 namespace common {
 
+enum class SemiMaskRepresentation : uint8_t {
+    ROARING = 0,
+    // Few masked offsets, e.g. a few hundred nodes out of millions, are kept in a sorted array.
+    SORTED_ARRAY = 1,
+    // Dense masks are kept in a plain bitset over [0, maxOffset).
+    BITSET = 2,
+};
+
+/**
+ * Read-optimized copy of a finalized roaring mask. Roaring is used while masking, as offsets arrive
+ * in any order from multiple threads. Once the mask is complete, very sparse masks are faster to
+ * probe and iterate as a sorted array, and dense ones as a bitset without container lookups.
+ */
+class SemiMaskReadView {
+public:
+    static constexpr uint64_t MAX_SORTED_ARRAY_SIZE = 4096;
+    // Same density at which roaring switches to bitmap containers, so memory usage is comparable.
+    static constexpr uint64_t MIN_BITSET_DENSITY_RECIPROCAL = 16;
+
+    static SemiMaskRepresentation chooseRepresentation(uint64_t numMasked, offset_t maxOffset);
+
+    template<typename ROARING>
+    void build(const ROARING& roaring, offset_t maxOffset);
+    void reset();
+
+    SemiMaskRepresentation getRepresentation() const { return representation; }
+
+    bool contains(offset_t offset) const;
+    offset_t nextMaskedOffset(offset_t offset) const;
+    offset_vec_t range(offset_t start, offset_t end) const;
+
+private:
+    SemiMaskRepresentation representation = SemiMaskRepresentation::ROARING;
+    offset_vec_t offsets;
+    std::vector<uint64_t> bits;
+};
+
 class Roaring32BitmapSemiMask final : public SemiMask {
 public:
     explicit Roaring32BitmapSemiMask(offset_t maxOffset)
         : SemiMask(maxOffset), roaring(std::make_shared<roaring::Roaring>()) {}
 
-    void mask(offset_t nodeOffset) override { roaring->add(nodeOffset); }
+    void mask(offset_t nodeOffset) override {
+        readView.reset();
+        roaring->add(nodeOffset);
+    }
     void maskRange(offset_t startNodeOffset, offset_t endNodeOffset) override {
+        readView.reset();
         roaring->addRange(startNodeOffset, endNodeOffset);
     }
 
-    bool isMasked(offset_t startNodeOffset) override { return roaring->contains(startNodeOffset); }
+    bool isMasked(offset_t startNodeOffset) override {
+        return readView.getRepresentation() == SemiMaskRepresentation::ROARING ?
+                   roaring->contains(startNodeOffset) :
+                   readView.contains(startNodeOffset);
+    }
 
     uint64_t getNumMaskedNodes() const override { return roaring->cardinality(); }
 
     offset_vec_t collectMaskedNodes(uint64_t size) const override;
 
     // include&exclude
-    offset_vec_t range(uint32_t start, uint32_t end) override;
+    offset_vec_t range(offset_t start, offset_t end) override;
+    offset_t nextMaskedOffset(offset_t offset) const override;
+
+    void finalize() override { readView.build(*roaring, getMaxOffset()); }
+    SemiMaskRepresentation getRepresentation() const { return readView.getRepresentation(); }
 
     std::shared_ptr<roaring::Roaring> roaring;
+
+private:
+    SemiMaskReadView readView;
 };
 
 class Roaring64BitmapSemiMask final : public SemiMask {
@@ -33,21 +85,36 @@ public:
     explicit Roaring64BitmapSemiMask(offset_t maxOffset)
         : SemiMask(maxOffset), roaring(std::make_shared<roaring::Roaring64Map>()) {}
 
-    void mask(offset_t nodeOffset) override { roaring->add(nodeOffset); }
+    void mask(offset_t nodeOffset) override {
+        readView.reset();
+        roaring->add(nodeOffset);
+    }
     void maskRange(offset_t startNodeOffset, offset_t endNodeOffset) override {
+        readView.reset();
         roaring->addRange(startNodeOffset, endNodeOffset);
     }
 
-    bool isMasked(offset_t startNodeOffset) override { return roaring->contains(startNodeOffset); }
+    bool isMasked(offset_t startNodeOffset) override {
+        return readView.getRepresentation() == SemiMaskRepresentation::ROARING ?
+                   roaring->contains(startNodeOffset) :
+                   readView.contains(startNodeOffset);
+    }
 
     uint64_t getNumMaskedNodes() const override { return roaring->cardinality(); }
 
     offset_vec_t collectMaskedNodes(uint64_t size) const override;
 
     // include&exclude
-    offset_vec_t range(uint32_t start, uint32_t end) override;
+    offset_vec_t range(offset_t start, offset_t end) override;
+    offset_t nextMaskedOffset(offset_t offset) const override;
+
+    void finalize() override { readView.build(*roaring, getMaxOffset()); }
+    SemiMaskRepresentation getRepresentation() const { return readView.getRepresentation(); }
 
     std::shared_ptr<roaring::Roaring64Map> roaring;
+
+private:
+    SemiMaskReadView readView;
 };
 
 } // namespace common
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ryu {
+namespace common {
+
+/**
+ * QueryTracer records when each thread works on the tasks, pipelines and morsels of one query.
+ * The timeline is written in the Chrome trace event format, which chrome://tracing and Perfetto
+ * open directly, so that idle workers, stragglers and serial phases such as pipeline finalization
+ * become visible.
+ */
+class QueryTracer {
+public:
+    using clock_t = std::chrono::steady_clock;
+
+    QueryTracer() : startTime{clock_t::now()} {}
+
+    void addEvent(std::string name, const char* category, clock_t::time_point start,
+        clock_t::time_point end);
+
+    uint64_t getNumEvents() const;
+
+    // Returns the events as a Chrome trace JSON object.
+    std::string toJson() const;
+
+private:
+    struct Event {
+        std::string name;
+        const char* category;
+        uint32_t threadIdx;
+        int64_t startInUs;
+        int64_t durationInUs;
+    };
+
+    clock_t::time_point startTime;
+    mutable std::mutex mtx;
+    std::vector<Event> events;
+    // Threads are numbered in the order they record their first event.
+    std::unordered_map<std::thread::id, uint32_t> threadIdxes;
+};
+
+// Records an event spanning the lifetime of the scope. Does nothing if tracer is null.
+class TraceScope {
+public:
+    TraceScope(QueryTracer* tracer, const char* category, std::string name)
+        : tracer{tracer}, category{category} {
+        if (tracer != nullptr) {
+            this->name = std::move(name);
+            start = QueryTracer::clock_t::now();
+        }
+    }
+    ~TraceScope() {
+        if (tracer != nullptr) {
+            tracer->addEvent(std::move(name), category, start, QueryTracer::clock_t::now());
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    QueryTracer* tracer;
+    const char* category;
+    std::string name;
+    QueryTracer::clock_t::time_point start;
+};
+
+} // namespace common
+} // namespace ryu
@@ -2,6 +2,7 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "common/api.h"
@@ -9,6 +10,8 @@
 namespace ryu {
 namespace common {
 
+class QueryTracer;
+
 using lock_t = std::unique_lock<std::mutex>;
 
 /**
@@ -29,10 +32,14 @@ class RYU_API Task {
 public:
     explicit Task(uint64_t maxNumThreads)
         : parent{nullptr}, maxNumThreads{maxNumThreads}, numThreadsFinished{0},
-          numThreadsRegistered{0}, exceptionsPtr{nullptr}, ID{UINT64_MAX} {}
+          numThreadsRegistered{0}, exceptionsPtr{nullptr}, ID{UINT64_MAX}, tracer{nullptr},
+          independentChildren{false}, maxNumConcurrentChildren{UINT64_MAX},
+          runOnCallingThread{false} {}
 
     virtual ~Task() = default;
     virtual void run() = 0;
+    // Calls run() and records it in the query trace if the task is traced.
+    void execute();
     // This function is called from inside deRegisterThreadAndFinalizeTaskIfNecessary() only
     // once by the last registered worker that is completing this task. So the task lock is
     // already acquired. So do not attempt to acquire the task lock inside. If needed we can
@@ -41,6 +48,11 @@ public:
     virtual void finalize() {}
     // If task should terminate all subsequent tasks.
     virtual bool terminate() { return false; }
+    // Name of the task in the query trace.
+    virtual std::string getTraceName() const { return "Task"; }
+
+    void setTracer(QueryTracer* tracer_) { tracer = tracer_; }
+    QueryTracer* getTracer() const { return tracer; }
 
     void addChildTask(std::unique_ptr<Task> child) {
         child->parent = this;
@@ -58,8 +70,32 @@ public:
 
     void setSingleThreadedTask() { maxNumThreads = 1; }
 
+    // Set for the tasks of point queries, whose hand-off to a worker would take about as long as
+    // running them. Only single-threaded tasks are run on the calling thread.
+    void setRunOnCallingThread() { runOnCallingThread = true; }
+    bool canRunOnCallingThread() const { return runOnCallingThread && maxNumThreads == 1; }
+
+    // Children which don't depend on each other, e.g. the branches of a union, can be scheduled
+    // concurrently, at most maxNumConcurrentChildren of them at a time.
+    void setIndependentChildren(uint64_t maxNumConcurrentChildren_ = UINT64_MAX) {
+        independentChildren = true;
+        maxNumConcurrentChildren = maxNumConcurrentChildren_;
+    }
+    bool hasIndependentChildren() const { return independentChildren; }
+    uint64_t getMaxNumConcurrentChildren() const { return maxNumConcurrentChildren; }
+
     bool registerThread();
 
+    bool canRegister() {
+        lock_t lck{taskMtx};
+        return !hasExceptionNoLock() && canRegisterNoLock();
+    }
+
+    uint64_t getNumActiveThreads() {
+        lock_t lck{taskMtx};
+        return numThreadsRegistered - numThreadsFinished;
+    }
+
     void deRegisterThreadAndFinalizeTask();
 
     void setException(const std::exception_ptr& exceptionPtr) {
@@ -101,6 +137,10 @@ protected:
     uint64_t maxNumThreads, numThreadsFinished, numThreadsRegistered;
     std::exception_ptr exceptionsPtr;
     uint64_t ID;
+    QueryTracer* tracer;
+    bool independentChildren;
+    uint64_t maxNumConcurrentChildren;
+    bool runOnCallingThread;
 };
 
 } // namespace common
@@ -1,7 +1,9 @@
 #pragma once
 #include <deque>
+#include <memory>
 
 #ifndef __SINGLE_THREADED__
+#include <atomic>
 #include <condition_variable>
 #include <thread>
 #endif
@@ -13,61 +15,114 @@ namespace ryu {
 namespace common {
 
 struct ScheduledTask {
-    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
+    ScheduledTask(std::shared_ptr<Task> task, uint64_t ID, uint64_t queryID = 0,
+        uint64_t maxNumQueryThreads = UINT64_MAX)
+        : task{std::move(task)}, ID{ID}, queryID{queryID},
+          maxNumQueryThreads{maxNumQueryThreads} {};
     std::shared_ptr<Task> task;
     uint64_t ID;
+    // Query the task belongs to, which may run several tasks at once, and the maximum number of
+    // threads all of its tasks together may use.
+    uint64_t queryID;
+    uint64_t maxNumQueryThreads;
 };
 
 /**
  * TaskScheduler is a library that manages a set of worker threads that can execute tasks that are
  * put into a task queue. Each task accepts a maximum number of threads. Users of TaskScheduler
  * schedule tasks to be executed by calling schedule functions, e.g., pushTaskIntoQueue or
- * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers grab the first
- * task from the beginning of the queue that they can register themselves to work on. Any task that
- * is completed is removed automatically from the queue. If there is a task that raises an
- * exception, the worker threads catch it and store it with the tasks. The user thread that is
- * waiting on the completion of the task (or tasks) will throw the exception (the user thread could
- * be waiting on a tasks through a function that waits, e.g., scheduleTaskAndWaitOrError.
+ * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers are shared fairly
+ * between queries: a worker registers itself to a task of the query with the fewest active
+ * threads among the tasks that accept more threads, and to the one closest to the beginning of the
+ * queue among tasks of equally loaded queries. The tasks of a query together never get more
+ * workers than the threads setting of its connection, even if they run concurrently, e.g. the
+ * branches of a union. Any task that is completed is removed automatically from the queue. If
+ * there is a task that raises an exception, the worker threads catch it and store it with the
+ * tasks. The user thread that is waiting on the completion of the task (or tasks) will throw the
+ * exception (the user thread could be waiting on a tasks through a function that waits, e.g.,
+ * scheduleTaskAndWaitOrError.
  *
  * Currently there is one way the TaskScheduler can be used:
  * Schedule one task T and wait for T to finish or error if there was an exception raised by
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * TaskScheduler guarantees that workers will register themselves to tasks of equally loaded
+ * queries in FIFO order. A long running query is thus not given all workers while other queries
+ * wait, but tasks are not guaranteed to be completed in FIFO order: a long running task that is
+ * not accepting more registration can stay in the queue for an unlimited time until completion.
+ *
+ * If work stealing is enabled, the single global queue is replaced by one queue per worker, each
+ * guarded by its own mutex. New tasks are distributed round-robin over the worker queues. A worker
+ * first tries to register itself to a task in its own queue and otherwise steals, i.e., registers
+ * itself to a task in another worker's queue. The global mutex is then only taken by workers that
+ * found no task and are about to sleep. FIFO registration order, fair sharing between queries and
+ * the thread limit of a query are only guaranteed per queue in this mode. On Linux machines with
+ * multiple NUMA nodes, workers are also pinned round-robin to the CPUs of the NUMA nodes.
  */
 #ifndef __SINGLE_THREADED__
 class RYU_API TaskScheduler {
 public:
 #if defined(__APPLE__)
-    explicit TaskScheduler(uint64_t numWorkerThreads, uint32_t threadQos);
+    TaskScheduler(uint64_t numWorkerThreads, bool enableWorkStealing, uint32_t threadQos);
 #else
-    explicit TaskScheduler(uint64_t numWorkerThreads);
+    TaskScheduler(uint64_t numWorkerThreads, bool enableWorkStealing);
 #endif
     ~TaskScheduler();
 
+    bool isWorkStealingEnabled() const { return enableWorkStealing; }
+
     // Schedules the dependencies of the given task and finally the task one after another (so
-    // not concurrently), and throws an exception if any of the tasks errors. Regardless of
-    // whether or not the given task or one of its dependencies errors, when this function
-    // returns, no task related to the given task will be in the task queue. Further no worker
-    // thread will be working on the given task.
+    // not concurrently), and throws an exception if any of the tasks errors. Independent
+    // dependencies are scheduled concurrently instead. Regardless of whether or not the given task
+    // or one of its dependencies errors, when this function returns, no task related to the given
+    // task will be in the task queue. Further no worker thread will be working on the given task.
+    // Tasks which can run on the calling thread, see Task::setRunOnCallingThread, are run there
+    // unless the query has a timeout.
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
+    // Puts the given task, which must not have dependencies, into the queue and returns without
+    // waiting for it. The caller must call runOrWaitTaskOrError on the returned task before the
+    // state used by the task is destroyed.
+    std::shared_ptr<ScheduledTask> scheduleTask(const std::shared_ptr<Task>& task,
+        processor::ExecutionContext* context);
+    // Runs a task scheduled with scheduleTask on the calling thread if no worker has registered to
+    // it yet, e.g. because all workers are busy with the pipeline of the calling thread. Otherwise
+    // waits until the task is completed. Throws the exception of the task if it errored.
+    void runOrWaitTaskOrError(const std::shared_ptr<ScheduledTask>& scheduledTask);
+
     static TaskScheduler* Get(const main::ClientContext& context);
 
+    uint64_t getNumQueuedTasks();
+    uint64_t getNumScheduledTasks();
+
 private:
+    struct WorkerQueue {
+        std::mutex mtx;
+        std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
+    };
+
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
-    void runWorkerThread();
+    void runWorkerThread(uint64_t workerID);
+    void runWorkStealingWorkerThread(uint64_t workerID);
+
+    // Schedules each of the tasks and its dependencies from one of at most as many threads as
+    // there are workers, so that their pipelines share the workers.
+    void scheduleIndependentTasksAndWaitOrError(const std::vector<std::shared_ptr<Task>>& tasks,
+        processor::ExecutionContext* context, uint64_t maxNumConcurrentTasks);
 
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+        const processor::ExecutionContext& context);
+    void notifyWorkerThreads();
 
     void removeErroringTask(uint64_t scheduledTaskID);
 
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    // Tries the worker's own queue first and then steals from the other workers' queues.
+    std::shared_ptr<ScheduledTask> stealTaskAndRegister(uint64_t workerID);
+    static std::shared_ptr<ScheduledTask> getTaskAndRegister(
+        std::deque<std::shared_ptr<ScheduledTask>>& queue);
     static void runTask(Task* task);
 
 private:
@@ -77,6 +132,11 @@ private:
     std::mutex taskSchedulerMtx;
     std::condition_variable cv;
     uint64_t nextScheduledTaskID;
+    bool enableWorkStealing;
+    std::vector<std::unique_ptr<WorkerQueue>> workerQueues;
+    // Bumped whenever a task is pushed in work stealing mode, so that a worker that found no task
+    // does not go to sleep if a task was pushed after it started searching.
+    std::atomic<uint64_t> queueEpoch;
 #if defined(__APPLE__)
     uint32_t threadQos; // Thread quality of service for worker threads.
 #endif
@@ -85,20 +145,28 @@ private:
 // Single-threaded version of TaskScheduler
 class TaskScheduler {
 public:
-    explicit TaskScheduler(uint64_t numWorkerThreads);
+    TaskScheduler(uint64_t numWorkerThreads, bool enableWorkStealing);
     ~TaskScheduler();
 
+    bool isWorkStealingEnabled() const { return false; }
+
     void scheduleTaskAndWaitOrError(const std::shared_ptr<Task>& task,
         processor::ExecutionContext* context, bool launchNewWorkerThread = false);
 
     static TaskScheduler* Get(const main::ClientContext& context);
 
+    uint64_t getNumQueuedTasks();
+    uint64_t getNumScheduledTasks();
+
 private:
-    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task);
+    std::shared_ptr<ScheduledTask> pushTaskIntoQueue(const std::shared_ptr<Task>& task,
+        const processor::ExecutionContext& context);
 
     void removeErroringTask(uint64_t scheduledTaskID);
 
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    static std::shared_ptr<ScheduledTask> getTaskAndRegister(
+        std::deque<std::shared_ptr<ScheduledTask>>& queue);
     static void runTask(Task* task);
 
 private:
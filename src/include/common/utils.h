@@ -64,6 +64,15 @@ constexpr T countBits(T) {
     return sizeof(T) * bitsPerByte;
 }
 
+// Hints the CPU to load the cache line holding the given address ahead of reading it.
+inline void prefetchForRead(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0 /* read */, 3 /* high temporal locality */);
+#else
+    (void)address;
+#endif
+}
+
 template<numeric_utils::IsIntegral T>
 struct CountZeros {
     static constexpr idx_t Leading(T value_in) { return std::countl_zero(value_in); }
@@ -83,6 +83,9 @@ public:
 
     void resize(uint64_t numValues);
 
+    // Grows the capacity to at least numValues without changing the size.
+    void reserve(uint64_t numValues);
+
 private:
     void resizeDataVector(ValueVector* dataVector);
 
@@ -10,6 +10,7 @@
 #include "common/null_mask.h"
 #include "common/types/ku_string.h"
 #include "common/vector/auxiliary_buffer.h"
+#include "common/vector/vector_buffer.h"
 
 namespace ryu {
 namespace common {
@@ -146,7 +147,7 @@ public:
     std::shared_ptr<DataChunkState> state;
 
 private:
-    std::unique_ptr<uint8_t[]> valueBuffer;
+    vector_buffer_t valueBuffer;
     NullMask nullMask;
     uint32_t numBytesPerValue;
     std::unique_ptr<AuxiliaryBuffer> auxiliaryBuffer;
@@ -206,6 +207,8 @@ public:
     static void copyListEntryAndBufferMetaData(ValueVector& vector,
         const SelectionVector& selVector, const ValueVector& other,
         const SelectionVector& otherSelVector);
+    // Copies the size and capacity of the data vector of other, whose data vector is shared.
+    static void copyBufferMetaData(ValueVector& vector, const ValueVector& other);
     static ValueVector* getDataVector(const ValueVector* vector) {
         KU_ASSERT(validateType(*vector));
         return getAuxBuffer(*vector).getDataVector();
@@ -237,6 +240,10 @@ public:
         KU_ASSERT(validateType(*vector));
         getAuxBufferUnsafe(*vector).resize(numValues);
     }
+    static void reserveDataVector(ValueVector* vector, uint64_t numValues) {
+        KU_ASSERT(validateType(*vector));
+        getAuxBufferUnsafe(*vector).reserve(numValues);
+    }
 
     static void copyFromRowData(ValueVector* vector, uint32_t pos, const uint8_t* rowData);
     static void copyToRowData(const ValueVector* vector, uint32_t pos, uint8_t* rowData,
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "common/api.h"
+
+namespace ryu {
+namespace common {
+
+// Frees the value buffer of a vector, or hands it to the VectorBufferCache of the calling thread if
+// it has one.
+struct RYU_API VectorBufferDeleter {
+    uint64_t size = 0;
+
+    void operator()(uint8_t* buffer) const;
+};
+
+using vector_buffer_t = std::unique_ptr<uint8_t[], VectorBufferDeleter>;
+
+// Every operator of every query allocates the value buffers of its vectors, and frees them once the
+// query is done. Most of them hold DEFAULT_VECTOR_CAPACITY values of 1 to 16 bytes, so there are
+// only a few sizes of buffers. Worker threads keep the buffers of these sizes they free, up to
+// MAX_CACHED_BYTES, and reuse them for the next vectors they create. Workers are shared by all
+// queries, so queries that follow each other closely mostly reuse the buffers of earlier ones
+// instead of going through the allocator.
+// The cached buffers are not accounted to the buffer manager. Instead, only worker threads cache
+// buffers, and they release their cache whenever they run out of tasks, i.e., once the queries
+// they worked on are done. Other threads, e.g. the ones of users freeing query results, free their
+// buffers right away.
+class RYU_API VectorBufferCache {
+public:
+    static constexpr uint64_t MAX_CACHED_BYTES = 4 * 1024 * 1024;
+
+    // Returns a zero-initialized buffer of the given size.
+    static vector_buffer_t allocate(uint64_t size);
+
+    // Lets the calling thread cache the buffers it frees.
+    static void enableThreadCache();
+    // Frees the buffers cached by the calling thread.
+    static void releaseThreadCache();
+    static uint64_t getNumThreadCachedBytes();
+};
+
+} // namespace common
+} // namespace ryu
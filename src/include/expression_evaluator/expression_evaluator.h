@@ -21,6 +21,7 @@ enum class EvaluatorType : uint8_t {
     PATH = 5,
     NODE_REL = 6,
     REFERENCE = 8,
+    FUSED = 9,
 };
 
 class ExpressionEvaluator;
@@ -14,6 +14,7 @@ protected:
 
     virtual void visitCase(ExpressionEvaluator*) {}
     virtual void visitFunction(ExpressionEvaluator*) {}
+    virtual void visitFused(ExpressionEvaluator*) {}
     virtual void visitLambdaParam(ExpressionEvaluator*) {}
     virtual void visitListLambda(ExpressionEvaluator*) {}
     virtual void visitLiteral(ExpressionEvaluator*) {}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <optional>
+
+#include "common/types/value/value.h"
+#include "expression_evaluator.h"
+
+namespace ryu {
+namespace evaluator {
+
+enum class FusedOperator : uint8_t {
+    ADD = 0,
+    SUBTRACT = 1,
+    MULTIPLY = 2,
+    DIVIDE = 3,
+    MODULO = 4,
+    EQUALS = 10,
+    NOT_EQUALS = 11,
+    GREATER_THAN = 12,
+    GREATER_THAN_EQUALS = 13,
+    LESS_THAN = 14,
+    LESS_THAN_EQUALS = 15,
+};
+
+// A binary numeric function applied to the running value and a constant.
+struct FusedStep {
+    FusedOperator op;
+    common::Value constant;
+    // Whether the constant is the left operand, e.g. 10 - a.x.
+    bool isConstantLeft;
+
+    bool isComparison() const { return op >= FusedOperator::EQUALS; }
+    // Index of the child the running value comes from.
+    uint32_t getInputIdx() const { return isConstantLeft ? 1 : 0; }
+
+    // Returns the step if the expression is a numeric arithmetic function or, as the root of a
+    // chain, a numeric comparison with exactly one non-null literal operand.
+    static std::optional<FusedStep> get(const binder::Expression& expression, bool isRoot);
+};
+
+// Evaluates a chain of numeric functions whose other operands are constants, e.g.
+// a.x * 2 + 1 > 10, in a single pass over its input instead of materializing a vector for every
+// function. Non-null input values are gathered into a buffer that stays in cache, each step is
+// applied to the whole buffer in a tight loop, and only the final values are written to the result.
+class FusedExpressionEvaluator final : public ExpressionEvaluator {
+    static constexpr EvaluatorType type_ = EvaluatorType::FUSED;
+
+public:
+    FusedExpressionEvaluator(std::shared_ptr<binder::Expression> expression,
+        std::unique_ptr<ExpressionEvaluator> input, std::vector<FusedStep> steps);
+
+    void evaluate() override;
+
+    bool selectInternal(common::SelectionVector& selVector) override;
+
+    std::unique_ptr<ExpressionEvaluator> copy() override;
+
+protected:
+    void resolveResultVector(const processor::ResultSet& resultSet,
+        storage::MemoryManager* memoryManager) override;
+
+private:
+    template<typename T>
+    common::sel_t evaluateSteps(const common::ValueVector& input, T* values,
+        common::sel_t* positions, uint8_t* results) const;
+
+    template<typename T>
+    void evaluateInternal(const common::ValueVector& input);
+
+    template<typename T>
+    bool selectValues(const common::ValueVector& input, common::SelectionVector& selVector);
+
+private:
+    // Steps from the innermost function to the root.
+    std::vector<FusedStep> steps;
+};
+
+} // namespace evaluator
+} // namespace ryu
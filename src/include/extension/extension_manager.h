@@ -1,10 +1,14 @@
 #pragma once
 
+#include <mutex>
+
 #include "loaded_extension.h"
 #include "storage/storage_extension.h"
 
 namespace ryu {
-namespace main {}
+namespace main {
+class Database;
+} // namespace main
 namespace extension {
 
 struct ExtensionEntry {
@@ -13,7 +17,16 @@ struct ExtensionEntry {
 };
 
 class ExtensionManager {
+    // A linked extension whose functions and types are registered the first time one of them is
+    // looked up.
+    struct LazyExtension {
+        LinkedExtension extension;
+        std::once_flag loadFlag;
+    };
+
 public:
+    explicit ExtensionManager(main::Database& database) : database{database} {}
+
     void loadExtension(const std::string& path, main::ClientContext* context);
 
     RYU_API std::string toCypher();
@@ -35,13 +48,31 @@ public:
     static std::optional<ExtensionEntry> lookupExtensionsByFunctionName(
         std::string_view functionName);
     static std::optional<ExtensionEntry> lookupExtensionsByTypeName(std::string_view typeName);
+    // Whether the linked extension only registers the functions and types listed in the entries
+    // above, so it doesn't need to be loaded before one of them is looked up.
+    static bool canLoadLazily(std::string_view extensionName);
+
+    // Load the lazily loaded linked extension providing the function or type, if there is one.
+    // Return whether the lookup should be retried.
+    bool loadLazyExtensionByFunctionName(std::string_view functionName);
+    bool loadLazyExtensionByTypeName(std::string_view typeName);
+    void loadLazyExtensions();
 
     void autoLoadLinkedExtensions(main::ClientContext* context);
+    // Registers the functions of all loaded extensions again after the catalog was reloaded.
+    void reloadExtensions(main::ClientContext* context);
 
     RYU_API static ExtensionManager* Get(const main::ClientContext& context);
 
 private:
+    bool loadLazyExtension(std::string_view extensionName);
+    void loadLazyExtension(LazyExtension& lazyExtension);
+
+private:
+    main::Database& database;
     std::vector<LoadedExtension> loadedExtensions;
+    std::mutex lazyExtensionsMtx;
+    std::vector<std::unique_ptr<LazyExtension>> lazyExtensions;
     std::unordered_map<std::string, main::ExtensionOption> extensionOptions;
     common::case_insensitive_map_t<std::unique_ptr<storage::StorageExtension>> storageExtensions;
 };
@@ -7,6 +7,12 @@
 namespace ryu {
 namespace extension {
 
+// An extension linked into the library, which is loaded by calling its load function directly.
+struct LinkedExtension {
+    const char* name;
+    ext_load_func_t load;
+};
+
 class LoadedExtension {
 
 public:
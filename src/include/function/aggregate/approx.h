@@ -0,0 +1,58 @@
+#pragma once
+
+#include "common/type_utils.h"
+#include "function/aggregate_function.h"
+#include "function/hash/hash_functions.h"
+
+namespace ryu {
+namespace function {
+
+// Sketch based aggregates. Their states have a fixed size and are stored inline in the aggregate
+// hash table like any other state, so memory per group is bounded regardless of the input size,
+// and thread-local states are merged with combine().
+
+struct ApproxCountDistinctFunction {
+    static constexpr const char* name = "APPROX_COUNT_DISTINCT";
+
+    static function_set getFunctionSet();
+};
+
+struct ApproxQuantileFunction {
+    static constexpr const char* name = "APPROX_QUANTILE";
+
+    static function_set getFunctionSet();
+};
+
+struct ApproxTopKFunction {
+    static constexpr const char* name = "APPROX_TOP_K";
+    static constexpr uint64_t DEFAULT_K = 10;
+
+    static function_set getFunctionSet();
+};
+
+struct ApproxAggregateUtils {
+    // Values are identified by their hash only. Nested values are not supported.
+    static bool isHashable(const common::LogicalType& type) {
+        switch (type.getPhysicalType()) {
+        case common::PhysicalTypeID::LIST:
+        case common::PhysicalTypeID::ARRAY:
+        case common::PhysicalTypeID::STRUCT:
+            return false;
+        default:
+            return true;
+        }
+    }
+
+    static common::hash_t hash(const common::ValueVector& input, uint32_t pos) {
+        common::hash_t result = 0;
+        common::TypeUtils::visit(
+            input.dataType.getPhysicalType(),
+            [&]<common::HashableNonNestedTypes T>(
+                T) { Hash::operation(input.getValue<T>(pos), result); },
+            [](auto) { KU_UNREACHABLE; });
+        return result;
+    }
+};
+
+} // namespace function
+} // namespace ryu
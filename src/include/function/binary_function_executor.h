@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/system_config.h"
 #include "common/vector/value_vector.h"
 
 namespace ryu {
@@ -108,6 +109,39 @@ struct BinaryFunctionExecutor {
         return {lPos, rPos, resPos};
     }
 
+    // Positions of unflat vectors are the loop index if all selection vectors are unfiltered, so
+    // the loops have no indirection or null checks and are vectorized for simple operations.
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC,
+        typename OP_WRAPPER>
+    static void executeOnUnfilteredValues(common::ValueVector& left, common::sel_t lFlatPos,
+        common::ValueVector& right, common::sel_t rFlatPos, common::ValueVector& result,
+        common::sel_t numValues, void* dataPtr) {
+        auto leftData = (LEFT_TYPE*)left.getData();
+        auto rightData = (RIGHT_TYPE*)right.getData();
+        auto resultData = (RESULT_TYPE*)result.getData();
+        const bool leftFlat = left.state->isFlat();
+        const bool rightFlat = right.state->isFlat();
+        if (leftFlat && !rightFlat) {
+            auto& leftValue = leftData[lFlatPos];
+            for (common::sel_t i = 0; i < numValues; ++i) {
+                OP_WRAPPER::template operation<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC>(leftValue,
+                    rightData[i], resultData[i], &left, &right, &result, i, dataPtr);
+            }
+        } else if (!leftFlat && rightFlat) {
+            auto& rightValue = rightData[rFlatPos];
+            for (common::sel_t i = 0; i < numValues; ++i) {
+                OP_WRAPPER::template operation<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC>(
+                    leftData[i], rightValue, resultData[i], &left, &right, &result, i, dataPtr);
+            }
+        } else {
+            for (common::sel_t i = 0; i < numValues; ++i) {
+                OP_WRAPPER::template operation<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC>(
+                    leftData[leftFlat ? lFlatPos : i], rightData[rightFlat ? rFlatPos : i],
+                    resultData[i], &left, &right, &result, i, dataPtr);
+            }
+        }
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC,
         typename OP_WRAPPER>
     static void executeOnSelectedValues(common::ValueVector& left,
@@ -130,6 +164,13 @@ struct BinaryFunctionExecutor {
 
             const auto numSelectedValues =
                 leftFlat ? rightSelVector->getSelSize() : leftSelVector->getSelSize();
+            if (noNullsGuaranteed && (leftFlat || leftSelVector->isUnfiltered()) &&
+                (rightFlat || rightSelVector->isUnfiltered()) && resultSelVector->isUnfiltered()) {
+                executeOnUnfilteredValues<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
+                    left, (*leftSelVector)[0], right, (*rightSelVector)[0], result,
+                    numSelectedValues, dataPtr);
+                return;
+            }
             for (common::sel_t selPos = 0; selPos < numSelectedValues; ++selPos) {
                 auto [lPos, rPos, resPos] = getSelectedPositions(leftSelVector, rightSelVector,
                     resultSelVector, selPos, leftFlat, rightFlat);
@@ -195,6 +236,37 @@ struct BinaryFunctionExecutor {
         numSelectedValues += (resultValue == true);
     }
 
+    // Selects from unfiltered values without nulls in two passes. The results are first computed
+    // into a byte mask by a loop without dependencies between positions, which is vectorized for
+    // numeric comparisons, and then compacted into selected positions without branches.
+    template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER, bool LEFT_FLAT,
+        bool RIGHT_FLAT>
+    static uint64_t selectOnUnfilteredValues(common::ValueVector& left,
+        common::ValueVector& right, common::sel_t numValues,
+        std::span<common::sel_t> selectedPositionsBuffer, void* dataPtr) {
+        KU_ASSERT(numValues <= common::DEFAULT_VECTOR_CAPACITY);
+        auto leftData = (LEFT_TYPE*)left.getData();
+        auto rightData = (RIGHT_TYPE*)right.getData();
+        if constexpr (LEFT_FLAT) {
+            leftData += left.state->getSelVector()[0];
+        }
+        if constexpr (RIGHT_FLAT) {
+            rightData += right.state->getSelVector()[0];
+        }
+        uint8_t resultValues[common::DEFAULT_VECTOR_CAPACITY];
+        for (common::sel_t i = 0; i < numValues; i++) {
+            SELECT_WRAPPER::template operation<LEFT_TYPE, RIGHT_TYPE, FUNC>(
+                leftData[LEFT_FLAT ? 0 : i], rightData[RIGHT_FLAT ? 0 : i], resultValues[i], &left,
+                &right, dataPtr);
+        }
+        uint64_t numSelectedValues = 0;
+        for (common::sel_t i = 0; i < numValues; i++) {
+            selectedPositionsBuffer[numSelectedValues] = i;
+            numSelectedValues += (resultValues[i] == true);
+        }
+        return numSelectedValues;
+    }
+
     template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, typename SELECT_WRAPPER>
     static uint64_t selectBothFlat(common::ValueVector& left, common::ValueVector& right,
         void* dataPtr) {
@@ -218,6 +290,10 @@ struct BinaryFunctionExecutor {
         auto& rightSelVector = right.state->getSelVector();
         if (left.isNull(lPos)) {
             return numSelectedValues;
+        } else if (right.hasNoNullsGuarantee() && rightSelVector.isUnfiltered()) {
+            numSelectedValues = selectOnUnfilteredValues<LEFT_TYPE, RIGHT_TYPE, FUNC,
+                SELECT_WRAPPER, true /* LEFT_FLAT */, false /* RIGHT_FLAT */>(left, right,
+                rightSelVector.getSelSize(), selectedPositionsBuffer, dataPtr);
         } else if (right.hasNoNullsGuarantee()) {
             rightSelVector.forEach([&](auto i) {
                 selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, lPos, i, i,
@@ -244,6 +320,10 @@ struct BinaryFunctionExecutor {
         auto& leftSelVector = left.state->getSelVector();
         if (right.isNull(rPos)) {
             return numSelectedValues;
+        } else if (left.hasNoNullsGuarantee() && leftSelVector.isUnfiltered()) {
+            numSelectedValues = selectOnUnfilteredValues<LEFT_TYPE, RIGHT_TYPE, FUNC,
+                SELECT_WRAPPER, false /* LEFT_FLAT */, true /* RIGHT_FLAT */>(left, right,
+                leftSelVector.getSelSize(), selectedPositionsBuffer, dataPtr);
         } else if (left.hasNoNullsGuarantee()) {
             leftSelVector.forEach([&](auto i) {
                 selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, i, rPos, i,
@@ -268,7 +348,12 @@ struct BinaryFunctionExecutor {
         uint64_t numSelectedValues = 0;
         auto selectedPositionsBuffer = selVector.getMutableBuffer();
         auto& leftSelVector = left.state->getSelVector();
-        if (left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee()) {
+        const bool noNullsGuaranteed = left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee();
+        if (noNullsGuaranteed && leftSelVector.isUnfiltered()) {
+            numSelectedValues = selectOnUnfilteredValues<LEFT_TYPE, RIGHT_TYPE, FUNC,
+                SELECT_WRAPPER, false /* LEFT_FLAT */, false /* RIGHT_FLAT */>(left, right,
+                leftSelVector.getSelSize(), selectedPositionsBuffer, dataPtr);
+        } else if (noNullsGuaranteed) {
             leftSelVector.forEach([&](auto i) {
                 selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC, SELECT_WRAPPER>(left, right, i, i, i,
                     numSelectedValues, selectedPositionsBuffer, dataPtr);
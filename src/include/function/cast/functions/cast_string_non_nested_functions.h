@@ -1,5 +1,8 @@
 #pragma once
 
+#include <bit>
+#include <cstring>
+
 #include "common/constants.h"
 #include "common/exception/conversion.h"
 #include "common/string_format.h"
@@ -184,6 +187,54 @@ struct IntegerCastOperation<uint128_t> {
 bool tryCastToBool(const char* input, uint64_t len, bool& result);
 void RYU_API castStringToBool(const char* input, uint64_t len, bool& result);
 
+// Parses 8 ASCII digits at once (SWAR). Returns false if any of them is not a digit.
+inline bool tryParseEightDigits(const char* input, uint64_t& result) {
+    uint64_t chunk = 0;
+    memcpy(&chunk, input, sizeof(chunk));
+    if (((chunk & 0xF0F0F0F0F0F0F0F0) |
+            (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) != 0x3333333333333333) {
+        return false;
+    }
+    chunk -= 0x3030303030303030;
+    // Combine adjacent digits into 2-digit, then 4-digit, then 8-digit numbers.
+    chunk = chunk * 10 + (chunk >> 8);
+    chunk = ((chunk & 0x000000FF000000FF) * (100 + (1000000ULL << 32)) +
+                ((chunk >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32))) >>
+            32;
+    result = chunk;
+    return true;
+}
+
+// Integers with at most digits10 digits can't overflow, so their digits are parsed without
+// overflow checks, 8 at a time.
+template<std::integral T, bool NEGATIVE>
+inline bool integerCastLoopNoOverflow(const char* input, uint64_t len, uint64_t startPos,
+    IntegerCastData<T>& result) {
+    uint64_t value = 0;
+    auto pos = startPos;
+    if constexpr (std::endian::native == std::endian::little) {
+        for (; pos + 8 <= len; pos += 8) {
+            uint64_t digits = 0;
+            if (!tryParseEightDigits(input + pos, digits)) {
+                return false;
+            }
+            value = value * 100000000 + digits;
+        }
+    }
+    for (; pos < len; pos++) {
+        if (!StringUtils::CharacterIsDigit(input[pos])) {
+            return false;
+        }
+        value = value * 10 + (input[pos] - '0');
+    }
+    if constexpr (NEGATIVE) {
+        result.result = static_cast<T>(0 - static_cast<T>(value));
+    } else {
+        result.result = static_cast<T>(value);
+    }
+    return pos > startPos; // false if no digits "" or "-"
+}
+
 // cast to numerical values
 // TODO(Kebing): support exponent + decimal
 template<typename T, bool NEGATIVE>
@@ -193,6 +244,11 @@ inline bool integerCastLoop(const char* input, uint64_t len, IntegerCastData<T>&
     if (NEGATIVE) {
         start_pos = 1;
     }
+    if constexpr (std::integral<T>) {
+        if (len - start_pos <= std::numeric_limits<T>::digits10) {
+            return integerCastLoopNoOverflow<T, NEGATIVE>(input, len, start_pos, result);
+        }
+    }
     auto pos = start_pos;
     while (pos < len) {
         if (!StringUtils::CharacterIsDigit(input[pos])) {
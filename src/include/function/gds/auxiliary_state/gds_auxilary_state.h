@@ -14,6 +14,8 @@ struct ExecutionContext;
 
 namespace function {
 
+class FrontierPair;
+
 // Maintain algorithm specific data structures
 class GDSAuxiliaryState {
 public:
@@ -29,6 +31,10 @@ public:
 
     virtual void switchToDense(processor::ExecutionContext* context, graph::Graph* graph) = 0;
 
+    // Called when an iteration activates no node for the next one. States which defer nodes to
+    // later iterations, e.g. delta-stepping, activate them on the next frontier and return true.
+    virtual bool activateDeferredNodes(FrontierPair& /*frontierPair*/) { return false; }
+
     template<class TARGET>
     TARGET* ptrCast() {
         return common::ku_dynamic_cast<TARGET*>(this);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "function/gds/bfs_graph.h"
+#include "function/gds/delta_stepping.h"
 #include "gds_auxilary_state.h"
 
 namespace ryu {
@@ -27,8 +28,9 @@ private:
 
 class WSPPathsAuxiliaryState : public GDSAuxiliaryState {
 public:
-    explicit WSPPathsAuxiliaryState(std::unique_ptr<BFSGraphManager> bfsGraphManager)
-        : bfsGraphManager{std::move(bfsGraphManager)} {}
+    WSPPathsAuxiliaryState(std::unique_ptr<BFSGraphManager> bfsGraphManager,
+        std::unique_ptr<DeltaSteppingBuckets> buckets)
+        : bfsGraphManager{std::move(bfsGraphManager)}, buckets{std::move(buckets)} {}
 
     BFSGraphManager* getBFSGraphManager() { return bfsGraphManager.get(); }
 
@@ -46,8 +48,19 @@ public:
         bfsGraphManager->switchToDense(context, graph);
     }
 
+    bool activateDeferredNodes(FrontierPair& frontierPair) override {
+        if (buckets == nullptr) {
+            return false;
+        }
+        return buckets->activateNextBucket(frontierPair, [&](common::nodeID_t nodeID) {
+            return bfsGraphManager->getCurrentGraph()->getParentListHead(nodeID)->getCost();
+        });
+    }
+
 private:
     std::unique_ptr<BFSGraphManager> bfsGraphManager;
+    // Null unless weighted shortest paths are computed with delta-stepping.
+    std::unique_ptr<DeltaSteppingBuckets> buckets;
     ParentList sourceParent;
 };
 
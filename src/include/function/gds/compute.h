@@ -24,6 +24,20 @@ public:
     virtual std::vector<common::nodeID_t> edgeCompute(common::nodeID_t boundNodeID,
         graph::NbrScanState::Chunk& results, bool fwdEdge) = 0;
 
+    // Pull (bottom-up) iterations. Instead of the nodes in the current frontier pushing to all
+    // their neighbors, every node that can still be reached scans its neighbors in the opposite
+    // direction and pulls from the ones in the current frontier. Only edge computes that return
+    // true here are run in pull iterations.
+    virtual bool canPull() const { return false; }
+    // Returns true if the node with `offset` in the next frontier should pull from its neighbors.
+    virtual bool shouldPull(common::offset_t) { KU_UNREACHABLE; }
+    // Pulls from the neighbors of boundNodeID that are in the current frontier. Sets `reached` if
+    // boundNodeID should be put in the next frontier. Returns false if the remaining neighbors of
+    // boundNodeID don't need to be scanned.
+    virtual bool pullCompute(common::nodeID_t, graph::NbrScanState::Chunk&, bool& /*reached*/) {
+        KU_UNREACHABLE;
+    }
+
     virtual void resetSingleThreadState() {}
 
     virtual bool terminate(common::NodeOffsetMaskMap&) { return false; }
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace ryu {
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace function {
+
+class FrontierPair;
+
+// Buckets of delta-stepping for weighted shortest paths.
+// Bellman-Ford relaxes every node whose cost improved in the next iteration, so on graphs with a
+// large diameter, nodes far from the source are relaxed many times with costs that are later
+// improved. Delta-stepping groups nodes into buckets of width delta by cost, and only relaxes the
+// nodes of the lowest non-empty bucket. Nodes of later buckets are deferred until the lower buckets
+// are settled.
+class DeltaSteppingBuckets {
+public:
+    explicit DeltaSteppingBuckets(double delta) : delta{delta}, bucketUpperBound{delta} {}
+
+    // Returns nullptr if delta-stepping is disabled through the wsp_delta setting.
+    static std::unique_ptr<DeltaSteppingBuckets> create(const main::ClientContext& context);
+
+    // Returns true if a node whose cost improved to `cost` should be relaxed in the next iteration.
+    // Otherwise, the node is deferred to a later bucket. Can be called concurrently.
+    bool isInCurrentBucket(common::nodeID_t nodeID, double cost);
+
+    // Moves to the lowest bucket with deferred nodes, and activates its nodes on the next frontier.
+    // Returns false if there are no deferred nodes left.
+    bool activateNextBucket(FrontierPair& frontierPair,
+        const std::function<double(common::nodeID_t)>& getCost);
+
+private:
+    struct DeferredNode {
+        common::nodeID_t nodeID;
+        double cost;
+    };
+
+    double delta;
+    double bucketUpperBound;
+    std::mutex mtx;
+    std::vector<DeferredNode> deferredNodes;
+};
+
+} // namespace function
+} // namespace ryu
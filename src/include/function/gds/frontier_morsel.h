@@ -30,6 +30,9 @@ class RYU_API FrontierMorselDispatcher {
     // can have fewer than this. See the beginFrontierComputeBetweenTables to see the actual
     // morselSize computation for details.
     static constexpr uint64_t MIN_NUMBER_OF_FRONTIER_MORSELS = 128;
+    // Towards the end of the frontier, the remaining offsets are split into at least this many
+    // morsels per thread.
+    static constexpr uint64_t NUM_MORSELS_PER_THREAD_AT_END = 2;
 
 public:
     explicit FrontierMorselDispatcher(uint64_t maxThreads);
@@ -161,6 +161,58 @@ private:
     std::atomic<iteration_t>* curData = nullptr;
 };
 
+// Dense frontier implementation that only keeps one bit per node, for algorithms that only need
+// to know which nodes are active in an iteration. All nodes in the frontier are visited in the
+// same iteration, so the frontier is cleared whenever it is reused for a new iteration.
+class RYU_API DenseBitsetFrontier : public Frontier {
+    friend class DenseBitsetFrontierPair;
+
+public:
+    static constexpr uint64_t NUM_BITS_PER_WORD = 64;
+
+    explicit DenseBitsetFrontier(const common::table_id_map_t<common::offset_t>& nodeMaxOffsetMap)
+        : nodeMaxOffsetMap{nodeMaxOffsetMap} {}
+    DenseBitsetFrontier(const DenseBitsetFrontier& other) = delete;
+    DenseBitsetFrontier(const DenseBitsetFrontier&& other) = delete;
+
+    // Allocate memory and clear all nodes.
+    void init(processor::ExecutionContext* context);
+    // Clear all nodes. Nodes added afterwards are visited in iteration `iter`.
+    void reset(iteration_t iter);
+
+    void pinTableID(common::table_id_t tableID) override;
+
+    void addNode(common::nodeID_t nodeID, iteration_t iter) override;
+    void addNode(common::offset_t offset, iteration_t iter) override;
+    void addNodes(const std::vector<common::nodeID_t>& nodeIDs, iteration_t iter) override;
+
+    iteration_t getIteration(common::offset_t offset) const override;
+
+    // Returns the first offset in [beginOffset, endOffset) that is in the frontier, or endOffset
+    // if there is none. Skips 64 nodes at a time over empty words.
+    common::offset_t getNextOffset(common::offset_t beginOffset, common::offset_t endOffset) const;
+
+    // Get frontier with no node.
+    static std::unique_ptr<DenseBitsetFrontier> getUnvisitedFrontier(
+        processor::ExecutionContext* context, graph::Graph* graph);
+    // Get frontier with all nodes in mask, or all nodes if mask is null, visited in iteration
+    // INITIAL_VISITED.
+    static std::unique_ptr<DenseBitsetFrontier> getVisitedFrontier(
+        processor::ExecutionContext* context, graph::Graph* graph,
+        common::NodeOffsetMaskMap* maskMap);
+
+private:
+    static uint64_t getNumWords(common::offset_t maxOffset) {
+        return (maxOffset + NUM_BITS_PER_WORD - 1) / NUM_BITS_PER_WORD;
+    }
+
+private:
+    common::table_id_map_t<common::offset_t> nodeMaxOffsetMap;
+    GDSDenseObjectManager<std::atomic<uint64_t>> denseObjects;
+    std::atomic<uint64_t>* curData = nullptr;
+    iteration_t iter = FRONTIER_UNVISITED;
+};
+
 class RYU_API FrontierPair {
 public:
     FrontierPair() { hasActiveNodesForNextIter_.store(false); }
@@ -170,6 +222,9 @@ public:
     iteration_t getCurrentIter() const { return curIter; }
 
     void setActiveNodesForNextIter() { hasActiveNodesForNextIter_.store(true); }
+    bool hasActiveNodesForNextIter() const {
+        return hasActiveNodesForNextIter_.load(std::memory_order_relaxed);
+    }
 
     bool continueNextIter(uint16_t maxIter) {
         return hasActiveNodesForNextIter_.load(std::memory_order_relaxed) &&
@@ -191,6 +246,10 @@ public:
 
     iteration_t getNextFrontierValue(common::offset_t offset);
     bool isActiveOnCurrentFrontier(common::offset_t offset);
+    // Returns the first offset in [beginOffset, endOffset) that is active on the current
+    // frontier, or endOffset if there is none.
+    virtual common::offset_t getNextActiveOffset(common::offset_t beginOffset,
+        common::offset_t endOffset);
     virtual std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() = 0;
 
     virtual GDSDensityState getState() const = 0;
@@ -298,6 +357,36 @@ private:
     std::shared_ptr<DenseFrontier> nextDenseFrontier;
 };
 
+// Frontier pair implementation that uses bitset frontiers. The next frontier is cleared at the
+// beginning of each iteration, so it only fits algorithms where a node is active in an iteration
+// only if it is put in the frontier in the previous iteration, e.g. wcc.
+class RYU_API DenseBitsetFrontierPair : public FrontierPair {
+public:
+    DenseBitsetFrontierPair(std::unique_ptr<DenseBitsetFrontier> curDenseFrontier,
+        std::unique_ptr<DenseBitsetFrontier> nextDenseFrontier);
+
+    void beginNewIterationInternalNoLock() override;
+
+    std::unordered_set<common::offset_t> getActiveNodesOnCurrentFrontier() override {
+        KU_UNREACHABLE;
+    }
+
+    common::offset_t getNextActiveOffset(common::offset_t beginOffset,
+        common::offset_t endOffset) override {
+        return curDenseFrontier->getNextOffset(beginOffset, endOffset);
+    }
+
+    GDSDensityState getState() const override { return GDSDensityState::DENSE; }
+    bool needSwitchToDense(uint64_t) const override { return false; }
+    void switchToDense(processor::ExecutionContext*, graph::Graph*) override {
+        // Do nothing.
+    }
+
+private:
+    std::unique_ptr<DenseBitsetFrontier> curDenseFrontier;
+    std::unique_ptr<DenseBitsetFrontier> nextDenseFrontier;
+};
+
 class SPEdgeCompute : public EdgeCompute {
 public:
     explicit SPEdgeCompute(SPFrontierPair* frontierPair)
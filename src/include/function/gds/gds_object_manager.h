@@ -3,6 +3,8 @@
 #include <atomic>
 #include <vector>
 
+#include "common/exception/buffer_manager.h"
+#include "common/string_format.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/mm_allocator.h"
 
@@ -118,6 +120,18 @@ public:
         array.data[pos].fetch_add(value, order);
     }
 
+    void fetchSub(common::offset_t pos, const T& value,
+        std::memory_order order = std::memory_order_seq_cst) {
+        KU_ASSERT_UNCONDITIONAL(pos < array.size);
+        array.data[pos].fetch_sub(value, order);
+    }
+
+    bool compareExchange(common::offset_t pos, T& expected, const T& desired,
+        std::memory_order order = std::memory_order_seq_cst) {
+        KU_ASSERT_UNCONDITIONAL(pos < array.size);
+        return array.data[pos].compare_exchange_strong(expected, desired, order);
+    }
+
     bool compareExchangeMax(const common::offset_t src, const common::offset_t dest,
         std::memory_order order = std::memory_order_seq_cst) {
         auto srcValue = get(src, order);
@@ -189,7 +203,18 @@ class GDSDenseObjectManager {
 public:
     void allocate(common::table_id_t tableID, common::offset_t maxOffset,
         storage::MemoryManager* mm) {
-        auto buffer = mm->allocateBuffer(false, maxOffset * sizeof(T));
+        const auto size = maxOffset * sizeof(T);
+        std::unique_ptr<storage::MemoryBuffer> buffer;
+        // Dense state is accessed randomly in every iteration, so it is never spilled. Report how
+        // much of it is needed, which is what the buffer pool has to be sized for.
+        try {
+            buffer = mm->allocateBuffer(false, size);
+        } catch (common::BufferManagerException&) {
+            throw common::BufferManagerException(common::stringFormat(
+                "Unable to allocate {} bytes of algorithm state for {} nodes. The buffer pool is "
+                "too small to run the algorithm on this graph.",
+                size, maxOffset));
+        }
         bufferPerTable.insert({tableID, std::move(buffer)});
     }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <utility>
 
 #include "common/enums/extend_direction.h"
@@ -19,6 +20,9 @@ struct FrontierTaskInfo {
     common::ExtendDirection direction;
     EdgeCompute& edgeCompute;
     std::vector<std::string> propertiesToScan;
+    // In pull iterations, bound nodes are the ones that may be put in the next frontier and
+    // `direction` is the direction in which they scan their neighbors.
+    bool pull = false;
 
     FrontierTaskInfo(common::table_id_t srcTableID, common::table_id_t dstTableID,
         catalog::TableCatalogEntry* relGroupEntry, graph::Graph* graph,
@@ -30,7 +34,8 @@ struct FrontierTaskInfo {
     FrontierTaskInfo(const FrontierTaskInfo& other)
         : srcTableID{other.srcTableID}, dstTableID{other.dstTableID},
           relGroupEntry{other.relGroupEntry}, graph{other.graph}, direction{other.direction},
-          edgeCompute{other.edgeCompute}, propertiesToScan{other.propertiesToScan} {}
+          edgeCompute{other.edgeCompute}, propertiesToScan{other.propertiesToScan},
+          pull{other.pull} {}
 
     common::table_id_t getBoundTableID() const;
     common::table_id_t getNbrTableID() const;
@@ -40,9 +45,13 @@ struct FrontierTaskInfo {
 struct FrontierTaskSharedState {
     FrontierMorselDispatcher morselDispatcher;
     FrontierPair& frontierPair;
+    // Statistics of the task, used to choose between push and pull iterations.
+    std::atomic<uint64_t> numActiveNodes;
+    std::atomic<uint64_t> numScannedRels;
 
     FrontierTaskSharedState(uint64_t maxNumThreads, FrontierPair& frontierPair)
-        : morselDispatcher{maxNumThreads}, frontierPair{frontierPair} {}
+        : morselDispatcher{maxNumThreads}, frontierPair{frontierPair}, numActiveNodes{0},
+          numScannedRels{0} {}
     DELETE_COPY_AND_MOVE(FrontierTaskSharedState);
 };
 
@@ -52,10 +61,17 @@ public:
         std::shared_ptr<FrontierTaskSharedState> sharedState)
         : Task{maxNumThreads}, info{info}, sharedState{std::move(sharedState)} {}
 
+    FrontierTaskSharedState* getSharedState() const { return sharedState.get(); }
+
     void run() override;
 
     void runSparse();
 
+    std::string getTraceName() const override { return "FrontierTask"; }
+
+private:
+    void runPull();
+
 private:
     FrontierTaskInfo info;
     std::shared_ptr<FrontierTaskSharedState> sharedState;
@@ -97,6 +113,8 @@ public:
 
     void runSparse();
 
+    std::string getTraceName() const override { return "VertexComputeTask"; }
+
 private:
     VertexComputeTaskInfo info;
     std::shared_ptr<VertexComputeTaskSharedState> sharedState;
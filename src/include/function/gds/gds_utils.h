@@ -17,11 +17,14 @@ public:
     static void runFTSEdgeCompute(processor::ExecutionContext* context, GDSComputeState& compState,
         graph::Graph* graph, common::ExtendDirection extendDirection,
         const std::vector<std::string>& propertiesToScan);
-    // Run edge compute for recursive join.
+    // Run edge compute for recursive join. The traversal stops early once the nodes activated in
+    // iterations from minOutputIteration on add up to numOutputsToStop, which is only valid if
+    // each activation is known to produce at least one output row.
     static void runRecursiveJoinEdgeCompute(processor::ExecutionContext* context,
         GDSComputeState& compState, graph::Graph* graph, common::ExtendDirection extendDirection,
         uint64_t maxIteration, common::NodeOffsetMaskMap* outputNodeMask,
-        const std::vector<std::string>& propertiesToScan);
+        const std::vector<std::string>& propertiesToScan, uint64_t minOutputIteration = 0,
+        common::offset_t numOutputsToStop = common::INVALID_LIMIT);
 
     // Run vertex compute without property scan
     static void runVertexCompute(processor::ExecutionContext* context, GDSDensityState densityState,
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+
+#include "gds_state.h"
+
+namespace ryu {
+namespace function {
+
+using msbfs_lanes_t = uint64_t;
+
+// Multi-source BFS (MS-BFS, Then et al., "The More the Merrier", VLDB 2015). BFS's from up to 64
+// sources share one traversal, with one lane (bit) per source. Each node keeps the lanes of the
+// sources that have reached it and the lanes of the sources that reached it in the last
+// iteration, so that a node in the frontier extends all its lanes to a neighbor at once.
+class MSBFSLanes : public GDSAuxiliaryState {
+public:
+    static constexpr uint64_t MAX_NUM_SOURCES = 64;
+
+    MSBFSLanes(const common::table_id_map_t<common::offset_t>& nodeMaxOffsetMap,
+        storage::MemoryManager* mm);
+
+    // Assigns the next lane to the source.
+    void initSource(common::nodeID_t sourceNodeID) override;
+    void beginFrontierCompute(common::table_id_t curTableID,
+        common::table_id_t nextTableID) override;
+    void switchToDense(processor::ExecutionContext*, graph::Graph*) override {}
+
+    // Makes the lanes of the next frontier current and clears the next frontier. Must be called
+    // before each iteration.
+    void beginNewIteration();
+    iteration_t getCurrentIter() const { return curIter; }
+
+    msbfs_lanes_t getCurrentLanes(common::offset_t offset) const {
+        return curLanes[offset].load(std::memory_order_relaxed);
+    }
+    // Adds `lanes` to the node in the next frontier. Returns the lanes that reach the node for
+    // the first time.
+    msbfs_lanes_t addLanesToNextFrontier(common::offset_t offset, msbfs_lanes_t lanes);
+
+    void pinNextTableID(common::table_id_t tableID);
+    msbfs_lanes_t getNextLanes(common::offset_t offset) const {
+        return nextLanes[offset].load(std::memory_order_relaxed);
+    }
+
+    // Compute state running a multi-source BFS. Sources are added with initSource.
+    static std::unique_ptr<GDSComputeState> getComputeState(processor::ExecutionContext* context,
+        graph::Graph* graph);
+
+private:
+    common::table_id_map_t<common::offset_t> nodeMaxOffsetMap;
+    GDSDenseObjectManager<std::atomic<msbfs_lanes_t>> seenObjects;
+    // Lanes of the current and next frontier. Swapped at the beginning of each iteration.
+    std::array<GDSDenseObjectManager<std::atomic<msbfs_lanes_t>>, 2> laneObjects;
+    common::idx_t curLanesIdx = 1;
+    iteration_t curIter = 0;
+    uint64_t numSources = 0;
+
+    std::atomic<msbfs_lanes_t>* curLanes = nullptr;
+    std::atomic<msbfs_lanes_t>* nextLanes = nullptr;
+    std::atomic<msbfs_lanes_t>* nextSeen = nullptr;
+};
+
+class MSBFSEdgeCompute : public EdgeCompute {
+public:
+    explicit MSBFSEdgeCompute(MSBFSLanes* lanes) : lanes{lanes} {}
+
+    std::vector<common::nodeID_t> edgeCompute(common::nodeID_t boundNodeID,
+        graph::NbrScanState::Chunk& resultChunk, bool) override;
+
+    std::unique_ptr<EdgeCompute> copy() override {
+        return std::make_unique<MSBFSEdgeCompute>(lanes);
+    }
+
+private:
+    MSBFSLanes* lanes;
+};
+
+} // namespace function
+} // namespace ryu
@@ -4,6 +4,7 @@
 #include "common/enums/extend_direction.h"
 #include "common/enums/path_semantic.h"
 #include "function/gds/gds_state.h"
+#include "function/gds/multi_source_bfs.h"
 #include "graph/graph_entry.h"
 #include "processor/operator/recursive_extend_shared_state.h"
 #include "rj_output_writer.h"
@@ -54,6 +55,32 @@ public:
         const RJBindData& bindData, GDSComputeState& computeState, common::nodeID_t sourceNodeID,
         processor::RecursiveExtendSharedState* sharedState) = 0;
 
+    // Algorithms that support it run from a batch of sources at once with a multi-source BFS.
+    // The output writer writes, for the nodes in the next frontier of `lanes`, the results of the
+    // sources that reach them in the current iteration.
+    virtual bool supportMultiSource() const { return false; }
+    virtual std::unique_ptr<RJOutputWriter> getMultiSourceOutputWriter(
+        processor::ExecutionContext* /*context*/, MSBFSLanes& /*lanes*/,
+        std::vector<common::nodeID_t> /*sourceNodeIDs*/,
+        processor::RecursiveExtendSharedState* /*sharedState*/) {
+        KU_UNREACHABLE;
+    }
+
+    // Algorithms that support it search from both ends when there is a single destination. The
+    // returned compute state is the one of the search from the source, on which getOutputWriter
+    // is called as for a single source search.
+    virtual bool supportBidirectional() const { return false; }
+    virtual std::unique_ptr<GDSComputeState> runBidirectional(
+        processor::ExecutionContext* /*context*/, const RJBindData& /*bindData*/,
+        processor::RecursiveExtendSharedState* /*sharedState*/, common::nodeID_t /*sourceNodeID*/,
+        common::nodeID_t /*dstNodeID*/, const std::vector<std::string>& /*propertiesToScan*/) {
+        KU_UNREACHABLE;
+    }
+
+    // Algorithms that write a row for many equivalent results write their number in an extra
+    // UINT64 column after the result columns. It becomes the multiplicity of the row when scanned.
+    virtual bool writeMultiplicity() const { return false; }
+
     virtual std::unique_ptr<RJAlgorithm> copy() const = 0;
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <unordered_set>
 
@@ -136,20 +137,24 @@ inline void Hash::operation(const float& key, common::hash_t& result) {
     }
 }
 
+// Hashes of strings are persisted in the hash index of string primary keys, so the hash of a string
+// must not change. Blocks are loaded with memcpy, which compiles to a single unaligned load instead
+// of dereferencing a misaligned pointer.
 template<>
 inline void Hash::operation(const std::string_view& key, common::hash_t& result) {
     common::hash_t hashValue = 0;
-    auto data64 = reinterpret_cast<const uint64_t*>(key.data());
-    for (size_t i = 0u; i < key.size() / 8; i++) {
-        auto blockHash = ryu::function::murmurhash64(*(data64 + i));
-        hashValue = ryu::function::combineHashScalar(hashValue, blockHash);
+    const auto numBlocks = key.size() / 8;
+    for (size_t i = 0u; i < numBlocks; i++) {
+        uint64_t block = 0;
+        memcpy(&block, key.data() + i * 8, sizeof(block));
+        hashValue = combineHashScalar(hashValue, murmurhash64(block));
     }
+    // The remaining bytes are sign-extended, as they have always been.
     uint64_t last = 0;
     for (size_t i = 0u; i < key.size() % 8; i++) {
-        last |= static_cast<uint64_t>(key[key.size() / 8 * 8 + i]) << i * 8;
+        last |= static_cast<uint64_t>(key[numBlocks * 8 + i]) << i * 8;
     }
-    hashValue = ryu::function::combineHashScalar(hashValue, ryu::function::murmurhash64(last));
-    result = hashValue;
+    result = combineHashScalar(hashValue, murmurhash64(last));
 }
 
 template<>
@@ -11,5 +11,14 @@ struct InternalIDCreationFunction {
     static function_set getFunctionSet();
 };
 
+// Whether the node is in the given partition of the node groups of its table, which are assigned
+// to partitions round-robin. Scans filtered by it skip the node groups of other partitions, so
+// the partitions of a query can run on separate instances or read replicas of a database.
+struct NodeGroupPartitionFunction {
+    static constexpr const char* name = "node_group_partition";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace ryu
@@ -81,6 +81,9 @@ struct RYU_API ScalarFunction : public ScalarOrAggregateFunction {
         const std::vector<common::SelectionVector*>& paramSelVectors, common::ValueVector& result,
         common::SelectionVector* resultSelVector, void* dataPtr = nullptr) {
         KU_ASSERT(params.size() == 3);
+        if constexpr (std::is_same_v<RESULT_TYPE, common::list_entry_t>) {
+            reserveListResult(params, result);
+        }
         TernaryFunctionExecutor::executeSwitch<A_TYPE, B_TYPE, C_TYPE, RESULT_TYPE, FUNC,
             TernaryListFunctionWrapper>(*params[0], paramSelVectors[0], *params[1],
             paramSelVectors[1], *params[2], paramSelVectors[2], result, resultSelVector, dataPtr);
@@ -112,6 +115,9 @@ struct RYU_API ScalarFunction : public ScalarOrAggregateFunction {
         const std::vector<common::SelectionVector*>& paramSelVectors, common::ValueVector& result,
         common::SelectionVector* resultSelVector, void* dataPtr = nullptr) {
         KU_ASSERT(params.size() == 2);
+        if constexpr (std::is_same_v<RESULT_TYPE, common::list_entry_t>) {
+            reserveListResult(params, result);
+        }
         BinaryFunctionExecutor::executeSwitch<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC,
             BinaryListStructFunctionWrapper>(*params[0], paramSelVectors[0], *params[1],
             paramSelVectors[1], result, resultSelVector, dataPtr);
@@ -207,6 +213,9 @@ struct RYU_API ScalarFunction : public ScalarOrAggregateFunction {
         const std::vector<common::SelectionVector*>& paramSelVectors, common::ValueVector& result,
         common::SelectionVector* resultSelVector, void* dataPtr) {
         KU_ASSERT(params.size() == 1);
+        if constexpr (std::is_same_v<RESULT_TYPE, common::list_entry_t>) {
+            reserveListResult(params, result);
+        }
         EXECUTOR::template executeSwitch<OPERAND_TYPE, RESULT_TYPE, FUNC,
             UnaryNestedTypeFunctionWrapper>(*params[0], paramSelVectors[0], result, resultSelVector,
             dataPtr);
@@ -245,6 +254,27 @@ struct RYU_API ScalarFunction : public ScalarOrAggregateFunction {
     virtual std::unique_ptr<ScalarFunction> copy() const {
         return std::make_unique<ScalarFunction>(*this);
     }
+
+private:
+    // Most list functions return at most the elements of their list parameters plus one element
+    // per row, so the data vector of the result is sized for that upfront instead of growing while
+    // lists are added row by row.
+    static void reserveListResult(const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result) {
+        if (result.dataType.getPhysicalType() != common::PhysicalTypeID::LIST) {
+            return;
+        }
+        auto numValues = result.state->getSelVector().getSelSize();
+        for (auto& param : params) {
+            auto physicalType = param->dataType.getPhysicalType();
+            if (physicalType == common::PhysicalTypeID::LIST ||
+                physicalType == common::PhysicalTypeID::ARRAY) {
+                numValues += common::ListVector::getDataVectorSize(param.get());
+            }
+        }
+        result.resetAuxiliaryBuffer();
+        common::ListVector::reserveDataVector(&result, numValues);
+    }
 };
 
 } // namespace function
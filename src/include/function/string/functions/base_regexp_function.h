@@ -1,12 +1,22 @@
 #pragma once
 
+#include <cctype>
+#include <optional>
 #include <regex>
 
 #include "common/vector/value_vector.h"
+#include "function/function.h"
 
 namespace ryu {
 namespace function {
 
+// A pattern without regular expression syntax apart from ^ and $ anchors, e.g. ^abc or a\.b.
+struct RegexpLiteral {
+    std::string text;
+    bool anchoredAtStart = false;
+    bool anchoredAtEnd = false;
+};
+
 struct BaseRegexpOperation {
     static inline std::string parseCypherPattern(const std::string& pattern) {
         // Cypher parses escape characters with 2 backslash eg. for expressing '.' requires '\\.'
@@ -19,6 +29,64 @@ struct BaseRegexpOperation {
         common::ValueVector& valueVector) {
         common::StringVector::addString(&valueVector, ryString, value.data(), value.length());
     }
+
+    // Returns the literal a parsed pattern matches, if it only matches a literal.
+    static inline std::optional<RegexpLiteral> getLiteral(const std::string& pattern) {
+        RegexpLiteral literal;
+        for (auto i = 0u; i < pattern.size(); i++) {
+            auto c = pattern[i];
+            if (c == '\\') {
+                // Escaped punctuation is literal, escaped letters and digits are classes.
+                if (i + 1 == pattern.size() || std::isalnum(static_cast<uint8_t>(pattern[i + 1]))) {
+                    return std::nullopt;
+                }
+                literal.text += pattern[++i];
+            } else if (c == '^' && i == 0) {
+                literal.anchoredAtStart = true;
+            } else if (c == '$' && i + 1 == pattern.size()) {
+                literal.anchoredAtEnd = true;
+            } else if (std::string_view{".^$|?*+()[]{}"}.find(c) != std::string_view::npos) {
+                return std::nullopt;
+            } else {
+                literal.text += c;
+            }
+        }
+        return literal;
+    }
+};
+
+struct RegexpLiteralBindData : public FunctionBindData {
+    std::string literal;
+    // Points into literal.
+    common::ku_string_t literalStr;
+
+    RegexpLiteralBindData(common::logical_type_vec_t paramTypes, std::string literal)
+        : FunctionBindData{std::move(paramTypes), common::LogicalType::BOOL()},
+          literal{std::move(literal)} {
+        literalStr.setFromRawStr(this->literal.data(), this->literal.size());
+    }
+
+    std::unique_ptr<FunctionBindData> copy() const override {
+        return std::make_unique<RegexpLiteralBindData>(copyVector(paramTypes), literal);
+    }
+};
+
+struct RegexpLiteralEquals {
+    static void operation(common::ku_string_t& left, common::ku_string_t& right,
+        uint8_t& result) {
+        result = left == right;
+    }
+};
+
+// Matches a string against the literal of a pattern with a plain string function.
+template<typename OP>
+struct RegexpLiteralMatch {
+    static void operation(common::ku_string_t& left, common::ku_string_t& /*right*/,
+        uint8_t& result, common::ValueVector& /*leftValueVector*/,
+        common::ValueVector& /*rightValueVector*/, common::ValueVector& /*resultValueVector*/,
+        void* dataPtr) {
+        OP::operation(left, reinterpret_cast<RegexpLiteralBindData*>(dataPtr)->literalStr, result);
+    }
 };
 
 } // namespace function
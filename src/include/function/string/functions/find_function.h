@@ -15,8 +15,9 @@ struct Find {
             result = 1;
         } else if (right.len > left.len) {
             result = 0;
+        } else {
+            result = Find::find(left.getData(), left.len, right.getData(), right.len) + 1;
         }
-        result = Find::find(left.getData(), left.len, right.getData(), right.len) + 1;
     }
 
 private:
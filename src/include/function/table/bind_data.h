@@ -25,7 +25,8 @@ struct RYU_API TableFuncBindData {
     TableFuncBindData(const TableFuncBindData& other)
         : columns{other.columns}, numRows{other.numRows},
           optionalParams{other.optionalParams == nullptr ? nullptr : other.optionalParams->copy()},
-          columnSkips{other.columnSkips}, columnPredicates{copyVector(other.columnPredicates)} {}
+          columnSkips{other.columnSkips}, columnPredicates{copyVector(other.columnPredicates)},
+          limitNum{other.limitNum} {}
     TableFuncBindData& operator=(const TableFuncBindData& other) = delete;
     virtual ~TableFuncBindData() = default;
 
@@ -46,6 +47,11 @@ struct RYU_API TableFuncBindData {
         return columnPredicates;
     }
 
+    // The number of rows the query reads at most from the function. Functions may use it to stop
+    // producing rows early, the limit is still applied on top of the function.
+    void setLimitNum(common::offset_t limit) { limitNum = limit; }
+    common::offset_t getLimitNum() const { return limitNum; }
+
     virtual bool getIgnoreErrorsOption() const;
 
     virtual std::unique_ptr<TableFuncBindData> copy() const;
@@ -63,6 +69,7 @@ struct RYU_API TableFuncBindData {
 protected:
     std::vector<bool> columnSkips;
     std::vector<storage::ColumnPredicateSet> columnPredicates;
+    common::offset_t limitNum = common::INVALID_LIMIT;
 };
 
 } // namespace function
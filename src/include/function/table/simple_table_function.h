@@ -128,6 +128,18 @@ struct BMInfoFunction final {
     static function_set getFunctionSet();
 };
 
+struct MetricsFunction final {
+    static constexpr const char* name = "METRICS";
+
+    static function_set getFunctionSet();
+};
+
+struct QueryMemoryUsageFunction final {
+    static constexpr const char* name = "QUERY_MEMORY_USAGE";
+
+    static function_set getFunctionSet();
+};
+
 struct FileInfoFunction final {
     static constexpr const char* name = "FILE_INFO";
 
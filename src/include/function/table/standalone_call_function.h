@@ -29,5 +29,65 @@ struct DropProjectedGraphFunction {
     static function_set getFunctionSet();
 };
 
+struct CreatePropertyIndexFunction {
+    static constexpr const char* name = "CREATE_PROPERTY_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+struct DropPropertyIndexFunction {
+    static constexpr const char* name = "DROP_PROPERTY_INDEX";
+
+    static function_set getFunctionSet();
+};
+
+// Recomputes the stats of node tables from a sample of their node groups.
+struct AnalyzeFunction {
+    static constexpr const char* name = "ANALYZE";
+
+    static function_set getFunctionSet();
+};
+
+// Reads the pages of a table into the buffer pool, as far as they fit into its free memory.
+struct PrewarmFunction {
+    static constexpr const char* name = "PREWARM";
+
+    static function_set getFunctionSet();
+};
+
+// Copies the data file and the WAL of the database to the given path, which can be opened as a
+// database restoring the state of all commits up to the copy of the WAL.
+struct SnapshotDatabaseFunction {
+    static constexpr const char* name = "SNAPSHOT_DATABASE";
+
+    static function_set getFunctionSet();
+};
+
+// Stores the result of a query in a node table, which answers the query until the tables it reads
+// are written to, see main::MaterializedViews.
+struct CreateMaterializedViewFunction {
+    static constexpr const char* name = "CREATE_MATERIALIZED_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+struct RefreshMaterializedViewFunction {
+    static constexpr const char* name = "REFRESH_MATERIALIZED_VIEW";
+
+    static function_set getFunctionSet();
+};
+
+struct BeginMaterializedViewRefreshFunction {
+    static constexpr const char* name = "_BEGIN_MATERIALIZED_VIEW_REFRESH";
+
+    static function_set getFunctionSet();
+};
+
+struct FinishMaterializedViewRefreshFunction {
+    static constexpr const char* name = "_FINISH_MATERIALIZED_VIEW_REFRESH";
+
+    static function_set getFunctionSet();
+};
+
 } // namespace function
 } // namespace ryu
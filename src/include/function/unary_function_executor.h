@@ -140,6 +140,14 @@ struct UnaryFunctionExecutor {
         const bool operandIsUnfiltered = operandSelVector->isUnfiltered();
         const bool resultIsUnfiltered = resultSelVector->isUnfiltered();
 
+        if (noNullsGuaranteed && operandIsUnfiltered && resultIsUnfiltered) {
+            // Positions are the loop index, so simple operations are vectorized.
+            for (auto i = 0u; i < operandSelVector->getSelSize(); i++) {
+                executeOnValue<OPERAND_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(operand, i, result, i,
+                    dataPtr);
+            }
+            return;
+        }
         for (auto i = 0u; i < operandSelVector->getSelSize(); i++) {
             const auto [operandPos, resultPos] = getSelectedPos(i, operandSelVector,
                 resultSelVector, operandIsUnfiltered, resultIsUnfiltered);
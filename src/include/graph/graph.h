@@ -10,6 +10,9 @@
 #include <span>
 
 namespace ryu {
+namespace common {
+class NodeOffsetMaskMap;
+} // namespace common
 namespace catalog {
 class TableCatalogEntry;
 } // namespace catalog
@@ -94,6 +97,9 @@ public:
             return std::span(reinterpret_cast<const T*>(propertyVectors[propertyIndex]->getData()),
                 nodeIDs.size());
         }
+        bool isNull(size_t propertyIndex, size_t idx) const {
+            return propertyVectors[propertyIndex]->isNull(idx);
+        }
 
     private:
         RYU_API Chunk(std::span<const common::nodeID_t> nodeIDs,
@@ -181,6 +187,9 @@ public:
 
     virtual NativeGraphEntry* getGraphEntry() = 0;
 
+    // Restricts neighbors to the nodes in the mask.
+    virtual void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) = 0;
+
     // Get id for all node tables.
     virtual std::vector<common::table_id_t> getNodeTableIDs() const = 0;
 
@@ -25,6 +25,8 @@ struct NativeGraphEntryTableInfo {
 struct RYU_API NativeGraphEntry {
     std::vector<NativeGraphEntryTableInfo> nodeInfos;
     std::vector<NativeGraphEntryTableInfo> relInfos;
+    // If algorithms run on an InMemGraph instead of an OnDiskGraph.
+    bool inMemory = false;
 
     NativeGraphEntry() = default;
     NativeGraphEntry(std::vector<catalog::TableCatalogEntry*> nodeEntries,
@@ -43,7 +45,7 @@ struct RYU_API NativeGraphEntry {
 
 private:
     NativeGraphEntry(const NativeGraphEntry& other)
-        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos} {}
+        : nodeInfos{other.nodeInfos}, relInfos{other.relInfos}, inMemory{other.inMemory} {}
 };
 
 } // namespace graph
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+
+#include "common/enums/rel_direction.h"
+#include "on_disk_graph.h"
+
+namespace ryu {
+namespace graph {
+
+// Adjacency of one rel table in one direction in CSR format, together with the rel properties
+// scanned with it. Node offsets are stored as uint32_t, so adjacencies of tables with more than
+// UINT32_MAX nodes or rels are not materialized.
+struct InMemAdjList {
+    struct PropertyColumn {
+        common::LogicalType type;
+        uint32_t numBytesPerValue = 0;
+        std::vector<uint8_t> data;
+        // Empty if the column has no null.
+        std::vector<bool> nulls;
+    };
+
+    common::table_id_t nbrTableID = common::INVALID_TABLE_ID;
+    // Rels of bound node i are at positions [csrOffsets[i], csrOffsets[i + 1]).
+    std::vector<uint32_t> csrOffsets;
+    std::vector<uint32_t> nbrOffsets;
+    std::vector<PropertyColumn> propertyColumns;
+
+    uint32_t getNumRels(common::offset_t boundOffset) const {
+        return csrOffsets[boundOffset + 1] - csrOffsets[boundOffset];
+    }
+};
+
+class InMemGraphNbrScanState final : public NbrScanState {
+    friend class InMemGraph;
+
+public:
+    InMemGraphNbrScanState(main::ClientContext* context, const catalog::TableCatalogEntry& entry,
+        common::oid_t relTableID, common::table_id_t nbrTableID,
+        std::vector<std::string> relProperties, bool randomLookup);
+
+    Chunk getChunk() override {
+        return createChunk(std::span(nbrNodes.get(), common::DEFAULT_VECTOR_CAPACITY), selVector,
+            std::span(propertyVectors));
+    }
+    bool next() override;
+
+private:
+    void startScan(const InMemAdjList* adjList_, common::offset_t boundOffset);
+    void scanBatch();
+
+private:
+    const catalog::TableCatalogEntry& entry;
+    common::oid_t relTableID;
+    common::table_id_t nbrTableID;
+    common::table_id_t srcTableID;
+    common::table_id_t dstTableID;
+    std::vector<std::string> relProperties;
+    bool randomLookup;
+    // Created on first use if an adjacency could not be materialized.
+    std::unique_ptr<NbrScanState> onDiskScanState;
+    // Cached per direction, so that the lock of the graph is only taken once per scan state.
+    std::array<const InMemAdjList*, 2> adjLists{};
+    std::array<bool, 2> adjListsFetched{};
+
+    const InMemAdjList* adjList = nullptr;
+    uint32_t curPos = 0;
+    uint32_t endPos = 0;
+    std::unique_ptr<common::nodeID_t[]> nbrNodes;
+    common::SelectionVector selVector;
+    std::vector<std::shared_ptr<common::ValueVector>> propertyVectors;
+};
+
+// Materializes the adjacencies of a projected graph in memory, so that algorithms which scan the
+// same rels in many iterations don't go through the storage layer each time.
+// Each adjacency is built from the on disk graph the first time it is scanned, with the rel
+// predicates and the node mask of the on disk graph applied. Vertex scans and everything else are
+// served by the on disk graph.
+class RYU_API InMemGraph final : public Graph {
+public:
+    InMemGraph(main::ClientContext* context, NativeGraphEntry entry);
+
+    NativeGraphEntry* getGraphEntry() override { return onDiskGraph.getGraphEntry(); }
+
+    void setNodeOffsetMask(common::NodeOffsetMaskMap* maskMap) override {
+        onDiskGraph.setNodeOffsetMask(maskMap);
+    }
+
+    std::vector<common::table_id_t> getNodeTableIDs() const override {
+        return onDiskGraph.getNodeTableIDs();
+    }
+
+    common::table_id_map_t<common::offset_t> getMaxOffsetMap(
+        transaction::Transaction* transaction) const override {
+        return onDiskGraph.getMaxOffsetMap(transaction);
+    }
+
+    common::offset_t getMaxOffset(transaction::Transaction* transaction,
+        common::table_id_t id) const override {
+        return onDiskGraph.getMaxOffset(transaction, id);
+    }
+
+    common::offset_t getNumNodes(transaction::Transaction* transaction) const override {
+        return onDiskGraph.getNumNodes(transaction);
+    }
+
+    std::vector<GraphRelInfo> getRelInfos(common::table_id_t srcTableID) override {
+        return onDiskGraph.getRelInfos(srcTableID);
+    }
+
+    std::unique_ptr<NbrScanState> prepareRelScan(const catalog::TableCatalogEntry& entry,
+        common::oid_t relTableID, common::table_id_t nbrTableID,
+        std::vector<std::string> relProperties, bool randomLookUp = true) override;
+
+    EdgeIterator scanFwd(common::nodeID_t nodeID, NbrScanState& state) override;
+    EdgeIterator scanBwd(common::nodeID_t nodeID, NbrScanState& state) override;
+
+    std::unique_ptr<VertexScanState> prepareVertexScan(catalog::TableCatalogEntry* tableEntry,
+        const std::vector<std::string>& propertiesToScan) override {
+        return onDiskGraph.prepareVertexScan(tableEntry, propertiesToScan);
+    }
+    VertexIterator scanVertices(common::offset_t beginOffset, common::offset_t endOffsetExclusive,
+        VertexScanState& state) override {
+        return onDiskGraph.scanVertices(beginOffset, endOffsetExclusive, state);
+    }
+
+private:
+    EdgeIterator scan(common::nodeID_t nodeID, InMemGraphNbrScanState& state,
+        common::RelDataDirection direction);
+    // Returns nullptr if the adjacency can't be materialized.
+    const InMemAdjList* getAdjList(const InMemGraphNbrScanState& state,
+        common::RelDataDirection direction);
+    std::unique_ptr<InMemAdjList> buildAdjList(const InMemGraphNbrScanState& state,
+        common::RelDataDirection direction);
+
+private:
+    main::ClientContext* context;
+    OnDiskGraph onDiskGraph;
+    std::mutex mtx;
+    // Keyed by rel table, direction and scanned properties.
+    std::unordered_map<std::string, std::unique_ptr<InMemAdjList>> adjLists;
+};
+
+} // namespace graph
+} // namespace ryu
@@ -41,11 +41,13 @@ struct ParsedNativeGraphTableInfo {
 struct RYU_API ParsedNativeGraphEntry : ParsedGraphEntry {
     std::vector<ParsedNativeGraphTableInfo> nodeInfos;
     std::vector<ParsedNativeGraphTableInfo> relInfos;
+    // If algorithms run on an in-memory CSR copy of the graph.
+    bool inMemory;
 
     ParsedNativeGraphEntry(std::vector<ParsedNativeGraphTableInfo> nodeInfos,
-        std::vector<ParsedNativeGraphTableInfo> relInfos)
+        std::vector<ParsedNativeGraphTableInfo> relInfos, bool inMemory = false)
         : ParsedGraphEntry{GraphEntryType::NATIVE}, nodeInfos{std::move(nodeInfos)},
-          relInfos{std::move(relInfos)} {}
+          relInfos{std::move(relInfos)}, inMemory{inMemory} {}
 };
 
 struct RYU_API ParsedCypherGraphEntry : ParsedGraphEntry {
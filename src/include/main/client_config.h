@@ -13,6 +13,8 @@ struct ClientConfigDefault {
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
     static constexpr uint32_t VAR_LENGTH_MAX_DEPTH = 30;
     static constexpr uint64_t SPARSE_FRONTIER_THRESHOLD = 1000;
+    // 0 means weighted shortest paths are computed with Bellman-Ford by default.
+    static constexpr double WSP_DELTA = 0;
     static constexpr bool ENABLE_SEMI_MASK = true;
     static constexpr bool ENABLE_ZONE_MAP = true;
     static constexpr bool ENABLE_PROGRESS_BAR = false;
@@ -23,6 +25,12 @@ struct ClientConfigDefault {
     static constexpr uint64_t WARNING_LIMIT = 8 * 1024;
     static constexpr bool ENABLE_PLAN_OPTIMIZER = true;
     static constexpr bool ENABLE_INTERNAL_CATALOG = false;
+    static constexpr bool ENABLE_ADAPTIVE_JOIN_ORDER = false;
+    static constexpr uint32_t SORT_STRING_PREFIX_LENGTH = 12;
+    static constexpr bool ENABLE_HARDWARE_COUNTERS = false;
+    static constexpr uint64_t SLOW_QUERY_THRESHOLD_IN_MS = 1000;
+    static constexpr bool AUTO_ANALYZE = false;
+    static constexpr bool ENABLE_QUERY_RESULT_CACHE = false;
 };
 
 struct ClientConfig {
@@ -42,6 +50,8 @@ struct ClientConfig {
     uint32_t varLengthMaxDepth = ClientConfigDefault::VAR_LENGTH_MAX_DEPTH;
     // Threshold determines when to switch from sparse frontier to dense frontier
     uint64_t sparseFrontierThreshold = ClientConfigDefault::SPARSE_FRONTIER_THRESHOLD;
+    // Bucket width of delta-stepping for weighted shortest paths. 0 disables delta-stepping.
+    double wspDelta = ClientConfigDefault::WSP_DELTA;
     // If using progress bar.
     bool enableProgressBar = ClientConfigDefault::ENABLE_PROGRESS_BAR;
     // time before displaying progress bar
@@ -57,6 +67,27 @@ struct ClientConfig {
     bool enablePlanOptimizer = ClientConfigDefault::ENABLE_PLAN_OPTIMIZER;
     // If use internal catalog during binding
     bool enableInternalCatalog = ClientConfigDefault::ENABLE_INTERNAL_CATALOG;
+    // If re-planning read-only statements whose hash join build sides turn out far larger or
+    // smaller than estimated.
+    bool enableAdaptiveJoinOrder = ClientConfigDefault::ENABLE_ADAPTIVE_JOIN_ORDER;
+    // Number of leading bytes of a string ORDER BY key encoded into the sort key. Strings sharing
+    // a longer prefix are compared in full.
+    uint32_t sortStringPrefixLength = ClientConfigDefault::SORT_STRING_PREFIX_LENGTH;
+    // If PROFILE also reports cpu cycles, instructions and LLC misses of each operator.
+    bool enableHardwareCounters = ClientConfigDefault::ENABLE_HARDWARE_COUNTERS;
+    // If not empty, the timeline of each query's tasks is written to this file as a Chrome trace.
+    std::string queryTracePath;
+    // If not empty, queries running longer than the slow query threshold are logged to this file
+    // with their profiled plans. All queries are profiled then.
+    std::string slowQueryLogPath;
+    // Execution time (milliseconds) from which a query is logged to the slow query log.
+    uint64_t slowQueryThresholdInMS = ClientConfigDefault::SLOW_QUERY_THRESHOLD_IN_MS;
+    // If the stats of node tables are recomputed with ANALYZE once many of their rows have been
+    // updated or deleted since their last ANALYZE.
+    bool autoAnalyze = ClientConfigDefault::AUTO_ANALYZE;
+    // If the results of read-only queries are cached and reused while the tables they read don't
+    // change, see QueryResultCache.
+    bool enableQueryResultCache = ClientConfigDefault::ENABLE_QUERY_RESULT_CACHE;
 };
 
 } // namespace main
@@ -17,9 +17,11 @@
 namespace ryu {
 namespace common {
 class RandomEngine;
+class ReoptimizeException;
 class TaskScheduler;
 class ProgressBar;
 class VirtualFileSystem;
+class QueryTracer;
 } // namespace common
 
 namespace catalog {
@@ -40,6 +42,7 @@ class StorageManager;
 
 namespace processor {
 class ImportDB;
+class ResultStream;
 class WarningContext;
 } // namespace processor
 
@@ -150,10 +153,14 @@ public:
     struct QueryConfig {
         QueryResultType resultType;
         common::ArrowResultConfig arrowConfig;
+        std::shared_ptr<processor::ResultStream> resultStream;
 
         QueryConfig() : resultType{QueryResultType::FTABLE}, arrowConfig{} {}
         QueryConfig(QueryResultType resultType, common::ArrowResultConfig arrowConfig)
             : resultType{resultType}, arrowConfig{arrowConfig} {}
+        explicit QueryConfig(std::shared_ptr<processor::ResultStream> resultStream)
+            : resultType{QueryResultType::STREAM}, arrowConfig{},
+              resultStream{std::move(resultStream)} {}
     };
 
     std::unique_ptr<QueryResult> query(std::string_view queryStatement,
@@ -163,6 +170,8 @@ public:
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> inputParams,
         std::optional<uint64_t> queryID = std::nullopt);
+    std::unique_ptr<QueryResult> executeBatch(PreparedStatement* preparedStatement,
+        std::vector<std::unordered_map<std::string, std::unique_ptr<common::Value>>> batch);
 
     struct TransactionHelper {
         enum class TransactionCommitAction : uint8_t {
@@ -197,7 +206,8 @@ private:
 
     PrepareResult prepareNoLock(std::shared_ptr<parser::Statement> parsedStatement,
         bool shouldCommitNewTransaction,
-        std::unordered_map<std::string, std::shared_ptr<common::Value>> inputParams = {});
+        std::unordered_map<std::string, std::shared_ptr<common::Value>> inputParams = {},
+        const planner::CardinalityFeedback* cardinalityFeedback = nullptr);
 
     template<typename T, typename... Args>
     std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
@@ -209,13 +219,39 @@ private:
         return executeWithParams(preparedStatement, std::move(params), args...);
     }
 
+    std::unique_ptr<QueryResult> executeWithParamsNoLock(PreparedStatement* preparedStatement,
+        const std::unordered_map<std::string, std::unique_ptr<common::Value>>& inputParams,
+        std::optional<uint64_t> queryID = std::nullopt);
     std::unique_ptr<QueryResult> executeNoLock(PreparedStatement* preparedStatement,
         CachedPreparedStatement* cachedPreparedStatement,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
+    // Plans a statement again with the cardinality observed by its failed execution and executes
+    // it from scratch.
+    std::unique_ptr<QueryResult> reoptimizeNoLock(const PreparedStatement& preparedStatement,
+        const CachedPreparedStatement& cachedStatement,
+        const common::ReoptimizeException& exception, std::optional<uint64_t> queryID,
+        QueryConfig config);
     std::unique_ptr<QueryResult> queryNoLock(std::string_view query,
         std::optional<uint64_t> queryID = std::nullopt, QueryConfig config = {});
 
     bool canExecuteWriteQuery() const;
+    // Runs ANALYZE on the node tables whose stats have gone stale if auto analyze is enabled and
+    // no transaction is active.
+    void autoAnalyzeNoLock();
+    // Returns the query which reads the materialized view whose defining query is the given query,
+    // refreshing the view first if its base tables have been written to since its last refresh.
+    // Returns an empty string if there is no such view, or it can't be brought up to date.
+    std::string getMaterializedViewQueryNoLock(std::string_view query);
+
+    bool canUseQueryResultCacheNoLock(const QueryConfig& config) const;
+    // Returns nullptr if the result of the query is not cached, or outdated.
+    std::unique_ptr<QueryResult> getCachedQueryResultNoLock(const std::string& key);
+    // Executes a statement, and caches its result if it only reads from tables.
+    std::unique_ptr<QueryResult> executeAndCacheResultNoLock(const std::string& key,
+        PreparedStatement* preparedStatement, CachedPreparedStatement* cachedStatement,
+        std::optional<uint64_t> queryID, QueryConfig config);
+
+    void writeQueryTrace(const common::QueryTracer& tracer);
 
     std::unique_ptr<QueryResult> handleFailedExecution(std::optional<uint64_t> queryID,
         const std::exception& e) const;
@@ -247,6 +283,8 @@ private:
     std::unique_ptr<graph::GraphEntrySet> graphEntrySet;
     // Whether the query can access internal tables/sequences or not.
     bool useInternalCatalogEntry_ = false;
+    // Whether auto analyze is running, so that its statements don't trigger it again.
+    bool runningAutoAnalyze = false;
     // Whether the transaction should be rolled back on destruction. If the parent database is
     // closed, the rollback should be prevented or it will SEGFAULT.
     bool preventTransactionRollbackOnDestruction = false;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <future>
+
 #include "client_context.h"
 #include "database.h"
 #include "function/udf_function.h"
@@ -47,8 +49,26 @@ public:
      */
     RYU_API std::unique_ptr<QueryResult> query(std::string_view query);
 
+    /**
+     * @brief Executes the given query on a separate thread without blocking the caller. The query
+     * can be cancelled with interrupt(). The connection must outlive the returned future.
+     * @param query The query to execute.
+     * @return the future result of the query.
+     */
+    RYU_API std::future<std::unique_ptr<QueryResult>> queryAsync(std::string_view query);
+
     RYU_API std::unique_ptr<QueryResult> queryAsArrow(std::string_view query, int64_t chunkSize);
 
+    /**
+     * @brief Executes the given query and returns its result while it is still being produced.
+     * Only a bounded number of result chunks is buffered, so the query waits for the caller to
+     * consume the result. The connection cannot run other queries until the result is consumed
+     * or destroyed.
+     * @param query The query to execute. Must be a single statement.
+     * @return the streamed result of the query.
+     */
+    RYU_API std::unique_ptr<QueryResult> queryAsStream(std::string_view query);
+
     /**
      * @brief Prepares the given query and returns the prepared statement.
      * @param query The query to prepare.
@@ -90,6 +110,17 @@ public:
      */
     RYU_API std::unique_ptr<QueryResult> executeWithParams(PreparedStatement* preparedStatement,
         std::unordered_map<std::string, std::unique_ptr<common::Value>> inputParams);
+    /**
+     * @brief Executes the given prepared statement once for each parameter set in batch. Unless
+     * there is an active transaction, all executions run in a single transaction that is rolled
+     * back if any of them fails.
+     * @param preparedStatement The prepared statement to execute.
+     * @param batch The parameter sets, each mapping parameter names to values.
+     * @return the results of the executions chained in order, or the error of the first failing
+     * execution.
+     */
+    RYU_API std::unique_ptr<QueryResult> executeBatch(PreparedStatement* preparedStatement,
+        std::vector<std::unordered_map<std::string, std::unique_ptr<common::Value>>> batch);
     /**
      * @brief interrupts all queries currently executing within this connection.
      */
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #if defined(__APPLE__)
@@ -32,6 +34,11 @@ class StorageExtension;
 
 namespace main {
 class DatabaseManager;
+class DatabaseMetrics;
+class SlowQueryLog;
+class ParsedStatementCache;
+class MaterializedViews;
+class QueryResultCache;
 /**
  * @brief Stores runtime configuration for creating or opening a Database
  */
@@ -62,12 +69,37 @@ struct RYU_API SystemConfig {
      * the error occured.
      * @param enableChecksums If true, the database will use checksums to detect corruption in the
      * WAL file.
+     * @param enableWorkStealing If true, the task scheduler keeps one task queue per worker thread
+     * and idle workers steal tasks from other workers' queues instead of contending on a single
+     * global queue. Workers are also pinned to NUMA nodes on Linux machines with multiple nodes.
+     * @param enableScanResistantEviction If true, the buffer pool evicts pages read by sequential
+     * table scans before recently used pages, so that large scans don't flush frequently accessed
+     * pages (e.g. hash index pages) out of the buffer pool.
+     * @param enableHugePages If true, the buffer pool and large memory allocations are backed by
+     * transparent huge pages where the operating system supports them, which reduces TLB misses
+     * of random lookups into large buffer pools. Regular pages are used otherwise.
+     * @param enableNUMAPartitioning If true, the buffer pool keeps one eviction queue and memory
+     * counter per NUMA node on Linux machines with multiple nodes, and threads evict pages of their
+     * own node first. Combined with enableWorkStealing, which pins workers to NUMA nodes, this
+     * keeps most frames a thread touches in node-local memory.
+     * @param enableReadReplica If true, the database is opened as a read replica of a database
+     * that another process writes to, which requires readOnly. Replicas don't lock the database
+     * file, and pick up the transactions committed and checkpoints made by the writer whenever a
+     * read transaction starts while no other transaction of the replica is active, instead of
+     * only seeing the data as of open time.
+     * @param enableBufferPoolPrewarm If true, the data file pages cached in the buffer pool are
+     * recorded at every checkpoint and when the database is closed, and read back into the buffer
+     * pool by a background thread after the database is opened again, so that the first queries
+     * after a restart don't have to wait for the pages they need one at a time.
      */
     explicit SystemConfig(uint64_t bufferPoolSize = -1u, uint64_t maxNumThreads = 0,
         bool enableCompression = true, bool readOnly = false, uint64_t maxDBSize = -1u,
         bool autoCheckpoint = true, uint64_t checkpointThreshold = 16777216 /* 16MB */,
         bool forceCheckpointOnClose = true, bool throwOnWalReplayFailure = true,
-        bool enableChecksums = true
+        bool enableChecksums = true, bool enableWorkStealing = false,
+        bool enableScanResistantEviction = false, bool enableHugePages = false,
+        bool enableNUMAPartitioning = false, bool enableReadReplica = false,
+        bool enableBufferPoolPrewarm = false
 #if defined(__APPLE__)
         ,
         uint32_t threadQos = QOS_CLASS_DEFAULT
@@ -84,6 +116,12 @@ struct RYU_API SystemConfig {
     bool forceCheckpointOnClose;
     bool throwOnWalReplayFailure;
     bool enableChecksums;
+    bool enableWorkStealing;
+    bool enableScanResistantEviction;
+    bool enableHugePages;
+    bool enableNUMAPartitioning;
+    bool enableReadReplica;
+    bool enableBufferPoolPrewarm;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
@@ -158,8 +196,24 @@ public:
 
     extension::ExtensionManager* getExtensionManager() { return extensionManager.get(); }
 
+    DatabaseMetrics* getMetrics() { return metrics.get(); }
+
+    /**
+     * @brief Exports the database-wide metrics, e.g. the number of page misses of the buffer
+     * manager or the durations of checkpoints, in the OpenMetrics text format.
+     */
+    RYU_API std::string exportMetrics();
+
+    SlowQueryLog* getSlowQueryLog() { return slowQueryLog.get(); }
+
     common::VirtualFileSystem* getVFS() { return vfs.get(); }
 
+    ParsedStatementCache* getParsedStatementCache() { return parsedStatementCache.get(); }
+
+    MaterializedViews* getMaterializedViews() { return materializedViews.get(); }
+
+    QueryResultCache* getQueryResultCache() { return queryResultCache.get(); }
+
 private:
     using construct_bm_func_t =
         std::function<std::unique_ptr<storage::BufferManager>(const Database&)>;
@@ -178,9 +232,17 @@ private:
 
     void validatePathInReadOnly() const;
 
+    // Warms up the parser in the background unless a database of the process already did so.
+    void startParserWarmUp();
+    // Reads the pages of the buffer pool snapshot back into the buffer pool in the background.
+    void startBufferPoolPrewarm(ClientContext& clientContext);
+
 private:
     std::string databasePath;
     DBConfig dbConfig;
+    // Declared before the components updating it, so that it is destructed after them.
+    std::unique_ptr<DatabaseMetrics> metrics;
+    std::unique_ptr<SlowQueryLog> slowQueryLog;
     std::unique_ptr<common::VirtualFileSystem> vfs;
     std::unique_ptr<storage::BufferManager> bufferManager;
     std::unique_ptr<storage::MemoryManager> memoryManager;
@@ -191,12 +253,20 @@ private:
     std::unique_ptr<common::FileInfo> lockFile;
     std::unique_ptr<DatabaseManager> databaseManager;
     std::unique_ptr<extension::ExtensionManager> extensionManager;
+    std::unique_ptr<ParsedStatementCache> parsedStatementCache;
+    std::unique_ptr<MaterializedViews> materializedViews;
+    // Declared after the memory manager, since cached results hold memory of the buffer pool.
+    std::unique_ptr<QueryResultCache> queryResultCache;
     QueryIDGenerator queryIDGenerator;
     std::shared_ptr<common::DatabaseLifeCycleManager> dbLifeCycleManager;
     std::vector<std::unique_ptr<extension::TransformerExtension>> transformerExtensions;
     std::vector<std::unique_ptr<extension::BinderExtension>> binderExtensions;
     std::vector<std::unique_ptr<extension::PlannerExtension>> plannerExtensions;
     std::vector<std::unique_ptr<extension::MapperExtension>> mapperExtensions;
+    // Warms up the parser of the process, see Parser::warmUp().
+    std::thread parserWarmUpThread;
+    std::thread prewarmThread;
+    std::atomic<bool> stopPrewarm{false};
 };
 
 } // namespace main
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ryu {
+namespace main {
+
+class Database;
+
+// A counter which many threads can increase without contending on one cache line: each thread
+// adds to one of several padded shards, which are summed up when the counter is read.
+class MetricCounter {
+public:
+    void increase(uint64_t value = 1) {
+        shards[getShardIdx()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t get() const;
+
+private:
+    static uint32_t getShardIdx();
+
+private:
+    static constexpr uint32_t NUM_SHARDS = 16;
+
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+    std::array<Shard, NUM_SHARDS> shards;
+};
+
+// Distribution of durations over buckets whose upper bounds double from 1ms to about 65s, plus a
+// last bucket for longer durations.
+class MetricHistogram {
+public:
+    static constexpr uint32_t NUM_BUCKETS = 18;
+
+    void observe(uint64_t durationInMicros);
+
+    // Returns UINT64_MAX for the last bucket.
+    static uint64_t getBucketUpperBoundInMicros(uint32_t bucketIdx);
+
+    uint64_t getBucketCount(uint32_t bucketIdx) const {
+        return buckets[bucketIdx].load(std::memory_order_relaxed);
+    }
+    uint64_t getCount() const { return count.load(std::memory_order_relaxed); }
+    uint64_t getSumInMicros() const { return sumInMicros.load(std::memory_order_relaxed); }
+
+private:
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets{};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sumInMicros{0};
+};
+
+struct MetricSample {
+    // Name of the metric family, e.g. ryu_checkpoint_duration_seconds.
+    std::string family;
+    // Name of the sample, e.g. ryu_checkpoint_duration_seconds_count.
+    std::string name;
+    // OpenMetrics type of the metric the sample belongs to: counter, gauge or histogram.
+    std::string type;
+    std::string help;
+    // Labels in OpenMetrics syntax, e.g. {le="0.001"}, or empty.
+    std::string labels;
+    double value;
+};
+
+// Database-wide metrics which components update as they work. Counters and histograms are cheap
+// atomics, and gauges, e.g. the memory used by the buffer manager, are read from the components
+// when the metrics are collected. They can be queried with CALL metrics() or exported in the
+// OpenMetrics text format for a monitoring system to scrape.
+class DatabaseMetrics {
+public:
+    // Buffer manager.
+    MetricCounter numPageAccesses;
+    MetricCounter numPageMisses;
+    MetricCounter numBytesRead;
+    MetricCounter numEvictedPages;
+    // WAL.
+    MetricCounter numWALBytes;
+    MetricCounter numWALSyncs;
+    // Checkpoints.
+    MetricHistogram checkpointDuration;
+    // Time checkpoints spend waiting for active transactions to leave, while new transactions are
+    // blocked.
+    MetricHistogram checkpointWaitDuration;
+    // Transactions.
+    MetricCounter numCommittedTransactions;
+    MetricCounter numRolledBackTransactions;
+
+    std::vector<MetricSample> collect(Database& database) const;
+
+    std::string exportOpenMetrics(Database& database) const;
+};
+
+} // namespace main
+} // namespace ryu
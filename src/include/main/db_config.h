@@ -60,12 +60,23 @@ struct DBConfig {
     bool readOnly;
     uint64_t maxDBSize;
     bool enableMultiWrites;
+    bool enableGroupCommit;
+    uint64_t groupCommitDelayInMicros;
     bool autoCheckpoint;
+    bool deferAutoCheckpoint;
     uint64_t checkpointThreshold;
     bool forceCheckpointOnClose;
     bool throwOnWalReplayFailure;
     bool enableChecksums;
     bool enableSpillingToDisk;
+    bool enableWorkStealing;
+    bool enableScanResistantEviction;
+    bool enableHugePages;
+    bool enableNUMAPartitioning;
+    bool enableReadReplica;
+    bool enableBufferPoolPrewarm;
+    // Checkpointed rel table pages are offloaded to this directory if it is set.
+    std::string coldStoragePath;
 #if defined(__APPLE__)
     uint32_t threadQos;
 #endif
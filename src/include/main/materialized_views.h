@@ -0,0 +1,80 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "common/types/types.h"
+
+namespace ryu {
+namespace catalog {
+class TableCatalogEntry;
+class NodeTableCatalogEntry;
+} // namespace catalog
+namespace transaction {
+class Transaction;
+} // namespace transaction
+
+namespace main {
+class ClientContext;
+
+/**
+ * @brief Freshness of the materialized views of a database. A materialized view is a node table
+ * which stores the result of its defining query, marked by a comment which starts with
+ * COMMENT_PREFIX followed by the query. Queries whose text equals the defining query of a view are
+ * answered by scanning the view, see ClientContext::getMaterializedViewQueryNoLock().
+ *
+ * Every table counts the writes to it (Table::getWriteVersion()). A refresh of a view records the
+ * write versions of all tables other than views before the defining query is evaluated, and the
+ * view is fresh as long as they are unchanged. Versions are only kept in memory, so views are
+ * refreshed once after the database is opened again.
+ *
+ * Views are looked up by their defining query in a registry, so that queries don't have to scan
+ * the catalog. It is filled from the catalog on the first lookup, a view is added to it whenever
+ * it is refreshed, and it is filled again once a registered view turns out to be dropped.
+ */
+class MaterializedViews {
+    using write_versions_t = common::table_id_map_t<uint64_t>;
+
+public:
+    static constexpr const char* COMMENT_PREFIX = "MATERIALIZED VIEW AS ";
+
+    static bool isView(const catalog::TableCatalogEntry& entry);
+    static std::string getDefiningQuery(const catalog::TableCatalogEntry& entry);
+    // Removes the surrounding whitespace and trailing semicolons of a query, so that the same
+    // query matches the defining query of a view however it is terminated.
+    static std::string normalizeQuery(std::string_view query);
+    // Returns the view whose defining query equals the query, or nullptr.
+    catalog::NodeTableCatalogEntry* findView(const ClientContext& context,
+        const transaction::Transaction* transaction, std::string_view query);
+    // Returns the query which reads the rows of the view with the columns of its defining query.
+    static std::string getScanQuery(const catalog::NodeTableCatalogEntry& viewEntry);
+
+    // Must be called in the write transaction which starts the refresh, before the rows of the
+    // view are replaced, so that no other write can be missed. The view is stale until the refresh
+    // is finished.
+    void beginRefresh(const ClientContext& context, const transaction::Transaction* transaction,
+        const catalog::NodeTableCatalogEntry& viewEntry);
+    void finishRefresh(common::table_id_t viewTableID);
+    bool isFresh(const ClientContext& context, const transaction::Transaction* transaction,
+        common::table_id_t viewTableID);
+
+private:
+    static write_versions_t getBaseTableVersions(const ClientContext& context,
+        const transaction::Transaction* transaction);
+    catalog::NodeTableCatalogEntry* findRegisteredView(const ClientContext& context,
+        const transaction::Transaction* transaction, const std::string& normalizedQuery);
+    void registerViews(const ClientContext& context, const transaction::Transaction* transaction);
+
+private:
+    std::mutex mtx;
+    common::table_id_map_t<write_versions_t> pendingVersions;
+    common::table_id_map_t<write_versions_t> refreshedVersions;
+    // Table IDs of the views by their normalized defining query.
+    std::optional<std::unordered_map<std::string, common::table_id_t>> viewsByQuery;
+};
+
+} // namespace main
+} // namespace ryu
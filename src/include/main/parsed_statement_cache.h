@@ -0,0 +1,48 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ryu {
+namespace parser {
+class Statement;
+}
+
+namespace main {
+
+// Database-wide LRU cache of parsed statements keyed by query text. Connections that issue the
+// same (parameterized) query skip parsing, which dominates compilation of short queries. Parsed
+// statements don't depend on the catalog and are not modified after parsing, so they are shared
+// across connections. Binding and planning still happen per execution because their results
+// depend on the catalog version, statistics and parameter values.
+class ParsedStatementCache {
+    using statements_t = std::vector<std::shared_ptr<parser::Statement>>;
+
+public:
+    static constexpr uint64_t CAPACITY = 512;
+    // Longer queries usually embed data, e.g. large lists, and are unlikely to be repeated.
+    static constexpr uint64_t MAX_QUERY_LENGTH = 16384;
+
+    bool lookup(std::string_view query, statements_t& statements);
+    void insert(std::string_view query, statements_t statements);
+    void clear();
+
+private:
+    struct Entry {
+        std::string query;
+        statements_t statements;
+    };
+
+    std::mutex mtx;
+    // Most recently used entries are at the front.
+    std::list<Entry> entries;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> entryMap;
+};
+
+} // namespace main
+} // namespace ryu
@@ -20,17 +20,23 @@ namespace binder {
 class Expression;
 }
 namespace planner {
+class CardinalityFeedback;
 class LogicalPlan;
-}
+} // namespace planner
 
 namespace main {
 
 // Prepared statement cached in client context and NEVER serialized to client side.
 struct CachedPreparedStatement {
     bool useInternalCatalogEntry = false;
+    // Text of the query the statement was parsed from.
+    std::string query;
     std::shared_ptr<parser::Statement> parsedStatement;
     std::unique_ptr<planner::LogicalPlan> logicalPlan;
     std::vector<std::shared_ptr<binder::Expression>> columns;
+    // Cardinalities observed by previous executions the plan was chosen with. Only set if the
+    // statement is planned in adaptive mode.
+    std::unique_ptr<planner::CardinalityFeedback> cardinalityFeedback;
 
     CachedPreparedStatement();
     ~CachedPreparedStatement();
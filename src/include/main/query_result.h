@@ -17,6 +17,7 @@ namespace main {
 enum class QueryResultType {
     FTABLE = 0,
     ARROW = 1,
+    STREAM = 2,
 };
 
 /**
@@ -117,6 +118,16 @@ public:
      * If converting to another arrow type, this is usually handled automatically.
      */
     RYU_API virtual std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) = 0;
+    /**
+     * @brief Returns the remaining tuples of the query result as an arrow array stream.
+     * @param chunkSize number of tuples in each array of the stream.
+     * @return An arrow C stream whose get_next converts only the next chunkSize tuples, so that
+     * large results can be consumed incrementally instead of being converted at once.
+     *
+     * The query result must outlive the stream. It is the caller's responsibility to call the
+     * release function of the stream and of each array returned by it.
+     */
+    RYU_API std::unique_ptr<ArrowArrayStream> getArrowArrayStream(int64_t chunkSize);
 
     QueryResultType getType() const { return type; }
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <thread>
+
+#include "main/query_result.h"
+
+namespace ryu {
+namespace processor {
+class FactorizedTable;
+class FactorizedTableIterator;
+class ResultStream;
+} // namespace processor
+
+namespace main {
+
+class ClientContext;
+
+/**
+ * StreamingQueryResult returns the tuples of a query while it is still running. The query is
+ * executed by a separate thread whose result collector hands chunks of the result to this object
+ * through a bounded ResultStream, so that the first tuples are available before the whole result
+ * is produced and only a bounded number of chunks is kept in memory. The connection cannot run
+ * other queries until the result is consumed or destroyed. Destroying the result before it is
+ * consumed interrupts the query.
+ */
+class StreamingQueryResult : public QueryResult {
+    static constexpr QueryResultType type_ = QueryResultType::STREAM;
+
+public:
+    StreamingQueryResult(std::vector<std::string> columnNames,
+        std::vector<common::LogicalType> columnTypes,
+        std::shared_ptr<processor::ResultStream> stream, std::thread executor,
+        ClientContext* clientContext);
+    ~StreamingQueryResult() override;
+
+    // Returns the number of tuples returned so far, since the total is only known at the end.
+    uint64_t getNumTuples() const override;
+
+    // Blocks until the next chunk of the result is produced. Throws if the query failed.
+    bool hasNext() const override;
+
+    std::shared_ptr<processor::FlatTuple> getNext() override;
+
+    void resetIterator() override;
+
+    // Consumes the remaining tuples.
+    std::string toString() const override;
+
+    bool hasNextArrowChunk() override;
+
+    std::unique_ptr<ArrowArray> getNextArrowChunk(int64_t chunkSize) override;
+
+private:
+    // Pops chunks from the stream until one has tuples left or the query finished.
+    bool fetchNext();
+    // Waits for the executing thread and takes the error, summary and, for statements whose
+    // output is not streamed, the tuples of the final result.
+    void finish();
+
+private:
+    std::shared_ptr<processor::ResultStream> stream;
+    std::thread executor;
+    ClientContext* clientContext;
+    std::shared_ptr<processor::FactorizedTable> table;
+    std::unique_ptr<processor::FactorizedTableIterator> iterator;
+    std::unique_ptr<QueryResult> finalResult;
+    uint64_t numTuplesRead = 0;
+};
+
+} // namespace main
+} // namespace ryu
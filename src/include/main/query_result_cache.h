@@ -0,0 +1,85 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace ryu {
+namespace common {
+class Value;
+} // namespace common
+namespace planner {
+class LogicalPlan;
+} // namespace planner
+namespace processor {
+class FactorizedTable;
+} // namespace processor
+namespace transaction {
+class TransactionManager;
+} // namespace transaction
+
+namespace main {
+struct ClientConfig;
+
+// Database-wide LRU cache of the results of read-only queries, keyed by query text, parameter
+// values and the connection settings which change results. Queries which may read attached
+// databases are not cached. A result is reused as long as no transaction which wrote to one of
+// the tables read by its plan, or changed the catalog, has committed since it was computed.
+// Results are held in memory of the buffer pool, so the cache is bounded by a fraction of it.
+//
+// Only queries whose plans consist of scans, joins and relational operators are cached. Plans
+// calling non-deterministic functions, e.g. rand() or current_timestamp(), are not cached.
+class QueryResultCache {
+public:
+    using parameters_t = std::unordered_map<std::string, std::shared_ptr<common::Value>>;
+
+    struct Entry {
+        std::shared_ptr<processor::FactorizedTable> table;
+        std::vector<std::string> columnNames;
+        std::vector<common::LogicalType> columnTypes;
+        std::vector<common::table_id_t> tableIDs;
+        // Commit timestamp before the query started, so all later commits are treated as unseen.
+        common::transaction_t timestamp = 0;
+        uint64_t memoryUsage = 0;
+    };
+
+    static constexpr uint64_t BUFFER_POOL_FRACTION = 16;
+    // Larger results would evict most of the other entries.
+    static constexpr uint64_t MAX_ENTRY_FRACTION = 4;
+
+    explicit QueryResultCache(uint64_t capacity) : capacity{capacity} {}
+
+    static std::string getKey(std::string_view query, const parameters_t& parameters,
+        const ClientConfig& clientConfig);
+    // Returns the IDs of the tables read by the plan, or nothing if the result of the plan can't be
+    // cached.
+    static std::optional<std::vector<common::table_id_t>> getTableIDs(
+        const planner::LogicalPlan& plan);
+
+    // Returns nullptr if there is no entry for the key, or it is outdated.
+    std::shared_ptr<const Entry> lookup(const std::string& key,
+        transaction::TransactionManager& transactionManager);
+    void insert(const std::string& key, std::shared_ptr<const Entry> entry);
+    void clear();
+
+private:
+    void eraseNoLock(std::list<std::pair<std::string, std::shared_ptr<const Entry>>>::iterator it);
+
+private:
+    uint64_t capacity;
+    std::mutex mtx;
+    uint64_t memoryUsage = 0;
+    // Most recently used entries are at the front.
+    std::list<std::pair<std::string, std::shared_ptr<const Entry>>> entries;
+    std::unordered_map<std::string_view, decltype(entries)::iterator> entryMap;
+};
+
+} // namespace main
+} // namespace ryu
@@ -47,6 +47,13 @@ struct SparseFrontierThresholdSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct WSPDeltaSetting {
+    static constexpr auto name = "wsp_delta";
+    static constexpr auto inputType = common::LogicalTypeID::DOUBLE;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct EnableSemiMaskSetting {
     static constexpr auto name = "enable_semi_mask";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -110,6 +117,20 @@ struct CheckpointThresholdSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct GroupCommitSetting {
+    static constexpr auto name = "group_commit";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct GroupCommitDelaySetting {
+    static constexpr auto name = "group_commit_delay";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct AutoCheckpointSetting {
     static constexpr auto name = "auto_checkpoint";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -117,6 +138,13 @@ struct AutoCheckpointSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct DeferAutoCheckpointSetting {
+    static constexpr auto name = "defer_auto_checkpoint";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct ForceCheckpointClosingDBSetting {
     static constexpr auto name = "force_checkpoint_on_close";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -138,6 +166,20 @@ struct EnableOptimizerSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct EnableAdaptiveJoinOrderSetting {
+    static constexpr auto name = "enable_adaptive_join_order";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct SortStringPrefixLengthSetting {
+    static constexpr auto name = "sort_string_prefix_length";
+    static constexpr auto inputType = common::LogicalTypeID::INT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 struct EnableInternalCatalogSetting {
     static constexpr auto name = "enable_internal_catalog";
     static constexpr auto inputType = common::LogicalTypeID::BOOL;
@@ -145,5 +187,54 @@ struct EnableInternalCatalogSetting {
     static common::Value getSetting(const ClientContext* context);
 };
 
+struct EnableHardwareCountersSetting {
+    static constexpr auto name = "enable_hardware_counters";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct QueryTracePathSetting {
+    static constexpr auto name = "query_trace_path";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct SlowQueryLogPathSetting {
+    static constexpr auto name = "slow_query_log_path";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct SlowQueryThresholdSetting {
+    static constexpr auto name = "slow_query_threshold";
+    static constexpr auto inputType = common::LogicalTypeID::UINT64;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct AutoAnalyzeSetting {
+    static constexpr auto name = "auto_analyze";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct EnableQueryResultCacheSetting {
+    static constexpr auto name = "query_result_cache";
+    static constexpr auto inputType = common::LogicalTypeID::BOOL;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
+struct ColdStoragePathSetting {
+    static constexpr auto name = "cold_storage_path";
+    static constexpr auto inputType = common::LogicalTypeID::STRING;
+    static void setContext(ClientContext* context, const common::Value& parameter);
+    static common::Value getSetting(const ClientContext* context);
+};
+
 } // namespace main
 } // namespace ryu
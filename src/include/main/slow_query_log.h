@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ryu_fwd.h"
+
+namespace ryu {
+namespace common {
+class Profiler;
+} // namespace common
+namespace processor {
+class PhysicalPlan;
+} // namespace processor
+
+namespace main {
+class ClientContext;
+
+struct SlowQueryInfo {
+    std::string query;
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameters = nullptr;
+    double compilingTimeInMS = 0;
+    uint64_t executionTimeInMS = 0;
+    // Peak memory allocated through the memory manager for the query.
+    uint64_t peakMemory = 0;
+};
+
+/**
+ * @brief Log of the queries which ran longer than the slow query threshold of their connection.
+ * Each query is appended to the log file as one JSON object per line, with its parameters, its
+ * physical plan annotated with the estimated and actual cardinality, time and bytes read of each
+ * operator, and totals of the query. Once a file grows beyond MAX_FILE_SIZE, it is moved to
+ * "<path>.1", replacing the previous one, so that at most two files are kept.
+ */
+class SlowQueryLog {
+public:
+    static constexpr uint64_t MAX_FILE_SIZE = 64 * 1024 * 1024;
+
+    // Returns the JSON entry of a query. The plan must have been executed with the profiler
+    // enabled.
+    static std::string createEntry(const SlowQueryInfo& info,
+        const processor::PhysicalPlan& physicalPlan, common::Profiler& profiler);
+
+    void append(const std::string& path, const std::string& entry, ClientContext* context);
+
+private:
+    // Serializes the connections appending to the log.
+    std::mutex mtx;
+};
+
+} // namespace main
+} // namespace ryu
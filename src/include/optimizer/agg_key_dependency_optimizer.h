@@ -8,6 +8,8 @@ namespace optimizer {
 
 // This optimizer analyzes the dependency between group by keys. If key2 depends on key1 (e.g. key1
 // is a primary key column) we only hash on key1 and saves key2 as a payload.
+// It also marks aggregates grouped by the node ID of a scan within the same pipeline as clustered,
+// since all tuples of a node are then produced one after another by the thread scanning it.
 class AggKeyDependencyOptimizer : public LogicalOperatorVisitor {
 public:
     void rewrite(planner::LogicalPlan* plan);
@@ -24,6 +24,10 @@ struct PredicateSet {
     void addPredicate(std::shared_ptr<binder::Expression> predicate);
     std::shared_ptr<binder::Expression> popNodePKEqualityComparison(
         const binder::Expression& nodeID);
+    // Pops a predicate `pk IN list` on the primary key of the node, where the list is constant.
+    // The list is the first child of the predicate.
+    std::shared_ptr<binder::Expression> popNodePKInListComparison(
+        const binder::Expression& nodeID);
     binder::expression_vector getAllPredicates();
 
 private:
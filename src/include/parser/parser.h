@@ -18,6 +18,13 @@ class Parser {
 public:
     RYU_API static std::vector<std::shared_ptr<Statement>> parseQuery(std::string_view query,
         std::vector<extension::TransformerExtension*> transformerExtensions = {});
+
+    // Parses common statement shapes once per process. The ATN of the lexer and the parser is
+    // deserialized on first use, and the DFA caching their predictions is shared by all parsers,
+    // so this moves the slow first parses out of the first queries. Concurrent callers wait for
+    // the warm-up to finish.
+    static void warmUp();
+    RYU_API static bool isWarmedUp();
 };
 
 } // namespace parser
@@ -2,6 +2,7 @@
 
 #include "binder/query/query_graph.h"
 #include "planner/operator/logical_plan.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/stats/table_stats.h"
 
 namespace ryu {
@@ -43,13 +44,25 @@ public:
     double getExtensionRate(const binder::RelExpression& rel,
         const binder::NodeExpression& boundNode, const transaction::Transaction* transaction) const;
     cardinality_t multiply(double extensionRate, cardinality_t card) const;
+    // Estimates the number of path nodes which a recursive join from numSources bound nodes
+    // reaches.
+    cardinality_t estimateNumReachedNodes(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode, cardinality_t numSources,
+        const transaction::Transaction* transaction) const;
+    cardinality_t getNumNodes(const transaction::Transaction* transaction,
+        const std::vector<common::table_id_t>& tableIDs) const;
 
 private:
     cardinality_t getNodeIDDom(const std::string& nodeIDName) const;
-    cardinality_t getNumNodes(const transaction::Transaction* transaction,
-        const std::vector<common::table_id_t>& tableIDs) const;
     cardinality_t getNumRels(const transaction::Transaction* transaction,
         const std::vector<common::table_id_t>& tableIDs) const;
+    // Estimates the selectivity of comparisons between a property and a literal from the sampled
+    // values of the property.
+    std::optional<double> estimateSelectivityFromSample(const binder::Expression& predicate) const;
+    storage::DegreeStats getDegreeStats(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode) const;
+    double getRecursiveExtensionRate(const binder::RelExpression& rel,
+        const binder::NodeExpression& boundNode, double oneHopExtensionRate) const;
 
 private:
     main::ClientContext* context;
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "binder/query/query_graph.h"
+
+namespace ryu {
+namespace planner {
+
+// Cardinalities observed while executing a statement, keyed by the subgraph of the query graph
+// whose plan produced them. A statement executed in adaptive mode is planned again with these
+// cardinalities replacing the estimated ones if an observed cardinality is far off its estimate.
+class CardinalityFeedback {
+public:
+    // Upper bound on the number of times a statement is planned again.
+    static constexpr uint64_t MAX_NUM_REOPTIMIZATIONS = 3;
+    // An observed cardinality triggers planning again if it differs from the estimate by more
+    // than this factor, in either direction.
+    static constexpr double REOPTIMIZATION_RATIO = 16;
+    // Small intermediate results are cheap regardless of the plan, so they never trigger planning
+    // again.
+    static constexpr common::cardinality_t MIN_CARDINALITY_TO_REOPTIMIZE = 1 << 16;
+
+    static std::string getKey(const binder::QueryGraph& queryGraph,
+        const binder::SubqueryGraph& subgraph);
+    // Range of observed cardinalities which do not trigger planning again, given the estimate.
+    static std::pair<common::cardinality_t, common::cardinality_t> getAcceptedRange(
+        common::cardinality_t estimated);
+
+    void add(const std::string& key, common::cardinality_t cardinality) {
+        observedCardinalities[key] = cardinality;
+    }
+    bool contains(const std::string& key) const { return observedCardinalities.contains(key); }
+    std::optional<common::cardinality_t> get(const std::string& key) const;
+    // Whether observing more cardinalities may still lead to planning again.
+    bool canReoptimize() const { return observedCardinalities.size() < MAX_NUM_REOPTIMIZATIONS; }
+
+private:
+    std::unordered_map<std::string, common::cardinality_t> observedCardinalities;
+};
+
+} // namespace planner
+} // namespace ryu
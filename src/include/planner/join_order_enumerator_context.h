@@ -1,5 +1,6 @@
 #pragma once
 
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/operator/logical_plan.h"
 #include "planner/subplans_table.h"
 
@@ -12,7 +13,7 @@ class JoinOrderEnumeratorContext {
 public:
     JoinOrderEnumeratorContext()
         : currentLevel{0}, maxLevel{0}, subPlansTable{std::make_unique<SubPlansTable>()},
-          queryGraph{nullptr} {}
+          queryGraph{nullptr}, cardinalityFeedback{nullptr} {}
     DELETE_COPY_DEFAULT_MOVE(JoinOrderEnumeratorContext);
 
     void init(const binder::QueryGraph* queryGraph, const binder::expression_vector& predicates);
@@ -25,9 +26,8 @@ public:
     const std::vector<LogicalPlan>& getPlans(const binder::SubqueryGraph& subqueryGraph) const {
         return subPlansTable->getSubgraphPlans(subqueryGraph);
     }
-    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan) {
-        subPlansTable->addPlan(subqueryGraph, std::move(plan));
-    }
+    // Observed cardinalities replace the estimated cardinality of plans in adaptive mode.
+    void addPlan(const binder::SubqueryGraph& subqueryGraph, LogicalPlan plan);
 
     binder::SubqueryGraph getEmptySubqueryGraph() const {
         return binder::SubqueryGraph(*queryGraph);
@@ -46,6 +46,8 @@ private:
 
     std::unique_ptr<SubPlansTable> subPlansTable;
     const binder::QueryGraph* queryGraph;
+    // Not null iff planning in adaptive mode.
+    const CardinalityFeedback* cardinalityFeedback;
 };
 
 } // namespace planner
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "binder/expression/node_expression.h"
 #include "function/gds/rec_joins.h"
 #include "planner/operator/logical_operator.h"
 
@@ -38,6 +39,17 @@ public:
 
     bool hasNodePredicate() const { return !children.empty(); }
 
+    // The node predicate of the recursive pattern is either evaluated upfront by the semi masker
+    // child, or evaluated lazily for the nodes which paths go through.
+    void setLazyNodePredicate(std::shared_ptr<binder::NodeExpression> node,
+        std::shared_ptr<binder::Expression> predicate) {
+        pathNode = std::move(node);
+        lazyNodePredicate = std::move(predicate);
+    }
+    bool hasLazyNodePredicate() const { return lazyNodePredicate != nullptr; }
+    const binder::NodeExpression& getPathNode() const { return *pathNode; }
+    std::shared_ptr<binder::Expression> getLazyNodePredicate() const { return lazyNodePredicate; }
+
     std::string getExpressionsForPrinting() const override { return function->getFunctionName(); }
 
     std::unique_ptr<LogicalOperator> copy() override {
@@ -46,6 +58,8 @@ public:
         result->limitNum = limitNum;
         result->hasInputNodeMask_ = hasInputNodeMask_;
         result->hasOutputNodeMask_ = hasOutputNodeMask_;
+        result->pathNode = pathNode;
+        result->lazyNodePredicate = lazyNodePredicate;
         return result;
     }
 
@@ -58,6 +72,9 @@ private:
 
     bool hasInputNodeMask_ = false;
     bool hasOutputNodeMask_ = false;
+
+    std::shared_ptr<binder::NodeExpression> pathNode;
+    std::shared_ptr<binder::Expression> lazyNodePredicate;
 };
 
 } // namespace planner
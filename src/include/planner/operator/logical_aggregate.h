@@ -59,9 +59,16 @@ public:
     }
     binder::expression_vector getAggregates() const { return aggregates; }
 
+    // Keys are clustered if all input tuples of a group arrive one after another in the same
+    // thread, which allows aggregating them without a hash table.
+    void setKeysClustered(bool clustered) { keysClustered = clustered; }
+    bool areKeysClustered() const { return keysClustered; }
+
     std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalAggregate>(keys, dependentKeys, aggregates, children[0]->copy(),
-            cardinality);
+        auto result = make_unique<LogicalAggregate>(keys, dependentKeys, aggregates,
+            children[0]->copy(), cardinality);
+        result->keysClustered = keysClustered;
+        return result;
     }
 
 private:
@@ -73,6 +80,7 @@ private:
     // be treated as a hash key during hash aggregation.
     binder::expression_vector dependentKeys;
     binder::expression_vector aggregates;
+    bool keysClustered = false;
 };
 
 } // namespace planner
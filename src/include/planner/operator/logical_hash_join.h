@@ -45,6 +45,18 @@ public:
     SIPInfo& getSIPInfoUnsafe() { return sipInfo; }
     SIPInfo getSIPInfo() const { return sipInfo; }
 
+    // Key of the query subgraph planned on the build side and its estimated cardinality. Only set
+    // when planning in adaptive mode, in which case the observed build side cardinality is checked
+    // against the estimated one.
+    void setBuildSubgraph(std::string key, common::cardinality_t estimatedCardinality) {
+        buildSubgraphKey = std::move(key);
+        estimatedBuildCardinality = estimatedCardinality;
+    }
+    const std::string& getBuildSubgraphKey() const { return buildSubgraphKey; }
+    common::cardinality_t getEstimatedBuildCardinality() const {
+        return estimatedBuildCardinality;
+    }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
     // Flat probe side key group in either of the following two cases:
@@ -63,6 +75,8 @@ private:
     common::JoinType joinType;
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark or Left
     SIPInfo sipInfo;
+    std::string buildSubgraphKey;
+    common::cardinality_t estimatedBuildCardinality = 0;
 };
 
 } // namespace planner
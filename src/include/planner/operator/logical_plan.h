@@ -39,6 +39,9 @@ public:
 
     bool isProfile() const;
     bool hasUpdate() const;
+    // Whether the plan only looks up nodes by a single primary key each and processes the looked
+    // up tuples, e.g. MATCH (u:User {id: $id}) RETURN u.name, so it runs for a short time.
+    bool isPointQuery() const;
 
 private:
     std::shared_ptr<LogicalOperator> lastOperator;
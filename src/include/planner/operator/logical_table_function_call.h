@@ -27,6 +27,7 @@ public:
     void setColumnPredicates(std::vector<storage::ColumnPredicateSet> predicates) {
         bindData->setColumnPredicates(std::move(predicates));
     }
+    void setLimitNum(common::offset_t limitNum) { bindData->setLimitNum(limitNum); }
 
     void computeFlatSchema() override;
     void computeFactorizedSchema() override;
@@ -10,6 +10,9 @@ namespace planner {
 enum class LogicalScanNodeTableType : uint8_t {
     SCAN = 0,
     PRIMARY_KEY_SCAN = 1,
+    // Scans the rows a secondary property index returns for a key. The scanned rows are only
+    // candidates, so the predicate stays in a filter above the scan.
+    PROPERTY_INDEX_SCAN = 2,
 };
 
 struct ExtraScanNodeTableInfo {
@@ -24,11 +27,26 @@ struct ExtraScanNodeTableInfo {
 
 struct PrimaryKeyScanInfo final : ExtraScanNodeTableInfo {
     std::shared_ptr<binder::Expression> key;
+    // Whether key is a list of keys, e.g. for `n.id IN $ids`, whose nodes are all scanned.
+    bool isKeyList;
 
-    explicit PrimaryKeyScanInfo(std::shared_ptr<binder::Expression> key) : key{std::move(key)} {}
+    explicit PrimaryKeyScanInfo(std::shared_ptr<binder::Expression> key, bool isKeyList = false)
+        : key{std::move(key)}, isKeyList{isKeyList} {}
 
     std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
-        return std::make_unique<PrimaryKeyScanInfo>(key);
+        return std::make_unique<PrimaryKeyScanInfo>(key, isKeyList);
+    }
+};
+
+struct PropertyIndexScanInfo final : ExtraScanNodeTableInfo {
+    std::string indexName;
+    std::shared_ptr<binder::Expression> key;
+
+    PropertyIndexScanInfo(std::string indexName, std::shared_ptr<binder::Expression> key)
+        : indexName{std::move(indexName)}, key{std::move(key)} {}
+
+    std::unique_ptr<ExtraScanNodeTableInfo> copy() const override {
+        return std::make_unique<PropertyIndexScanInfo>(indexName, key);
     }
 };
 
@@ -92,6 +110,14 @@ public:
 
     ExtraScanNodeTableInfo* getExtraInfo() const { return extraInfo.get(); }
 
+    // Only committed node groups in the partition are scanned, see node_group_partition().
+    void setNodeGroupPartition(uint64_t partitionIdx_, uint64_t numPartitions_) {
+        partitionIdx = partitionIdx_;
+        numPartitions = numPartitions_;
+    }
+    uint64_t getPartitionIdx() const { return partitionIdx; }
+    uint64_t getNumPartitions() const { return numPartitions; }
+
     std::unique_ptr<OPPrintInfo> getPrintInfo() const override {
         return std::make_unique<LogicalScanNodeTablePrintInfo>(nodeID, properties);
     }
@@ -105,6 +131,8 @@ private:
     binder::expression_vector properties;
     std::vector<storage::ColumnPredicateSet> propertyPredicates;
     std::unique_ptr<ExtraScanNodeTableInfo> extraInfo;
+    uint64_t partitionIdx = 0;
+    uint64_t numPartitions = 1;
 };
 
 } // namespace planner
@@ -12,9 +12,10 @@ class LogicalExportDatabase final : public LogicalSimple {
 
 public:
     LogicalExportDatabase(common::FileScanInfo boundFileInfo,
-        const std::vector<std::shared_ptr<LogicalOperator>>& plans, bool exportSchemaOnly)
+        const std::vector<std::shared_ptr<LogicalOperator>>& plans, bool exportSchemaOnly,
+        uint64_t parallelism)
         : LogicalSimple{type_, plans}, boundFileInfo{std::move(boundFileInfo)},
-          schemaOnly{exportSchemaOnly} {}
+          schemaOnly{exportSchemaOnly}, parallelism{parallelism} {}
 
     std::string getFilePath() const { return boundFileInfo.filePaths[0]; }
     common::FileType getFileType() const { return boundFileInfo.fileTypeInfo.fileType; }
@@ -26,15 +27,18 @@ public:
     std::string getExpressionsForPrinting() const override { return std::string{}; }
 
     bool isSchemaOnly() const { return schemaOnly; }
+    // Number of tables exported concurrently.
+    uint64_t getParallelism() const { return parallelism; }
 
     std::unique_ptr<LogicalOperator> copy() override {
         return make_unique<LogicalExportDatabase>(boundFileInfo.copy(), copyVector(children),
-            schemaOnly);
+            schemaOnly, parallelism);
     }
 
 private:
     common::FileScanInfo boundFileInfo;
     bool schemaOnly;
+    uint64_t parallelism;
 };
 
 } // namespace planner
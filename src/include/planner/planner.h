@@ -26,6 +26,7 @@ class NormalizedQueryPart;
 class BoundReadingClause;
 class BoundUpdatingClause;
 class BoundProjectionBody;
+class SubqueryExpression;
 } // namespace binder
 namespace planner {
 
@@ -142,6 +143,15 @@ public:
         const binder::expression_vector& predicates, LogicalPlan& leftPlan,
         std::shared_ptr<binder::BoundJoinHintNode> hint);
     void planSubquery(const std::shared_ptr<binder::Expression>& subquery, LogicalPlan& outerPlan);
+    // Plans a correlated [NOT] EXISTS predicate as a semi (anti) join. Returns false if the
+    // predicate is not such a subquery.
+    bool tryPlanExistsFilter(const std::shared_ptr<binder::Expression>& predicate,
+        LogicalPlan& outerPlan);
+    // Returns the conditions on which the planned inner side is joined with the outer plan.
+    std::vector<binder::expression_pair> planCorrelatedSubquery(
+        const binder::SubqueryExpression& subquery,
+        const binder::expression_vector& correlatedExprs, LogicalPlan& outerPlan,
+        LogicalPlan& innerPlan);
     void planSubqueryIfNecessary(std::shared_ptr<binder::Expression> expression, LogicalPlan& plan);
 
     static binder::expression_vector getCorrelatedExprs(
@@ -187,6 +197,8 @@ public:
     void planInnerHashJoin(const binder::SubqueryGraph& subgraph,
         const binder::SubqueryGraph& otherSubgraph,
         const std::vector<std::shared_ptr<binder::NodeExpression>>& joinNodes, bool flipPlan);
+    void setBuildSubgraphKeyIfAdaptive(const binder::SubqueryGraph& buildSubgraph,
+        LogicalOperator& hashJoin);
 
     // Plan semi mask
     void appendNodeSemiMask(SemiMaskTargetType targetType, const binder::NodeExpression& node,
@@ -312,6 +324,12 @@ public:
 
     void appendDistinct(const binder::expression_vector& keys, LogicalPlan& plan);
 
+    // Enables adaptive mode, in which hash joins check the cardinality of their build side at
+    // runtime. Cardinalities observed by previous executions replace estimated ones.
+    void setCardinalityFeedback(const CardinalityFeedback* feedback) {
+        context.cardinalityFeedback = feedback;
+    }
+
     const CardinalityEstimator& getCardinalityEstimator() const { return cardinalityEstimator; }
     CardinalityEstimator& getCardinliatyEstimatorUnsafe() { return cardinalityEstimator; }
 
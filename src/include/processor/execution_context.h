@@ -3,6 +3,9 @@
 #include "common/profiler.h"
 
 namespace ryu {
+namespace common {
+class QueryTracer;
+}
 namespace main {
 class ClientContext;
 }
@@ -12,6 +15,8 @@ struct RYU_API ExecutionContext {
     uint64_t queryID;
     common::Profiler* profiler;
     main::ClientContext* clientContext;
+    // Records the timeline of the query's tasks if query tracing is enabled.
+    common::QueryTracer* tracer = nullptr;
 
     ExecutionContext(common::Profiler* profiler, main::ClientContext* clientContext,
         uint64_t queryID)
@@ -38,6 +38,9 @@ private:
     std::unique_ptr<evaluator::ExpressionEvaluator> getFunctionEvaluator(
         std::shared_ptr<binder::Expression> expression);
 
+    std::unique_ptr<evaluator::ExpressionEvaluator> getFusedEvaluator(
+        const std::shared_ptr<binder::Expression>& expression);
+
     std::unique_ptr<evaluator::ExpressionEvaluator> getNodeEvaluator(
         std::shared_ptr<binder::Expression> expression);
 
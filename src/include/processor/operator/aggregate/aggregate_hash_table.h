@@ -312,7 +312,29 @@ public:
 
 // Fixed-sized Aggregate hash table that flushes tuples into partitions in the
 // HashAggregateSharedState when full
+// Thread-local pre-aggregation table of a parallel aggregate. Groups are flushed into the radix
+// partitions of the shared state whenever the table is full, and the partitions are merged in
+// parallel by HashAggregateFinalize.
+//
+// The size of the table adapts to how well it reduces its input. If most input tuples hit an
+// existing group, the table is grown so that more duplicates are merged before being flushed. If
+// almost every tuple creates a new group, pre-aggregation only adds probing costs, so the table is
+// shrunk to a small, cache-resident buffer that is passed through to the partitions after about
+// every vector.
+//
+// A single group key with a small domain (BOOL, INT8, INT16 and their unsigned counterparts) or
+// the node IDs of a single table is aggregated directly: the slot of a group is indexed by the key
+// itself, so neither probing nor comparing keys is needed. Slot 0 holds the NULL group. Node
+// offsets grow the slots up to MAX_NUM_HASH_SLOTS; a larger offset or a second node table turns
+// the table back into a regular hash table.
 class PartitioningAggregateHashTable final : public AggregateHashTable {
+    // Groups per input tuple of a flushed table at or below which the table is grown.
+    static constexpr double GROW_REDUCTION_RATIO = 0.5;
+    // Groups per input tuple of a flushed table at or above which the table is passed through.
+    static constexpr double PASS_THROUGH_REDUCTION_RATIO = 0.9;
+    static constexpr uint64_t MAX_NUM_HASH_SLOTS = 1 << 17;
+    static constexpr uint64_t PASS_THROUGH_NUM_HASH_SLOTS = 4 * common::DEFAULT_VECTOR_CAPACITY;
+
 public:
     PartitioningAggregateHashTable(AggregatePartitioningData* partitioningData,
         storage::MemoryManager& memoryManager, std::vector<common::LogicalType> keyTypes,
@@ -323,7 +345,10 @@ public:
         : AggregateHashTable(memoryManager, std::move(keyTypes), std::move(payloadTypes),
               aggregateFunctions, distinctAggKeyTypes,
               common::DEFAULT_VECTOR_CAPACITY /*minimum size*/, tableSchema.copy()),
-          tableSchema{std::move(tableSchema)}, partitioningData{partitioningData} {}
+          tableSchema{std::move(tableSchema)}, partitioningData{partitioningData},
+          defaultNumHashSlots{maxNumHashSlots} {
+        initDirectAccess();
+    }
 
     uint64_t append(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& dependentKeyVectors,
@@ -333,9 +358,32 @@ public:
 
     void mergeIfFull(uint64_t tuplesToAdd, bool mergeAll = false);
 
+    bool isPassThrough() const { return maxNumHashSlots < defaultNumHashSlots; }
+    bool isDirectAccess() const { return directAccess; }
+
+private:
+    void adaptSize(uint64_t numGroups);
+
+    void initDirectAccess();
+    // Makes sure every key of the vector has a direct slot. Returns false if some key can't have
+    // one.
+    bool reserveDirectSlots(const common::ValueVector& keyVector);
+    void resizeDirectSlots(uint64_t newSize);
+    void disableDirectAccess();
+    void findDirectSlots(const std::vector<common::ValueVector*>& keyVectors,
+        const std::vector<common::ValueVector*>& dependentKeyVectors);
+    uint64_t getDirectSlotIdx(const common::ValueVector& keyVector, uint32_t pos) const;
+    uint64_t getDirectSlotIdx(const uint8_t* entry) const;
+
 private:
     FactorizedTableSchema tableSchema;
     AggregatePartitioningData* partitioningData;
+    uint64_t defaultNumHashSlots;
+    // Number of tuples appended since the table was last flushed.
+    uint64_t numInputTuples = 0;
+    bool directAccess = false;
+    // Table of the node IDs aggregated directly.
+    common::table_id_t directTableID = common::INVALID_TABLE_ID;
 };
 
 } // namespace processor
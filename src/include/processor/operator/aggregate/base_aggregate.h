@@ -8,6 +8,7 @@
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/factorized_table_schema.h"
+#include "processor/result/spillable_factorized_table.h"
 
 namespace ryu {
 namespace main {
@@ -82,6 +83,9 @@ protected:
                 // If it is not filled, we resize it to the actual capacity before writing it to the
                 // hashTable
                 table.resize(table.getNumTuplesPerBlock());
+                // The block stays pinned until all of its tuples have been written.
+                spillableTable = std::make_unique<SpillableFactorizedTable>(table);
+                spillableTable->pin(false /* loadSpilledBlocks */);
             }
             // numTuplesReserved may be greater than the capacity of the factorizedTable
             // if threads try to write to it while a new block is being allocated
@@ -92,6 +96,8 @@ protected:
             // finished
             std::atomic<uint64_t> numTuplesWritten;
             FactorizedTable table;
+            // Full blocks can be spilled to disk until they are merged into the hash table.
+            std::unique_ptr<SpillableFactorizedTable> spillableTable;
         };
         common::MPSCQueue<TupleBlock*> queuedTuples;
         // When queueing tuples, they are always added to the headBlock until the headBlock is full
@@ -42,6 +42,11 @@ class HashAggregateSharedState final : public BaseAggregateSharedState,
                                        public AggregatePartitioningData {
 
 public:
+    // When spilling to disk is enabled, the groups are split into at least this many partitions.
+    // Partitions are merged one at a time and the other partitions can be spilled meanwhile, so
+    // memory usage is bounded by the size of the partitions rather than the number of groups.
+    static constexpr size_t MIN_NUM_PARTITIONS_FOR_SPILLING = 16;
+
     explicit HashAggregateSharedState(main::ClientContext* context, HashAggregateInfo hashAggInfo,
         const std::vector<function::AggregateFunction>& aggregateFunctions,
         std::span<AggregateInfo> aggregateInfos, std::vector<common::LogicalType> keyTypes,
@@ -73,9 +78,12 @@ public:
 
     std::pair<uint64_t, uint64_t> getNextRangeToRead() override;
 
+    // The partition being scanned is pinned in memory until finishScan is called with the same
+    // startOffset, so that the entries remain valid.
     void scan(std::span<uint8_t*> entries, std::vector<common::ValueVector*>& keyVectors,
         common::offset_t startOffset, common::offset_t numRowsToScan,
         std::vector<uint32_t>& columnIndices);
+    void finishScan(common::offset_t startOffset);
 
     uint64_t getNumTuples() const;
 
@@ -93,7 +101,8 @@ public:
     void assertFinalized() const;
 
 protected:
-    std::tuple<const FactorizedTable*, common::offset_t> getPartitionForOffset(
+    // Returns the index of the partition containing the offset and the offset of its first tuple.
+    std::tuple<common::idx_t, common::offset_t> getPartitionForOffset(
         common::offset_t offset) const;
 
     struct Partition {
@@ -104,6 +113,8 @@ protected:
         // the same way as the main table
         std::vector<std::unique_ptr<HashTableQueue>> distinctTableQueues;
         std::atomic<bool> finalized = false;
+        // Lets finalized partitions be spilled to disk while they are not being scanned.
+        std::unique_ptr<SpillableFactorizedTable> spillableTable;
     };
 
 public:
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <mutex>
+
+#include "common/copy_constructors.h"
+#include "common/data_chunk/data_chunk.h"
+#include "common/in_mem_overflow_buffer.h"
+#include "processor/operator/aggregate/aggregate_input.h"
+#include "processor/operator/aggregate/base_aggregate_scan.h"
+#include "processor/operator/sink.h"
+#include "processor/result/factorized_table.h"
+
+namespace ryu {
+namespace processor {
+
+class StreamingAggregateSharedState {
+public:
+    explicit StreamingAggregateSharedState(std::shared_ptr<FactorizedTable> table)
+        : table{std::move(table)} {}
+
+    void mergeLocalTable(FactorizedTable& localTable) {
+        std::unique_lock lck{mtx};
+        table->merge(localTable);
+    }
+
+    std::shared_ptr<FactorizedTable> getTable() { return table; }
+
+private:
+    std::mutex mtx;
+    std::shared_ptr<FactorizedTable> table;
+};
+
+struct StreamingAggregateInfo {
+    // The node ID the input is clustered by, followed by the keys depending on it. All keys are
+    // flat.
+    std::vector<DataPos> keysPos;
+    std::vector<common::LogicalType> aggregateTypes;
+    std::vector<move_agg_result_to_vector_func> moveAggResultToVectorFuncs;
+    // Layout: [keys..., aggregate results...].
+    FactorizedTableSchema tableSchema;
+
+    StreamingAggregateInfo(std::vector<DataPos> keysPos,
+        std::vector<common::LogicalType> aggregateTypes,
+        std::vector<move_agg_result_to_vector_func> moveAggResultToVectorFuncs,
+        FactorizedTableSchema tableSchema)
+        : keysPos{std::move(keysPos)}, aggregateTypes{std::move(aggregateTypes)},
+          moveAggResultToVectorFuncs{std::move(moveAggResultToVectorFuncs)},
+          tableSchema{std::move(tableSchema)} {}
+    EXPLICIT_COPY_DEFAULT_MOVE(StreamingAggregateInfo);
+
+private:
+    StreamingAggregateInfo(const StreamingAggregateInfo& other)
+        : keysPos{other.keysPos}, aggregateTypes{common::LogicalType::copy(other.aggregateTypes)},
+          moveAggResultToVectorFuncs{other.moveAggResultToVectorFuncs},
+          tableSchema{other.tableSchema.copy()} {}
+};
+
+// Aggregates input that is clustered by its group key, i.e. all tuples of a group are produced one
+// after another by the same thread. Only the aggregate states of the current group are kept; once
+// the key changes the group is complete and its result is appended to the output table. Groups
+// are thus never hashed nor merged across threads.
+class StreamingAggregate final : public Sink {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::STREAMING_AGGREGATE;
+
+public:
+    StreamingAggregate(std::shared_ptr<StreamingAggregateSharedState> sharedState,
+        StreamingAggregateInfo info, std::vector<function::AggregateFunction> aggregateFunctions,
+        std::vector<AggregateInfo> aggInfos, std::unique_ptr<PhysicalOperator> child, uint32_t id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : Sink{type_, std::move(child), id, std::move(printInfo)},
+          sharedState{std::move(sharedState)}, info{std::move(info)},
+          aggregateFunctions{std::move(aggregateFunctions)}, aggInfos{std::move(aggInfos)} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    void executeInternal(ExecutionContext* context) override;
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<StreamingAggregate>(sharedState, info.copy(),
+            copyVector(aggregateFunctions), copyVector(aggInfos), children[0]->copy(), id,
+            printInfo->copy());
+    }
+
+private:
+    bool isCurrentGroup() const;
+    void startGroup();
+    void updateAggregateStates();
+    void finishGroup();
+    void flushGroups();
+
+private:
+    std::shared_ptr<StreamingAggregateSharedState> sharedState;
+    StreamingAggregateInfo info;
+    std::vector<function::AggregateFunction> aggregateFunctions;
+    std::vector<AggregateInfo> aggInfos;
+
+    std::vector<common::ValueVector*> keyVectors;
+    std::vector<AggregateInput> aggInputs;
+    std::vector<std::unique_ptr<function::AggregateState>> aggregateStates;
+    std::unique_ptr<common::InMemOverflowBuffer> overflowBuffer;
+    bool hasGroup = false;
+    // Finished groups not yet appended to the local table. The current group's keys are held in
+    // the next row.
+    std::unique_ptr<common::DataChunk> groupsChunk;
+    std::vector<common::ValueVector*> groupVectors;
+    uint64_t numGroups = 0;
+    std::unique_ptr<FactorizedTable> localTable;
+};
+
+} // namespace processor
+} // namespace ryu
@@ -10,16 +10,23 @@ struct CrossProductLocalState {
     std::shared_ptr<FactorizedTable> table;
     uint64_t maxMorselSize;
     uint64_t startIdx = 0u;
+    // Whether the whole table has been scanned by a single morsel. Its vectors then stay as they
+    // are and are repeated for every following left tuple instead of being scanned again.
+    bool scannedAtOnce = false;
 
     CrossProductLocalState(std::shared_ptr<FactorizedTable> table, uint64_t maxMorselSize)
         : table{std::move(table)}, maxMorselSize{maxMorselSize}, startIdx{0} {}
     EXPLICIT_COPY_DEFAULT_MOVE(CrossProductLocalState);
 
-    void init() { startIdx = table->getNumTuples(); }
+    void init() {
+        startIdx = table->getNumTuples();
+        scannedAtOnce = false;
+    }
 
 private:
     CrossProductLocalState(const CrossProductLocalState& other)
-        : table{other.table}, maxMorselSize{other.maxMorselSize}, startIdx{other.startIdx} {}
+        : table{other.table}, maxMorselSize{other.maxMorselSize}, startIdx{other.startIdx},
+          scannedAtOnce{false} {}
 };
 
 struct CrossProductInfo {
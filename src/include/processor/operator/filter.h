@@ -2,6 +2,8 @@
 
 #include "expression_evaluator/expression_evaluator.h"
 #include "processor/operator/filtering_operator.h"
+#include "processor/operator/hash_join/runtime_join_filter.h"
+#include "processor/operator/order_by/top_k_filter.h"
 #include "processor/operator/physical_operator.h"
 
 namespace ryu {
@@ -39,15 +41,36 @@ public:
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
 
+    // The probe key must be in the data chunk to select.
+    void addRuntimeJoinFilter(RuntimeJoinFilterInfo info) {
+        KU_ASSERT(info.keyPos.dataChunkPos == dataChunkToSelectPos);
+        runtimeJoinFilterInfos.push_back(std::move(info));
+    }
+    // The key must be in the data chunk to select.
+    void addTopKFilter(TopKFilterInfo info) {
+        KU_ASSERT(info.keyPos.dataChunkPos == dataChunkToSelectPos);
+        topKFilterInfos.push_back(std::move(info));
+    }
+
     std::unique_ptr<PhysicalOperator> copy() override {
-        return make_unique<Filter>(expressionEvaluator->copy(), dataChunkToSelectPos,
+        auto result = make_unique<Filter>(expressionEvaluator->copy(), dataChunkToSelectPos,
             children[0]->copy(), id, printInfo->copy());
+        result->runtimeJoinFilterInfos = runtimeJoinFilterInfos;
+        result->topKFilterInfos = topKFilterInfos;
+        return result;
     }
 
+private:
+    bool applyRuntimeFilters();
+
 private:
     std::unique_ptr<evaluator::ExpressionEvaluator> expressionEvaluator;
     uint32_t dataChunkToSelectPos;
     std::shared_ptr<common::DataChunkState> state;
+    std::vector<RuntimeJoinFilterInfo> runtimeJoinFilterInfos;
+    std::vector<RuntimeJoinFilterProber> runtimeJoinFilterProbers;
+    std::vector<TopKFilterInfo> topKFilterInfos;
+    std::vector<TopKFilterProber> topKFilterProbers;
 };
 
 struct NodeLabelFilterInfo {
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
+#include <optional>
 
 #include "binder/expression/expression.h"
 #include "join_hash_table.h"
@@ -8,6 +10,8 @@
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
 #include "processor/result/result_set.h"
+#include "processor/result/spillable_factorized_table.h"
+#include "runtime_join_filter.h"
 
 namespace ryu {
 namespace processor {
@@ -32,24 +36,115 @@ private:
 
 class HashJoinBuild;
 
+// Range of build side cardinalities the plan was chosen for. A build side whose cardinality is out
+// of this range aborts the statement with a ReoptimizeException, so that it can be planned again
+// with the observed cardinality.
+struct BuildCardinalityCheck {
+    std::string subgraphKey;
+    common::cardinality_t minCardinality;
+    common::cardinality_t maxCardinality;
+};
+
+// A build side partition of a grace hash join. Partitions that are not pinned can be spilled to
+// disk by the buffer manager.
+struct HashJoinPartition {
+    std::unique_ptr<JoinHashTable> hashTable;
+    std::unique_ptr<SpillableFactorizedTable> spillableTable;
+    // Serializes appends and building or releasing the hash slots.
+    std::mutex mtx;
+    bool finalized = false;
+    // Resident partitions keep their tuples and hash slots in memory until the join finishes.
+    bool resident = false;
+    // Number of probe threads probing a non-resident partition.
+    uint64_t numProbers = 0;
+
+    explicit HashJoinPartition(std::unique_ptr<JoinHashTable> hashTable);
+};
+
 // This is a shared state between HashJoinBuild and HashJoinProbe operators.
 // Each clone of these two operators will share the same state.
 // Inside the state, we keep the materialized tuples in factorizedTable, which are merged by each
 // HashJoinBuild thread when they finished materializing thread-local tuples. Also, the state holds
 // a global htDirectory, which will be updated by the last thread in the hash join build side
 // task/pipeline, and probed by the HashJoinProbe operators.
+//
+// If partitions are given, the join is executed as a grace hash join and the global hash table
+// is left empty. Build threads distribute their tuples over the partitions by the highest bits of
+// the hash, and the buffer manager may spill partitions to disk when it runs out of memory.
+// Partitions that are still in memory at the end of the build are probed as usual. Probe tuples
+// belonging to a spilled partition are deferred and probed against the partition, loaded back
+// from disk, once the probe side is exhausted.
+//
+// If finalized in parallel, building the hash slots is left to a HashJoinFinalize pipeline run
+// after the build pipeline. Its threads claim blocks of the global table, or partitions, one at a
+// time so that large builds don't end with a single-threaded pass over all tuples.
 class HashJoinSharedState {
 public:
+    static constexpr uint64_t NUM_PARTITIONS_LOG2 = 4;
+    static constexpr uint64_t NUM_PARTITIONS = 1 << NUM_PARTITIONS_LOG2;
+    // Thread-local tuples are moved into the partitions once they exceed this size, so that they
+    // can be spilled.
+    static constexpr uint64_t LOCAL_TABLE_FLUSH_THRESHOLD = 16 * common::TEMP_PAGE_SIZE;
+
     explicit HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable)
         : hashTable{std::move(hashTable)} {};
+    HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable,
+        std::vector<std::unique_ptr<JoinHashTable>> partitionHashTables);
 
     void mergeLocalHashTable(JoinHashTable& localHashTable);
 
     JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    void setFinalizedInParallel() { finalizedInParallel = true; }
+    bool isFinalizedInParallel() const { return finalizedInParallel; }
+    // Checks the build cardinality and allocates the hash slots of the global table.
+    void prepareHashSlots();
+    // Inserts blocks of the global table into its hash slots until no block is left. Can be called
+    // by multiple threads.
+    void buildHashSlots();
+    // Called once all hash slots and partitions are built.
+    void finishFinalize();
+
+    // Requests a runtime join filter to be built from the build keys at the end of the build.
+    void setRuntimeJoinFilter(std::shared_ptr<RuntimeJoinFilter> filter) {
+        runtimeJoinFilter = std::move(filter);
+    }
+    RuntimeJoinFilter* getRuntimeJoinFilter() const { return runtimeJoinFilter.get(); }
+
+    void setBuildCardinalityCheck(BuildCardinalityCheck check) {
+        buildCardinalityCheck = std::move(check);
+    }
+    void checkBuildCardinality(common::cardinality_t cardinality) const;
+
+    bool isPartitioned() const { return !partitions.empty(); }
+    static common::idx_t getPartitionIdx(common::hash_t hash) {
+        return hash >> (sizeof(common::hash_t) * 8 - NUM_PARTITIONS_LOG2);
+    }
+    // Moves the tuples of a thread-local hash table into the partitions and clears it.
+    void appendToPartitions(JoinHashTable& localHashTable);
+    // Builds the hash slots of partitions that have not been spilled so far and keeps them in
+    // memory. Can be called by multiple threads, each finalizing the partitions no other thread
+    // has claimed.
+    void finalizePartitions();
+    bool isPartitionResident(common::idx_t partitionIdx) const {
+        return partitions[partitionIdx]->resident;
+    }
+    JoinHashTable* getPartitionHashTable(common::idx_t partitionIdx) const {
+        return partitions[partitionIdx]->hashTable.get();
+    }
+    // Loads a spilled partition back into memory and builds its hash slots if no other thread is
+    // probing it already.
+    JoinHashTable* pinSpilledPartition(common::idx_t partitionIdx);
+    void unpinSpilledPartition(common::idx_t partitionIdx);
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    std::vector<std::unique_ptr<HashJoinPartition>> partitions;
+    std::shared_ptr<RuntimeJoinFilter> runtimeJoinFilter;
+    std::optional<BuildCardinalityCheck> buildCardinalityCheck;
+    bool finalizedInParallel = false;
+    std::atomic<common::idx_t> nextBlockIdxToBuild = 0;
 };
 
 struct HashJoinBuildInfo {
@@ -99,6 +194,8 @@ protected:
         return hashTable->appendVectors(keyVectors, payloadVectors, keyState);
     }
 
+    void flushLocalHashTableIfNecessary();
+
 private:
     void setKeyState(common::DataChunkState* state);
 
@@ -114,5 +211,34 @@ protected:
     std::unique_ptr<JoinHashTable> hashTable; // local state
 };
 
+class HashJoinFinalize final : public Sink {
+    static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::HASH_JOIN_FINALIZE;
+
+public:
+    HashJoinFinalize(std::shared_ptr<HashJoinSharedState> sharedState, physical_op_id id,
+        std::unique_ptr<OPPrintInfo> printInfo)
+        : Sink{type_, id, std::move(printInfo)}, sharedState{std::move(sharedState)} {}
+
+    bool isSource() const override { return true; }
+
+    void executeInternal(ExecutionContext* /*context*/) override {
+        if (sharedState->isPartitioned()) {
+            sharedState->finalizePartitions();
+        } else {
+            sharedState->buildHashSlots();
+        }
+    }
+    void finalizeInternal(ExecutionContext* /*context*/) override {
+        sharedState->finishFinalize();
+    }
+
+    std::unique_ptr<PhysicalOperator> copy() override {
+        return std::make_unique<HashJoinFinalize>(sharedState, id, printInfo->copy());
+    }
+
+private:
+    std::shared_ptr<HashJoinSharedState> sharedState;
+};
+
 } // namespace processor
 } // namespace ryu
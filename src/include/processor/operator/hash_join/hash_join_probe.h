@@ -35,6 +35,8 @@ public:
     ProbeDataInfo(const ProbeDataInfo& other)
         : ProbeDataInfo{other.keysDataPos, other.payloadsOutPos} {
         markDataPos = other.markDataPos;
+        deferredPos = other.deferredPos;
+        deferredSchema = other.deferredSchema.copy();
     }
 
     inline uint32_t getNumPayloads() const { return payloadsOutPos.size(); }
@@ -43,6 +45,21 @@ public:
     std::vector<DataPos> keysDataPos;
     std::vector<DataPos> payloadsOutPos;
     DataPos markDataPos;
+    // Probe side vectors materialized for probe tuples whose build side partition is spilled.
+    // Only used if the hash join is partitioned.
+    std::vector<DataPos> deferredPos;
+    FactorizedTableSchema deferredSchema;
+};
+
+// Probe tuples deferred by a thread until the probe side is exhausted, one table per build side
+// partition.
+struct DeferredProbeState {
+    std::vector<std::unique_ptr<FactorizedTable>> tables;
+    // Declared after the tables so that they are unregistered from the spiller first.
+    std::vector<std::unique_ptr<SpillableFactorizedTable>> spillableTables;
+    bool replaying = false;
+    common::idx_t partitionIdx = 0;
+    ft_tuple_idx_t nextTupleIdx = 0;
 };
 
 struct HashJoinProbePrintInfo final : OPPrintInfo {
@@ -72,7 +89,7 @@ public:
         std::unique_ptr<OPPrintInfo> printInfo)
         : PhysicalOperator{type_, std::move(probeChild), id, std::move(printInfo)},
           sharedState{std::move(sharedState)}, joinType{joinType}, flatProbe{flatProbe},
-          probeDataInfo{probeDataInfo}, markVector(nullptr) {}
+          probeDataInfo{probeDataInfo}, markVector(nullptr), probeHashTable{nullptr} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
@@ -89,6 +106,12 @@ private:
                            getMatchedTuplesForUnFlatKey(context);
     }
     bool getMatchedTuplesForFlatKey(ExecutionContext* context);
+    // Probes the next tuple against the build side partition of its hash. Tuples of spilled
+    // partitions are deferred and probed once the probe side is exhausted.
+    bool probePartitionedFlatKey(ExecutionContext* context);
+    void deferProbeTuple(common::idx_t partitionIdx);
+    bool probeNextDeferredTuple();
+    void restoreDeferredTuple(const FactorizedTable& table, ft_tuple_idx_t tupleIdx);
     // We can probe a batch of input tuples if we know they have at most one match.
     bool getMatchedTuplesForUnFlatKey(ExecutionContext* context);
 
@@ -100,6 +123,9 @@ private:
     uint64_t getLeftJoinResult();
     uint64_t getMarkJoinResult();
     uint64_t getCountJoinResult();
+    // Semi and anti joins return the probe tuples as they are, once for any number of matches.
+    uint64_t getSemiJoinResult();
+    uint64_t getAntiJoinResult();
     uint64_t getJoinResult();
 
 private:
@@ -113,6 +139,10 @@ private:
     std::vector<common::ValueVector*> keyVectors;
     common::ValueVector* markVector;
     std::unique_ptr<ProbeState> probeState;
+    // The global hash table, or the partition the current probe tuple is probed against.
+    JoinHashTable* probeHashTable;
+    std::vector<common::ValueVector*> deferredVectors;
+    std::unique_ptr<DeferredProbeState> deferredState;
 
     std::unique_ptr<common::ValueVector> hashVector;
     std::unique_ptr<common::ValueVector> tmpHashVector;
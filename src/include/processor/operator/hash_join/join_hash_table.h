@@ -9,6 +9,18 @@ class MemoryManager;
 }
 namespace processor {
 
+// Range of the keys of a join hash table whose only key is a node ID.
+struct NodeIDKeyRange {
+    common::table_id_t tableID = common::INVALID_TABLE_ID;
+    common::offset_t minOffset = common::INVALID_OFFSET;
+    common::offset_t maxOffset = 0;
+    bool singleTable = true;
+
+    void update(common::nodeID_t nodeID);
+    void merge(const NodeIDKeyRange& other);
+    bool isEmpty() const { return tableID == common::INVALID_TABLE_ID; }
+};
+
 class JoinHashTable : public BaseHashTable {
 public:
     JoinHashTable(storage::MemoryManager& memoryManager, common::logical_type_vec_t keyTypes,
@@ -23,17 +35,40 @@ public:
     uint64_t appendVectorWithSorting(common::ValueVector* keyVector,
         std::vector<common::ValueVector*> payloadVectors);
 
+    // Lets allocateHashSlots index slots directly by key offset instead of by hash if all keys
+    // are offsets of a single node table and dense enough. Probing then skips hashing and only
+    // walks chains of duplicate keys. Only valid for tables which are probed through probe().
+    void allowDirectAccess() { directAccessAllowed = true; }
+    bool isDirectAccess() const { return directAccess; }
+
     void allocateHashSlots(uint64_t numTuples);
     void buildHashSlots();
+    // Inserts the tuples of one block of the factorized table into the allocated hash slots.
+    // Different blocks can be inserted concurrently.
+    void buildHashSlots(const DataBlock& block);
+
+    // Appends copies of tuples of another join hash table with the same schema. Only valid if all
+    // columns are flat and of fixed size.
+    void appendFlatTuples(const std::vector<const uint8_t*>& tuples);
 
     // The tmpHashResultVector may be null if there is only one keyVector
     void probe(const std::vector<common::ValueVector*>& keyVectors, common::ValueVector& hashVector,
         common::SelectionVector& hashSelVec, common::ValueVector* tmpHashResultVector,
         uint8_t** probedTuples);
+    // Computes the hashes of the probe keys into hashVector. Returns false if any key is null, in
+    // which case there is nothing to probe.
+    static bool computeProbeHashes(const std::vector<common::ValueVector*>& keyVectors,
+        common::ValueVector& hashVector, common::SelectionVector& hashSelVec,
+        common::ValueVector* tmpHashResultVector);
+    // Looks up the chains of tuples for hashes computed by computeProbeHashes.
+    void lookupHashSlots(const common::ValueVector& hashVector,
+        const common::SelectionVector& hashSelVec, uint8_t** probedTuples);
     // All key vectors must be flat. Thus input is a tuple, multiple matches can be found for the
-    // given key tuple.
+    // given key tuple. At most maxNumMatches are returned, the rest of the chain is left in
+    // probedTuples.
     common::sel_t matchFlatKeys(const std::vector<common::ValueVector*>& keyVectors,
-        uint8_t** probedTuples, uint8_t** matchedTuples);
+        uint8_t** probedTuples, uint8_t** matchedTuples,
+        common::sel_t maxNumMatches = common::DEFAULT_VECTOR_CAPACITY);
     // Input is multiple tuples, at most one match exist for each key.
     common::sel_t matchUnFlatKey(common::ValueVector* keyVector, uint8_t** probedTuples,
         uint8_t** matchedTuples, common::SelectionVector& matchedTuplesSelVector);
@@ -42,18 +77,31 @@ public:
         uint8_t** tuplesToRead, uint64_t startPos, uint64_t numTuplesToRead) {
         factorizedTable->lookup(vectors, colIdxesToScan, tuplesToRead, startPos, numTuplesToRead);
     }
-    void merge(JoinHashTable& other) { factorizedTable->merge(*other.factorizedTable); }
+    void merge(JoinHashTable& other) {
+        factorizedTable->merge(*other.factorizedTable);
+        keyRange.merge(other.keyRange);
+    }
+    void clear() { factorizedTable->clear(); }
     uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + prevPtrColOffset);
     }
     uint8_t* getTupleForHash(common::hash_t hash) {
+        KU_ASSERT(!directAccess);
         auto slotIdx = getSlotIdxForHash(hash);
         KU_ASSERT(slotIdx < maxNumHashSlots);
         return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
                                 ->getData()))[slotIdx & slotIdxInBlockMask];
     }
+    common::hash_t getHash(const uint8_t* tuple) const {
+        return *(common::hash_t*)(tuple + getHashValueColOffset());
+    }
 
 private:
+    uint8_t** getSlot(uint64_t slotIdx) const {
+        return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
+                           (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
+    }
+    uint8_t* getTupleForKey(common::nodeID_t key) const;
     uint8_t** findHashSlot(const uint8_t* tuple) const;
     // This function returns the pointer that previously stored in the same slot.
     uint8_t* insertEntry(uint8_t* tuple) const;
@@ -67,6 +115,11 @@ private:
     static constexpr uint64_t PREV_PTR_COL_IDX = 1;
     static constexpr uint64_t HASH_COL_IDX = 2;
     uint64_t prevPtrColOffset;
+    // Key ranges are only tracked if the only key is a node ID.
+    bool trackKeyRange;
+    NodeIDKeyRange keyRange;
+    bool directAccessAllowed = false;
+    bool directAccess = false;
 };
 
 } // namespace processor
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/system_config.h"
+#include "common/vector/value_vector.h"
+#include "processor/data_pos.h"
+
+namespace ryu {
+namespace storage {
+class MemoryManager;
+}
+namespace processor {
+
+class DataBlock;
+class JoinHashTable;
+
+// A filter on the probe keys of an inner hash join with a single key, built from the keys of the
+// build side once the build side is finalized. Probe side operators evaluate it on whole vectors to
+// drop tuples which cannot find a match before they reach the hash join probe.
+//
+// The filter is a register-blocked bloom filter on the key hashes, i.e. all bits of a key are set
+// in the same 64-bit word, plus the [min, max] range of the keys if they are signed integers. Both
+// are conservative: keys passing the filter may still have no match.
+class RuntimeJoinFilter {
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+    static constexpr uint64_t MAX_NUM_WORDS_LOG2 = 22;
+    static constexpr uint64_t NUM_BITS_PER_HASH = 4;
+
+public:
+    explicit RuntimeJoinFilter(common::LogicalType keyType);
+
+    // Sizes the filter for the given number of keys. Must be called once, before inserting.
+    void init(uint64_t numKeys);
+    // Inserts the keys of the tuples in one block of the hash table. Blocks can be inserted
+    // concurrently.
+    void insert(const JoinHashTable& hashTable, const DataBlock& block);
+    // Makes the filter available for probing once all blocks are inserted.
+    void finalize() { built = true; }
+    bool isBuilt() const { return built; }
+
+    const common::LogicalType& getKeyType() const { return keyType; }
+    bool hasRange() const { return rangeSupported; }
+
+    bool mayContainHash(common::hash_t hash) const;
+    bool mayContainInRange(int64_t value) const { return value >= minValue && value <= maxValue; }
+
+private:
+    static uint64_t getMask(common::hash_t hash) {
+        uint64_t mask = 0;
+        for (auto i = 0u; i < NUM_BITS_PER_HASH; i++) {
+            mask |= uint64_t(1) << ((hash >> (i * 6)) & 63);
+        }
+        return mask;
+    }
+
+private:
+    common::LogicalType keyType;
+    bool rangeSupported;
+    bool built = false;
+    // Serializes merging the key ranges of blocks.
+    std::mutex mtx;
+    std::vector<uint64_t> words;
+    // The word of a hash is picked by its highest bits, the bits within the word by its lowest
+    // bits.
+    uint64_t wordIdxShift = 64;
+    int64_t minValue = 0;
+    int64_t maxValue = -1;
+};
+
+// A runtime join filter and the position of the probe key at the operator evaluating it.
+struct RuntimeJoinFilterInfo {
+    std::shared_ptr<RuntimeJoinFilter> filter;
+    DataPos keyPos;
+
+    RuntimeJoinFilterInfo(std::shared_ptr<RuntimeJoinFilter> filter, const DataPos& keyPos)
+        : filter{std::move(filter)}, keyPos{keyPos} {}
+};
+
+// Thread-local evaluation of a runtime join filter. Evaluation stops once the filter turns out to
+// drop too few tuples to pay for itself.
+class RuntimeJoinFilterProber {
+    static constexpr uint64_t NUM_TUPLES_TO_SAMPLE = 16 * common::DEFAULT_VECTOR_CAPACITY;
+    static constexpr double MIN_DROPPED_FRACTION = 0.1;
+
+public:
+    RuntimeJoinFilterProber(std::shared_ptr<RuntimeJoinFilter> filter,
+        common::ValueVector* keyVector, storage::MemoryManager* memoryManager);
+
+    // Removes tuples whose key cannot find a match from the selection vector of the key state if
+    // it is unFlat. Returns false if no tuple is left.
+    bool select();
+
+private:
+    bool mayMatch(common::sel_t hashPos, common::sel_t keyPos) const;
+
+private:
+    std::shared_ptr<RuntimeJoinFilter> filter;
+    common::ValueVector* keyVector;
+    std::unique_ptr<common::ValueVector> hashVector;
+    common::SelectionVector hashSelVec;
+    bool enabled = true;
+    uint64_t numProbed = 0;
+    uint64_t numDropped = 0;
+};
+
+} // namespace processor
+} // namespace ryu
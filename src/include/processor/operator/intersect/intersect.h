@@ -54,7 +54,8 @@ public:
 private:
     // For each build side, probe its HT and return a vector of matched flat tuples.
     void probeHTs();
-    // Left is always the one with less num of values.
+    // Left is always the one with less num of values. Right is seeked into rather than scanned,
+    // in the style of leapfrog triejoin.
     static void twoWayIntersect(common::nodeID_t* leftNodeIDs, common::SelectionVector& lSelVector,
         common::nodeID_t* rightNodeIDs, common::SelectionVector& rSelVector);
     void intersectLists(const std::vector<common::overflow_value_t>& listsToIntersect);
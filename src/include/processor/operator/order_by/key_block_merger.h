@@ -13,18 +13,24 @@ struct KeyBlockMergeMorsel;
 // This struct stores the string key column information. We can utilize the
 // pre-computed indexes and offsets to expedite the tuple comparison in merge sort.
 struct StrKeyColInfo {
-    StrKeyColInfo(uint32_t colOffsetInFT, uint32_t colOffsetInEncodedKeyBlock, bool isAscOrder)
+    StrKeyColInfo(uint32_t colOffsetInFT, uint32_t colOffsetInEncodedKeyBlock, bool isAscOrder,
+        uint32_t strPrefixLength)
         : colOffsetInFT{colOffsetInFT}, colOffsetInEncodedKeyBlock{colOffsetInEncodedKeyBlock},
-          isAscOrder{isAscOrder} {}
+          isAscOrder{isAscOrder}, strPrefixLength{strPrefixLength} {}
 
     inline uint32_t getEncodingSize() const {
-        return OrderByKeyEncoder::getEncodingSize(
-            common::LogicalType(common::LogicalTypeID::STRING));
+        return OrderByKeyEncoder::getEncodingSize(common::LogicalType::STRING(), strPrefixLength);
+    }
+
+    inline bool isLongStr(const uint8_t* tuplePtr) const {
+        return OrderByKeyEncoder::isLongStr(tuplePtr + colOffsetInEncodedKeyBlock, isAscOrder,
+            strPrefixLength);
     }
 
     uint32_t colOffsetInFT;
     uint32_t colOffsetInEncodedKeyBlock;
     bool isAscOrder;
+    uint32_t strPrefixLength;
 };
 
 class MergedKeyBlocks {
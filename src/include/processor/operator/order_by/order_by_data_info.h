@@ -14,15 +14,17 @@ struct OrderByDataInfo {
     std::vector<bool> isAscOrder;
     FactorizedTableSchema payloadTableSchema;
     std::vector<uint32_t> keyInPayloadPos;
+    // Number of leading bytes of string keys encoded into the sort key.
+    uint32_t strPrefixLength;
 
     OrderByDataInfo(std::vector<DataPos> keysPos, std::vector<DataPos> payloadsPos,
         std::vector<common::LogicalType> keyTypes, std::vector<common::LogicalType> payloadTypes,
         std::vector<bool> isAscOrder, FactorizedTableSchema payloadTableSchema,
-        std::vector<uint32_t> keyInPayloadPos)
+        std::vector<uint32_t> keyInPayloadPos, uint32_t strPrefixLength)
         : keysPos{std::move(keysPos)}, payloadsPos{std::move(payloadsPos)},
           keyTypes{std::move(keyTypes)}, payloadTypes{std::move(payloadTypes)},
           isAscOrder{std::move(isAscOrder)}, payloadTableSchema{std::move(payloadTableSchema)},
-          keyInPayloadPos{std::move(keyInPayloadPos)} {}
+          keyInPayloadPos{std::move(keyInPayloadPos)}, strPrefixLength{strPrefixLength} {}
     EXPLICIT_COPY_DEFAULT_MOVE(OrderByDataInfo);
 
 private:
@@ -31,7 +33,7 @@ private:
           keyTypes{common::LogicalType::copy(other.keyTypes)},
           payloadTypes{common::LogicalType::copy(other.payloadTypes)}, isAscOrder{other.isAscOrder},
           payloadTableSchema{other.payloadTableSchema.copy()},
-          keyInPayloadPos{other.keyInPayloadPos} {}
+          keyInPayloadPos{other.keyInPayloadPos}, strPrefixLength{other.strPrefixLength} {}
 };
 
 } // namespace processor
@@ -51,7 +51,8 @@ public:
 
     inline uint32_t getNumTuplesInCurBlock() const { return keyBlocks.back()->numTuples; }
 
-    static uint32_t getNumBytesPerTuple(const std::vector<common::ValueVector*>& keyVectors);
+    static uint32_t getNumBytesPerTuple(const std::vector<common::ValueVector*>& keyVectors,
+        uint32_t strPrefixLength);
 
     static inline uint32_t getEncodedFTBlockIdx(const uint8_t* tupleInfoPtr) {
         return *(uint32_t*)tupleInfoPtr;
@@ -71,16 +72,23 @@ public:
         return *(nullBytePtr) == (isAscOrder ? UINT8_MAX : 0);
     }
 
-    static inline bool isLongStr(const uint8_t* strBuffer, bool isAsc) {
-        return *(strBuffer + 13) == (isAsc ? UINT8_MAX : 0);
+    // A string is encoded as its first strPrefixLength bytes followed by a flag byte that tells
+    // whether the string is longer than the prefix, so strings with equal encodings only need to
+    // be compared in full if both are long.
+    static inline bool isLongStr(const uint8_t* strBuffer, bool isAsc, uint32_t strPrefixLength) {
+        return *(strBuffer + 1 + strPrefixLength) == (isAsc ? UINT8_MAX : 0);
     }
 
-    static uint32_t getEncodingSize(const common::LogicalType& dataType);
+    static uint32_t getEncodingSize(const common::LogicalType& dataType,
+        uint32_t strPrefixLength);
 
     void encodeKeys(const std::vector<common::ValueVector*>& orderByKeys);
 
     inline void clear() { keyBlocks.clear(); }
 
+    // Drops the encoded keys and starts encoding keys for an empty payload table.
+    void reset();
+
 private:
     template<typename type>
     static inline void encodeTemplate(const uint8_t* data, uint8_t* resultPtr, bool swapBytes) {
@@ -92,6 +100,9 @@ private:
         KU_UNREACHABLE;
     }
 
+    static void encodeString(const common::ku_string_t& data, uint8_t* resultPtr,
+        uint32_t strPrefixLength);
+
     static inline uint8_t flipSign(uint8_t key_byte) { return key_byte ^ 128; }
 
     void flipBytesIfNecessary(uint32_t keyColIdx, uint8_t* tuplePtr, uint32_t numEntriesToEncode,
@@ -109,12 +120,14 @@ private:
 
     void allocateMemoryIfFull();
 
-    static void getEncodingFunction(common::PhysicalTypeID physicalType, encode_function_t& func);
+    static void getEncodingFunction(common::PhysicalTypeID physicalType, uint32_t strPrefixLength,
+        encode_function_t& func);
 
 private:
     storage::MemoryManager* memoryManager;
     std::vector<std::shared_ptr<DataBlock>> keyBlocks;
     std::vector<bool> isAscOrder;
+    uint32_t strPrefixLength;
     uint32_t numBytesPerTuple;
     uint32_t maxNumTuplesPerBlock;
     uint32_t ftBlockIdx = 0;
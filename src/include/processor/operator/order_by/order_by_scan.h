@@ -9,6 +9,8 @@ namespace processor {
 struct OrderByScanLocalState {
     std::vector<common::ValueVector*> vectorsToRead;
     std::unique_ptr<PayloadScanner> payloadScanner;
+    // Merges the sorted runs of an external sort instead of scanning the merged key block.
+    std::unique_ptr<SortedRunMerger> runMerger;
     uint64_t numTuples = 0;
     uint64_t numTuplesRead = 0;
 
@@ -17,7 +19,8 @@ struct OrderByScanLocalState {
 
     // NOLINTNEXTLINE(readability-make-member-function-const): Updates vectorsToRead.
     uint64_t scan() {
-        uint64_t tuplesRead = payloadScanner->scan(vectorsToRead);
+        uint64_t tuplesRead =
+            runMerger ? runMerger->scan(vectorsToRead) : payloadScanner->scan(vectorsToRead);
         numTuplesRead += tuplesRead;
         return tuplesRead;
     }
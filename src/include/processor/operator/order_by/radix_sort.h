@@ -22,7 +22,9 @@ public:
 // string overflow pointers). The algorithm loops through each column of the orderByVectors. If it
 // sees a column with string, which is variable length, it will call radixSort to sort the columns
 // seen so far. If there are tie tuples, it will compare the overflow ptr of strings. For subsequent
-// columns, the algorithm only calls radixSort on tie tuples.
+// columns, the algorithm only calls radixSort on tie tuples. Small tie ranges and wide keys, such
+// as long string prefixes, are sorted by comparing the binary strings instead, since radix sort
+// needs a counting pass over all tuples for every byte.
 class RadixSort {
 public:
     RadixSort(storage::MemoryManager* memoryManager, FactorizedTable& factorizedTable,
@@ -31,9 +33,15 @@ public:
     void sortSingleKeyBlock(const DataBlock& keyBlock);
 
 private:
+    void sortTuples(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32_t numBytesSorted,
+        uint32_t numBytesToSort);
+
     void radixSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32_t numBytesSorted,
         uint32_t numBytesToSort);
 
+    void comparisonSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32_t numBytesSorted,
+        uint32_t numBytesToSort);
+
     std::vector<TieRange> findTies(uint8_t* keyBlockPtr, uint32_t numTuplesToFindTies,
         uint32_t numBytesToSort, uint32_t baseTupleIdx) const;
 
@@ -3,6 +3,7 @@
 #include <queue>
 
 #include "processor/operator/order_by/radix_sort.h"
+#include "processor/operator/order_by/sorted_run.h"
 #include "processor/result/factorized_table.h"
 
 namespace ryu {
@@ -10,7 +11,7 @@ namespace processor {
 
 class SortSharedState {
 public:
-    SortSharedState() : nextTableIdx{0}, numBytesPerTuple{0} {
+    SortSharedState() : nextTableIdx{0}, numBytesPerTuple{0}, runSize{0} {
         sortedKeyBlocks = std::make_unique<std::queue<std::shared_ptr<MergedKeyBlocks>>>();
     }
 
@@ -37,6 +38,17 @@ public:
         return sortedKeyBlocks->empty() ? nullptr : sortedKeyBlocks->front().get();
     }
 
+    // In external mode, each thread writes its tuples as sorted runs of about runSize bytes
+    // instead of keeping all key blocks and payloads in memory, and the runs are merged by the
+    // scan.
+    void enableExternalSort(uint64_t runSize_) { runSize = runSize_; }
+    bool isExternal() const { return runSize != 0; }
+    uint64_t getRunSize() const { return runSize; }
+
+    void appendSortedRun(std::unique_ptr<SortedRun> run);
+
+    std::vector<SortedRun*> getSortedRuns() const;
+
 private:
     std::mutex mtx;
     std::vector<std::unique_ptr<FactorizedTable>> payloadTables;
@@ -44,6 +56,8 @@ private:
     std::unique_ptr<std::queue<std::shared_ptr<MergedKeyBlocks>>> sortedKeyBlocks;
     uint32_t numBytesPerTuple;
     std::vector<StrKeyColInfo> strKeyColsInfo;
+    uint64_t runSize;
+    std::vector<std::unique_ptr<SortedRun>> sortedRuns;
 };
 
 class SortLocalState {
@@ -57,6 +71,12 @@ public:
     void finalize(SortSharedState& sharedState);
 
 private:
+    // Sorts the local tuples into a run and starts over with empty key blocks and payload table.
+    void flushRun();
+
+private:
+    SortSharedState* sharedState = nullptr;
+    storage::MemoryManager* memoryManager = nullptr;
     std::unique_ptr<OrderByKeyEncoder> orderByKeyEncoder;
     std::unique_ptr<RadixSort> radixSorter;
     uint64_t globalIdx = UINT64_MAX;
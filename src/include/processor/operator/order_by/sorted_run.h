@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstring>
+#include <mutex>
+
+#include "processor/result/factorized_table.h"
+#include "storage/buffer_manager/spillable_object.h"
+
+namespace ryu {
+namespace processor {
+
+// A sorted run holds the tuples of an external sort in key order. Each row stores the encoded key
+// (without the payload index) followed by the payload tuple, so that the run doesn't refer to the
+// payload table it was built from. Once finished, the run is registered with the spiller and its
+// blocks may be spilled to disk until the merge reaches them. The merge reads rows in order and
+// loads spilled blocks back one at a time.
+class SortedRun final : public storage::SpillableObject {
+public:
+    SortedRun(storage::MemoryManager& memoryManager, uint32_t numBytesPerKey,
+        uint32_t numBytesPerPayload);
+    ~SortedRun() override;
+    DELETE_COPY_AND_MOVE(SortedRun);
+
+    void append(const uint8_t* key, const uint8_t* payload);
+    // The run isn't read until all runs are merged, so it can be spilled once it is complete.
+    void finish();
+
+    // Rows must be read in increasing order once the run is finished.
+    uint8_t* getTuple(uint64_t tupleIdx);
+    // Frees the blocks that only contain rows before tupleIdx.
+    void releaseBlocksBefore(uint64_t tupleIdx);
+
+    storage::SpillResult spillToDisk() override;
+
+    uint64_t getNumTuples() const { return numTuples; }
+    uint32_t getNumBytesPerKey() const { return numBytesPerKey; }
+
+private:
+    storage::MemoryManager& memoryManager;
+    uint32_t numBytesPerKey;
+    uint32_t numBytesPerTuple;
+    uint32_t numTuplesPerBlock;
+    uint64_t numTuples;
+    std::vector<std::unique_ptr<DataBlock>> blocks;
+    std::mutex mtx;
+    // Blocks before this index are read by the merge and must not be spilled.
+    uint64_t numBlocksReached;
+};
+
+// Merges sorted runs with a min-heap over the next row of each run and scans the payloads of the
+// merged rows in batches.
+class SortedRunMerger {
+public:
+    SortedRunMerger(std::vector<SortedRun*> runs, FactorizedTable* payloadTable);
+
+    uint64_t scan(std::vector<common::ValueVector*> vectorsToRead);
+
+private:
+    struct RunCursor {
+        SortedRun* run;
+        uint64_t nextTupleIdx;
+        uint8_t* tuple;
+    };
+
+    bool isAfter(const RunCursor& left, const RunCursor& right) const {
+        return memcmp(left.tuple, right.tuple, numBytesPerKey) > 0;
+    }
+
+private:
+    std::vector<RunCursor> cursors;
+    FactorizedTable* payloadTable;
+    uint32_t numBytesPerKey;
+    std::vector<uint32_t> colsToScan;
+    std::unique_ptr<uint8_t*[]> tuplesToRead;
+};
+
+} // namespace processor
+} // namespace ryu
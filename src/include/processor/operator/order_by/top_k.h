@@ -5,6 +5,7 @@
 #include "binder/expression/expression.h"
 #include "processor/operator/sink.h"
 #include "sort_state.h"
+#include "storage/predicate/dynamic_predicate.h"
 
 namespace ryu {
 namespace processor {
@@ -76,7 +77,14 @@ public:
     void append(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& payloadVectors);
 
-    void reduce();
+    // Returns true if the buffer is reduced to its top tuples, which moves the boundary.
+    bool reduce();
+
+    // The first key of the last tuple kept after reducing.
+    std::unique_ptr<common::Value> getBoundaryValue() const {
+        KU_ASSERT(hasBoundaryValue);
+        return boundaryVecs[0]->getAsValue(boundaryVecs[0]->state->getSelVector()[0]);
+    }
 
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     inline void finalize() { sortState->finalize(); }
@@ -133,7 +141,8 @@ private:
 class TopKLocalState {
 public:
     void init(const OrderByDataInfo& orderByDataInfo, storage::MemoryManager* memoryManager,
-        ResultSet& resultSet, uint64_t skipNumber, uint64_t limitNumber);
+        ResultSet& resultSet, uint64_t skipNumber, uint64_t limitNumber,
+        std::shared_ptr<storage::DynamicBound> bound);
 
     void append(const std::vector<common::ValueVector*>& keyVectors,
         const std::vector<common::ValueVector*>& payloadVectors);
@@ -142,6 +151,8 @@ public:
     inline void finalize() { buffer->finalize(); }
 
     std::unique_ptr<TopKBuffer> buffer;
+    // Tightened to the local boundary whenever the buffer is reduced.
+    std::shared_ptr<storage::DynamicBound> bound;
 };
 
 class TopKSharedState {
@@ -184,9 +195,15 @@ public:
 
     void finalize(ExecutionContext* /*context*/) override { sharedState->finalize(); }
 
+    // Publishes the boundary of the first key to operators below, which drop tuples that can't be
+    // among the top k (see TopKFilterProber).
+    void setBound(std::shared_ptr<storage::DynamicBound> bound_) { bound = std::move(bound_); }
+
     std::unique_ptr<PhysicalOperator> copy() override {
-        return std::make_unique<TopK>(info.copy(), sharedState, skipNumber, limitNumber,
+        auto result = std::make_unique<TopK>(info.copy(), sharedState, skipNumber, limitNumber,
             children[0]->copy(), id, printInfo->copy());
+        result->bound = bound;
+        return result;
     }
 
 private:
@@ -195,6 +212,7 @@ private:
     std::shared_ptr<TopKSharedState> sharedState;
     uint64_t skipNumber;
     uint64_t limitNumber;
+    std::shared_ptr<storage::DynamicBound> bound;
     std::vector<common::ValueVector*> orderByVectors;
     std::vector<common::ValueVector*> payloadVectors;
 };
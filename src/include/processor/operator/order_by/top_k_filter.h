@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+
+#include "common/vector/value_vector.h"
+#include "processor/data_pos.h"
+#include "storage/predicate/dynamic_predicate.h"
+
+namespace ryu {
+namespace processor {
+
+// The boundary of the tuples kept by a TopK on its first key, and the position of the key at an
+// operator below the TopK evaluating it. Tuples whose key is strictly worse than the boundary can't
+// be among the top k.
+struct TopKFilterInfo {
+    std::shared_ptr<storage::DynamicBound> bound;
+    DataPos keyPos;
+
+    TopKFilterInfo(std::shared_ptr<storage::DynamicBound> bound, const DataPos& keyPos)
+        : bound{std::move(bound)}, keyPos{keyPos} {}
+};
+
+// Thread-local evaluation of a top-k boundary on whole vectors. Null keys are never dropped.
+class TopKFilterProber {
+public:
+    TopKFilterProber(std::shared_ptr<storage::DynamicBound> bound, common::ValueVector* keyVector)
+        : bound{std::move(bound)}, keyVector{keyVector} {}
+
+    // Removes tuples outside of the boundary from the selection vector of the key state if it is
+    // unFlat. Returns false if no tuple is left.
+    bool select();
+
+private:
+    std::shared_ptr<storage::DynamicBound> bound;
+    common::ValueVector* keyVector;
+};
+
+} // namespace processor
+} // namespace ryu
@@ -57,18 +57,15 @@ struct CopyPartitionerSharedState : public PartitionerSharedState {
     // Must only be called once for any given parameters.
     // The data gets moved out of the shared state since some of it may be spilled to disk and will
     // need to be freed after its processed.
+    // Spilled chunked groups are not loaded here. The caller loads them one at a time, so that a
+    // partition holding many rels doesn't need to fit into memory at once.
     std::unique_ptr<storage::InMemChunkedNodeGroupCollection> getPartitionBuffer(
         common::idx_t partitioningIdx, common::partition_idx_t partitionIdx) const {
         KU_ASSERT(partitioningIdx < partitioningBuffers.size());
         KU_ASSERT(partitionIdx < partitioningBuffers[partitioningIdx]->partitions.size());
 
         KU_ASSERT(partitioningBuffers[partitioningIdx]->partitions[partitionIdx].get());
-        auto partitioningBuffer =
-            std::move(partitioningBuffers[partitioningIdx]->partitions[partitionIdx]);
-        // This may still run out of memory if there isn't enough space for one partitioningBuffer
-        // per thread
-        partitioningBuffer->loadFromDisk(mm);
-        return partitioningBuffer;
+        return std::move(partitioningBuffers[partitioningIdx]->partitions[partitionIdx]);
     }
 };
 
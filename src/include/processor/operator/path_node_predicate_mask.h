@@ -0,0 +1,53 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "binder/expression/node_expression.h"
+#include "common/mask.h"
+#include "expression_evaluator/expression_evaluator.h"
+#include "planner/operator/schema.h"
+#include "processor/result/result_set.h"
+#include "storage/table/node_table.h"
+
+namespace ryu {
+namespace processor {
+
+// Mask of the nodes of a table which satisfy the node predicate of a recursive pattern. Unlike a
+// semi mask computed by scanning the whole table upfront, the predicate is evaluated the first time
+// a node is checked by looking up its properties, and the result is cached. Checks may come from
+// multiple threads.
+class PathNodePredicateMask final : public common::SemiMask {
+public:
+    PathNodePredicateMask(main::ClientContext* context, const binder::NodeExpression& node,
+        common::table_id_t tableID, const std::shared_ptr<binder::Expression>& predicate);
+
+    void mask(common::offset_t) override { KU_UNREACHABLE; }
+    void maskRange(common::offset_t, common::offset_t) override { KU_UNREACHABLE; }
+
+    bool isMasked(common::offset_t nodeOffset) override;
+
+    common::offset_vec_t range(common::offset_t, common::offset_t) override { KU_UNREACHABLE; }
+    common::offset_t nextMaskedOffset(common::offset_t) const override { KU_UNREACHABLE; }
+
+    // Only counts the nodes checked so far.
+    uint64_t getNumMaskedNodes() const override;
+
+    common::offset_vec_t collectMaskedNodes(uint64_t) const override { KU_UNREACHABLE; }
+
+private:
+    bool evaluate(common::offset_t nodeOffset);
+
+private:
+    main::ClientContext* context;
+    storage::NodeTable& table;
+    planner::Schema schema;
+    std::unique_ptr<ResultSet> resultSet;
+    std::unique_ptr<storage::NodeTableScanState> scanState;
+    std::unique_ptr<evaluator::ExpressionEvaluator> predicateEvaluator;
+    mutable std::mutex mtx;
+    std::unordered_map<common::offset_t, bool> results;
+};
+
+} // namespace processor
+} // namespace ryu
@@ -5,13 +5,21 @@
 namespace ryu {
 namespace storage {
 class CSRNodeGroup;
+class MemoryManager;
 struct InMemChunkedCSRHeader;
 } // namespace storage
 
 namespace processor {
 
+// The chunked groups of the partition may be spilled to disk. Each pass over the partition loads
+// one group at a time and allows it to be spilled again afterwards, and groups are freed as soon as
+// they have been written to the CSR node group.
 struct CopyRelBatchInsertExecutionState : RelBatchInsertExecutionState {
     std::unique_ptr<storage::InMemChunkedNodeGroupCollection> partitioningBuffer;
+    storage::MemoryManager* mm = nullptr;
+    common::offset_t startNodeOffset = 0;
+
+    ~CopyRelBatchInsertExecutionState() override;
 };
 
 class CopyRelBatchInsert final : public RelBatchInsertImpl {
@@ -38,10 +46,16 @@ public:
 private:
     static void setRowIdxFromCSROffsets(storage::ColumnChunkData& rowIdxChunk,
         storage::ColumnChunkData& csrOffsetChunk);
+    // Same as setRowIdxFromCSROffsets, but orders the rels of each CSR list by their sort key.
+    static void setRowIdxFromSortedCSROffsets(storage::MemoryManager& mm,
+        storage::InMemChunkedNodeGroupCollection& partition,
+        common::column_id_t boundNodeOffsetColumn, common::column_id_t sortColumn,
+        storage::ColumnChunkData& csrOffsetChunk);
 
-    static void populateCSRLengthsInternal(const storage::InMemChunkedCSRHeader& csrHeader,
-        common::offset_t numNodes, storage::InMemChunkedNodeGroupCollection& partition,
-        common::column_id_t boundNodeOffsetColumn);
+    static void populateCSRLengthsInternal(storage::MemoryManager& mm,
+        const storage::InMemChunkedCSRHeader& csrHeader, common::offset_t numNodes,
+        storage::InMemChunkedNodeGroupCollection& partition,
+        common::column_id_t boundNodeOffsetColumn, common::offset_t startNodeOffset);
 };
 
 } // namespace processor
@@ -7,6 +7,7 @@
 #include "processor/operator/persistent/index_builder.h"
 #include "storage/stats/table_stats.h"
 #include "storage/table/chunked_node_group.h"
+#include "storage/table/node_table.h"
 
 namespace ryu {
 namespace storage {
@@ -18,6 +19,7 @@ class Transaction;
 
 namespace processor {
 struct ExecutionContext;
+class NodeGroupWriter;
 
 struct NodeBatchInsertPrintInfo final : OPPrintInfo {
     std::string tableName;
@@ -38,6 +40,8 @@ private:
 struct NodeBatchInsertInfo final : BatchInsertInfo {
     evaluator::evaluator_vector_t columnEvaluators;
     std::vector<common::ColumnEvaluateType> evaluateTypes;
+    // Rows whose primary key already exists update the existing node instead of being inserted
+    bool updateOnConflict = false;
 
     NodeBatchInsertInfo(std::string tableName, std::vector<common::LogicalType> warningColumnTypes,
         std::vector<std::unique_ptr<evaluator::ExpressionEvaluator>> columnEvaluators,
@@ -47,7 +51,7 @@ struct NodeBatchInsertInfo final : BatchInsertInfo {
 
     NodeBatchInsertInfo(const NodeBatchInsertInfo& other)
         : BatchInsertInfo{other}, columnEvaluators{copyVector(other.columnEvaluators)},
-          evaluateTypes{other.evaluateTypes} {}
+          evaluateTypes{other.evaluateTypes}, updateOnConflict{other.updateOnConflict} {}
 
     std::unique_ptr<BatchInsertInfo> copy() const override {
         return std::make_unique<NodeBatchInsertInfo>(*this);
@@ -86,8 +90,20 @@ struct NodeBatchInsertLocalState final : BatchInsertLocalState {
 
     storage::TableStats stats;
 
-    explicit NodeBatchInsertLocalState(std::span<common::LogicalType> outputDataTypes)
-        : stats{outputDataTypes} {}
+    // Single row vectors and per column update states used to update the nodes whose primary key
+    // already exists when updateOnConflict is set
+    std::unique_ptr<common::ValueVector> upsertNodeIDVector;
+    std::vector<std::unique_ptr<common::ValueVector>> upsertPropertyVectors;
+    std::vector<std::unique_ptr<storage::NodeTableUpdateState>> upsertUpdateStates;
+    std::shared_ptr<common::SelectionVector> insertSelVector;
+
+    // Writes full node groups on the workers of the task scheduler. Declared last so that pending
+    // writes are finished before the index builder, error handler and allocator they use are
+    // destroyed.
+    std::unique_ptr<NodeGroupWriter> nodeGroupWriter;
+
+    explicit NodeBatchInsertLocalState(std::span<common::LogicalType> outputDataTypes);
+    ~NodeBatchInsertLocalState() override;
 };
 
 class NodeBatchInsert final : public BatchInsert {
@@ -131,6 +147,12 @@ private:
         common::offset_t startIndexInGroup) const;
 
     void copyToNodeGroup(transaction::Transaction* transaction, storage::MemoryManager* mm) const;
+    // Hands the full local node group to the background writer and continues with an empty one.
+    void writeNodeGroupInBackground(storage::MemoryManager* mm) const;
+    void initUpsertState(ExecutionContext* context) const;
+    // Updates the nodes whose primary key already exists and filters them out of the selected
+    // rows, so that only the new nodes are appended. Returns the number of updated nodes.
+    uint64_t updateExistingNodes(transaction::Transaction* transaction) const;
 
     NodeBatchInsertErrorHandler createErrorHandler(ExecutionContext* context) const;
 
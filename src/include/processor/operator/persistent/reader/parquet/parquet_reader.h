@@ -9,6 +9,7 @@
 #include "parquet_types.h"
 #include "protocol/TCompactProtocol.h"
 #include "resizable_buffer.h"
+#include "storage/predicate/column_predicate.h"
 
 namespace ryu {
 namespace processor {
@@ -49,6 +50,10 @@ public:
     bool scanInternal(ParquetReaderScanState& state, common::DataChunk& result);
     void scan(ParquetReaderScanState& state, common::DataChunk& result);
     uint64_t getNumRowsGroups() { return metadata->row_groups.size(); }
+    // Whether the statistics of the row group show that none of its rows satisfy the predicates
+    // of its columns.
+    bool canSkipRowGroup(uint64_t groupIdx,
+        const std::vector<storage::ColumnPredicateSet>& columnPredicates) const;
 
     uint32_t getNumColumns() const { return columnNames.size(); }
     std::string getColumnName(uint32_t idx) const { return columnNames[idx]; }
@@ -93,10 +98,13 @@ private:
 
 struct ParquetScanSharedState final : function::ScanFileWithProgressSharedState {
     explicit ParquetScanSharedState(common::FileScanInfo fileScanInfo, uint64_t numRows,
-        main::ClientContext* context, std::vector<bool> columnSkips);
+        main::ClientContext* context, std::vector<bool> columnSkips,
+        std::vector<storage::ColumnPredicateSet> columnPredicates);
 
     std::vector<std::unique_ptr<ParquetReader>> readers;
     std::vector<bool> columnSkips;
+    // Predicates pushed down into the scan, used to skip row groups by their statistics.
+    std::vector<storage::ColumnPredicateSet> columnPredicates;
     uint64_t totalRowsGroups;
     std::atomic<uint64_t> numBlocksReadByFiles;
 };
@@ -44,6 +44,8 @@ struct RYU_API RelBatchInsertInfo final : BatchInsertInfo {
     common::table_id_t fromTableID, toTableID;
     uint64_t partitioningIdx = UINT64_MAX;
     common::column_id_t boundNodeOffsetColumnID = common::INVALID_COLUMN_ID;
+    // Column of the partitioned data holding the sort property, if the rel group has one.
+    common::column_id_t sortColumnID = common::INVALID_COLUMN_ID;
 
     RelBatchInsertInfo(std::string tableName, std::vector<common::LogicalType> warningColumnTypes,
         common::table_id_t fromTableID, common::table_id_t toTableID,
@@ -53,7 +55,8 @@ struct RYU_API RelBatchInsertInfo final : BatchInsertInfo {
     RelBatchInsertInfo(const RelBatchInsertInfo& other)
         : BatchInsertInfo{other}, direction{other.direction}, fromTableID{other.fromTableID},
           toTableID{other.toTableID}, partitioningIdx{other.partitioningIdx},
-          boundNodeOffsetColumnID{other.boundNodeOffsetColumnID} {}
+          boundNodeOffsetColumnID{other.boundNodeOffsetColumnID},
+          sortColumnID{other.sortColumnID} {}
 
     std::unique_ptr<BatchInsertInfo> copy() const override {
         return std::make_unique<RelBatchInsertInfo>(*this);
@@ -155,7 +158,7 @@ private:
     void populateCSRHeader(const catalog::RelGroupCatalogEntry& relGroupEntry,
         RelBatchInsertExecutionState& executionState, common::offset_t startNodeOffset,
         const RelBatchInsertInfo& relInfo, const RelBatchInsertLocalState& localState,
-        common::offset_t numNodes, bool leaveGaps);
+        common::offset_t numNodes, bool leaveGaps, double packedDensity);
 
     static void checkRelMultiplicityConstraint(const catalog::RelGroupCatalogEntry& relGroupEntry,
         const storage::InMemChunkedCSRHeader& csrHeader, common::offset_t startNodeOffset,
@@ -19,6 +19,8 @@ public:
     std::vector<PageWriteInformation> writeInfo;
     std::unique_ptr<ColumnWriterStatistics> statsState;
     uint64_t currentPage = 0;
+    // The serialized column chunk with offsets relative to its start until it is appended.
+    std::unique_ptr<common::BufferWriter> chunkBuffer;
 };
 
 class BasicColumnWriter : public ColumnWriter {
@@ -36,6 +38,7 @@ public:
         uint64_t count) override;
     void beginWrite(ColumnWriterState& state) override;
     void write(ColumnWriterState& state, common::ValueVector* vector, uint64_t count) override;
+    void finalizeChunk(ColumnWriterState& state) override;
     void finalizeWrite(ColumnWriterState& state) override;
 
 protected:
@@ -24,6 +24,7 @@ public:
     void beginWrite(ColumnWriterState& state) override;
     void write(ColumnWriterState& writerState, common::ValueVector* vector,
         uint64_t count) override;
+    void finalizeChunk(ColumnWriterState& writerState) override;
     void finalizeWrite(ColumnWriterState& writerState) override;
 
 private:
@@ -38,6 +38,24 @@ private:
     common::offset_t& offset;
 };
 
+// Serializes thrift objects into memory, so column chunks can be serialized without the lock of the
+// writer.
+class ParquetBufferTransport : public ryu_apache::thrift::protocol::TTransport {
+public:
+    explicit ParquetBufferTransport(common::BufferWriter& buffer) : buffer{buffer} {}
+
+    inline bool isOpen() const override { return true; }
+
+    void open() override {}
+
+    void close() override {}
+
+    inline void write_virt(const uint8_t* buf, uint32_t len) override { buffer.write(buf, len); }
+
+private:
+    common::BufferWriter& buffer;
+};
+
 struct PreparedRowGroup {
     ryu_parquet::format::RowGroup rowGroup;
     std::vector<std::unique_ptr<ColumnWriterState>> states;
@@ -50,7 +68,7 @@ public:
         main::ClientContext* context);
 
     inline common::offset_t getOffset() const { return fileOffset; }
-    inline void write(const uint8_t* buf, uint32_t len) {
+    inline void write(const uint8_t* buf, uint64_t len) {
         fileInfo->writeFile(buf, len, fileOffset);
         fileOffset += len;
     }
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <array>
+#include <optional>
+
 #include "planner/operator/operator_print_info.h"
 #include "processor/result/result_set.h"
 
 namespace ryu::common {
+class HardwareCounters;
+class MemoryTracker;
 class Profiler;
 class NumericMetric;
 class TimeMetric;
@@ -38,6 +43,7 @@ enum class PhysicalOperatorType : uint8_t {
     FILTER,
     FLATTEN,
     HASH_JOIN_BUILD,
+    HASH_JOIN_FINALIZE,
     HASH_JOIN_PROBE,
     IMPORT_DATABASE,
     INDEX_LOOKUP,
@@ -62,6 +68,7 @@ enum class PhysicalOperatorType : uint8_t {
     SET_PROPERTY,
     SKIP,
     STANDALONE_CALL,
+    STREAMING_AGGREGATE,
     TABLE_FUNCTION_CALL,
     TOP_K,
     TOP_K_SCAN,
@@ -81,12 +88,36 @@ struct PhysicalOperatorUtils {
     RYU_API static std::string operatorTypeToString(PhysicalOperatorType operatorType);
 };
 
+enum class OperatorCounter : uint8_t {
+    PAGE_ACCESSES = 0,
+    PAGE_MISSES = 1,
+    BYTES_READ = 2,
+    CYCLES = 3,
+    INSTRUCTIONS = 4,
+    LLC_MISSES = 5,
+};
+
 struct OperatorMetrics {
+    static constexpr uint32_t NUM_COUNTERS = 6;
+
     common::TimeMetric& executionTime;
     common::NumericMetric& numOutputTuple;
+    // Counters of the thread sampled around each call to getNextTuple, indexed by OperatorCounter.
+    // Null if not profiled. Hardware counters are only profiled if enabled and available.
+    std::array<common::NumericMetric*, NUM_COUNTERS> counters{};
+    std::array<uint64_t, NUM_COUNTERS> startValues{};
+    common::HardwareCounters* hardwareCounters = nullptr;
+    // Memory allocated while the operator runs is accounted to this tracker.
+    common::MemoryTracker* memoryTracker = nullptr;
 
     OperatorMetrics(common::TimeMetric& executionTime, common::NumericMetric& numOutputTuple)
         : executionTime{executionTime}, numOutputTuple{numOutputTuple} {}
+
+    void startCounters();
+    void stopCounters();
+
+private:
+    std::array<uint64_t, NUM_COUNTERS> readCounters() const;
 };
 
 using physical_op_vector_t = std::vector<std::unique_ptr<PhysicalOperator>>;
@@ -137,6 +168,15 @@ public:
 
     const OPPrintInfo* getPrintInfo() const { return printInfo.get(); }
 
+    // Number of output tuples estimated by the planner, if the operator was mapped from a logical
+    // operator.
+    void setEstimatedCardinality(common::cardinality_t cardinality) {
+        estimatedCardinality = cardinality;
+    }
+    std::optional<common::cardinality_t> getEstimatedCardinality() const {
+        return estimatedCardinality;
+    }
+
     virtual std::unique_ptr<PhysicalOperator> copy() = 0;
 
     virtual double getProgress(ExecutionContext* context) const;
@@ -158,11 +198,20 @@ protected:
 
     std::string getTimeMetricKey() const { return "time-" + std::to_string(id); }
     std::string getNumTupleMetricKey() const { return "numTuple-" + std::to_string(id); }
+    std::string getCounterMetricKey(OperatorCounter counter) const {
+        return "counter" + std::to_string(static_cast<uint8_t>(counter)) + "-" +
+               std::to_string(id);
+    }
 
     void registerProfilingMetrics(common::Profiler* profiler);
+    // Returns the tracker of the operator, which its clones share, or nullptr if memory is not
+    // tracked.
+    common::MemoryTracker* getMemoryTracker(common::Profiler* profiler) const;
 
     double getExecutionTime(common::Profiler& profiler) const;
     uint64_t getNumOutputTuples(common::Profiler& profiler) const;
+    // Returns the counter accumulated by this operator excluding its child.
+    uint64_t getCounter(common::Profiler& profiler, OperatorCounter counter) const;
 
     virtual void finalizeInternal(ExecutionContext* /*context*/) {}
 
@@ -174,6 +223,7 @@ protected:
     physical_op_vector_t children;
     ResultSet* resultSet;
     std::unique_ptr<OPPrintInfo> printInfo;
+    std::optional<common::cardinality_t> estimatedCardinality;
 };
 
 } // namespace processor
@@ -24,6 +24,9 @@ private:
 
 class RecursiveExtend : public Sink {
     static constexpr PhysicalOperatorType type_ = PhysicalOperatorType::RECURSIVE_EXTEND;
+    // Sources of a node table are batched into multi-source BFS's if there are at least this
+    // many. With fewer sources, single-source BFS's with sparse frontiers are cheaper.
+    static constexpr uint64_t MIN_NUM_SOURCES_FOR_MULTI_SOURCE = 8;
 
 public:
     RecursiveExtend(std::unique_ptr<function::RJAlgorithm> function, function::RJBindData bindData,
@@ -45,6 +48,9 @@ public:
             printInfo->copy());
     }
 
+private:
+    void runMultiSource(ExecutionContext* context, std::vector<common::nodeID_t> sourceNodeIDs);
+
 private:
     std::unique_ptr<function::RJAlgorithm> function;
     function::RJBindData bindData;
@@ -6,6 +6,7 @@
 #include "common/enums/accumulate_type.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_stream.h"
 
 namespace ryu {
 namespace processor {
@@ -22,9 +23,14 @@ public:
 
     std::shared_ptr<FactorizedTable> getTable() { return table; }
 
+    void setStream(std::shared_ptr<ResultStream> stream_) { stream = std::move(stream_); }
+    ResultStream* getStream() const { return stream.get(); }
+
 private:
     std::mutex mtx;
     std::shared_ptr<FactorizedTable> table;
+    // If set, local tables are handed to the consumer through the stream instead of being merged.
+    std::shared_ptr<ResultStream> stream;
 };
 
 struct ResultCollectorInfo {
@@ -83,6 +89,10 @@ public:
 
     std::unique_ptr<main::QueryResult> getQueryResult() const override;
 
+    void setResultStream(std::shared_ptr<ResultStream> stream) {
+        sharedState->setStream(std::move(stream));
+    }
+
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<ResultCollector>(info.copy(), sharedState, children[0]->copy(), id,
             printInfo->copy());
@@ -93,6 +103,9 @@ private:
 
     void initNecessaryLocalState(ResultSet* resultSet, ExecutionContext* context);
 
+    // Returns false if the consumer closed the stream.
+    bool pushLocalTable(ExecutionContext* context);
+
 private:
     ResultCollectorInfo info;
     std::shared_ptr<ResultCollectorSharedState> sharedState;
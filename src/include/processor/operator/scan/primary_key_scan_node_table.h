@@ -42,12 +42,12 @@ class PrimaryKeyScanNodeTable : public ScanTable {
 
 public:
     PrimaryKeyScanNodeTable(ScanOpInfo opInfo, std::vector<ScanNodeTableInfo> tableInfos,
-        std::unique_ptr<evaluator::ExpressionEvaluator> indexEvaluator,
+        std::unique_ptr<evaluator::ExpressionEvaluator> indexEvaluator, bool isKeyList,
         std::shared_ptr<PrimaryKeyScanSharedState> sharedState, physical_op_id id,
         std::unique_ptr<OPPrintInfo> printInfo)
         : ScanTable{type_, std::move(opInfo), id, std::move(printInfo)}, scanState{nullptr},
           tableInfos{std::move(tableInfos)}, indexEvaluator{std::move(indexEvaluator)},
-          sharedState{std::move(sharedState)} {}
+          isKeyList{isKeyList}, sharedState{std::move(sharedState)} {}
 
     bool isSource() const override { return true; }
 
@@ -59,14 +59,29 @@ public:
 
     std::unique_ptr<PhysicalOperator> copy() override {
         return std::make_unique<PrimaryKeyScanNodeTable>(opInfo.copy(), copyVector(tableInfos),
-            indexEvaluator->copy(), sharedState, id, printInfo->copy());
+            indexEvaluator->copy(), isKeyList, sharedState, id, printInfo->copy());
     }
 
+private:
+    bool getNextKeyListTuple(ExecutionContext* context);
+    // Looks up the offsets of all keys of the list in the table of tableIdx. They are sorted by
+    // offset, which also drops duplicate keys.
+    void lookupKeyList(ExecutionContext* context, common::idx_t tableIdx);
+    bool scanNode(ExecutionContext* context, ScanNodeTableInfo& tableInfo,
+        common::offset_t nodeOffset);
+
 private:
     std::unique_ptr<storage::NodeTableScanState> scanState;
     std::vector<ScanNodeTableInfo> tableInfos;
     std::unique_ptr<evaluator::ExpressionEvaluator> indexEvaluator;
+    bool isKeyList;
     std::shared_ptr<PrimaryKeyScanSharedState> sharedState;
+
+    // Offsets of the keys of the list found in the table of keyListTableIdx, which are scanned one
+    // at a time.
+    common::idx_t keyListTableIdx = common::INVALID_IDX;
+    std::vector<common::offset_t> keyListOffsets;
+    common::idx_t nextKeyListOffsetIdx = 0;
 };
 
 } // namespace processor
@@ -40,15 +40,20 @@ public:
         }
     }
 
-    bool scan(main::ClientContext* context, storage::RelTableScanState& scanState,
+    // Each table keeps its own scan state, which is set to the table once. Switching to the next
+    // table for a bound node then only initializes the state for the node.
+    void initScanStates(main::ClientContext* context, common::ValueVector* boundNodeIDVector,
         const std::vector<common::ValueVector*>& outVectors);
 
+    bool scan(main::ClientContext* context);
+
 private:
     RelTableCollectionScanner(const RelTableCollectionScanner& other)
         : relInfos{copyVector(other.relInfos)} {}
 
 private:
     std::vector<ScanRelTableInfo> relInfos;
+    std::vector<std::unique_ptr<storage::RelTableScanState>> scanStates;
     std::vector<bool> directionValues;
     common::ValueVector* directionVector = nullptr;
     common::idx_t currentTableIdx = common::INVALID_IDX;
@@ -64,7 +69,7 @@ public:
         std::unique_ptr<PhysicalOperator> child, physical_op_id id,
         std::unique_ptr<OPPrintInfo> printInfo)
         : ScanTable{type_, std::move(info), std::move(child), id, std::move(printInfo)},
-          directionInfo{std::move(directionInfo)}, scanState{nullptr}, boundNodeIDVector{nullptr},
+          directionInfo{std::move(directionInfo)}, boundNodeIDVector{nullptr},
           scanners{std::move(scanners)}, currentScanner{nullptr} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
@@ -82,7 +87,6 @@ private:
 
 private:
     DirectionInfo directionInfo;
-    std::unique_ptr<storage::RelTableScanState> scanState;
 
     common::ValueVector* boundNodeIDVector;
     common::table_id_map_t<RelTableCollectionScanner> scanners;
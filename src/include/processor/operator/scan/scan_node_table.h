@@ -1,5 +1,7 @@
 #pragma once
 
+#include "processor/operator/hash_join/runtime_join_filter.h"
+#include "processor/operator/order_by/top_k_filter.h"
 #include "processor/operator/scan/scan_table.h"
 #include "storage/predicate/column_predicate.h"
 #include "storage/table/node_table.h"
@@ -16,10 +18,12 @@ struct ScanNodeTableProgressSharedState {
 
 class ScanNodeTableSharedState {
 public:
-    explicit ScanNodeTableSharedState(std::unique_ptr<common::SemiMask> semiMask)
+    explicit ScanNodeTableSharedState(std::unique_ptr<common::SemiMask> semiMask,
+        uint64_t partitionIdx = 0, uint64_t numPartitions = 1)
         : table{nullptr}, currentCommittedGroupIdx{common::INVALID_NODE_GROUP_IDX},
           currentUnCommittedGroupIdx{common::INVALID_NODE_GROUP_IDX}, numCommittedNodeGroups{0},
-          numUnCommittedNodeGroups{0}, semiMask{std::move(semiMask)} {};
+          numUnCommittedNodeGroups{0}, semiMask{std::move(semiMask)}, partitionIdx{partitionIdx},
+          numPartitions{numPartitions} {};
 
     void initialize(const transaction::Transaction* transaction, storage::NodeTable* table,
         ScanNodeTableProgressSharedState& progressSharedState);
@@ -29,6 +33,12 @@ public:
 
     common::SemiMask* getSemiMask() const { return semiMask.get(); }
 
+private:
+    // Moves to the first committed node group with a masked node.
+    void skipUnmaskedNodeGroups(ScanNodeTableProgressSharedState& progressSharedState);
+    // Moves to the first committed node group of the partition.
+    void skipNodeGroupsOfOtherPartitions(ScanNodeTableProgressSharedState& progressSharedState);
+
 private:
     std::mutex mtx;
     storage::NodeTable* table;
@@ -37,17 +47,23 @@ private:
     common::node_group_idx_t numCommittedNodeGroups;
     common::node_group_idx_t numUnCommittedNodeGroups;
     std::unique_ptr<common::SemiMask> semiMask;
+    uint64_t partitionIdx;
+    uint64_t numPartitions;
 };
 
 struct ScanNodeTablePrintInfo final : OPPrintInfo {
     std::vector<std::string> tableNames;
     std::string alias;
     binder::expression_vector properties;
+    uint64_t partitionIdx;
+    uint64_t numPartitions;
 
     ScanNodeTablePrintInfo(std::vector<std::string> tableNames, std::string alias,
-        binder::expression_vector properties)
+        binder::expression_vector properties, uint64_t partitionIdx = 0,
+        uint64_t numPartitions = 1)
         : tableNames{std::move(tableNames)}, alias{std::move(alias)},
-          properties{std::move(properties)} {}
+          properties{std::move(properties)}, partitionIdx{partitionIdx},
+          numPartitions{numPartitions} {}
 
     std::string toString() const override;
 
@@ -58,7 +74,8 @@ struct ScanNodeTablePrintInfo final : OPPrintInfo {
 private:
     ScanNodeTablePrintInfo(const ScanNodeTablePrintInfo& other)
         : OPPrintInfo{other}, tableNames{other.tableNames}, alias{other.alias},
-          properties{other.properties} {}
+          properties{other.properties}, partitionIdx{other.partitionIdx},
+          numPartitions{other.numPartitions} {}
 };
 
 struct ScanNodeTableInfo : ScanTableInfo {
@@ -91,6 +108,17 @@ public:
 
     common::table_id_map_t<common::SemiMask*> getSemiMasks() const;
 
+    // Scanned tuples not passing the filter are dropped before they are returned.
+    void addRuntimeJoinFilter(RuntimeJoinFilterInfo info) {
+        runtimeJoinFilterInfos.push_back(std::move(info));
+    }
+
+    // Node groups are skipped by the zone maps of the key column if no key can satisfy the
+    // boundary, and scanned tuples not satisfying it are dropped. propertyIdx is the position of
+    // the key among the scanned properties.
+    void addTopKFilter(TopKFilterInfo info, common::idx_t propertyIdx,
+        const std::string& propertyName);
+
     bool isSource() const override { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
@@ -103,8 +131,11 @@ public:
     }
 
     std::unique_ptr<PhysicalOperator> copy() override {
-        return std::make_unique<ScanNodeTable>(opInfo.copy(), copyVector(tableInfos), sharedStates,
-            id, printInfo->copy(), progressSharedState);
+        auto result = std::make_unique<ScanNodeTable>(opInfo.copy(), copyVector(tableInfos),
+            sharedStates, id, printInfo->copy(), progressSharedState);
+        result->runtimeJoinFilterInfos = runtimeJoinFilterInfos;
+        result->topKFilterInfos = topKFilterInfos;
+        return result;
     }
 
     double getProgress(ExecutionContext* context) const override;
@@ -114,12 +145,18 @@ private:
 
     void initCurrentTable(ExecutionContext* context);
 
+    bool applyRuntimeFilters();
+
 private:
     common::idx_t currentTableIdx;
     std::unique_ptr<storage::NodeTableScanState> scanState;
     std::vector<ScanNodeTableInfo> tableInfos;
     std::vector<std::shared_ptr<ScanNodeTableSharedState>> sharedStates;
     std::shared_ptr<ScanNodeTableProgressSharedState> progressSharedState;
+    std::vector<RuntimeJoinFilterInfo> runtimeJoinFilterInfos;
+    std::vector<RuntimeJoinFilterProber> runtimeJoinFilterProbers;
+    std::vector<TopKFilterInfo> topKFilterInfos;
+    std::vector<TopKFilterProber> topKFilterProbers;
 };
 
 } // namespace processor
@@ -14,6 +14,8 @@ namespace processor {
 
 struct ScanRelTableInfo : ScanTableInfo {
     common::RelDataDirection direction;
+    // Column of the rel group's sort property, if it has one.
+    common::column_id_t sortColumnID = common::INVALID_COLUMN_ID;
 
     ScanRelTableInfo(storage::Table* table,
         std::vector<storage::ColumnPredicateSet> columnPredicates,
@@ -26,7 +28,7 @@ struct ScanRelTableInfo : ScanTableInfo {
 
 private:
     ScanRelTableInfo(const ScanRelTableInfo& other)
-        : ScanTableInfo{other}, direction{other.direction} {}
+        : ScanTableInfo{other}, direction{other.direction}, sortColumnID{other.sortColumnID} {}
 };
 
 struct ScanRelTablePrintInfo final : OPPrintInfo {
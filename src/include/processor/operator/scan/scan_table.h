@@ -64,6 +64,9 @@ struct ScanTableInfo {
     virtual ~ScanTableInfo() = default;
 
     void addColumnInfo(common::column_id_t columnID, ColumnCaster caster);
+    // Adds a zone map predicate on the idx-th scanned column. Columns which are cast after
+    // scanning are skipped, since their zone maps are of a different type.
+    void addColumnPredicate(common::idx_t idx, std::unique_ptr<storage::ColumnPredicate> predicate);
 
     virtual void initScanState(storage::TableScanState& scanState,
         const std::vector<common::ValueVector*>& outVectors, main::ClientContext* context) = 0;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/exception/internal.h"
+#include "common/memory_tracker.h"
 #include "common/metric.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/result/factorized_table.h"
@@ -31,6 +32,7 @@ public:
 
     void execute(ResultSet* resultSet, ExecutionContext* context) {
         initLocalState(resultSet, context);
+        common::MemoryTrackerScope memoryScope{metrics->memoryTracker};
         metrics->executionTime.start();
         executeInternal(context);
         metrics->executionTime.stop();
@@ -50,6 +52,13 @@ public:
 
     virtual bool terminate() const { return false; }
 
+    // Child pipelines of some sinks, e.g. the tables of an export, don't depend on each other. Up
+    // to this many of them are then run concurrently. 1 runs them one after another.
+    void setMaxNumConcurrentChildren(uint64_t numChildren) {
+        maxNumConcurrentChildren = numChildren;
+    }
+    uint64_t getMaxNumConcurrentChildren() const { return maxNumConcurrentChildren; }
+
     std::unique_ptr<PhysicalOperator> copy() override = 0;
 
 protected:
@@ -62,6 +71,7 @@ protected:
 
 protected:
     std::unique_ptr<ResultSetDescriptor> resultSetDescriptor;
+    uint64_t maxNumConcurrentChildren = 1;
 };
 
 class RYU_API DummySink final : public Sink {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "function/table/bind_data.h"
 #include "function/table/table_function.h"
 #include "processor/result/factorized_table.h"
@@ -11,6 +13,9 @@ struct FTableScanBindData : public function::TableFuncBindData {
     std::shared_ptr<FactorizedTable> table;
     std::vector<ft_col_idx_t> columnIndices;
     uint64_t morselSize;
+    // UINT64 column holding the number of times each tuple is repeated. Consecutive tuples with
+    // the same multiplicity are scanned together and set the multiplicity of the result set.
+    std::optional<ft_col_idx_t> multiplicityColIdx;
 
     FTableScanBindData(std::shared_ptr<FactorizedTable> table,
         std::vector<ft_col_idx_t> columnIndices, uint64_t morselSize)
@@ -18,7 +23,8 @@ struct FTableScanBindData : public function::TableFuncBindData {
     }
     FTableScanBindData(const FTableScanBindData& other)
         : function::TableFuncBindData{other}, table{other.table},
-          columnIndices{other.columnIndices}, morselSize{other.morselSize} {}
+          columnIndices{other.columnIndices}, morselSize{other.morselSize},
+          multiplicityColIdx{other.multiplicityColIdx} {}
 
     std::unique_ptr<TableFuncBindData> copy() const override {
         return std::make_unique<FTableScanBindData>(*this);
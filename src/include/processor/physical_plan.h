@@ -14,6 +14,9 @@ public:
 
 public:
     std::unique_ptr<PhysicalOperator> lastOperator;
+    // Set by the planner for point queries, whose single-threaded pipelines are run on the
+    // calling thread instead of being handed to a worker.
+    bool isPointQuery = false;
 };
 
 } // namespace processor
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "common/arrow/arrow_result_config.h"
 #include "main/query_result.h"
 #include "planner/operator/logical_operator.h"
@@ -32,6 +34,8 @@ class TableCatalogEntry;
 }
 
 namespace planner {
+class LogicalHashJoin;
+class LogicalOrderBy;
 class LogicalSemiMasker;
 struct LogicalInsertInfo;
 class LogicalCopyFrom;
@@ -41,6 +45,8 @@ class LogicalPlan;
 namespace processor {
 
 struct HashJoinBuildInfo;
+class HashJoinSharedState;
+class TopK;
 struct AggregateInfo;
 class NodeInsertExecutor;
 class RelInsertExecutor;
@@ -62,7 +68,8 @@ public:
 
     std::unique_ptr<PhysicalPlan> getPhysicalPlan(const planner::LogicalPlan* logicalPlan,
         const binder::expression_vector& expressions, main::QueryResultType resultType,
-        common::ArrowResultConfig arrowConfig);
+        common::ArrowResultConfig arrowConfig,
+        std::shared_ptr<ResultStream> resultStream = nullptr);
 
     uint32_t getOperatorID() { return physicalOperatorID++; }
 
@@ -178,7 +185,8 @@ public:
     std::unique_ptr<PhysicalOperator> createFTableScan(const binder::expression_vector& exprs,
         std::vector<ft_col_idx_t> colIndices, const planner::Schema* schema,
         std::shared_ptr<FactorizedTable> table, uint64_t maxMorselSize,
-        physical_op_vector_t children);
+        physical_op_vector_t children,
+        std::optional<ft_col_idx_t> multiplicityColIdx = std::nullopt);
     // Scan is the leaf operator of physical plan.
     std::unique_ptr<PhysicalOperator> createFTableScan(const binder::expression_vector& exprs,
         const std::vector<ft_col_idx_t>& colIndices, const planner::Schema* schema,
@@ -210,6 +218,10 @@ public:
         const binder::expression_vector& payloads, const binder::expression_vector& aggregates,
         planner::Schema* inSchema, planner::Schema* outSchema,
         std::unique_ptr<PhysicalOperator> prevOperator);
+    std::unique_ptr<PhysicalOperator> createStreamingAggregate(
+        const binder::expression_vector& keys, const binder::expression_vector& aggregates,
+        planner::Schema* inSchema, planner::Schema* outSchema,
+        std::unique_ptr<PhysicalOperator> prevOperator);
 
     NodeInsertExecutor getNodeInsertExecutor(const planner::LogicalInsertInfo* boundInfo,
         const planner::Schema& inSchema, const planner::Schema& outSchema) const;
@@ -227,11 +239,21 @@ public:
         DataPos pkPos) const;
 
     static void mapSIPJoin(PhysicalOperator* joinRoot);
+    void mapTopKFilter(const planner::LogicalOrderBy& orderBy, TopK& topK);
+    void mapRuntimeJoinFilter(const planner::LogicalHashJoin& hashJoin,
+        HashJoinSharedState& sharedState);
 
     static std::vector<DataPos> getDataPos(const binder::expression_vector& expressions,
         const planner::Schema& schema);
     static FactorizedTableSchema createFlatFTableSchema(
         const binder::expression_vector& expressions, const planner::Schema& schema);
+    // Values of a fixed size type don't refer to overflow data, so tuples holding them can be
+    // spilled to disk.
+    static bool isFixedSize(const common::LogicalType& type);
+    // Returns true if the operator can drop tuples by a runtime filter on the key, i.e. it is a
+    // plain node table scan of the key or a filter selecting the data chunk of the key.
+    static bool canEvaluateRuntimeFilter(const planner::LogicalOperator& op,
+        const binder::Expression& key);
     std::unique_ptr<common::SemiMask> createSemiMask(common::table_id_t tableID) const;
 
     void addOperatorMapping(const planner::LogicalOperator* logicalOp,
@@ -14,9 +14,9 @@ class QueryProcessor {
 
 public:
 #if defined(__APPLE__)
-    explicit QueryProcessor(uint64_t numThreads, uint32_t threadQos);
+    QueryProcessor(uint64_t numThreads, bool enableWorkStealing, uint32_t threadQos);
 #else
-    explicit QueryProcessor(uint64_t numThreads);
+    QueryProcessor(uint64_t numThreads, bool enableWorkStealing);
 #endif
 
     common::TaskScheduler* getTaskScheduler() { return taskScheduler.get(); }
@@ -27,7 +27,7 @@ public:
 private:
     void decomposePlanIntoTask(PhysicalOperator* op, common::Task* task, ExecutionContext* context);
 
-    void initTask(common::Task* task);
+    void initTask(common::Task* task, bool isPointQuery);
 
 private:
     std::unique_ptr<common::TaskScheduler> taskScheduler;
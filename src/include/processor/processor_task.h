@@ -18,6 +18,8 @@ public:
 
     bool terminate() override;
 
+    std::string getTraceName() const override;
+
 private:
     bool sharedStateInitialized;
     Sink* sink;
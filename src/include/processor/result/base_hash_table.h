@@ -34,6 +34,9 @@ public:
     uint64_t getNumEntries() const { return factorizedTable->getNumTuples(); }
     uint64_t getCapacity() const { return maxNumHashSlots; }
     const FactorizedTable* getFactorizedTable() const { return factorizedTable.get(); }
+    FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
+    // Frees the hash slots. The hash table must not be probed before building the slots again.
+    void releaseHashSlots();
 
 protected:
     static constexpr uint64_t HASH_BLOCK_SIZE = common::TEMP_PAGE_SIZE;
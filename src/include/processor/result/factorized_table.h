@@ -8,11 +8,13 @@
 #include "common/vector/value_vector.h"
 #include "factorized_table_schema.h"
 #include "flat_tuple.h"
+#include "storage/buffer_manager/spill_result.h"
 
 namespace ryu {
 namespace storage {
 class MemoryManager;
-}
+class Spiller;
+} // namespace storage
 namespace processor {
 
 struct BlockAppendingInfo {
@@ -39,6 +41,12 @@ public:
     // Manually set the underlying memory buffer to evicted to avoid double free
     void preventDestruction();
 
+    // The block stays full after being spilled, so that no tuple is appended into a block that is
+    // on disk.
+    storage::SpillResult spillToDisk(const storage::Spiller& spiller);
+    void loadFromDisk(const storage::Spiller& spiller);
+    bool isSpilled() const;
+
     static void copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
         DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
         uint32_t numBytesPerTuple);
@@ -140,6 +148,8 @@ public:
 
     uint64_t getNumTuples() const { return numTuples; }
     uint64_t getTotalNumFlatTuples() const;
+    // Memory held by the tuple blocks and the overflow buffer of the table.
+    uint64_t getMemoryUsage() const;
     uint64_t getNumFlatTuples(ft_tuple_idx_t tupleIdx) const;
 
     const std::vector<std::unique_ptr<DataBlock>>& getTupleDataBlocks() {
@@ -194,6 +204,13 @@ public:
         return std::make_shared<FactorizedTable>(mm, FactorizedTableSchema());
     }
 
+    // Only the flat tuple blocks are spilled, the overflow buffer stays in memory. Tables with
+    // unflat columns can't be spilled since their tuples point into the unflat tuple blocks, which
+    // are placed at a different address when reloaded.
+    storage::SpillResult spillToDisk();
+    void loadFromDisk();
+    bool hasSpilledBlocks() const;
+
     void setPreventDestruction(bool preventDestruction) {
         this->preventDestruction = preventDestruction;
     }
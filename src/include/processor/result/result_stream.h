@@ -0,0 +1,60 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "common/types/types.h"
+
+namespace ryu {
+namespace main {
+class QueryResult;
+}
+namespace processor {
+
+class FactorizedTable;
+
+/**
+ * ResultStream is a bounded queue through which the result collector of a running query hands
+ * chunks of its output to the consumer of a streaming query result. Producers block while the
+ * queue is full, which pauses the workers of the final pipeline until the consumer catches up.
+ * The thread executing the query starts the stream once the result columns are known and
+ * finishes it with the final query result, which carries errors and the query summary.
+ */
+class ResultStream {
+public:
+    static constexpr uint64_t CAPACITY = 16;
+
+    void start(std::vector<std::string> columnNames, std::vector<common::LogicalType> columnTypes);
+    // Returns false if the query finished before the stream was started, e.g. on a binder error.
+    bool waitUntilStarted();
+    std::vector<std::string> getColumnNames() const { return columnNames; }
+    std::vector<common::LogicalType> getColumnTypes() const {
+        return common::LogicalType::copy(columnTypes);
+    }
+
+    // Returns false if the consumer closed the stream, so producers can stop early.
+    bool push(std::shared_ptr<FactorizedTable> table);
+    // Returns nullptr once the query finished and all chunks are consumed.
+    std::shared_ptr<FactorizedTable> pop();
+
+    void finish(std::unique_ptr<main::QueryResult> result);
+    std::unique_ptr<main::QueryResult> takeFinalResult();
+
+    void close();
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::shared_ptr<FactorizedTable>> tables;
+    std::vector<std::string> columnNames;
+    std::vector<common::LogicalType> columnTypes;
+    std::unique_ptr<main::QueryResult> finalResult;
+    bool started = false;
+    bool finished = false;
+    bool closed = false;
+};
+
+} // namespace processor
+} // namespace ryu
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <mutex>
+
+#include "processor/result/factorized_table.h"
+#include "storage/buffer_manager/spillable_object.h"
+
+namespace ryu {
+namespace processor {
+
+// Lets the buffer manager spill the tuple blocks of a factorized table while the table is not
+// pinned. The table is not owned and must only contain flat columns (see
+// FactorizedTable::spillToDisk). Callers pin the table before reading or appending to it. Pinning
+// prevents the table from being spilled until the last pin is released. Spilled blocks are loaded
+// back only if requested, so that appending to a table doesn't require reading it back from disk.
+class SpillableFactorizedTable final : public storage::SpillableObject {
+public:
+    explicit SpillableFactorizedTable(FactorizedTable& table) : table{table}, numPins{0} {}
+    ~SpillableFactorizedTable() override;
+    DELETE_COPY_AND_MOVE(SpillableFactorizedTable);
+
+    FactorizedTable& pin(bool loadSpilledBlocks = true);
+    void unpin();
+
+    storage::SpillResult spillToDisk() override;
+
+    FactorizedTable& getTable() const { return table; }
+
+private:
+    FactorizedTable& table;
+    std::mutex mtx;
+    // Serializes loading blocks back from disk between concurrent pins.
+    std::mutex loadMtx;
+    uint64_t numPins;
+};
+
+} // namespace processor
+} // namespace ryu
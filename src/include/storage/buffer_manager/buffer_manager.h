@@ -4,17 +4,20 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "common/types/types.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/page_state.h"
+#include "storage/enums/page_access_pattern.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/file_handle.h"
 
 namespace ryu {
 namespace main {
 struct DBConfig;
+class DatabaseMetrics;
 };
 namespace common {
 class VirtualFileSystem;
@@ -28,6 +31,12 @@ namespace storage {
 class ChunkedNodeGroup;
 class Spiller;
 
+// CLOCK gives every page a second chance before it is evicted. SCAN_RESISTANT (a clock
+// approximation of 2Q) keeps pages read with the USE_ONCE access pattern MARKED, so they are
+// evicted first, and only takes the second chance away from recently used pages when there are
+// no such pages left to evict. This keeps large sequential scans from flushing the hot set.
+enum class EvictionPolicy : uint8_t { CLOCK = 0, SCAN_RESISTANT = 1 };
+
 // This class keeps state info for pages potentially can be evicted.
 // The page state of a candidate is set to be MARKED when it is first enqueued. After enqueued, if
 // the candidate was recently accessed, it is no longer immediately evictable. See the state
@@ -89,6 +98,20 @@ private:
     std::unique_ptr<std::atomic<EvictionCandidate>[]> data;
 };
 
+// A share of the buffer pool's bookkeeping. With NUMA partitioning, there is one partition per NUMA
+// node, and threads enqueue the pages they claim and account the memory they reserve in the
+// partition of the node they run on, so that threads on different sockets don't contend on the
+// same cursors and counters. The memory limit still applies to the whole buffer pool.
+struct alignas(64) BufferPoolPartition {
+    explicit BufferPoolPartition(uint64_t capacity) : evictionQueue{capacity}, usedMemory{0} {}
+
+    EvictionQueue evictionQueue;
+    // Memory reserved through this partition minus memory freed through it. Memory can be freed
+    // through another partition than it was reserved through, so only the (wrapping) sum over all
+    // partitions is meaningful.
+    std::atomic<uint64_t> usedMemory;
+};
+
 /**
  * The Buffer Manager (BM) is a centralized manager of database memory resources.
  * It provides two main functionalities:
@@ -184,6 +207,15 @@ private:
  * Umbra's design in his CS 848 course project:
  * https://github.com/fabubaker/ryu/blob/umbra-bm/final_project_report.pdf.
  */
+// Page accesses of the calling thread, which PROFILE attributes to the operators causing them.
+struct BufferManagerThreadStats {
+    // Number of pins and optimistic reads.
+    uint64_t numPageAccesses = 0;
+    // Number of accessed pages which had to be read from disk.
+    uint64_t numPageMisses = 0;
+    uint64_t numBytesRead = 0;
+};
+
 class BufferManager {
     friend class testing::FlakyBufferManager;
     friend class testing::BufferManagerTest;
@@ -193,10 +225,18 @@ class BufferManager {
     friend class MemoryManager;
 
 public:
+    // Matches the queue depth of the io_uring used by the local file system.
+    static constexpr common::page_idx_t MAX_NUM_PAGES_PER_PREFETCH = 64;
+
     BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly);
+        uint64_t bufferPoolSize, uint64_t maxDBSize, common::VirtualFileSystem* vfs, bool readOnly,
+        EvictionPolicy evictionPolicy = EvictionPolicy::CLOCK, bool enableHugePages = false,
+        bool enableNUMAPartitioning = false);
     virtual ~BufferManager();
 
+    bool hugePagesEnabled() const { return enableHugePages; }
+    uint64_t getNumPartitions() const { return partitions.size(); }
+
     // Currently, these functions are specifically used only for WAL files.
     void removeFilePagesFromFrames(FileHandle& fileHandle);
     void updateFrameIfPageIsInFrameWithoutLock(common::file_idx_t fileIdx, const uint8_t* newPage,
@@ -211,7 +251,7 @@ public:
     }
 
     uint64_t getMemoryLimit() const { return bufferPoolSize; }
-    uint64_t getUsedMemory() const { return usedMemory; }
+    uint64_t getUsedMemory() const;
 
     void getSpillerOrSkip(std::function<void(Spiller&)> func) {
         if (spiller) {
@@ -226,6 +266,10 @@ public:
     // (due to some external intervention)
     void removeEvictedCandidates();
 
+    static BufferManagerThreadStats& getThreadStats();
+
+    void setMetrics(main::DatabaseMetrics* metrics_) { metrics = metrics_; }
+
 protected:
     // Reclaims used memory until the given size to reserve is available.
     // The specified amount of memory will be recorded as being used
@@ -234,10 +278,18 @@ protected:
 private:
     uint8_t* pin(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy = PageReadPolicy::READ_PAGE);
+    uint8_t* pinPage(FileHandle& fileHandle, common::page_idx_t pageIdx,
+        PageReadPolicy pageReadPolicy);
     void optimisticRead(FileHandle& fileHandle, common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& func);
+        const std::function<void(uint8_t*)>& func,
+        PageAccessPattern accessPattern = PageAccessPattern::NORMAL);
     // The function assumes that the requested page is already pinned.
     void unpin(FileHandle& fileHandle, common::page_idx_t pageIdx);
+    // Reads the evicted pages in the range into their frames with batches of concurrent reads, so
+    // that pinning them later doesn't have to wait for each read in turn. This is only a hint:
+    // pages which are used by other threads are skipped, and we stop once no frame can be claimed.
+    void prefetchPages(FileHandle& fileHandle, common::page_idx_t startPageIdx,
+        common::page_idx_t numPages, PageAccessPattern accessPattern);
     uint8_t* getFrame(FileHandle& fileHandle, common::page_idx_t pageIdx) const {
 #if BM_MALLOC
         return fileHandle.getPageState(pageIdx)->getPage();
@@ -259,14 +311,19 @@ private:
 
     bool claimAFrame(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
+    // Releases the frames of pages which were claimed and locked but couldn't be read.
+    void releaseClaimedFrames(FileHandle& fileHandle, std::span<const common::page_idx_t> pages);
     // Return number of bytes freed.
-    uint64_t tryEvictPage(std::atomic<EvictionCandidate>& candidate);
+    uint64_t tryEvictPage(EvictionQueue& evictionQueue, std::atomic<EvictionCandidate>& candidate);
 
     void cachePageIntoFrame(FileHandle& fileHandle, common::page_idx_t pageIdx,
         PageReadPolicy pageReadPolicy);
     void removePageFromFrame(FileHandle& fileHandle, common::page_idx_t pageIdx, bool shouldFlush);
 
-    uint64_t freeUsedMemory(uint64_t size);
+    void freeUsedMemory(uint64_t size);
+
+    void recordPageAccess();
+    void recordPageMisses(uint64_t numPages, uint64_t pageSize);
 
     void releaseFrameForPage(FileHandle& fileHandle [[maybe_unused]],
         common::page_idx_t pageIdx [[maybe_unused]]) {
@@ -277,13 +334,23 @@ private:
 #endif
     }
 
+    // Returns the partition of the NUMA node the calling thread runs on.
+    BufferPoolPartition& getLocalPartition() const;
+    // Enqueues the page into the local partition, or into another one if the local queue is full.
+    bool enqueueEvictionCandidate(common::file_idx_t fileIdx, common::page_idx_t pageIdx);
+
+    // Evicts from the local partition first, and from the other partitions if nothing could be
+    // evicted there.
     uint64_t evictPages();
+    uint64_t evictPages(EvictionQueue& evictionQueue);
 
 private:
     std::atomic<uint64_t> bufferPoolSize;
-    EvictionQueue evictionQueue;
-    // Total memory used
-    std::atomic<uint64_t> usedMemory;
+    EvictionPolicy evictionPolicy;
+    bool enableHugePages;
+    std::vector<std::unique_ptr<BufferPoolPartition>> partitions;
+    // Partition index of each CPU. Empty if the buffer pool has a single partition.
+    std::vector<uint32_t> cpuPartitions;
     // Amount of memory used, which cannot be evicted
     std::atomic<uint64_t> nonEvictableMemory;
     // Each VMRegion corresponds to a virtual memory region of a specific page size. Currently, we
@@ -292,6 +359,8 @@ private:
     std::vector<std::unique_ptr<FileHandle>> fileHandles;
     std::unique_ptr<Spiller> spiller;
     common::VirtualFileSystem* vfs;
+    // Null if the buffer manager doesn't belong to a database, e.g. in tests.
+    main::DatabaseMetrics* metrics = nullptr;
 };
 
 } // namespace storage
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <vector>
 
 #include "common/system_config.h"
 #include "common/types/types.h"
@@ -13,8 +14,10 @@
 namespace ryu {
 
 namespace common {
+class MemoryTracker;
+class QueryMemoryTracker;
 class VirtualFileSystem;
-}
+} // namespace common
 
 namespace storage {
 
@@ -42,6 +45,9 @@ public:
 
     MemoryManager* getMemoryManager() const { return mm; }
 
+    // True if the buffer has been spilled to disk and not loaded back yet.
+    bool isSpilled() const { return evicted && filePosition != UINT64_MAX; }
+
     // Manually set the evicted state of the buffer to avoid double free.
     void preventDestruction() { evicted = true; }
 
@@ -56,6 +62,8 @@ private:
     std::span<uint8_t> buffer;
     uint64_t filePosition = UINT64_MAX;
     MemoryManager* mm;
+    // Tracker of the query operator the buffer was allocated for. Null if untracked.
+    std::shared_ptr<common::MemoryTracker> memoryTracker;
     common::page_idx_t pageIdx;
     bool evicted;
 };
@@ -91,6 +99,11 @@ public:
 
     BufferManager* getBufferManager() const { return bm; }
 
+    // Creates the memory tracker of a query. It is listed by getQueryMemoryTrackers as long as the
+    // query runs or memory allocated for it, e.g. its result, is alive.
+    std::shared_ptr<common::QueryMemoryTracker> createQueryMemoryTracker(uint64_t queryID);
+    std::vector<std::shared_ptr<common::QueryMemoryTracker>> getQueryMemoryTrackers();
+
     static MemoryManager* Get(const main::ClientContext& context);
 
 private:
@@ -104,6 +117,8 @@ private:
     common::page_offset_t pageSize;
     std::stack<common::page_idx_t> freePages;
     std::mutex allocatorLock;
+    std::mutex queryMemoryTrackersLock;
+    std::vector<std::weak_ptr<common::QueryMemoryTracker>> queryMemoryTrackers;
 };
 
 } // namespace storage
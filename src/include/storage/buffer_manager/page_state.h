@@ -55,6 +55,10 @@ public:
         // KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
         stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), UNLOCKED));
     }
+    // Used for pages which were only used once, so that they are immediately evictable.
+    void unlockAndMark() {
+        stateAndVersion.store(updateStateAndIncrementVersion(stateAndVersion.load(), MARKED));
+    }
     void unlockUnchanged() {
         // TODO(Keenan / Guodong): Track down this rare bug and re-enable the assert. Ref #2289.
         // KU_ASSERT(getState(stateAndVersion.load()) == LOCKED);
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "storage/buffer_manager/spill_result.h"
+
+namespace ryu {
+namespace storage {
+
+// In-memory data whose buffers can be written to the spill file to reclaim memory when the buffer
+// manager runs out of memory. Objects register themselves with the Spiller once they are no longer
+// in use (see Spiller::addUnusedChunk), and must be loaded back from disk before being used again.
+class SpillableObject {
+public:
+    virtual ~SpillableObject() = default;
+
+    // Returns the amount of memory reclaimed. Implementations must be safe to call concurrently
+    // with the owner marking the object as in use again, in which case nothing should be spilled.
+    virtual SpillResult spillToDisk() = 0;
+};
+
+} // namespace storage
+} // namespace ryu
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spillable_object.h"
 #include "storage/file_handle.h"
 
 namespace ryu {
@@ -8,8 +9,6 @@ namespace common {
 class VirtualFileSystem;
 };
 namespace storage {
-class InMemChunkedNodeGroup;
-
 class BufferManager;
 class ColumnChunkData;
 
@@ -17,16 +16,21 @@ class ColumnChunkData;
 class Spiller {
 public:
     Spiller(std::string tmpFilePath, BufferManager& bufferManager, common::VirtualFileSystem* vfs);
-    void addUnusedChunk(InMemChunkedNodeGroup* nodeGroup);
-    void clearUnusedChunk(InMemChunkedNodeGroup* nodeGroup);
+    void addUnusedChunk(SpillableObject* object);
+    void clearUnusedChunk(SpillableObject* object);
     SpillResult spillToDisk(ColumnChunkData& chunk) const;
     void loadFromDisk(ColumnChunkData& chunk) const;
-    // reclaims memory from the next full partitioner group in the set
-    // and returns the amount of memory reclaimed
+    SpillResult spillToDisk(MemoryBuffer& buffer) const;
+    // Does nothing if the buffer is not spilled
+    void loadFromDisk(MemoryBuffer& buffer) const;
+    // reclaims memory from the next unused spillable object (e.g. a full partitioner group) in the
+    // set and returns the amount of memory reclaimed
     // If the set is empty, returns zero
     SpillResult claimNextGroup();
     // Must only be used once all chunks have been loaded from disk.
     void clearFile();
+    // Total number of bytes written to the spill file since the spiller was created.
+    uint64_t getNumBytesSpilled() const { return numBytesSpilled.load(std::memory_order_relaxed); }
     ~Spiller();
 
 private:
@@ -37,10 +41,11 @@ private:
     std::string tmpFilePath;
     BufferManager& bufferManager;
     common::VirtualFileSystem* vfs;
-    std::unordered_set<InMemChunkedNodeGroup*> fullPartitionerGroups;
+    std::unordered_set<SpillableObject*> fullPartitionerGroups;
     std::atomic<FileHandle*> dataFH;
     std::mutex partitionerGroupsMtx;
     mutable std::mutex fileCreationMutex;
+    mutable std::atomic<uint64_t> numBytesSpilled;
 };
 
 } // namespace storage
@@ -13,11 +13,17 @@ namespace storage {
 // Each FileHandle should grab a frame group each time when they add a new file page group (see
 // `FileHandle::addNewPageGroupWithoutLock`). In this way, each file page group uniquely
 // corresponds to a frame group, thus, a page also uniquely corresponds to a frame in a VMRegion.
+// With huge pages, the region is aligned to HUGE_PAGE_SIZE and backed by transparent huge pages
+// where the kernel supports them, which cuts TLB misses for random accesses into large buffer
+// pools. Explicit MAP_HUGETLB mappings are not used since frames are released individually.
 class VMRegion {
     friend class BufferManager;
 
 public:
-    explicit VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize);
+    static constexpr uint64_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    VMRegion(common::PageSizeClass pageSizeClass, uint64_t maxRegionSize,
+        bool useHugePages = false);
     ~VMRegion();
 
     common::frame_group_idx_t addNewFrameGroup();
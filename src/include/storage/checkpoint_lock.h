@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "common/file_system/file_info.h"
+
+namespace ryu {
+namespace main {
+class ClientContext;
+} // namespace main
+
+namespace storage {
+
+/**
+ * Coordinates the checkpoints of a writer with read replicas in other processes. Replicas hold a
+ * shared lock on a file next to the database file while their transactions read the data file,
+ * and the writer holds an exclusive one while it overwrites pages of the data file in place. The
+ * file also stores the number of checkpoints made, from which replicas tell that they have to
+ * read the checkpointed data again. The lock is released on destruction.
+ */
+class CheckpointLock {
+public:
+    // Waits until the lock is available and throws if that takes longer than the checkpoint wait
+    // timeout.
+    CheckpointLock(const std::string& databasePath, main::ClientContext& context, bool exclusive);
+
+    uint64_t getNumCheckpoints() const;
+    // Must be called by the writer once a checkpoint is applied to the data file.
+    void incrementNumCheckpoints();
+
+private:
+    std::unique_ptr<common::FileInfo> fileInfo;
+};
+
+} // namespace storage
+} // namespace ryu
@@ -35,9 +35,19 @@ public:
     void rollback();
 
     void readCheckpoint();
+    // Reads the checkpointed catalog and storage metadata from the data file of storageManager.
+    static void readCheckpoint(main::ClientContext* context, catalog::Catalog* catalog,
+        StorageManager* storageManager);
 
     static bool canAutoCheckpoint(const main::ClientContext& clientContext,
         const transaction::Transaction& transaction);
+    // Whether an auto checkpoint can be put off to a later commit. The WAL is allowed to grow up to
+    // MAX_DEFERRED_CHECKPOINT_FACTOR times the checkpoint threshold, after which the checkpoint
+    // has to wait for active transactions to leave.
+    static bool canDeferAutoCheckpoint(const main::ClientContext& clientContext,
+        const transaction::Transaction& transaction);
+
+    static constexpr uint64_t MAX_DEFERRED_CHECKPOINT_FACTOR = 2;
 
 protected:
     virtual bool checkpointStorage();
@@ -47,9 +57,6 @@ protected:
     virtual void logCheckpointAndApplyShadowPages();
 
 private:
-    static void readCheckpoint(main::ClientContext* context, catalog::Catalog* catalog,
-        StorageManager* storageManager);
-
     PageRange serializeCatalog(const catalog::Catalog& catalog, StorageManager& storageManager);
     PageRange serializeMetadata(const catalog::Catalog& catalog, StorageManager& storageManager);
 
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "storage/page_allocator.h"
+
+namespace ryu {
+namespace storage {
+
+// A column chunk moved to other pages of the data file by a checkpoint. The chunk is identified by
+// its table, node group and column, and among the chunks of that column by the pages it was moved
+// to, which no other chunk uses.
+struct ChunkRelocation {
+    common::table_id_t tableID;
+    common::node_group_idx_t nodeGroupIdx;
+    common::column_id_t columnID;
+    PageRange oldPageRange;
+    PageRange newPageRange;
+};
+
+// Moves chunks back to their old pages when a checkpoint is rolled back. Tables pass it to
+// reclaimStorage(), which gives it the page ranges of all their chunks. The pages that chunks were
+// moved to are free again.
+class ChunkRelocationRollback final : public PageAllocator {
+public:
+    ChunkRelocationRollback(FileHandle* fileHandle,
+        const std::vector<ChunkRelocation>& relocations);
+
+    bool hasRelocations(common::table_id_t tableID) const;
+    void setTableID(common::table_id_t tableID_) { tableID = tableID_; }
+    // Relocations whose chunks were not found, e.g. because their table was dropped meanwhile.
+    uint64_t getNumRemainingRelocations() const { return oldPageRanges.size(); }
+
+    PageRange allocatePageRange(common::page_idx_t numPages) override;
+    void freePageRange(PageRange /*pageRange*/) override {}
+    void reclaimChunkPages(PageRange& pageRange) override;
+    void setChunkNodeGroupIdx(common::node_group_idx_t nodeGroupIdx_) override {
+        nodeGroupIdx = nodeGroupIdx_;
+    }
+    void setChunkColumnID(common::column_id_t columnID_) override { columnID = columnID_; }
+
+private:
+    using chunk_key_t = std::tuple<common::table_id_t, common::node_group_idx_t,
+        common::column_id_t, common::page_idx_t>;
+
+    // Old page ranges keyed by the chunk and its new start page.
+    std::map<chunk_key_t, PageRange> oldPageRanges;
+    common::table_id_t tableID;
+    common::node_group_idx_t nodeGroupIdx;
+    common::column_id_t columnID;
+};
+
+} // namespace storage
+} // namespace ryu
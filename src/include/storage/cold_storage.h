@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types/types.h"
+#include "storage/page_range.h"
+
+namespace ryu {
+namespace common {
+struct FileInfo;
+class VirtualFileSystem;
+} // namespace common
+
+namespace main {
+class ClientContext;
+class Database;
+} // namespace main
+
+namespace storage {
+
+class FileHandle;
+
+// Location of an offloaded page in the cold storage.
+struct ColdPage {
+    uint32_t segmentIdx;
+    common::page_idx_t pageIdxInSegment;
+};
+
+/**
+ * ColdStorage moves pages of the data file to a cold storage tier, e.g. an S3 bucket accessed
+ * through the httpfs extension. Pages are offloaded in batches into immutable segment files, after
+ * which their space in the local data file is released. Offloaded pages are read through the
+ * buffer manager like any other page, so hot pages stay cached in memory, and blocks of remote
+ * segments can additionally be cached on local disk by httpfs. A page becomes local again once it
+ * is overwritten. The map of offloaded pages is kept in a small file next to the database file.
+ */
+class ColdStorage {
+public:
+    ColdStorage(const std::string& databasePath, common::VirtualFileSystem* vfs,
+        main::ClientContext* context);
+    ~ColdStorage();
+
+    bool isColdPage(common::page_idx_t pageIdx) const;
+    // Reads the page from the cold storage if it was offloaded. Returns false otherwise.
+    bool tryReadPage(uint8_t* buffer, common::page_idx_t pageIdx, uint64_t pageSize);
+
+    // Must be called before the pages are overwritten in the local data file.
+    void removePages(PageRange pageRange);
+    void removePages(std::span<const common::page_idx_t> pageIdxes);
+
+    // Writes the map of offloaded pages for a copy of the data file at databasePath. Segments are
+    // immutable, so the copy shares them. Throws if a segment can't be reached.
+    void copyMapTo(const std::string& databasePath, main::ClientContext* context) const;
+
+    // Copies the pages which are not offloaded yet into a new segment at segmentPath and releases
+    // their space in the local data file.
+    void offload(main::ClientContext& clientContext, const std::string& segmentPath,
+        std::span<const PageRange> pageRanges, FileHandle& dataFH);
+
+private:
+    bool hasColdPages() const { return numColdPages.load(std::memory_order_relaxed) > 0; }
+    common::FileInfo* getSegment(uint32_t segmentIdx);
+    void persistNoLock() const { writeMapNoLock(mapFilePath); }
+    void writeMapNoLock(const std::string& path) const;
+
+private:
+    static constexpr uint64_t MAX_NUM_PAGES_PER_COPY = 256;
+
+    std::string mapFilePath;
+    common::VirtualFileSystem* vfs;
+    main::Database* database;
+    // Pages are read without a client context, so segments are opened with a context of their
+    // own.
+    std::unique_ptr<main::ClientContext> segmentContext;
+    std::vector<std::string> segmentPaths;
+    std::vector<std::unique_ptr<common::FileInfo>> segments;
+    std::unordered_map<common::page_idx_t, ColdPage> coldPages;
+    std::atomic<uint64_t> numColdPages;
+    // Protects coldPages and segmentPaths.
+    mutable std::shared_mutex mtx;
+    // Protects opening segments.
+    std::mutex segmentsMtx;
+};
+
+} // namespace storage
+} // namespace ryu
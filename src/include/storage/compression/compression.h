@@ -11,6 +11,7 @@
 #include "common/null_mask.h"
 #include "common/numeric_utils.h"
 #include "common/types/types.h"
+#include "storage/compression/fsst.h"
 #include <span>
 
 namespace ryu {
@@ -118,6 +119,9 @@ enum class CompressionType : uint8_t {
     BOOLEAN_BITPACKING = 2,
     CONSTANT = 3,
     ALP = 4,
+    INTEGER_DELTA = 5,
+    RLE = 6,
+    FSST = 7,
 };
 
 struct ExtraMetadata {
@@ -141,6 +145,34 @@ struct ALPMetadata : ExtraMetadata {
     std::unique_ptr<ExtraMetadata> copy() override;
 };
 
+// used only for run-length encoding
+struct RLEMetadata : ExtraMetadata {
+    RLEMetadata() : numValuesPerPage(0) {}
+    explicit RLEMetadata(uint64_t numValuesPerPage) : numValuesPerPage(numValuesPerPage) {}
+
+    // Every page holds the same number of values, chosen so that no page has more runs than
+    // can fit in it
+    uint64_t numValuesPerPage;
+
+    void serialize(common::Serializer& serializer) const;
+    static RLEMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
+// used only for string data compressed with a static symbol table
+struct FSSTMetadata : ExtraMetadata {
+    FSSTMetadata() = default;
+    explicit FSSTMetadata(FSSTSymbolTable symbolTable) : symbolTable(std::move(symbolTable)) {}
+
+    FSSTSymbolTable symbolTable;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTMetadata deserialize(common::Deserializer& deserializer);
+
+    std::unique_ptr<ExtraMetadata> copy() override;
+};
+
 struct InPlaceUpdateLocalState {
     struct FloatState {
         size_t newExceptionCount;
@@ -193,6 +225,12 @@ struct RYU_API CompressionMetadata {
     inline ALPMetadata* floatMetadata() {
         return common::ku_dynamic_cast<ALPMetadata*>(getExtraMetadata());
     }
+    inline const RLEMetadata* rleMetadata() const {
+        return common::ku_dynamic_cast<const RLEMetadata*>(getExtraMetadata());
+    }
+    inline const FSSTMetadata* fsstMetadata() const {
+        return common::ku_dynamic_cast<const FSSTMetadata*>(getExtraMetadata());
+    }
 
     void serialize(common::Serializer& serializer) const;
     static CompressionMetadata deserialize(common::Deserializer& deserializer);
@@ -420,6 +458,95 @@ protected:
         const BitpackInfo<T>& header) const;
 };
 
+template<typename T>
+concept IntegerDeltaType = (std::same_as<T, int32_t> || std::same_as<T, int64_t> ||
+                            std::same_as<T, uint32_t> || std::same_as<T, uint64_t>);
+
+// Delta encoding for non-decreasing integers, such as serial keys and internal IDs.
+// Pages are split into blocks of BLOCK_SIZE values, each storing its first value followed by the
+// bitpacked differences between consecutive values. The differences are frame of reference
+// encoded using the range stored in the child metadata, so a constant stride takes no space
+// beyond the first value of each block.
+// Values can only be decoded sequentially within a block, so they are never updated in-place.
+template<IntegerDeltaType T>
+class IntegerDelta : public CompressionAlg {
+    using U = common::numeric_utils::MakeUnSignedT<T>;
+
+public:
+    static constexpr uint64_t BLOCK_SIZE = 512;
+    static constexpr common::idx_t DELTA_CHILD_IDX = 0;
+
+public:
+    IntegerDelta() = default;
+    IntegerDelta(const IntegerDelta&) = default;
+
+    // Returns std::nullopt if the values are not sorted
+    static std::optional<CompressionMetadata> getMetadata(std::span<const T> values,
+        StorageValue min, StorageValue max);
+
+    static BitpackInfo<U> getPackingInfo(const CompressionMetadata& metadata);
+
+    static uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata);
+
+    void setValuesFromUncompressed(const uint8_t*, common::offset_t, uint8_t*, common::offset_t,
+        common::offset_t, const CompressionMetadata&, const common::NullMask*) const final {
+        KU_UNREACHABLE;
+    }
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override { return CompressionType::INTEGER_DELTA; }
+
+private:
+    static uint64_t getNumBytesPerBlock(uint8_t bitWidth) {
+        return sizeof(U) + BLOCK_SIZE * bitWidth / 8;
+    }
+};
+
+// Run-length encoding for columns with long runs of repeated values.
+// Each page stores the number of runs, followed by the end offset of each run within the page
+// and then the value of each run. Decompression fills whole runs at once.
+template<IntegerBitpackingType T>
+class RunLengthEncoding : public CompressionAlg {
+    using run_end_t = uint32_t;
+
+public:
+    RunLengthEncoding() = default;
+    RunLengthEncoding(const RunLengthEncoding&) = default;
+
+    // Returns std::nullopt if the runs are too short for run-length encoding to be worthwhile
+    static std::optional<CompressionMetadata> getMetadata(std::span<const T> values,
+        StorageValue min, StorageValue max);
+
+    static uint64_t numValues(uint64_t dataSize, const CompressionMetadata& metadata);
+
+    void setValuesFromUncompressed(const uint8_t*, common::offset_t, uint8_t*, common::offset_t,
+        common::offset_t, const CompressionMetadata&, const common::NullMask*) const final {
+        KU_UNREACHABLE;
+    }
+
+    uint64_t compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+        uint8_t* dstBuffer, uint64_t dstBufferSize,
+        const struct CompressionMetadata& metadata) const final;
+
+    void decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset, uint8_t* dstBuffer,
+        uint64_t dstOffset, uint64_t numValues,
+        const struct CompressionMetadata& metadata) const final;
+
+    CompressionType getCompressionType() const override { return CompressionType::RLE; }
+
+private:
+    static constexpr uint64_t getMaxNumRunsPerPage(uint64_t pageSize) {
+        return (pageSize - sizeof(run_end_t)) / (sizeof(run_end_t) + sizeof(T));
+    }
+};
+
 class BooleanBitpacking : public CompressionAlg {
 public:
     BooleanBitpacking() = default;
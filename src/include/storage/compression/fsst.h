@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace ryu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+// Static symbol table string compression, based on FSST (Fast Static Symbol Table, Boncz et al.).
+//
+// The table holds up to MAX_NUM_SYMBOLS symbols of between 1 and MAX_SYMBOL_LENGTH bytes, built
+// from a sample of the strings being compressed. Each string is encoded independently as a
+// sequence of one-byte codes, where ESCAPE_CODE is followed by a literal byte which is not covered
+// by any symbol. Since encoding is deterministic, equal strings have equal encodings.
+class FSSTSymbolTable {
+public:
+    static constexpr uint64_t MAX_SYMBOL_LENGTH = 8;
+    static constexpr uint64_t MAX_NUM_SYMBOLS = 255;
+    static constexpr uint8_t ESCAPE_CODE = 255;
+
+    FSSTSymbolTable() = default;
+
+    static FSSTSymbolTable build(std::span<const std::string_view> strings);
+
+    uint64_t getNumSymbols() const { return symbols.size(); }
+
+    // Appends the encoding of str to result
+    void encode(std::string_view str, std::vector<uint8_t>& result) const;
+    uint64_t getDecodedLength(const uint8_t* codes, uint64_t numCodes) const;
+    // dst must have space for getDecodedLength(codes, numCodes) bytes
+    void decode(const uint8_t* codes, uint64_t numCodes, uint8_t* dst) const;
+
+    void serialize(common::Serializer& serializer) const;
+    static FSSTSymbolTable deserialize(common::Deserializer& deserializer);
+
+private:
+    void addSymbol(uint64_t symbol, uint8_t length);
+    // Returns the code of the longest symbol which str starts with, or ESCAPE_CODE if there is
+    // none. length must be at least 1.
+    uint8_t findLongestSymbol(const uint8_t* str, uint64_t length) const;
+
+private:
+    // Symbols are stored little-endian, with unused high bytes set to zero
+    std::vector<uint64_t> symbols;
+    std::vector<uint8_t> lengths;
+    // Codes of the symbols starting with each byte, from longest to shortest
+    std::array<std::vector<uint8_t>, 256> codesByFirstByte;
+};
+
+} // namespace storage
+} // namespace ryu
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ryu {
+namespace storage {
+
+// USE_ONCE is a hint that the page is unlikely to be read again soon (e.g. by a sequential scan),
+// so the scan-resistant eviction policy may evict it before any recently used page.
+enum class PageAccessPattern : uint8_t { NORMAL = 0, USE_ONCE = 1 };
+
+} // namespace storage
+} // namespace ryu
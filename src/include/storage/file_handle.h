@@ -15,6 +15,7 @@
 #include "common/types/types.h"
 #include "storage/buffer_manager/page_state.h"
 #include "storage/buffer_manager/vm_region.h"
+#include "storage/enums/page_access_pattern.h"
 #include "storage/enums/page_read_policy.h"
 #include "storage/page_manager.h"
 
@@ -38,6 +39,7 @@ namespace storage {
 
 class ShadowFile;
 class BufferManager;
+class ColdStorage;
 class FileHandle {
 public:
     friend class BufferManager;
@@ -64,9 +66,18 @@ public:
 
     uint8_t* pinPage(common::page_idx_t pageIdx, PageReadPolicy readPolicy);
     void optimisticReadPage(common::page_idx_t pageIdx,
-        const std::function<void(uint8_t*)>& readOp);
+        const std::function<void(uint8_t*)>& readOp,
+        PageAccessPattern accessPattern = PageAccessPattern::NORMAL);
     // The function assumes that the requested page is already pinned.
     void unpinPage(common::page_idx_t pageIdx);
+    // Loads the evicted pages in the range into the buffer pool ahead of them being read.
+    void prefetchPages(common::page_idx_t startPageIdx, common::page_idx_t numPages,
+        PageAccessPattern accessPattern = PageAccessPattern::NORMAL);
+    // Hints the file system to read the evicted pages in the range in the background, without
+    // claiming any frames for them. Used for pages that are expected to be read a bit later.
+    void prefetchPagesAsync(const PageRange& pageRange);
+    // Returns the runs of pages which are currently held in frames.
+    std::vector<PageRange> getCachedPageRanges();
 
     // This function assumes the page is already LOCKED.
     void setLockedPageDirty(common::page_idx_t pageIdx) {
@@ -90,6 +101,9 @@ public:
     void readPageFromDisk(uint8_t* frame, common::page_idx_t pageIdx) const {
         KU_ASSERT(!isInMemoryMode());
         KU_ASSERT(pageIdx < numPages);
+        if (coldStorage != nullptr && readPageFromColdStorage(frame, pageIdx)) {
+            return;
+        }
         fileInfo->readFromFile(frame, getPageSize(), pageIdx * getPageSize());
     }
     void writePageToFile(const uint8_t* buffer, common::page_idx_t pageIdx) {
@@ -110,6 +124,10 @@ public:
 
     PageManager* getPageManager() { return pageManager.get(); }
 
+    // Offloaded pages are read from the cold storage instead of the file.
+    void setColdStorage(ColdStorage* coldStorage_) { coldStorage = coldStorage_; }
+    ColdStorage* getColdStorage() const { return coldStorage; }
+
 private:
     bool isLargePaged() const { return fhFlags & isLargePagedMask; }
     bool isNewTmpFile() const { return fhFlags & isNewInMemoryTmpFileMask; }
@@ -118,6 +136,7 @@ private:
     bool isLockRequired() const { return fhFlags & isLockRequiredMask; }
 
     common::page_idx_t addNewPageWithoutLock();
+    bool readPageFromColdStorage(uint8_t* frame, common::page_idx_t pageIdx) const;
     void constructPersistentFileHandle(const std::string& path, common::VirtualFileSystem* vfs,
         main::ClientContext* context);
     void constructTmpFileHandle(const std::string& path);
@@ -166,6 +185,8 @@ private:
     common::ConcurrentVector<common::page_group_idx_t> frameGroupIdxes;
 
     std::unique_ptr<PageManager> pageManager;
+    // Owned by the storage manager. Only set for the data file.
+    ColdStorage* coldStorage = nullptr;
 };
 
 } // namespace storage
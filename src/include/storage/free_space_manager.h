@@ -39,6 +39,8 @@ public:
     void finalizeCheckpoint(FileHandle* fileHandle);
 
     common::row_idx_t getNumEntries() const;
+    // Number of pages in entries which can be reused right away.
+    common::page_idx_t getNumPages() const;
     std::vector<PageRange> getEntries(common::row_idx_t startOffset,
         common::row_idx_t endOffset) const;
 
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <span>
 #include <string_view>
 #include <type_traits>
 
@@ -15,6 +18,7 @@
 #include "index.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/disk_array_collection.h"
+#include "storage/index/hash_index_filter.h"
 #include "storage/index/hash_index_utils.h"
 #include "storage/index/in_mem_hash_index.h"
 #include "storage/local_storage/local_hash_index.h"
@@ -111,6 +115,26 @@ public:
         return lookupInPersistentIndex(transaction, key, result, isVisible);
     }
 
+    // Batched version of the above lookup. The offset of each key is written to the same position
+    // in results, or INVALID_OFFSET if the key is not found.
+    void lookupInternal(const transaction::Transaction* transaction, std::span<const Key> keys,
+        std::span<common::offset_t> results, visible_func isVisible) {
+        KU_ASSERT(keys.size() == results.size());
+        std::vector<common::idx_t> persistentLookups;
+        for (auto i = 0u; i < keys.size(); i++) {
+            auto localLookupState = localStorage->lookup(keys[i], results[i], isVisible);
+            if (localLookupState != HashIndexLocalLookupState::KEY_FOUND) {
+                results[i] = common::INVALID_OFFSET;
+            }
+            if (localLookupState == HashIndexLocalLookupState::KEY_NOT_EXIST) {
+                persistentLookups.push_back(i);
+            }
+        }
+        if (!persistentLookups.empty()) {
+            lookupInPersistentIndex(transaction, keys, persistentLookups, results, isVisible);
+        }
+    }
+
     // For deletions, we don't check if the deleted keys exist or not. Thus, we don't need to check
     // in the persistent storage and directly delete keys in the local storage.
     void deleteInternal(Key key) const { localStorage->deleteKey(key); }
@@ -186,6 +210,10 @@ private:
             return false;
         }
         auto hashValue = HashIndexUtils::hash(key);
+        if (const auto filter = getPersistentFilter(transaction, header, 1 /* numLookups */);
+            filter && !filter->mayContain(hashValue)) {
+            return false;
+        }
         auto fingerprint = HashIndexUtils::getFingerprintForHash(hashValue);
         auto iter = getSlotIterator(HashIndexUtils::getPrimarySlotIdForHash(header, hashValue),
             transaction);
@@ -199,6 +227,67 @@ private:
         } while (nextChainedSlot(transaction, iter));
         return false;
     }
+    // Looks up keys[idx] for each idx in keysToLookup. The keys are probed in the order of their
+    // primary slots so that each chain of slots is read once for all the keys which hash to it.
+    void lookupInPersistentIndex(const transaction::Transaction* transaction,
+        std::span<const Key> keys, std::span<const common::idx_t> keysToLookup,
+        std::span<common::offset_t> results, visible_func isVisible) {
+        auto& header = transaction->getType() == transaction::TransactionType::CHECKPOINT ?
+                           this->indexHeaderForWriteTrx :
+                           this->indexHeaderForReadTrx;
+        if (header.numEntries == 0) {
+            return;
+        }
+        struct SlotLookup {
+            slot_id_t slotId;
+            uint8_t fingerprint;
+            common::idx_t keyIdx;
+        };
+        std::vector<SlotLookup> lookups;
+        lookups.reserve(keysToLookup.size());
+        const auto filter = getPersistentFilter(transaction, header, keysToLookup.size());
+        for (const auto keyIdx : keysToLookup) {
+            const auto hashValue = HashIndexUtils::hash(keys[keyIdx]);
+            if (filter && !filter->mayContain(hashValue)) {
+                continue;
+            }
+            lookups.push_back(SlotLookup{HashIndexUtils::getPrimarySlotIdForHash(header, hashValue),
+                HashIndexUtils::getFingerprintForHash(hashValue), keyIdx});
+        }
+        std::sort(lookups.begin(), lookups.end(),
+            [](const auto& a, const auto& b) { return a.slotId < b.slotId; });
+        // Slots of the current chain are only read once some key needs them
+        std::vector<OnDiskSlotType> chain;
+        for (auto i = 0u; i < lookups.size(); i++) {
+            const auto& lookup = lookups[i];
+            if (i == 0 || lookup.slotId != lookups[i - 1].slotId) {
+                chain.clear();
+                chain.push_back(getSlot(transaction, SlotInfo{lookup.slotId, SlotType::PRIMARY}));
+            }
+            for (auto slotIdx = 0u;; slotIdx++) {
+                if (slotIdx == chain.size()) {
+                    const auto nextSlotId = chain.back().header.nextOvfSlotId;
+                    if (nextSlotId == SlotHeader::INVALID_OVERFLOW_SLOT_ID) {
+                        break;
+                    }
+                    chain.push_back(getSlot(transaction, SlotInfo{nextSlotId, SlotType::OVF}));
+                }
+                auto entryPos = findMatchedEntryInSlot(transaction, chain[slotIdx],
+                    keys[lookup.keyIdx], lookup.fingerprint, isVisible);
+                if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
+                    results[lookup.keyIdx] = chain[slotIdx].entries[entryPos].value;
+                    break;
+                }
+            }
+        }
+    }
+    // Returns the filter over the keys in the persistent index, or nullptr if there is none yet.
+    // Building it reads every slot, so it is only built once the number of lookups which reached
+    // the persistent index is a fair fraction of the number of entries.
+    const HashIndexFilter* getPersistentFilter(const transaction::Transaction* transaction,
+        const HashIndexHeader& header, uint64_t numLookups);
+    void buildPersistentFilter(const transaction::Transaction* transaction,
+        const HashIndexHeader& header);
     void deleteFromPersistentIndex(const transaction::Transaction* transaction, Key key,
         visible_func isVisible);
 
@@ -307,6 +396,12 @@ private:
     const HashIndexHeader& indexHeaderForReadTrx;
     HashIndexHeader& indexHeaderForWriteTrx;
     MemoryManager& memoryManager;
+    std::mutex persistentFilterMtx;
+    std::unique_ptr<HashIndexFilter> persistentFilter;
+    // Set once persistentFilter is built. The filter is only replaced or dropped during
+    // checkpoints, which don't run concurrently with lookups.
+    std::atomic<bool> hasPersistentFilter;
+    std::atomic<uint64_t> numPersistentLookups;
 };
 
 template<>
@@ -388,6 +483,12 @@ public:
 
     bool lookup(const transaction::Transaction* trx, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result, visible_func isVisible);
+    // Looks up the keys at the given positions of keyVector, none of which may be null. The offset
+    // of each key is written to the same position in results, or INVALID_OFFSET if the key is not
+    // found.
+    void lookup(const transaction::Transaction* trx, common::ValueVector* keyVector,
+        std::span<const common::sel_t> positions, std::span<common::offset_t> results,
+        visible_func isVisible);
 
     std::unique_ptr<Index::InsertState> initInsertState(main::ClientContext*,
         visible_func isVisible) override {
@@ -474,6 +575,9 @@ public:
         return indexInfo.keyDataTypes[0];
     }
     void reclaimStorage(PageAllocator& pageAllocator) const;
+    // Only passes on the pages of the slots, whose page indexes are held in memory. The overflow
+    // file's pages are found by reading its page chain.
+    void reclaimSlotStorage(PageAllocator& pageAllocator) const;
 
     static RYU_API std::unique_ptr<Index> load(main::ClientContext* context,
         StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
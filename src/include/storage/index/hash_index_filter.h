@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace ryu {
+namespace storage {
+
+// Register-blocked bloom filter over the hashes of the keys in the persistent part of a hash
+// index, used to answer most lookups of absent keys without reading any slot. Each key sets
+// NUM_BITS_PER_KEY bits within a single 64-bit word, so a probe reads one word.
+//
+// The filter is a superset of the persistent keys: deleted keys are never removed, and keys added
+// by a checkpoint which is rolled back only cause false positives.
+class HashIndexFilter {
+public:
+    static constexpr uint64_t NUM_BITS_PER_ENTRY = 12;
+    static constexpr uint64_t NUM_BITS_PER_KEY = 4;
+
+    // Sized to hold numEntries keys at NUM_BITS_PER_ENTRY bits each
+    explicit HashIndexFilter(uint64_t numEntries);
+
+    uint64_t getCapacity() const { return capacity; }
+
+    void insert(common::hash_t hash) {
+        const auto mixed = mix(hash);
+        words[getWordIdx(mixed)] |= getMask(mixed);
+    }
+    bool mayContain(common::hash_t hash) const {
+        const auto mixed = mix(hash);
+        const auto mask = getMask(mixed);
+        return (words[getWordIdx(mixed)] & mask) == mask;
+    }
+
+private:
+    // The hash index already uses the high bits of the hash to pick the index and the low bits to
+    // pick the slot, so all keys looked up in the filter share bits. Remix before using them.
+    static uint64_t mix(common::hash_t hash) {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+    uint64_t getWordIdx(uint64_t mixed) const { return ((mixed >> 32) * words.size()) >> 32; }
+    static uint64_t getMask(uint64_t mixed) {
+        uint64_t mask = 0;
+        for (auto i = 0u; i < NUM_BITS_PER_KEY; i++) {
+            mask |= uint64_t{1} << ((mixed >> (i * 6)) & 63);
+        }
+        return mask;
+    }
+
+private:
+    uint64_t capacity;
+    std::vector<uint64_t> words;
+};
+
+} // namespace storage
+} // namespace ryu
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
+#include "common/types/value/value.h"
+#include "storage/index/index.h"
+
+namespace ryu {
+namespace storage {
+
+class NodeTable;
+class PropertyIndexEntries;
+
+// Secondary index on a single node table property, kept in memory. It maps each value to the
+// offsets of the committed rows which hold it.
+//
+// The index is a superset of the rows matching a value: entries are added when rows are committed
+// or updated, but not removed when they are deleted or updated again, so that transactions reading
+// an older version of a row can still find it. Lookups therefore only return candidates, and the
+// predicate has to be re-evaluated on the scanned rows. Rows in a transaction's local storage are
+// not indexed; scans always read them.
+//
+// The index isn't persisted. After the database is opened, it is rebuilt from the table the first
+// time it is looked up or its property is updated, which also drops entries gone stale. Until then
+// the committed values are those the table held when it was opened, so the rebuild indexes every
+// value a transaction can still see.
+class PropertyIndex final : public Index {
+public:
+    PropertyIndex(IndexInfo indexInfo, NodeTable& table);
+    ~PropertyIndex() override;
+
+    static bool isIndexable(common::PhysicalTypeID typeID);
+
+    // Adds the committed rows visible to transaction, starting from the given node group.
+    void build(main::ClientContext* context, const transaction::Transaction* transaction,
+        common::node_group_idx_t startNodeGroupIdx = 0);
+
+    // Returns the offsets of the committed rows which may hold key, in ascending order.
+    std::vector<common::offset_t> lookup(main::ClientContext* context, const common::Value& key);
+
+    std::unique_ptr<InsertState> initInsertState(main::ClientContext* context,
+        visible_func isVisible) override;
+    std::unique_ptr<UpdateState> initUpdateState(main::ClientContext* context,
+        common::column_id_t columnID, visible_func isVisible) override;
+    void update(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        common::ValueVector& propertyVector, UpdateState& updateState) override;
+    std::unique_ptr<DeleteState> initDeleteState(const transaction::Transaction* transaction,
+        MemoryManager* mm, visible_func isVisible) override;
+    void delete_(transaction::Transaction* transaction, const common::ValueVector& nodeIDVector,
+        DeleteState& deleteState) override;
+    bool needCommitInsert() const override { return true; }
+    void commitInsert(transaction::Transaction* transaction,
+        const common::ValueVector& nodeIDVector,
+        const std::vector<common::ValueVector*>& indexVectors, InsertState& insertState) override;
+    // Rows appended by COPY bypass local storage, so they are added here.
+    void finalize(main::ClientContext* context) override;
+
+    static std::unique_ptr<Index> load(main::ClientContext* context,
+        StorageManager* storageManager, IndexInfo indexInfo, std::span<uint8_t> storageInfoBuffer);
+
+    static IndexType getIndexType() {
+        static const IndexType PROPERTY_INDEX_TYPE{catalog::PropertyIndexCatalogEntry::TYPE_NAME,
+            IndexConstraintType::SECONDARY_NON_UNIQUE, IndexDefinitionType::BUILTIN, load};
+        return PROPERTY_INDEX_TYPE;
+    }
+
+private:
+    void buildIfNeeded(main::ClientContext* context);
+
+private:
+    NodeTable& table;
+    mutable std::mutex mtx;
+    // Serializes the lazy build after the database is opened.
+    std::mutex buildMtx;
+    std::atomic<bool> built;
+    std::unique_ptr<PropertyIndexEntries> entries;
+    // Number of committed node groups when build() last finished. The last of them may have had
+    // rows appended since.
+    common::node_group_idx_t numScannedNodeGroups;
+};
+
+} // namespace storage
+} // namespace ryu
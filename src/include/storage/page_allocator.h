@@ -18,6 +18,14 @@ public:
     // Only used during checkpoint
     virtual void freePageRange(PageRange block) = 0;
     void freePage(common::page_idx_t pageIdx) { freePageRange(PageRange(pageIdx, 1)); }
+    // Called on the pages of column chunks when reclaiming their storage. Allocators which move
+    // chunks instead of freeing them update the range in place.
+    virtual void reclaimChunkPages(PageRange& pageRange) { freePageRange(pageRange); }
+    // Called when reclaiming storage before the chunks of each node group and column, so that
+    // allocators can tell which chunk the pages given to reclaimChunkPages() belong to. The column
+    // is INVALID_COLUMN_ID for the CSR header of rel tables.
+    virtual void setChunkNodeGroupIdx(common::node_group_idx_t /*nodeGroupIdx*/) {}
+    virtual void setChunkColumnID(common::column_id_t /*columnID*/) {}
 
     FileHandle* getDataFH() const { return dataFH; }
 
@@ -30,6 +30,10 @@ public:
     PageRange allocatePageRange(common::page_idx_t numPages) override;
     void freePageRange(PageRange block) override;
     void freeImmediatelyRewritablePageRange(FileHandle* fileHandle, PageRange block);
+    // Only reuses free pages, so the file never grows.
+    std::optional<PageRange> allocateFreePageRange(common::page_idx_t numPages);
+    // Returns pages allocated by allocateFreePageRange() which ended up unused.
+    void returnFreePageRange(PageRange block);
 
     // The page manager must first allocate space for itself so that its serialized version also
     // tracks the pages allocated itself
@@ -39,8 +43,14 @@ public:
     void deserialize(common::Deserializer& deSer);
     void finalizeCheckpoint();
     void rollbackCheckpoint() { freeSpaceManager->rollbackCheckpoint(); }
+    // Drops the free page ranges before they are deserialized again from a newer checkpoint.
+    void resetFreeSpace() {
+        freeSpaceManager = std::make_unique<FreeSpaceManager>();
+        version = 0;
+    }
 
     common::row_idx_t getNumFreeEntries() const { return freeSpaceManager->getNumEntries(); }
+    common::page_idx_t getNumFreePages() const { return freeSpaceManager->getNumPages(); }
     std::vector<PageRange> getFreeEntries(common::row_idx_t startOffset,
         common::row_idx_t endOffset) const {
         return freeSpaceManager->getEntries(startOffset, endOffset);
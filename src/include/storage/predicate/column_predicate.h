@@ -20,6 +20,9 @@ public:
     }
     void tryAddPredicate(const binder::Expression& column, const binder::Expression& predicate);
     bool isEmpty() const { return predicates.empty(); }
+    const std::vector<std::unique_ptr<ColumnPredicate>>& getPredicates() const {
+        return predicates;
+    }
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const;
 
@@ -40,6 +43,8 @@ public:
 
     virtual ~ColumnPredicate() = default;
 
+    common::ExpressionType getExpressionType() const { return expressionType; }
+
     virtual common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const = 0;
 
     virtual std::string toString();
@@ -57,8 +62,11 @@ protected:
 };
 
 struct RYU_API ColumnPredicateUtil {
+    // Prefix predicates can only be checked against the zone maps of our own storage and are not
+    // rendered as SQL that external scans understand, so callers pushing predicates into foreign
+    // tables must not allow them.
     static std::unique_ptr<ColumnPredicate> tryConvert(const binder::Expression& column,
-        const binder::Expression& predicate);
+        const binder::Expression& predicate, bool allowStringPrefix = true);
 };
 
 } // namespace storage
@@ -14,6 +14,10 @@ public:
         : ColumnPredicate{std::move(columnName), expressionType}, value{std::move(value)} {}
 
     common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+    static common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats,
+        common::ExpressionType expressionType, const common::Value& value);
+
+    const common::Value& getValue() const { return value; }
 
     std::string toString() override;
 
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <mutex>
+
+#include "column_predicate.h"
+#include "common/types/value/value.h"
+
+namespace ryu {
+namespace storage {
+
+// A bound which an operator tightens while the query runs, e.g. the boundary of the tuples kept by
+// a top-k. Values satisfy the bound if they are at most (LESS_THAN_EQUALS) or at least
+// (GREATER_THAN_EQUALS) its current value. Nulls and all values satisfy it until it is set.
+class RYU_API DynamicBound {
+public:
+    explicit DynamicBound(common::ExpressionType expressionType);
+
+    common::ExpressionType getExpressionType() const { return expressionType; }
+
+    // Replaces the current value if the given one is tighter. Null values are ignored.
+    void tighten(const common::Value& newValue);
+    std::shared_ptr<const common::Value> getValue() const;
+
+    // Returns true if the given value, of the physical type of the bound, satisfies the bound.
+    template<typename T>
+    static bool satisfies(common::ExpressionType expressionType, T value, T bound) {
+        return expressionType == common::ExpressionType::LESS_THAN_EQUALS ? value <= bound :
+                                                                            value >= bound;
+    }
+
+private:
+    common::ExpressionType expressionType;
+    mutable std::mutex mtx;
+    std::shared_ptr<const common::Value> value;
+};
+
+// Checks zone maps against the value a dynamic bound has when a chunk is scanned.
+class ColumnDynamicPredicate : public ColumnPredicate {
+public:
+    ColumnDynamicPredicate(std::string columnName, std::shared_ptr<DynamicBound> bound)
+        : ColumnPredicate{std::move(columnName), bound->getExpressionType()},
+          bound{std::move(bound)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+
+    std::string toString() override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnDynamicPredicate>(columnName, bound);
+    }
+
+private:
+    std::shared_ptr<DynamicBound> bound;
+};
+
+} // namespace storage
+} // namespace ryu
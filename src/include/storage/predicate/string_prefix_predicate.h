@@ -0,0 +1,28 @@
+#pragma once
+
+#include "column_predicate.h"
+
+namespace ryu {
+namespace storage {
+
+// Predicate for STARTS_WITH on a string column with a constant prefix
+class ColumnStringPrefixPredicate : public ColumnPredicate {
+public:
+    ColumnStringPrefixPredicate(std::string columnName, std::string prefix)
+        : ColumnPredicate{std::move(columnName), common::ExpressionType::FUNCTION},
+          prefix{std::move(prefix)} {}
+
+    common::ZoneMapCheckResult checkZoneMap(const MergedColumnChunkStats& stats) const override;
+
+    std::string toString() override;
+
+    std::unique_ptr<ColumnPredicate> copy() const override {
+        return std::make_unique<ColumnStringPrefixPredicate>(columnName, prefix);
+    }
+
+private:
+    std::string prefix;
+};
+
+} // namespace storage
+} // namespace ryu
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "common/types/uuid.h"
 #include "storage/file_handle.h"
 
@@ -21,15 +23,20 @@ struct ShadowFileHeader {
 static_assert(std::is_trivially_copyable_v<ShadowFileHeader>);
 
 class BufferManager;
-// NOTE: This class is NOT thread-safe for now, as we are not checkpointing in parallel yet.
+// Node groups are checkpointed in parallel, so shadow pages can be created from multiple threads.
+// Lookups and creation of shadow pages are guarded by a mutex; clearing and flushing the file only
+// happen from a single thread.
 class ShadowFile {
+    // Fewer records are applied by a single thread.
+    static constexpr uint64_t MIN_NUM_RECORDS_PER_THREAD = 256;
+
 public:
     ShadowFile(BufferManager& bm, common::VirtualFileSystem* vfs, const std::string& databasePath);
 
     // TODO(Guodong): Remove originalFile param.
     bool hasShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage) const {
-        return shadowPagesMap.contains(originalFile) &&
-               shadowPagesMap.at(originalFile).contains(originalPage);
+        std::unique_lock lck{mtx};
+        return hasShadowPageNoLock(originalFile, originalPage);
     }
     void clearShadowPage(common::file_idx_t originalFile, common::page_idx_t originalPage);
     common::page_idx_t getShadowPage(common::file_idx_t originalFile,
@@ -52,9 +59,16 @@ public:
     static void replayShadowPageRecords(main::ClientContext& context);
 
 private:
+    bool hasShadowPageNoLock(common::file_idx_t originalFile,
+        common::page_idx_t originalPage) const {
+        return shadowPagesMap.contains(originalFile) &&
+               shadowPagesMap.at(originalFile).contains(originalPage);
+    }
+
     FileHandle* getOrCreateShadowingFH();
 
 private:
+    mutable std::mutex mtx;
     BufferManager& bm;
     std::string shadowFilePath;
     common::VirtualFileSystem* vfs;
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <optional>
 
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
 #include "common/vector/value_vector.h"
 #include "storage/stats/hyperloglog.h"
+#include "storage/stats/value_sample.h"
 
 namespace ryu {
 namespace storage {
@@ -16,15 +18,29 @@ public:
     explicit ColumnStats(const common::LogicalType& dataType);
     EXPLICIT_COPY_DEFAULT_MOVE(ColumnStats);
 
-    common::cardinality_t getNumDistinctValues() const { return hll ? hll->count() : 0; }
+    common::cardinality_t getNumDistinctValues() const {
+        return std::max<common::cardinality_t>(hll ? hll->count() : 0, numDistinctValuesEstimate);
+    }
+    // Returns nullptr if values of the column's type are not sampled.
+    const ValueSample* getSample() const { return sample ? &*sample : nullptr; }
 
     void update(const common::ValueVector* vector);
+    // Scales stats collected from a sample of `numSampledRows` rows up to the whole table, which
+    // is `scale` times larger. The distinct count is only scaled up for columns whose sampled
+    // values are (almost) all distinct, since repeated values likely repeat outside the sample.
+    void extrapolate(double scale, common::row_idx_t numSampledRows);
 
     void merge(const ColumnStats& other) {
         if (hll) {
             KU_ASSERT(other.hll);
             hll->merge(*other.hll);
         };
+        if (sample) {
+            KU_ASSERT(other.sample);
+            sample->merge(*other.sample);
+        }
+        numDistinctValuesEstimate =
+            std::max(numDistinctValuesEstimate, other.numDistinctValuesEstimate);
     }
 
     void serialize(common::Serializer& serializer) const {
@@ -34,6 +50,14 @@ public:
             serializer.writeDebuggingInfo("hll");
             hll->serialize(serializer);
         }
+        serializer.writeDebuggingInfo("has_sample");
+        serializer.serializeValue(sample.has_value());
+        if (sample) {
+            serializer.writeDebuggingInfo("sample");
+            sample->serialize(serializer);
+        }
+        serializer.writeDebuggingInfo("num_distinct_values_estimate");
+        serializer.serializeValue(numDistinctValuesEstimate);
     }
 
     static ColumnStats deserialize(common::Deserializer& deserializer) {
@@ -46,14 +70,28 @@ public:
             deserializer.validateDebuggingInfo(info, "hll");
             columnStats.hll = HyperLogLog::deserialize(deserializer);
         }
+        deserializer.validateDebuggingInfo(info, "has_sample");
+        bool hasSample = false;
+        deserializer.deserializeValue(hasSample);
+        if (hasSample) {
+            deserializer.validateDebuggingInfo(info, "sample");
+            columnStats.sample = ValueSample::deserialize(deserializer);
+        }
+        deserializer.validateDebuggingInfo(info, "num_distinct_values_estimate");
+        deserializer.deserializeValue(columnStats.numDistinctValuesEstimate);
         return columnStats;
     }
 
 private:
-    ColumnStats(const ColumnStats& other) : hll{other.hll}, hashes{nullptr} {}
+    ColumnStats(const ColumnStats& other)
+        : hll{other.hll}, sample{other.sample},
+          numDistinctValuesEstimate{other.numDistinctValuesEstimate}, hashes{nullptr} {}
 
 private:
     std::optional<HyperLogLog> hll;
+    std::optional<ValueSample> sample;
+    // Distinct count extrapolated by ANALYZE from a sample of the table.
+    common::cardinality_t numDistinctValuesEstimate = 0;
     // Preallocated vector for hash values.
     std::unique_ptr<common::ValueVector> hashes;
 };
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/types/types.h"
+
+namespace ryu {
+namespace storage {
+
+// Summary of the number of rels of each bound node in one direction of a rel table. It is
+// recomputed from the CSR lengths whenever a CSR node group is written to disk, i.e. at COPY and
+// at checkpoint.
+struct DegreeStats {
+    // Number of bound nodes with at least one rel.
+    common::cardinality_t numNodes = 0;
+    common::cardinality_t sumDegrees = 0;
+    // Kept as a double since it easily overflows for hub nodes.
+    double sumSquaredDegrees = 0;
+    common::length_t maxDegree = 0;
+
+    void add(common::length_t degree) {
+        if (degree == 0) {
+            return;
+        }
+        numNodes++;
+        sumDegrees += degree;
+        sumSquaredDegrees += static_cast<double>(degree) * static_cast<double>(degree);
+        maxDegree = std::max(maxDegree, degree);
+    }
+
+    void merge(const DegreeStats& other) {
+        numNodes += other.numNodes;
+        sumDegrees += other.sumDegrees;
+        sumSquaredDegrees += other.sumSquaredDegrees;
+        maxDegree = std::max(maxDegree, other.maxDegree);
+    }
+
+    // Expected degree of the bound node of a uniformly picked rel, i.e. E[d^2] / E[d]. Nodes
+    // reached by following rels are biased towards high degree nodes in that way. On power-law
+    // graphs this is much larger than the average degree.
+    double getSizeBiasedDegree() const {
+        return sumDegrees == 0 ? 0 : sumSquaredDegrees / static_cast<double>(sumDegrees);
+    }
+
+    void serialize(common::Serializer& serializer) const {
+        serializer.writeDebuggingInfo("num_nodes");
+        serializer.write(numNodes);
+        serializer.writeDebuggingInfo("sum_degrees");
+        serializer.write(sumDegrees);
+        serializer.writeDebuggingInfo("sum_squared_degrees");
+        serializer.write(sumSquaredDegrees);
+        serializer.writeDebuggingInfo("max_degree");
+        serializer.write(maxDegree);
+    }
+
+    static DegreeStats deserialize(common::Deserializer& deSer) {
+        DegreeStats stats;
+        std::string info;
+        deSer.validateDebuggingInfo(info, "num_nodes");
+        deSer.deserializeValue(stats.numNodes);
+        deSer.validateDebuggingInfo(info, "sum_degrees");
+        deSer.deserializeValue(stats.sumDegrees);
+        deSer.validateDebuggingInfo(info, "sum_squared_degrees");
+        deSer.deserializeValue(stats.sumSquaredDegrees);
+        deSer.validateDebuggingInfo(info, "max_degree");
+        deSer.deserializeValue(stats.maxDegree);
+        return stats;
+    }
+};
+
+} // namespace storage
+} // namespace ryu
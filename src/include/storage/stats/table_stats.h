@@ -35,6 +35,25 @@ public:
         }
     }
 
+    // Replaces the cardinality and the stats of the given columns, e.g. after recomputing them.
+    void replace(const std::vector<common::column_id_t>& columnIDs, TableStats other) {
+        cardinality = other.cardinality;
+        KU_ASSERT(columnIDs.size() == other.columnStats.size());
+        for (auto i = 0u; i < columnIDs.size(); ++i) {
+            KU_ASSERT(columnIDs[i] < columnStats.size());
+            columnStats[columnIDs[i]] = std::move(other.columnStats[i]);
+        }
+    }
+
+    // Scales stats collected from a sample of the table up to the whole table, which has `scale`
+    // times as many rows.
+    void extrapolate(double scale) {
+        for (auto& stats : columnStats) {
+            stats.extrapolate(scale, cardinality);
+        }
+        cardinality = static_cast<common::cardinality_t>(cardinality * scale);
+    }
+
     common::cardinality_t getTableCard() const { return cardinality; }
 
     common::cardinality_t getNumDistinctValues(common::column_id_t columnID) const {
@@ -42,6 +61,11 @@ public:
         return columnStats[columnID].getNumDistinctValues();
     }
 
+    const ColumnStats& getColumnStats(common::column_id_t columnID) const {
+        KU_ASSERT(columnID < columnStats.size());
+        return columnStats[columnID];
+    }
+
     void update(const std::vector<common::ValueVector*>& vectors,
         size_t numColumns = std::numeric_limits<size_t>::max());
     void update(const std::vector<common::column_id_t>& columnIDs,
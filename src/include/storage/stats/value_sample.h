@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+
+#include "common/types/types.h"
+
+namespace ryu {
+namespace common {
+class Serializer;
+class Deserializer;
+} // namespace common
+
+namespace storage {
+
+struct MostCommonValue {
+    double value;
+    // Fraction of the sampled (non-null) values equal to `value`.
+    double frequency;
+};
+
+// Summary of the distribution of a numeric column, derived from a ValueSample. Values seen more
+// than once in the sample are kept as most common values; the remaining ones are split into buckets
+// holding the same number of sampled values each.
+struct EquiDepthHistogram {
+    std::vector<MostCommonValue> mostCommonValues;
+    // Bucket i covers the values in [bounds[i], bounds[i + 1]].
+    std::vector<double> bounds;
+    // Fraction of the sampled values which are not most common values.
+    double remainingFraction = 0;
+
+    bool empty() const { return mostCommonValues.empty() && bounds.empty(); }
+
+    // Estimated fraction of non-null values equal to `value`.
+    double estimateEqualsSelectivity(double value,
+        common::cardinality_t numDistinctValues) const;
+    // Estimated fraction of non-null values smaller than (or equal to, if `inclusive`) `value`.
+    double estimateLessThanSelectivity(double value, bool inclusive) const;
+};
+
+// Uniform sample of the non-null values of a column. Every inserted value gets a pseudo-random
+// priority and the CAPACITY values with the smallest priorities are kept, so that samples collected
+// by different threads can be merged into a uniform sample of their union.
+class ValueSample {
+    struct Entry {
+        uint64_t priority;
+        double value;
+    };
+
+public:
+    static constexpr uint64_t CAPACITY = 256;
+    static constexpr uint64_t MAX_NUM_MOST_COMMON_VALUES = 16;
+    static constexpr uint64_t NUM_HISTOGRAM_BUCKETS = 32;
+
+    // Only types whose order is preserved when converting their values to double are sampled.
+    static bool isSampled(const common::LogicalType& dataType);
+
+    void insert(double value);
+    void merge(const ValueSample& other);
+
+    // Number of non-null values inserted, including those not kept in the sample.
+    uint64_t getNumValues() const { return numValues; }
+    // Scales the number of values inserted, e.g. when the sample was taken over part of a table.
+    void scaleNumValues(double scale) { numValues = static_cast<uint64_t>(numValues * scale); }
+
+    EquiDepthHistogram getHistogram() const;
+
+    void serialize(common::Serializer& serializer) const;
+    static ValueSample deserialize(common::Deserializer& deserializer);
+
+private:
+    void insert(Entry entry);
+
+private:
+    uint64_t numValues = 0;
+    // Max-heap on priority.
+    std::vector<Entry> entries;
+};
+
+} // namespace storage
+} // namespace ryu
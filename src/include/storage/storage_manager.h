@@ -4,6 +4,7 @@
 
 #include "catalog/catalog.h"
 #include "shadow_file.h"
+#include "storage/chunk_relocation.h"
 #include "storage/index/index.h"
 #include "storage/wal/wal.h"
 
@@ -24,6 +25,8 @@ class Table;
 class NodeTable;
 class RelTable;
 class DiskArrayCollection;
+class ColdStorage;
+class CheckpointLock;
 struct DatabaseHeader;
 
 class RYU_API StorageManager {
@@ -33,6 +36,8 @@ public:
     ~StorageManager();
 
     Table* getTable(common::table_id_t tableID);
+    // Whether the node groups of a table have been deserialized since the database was opened.
+    bool isTableLoaded(common::table_id_t tableID);
 
     static void recover(main::ClientContext& clientContext, bool throwOnWalReplayFailure,
         bool enableChecksums);
@@ -44,6 +49,32 @@ public:
     bool checkpoint(main::ClientContext* context, PageAllocator& pageAllocator);
     void finalizeCheckpoint();
     void rollbackCheckpoint(const catalog::Catalog& catalog);
+    void vacuumUpdates(common::transaction_t oldestActiveTS);
+    // Names of the node tables whose stats have gone stale, see NodeTable::needsAnalyze().
+    std::vector<std::string> getNodeTablesToAnalyze();
+    // Write versions of all tables, see Table::getWriteVersion().
+    common::table_id_map_t<uint64_t> getTableWriteVersions();
+    // In-memory databases don't checkpoint. Instead, full node groups are compressed into pages
+    // of the in-memory data file, which is what checkpoints do for on-disk databases.
+    void compactInMemoryNodeGroups(main::ClientContext* context);
+    bool hasCompactableNodeGroups();
+    // Moves the checkpointed column chunks of rel tables to the configured cold storage path.
+    void offloadColdPages(main::ClientContext& context);
+    // Records the runs of data file pages held in the buffer pool, so that they can be prewarmed
+    // after the database is opened again.
+    void saveBufferPoolSnapshot(main::ClientContext& context);
+    // Returns the page runs of the last snapshot, or none if there is no snapshot.
+    std::vector<PageRange> loadBufferPoolSnapshot(main::ClientContext& context) const;
+    // Reads the evicted pages of a run of the data file into the buffer pool. Returns false
+    // without reading them if they don't fit into the free memory of the buffer pool, since
+    // prewarming must not evict pages which are in use.
+    bool prewarmPages(PageRange pageRange);
+    // Prewarms the column chunks of a table, and the slots of its primary key index. Returns
+    // false if the buffer pool filled up before all of them were read.
+    bool prewarmTable(common::table_id_t tableID);
+    // Applies the checkpoints and commits that the writing process made since the last refresh of
+    // this read replica. Must be called with a shared checkpoint lock and no active transactions.
+    void refreshReplica(main::ClientContext& context, const CheckpointLock& lock);
 
     WAL& getWAL() const;
     ShadowFile& getShadowFile() const;
@@ -83,20 +114,54 @@ private:
     void createRelTableGroup(catalog::RelGroupCatalogEntry* entry);
 
     void reclaimDroppedTables(const catalog::Catalog& catalog);
+    // Returns true if any chunk was moved.
+    bool compactDataFile();
+
+    void serializeNodeGroupsNoLock(common::table_id_t tableID, common::Serializer& ser);
+    void skipNodeGroups(common::table_id_t tableID, common::Deserializer& deSer);
+    void loadNodeGroupsNoLock(common::table_id_t tableID);
+    void readNodeGroupsNoLock(common::table_id_t tableID, uint8_t* buffer) const;
+
+    void reloadReplicaCheckpoint(main::ClientContext& context);
 
 private:
+    // Location of the serialized node groups of a table relative to the start of the metadata.
+    struct NodeGroupsLocation {
+        uint64_t offset;
+        uint64_t size;
+    };
+
     std::mutex mtx;
     std::string databasePath;
     std::unique_ptr<storage::DatabaseHeader> databaseHeader;
     bool readOnly;
     FileHandle* dataFH;
     std::unordered_map<common::table_id_t, std::unique_ptr<Table>> tables;
+    // Tables whose node groups haven't been deserialized since the database was opened. They are
+    // deserialized on the first getTable() call, so opening a database doesn't have to read the
+    // metadata of every node group.
+    std::unordered_map<common::table_id_t, NodeGroupsLocation> unloadedNodeGroups;
+    // File offset of the metadata which unloaded node groups are read from.
+    uint64_t metadataFileOffset;
+    // Locations of unloaded node groups in the metadata written by the running checkpoint.
+    std::optional<std::unordered_map<common::table_id_t, NodeGroupsLocation>>
+        checkpointedNodeGroups;
+    // Chunks moved by the running checkpoint.
+    std::vector<ChunkRelocation> chunkRelocations;
     MemoryManager& memoryManager;
     std::unique_ptr<WAL> wal;
     std::unique_ptr<ShadowFile> shadowFile;
+    // Not set for in-memory databases.
+    std::unique_ptr<ColdStorage> coldStorage;
     bool enableCompression;
     bool inMemory;
     std::vector<IndexType> registeredIndexTypes;
+    // Read replicas only. The WAL offset up to which commits are applied, and the number of
+    // checkpoints of the writer that the checkpointed data was read after.
+    uint64_t replicaWALOffset;
+    uint64_t replicaNumCheckpoints;
+    // Set if a refresh failed halfway, after which everything is read again.
+    bool replicaNeedsReload;
 };
 
 } // namespace storage
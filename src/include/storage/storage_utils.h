@@ -75,6 +75,18 @@ public:
     static std::string getTmpFilePath(const std::string& path) {
         return common::stringFormat("{}.{}", path, common::StorageConstants::TEMP_FILE_SUFFIX);
     }
+    static std::string getColdStorageMapFilePath(const std::string& path) {
+        return common::stringFormat("{}.{}", path,
+            common::StorageConstants::COLD_STORAGE_MAP_SUFFIX);
+    }
+    static std::string getCheckpointLockFilePath(const std::string& path) {
+        return common::stringFormat("{}.{}", path,
+            common::StorageConstants::CHECKPOINT_LOCK_FILE_SUFFIX);
+    }
+    static std::string getBufferPoolSnapshotFilePath(const std::string& path) {
+        return common::stringFormat("{}.{}", path,
+            common::StorageConstants::BUFFER_POOL_SNAPSHOT_SUFFIX);
+    }
 
     static std::string expandPath(const main::ClientContext* context, const std::string& path);
 
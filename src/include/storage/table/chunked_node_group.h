@@ -4,11 +4,13 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <span>
 
 #include "common/enums/rel_multiplicity.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/buffer_manager/spill_result.h"
+#include "storage/buffer_manager/spillable_object.h"
 #include "storage/enums/residency_state.h"
 #include "storage/table/column_chunk.h"
 #include "storage/table/column_chunk_data.h"
@@ -36,11 +38,11 @@ class PageAllocator;
 
 enum class NodeGroupDataFormat : uint8_t { REGULAR = 0, CSR = 1 };
 
-class RYU_API InMemChunkedNodeGroup {
+class RYU_API InMemChunkedNodeGroup : public SpillableObject {
     friend class ChunkedNodeGroup;
 
 public:
-    virtual ~InMemChunkedNodeGroup() = default;
+    ~InMemChunkedNodeGroup() override = default;
     InMemChunkedNodeGroup(MemoryManager& mm, const std::vector<common::LogicalType>& columnTypes,
         bool enableCompression, uint64_t capacity, common::row_idx_t startRowIdx);
     InMemChunkedNodeGroup(std::vector<std::unique_ptr<ColumnChunkData>>&& chunks,
@@ -53,8 +55,11 @@ public:
     // I.e. if you want to be able to spill to disk again you must call setUnused first
     void loadFromDisk(const MemoryManager& mm);
     // returns the amount of space reclaimed in bytes
-    SpillResult spillToDisk();
+    SpillResult spillToDisk() override;
     void setUnused(const MemoryManager& mm);
+    // Prevents the group from being spilled without loading spilled chunks back, e.g. before the
+    // group is freed.
+    void clearUnused(const MemoryManager& mm);
 
     bool isFull() const { return numRows == capacity; }
     common::idx_t getNumColumns() const { return chunks.size(); }
@@ -184,8 +189,13 @@ public:
         common::offset_t offsetInOtherNodeGroup, common::offset_t numRowsToAppend);
 
     void scan(const transaction::Transaction* transaction, const TableScanState& scanState,
-        const NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInGroup,
+        NodeGroupScanState& nodeGroupScanState, common::offset_t rowIdxInGroup,
         common::length_t numRowsToScan) const;
+    // Whether the zone maps of the scanned columns rule out every row of the group for the
+    // predicates of the scan. The result is kept in the node group scan state, so the zone maps
+    // are checked once per group rather than once per scanned vector.
+    bool canSkipScan(const TableScanState& scanState,
+        NodeGroupScanState& nodeGroupScanState) const;
 
     template<ResidencyState SCAN_RESIDENCY_STATE>
     void scanCommitted(transaction::Transaction* transaction, TableScanState& scanState,
@@ -202,6 +212,10 @@ public:
 
     void update(const transaction::Transaction* transaction, common::row_idx_t rowIdxInChunk,
         common::column_id_t columnID, const common::ValueVector& propertyVector);
+    // Rows must be distinct and increasing.
+    void update(const transaction::Transaction* transaction,
+        std::span<const common::row_idx_t> rowIdxesInChunk, common::column_id_t columnID,
+        const common::ValueVector& propertyVector, std::span<const common::sel_t> valuePositions);
 
     bool delete_(const transaction::Transaction* transaction, common::row_idx_t rowIdxInChunk);
 
@@ -230,6 +244,9 @@ public:
     void rollbackDelete(common::row_idx_t startRow, common::row_idx_t numRows_,
         common::transaction_t commitTS);
     virtual void reclaimStorage(PageAllocator& pageAllocator) const;
+    void vacuumUpdates(common::transaction_t oldestActiveTS) const;
+    void prefetchPagesAsync(FileHandle& dataFH,
+        const std::vector<common::column_id_t>& columnIDs) const;
 
     uint64_t getEstimatedMemoryUsage() const;
 
@@ -254,6 +271,7 @@ protected:
     std::atomic<common::row_idx_t> numRows;
     std::vector<std::unique_ptr<ColumnChunk>> chunks;
     std::unique_ptr<VersionInfo> versionInfo;
+    std::mutex deletionMtx;
 };
 
 } // namespace storage
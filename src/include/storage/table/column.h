@@ -127,6 +127,11 @@ protected:
         const std::optional<StorageValue>& min, const std::optional<StorageValue>& max) const;
 
 protected:
+    // Reads the data pages covering the values to scan into the buffer pool with one batch of
+    // reads instead of one read at a time as each page is reached.
+    void prefetchPages(const SegmentState& state, common::offset_t startOffsetInSegment,
+        common::offset_t numValues) const;
+
     bool isEndOffsetOutOfPagesCapacity(const ColumnChunkMetadata& metadata,
         common::offset_t endOffset) const;
 
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 #include "common/assert.h"
 #include "common/cast.h"
@@ -13,6 +14,7 @@
 namespace ryu {
 namespace storage {
 class PageAllocator;
+class FileHandle;
 class MemoryManager;
 class Column;
 struct ColumnChunkScanner;
@@ -163,6 +165,11 @@ public:
         common::sel_t posInOutputVector) const;
     void update(const transaction::Transaction* transaction, common::offset_t offsetInChunk,
         const common::ValueVector& values);
+    // Updates the rows at offsetsInChunk, which must be distinct and increasing, with the values
+    // at valuePositions. Rows of the same vector share one version.
+    void update(const transaction::Transaction* transaction,
+        std::span<const common::offset_t> offsetsInChunk, const common::ValueVector& values,
+        std::span<const common::sel_t> valuePositions);
 
     uint64_t getEstimatedMemoryUsage() const {
         if (getResidencyState() == ResidencyState::ON_DISK) {
@@ -220,11 +227,19 @@ public:
     bool hasUpdates() const { return updateInfo.isSet(); }
     bool hasUpdates(const transaction::Transaction* transaction, common::row_idx_t startRow,
         common::length_t numRows) const;
+    bool isUpdatedByOtherTransaction(const transaction::Transaction* transaction,
+        common::row_idx_t rowInChunk) const {
+        return updateInfo.isUpdatedByOtherTransaction(transaction, rowInChunk);
+    }
     void resetUpdateInfo() { updateInfo.reset(); }
+    void vacuumUpdates(common::transaction_t oldestActiveTS) {
+        updateInfo.vacuum(oldestActiveTS);
+    }
 
     MergedColumnChunkStats getMergedColumnChunkStats() const;
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
+    void prefetchPagesAsync(FileHandle& dataFH) const;
 
     void append(common::ValueVector* vector, const common::SelectionView& selView);
     void append(const ColumnChunk* other, common::offset_t startPosInOtherChunk,
@@ -13,6 +13,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/compression/compression.h"
+#include "storage/enums/page_access_pattern.h"
 #include "storage/enums/residency_state.h"
 #include "storage/table/column_chunk_metadata.h"
 #include "storage/table/column_chunk_stats.h"
@@ -43,6 +44,7 @@ struct SegmentState {
     const Column* column;
     ColumnChunkMetadata metadata;
     uint64_t numValuesPerPage = UINT64_MAX;
+    PageAccessPattern pageAccessPattern = PageAccessPattern::NORMAL;
     std::unique_ptr<SegmentState> nullState;
 
     // Used for struct/list/string columns.
@@ -87,6 +89,8 @@ struct SegmentState {
     }
 
     void reclaimAllocatedPages(PageAllocator& pageAllocator) const;
+    // Sets the access pattern of this state and of its null and children states.
+    void setPageAccessPattern(PageAccessPattern accessPattern);
 
     // Used by rangeSegments in column_chunk.h to provide the same interface as the segments stored
     // in ColumnChunk inside unique_ptr
@@ -272,6 +276,8 @@ public:
     void updateStats(const common::ValueVector* vector, const common::SelectionView& selVector);
 
     virtual void reclaimStorage(PageAllocator& pageAllocator);
+    // Hints that the pages of the on-disk data (including nested chunks) will be read soon.
+    virtual void prefetchPagesAsync(FileHandle& dataFH) const;
 
     std::vector<std::unique_ptr<ColumnChunkData>> split(bool targetMaxSize = false) const;
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string_view>
+#include <utility>
+
 #include "storage/compression/compression.h"
 namespace common {
 class ValueVector;
@@ -21,6 +24,17 @@ struct RYU_API ColumnChunkStats {
     void reset();
 };
 
+// String statistics track the first PREFIX_LENGTH bytes of each string, packed big-endian and
+// zero-padded into an unsigned integer. Packed prefixes are ordered the same way as the strings
+// they are taken from, except that strings sharing a prefix compare equal.
+struct RYU_API StringPrefixStats {
+    static constexpr uint64_t PREFIX_LENGTH = sizeof(uint64_t);
+
+    static uint64_t getPrefix(std::string_view str);
+    // Returns the smallest and largest packed prefixes of strings starting with the given string
+    static std::pair<uint64_t, uint64_t> getPrefixRange(std::string_view prefix);
+};
+
 struct MergedColumnChunkStats {
     MergedColumnChunkStats(ColumnChunkStats stats, bool guaranteedNoNulls, bool guaranteedAllNulls)
         : stats(stats), guaranteedNoNulls(guaranteedNoNulls),
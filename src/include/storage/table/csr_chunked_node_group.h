@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "storage/enums/residency_state.h"
+#include "storage/stats/degree_stats.h"
 #include "storage/table/chunked_node_group.h"
 #include "storage/table/column_chunk.h"
 
@@ -82,7 +83,9 @@ struct RYU_API InMemChunkedCSRHeader {
     }
 
     // Return a vector of CSR offsets for the end of each CSR region.
-    common::offset_vec_t populateStartCSROffsetsFromLength(bool leaveGaps) const;
+    // Gaps are left so that regions are filled up to packedDensity.
+    common::offset_vec_t populateStartCSROffsetsFromLength(bool leaveGaps,
+        double packedDensity) const;
     void populateEndCSROffsetFromStartAndLength() const;
     void finalizeCSRRegionEndOffsets(const common::offset_vec_t& rightCSROffsetOfRegions) const;
     void populateRegionCSROffsets(const CSRRegion& region,
@@ -90,8 +93,10 @@ struct RYU_API InMemChunkedCSRHeader {
     void populateEndCSROffsets(const common::offset_vec_t& gaps) const;
     common::idx_t getNumRegions() const;
 
+    DegreeStats computeDegreeStats() const;
+
 private:
-    static common::length_t computeGapFromLength(common::length_t length);
+    static common::length_t computeGapFromLength(common::length_t length, double packedDensity);
 };
 
 struct ChunkedCSRHeader {
@@ -118,7 +123,9 @@ struct ChunkedCSRHeader {
     bool sanityCheck() const;
 
     // Return a vector of CSR offsets for the end of each CSR region.
-    common::offset_vec_t populateStartCSROffsetsFromLength(bool leaveGaps) const;
+    // Gaps are left so that regions are filled up to packedDensity.
+    common::offset_vec_t populateStartCSROffsetsFromLength(bool leaveGaps,
+        double packedDensity) const;
     void populateEndCSROffsetFromStartAndLength() const;
     void finalizeCSRRegionEndOffsets(const common::offset_vec_t& rightCSROffsetOfRegions) const;
     void populateRegionCSROffsets(const CSRRegion& region, const ChunkedCSRHeader& oldHeader) const;
@@ -126,7 +133,7 @@ struct ChunkedCSRHeader {
     common::idx_t getNumRegions() const;
 
 private:
-    static common::length_t computeGapFromLength(common::length_t length);
+    static common::length_t computeGapFromLength(common::length_t length, double packedDensity);
 };
 
 class InMemChunkedCSRNodeGroup;
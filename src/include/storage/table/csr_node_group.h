@@ -2,6 +2,8 @@
 
 #include <array>
 #include <bitset>
+#include <concepts>
+#include <unordered_map>
 
 #include "common/constants.h"
 #include "common/system_config.h"
@@ -18,6 +20,31 @@ class MemoryManager;
 
 using row_idx_vec_t = std::vector<common::row_idx_t>;
 
+// Rels of a rel group with a sort property are kept in ascending order of the property within each
+// CSR list, with nulls last. Only properties stored as integers can be used as sort keys.
+template<typename T>
+concept CSRSortKey = std::integral<T> && !std::same_as<T, bool>;
+
+template<CSRSortKey T>
+struct CSRSortKeyValue {
+    bool isNull = true;
+    T value = 0;
+
+    static CSRSortKeyValue read(const ColumnChunkData& chunk, common::offset_t pos) {
+        if (chunk.isNull(pos)) {
+            return CSRSortKeyValue{};
+        }
+        return CSRSortKeyValue{false, chunk.getValue<T>(pos)};
+    }
+
+    bool operator<(const CSRSortKeyValue& other) const {
+        if (isNull || other.isNull) {
+            return !isNull && other.isNull;
+        }
+        return value < other.value;
+    }
+};
+
 struct csr_list_t {
     common::row_idx_t startRow = common::INVALID_ROW_IDX;
     common::length_t length = 0;
@@ -96,17 +123,44 @@ struct CSRIndex {
     }
 };
 
-// TODO(Guodong): Serialize the info to disk. This should be a config per node group.
+// Density parameters of the packed CSR layout, kept per node group. Regions are upgraded to their
+// parent once their density exceeds the high density of their level, which goes from
+// LEAF_HIGH_CSR_DENSITY at the leaves down to PACKED_CSR_DENSITY at the top. When the whole node
+// group is over its bound, it is redistributed, filling each leaf region up to `packedDensity` and
+// leaving the rest as gaps.
+// `packedDensity` is learned from how often the node group has to be redistributed: node groups
+// redistributed again soon get more gaps, so that skewed insertions are absorbed without rewriting
+// the whole group, and quiet ones are packed back tighter. It is persisted with the node group.
 struct PackedCSRInfo {
     static_assert(common::StorageConfig::NODE_GROUP_SIZE_LOG2 >
                   common::StorageConfig::CSR_LEAF_REGION_SIZE_LOG2);
-    uint64_t calibratorTreeHeight = common::StorageConfig::NODE_GROUP_SIZE_LOG2 -
-                                    common::StorageConfig::CSR_LEAF_REGION_SIZE_LOG2;
-    double highDensityStep = (common::StorageConstants::LEAF_HIGH_CSR_DENSITY -
-                                 common::StorageConstants::PACKED_CSR_DENSITY) /
-                             static_cast<double>(calibratorTreeHeight);
-
-    constexpr PackedCSRInfo() noexcept = default;
+    static constexpr uint64_t CALIBRATOR_TREE_HEIGHT =
+        common::StorageConfig::NODE_GROUP_SIZE_LOG2 -
+        common::StorageConfig::CSR_LEAF_REGION_SIZE_LOG2;
+    static constexpr double HIGH_DENSITY_STEP = (common::StorageConstants::LEAF_HIGH_CSR_DENSITY -
+                                                    common::StorageConstants::PACKED_CSR_DENSITY) /
+                                                static_cast<double>(CALIBRATOR_TREE_HEIGHT);
+    // The packed density can't go over the high density of the top level, otherwise a node group
+    // would need to be redistributed again right after being redistributed.
+    static constexpr double MIN_PACKED_DENSITY = 0.5;
+    static constexpr double MAX_PACKED_DENSITY = common::StorageConstants::PACKED_CSR_DENSITY;
+    static constexpr double PACKED_DENSITY_STEP = 0.1;
+    // Number of checkpoints with changes to the persistent data since the last redistribution
+    // below which the packed density is lowered, and from which it is raised.
+    static constexpr uint64_t FREQUENT_REDISTRIBUTION_THRESHOLD = 4;
+    static constexpr uint64_t RARE_REDISTRIBUTION_THRESHOLD = 32;
+
+    double packedDensity = common::StorageConstants::PACKED_CSR_DENSITY;
+    uint64_t numCheckpointsSinceRedistribution = 0;
+
+    static double getHighDensity(uint64_t level);
+
+    // Records a checkpoint changing the persistent data of the node group. Must be called before
+    // the node group is redistributed, so that the new layout uses the adapted density.
+    void recordCheckpoint(bool needRedistribution);
+
+    void serialize(common::Serializer& serializer) const;
+    static PackedCSRInfo deserialize(common::Deserializer& deSer);
 };
 
 class CSRNodeGroup;
@@ -122,6 +176,9 @@ struct CSRNodeGroupScanState final : NodeGroupScanState {
     // The number of rows (i.e., rels) that have been scanned so far in current node group.
     common::row_idx_t numCachedRows;
     common::row_idx_t nextCachedRowToScan;
+    // End (exclusive) of the rows to scan within the persistent csr list when a single bound node
+    // is scanned. Invalid until the scan of the list starts.
+    common::row_idx_t csrListEndRow;
 
     // States at the csr list level. Cached during scan over a single csr list.
     NodeCSRIndex inMemCSRList;
@@ -131,12 +188,15 @@ struct CSRNodeGroupScanState final : NodeGroupScanState {
     // This is for local scan state where we don't need `header`.
     explicit CSRNodeGroupScanState()
         : header{nullptr}, numTotalRows{0}, numCachedRows{0}, nextCachedRowToScan{0},
+          csrListEndRow{common::INVALID_ROW_IDX},
           source{CSRNodeGroupScanSource::COMMITTED_PERSISTENT} {}
     explicit CSRNodeGroupScanState(common::idx_t numChunks)
         : NodeGroupScanState{numChunks}, header{nullptr}, numTotalRows{0}, numCachedRows{0},
-          nextCachedRowToScan{0}, source{CSRNodeGroupScanSource::COMMITTED_PERSISTENT} {}
+          nextCachedRowToScan{0}, csrListEndRow{common::INVALID_ROW_IDX},
+          source{CSRNodeGroupScanSource::COMMITTED_PERSISTENT} {}
     explicit CSRNodeGroupScanState(MemoryManager& mm, bool randomLookup = false)
         : numTotalRows{0}, numCachedRows{0}, nextCachedRowToScan{0},
+          csrListEndRow{common::INVALID_ROW_IDX},
           source{CSRNodeGroupScanSource::COMMITTED_PERSISTENT} {
         header = std::make_unique<InMemChunkedCSRHeader>(mm, false,
             randomLookup ? 1 : common::StorageConfig::NODE_GROUP_SIZE);
@@ -151,6 +211,8 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
 
     std::unique_ptr<InMemChunkedCSRHeader> oldHeader;
     std::unique_ptr<InMemChunkedCSRHeader> newHeader;
+    // Column of the rel group's sort property, if it has one.
+    common::column_id_t sortColumnID = common::INVALID_COLUMN_ID;
 
     CSRNodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm,
@@ -159,6 +221,11 @@ struct CSRNodeGroupCheckpointState final : NodeGroupCheckpointState {
           csrOffsetColumn{csrOffsetCol}, csrLengthColumn{csrLengthCol} {}
 };
 
+// Order in which the old persistent rows and the in-memory insertions of a CSR list are merged when
+// the rel group has a sort property. Deleted persistent rows are included and skipped on write.
+using csr_sorted_merge_t = std::vector<bool /* fromPersistent */>;
+using csr_sorted_merges_t = std::unordered_map<common::offset_t, csr_sorted_merge_t>;
+
 static constexpr common::column_id_t NBR_ID_COLUMN_ID = 0;
 static constexpr common::column_id_t REL_ID_COLUMN_ID = 1;
 
@@ -171,16 +238,16 @@ static constexpr common::column_id_t REL_ID_COLUMN_ID = 1;
 // node.
 class CSRNodeGroup final : public NodeGroup {
 public:
-    static constexpr PackedCSRInfo DEFAULT_PACKED_CSR_INFO{};
-
     CSRNodeGroup(MemoryManager& mm, const common::node_group_idx_t nodeGroupIdx,
         const bool enableCompression, std::vector<common::LogicalType> dataTypes)
         : NodeGroup{mm, nodeGroupIdx, enableCompression, std::move(dataTypes),
               common::INVALID_OFFSET, NodeGroupDataFormat::CSR} {}
     CSRNodeGroup(MemoryManager& mm, const common::node_group_idx_t nodeGroupIdx,
-        const bool enableCompression, std::unique_ptr<ChunkedNodeGroup> chunkedNodeGroup)
+        const bool enableCompression, std::unique_ptr<ChunkedNodeGroup> chunkedNodeGroup,
+        PackedCSRInfo packedCSRInfo, DegreeStats degreeStats)
         : NodeGroup{mm, nodeGroupIdx, enableCompression, common::INVALID_OFFSET,
               NodeGroupDataFormat::CSR},
+          packedCSRInfo{packedCSRInfo}, degreeStats{degreeStats},
           persistentChunkGroup{std::move(chunkedNodeGroup)} {
         for (auto i = 0u; i < persistentChunkGroup->getNumColumns(); i++) {
             dataTypes.push_back(persistentChunkGroup->getColumnChunk(i).getDataType().copy());
@@ -210,13 +277,20 @@ public:
 
     void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state) override;
     void reclaimStorage(PageAllocator& pageAllocator, const common::UniqLock& lock) const override;
+    void vacuumUpdates(common::transaction_t oldestActiveTS,
+        const common::UniqLock& lock) const override;
 
     bool isEmpty() const override { return !persistentChunkGroup && NodeGroup::isEmpty(); }
 
     ChunkedNodeGroup* getPersistentChunkedGroup() const { return persistentChunkGroup.get(); }
-    void setPersistentChunkedGroup(std::unique_ptr<ChunkedNodeGroup> chunkedNodeGroup) {
+    const PackedCSRInfo& getPackedCSRInfo() const { return packedCSRInfo; }
+    // Degrees of the persistent data only.
+    const DegreeStats& getDegreeStats() const { return degreeStats; }
+    void setPersistentChunkedGroup(std::unique_ptr<ChunkedNodeGroup> chunkedNodeGroup,
+        DegreeStats degreeStats_) {
         KU_ASSERT(chunkedNodeGroup->getFormat() == NodeGroupDataFormat::CSR);
         persistentChunkGroup = std::move(chunkedNodeGroup);
+        degreeStats = degreeStats_;
     }
 
     void serialize(common::Serializer& serializer) override;
@@ -238,6 +312,11 @@ private:
     NodeGroupScanResult scanCommittedPersistentWithoutCache(
         const transaction::Transaction* transaction, RelTableScanState& tableState,
         CSRNodeGroupScanState& nodeGroupScanState) const;
+    // Narrows the scan of a persistent csr list down to the rows whose sort keys may satisfy the
+    // sort key predicates of the scan.
+    void narrowScanBySortKey(const transaction::Transaction* transaction,
+        const RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState,
+        common::row_idx_t startRow, common::length_t csrListLength) const;
 
     NodeGroupScanResult scanCommittedInMem(const transaction::Transaction* transaction,
         RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const;
@@ -252,6 +331,12 @@ private:
     void populateCSRLengthInMemOnly(const common::UniqLock& lock, common::offset_t numNodes,
         const CSRNodeGroupCheckpointState& csrState);
 
+    // Orders the valid in-memory rows of each CSR list by their sort keys.
+    void sortInMemCSRLists(const common::UniqLock& lock,
+        const CSRNodeGroupCheckpointState& csrState) const;
+    csr_sorted_merges_t planSortedMerges(const common::UniqLock& lock,
+        const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions) const;
+
     void collectRegionChangesAndUpdateHeaderLength(const common::UniqLock& lock, CSRRegion& region,
         const CSRNodeGroupCheckpointState& csrState) const;
     void collectInMemRegionChangesAndUpdateHeaderLength(const common::UniqLock& lock,
@@ -268,21 +353,24 @@ private:
         const CSRNodeGroupCheckpointState& csrState) const;
 
     static void redistributeCSRRegions(const CSRNodeGroupCheckpointState& csrState,
-        const std::vector<CSRRegion>& leafRegions);
+        const std::vector<CSRRegion>& leafRegions, double packedDensity);
     static std::vector<CSRRegion> mergeRegionsToCheckpoint(
         const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& leafRegions);
     static bool isWithinDensityBound(const InMemChunkedCSRHeader& header,
         const std::vector<CSRRegion>& leafRegions, const CSRRegion& region);
 
     void checkpointColumn(const common::UniqLock& lock, common::column_id_t columnID,
-        const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions) const;
+        const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions,
+        const csr_sorted_merges_t& sortedMerges) const;
     std::vector<ChunkCheckpointState> checkpointColumnInRegion(const common::UniqLock& lock,
         common::column_id_t columnID, const CSRNodeGroupCheckpointState& csrState,
-        const CSRRegion& region) const;
+        const CSRRegion& region, const csr_sorted_merges_t& sortedMerges) const;
     void checkpointCSRHeaderColumns(const CSRNodeGroupCheckpointState& csrState) const;
     void finalizeCheckpoint(const common::UniqLock& lock);
 
 private:
+    PackedCSRInfo packedCSRInfo;
+    DegreeStats degreeStats;
     std::unique_ptr<ChunkedNodeGroup> persistentChunkGroup;
     std::unique_ptr<CSRIndex> csrIndex;
 };
@@ -48,14 +48,26 @@ public:
     static std::unique_ptr<DictionaryChunk> deserialize(MemoryManager& memoryManager,
         common::Deserializer& deSer);
 
+    // Flushes the string data and offsets. If compression is enabled, the string data is encoded
+    // with a static symbol table first when that makes it smaller.
     void flush(PageAllocator& pageAllocator);
 
+    // Returns a copy of the dictionary whose string data is encoded with a symbol table built from
+    // its strings, or nullptr if compression is disabled or would not save any pages.
+    // The offsets of the copy refer to the encoded data, so it can only be flushed.
+    std::unique_ptr<DictionaryChunk> compressStringData() const;
+    // Marks the metadata of the flushed string data as being encoded with this dictionary's
+    // symbol table, if it has one
+    void setStringDataCompression(ColumnChunkMetadata& stringDataMetadata) const;
+
 private:
     bool enableCompression;
     // String data is stored as a UINT8 chunk, using the numValues in the chunk to track the number
     // of characters stored.
     std::unique_ptr<ColumnChunkData> stringDataChunk;
     std::unique_ptr<ColumnChunkData> offsetChunk;
+    // Only set for dictionaries produced by compressStringData
+    std::optional<FSSTSymbolTable> symbolTable;
 
     struct DictionaryEntry {
         string_index_t index;
@@ -36,8 +36,18 @@ private:
         uint64_t index, uint64_t numValues, uint64_t dataSize) const;
     void scanValue(const SegmentState& dataState, uint64_t startOffset, uint64_t endOffset,
         StringChunkData* result, uint64_t offsetInVector) const;
-    void scanValue(const SegmentState& dataState, uint64_t startOffset, uint64_t endOffset,
-        common::ValueVector* resultVector, uint64_t offsetInVector) const;
+    void scanValues(const SegmentState& dataState,
+        const std::vector<DictionaryChunk::string_offset_t>& offsets,
+        DictionaryChunk::string_index_t firstOffsetToScan,
+        const std::vector<std::pair<DictionaryChunk::string_index_t, uint64_t>>& offsetsToScan,
+        common::ValueVector* resultVector) const;
+    static void copyValue(const SegmentState& dataState, const uint8_t* data, uint64_t length,
+        common::ValueVector* resultVector, uint64_t offsetInVector);
+
+    // Whether the string data is encoded with a symbol table, in which case both the string data
+    // and its offsets refer to the encoded bytes
+    static bool isEncoded(const SegmentState& dataState);
+    static const FSSTSymbolTable& getSymbolTable(const SegmentState& dataState);
 
     static bool canDataCommitInPlace(const SegmentState& dataState,
         uint64_t totalStringLengthToAdd);
@@ -28,6 +28,12 @@ public:
         KU_ASSERT(groupIdx < chunkedGroups.size());
         return *chunkedGroups[groupIdx];
     }
+    // Moves the chunked group out of the collection, leaving nullptr in its place, so that it can
+    // be freed as soon as it has been processed.
+    std::unique_ptr<InMemChunkedNodeGroup> moveChunkedGroup(common::node_group_idx_t groupIdx) {
+        KU_ASSERT(groupIdx < chunkedGroups.size());
+        return std::move(chunkedGroups[groupIdx]);
+    }
 
     // Return num of rows before append.
     void append(MemoryManager& memoryManager, const std::vector<common::ValueVector*>& vectors,
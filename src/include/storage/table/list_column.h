@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstddef>
+#include <utility>
+#include <vector>
 
 #include "column.h"
 #include "common/types/types.h"
@@ -86,6 +88,12 @@ private:
     void scanFiltered(const SegmentState& state, common::offset_t startOffsetInChunk,
         common::ValueVector* offsetVector, const ListOffsetSizeInfo& listOffsetInfoInStorage,
         common::offset_t offsetInResult) const;
+    // Scans the data of lists, given as (start offset in storage, size), to consecutive positions
+    // of the data vector. Lists stored next to each other are read by a single scan of the data
+    // column, which saves most of the per-scan overhead for short lists.
+    void scanListData(const SegmentState& state, common::ValueVector* dataVector,
+        common::offset_t offsetInDataVector,
+        const std::vector<std::pair<common::offset_t, common::list_size_t>>& lists) const;
 
     common::offset_t readOffset(const SegmentState& state,
         common::offset_t offsetInNodeGroup) const;
@@ -26,6 +26,9 @@ struct NodeGroupScanState {
     common::row_idx_t nextRowToScan = 0;
     // State of each chunk in the checkpointed chunked group.
     std::vector<ChunkState> chunkStates;
+    // Chunked group whose zone maps were checked last, and whether they rule out the scan.
+    const ChunkedNodeGroup* zoneMapCheckedGroup = nullptr;
+    bool zoneMapSkipsScan = false;
 
     explicit NodeGroupScanState() {}
     explicit NodeGroupScanState(common::idx_t numChunks) { chunkStates.resize(numChunks); }
@@ -48,6 +51,9 @@ struct NodeGroupCheckpointState {
     std::vector<Column*> columns;
     PageAllocator& pageAllocator;
     MemoryManager* mm;
+    // Number of threads node groups are checkpointed with. States holding per node group data,
+    // e.g. the CSR headers of rel groups, must keep a single thread.
+    uint64_t maxNumThreads = 1;
 
     NodeGroupCheckpointState(std::vector<common::column_id_t> columnIDs,
         std::vector<Column*> columns, PageAllocator& pageAllocator, MemoryManager* mm)
@@ -116,6 +122,8 @@ public:
     }
     common::row_idx_t getNumRowsLeftToAppend() const { return capacity - nextRowToAppend; }
     bool isFull() const { return numRows.load() == capacity; }
+    // Whether the node group is full and none of its data has been flushed to pages yet.
+    bool isFullAndInMemoryOnly() const;
     const std::vector<common::LogicalType>& getDataTypes() const { return dataTypes; }
     NodeGroupDataFormat getFormat() const { return format; }
     common::row_idx_t append(const transaction::Transaction* transaction,
@@ -161,6 +169,11 @@ public:
 
     void update(const transaction::Transaction* transaction, common::row_idx_t rowIdxInGroup,
         common::column_id_t columnID, const common::ValueVector& propertyVector);
+    // Updates the rows at rowIdxesInGroup, which must be distinct and increasing, with the values
+    // of propertyVector at valuePositions.
+    void update(const transaction::Transaction* transaction,
+        std::span<const common::row_idx_t> rowIdxesInGroup, common::column_id_t columnID,
+        const common::ValueVector& propertyVector, std::span<const common::sel_t> valuePositions);
     bool delete_(const transaction::Transaction* transaction, common::row_idx_t rowIdxInGroup);
 
     bool hasDeletions(const transaction::Transaction* transaction) const;
@@ -172,6 +185,12 @@ public:
     void rollbackInsert(common::row_idx_t startRow);
     void reclaimStorage(PageAllocator& pageAllocator) const;
     virtual void reclaimStorage(PageAllocator& pageAllocator, const common::UniqLock& lock) const;
+    void vacuumUpdates(common::transaction_t oldestActiveTS) const;
+    virtual void vacuumUpdates(common::transaction_t oldestActiveTS,
+        const common::UniqLock& lock) const;
+    // Hints that the given columns of the on-disk chunked groups will be scanned soon.
+    void prefetchPagesAsync(FileHandle& dataFH,
+        const std::vector<common::column_id_t>& columnIDs) const;
 
     virtual void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
 
@@ -77,7 +77,12 @@ public:
     uint64_t getEstimatedMemoryUsage() const;
 
     void checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    // Checkpoints only the full node groups whose data is still in uncompressed in-memory chunks.
+    // In-memory databases never checkpoint, so this is how their node groups get compressed.
+    void compactFullGroups(MemoryManager& memoryManager, NodeGroupCheckpointState& state);
+    bool hasCompactableGroups() const;
     void reclaimStorage(PageAllocator& pageAllocator) const;
+    void vacuumUpdates(common::transaction_t oldestActiveTS) const;
 
     TableStats getStats() const {
         auto lock = nodeGroups.lock();
@@ -96,6 +101,10 @@ public:
         auto lock = nodeGroups.lock();
         this->stats.merge(columnIDs, stats);
     }
+    void replaceStats(const std::vector<common::column_id_t>& columnIDs, TableStats stats) {
+        auto lock = nodeGroups.lock();
+        this->stats.replace(columnIDs, std::move(stats));
+    }
 
     void serialize(common::Serializer& ser);
     void deserialize(common::Deserializer& deSer, MemoryManager& memoryManager);
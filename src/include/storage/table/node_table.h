@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "common/types/types.h"
 #include "storage/index/hash_index.h"
 #include "storage/table/node_group_collection.h"
@@ -67,6 +69,10 @@ struct RYU_API NodeTableUpdateState : TableUpdateState {
     bool needToUpdateIndex(common::idx_t idx) const {
         return idx < indexUpdateState.size() && indexUpdateState[idx] != nullptr;
     }
+    bool needToUpdateAnyIndex() const {
+        return std::any_of(indexUpdateState.begin(), indexUpdateState.end(),
+            [](const auto& state) { return state != nullptr; });
+    }
 };
 
 struct RYU_API NodeTableDeleteState : TableDeleteState {
@@ -134,6 +140,12 @@ public:
     void insert(transaction::Transaction* transaction, TableInsertState& insertState) override;
     void initUpdateState(main::ClientContext* context, TableUpdateState& updateState) const;
     void update(transaction::Transaction* transaction, TableUpdateState& updateState) override;
+    // Updates one column of several nodes with the values of propertyVector at valuePositions.
+    // Node offsets must be distinct and increasing. Indexes are not updated, so the column must
+    // not need any index updates.
+    void update(transaction::Transaction* transaction, common::column_id_t columnID,
+        std::span<const common::offset_t> nodeOffsets, const common::ValueVector& propertyVector,
+        std::span<const common::sel_t> valuePositions);
     bool delete_(transaction::Transaction* transaction, TableDeleteState& deleteState) override;
 
     void addColumn(transaction::Transaction* transaction, TableAddColumnState& addColumnState,
@@ -144,6 +156,18 @@ public:
 
     bool lookupPK(const transaction::Transaction* transaction, common::ValueVector* keyVector,
         uint64_t vectorPos, common::offset_t& result) const;
+    // Batched version of lookupPK for non-null keys. The offset of each key is written to the same
+    // position in results, or INVALID_OFFSET if the key is not found.
+    void lookupPKs(const transaction::Transaction* transaction, common::ValueVector* keyVector,
+        std::span<const common::sel_t> positions, std::span<common::offset_t> results) const;
+
+    // Scans the index columns of the committed rows visible to transaction, starting from the
+    // given node group.
+    void scanCommittedIndexColumns(main::ClientContext* context,
+        const transaction::Transaction* transaction, IndexScanHelper& scanHelper,
+        common::node_group_idx_t startNodeGroupIdx) const {
+        scanIndexColumns(context, transaction, scanHelper, *nodeGroups, startNodeGroupIdx);
+    }
 
     void addIndex(std::unique_ptr<Index> index);
     void dropIndex(const std::string& name);
@@ -176,8 +200,18 @@ public:
         LocalTable* localTable) override;
     bool checkpoint(main::ClientContext* context, catalog::TableCatalogEntry* tableEntry,
         PageAllocator& pageAllocator) override;
-    void rollbackCheckpoint() override;
+    void rollbackCheckpoint(ChunkRelocationRollback& relocationRollback) override;
+    // Compresses the full node groups of in-memory databases into pages of the data file.
+    void compactFullNodeGroups(main::ClientContext* context, PageAllocator& pageAllocator);
+    bool hasCompactableNodeGroups() const { return nodeGroups->hasCompactableGroups(); }
     void reclaimStorage(PageAllocator& pageAllocator) const override;
+    // Unlike reclaimStorage(), skips the pages of the primary key index.
+    void reclaimColumnStorage(PageAllocator& pageAllocator) const {
+        nodeGroups->reclaimStorage(pageAllocator);
+    }
+    void vacuumUpdates(common::transaction_t oldestActiveTS) const override {
+        nodeGroups->vacuumUpdates(oldestActiveTS);
+    }
 
     void rollbackPKIndexInsert(main::ClientContext* context, common::row_idx_t startRow,
         common::row_idx_t numRows_, common::node_group_idx_t nodeGroupIdx_);
@@ -197,16 +231,37 @@ public:
     NodeGroup* getNodeGroupNoLock(common::node_group_idx_t nodeGroupIdx) const {
         return nodeGroups->getNodeGroupNoLock(nodeGroupIdx);
     }
+    // Starts reading the scanned columns of a committed node group from disk in the background,
+    // so that they are likely to be cached by the time the node group is scanned.
+    void prefetchNodeGroupAsync(const TableScanState& scanState,
+        common::node_group_idx_t nodeGroupIdx) const;
 
     TableStats getStats(const transaction::Transaction* transaction) const;
     // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
     void mergeStats(const std::vector<common::column_id_t>& columnIDs, const TableStats& stats) {
         nodeGroups->mergeStats(columnIDs, stats);
     }
+    // Replaces the stats of the given columns with ones recomputed by ANALYZE.
+    // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+    void replaceStats(const std::vector<common::column_id_t>& columnIDs, TableStats stats) {
+        nodeGroups->replaceStats(columnIDs, std::move(stats));
+        numChangesSinceAnalyze = 0;
+        setHasChanges();
+    }
+    // Updates and deletions are not reflected in the stats, which only grow with insertions. The
+    // stats are considered stale once the rows updated or deleted since the last ANALYZE make up a
+    // large enough fraction of the table.
+    bool needsAnalyze() const;
 
     void serialize(common::Serializer& serializer) const override;
     void deserialize(main::ClientContext* context, StorageManager* storageManager,
         common::Deserializer& deSer) override;
+    void serializeNodeGroups(common::Serializer& serializer) const override {
+        nodeGroups->serialize(serializer);
+    }
+    void deserializeNodeGroups(common::Deserializer& deSer) override {
+        nodeGroups->deserialize(deSer, *memoryManager);
+    }
 
 private:
     void validatePkNotExists(const transaction::Transaction* transaction,
@@ -215,15 +270,19 @@ private:
     visible_func getVisibleFunc(const transaction::Transaction* transaction) const;
     common::DataChunk constructDataChunkForColumns(
         const std::vector<common::column_id_t>& columnIDs) const;
-    void scanIndexColumns(main::ClientContext* context, IndexScanHelper& scanHelper,
-        const NodeGroupCollection& nodeGroups_) const;
+    void scanIndexColumns(main::ClientContext* context,
+        const transaction::Transaction* transaction, IndexScanHelper& scanHelper,
+        const NodeGroupCollection& nodeGroups_,
+        common::node_group_idx_t startNodeGroupIdx = 0) const;
 
 private:
     std::vector<std::unique_ptr<Column>> columns;
     std::unique_ptr<NodeGroupCollection> nodeGroups;
     common::column_id_t pkColumnID;
+    FileHandle* dataFH;
     std::vector<IndexHolder> indexes;
     NodeTableVersionRecordHandler versionRecordHandler;
+    std::atomic<common::row_idx_t> numChangesSinceAnalyze{0};
 };
 
 } // namespace storage
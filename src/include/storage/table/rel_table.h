@@ -15,6 +15,7 @@ namespace storage {
 class MemoryManager;
 
 struct LocalRelTableScanState;
+class ColumnConstantPredicate;
 struct RelTableScanState : TableScanState {
     common::RelDataDirection direction;
     common::sel_t currBoundNodeIdx;
@@ -27,6 +28,11 @@ struct RelTableScanState : TableScanState {
 
     std::unique_ptr<LocalRelTableScanState> localTableScanState;
 
+    // Predicates on the sort key of a rel group with a sort property. Persistent CSR lists are
+    // sorted by the key, so the scan of a list is narrowed down to the rows that may satisfy them.
+    common::idx_t sortKeyColumnIdx = common::INVALID_IDX;
+    std::vector<const ColumnConstantPredicate*> sortKeyPredicates;
+
     RelTableScanState(MemoryManager& mm, common::ValueVector* nodeIDVector,
         std::vector<common::ValueVector*> outputVectors,
         std::shared_ptr<common::DataChunkState> outChunkState, bool randomLookup = false)
@@ -52,6 +58,8 @@ struct RelTableScanState : TableScanState {
         std::vector<common::column_id_t> columnIDs_,
         std::vector<ColumnPredicateSet> columnPredicateSets_,
         common::RelDataDirection direction_) override;
+    // Must be called after setToTable.
+    void initSortKeyPredicates(common::column_id_t sortColumnID);
 
     void initState(transaction::Transaction* transaction, NodeGroup* nodeGroup,
         bool resetCachedBoundNodeIDs = true) override;
@@ -199,8 +207,9 @@ public:
         LocalTable* localTable) override;
     bool checkpoint(main::ClientContext*, catalog::TableCatalogEntry* tableEntry,
         PageAllocator& pageAllocator) override;
-    void rollbackCheckpoint() override {};
+    void rollbackCheckpoint(ChunkRelocationRollback& relocationRollback) override;
     void reclaimStorage(PageAllocator& pageAllocator) const override;
+    void vacuumUpdates(common::transaction_t oldestActiveTS) const override;
 
     common::row_idx_t getNumTotalRows(const transaction::Transaction* transaction) override;
 
@@ -223,6 +232,8 @@ public:
     void serialize(common::Serializer& ser) const override;
     void deserialize(main::ClientContext* context, StorageManager* storageManager,
         common::Deserializer& deSer) override;
+    void serializeNodeGroups(common::Serializer& ser) const override;
+    void deserializeNodeGroups(common::Deserializer& deSer) override;
 
 private:
     static void prepareCommitForNodeGroup(const transaction::Transaction* transaction,
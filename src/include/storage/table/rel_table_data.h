@@ -64,6 +64,10 @@ public:
         const common::ValueVector& dataVector) const;
     bool delete_(transaction::Transaction* transaction, common::ValueVector& boundNodeIDVector,
         const common::ValueVector& relIDVector);
+    // Deletes rows, which were scanned from the given source, of the CSR lists of a node group.
+    // Runs of consecutive rows are recorded as a single delete in the undo buffer.
+    void deleteRows(transaction::Transaction* transaction, common::node_group_idx_t nodeGroupIdx,
+        CSRNodeGroupScanSource source, const std::vector<common::row_idx_t>& rowIndices);
     void addColumn(TableAddColumnState& addColumnState, PageAllocator& pageAllocator);
 
     bool checkIfNodeHasRels(transaction::Transaction* transaction,
@@ -95,10 +99,15 @@ public:
     common::RelMultiplicity getMultiplicity() const { return multiplicity; }
 
     TableStats getStats() const { return nodeGroups->getStats(); }
+    // Degrees of the bound nodes in checkpointed data.
+    DegreeStats getDegreeStats() const;
 
     void reclaimStorage(PageAllocator& pageAllocator) const;
+    void vacuumUpdates(common::transaction_t oldestActiveTS) const {
+        nodeGroups->vacuumUpdates(oldestActiveTS);
+    }
     void checkpoint(const std::vector<common::column_id_t>& columnIDs,
-        PageAllocator& pageAllocator);
+        common::column_id_t sortColumnID, PageAllocator& pageAllocator);
 
     void pushInsertInfo(const transaction::Transaction* transaction, const CSRNodeGroup& nodeGroup,
         common::row_idx_t numRows_, CSRNodeGroupScanSource source);
@@ -150,7 +159,6 @@ private:
     MemoryManager* mm;
     ShadowFile* shadowFile;
     bool enableCompression;
-    PackedCSRInfo packedCSRInfo;
     common::RelDataDirection direction;
     common::RelMultiplicity multiplicity;
 
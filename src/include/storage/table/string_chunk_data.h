@@ -59,11 +59,13 @@ public:
 
     void finalize() override;
 
+    ColumnChunkMetadata getMetadataToFlush() const override;
     void flush(PageAllocator& pageAllocator) override;
     uint64_t getSizeOnDisk() const override;
     uint64_t getMinimumSizeOnDisk() const override;
     uint64_t getSizeOnDiskInMemoryStats() const override;
     void reclaimStorage(PageAllocator& pageAllocator) override;
+    void prefetchPagesAsync(FileHandle& dataFH) const override;
 
     void resetNumValuesFromMetadata() override;
     void syncNumValues() override {
@@ -38,6 +38,9 @@ struct RYU_API TableScanState {
 
     std::vector<ColumnPredicateSet> columnPredicateSets;
 
+    // Set by sequential scans, whose pages are unlikely to be read again soon.
+    PageAccessPattern pageAccessPattern = PageAccessPattern::NORMAL;
+
     TableScanState(common::ValueVector* nodeIDVector,
         std::vector<common::ValueVector*> outputVectors,
         std::shared_ptr<common::DataChunkState> outChunkState)
@@ -149,6 +152,7 @@ struct TableAddColumnState final {
 
 class LocalTable;
 class StorageManager;
+class ChunkRelocationRollback;
 class RYU_API Table {
 public:
     Table(const catalog::TableCatalogEntry* tableEntry, const StorageManager* storageManager,
@@ -177,13 +181,23 @@ public:
         LocalTable* localTable) = 0;
     virtual bool checkpoint(main::ClientContext* context, catalog::TableCatalogEntry* tableEntry,
         PageAllocator& pageAllocator) = 0;
-    virtual void rollbackCheckpoint() = 0;
+    // Also moves the chunks that the checkpoint relocated back to their old pages.
+    virtual void rollbackCheckpoint(ChunkRelocationRollback& relocationRollback) = 0;
     virtual void reclaimStorage(PageAllocator& pageAllocator) const = 0;
+    // Prunes committed versions of updated values that no transaction starting at or after
+    // oldestActiveTS needs anymore.
+    virtual void vacuumUpdates(common::transaction_t oldestActiveTS) const = 0;
 
     virtual common::row_idx_t getNumTotalRows(const transaction::Transaction* transaction) = 0;
 
     void setHasChanges() { hasChanges = true; }
 
+    // Incremented by each write to the rows of the table, including uncommitted ones, so that data
+    // derived from the table can tell whether it may be outdated. The table is also recorded as
+    // written by the transaction, see TransactionManager::hasCommitsSince().
+    uint64_t getWriteVersion() const { return writeVersion.load(); }
+    void increaseWriteVersion(transaction::Transaction* transaction);
+
     template<class TARGET>
     TARGET& cast() {
         return common::ku_dynamic_cast<TARGET&>(*this);
@@ -203,6 +217,10 @@ public:
     virtual void serialize(common::Serializer& serializer) const = 0;
     virtual void deserialize(main::ClientContext* context, StorageManager* storageManager,
         common::Deserializer& deSer) = 0;
+    // The node group metadata of a table can be large, so it is serialized separately from the
+    // rest of the table and only deserialized when the table is first accessed.
+    virtual void serializeNodeGroups(common::Serializer& serializer) const = 0;
+    virtual void deserializeNodeGroups(common::Deserializer& deSer) = 0;
 
 protected:
     virtual bool scanInternal(transaction::Transaction* transaction, TableScanState& scanState) = 0;
@@ -215,6 +233,7 @@ protected:
     MemoryManager* memoryManager;
     ShadowFile* shadowFile;
     std::atomic<bool> hasChanges;
+    std::atomic<uint64_t> writeVersion{0};
 };
 
 } // namespace storage
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <shared_mutex>
+#include <span>
 
 #include "column_chunk_data.h"
 #include "common/types/types.h"
@@ -23,6 +25,8 @@ struct VectorUpdateInfo {
     common::transaction_t version;
     std::array<common::sel_t, common::DEFAULT_VECTOR_CAPACITY> rowsInVector;
     common::sel_t numRowsUpdated;
+    // Largest row in rowsInVector, only meaningful if numRowsUpdated > 0.
+    common::sel_t maxRowUpdated;
     // Older versions.
     std::unique_ptr<VectorUpdateInfo> prev;
     // Newer versions.
@@ -31,15 +35,21 @@ struct VectorUpdateInfo {
     std::unique_ptr<ColumnChunkData> data;
 
     VectorUpdateInfo()
-        : version{common::INVALID_TRANSACTION}, rowsInVector{}, numRowsUpdated(0), prev(nullptr),
-          next{nullptr}, data{nullptr} {}
+        : version{common::INVALID_TRANSACTION}, rowsInVector{}, numRowsUpdated(0),
+          maxRowUpdated{0}, prev(nullptr), next{nullptr}, data{nullptr} {}
     VectorUpdateInfo(MemoryManager& memoryManager, const common::transaction_t transactionID,
         common::LogicalType dataType)
-        : version{transactionID}, rowsInVector{}, numRowsUpdated{0}, prev{nullptr}, next{nullptr} {
+        : version{transactionID}, rowsInVector{}, numRowsUpdated{0}, maxRowUpdated{0},
+          prev{nullptr}, next{nullptr} {
         data = ColumnChunkFactory::createColumnChunkData(memoryManager, std::move(dataType), false,
             common::DEFAULT_VECTOR_CAPACITY, ResidencyState::IN_MEMORY);
     }
 
+    void appendRow(common::sel_t row) {
+        rowsInVector[numRowsUpdated++] = row;
+        maxRowUpdated = std::max(maxRowUpdated, row);
+    }
+
     std::unique_ptr<VectorUpdateInfo> movePrev() { return std::move(prev); }
     void setPrev(std::unique_ptr<VectorUpdateInfo> prev_) { this->prev = std::move(prev_); }
     VectorUpdateInfo* getPrev() const { return prev.get(); }
@@ -72,9 +82,17 @@ public:
 
     UpdateInfo() {}
 
-    VectorUpdateInfo& update(MemoryManager& memoryManager,
+    // Returns the version of the vector updated by the transaction, and whether it was created by
+    // this update. Only a new version has to be recorded in the undo buffer of the transaction.
+    std::pair<VectorUpdateInfo*, bool> update(MemoryManager& memoryManager,
         const transaction::Transaction* transaction, common::idx_t vectorIdx,
         common::sel_t rowIdxInVector, const common::ValueVector& values);
+    // Updates several rows of the same vector with the values at valuePositions, under a single
+    // lock of the vector's version chain. Rows must be distinct and in increasing order.
+    std::pair<VectorUpdateInfo*, bool> update(MemoryManager& memoryManager,
+        const transaction::Transaction* transaction, common::idx_t vectorIdx,
+        std::span<const common::sel_t> rowsInVector, const common::ValueVector& values,
+        std::span<const common::sel_t> valuePositions);
 
     void clearVectorInfo(common::idx_t vectorIdx) {
         std::unique_lock lock{mtx};
@@ -100,11 +118,19 @@ public:
 
     void commit(common::idx_t vectorIdx, VectorUpdateInfo* info, common::transaction_t commitTS);
     void rollback(common::idx_t vectorIdx, common::transaction_t version);
+    // Merges the committed versions of each vector that are visible to every transaction starting
+    // at or after oldestActiveTS into the newest of them, so that scans don't have to walk the
+    // whole version chain until the next checkpoint.
+    void vacuum(common::transaction_t oldestActiveTS);
 
     common::row_idx_t getNumUpdatedRows(const transaction::Transaction* transaction) const;
 
     bool hasUpdates(const transaction::Transaction* transaction, common::row_idx_t startRow,
         common::length_t numRows) const;
+    // Whether the row has been updated by a transaction which is uncommitted or committed after
+    // the given transaction started. Modifying the row would then be a write-write conflict.
+    bool isUpdatedByOtherTransaction(const transaction::Transaction* transaction,
+        common::row_idx_t rowInChunk) const;
 
     bool isSet() const {
         std::shared_lock lock{mtx};
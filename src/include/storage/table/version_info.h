@@ -36,6 +36,10 @@ public:
         common::row_idx_t startRow, common::length_t numRows) const;
     bool hasInsertions() const;
     bool isDeleted(const transaction::Transaction* transaction, common::row_idx_t rowInChunk) const;
+    // Whether the row has been deleted by another transaction, committed or not. Updating the row
+    // would then be a write-write conflict.
+    bool isDeletedByOtherTransaction(const transaction::Transaction* transaction,
+        common::row_idx_t rowInChunk) const;
     bool isInserted(const transaction::Transaction* transaction,
         common::row_idx_t rowInChunk) const;
 
@@ -3,16 +3,17 @@
 #include <memory>
 #include <optional>
 
+#include "common/checksum.h"
+#include "common/file_system/file_info.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/reader.h"
-#include "storage/buffer_manager/memory_manager.h"
 
 namespace ryu {
 namespace storage {
+// Verifies the checksum of each entry while it is read, without buffering its contents
 class ChecksumReader : public common::Reader {
 public:
-    explicit ChecksumReader(common::FileInfo& fileInfo, MemoryManager& memoryManager,
-        std::string_view checksumMismatchMessage);
+    explicit ChecksumReader(common::FileInfo& fileInfo, std::string_view checksumMismatchMessage);
 
     void read(uint8_t* data, uint64_t size) override;
     bool finished() override;
@@ -24,12 +25,13 @@ public:
     void onObjectEnd() override;
 
     uint64_t getReadOffset() const;
+    // Note: this function resets the next file offset to read.
+    void resetReadOffset(uint64_t fileOffset);
 
 private:
     common::Deserializer deserializer;
 
-    std::optional<uint64_t> currentEntrySize;
-    std::unique_ptr<MemoryBuffer> entryBuffer;
+    std::optional<common::IncrementalChecksum> currentEntryChecksum;
 
     std::string_view checksumMismatchMessage;
 };
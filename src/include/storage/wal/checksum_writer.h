@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 
+#include "common/checksum.h"
 #include "common/serializer/serializer.h"
 #include "common/serializer/writer.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -34,6 +35,8 @@ private:
     common::Serializer outputSerializer;
     std::optional<uint64_t> currentEntrySize;
     std::unique_ptr<MemoryBuffer> entryBuffer;
+    // Computed while the entry is buffered, so it is not read a second time.
+    common::IncrementalChecksum currentEntryChecksum;
 };
 
 } // namespace storage
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <condition_variable>
+
 #include "storage/wal/wal_record.h"
 
 namespace ryu {
@@ -16,7 +18,17 @@ public:
         common::VirtualFileSystem* vfs);
     ~WAL();
 
+    // Appends the local WAL of a committing transaction. Unless group commit is enabled, the WAL
+    // is also synced before returning; otherwise the commit becomes durable once
+    // waitForCommitDurable() returns for its commit number.
     void logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context);
+    // Returns the commit number of the last commit appended to the WAL.
+    uint64_t getLastCommitNumber();
+    // Blocks until all commits up to and including commitNumber are synced to disk. One of the
+    // waiting committers becomes the leader, which optionally waits for the configured group
+    // commit delay so that more commits can join the batch, and then syncs the WAL on behalf of
+    // all of them.
+    void waitForCommitDurable(uint64_t commitNumber, main::ClientContext* context);
     void logAndFlushCheckpoint(main::ClientContext* context);
 
     // Clear any buffer in the WAL writer. Also truncate the WAL file to 0 bytes.
@@ -25,6 +37,9 @@ public:
     void reset();
 
     uint64_t getFileSize();
+    // Copies the WAL file with all commits appended so far to the given path. Commits are blocked
+    // until the copy is done.
+    void copyTo(const std::string& path);
 
     static WAL* Get(const main::ClientContext& context);
 
@@ -32,6 +47,7 @@ private:
     void initWriter(main::ClientContext* context);
     void addNewWALRecordNoLock(const WALRecord& walRecord);
     void flushAndSyncNoLock();
+    void waitForSyncToFinishNoLock(std::unique_lock<std::mutex>& lck);
     void writeHeader(main::ClientContext& context);
 
 private:
@@ -47,6 +63,13 @@ private:
     // writing COMMIT/CHECKPOINT records
     std::unique_ptr<common::Serializer> serializer;
     bool enableChecksums;
+
+    // Commits are numbered in the order they are appended to the WAL. All commits up to
+    // numSyncedCommits are durable. Only one thread syncs the WAL for group commit at a time.
+    std::condition_variable syncCV;
+    uint64_t numAppendedCommits = 0;
+    uint64_t numSyncedCommits = 0;
+    bool syncInProgress = false;
 };
 
 } // namespace storage
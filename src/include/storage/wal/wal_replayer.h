@@ -13,6 +13,10 @@ public:
     explicit WALReplayer(main::ClientContext& clientContext);
 
     void replay(bool throwOnWalReplayFailure, bool enableChecksums) const;
+    // Applies the transactions committed to the WAL after startOffset without modifying any file,
+    // which is how read replicas follow the WAL of the writing process. Returns the offset after
+    // the last applied COMMIT record.
+    uint64_t tail(uint64_t startOffset, bool enableChecksums) const;
 
 private:
     struct WALReplayInfo {
@@ -40,8 +44,12 @@ private:
 
     // This function is used to deserialize the WAL records without actually applying them to the
     // storage.
-    WALReplayInfo dryReplay(common::FileInfo& fileInfo, bool throwOnWalReplayFailure,
-        bool enableChecksums) const;
+    WALReplayInfo dryReplay(common::FileInfo& fileInfo, uint64_t startOffset,
+        bool throwOnWalReplayFailure, bool enableChecksums) const;
+    // Replays the records in [startOffset, endOffset), which must end with a COMMIT record.
+    void replayCommittedRecords(common::FileInfo& fileInfo, uint64_t startOffset,
+        uint64_t endOffset, bool enableChecksums) const;
+    void rollbackActiveTransaction() const;
 
     void removeWALAndShadowFiles() const;
     void removeFileIfExists(const std::string& path) const;
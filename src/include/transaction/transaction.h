@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <unordered_map>
 
 #include "common/types/types.h"
 
@@ -114,6 +115,14 @@ public:
     }
 
     bool shouldForceCheckpoint() const;
+    bool changesCatalog() const { return hasCatalogChanges; }
+
+    void addWrittenTable(common::table_id_t tableID) {
+        std::unique_lock lck{writtenTablesMtx};
+        writtenTables.insert(tableID);
+    }
+    // Tables whose rows the transaction has inserted, updated or deleted.
+    const common::table_id_set_t& getWrittenTables() const { return writtenTables; }
 
     void commit(storage::WAL* wal);
     void rollback(storage::WAL* wal);
@@ -147,6 +156,8 @@ public:
 
 private:
     common::offset_t getMinUncommittedNodeOffset(common::table_id_t tableID) const;
+    // Logs the values taken from sequences since the last call to the WAL.
+    void logSequenceChanges();
 
 private:
     TransactionType type;
@@ -161,6 +172,11 @@ private:
     LocalCacheManager localCacheManager;
     bool forceCheckpoint;
     std::atomic<bool> hasCatalogChanges;
+    std::mutex writtenTablesMtx;
+    common::table_id_set_t writtenTables;
+    std::mutex sequenceChangesMtx;
+    // Number of values taken from each sequence which are not logged to the WAL yet.
+    std::unordered_map<catalog::SequenceCatalogEntry*, uint64_t> sequenceChanges;
 };
 
 // TODO(bmwinger): These shouldn't need to be exported
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 #include "common/constants.h"
 #include "common/uniq_lock.h"
+#include "storage/checkpoint_lock.h"
 #include "storage/checkpointer.h"
 #include "storage/wal/wal.h"
 #include "transaction/transaction.h"
@@ -14,6 +18,10 @@ namespace main {
 class ClientContext;
 } // namespace main
 
+namespace storage {
+class StorageManager;
+} // namespace storage
+
 namespace testing {
 class DBTest;
 class FlakyBufferManager;
@@ -38,6 +46,7 @@ public:
         : wal{wal}, lastTransactionID{Transaction::START_TRANSACTION_ID}, lastTimestamp{1} {
         initCheckpointerFunc = initCheckpointer;
     }
+    ~TransactionManager();
 
     Transaction* beginTransaction(main::ClientContext& clientContext, TransactionType type);
 
@@ -46,16 +55,47 @@ public:
 
     void checkpoint(main::ClientContext& clientContext);
 
+    // Starts a background thread that periodically vacuums updates.
+    void startUpdateVacuumer(storage::StorageManager& storageManager);
+    // Prunes update versions that are not visible to any active or future transaction anymore.
+    void vacuumUpdates(storage::StorageManager& storageManager);
+    // Runs the function while no checkpoint or vacuum replaces the pages of the data file, e.g. to
+    // read pages into the buffer pool outside of a transaction.
+    void runWithoutCheckpoint(const std::function<void()>& func);
+
     static TransactionManager* Get(const main::ClientContext& context);
 
+    // Doesn't take a lock, so it can be read while a checkpoint waits for transactions to leave.
+    uint64_t getNumActiveTransactions() const {
+        return numActiveTransactions.load(std::memory_order_relaxed);
+    }
+
+    // Timestamp of the last commit. Transactions started afterwards see all committed changes.
+    // Doesn't take a lock, so that it is cheap to call per query, e.g. by the query result cache.
+    common::transaction_t getLastTimestamp() const {
+        return lastTimestamp.load(std::memory_order_acquire);
+    }
+    // Returns true if a transaction which committed after the given timestamp wrote to one of the
+    // tables or changed the catalog.
+    bool hasCommitsSince(common::transaction_t timestamp,
+        const std::vector<common::table_id_t>& tableIDs);
+
 private:
+    // Read replicas apply the changes of the writing process before a transaction starts while no
+    // other transaction of this process is active, and keep them from being checkpointed until the
+    // last transaction ends.
+    Transaction* beginReplicaTransaction(main::ClientContext& clientContext);
+
     bool hasNoActiveTransactions() const;
+    Transaction* addActiveTransactionNoLock(std::unique_ptr<Transaction> transaction);
     void checkpointNoLock(main::ClientContext& clientContext);
 
     // This functions locks the mutex to start new transactions.
     common::UniqLock stopNewTransactionsAndWaitUntilAllTransactionsLeave();
 
     bool hasActiveWriteTransactionNoLock() const;
+    bool shouldDeferAutoCheckpointNoLock(const main::ClientContext& clientContext,
+        const Transaction& transaction) const;
 
     // Note: Used by DBTest::createDB only.
     void setCheckPointWaitTimeoutForTransactionsToLeaveInMicros(uint64_t waitTimeInMicros) {
@@ -63,20 +103,39 @@ private:
     }
 
     void clearTransactionNoLock(common::transaction_t transactionID);
+    common::transaction_t getOldestActiveStartTSNoLock() const;
 
 private:
     storage::WAL& wal;
     std::vector<std::unique_ptr<Transaction>> activeTransactions;
+    std::atomic<uint64_t> numActiveTransactions{0};
     common::transaction_t lastTransactionID;
-    common::transaction_t lastTimestamp;
+    // Only modified while holding mtxForSerializingPublicFunctionCalls.
+    std::atomic<common::transaction_t> lastTimestamp;
+    // Commit timestamps of the last transactions which wrote to each table, or changed the
+    // catalog. Only tracked in memory, since they are compared with timestamps of this process.
+    common::table_id_map_t<common::transaction_t> tableCommitTimestamps;
+    common::transaction_t catalogCommitTimestamp = 0;
     // This mutex is used to ensure thread safety and letting only one public function to be called
     // at any time except the stopNewTransactionsAndWaitUntilAllReadTransactionsLeave
     // function, which needs to let calls to coming and rollback.
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
     uint64_t checkpointWaitTimeoutInMicros = common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS;
+    // Checkpointing replaces the chunks whose updates are vacuumed, so it excludes vacuuming.
+    // It is always locked after mtxForSerializingPublicFunctionCalls, or on its own by
+    // runWithoutCheckpoint().
+    std::mutex mtxForVacuum;
+    std::thread vacuumThread;
+    std::mutex vacuumThreadMtx;
+    std::condition_variable vacuumThreadCV;
+    bool stopVacuumThread = false;
 
     init_checkpointer_func_t initCheckpointerFunc;
+    // Read replicas only. Held while any transaction is active. Refreshes are serialized by
+    // mtxForReplica, which is always locked before mtxForSerializingPublicFunctionCalls.
+    std::unique_ptr<storage::CheckpointLock> replicaCheckpointLock;
+    std::mutex mtxForReplica;
 };
 } // namespace transaction
 } // namespace ryu
@@ -1,31 +1,44 @@
 #include "main/client_context.h"
 
 #include "binder/binder.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "common/exception/checkpoint.h"
 #include "common/exception/connection.h"
+#include "common/exception/reoptimize.h"
 #include "common/exception/runtime.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/memory_tracker.h"
 #include "common/random_engine.h"
 #include "common/string_utils.h"
 #include "common/task_system/progress_bar.h"
+#include "common/task_system/query_tracer.h"
 #include "extension/extension.h"
 #include "extension/extension_manager.h"
+#include "function/table/standalone_call_function.h"
 #include "graph/graph_entry_set.h"
 #include "main/attached_database.h"
 #include "main/database.h"
 #include "main/database_manager.h"
 #include "main/db_config.h"
+#include "main/materialized_views.h"
+#include "main/parsed_statement_cache.h"
+#include "main/query_result/materialized_query_result.h"
+#include "main/query_result_cache.h"
+#include "main/slow_query_log.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
 #include "parser/visitor/standalone_call_rewriter.h"
 #include "parser/visitor/statement_read_write_analyzer.h"
+#include "planner/join_order/cardinality_feedback.h"
 #include "planner/planner.h"
 #include "processor/plan_mapper.h"
 #include "processor/processor.h"
+#include "processor/result/result_stream.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/spiller.h"
 #include "storage/storage_manager.h"
 #include "transaction/transaction_context.h"
+#include "transaction/transaction_manager.h"
 #include <processor/warning_context.h>
 
 #if defined(_WIN32)
@@ -284,6 +297,7 @@ std::unique_ptr<PreparedStatement> ClientContext::prepareWithParams(std::string_
     }
     auto [preparedStatement, cachedStatement] = prepareNoLock(parsedStatements[0],
         true /*shouldCommitNewTransaction*/, std::move(inputParamsTmp));
+    cachedStatement->query = std::string(query);
     preparedStatement->cachedPreparedStatementName =
         cachedPreparedStatementManager.addStatement(std::move(cachedStatement));
     useInternalCatalogEntry_ = false;
@@ -311,6 +325,74 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     std::optional<uint64_t> queryID) { // NOLINT(performance-unnecessary-value-param): It doesn't
     // make sense to pass the map as a const reference.
     lock_t lck{mtx};
+    return executeWithParamsNoLock(preparedStatement, inputParams, queryID);
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeBatch(PreparedStatement* preparedStatement,
+    std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>> batch) {
+    lock_t lck{mtx};
+    if (!preparedStatement->isSuccess()) {
+        return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
+    }
+    if (batch.empty()) {
+        return QueryResult::getQueryResultWithError("Cannot execute an empty batch.");
+    }
+    if (preparedStatement->getStatementType() == StatementType::TRANSACTION) {
+        return QueryResult::getQueryResultWithError(
+            "Transaction statements cannot be executed in a batch.");
+    }
+    // Without an active transaction, every execution would begin and commit its own auto
+    // transaction, so the whole batch runs in one manual transaction instead.
+    const bool requireNewTransaction = !transactionContext->hasActiveTransaction();
+    if (requireNewTransaction) {
+        try {
+            if (preparedStatement->isReadOnly()) {
+                transactionContext->beginReadTransaction();
+            } else {
+                transactionContext->beginWriteTransaction();
+            }
+        } catch (std::exception& e) {
+            return QueryResult::getQueryResultWithError(e.what());
+        }
+    }
+    std::unique_ptr<QueryResult> queryResult;
+    QueryResult* lastResult = nullptr;
+    for (auto& inputParams : batch) {
+        auto currentQueryResult = executeWithParamsNoLock(preparedStatement, inputParams);
+        if (!currentQueryResult->isSuccess()) {
+            // A failed execution already rolls back the transaction, but binding errors do not.
+            if (requireNewTransaction) {
+                transactionContext->rollback();
+            }
+            return currentQueryResult;
+        }
+        if (!lastResult) {
+            queryResult = std::move(currentQueryResult);
+            lastResult = queryResult.get();
+        } else {
+            auto current = currentQueryResult.get();
+            lastResult->addNextResult(std::move(currentQueryResult));
+            lastResult = current;
+        }
+    }
+    if (requireNewTransaction) {
+        try {
+            transactionContext->commit();
+        } catch (CheckpointException& e) {
+            transactionContext->clearTransaction();
+            return QueryResult::getQueryResultWithError(e.what());
+        } catch (std::exception& e) {
+            transactionContext->rollback();
+            return QueryResult::getQueryResultWithError(e.what());
+        }
+    }
+    return queryResult;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeWithParamsNoLock(
+    PreparedStatement* preparedStatement,
+    const std::unordered_map<std::string, std::unique_ptr<Value>>& inputParams,
+    std::optional<uint64_t> queryID) {
     if (!preparedStatement->isSuccess()) {
         return QueryResult::getQueryResultWithError(preparedStatement->errMsg);
     }
@@ -328,14 +410,79 @@ std::unique_ptr<QueryResult> ClientContext::executeWithParams(PreparedStatement*
     }
     // LCOV_EXCL_STOP
     auto cachedStatement = cachedPreparedStatementManager.getCachedStatement(name);
+    std::string resultCacheKey;
+    if (canUseQueryResultCacheNoLock(QueryConfig{})) {
+        resultCacheKey =
+            QueryResultCache::getKey(cachedStatement->query, preparedStatement->parameterMap,
+                clientConfig);
+        if (auto cachedResult = getCachedQueryResultNoLock(resultCacheKey)) {
+            return cachedResult;
+        }
+    }
     // rebind
     auto [newPreparedStatement, newCachedStatement] =
         prepareNoLock(cachedStatement->parsedStatement, false /*shouldCommitNewTransaction*/,
             preparedStatement->parameterMap);
+    newCachedStatement->query = cachedStatement->query;
     useInternalCatalogEntry_ = false;
+    if (!resultCacheKey.empty()) {
+        return executeAndCacheResultNoLock(resultCacheKey, newPreparedStatement.get(),
+            newCachedStatement.get(), queryID, QueryConfig{});
+    }
     return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID);
 }
 
+bool ClientContext::canUseQueryResultCacheNoLock(const QueryConfig& config) const {
+    // Transactions may read their own uncommitted writes. Read replicas apply commits of the
+    // writing process, which are not tracked by the transaction manager. The cache is shared by
+    // all connections to the local database, so queries which may read an attached database
+    // through USE or a default database are not cached either.
+    return clientConfig.enableQueryResultCache && !transactionContext->hasActiveTransaction() &&
+           config.resultType == QueryResultType::FTABLE && config.resultStream == nullptr &&
+           !localDatabase->getConfig().enableReadReplica && remoteDatabase == nullptr &&
+           !DatabaseManager::Get(*this)->hasDefaultDatabase();
+}
+
+std::unique_ptr<QueryResult> ClientContext::getCachedQueryResultNoLock(const std::string& key) {
+    const auto entry =
+        localDatabase->getQueryResultCache()->lookup(key, *TransactionManager::Get(*this));
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    auto result = std::make_unique<MaterializedQueryResult>(entry->columnNames,
+        LogicalType::copy(entry->columnTypes), entry->table);
+    PreparedSummary preparedSummary;
+    preparedSummary.statementType = StatementType::QUERY;
+    result->setQuerySummary(std::make_unique<QuerySummary>(preparedSummary));
+    return result;
+}
+
+std::unique_ptr<QueryResult> ClientContext::executeAndCacheResultNoLock(const std::string& key,
+    PreparedStatement* preparedStatement, CachedPreparedStatement* cachedStatement,
+    std::optional<uint64_t> queryID, QueryConfig config) {
+    // Commits after this timestamp may or may not be seen by the query, so they make the result
+    // outdated.
+    const auto timestamp = TransactionManager::Get(*this)->getLastTimestamp();
+    auto result = executeNoLock(preparedStatement, cachedStatement, queryID, config);
+    if (!result->isSuccess() || !preparedStatement->isReadOnly() ||
+        result->getType() != QueryResultType::FTABLE || result->hasNextQueryResult()) {
+        return result;
+    }
+    auto tableIDs = QueryResultCache::getTableIDs(*cachedStatement->logicalPlan);
+    if (!tableIDs) {
+        return result;
+    }
+    auto entry = std::make_shared<QueryResultCache::Entry>();
+    entry->table = result->constCast<MaterializedQueryResult>().getSharedFactorizedTable();
+    entry->columnNames = cachedStatement->getColumnNames();
+    entry->columnTypes = cachedStatement->getColumnTypes();
+    entry->tableIDs = std::move(*tableIDs);
+    entry->timestamp = timestamp;
+    entry->memoryUsage = entry->table->getMemoryUsage();
+    localDatabase->getQueryResultCache()->insert(key, std::move(entry));
+    return result;
+}
+
 std::unique_ptr<QueryResult> ClientContext::query(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
     lock_t lck{mtx};
@@ -346,18 +493,36 @@ std::unique_ptr<QueryResult> ClientContext::queryNoLock(std::string_view query,
     std::optional<uint64_t> queryID, QueryConfig config) {
     auto parsedStatements = std::vector<std::shared_ptr<Statement>>();
     try {
-        parsedStatements = parseQuery(query);
+        const auto viewQuery = getMaterializedViewQueryNoLock(query);
+        parsedStatements = parseQuery(viewQuery.empty() ? query : viewQuery);
     } catch (std::exception& exception) {
         return QueryResult::getQueryResultWithError(exception.what());
     }
+    // The result stream is consumed as the result of a single statement.
+    if (config.resultStream != nullptr && parsedStatements.size() != 1) {
+        return QueryResult::getQueryResultWithError(
+            "Streaming query results are only supported for a single statement.");
+    }
+    // Results are cached per query, so only queries with a single statement are cached.
+    std::string resultCacheKey;
+    if (parsedStatements.size() == 1 && canUseQueryResultCacheNoLock(config)) {
+        resultCacheKey = QueryResultCache::getKey(query, {} /* parameters */, clientConfig);
+        if (auto cachedResult = getCachedQueryResultNoLock(resultCacheKey)) {
+            return cachedResult;
+        }
+    }
     std::unique_ptr<QueryResult> queryResult;
     QueryResult* lastResult = nullptr;
     double internalCompilingTime = 0.0, internalExecutionTime = 0.0;
     for (const auto& statement : parsedStatements) {
         auto [preparedStatement, cachedStatement] =
             prepareNoLock(statement, false /*shouldCommitNewTransaction*/);
+        cachedStatement->query = std::string(query);
         auto currentQueryResult =
-            executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config);
+            resultCacheKey.empty() ?
+                executeNoLock(preparedStatement.get(), cachedStatement.get(), queryID, config) :
+                executeAndCacheResultNoLock(resultCacheKey, preparedStatement.get(),
+                    cachedStatement.get(), queryID, config);
         if (!currentQueryResult->isSuccess()) {
             if (!lastResult) {
                 queryResult = std::move(currentQueryResult);
@@ -396,15 +561,25 @@ std::vector<std::shared_ptr<Statement>> ClientContext::parseQuery(std::string_vi
     }
     std::vector<std::shared_ptr<Statement>> statements;
     auto parserTimer = TimeMetric(true /*enable*/);
-    parserTimer.start();
-    auto parsedStatements = Parser::parseQuery(query, localDatabase->getTransformerExtensions());
-    parserTimer.stop();
-    const auto avgParsingTime = parserTimer.getElapsedTimeMS() / parsedStatements.size() / 1.0;
+    auto parsedStatementCache = localDatabase->getParsedStatementCache();
+    std::vector<std::shared_ptr<Statement>> parsedStatements;
+    // Cached statements are shared with other connections, so they must not be modified. Their
+    // parsing time is the one measured when they were parsed.
+    if (!parsedStatementCache->lookup(query, parsedStatements)) {
+        parserTimer.start();
+        parsedStatements = Parser::parseQuery(query, localDatabase->getTransformerExtensions());
+        parserTimer.stop();
+        const auto parsingTime = parserTimer.getElapsedTimeMS() / parsedStatements.size() / 1.0;
+        for (auto& parsedStatement : parsedStatements) {
+            parsedStatement->setParsingTime(parsingTime);
+        }
+        parsedStatementCache->insert(query, parsedStatements);
+    }
     StandaloneCallRewriter standaloneCallAnalyzer{this, parsedStatements.size() == 1};
     for (auto i = 0u; i < parsedStatements.size(); i++) {
         auto rewriteQuery = standaloneCallAnalyzer.getRewriteQuery(*parsedStatements[i]);
+        const auto avgParsingTime = parsedStatements[i]->getParsingTime();
         if (rewriteQuery.empty()) {
-            parsedStatements[i]->setParsingTime(avgParsingTime);
             statements.push_back(std::move(parsedStatements[i]));
         } else {
             parserTimer.start();
@@ -439,7 +614,8 @@ void ClientContext::validateTransaction(bool readOnly, bool requireTransaction)
 
 ClientContext::PrepareResult ClientContext::prepareNoLock(
     std::shared_ptr<Statement> parsedStatement, bool shouldCommitNewTransaction,
-    std::unordered_map<std::string, std::shared_ptr<Value>> inputParams) {
+    std::unordered_map<std::string, std::shared_ptr<Value>> inputParams,
+    const planner::CardinalityFeedback* cardinalityFeedback) {
     auto preparedStatement = std::make_unique<PreparedStatement>();
     auto cachedStatement = std::make_unique<CachedPreparedStatement>();
     cachedStatement->parsedStatement = parsedStatement;
@@ -468,6 +644,16 @@ ClientContext::PrepareResult ClientContext::prepareNoLock(
                 preparedStatement->parameterMap = expressionBinder->getKnownParameters();
                 cachedStatement->columns = boundStatement->getStatementResult()->getColumns();
                 auto planner = Planner(this);
+                // Re-optimization restarts the statement, which is only safe if nothing has been
+                // written and the statement does not run inside a transaction opened by the user.
+                if (clientConfig.enableAdaptiveJoinOrder && preparedStatement->isReadOnly() &&
+                    transactionContext->isAutoTransaction()) {
+                    cachedStatement->cardinalityFeedback =
+                        cardinalityFeedback ?
+                            std::make_unique<CardinalityFeedback>(*cardinalityFeedback) :
+                            std::make_unique<CardinalityFeedback>();
+                    planner.setCardinalityFeedback(cachedStatement->cardinalityFeedback.get());
+                }
                 auto bestPlan = planner.planStatement(*boundStatement);
                 optimizer::Optimizer::optimize(&bestPlan, this, planner.getCardinalityEstimator());
                 cachedStatement->logicalPlan = std::make_unique<LogicalPlan>(std::move(bestPlan));
@@ -505,15 +691,32 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
             *transactionContext,
             [&]() -> void {
                 const auto profiler = std::make_unique<Profiler>();
-                profiler->enabled = cachedStatement->logicalPlan->isProfile();
+                // The settings are read up front, since the query may change them.
+                const auto slowQueryLogPath = clientConfig.slowQueryLogPath;
+                const auto slowQueryThresholdInMS = clientConfig.slowQueryThresholdInMS;
+                const auto logSlowQuery = !slowQueryLogPath.empty();
+                profiler->enabled = cachedStatement->logicalPlan->isProfile() || logSlowQuery;
+                profiler->enableHardwareCounters = clientConfig.enableHardwareCounters;
                 if (!queryID) {
                     queryID = localDatabase->getNextQueryID();
                 }
+                profiler->memoryTracker =
+                    storage::MemoryManager::Get(*this)->createQueryMemoryTracker(*queryID);
                 const auto executionContext =
                     std::make_unique<ExecutionContext>(profiler.get(), this, *queryID);
+                std::unique_ptr<QueryTracer> tracer;
+                if (!clientConfig.queryTracePath.empty()) {
+                    tracer = std::make_unique<QueryTracer>();
+                    executionContext->tracer = tracer.get();
+                }
                 auto mapper = PlanMapper(executionContext.get());
                 const auto physicalPlan = mapper.getPhysicalPlan(cachedStatement->logicalPlan.get(),
-                    cachedStatement->columns, queryConfig.resultType, queryConfig.arrowConfig);
+                    cachedStatement->columns, queryConfig.resultType, queryConfig.arrowConfig,
+                    queryConfig.resultStream);
+                if (queryConfig.resultStream != nullptr) {
+                    queryConfig.resultStream->start(cachedStatement->getColumnNames(),
+                        cachedStatement->getColumnTypes());
+                }
                 if (isTransactionStatement) {
                     result = localDatabase->queryProcessor->execute(physicalPlan.get(),
                         executionContext.get());
@@ -525,10 +728,30 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
                     result = localDatabase->queryProcessor->execute(physicalPlan.get(),
                         executionContext.get());
                 }
+                if (tracer != nullptr) {
+                    writeQueryTrace(*tracer);
+                }
+                const auto executionTime = executingTimer.timer.getElapsedTimeInMS();
+                if (logSlowQuery && executionTime >= slowQueryThresholdInMS) {
+                    SlowQueryInfo info;
+                    info.query = cachedStatement->query;
+                    info.parameters = &preparedStatement->parameterMap;
+                    info.compilingTimeInMS = preparedStatement->preparedSummary.compilingTime;
+                    info.executionTimeInMS = executionTime;
+                    info.peakMemory = profiler->memoryTracker->getPeakUsage();
+                    localDatabase->getSlowQueryLog()->append(slowQueryLogPath,
+                        SlowQueryLog::createEntry(info, *physicalPlan, *profiler), this);
+                }
             },
             preparedStatement->isReadOnly(), isTransactionStatement,
             TransactionHelper::getAction(true /*shouldCommitNewTransaction*/,
                 !isTransactionStatement /*shouldCommitAutoTransaction*/));
+    } catch (ReoptimizeException& e) {
+        if (cachedStatement->cardinalityFeedback != nullptr) {
+            return reoptimizeNoLock(*preparedStatement, *cachedStatement, e, queryID, queryConfig);
+        }
+        useInternalCatalogEntry_ = false;
+        return handleFailedExecution(queryID, e);
     } catch (std::exception& e) {
         useInternalCatalogEntry_ = false;
         return handleFailedExecution(queryID, e);
@@ -541,9 +764,78 @@ std::unique_ptr<QueryResult> ClientContext::executeNoLock(PreparedStatement* pre
     auto summary = std::make_unique<QuerySummary>(preparedStatement->preparedSummary);
     summary->setExecutionTime(executingTimer.getElapsedTimeMS());
     result->setQuerySummary(std::move(summary));
+    if (!preparedStatement->isReadOnly()) {
+        autoAnalyzeNoLock();
+    }
     return result;
 }
 
+void ClientContext::autoAnalyzeNoLock() {
+    if (!clientConfig.autoAnalyze || runningAutoAnalyze ||
+        transactionContext->hasActiveTransaction() || !canExecuteWriteQuery()) {
+        return;
+    }
+    runningAutoAnalyze = true;
+    for (auto tableName : storage::StorageManager::Get(*this)->getNodeTablesToAnalyze()) {
+        StringUtils::replaceAll(tableName, "'", "\\'");
+        // Failures are ignored, since the stats are only used for planning.
+        queryNoLock(stringFormat("CALL {}('{}');", function::AnalyzeFunction::name, tableName));
+    }
+    runningAutoAnalyze = false;
+}
+
+std::string ClientContext::getMaterializedViewQueryNoLock(std::string_view query) {
+    if (transactionContext->hasActiveTransaction()) {
+        return "";
+    }
+    const auto materializedViews = localDatabase->getMaterializedViews();
+    const auto viewEntry = materializedViews->findView(*this, &DUMMY_TRANSACTION, query);
+    if (viewEntry == nullptr) {
+        return "";
+    }
+    const auto viewTableID = viewEntry->getTableID();
+    auto viewName = viewEntry->getName();
+    auto scanQuery = main::MaterializedViews::getScanQuery(*viewEntry);
+    if (materializedViews->isFresh(*this, &DUMMY_TRANSACTION, viewTableID)) {
+        return scanQuery;
+    }
+    if (!canExecuteWriteQuery()) {
+        return "";
+    }
+    StringUtils::replaceAll(viewName, "\\", "\\\\");
+    StringUtils::replaceAll(viewName, "'", "\\'");
+    // If the refresh fails, the query is evaluated from the base tables instead.
+    const auto refreshResult = queryNoLock(
+        stringFormat("CALL {}('{}');", function::RefreshMaterializedViewFunction::name, viewName));
+    if (!refreshResult->isSuccess() ||
+        !materializedViews->isFresh(*this, &DUMMY_TRANSACTION, viewTableID)) {
+        return "";
+    }
+    return scanQuery;
+}
+
+std::unique_ptr<QueryResult> ClientContext::reoptimizeNoLock(
+    const PreparedStatement& preparedStatement, const CachedPreparedStatement& cachedStatement,
+    const ReoptimizeException& exception, std::optional<uint64_t> queryID, QueryConfig config) {
+    const auto memoryManager = storage::MemoryManager::Get(*this);
+    memoryManager->getBufferManager()->getSpillerOrSkip([](auto& spiller) { spiller.clearFile(); });
+    auto cardinalityFeedback = *cachedStatement.cardinalityFeedback;
+    cardinalityFeedback.add(exception.getSubgraphKey(), exception.getCardinality());
+    auto [newPreparedStatement, newCachedStatement] =
+        prepareNoLock(cachedStatement.parsedStatement, false /*shouldCommitNewTransaction*/,
+            preparedStatement.parameterMap, &cardinalityFeedback);
+    newCachedStatement->query = cachedStatement.query;
+    return executeNoLock(newPreparedStatement.get(), newCachedStatement.get(), queryID, config);
+}
+
+void ClientContext::writeQueryTrace(const QueryTracer& tracer) {
+    const auto trace = tracer.toJson();
+    const auto fileInfo = VirtualFileSystem::GetUnsafe(*this)->openFile(clientConfig.queryTracePath,
+        FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS), this);
+    fileInfo->writeFile(reinterpret_cast<const uint8_t*>(trace.data()), trace.size(),
+        0 /* offset */);
+}
+
 std::unique_ptr<QueryResult> ClientContext::handleFailedExecution(std::optional<uint64_t> queryID,
     const std::exception& e) const {
     const auto memoryManager = storage::MemoryManager::Get(*this);
@@ -1,8 +1,11 @@
 #include "main/connection.h"
 
+#include <thread>
 #include <utility>
 
 #include "common/random_engine.h"
+#include "main/query_result/streaming_query_result.h"
+#include "processor/result/result_stream.h"
 
 using namespace ryu::parser;
 using namespace ryu::binder;
@@ -53,6 +56,12 @@ std::unique_ptr<QueryResult> Connection::query(std::string_view queryStatement)
     return queryResult;
 }
 
+std::future<std::unique_ptr<QueryResult>> Connection::queryAsync(std::string_view query) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    return std::async(std::launch::async,
+        [this, query = std::string(query)]() { return this->query(query); });
+}
+
 std::unique_ptr<QueryResult> Connection::queryAsArrow(std::string_view query, int64_t chunkSize) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
     auto queryResult = clientContext->query(query, std::nullopt,
@@ -61,6 +70,31 @@ std::unique_ptr<QueryResult> Connection::queryAsArrow(std::string_view query, in
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> Connection::queryAsStream(std::string_view query) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto stream = std::make_shared<ResultStream>();
+    std::thread executor{[this, stream, query = std::string(query)]() {
+        std::unique_ptr<QueryResult> result;
+        try {
+            result = clientContext->query(query, std::nullopt, ClientContext::QueryConfig{stream});
+        } catch (std::exception& e) {
+            result = QueryResult::getQueryResultWithError(e.what());
+        }
+        stream->finish(std::move(result));
+    }};
+    std::unique_ptr<QueryResult> queryResult;
+    if (stream->waitUntilStarted()) {
+        queryResult = std::make_unique<StreamingQueryResult>(stream->getColumnNames(),
+            stream->getColumnTypes(), stream, std::move(executor), clientContext.get());
+    } else {
+        // The query failed or finished before producing any output.
+        executor.join();
+        queryResult = stream->takeFinalResult();
+    }
+    queryResult->setDBLifeCycleManager(dbLifeCycleManager);
+    return queryResult;
+}
+
 std::unique_ptr<QueryResult> Connection::queryWithID(std::string_view queryStatement,
     uint64_t queryID) {
     dbLifeCycleManager->checkDatabaseClosedOrThrow();
@@ -87,6 +121,14 @@ std::unique_ptr<QueryResult> Connection::executeWithParams(PreparedStatement* pr
     return queryResult;
 }
 
+std::unique_ptr<QueryResult> Connection::executeBatch(PreparedStatement* preparedStatement,
+    std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>> batch) {
+    dbLifeCycleManager->checkDatabaseClosedOrThrow();
+    auto queryResult = clientContext->executeBatch(preparedStatement, std::move(batch));
+    queryResult->setDBLifeCycleManager(dbLifeCycleManager);
+    return queryResult;
+}
+
 std::unique_ptr<QueryResult> Connection::executeWithParamsWithID(
     PreparedStatement* preparedStatement,
     std::unordered_map<std::string, std::unique_ptr<Value>> inputParams, uint64_t queryID) {
@@ -7,6 +7,12 @@
 #include "extension/transformer_extension.h"
 #include "main/client_context.h"
 #include "main/database_manager.h"
+#include "main/database_metrics.h"
+#include "main/slow_query_log.h"
+#include "main/materialized_views.h"
+#include "main/parsed_statement_cache.h"
+#include "main/query_result_cache.h"
+#include "parser/parser.h"
 #include "storage/buffer_manager/buffer_manager.h"
 
 #if defined(_WIN32)
@@ -34,7 +40,9 @@ namespace main {
 
 SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, bool enableCompression,
     bool readOnly, uint64_t maxDBSize, bool autoCheckpoint, uint64_t checkpointThreshold,
-    bool forceCheckpointOnClose, bool throwOnWalReplayFailure, bool enableChecksums
+    bool forceCheckpointOnClose, bool throwOnWalReplayFailure, bool enableChecksums,
+    bool enableWorkStealing, bool enableScanResistantEviction, bool enableHugePages,
+    bool enableNUMAPartitioning, bool enableReadReplica, bool enableBufferPoolPrewarm
 #if defined(__APPLE__)
     ,
     uint32_t threadQos
@@ -43,7 +51,11 @@ SystemConfig::SystemConfig(uint64_t bufferPoolSize_, uint64_t maxNumThreads, boo
     : maxNumThreads{maxNumThreads}, enableCompression{enableCompression}, readOnly{readOnly},
       autoCheckpoint{autoCheckpoint}, checkpointThreshold{checkpointThreshold},
       forceCheckpointOnClose{forceCheckpointOnClose},
-      throwOnWalReplayFailure(throwOnWalReplayFailure), enableChecksums(enableChecksums) {
+      throwOnWalReplayFailure(throwOnWalReplayFailure), enableChecksums(enableChecksums),
+      enableWorkStealing{enableWorkStealing},
+      enableScanResistantEviction{enableScanResistantEviction}, enableHugePages{enableHugePages},
+      enableNUMAPartitioning{enableNUMAPartitioning}, enableReadReplica{enableReadReplica},
+      enableBufferPoolPrewarm{enableBufferPoolPrewarm} {
 #if defined(__APPLE__)
     this->threadQos = threadQos;
 #endif
@@ -90,12 +102,16 @@ Database::Database(std::string_view databasePath, SystemConfig systemConfig,
     construct_bm_func_t constructBMFunc)
     : dbConfig(systemConfig) {
     initMembers(databasePath, constructBMFunc);
+    startParserWarmUp();
 }
 
 std::unique_ptr<BufferManager> Database::initBufferManager(const Database& db) {
     return std::make_unique<BufferManager>(db.databasePath,
         StorageUtils::getTmpFilePath(db.databasePath), db.dbConfig.bufferPoolSize,
-        db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly);
+        db.dbConfig.maxDBSize, db.vfs.get(), db.dbConfig.readOnly,
+        db.dbConfig.enableScanResistantEviction ? EvictionPolicy::SCAN_RESISTANT :
+                                                  EvictionPolicy::CLOCK,
+        db.dbConfig.enableHugePages, db.dbConfig.enableNUMAPartitioning);
 }
 
 void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFunc) {
@@ -108,16 +124,20 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
     if (std::filesystem::is_directory(databasePath)) {
         throw RuntimeException("Database path cannot be a directory: " + databasePath);
     }
+    metrics = std::make_unique<DatabaseMetrics>();
+    slowQueryLog = std::make_unique<SlowQueryLog>();
     vfs = std::make_unique<VirtualFileSystem>(databasePath);
     validatePathInReadOnly();
 
     bufferManager = initBmFunc(*this);
+    bufferManager->setMetrics(metrics.get());
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get(), vfs.get());
 #if defined(__APPLE__)
-    queryProcessor =
-        std::make_unique<processor::QueryProcessor>(dbConfig.maxNumThreads, dbConfig.threadQos);
+    queryProcessor = std::make_unique<processor::QueryProcessor>(dbConfig.maxNumThreads,
+        dbConfig.enableWorkStealing, dbConfig.threadQos);
 #else
-    queryProcessor = std::make_unique<processor::QueryProcessor>(dbConfig.maxNumThreads);
+    queryProcessor = std::make_unique<processor::QueryProcessor>(dbConfig.maxNumThreads,
+        dbConfig.enableWorkStealing);
 #endif
 
     catalog = std::make_unique<Catalog>();
@@ -126,27 +146,54 @@ void Database::initMembers(std::string_view dbPath, construct_bm_func_t initBmFu
     transactionManager = std::make_unique<TransactionManager>(storageManager->getWAL());
     databaseManager = std::make_unique<DatabaseManager>();
 
-    extensionManager = std::make_unique<extension::ExtensionManager>();
+    extensionManager = std::make_unique<extension::ExtensionManager>(*this);
+    catalog->setExtensionManager(extensionManager.get());
+    parsedStatementCache = std::make_unique<ParsedStatementCache>();
+    materializedViews = std::make_unique<MaterializedViews>();
+    queryResultCache = std::make_unique<QueryResultCache>(
+        dbConfig.bufferPoolSize / QueryResultCache::BUFFER_POOL_FRACTION);
     dbLifeCycleManager = std::make_shared<DatabaseLifeCycleManager>();
     if (clientContext.isInMemory()) {
         storageManager->initDataFileHandle(vfs.get(), &clientContext);
         extensionManager->autoLoadLinkedExtensions(&clientContext);
+        transactionManager->startUpdateVacuumer(*storageManager);
         return;
     }
     StorageManager::recover(clientContext, dbConfig.throwOnWalReplayFailure,
         dbConfig.enableChecksums);
+    if (!dbConfig.readOnly) {
+        transactionManager->startUpdateVacuumer(*storageManager);
+    }
+    if (dbConfig.enableBufferPoolPrewarm && !dbConfig.enableReadReplica) {
+        startBufferPoolPrewarm(clientContext);
+    }
 }
 
 Database::~Database() {
+    if (parserWarmUpThread.joinable()) {
+        parserWarmUpThread.join();
+    }
+    stopPrewarm = true;
+    if (prewarmThread.joinable()) {
+        prewarmThread.join();
+    }
     if (!dbConfig.readOnly && dbConfig.forceCheckpointOnClose) {
         try {
             ClientContext clientContext(this);
             transactionManager->checkpoint(clientContext);
         } catch (...) {} // NOLINT
     }
+    try {
+        ClientContext clientContext(this);
+        storageManager->saveBufferPoolSnapshot(clientContext);
+    } catch (...) {} // NOLINT
     dbLifeCycleManager->isDatabaseClosed = true;
 }
 
+std::string Database::exportMetrics() {
+    return metrics->exportOpenMetrics(*this);
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const function.
 void Database::registerFileSystem(std::unique_ptr<FileSystem> fs) {
     vfs->registerFileSystem(std::move(fs));
@@ -168,6 +215,8 @@ void Database::addExtensionOption(std::string name, LogicalTypeID type, Value de
 void Database::addTransformerExtension(
     std::unique_ptr<extension::TransformerExtension> transformerExtension) {
     transformerExtensions.push_back(std::move(transformerExtension));
+    // Cached statements were parsed without the new extension.
+    parsedStatementCache->clear();
 }
 
 std::vector<extension::TransformerExtension*> Database::getTransformerExtensions() {
@@ -220,6 +269,9 @@ std::vector<StorageExtension*> Database::getStorageExtensions() {
 }
 
 void Database::validatePathInReadOnly() const {
+    if (dbConfig.enableReadReplica && !dbConfig.readOnly) {
+        throw Exception("Read replicas must be opened under READ ONLY mode.");
+    }
     if (dbConfig.readOnly) {
         if (DBConfig::isDBPathInMemory(databasePath)) {
             throw Exception("Cannot open an in-memory database under READ ONLY mode.");
@@ -230,6 +282,56 @@ void Database::validatePathInReadOnly() const {
     }
 }
 
+void Database::startParserWarmUp() {
+#ifndef __SINGLE_THREADED__
+    // Opening the database doesn't wait for the warm-up. Queries parsed meanwhile work as usual.
+    if (!parser::Parser::isWarmedUp()) {
+        parserWarmUpThread = std::thread([] { parser::Parser::warmUp(); });
+    }
+#endif
+}
+
+void Database::startBufferPoolPrewarm(ClientContext& clientContext) {
+#ifndef __SINGLE_THREADED__
+    std::vector<PageRange> pageRanges;
+    try {
+        pageRanges = storageManager->loadBufferPoolSnapshot(clientContext);
+    } catch (...) { // NOLINT: A damaged snapshot only means that pages are read on first use.
+        return;
+    }
+    if (pageRanges.empty()) {
+        return;
+    }
+    prewarmThread = std::thread([this, pageRanges = std::move(pageRanges)] {
+        // Pages are read in batches, so that checkpoints don't wait long for the prewarming to
+        // get out of their way.
+        static constexpr page_idx_t PREWARM_BATCH_SIZE = 1024;
+        for (auto& pageRange : pageRanges) {
+            for (auto i = 0u; i < pageRange.numPages; i += PREWARM_BATCH_SIZE) {
+                if (stopPrewarm) {
+                    return;
+                }
+                const PageRange batch{pageRange.startPageIdx + i,
+                    std::min(PREWARM_BATCH_SIZE, pageRange.numPages - i)};
+                bool fitsIntoBufferPool = false;
+                try {
+                    transactionManager->runWithoutCheckpoint([&] {
+                        fitsIntoBufferPool = storageManager->prewarmPages(batch);
+                    });
+                } catch (...) { // NOLINT: Pages which failed to be read are read on first use.
+                    return;
+                }
+                if (!fitsIntoBufferPool) {
+                    return;
+                }
+            }
+        }
+    });
+#else
+    KU_UNUSED(clientContext);
+#endif
+}
+
 uint64_t Database::getNextQueryID() {
     std::unique_lock lock(queryIDGenerator.queryIDLock);
     return queryIDGenerator.queryID++;
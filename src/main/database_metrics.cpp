@@ -0,0 +1,142 @@
+#include "main/database_metrics.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "common/task_system/task_scheduler.h"
+#include "main/database.h"
+#include "processor/processor.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "transaction/transaction_manager.h"
+
+namespace ryu {
+namespace main {
+
+uint32_t MetricCounter::getShardIdx() {
+    static std::atomic<uint32_t> nextShardIdx{0};
+    thread_local uint32_t shardIdx =
+        nextShardIdx.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+    return shardIdx;
+}
+
+uint64_t MetricCounter::get() const {
+    uint64_t value = 0;
+    for (auto& shard : shards) {
+        value += shard.value.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+void MetricHistogram::observe(uint64_t durationInMicros) {
+    auto bucketIdx = 0u;
+    while (durationInMicros > getBucketUpperBoundInMicros(bucketIdx)) {
+        bucketIdx++;
+    }
+    buckets[bucketIdx].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sumInMicros.fetch_add(durationInMicros, std::memory_order_relaxed);
+}
+
+uint64_t MetricHistogram::getBucketUpperBoundInMicros(uint32_t bucketIdx) {
+    if (bucketIdx == NUM_BUCKETS - 1) {
+        return UINT64_MAX;
+    }
+    return 1000ull << bucketIdx;
+}
+
+static constexpr double MICROS_PER_SECOND = 1000000.0;
+
+static void addCounter(std::vector<MetricSample>& samples, const std::string& family,
+    const std::string& help, uint64_t value) {
+    samples.push_back({family, family + "_total", "counter", help, "", (double)value});
+}
+
+static void addGauge(std::vector<MetricSample>& samples, const std::string& family,
+    const std::string& help, uint64_t value) {
+    samples.push_back({family, family, "gauge", help, "", (double)value});
+}
+
+static void addHistogram(std::vector<MetricSample>& samples, const std::string& family,
+    const std::string& help, const MetricHistogram& histogram) {
+    // Buckets are cumulative in OpenMetrics.
+    uint64_t numObservations = 0;
+    for (auto i = 0u; i < MetricHistogram::NUM_BUCKETS; i++) {
+        numObservations += histogram.getBucketCount(i);
+        const auto upperBound = MetricHistogram::getBucketUpperBoundInMicros(i);
+        std::ostringstream labels;
+        labels << "{le=\"";
+        if (upperBound == UINT64_MAX) {
+            labels << "+Inf";
+        } else {
+            labels << (double)upperBound / MICROS_PER_SECOND;
+        }
+        labels << "\"}";
+        samples.push_back(
+            {family, family + "_bucket", "histogram", help, labels.str(), (double)numObservations});
+    }
+    samples.push_back(
+        {family, family + "_count", "histogram", help, "", (double)histogram.getCount()});
+    samples.push_back({family, family + "_sum", "histogram", help, "",
+        (double)histogram.getSumInMicros() / MICROS_PER_SECOND});
+}
+
+std::vector<MetricSample> DatabaseMetrics::collect(Database& database) const {
+    std::vector<MetricSample> samples;
+    const auto bufferManager = database.getMemoryManager()->getBufferManager();
+    addGauge(samples, "ryu_buffer_manager_memory_limit_bytes",
+        "Size of the buffer pool in bytes.", bufferManager->getMemoryLimit());
+    addGauge(samples, "ryu_buffer_manager_memory_usage_bytes",
+        "Memory used by the buffer manager in bytes.", bufferManager->getUsedMemory());
+    addCounter(samples, "ryu_buffer_manager_page_accesses", "Number of pages pinned or read.",
+        numPageAccesses.get());
+    addCounter(samples, "ryu_buffer_manager_page_misses",
+        "Number of accessed pages which had to be read from disk.", numPageMisses.get());
+    addCounter(samples, "ryu_buffer_manager_read_bytes", "Number of bytes read from disk.",
+        numBytesRead.get());
+    addCounter(samples, "ryu_buffer_manager_evicted_pages", "Number of pages evicted.",
+        numEvictedPages.get());
+    addCounter(samples, "ryu_wal_written_bytes", "Number of bytes of committed WAL records.",
+        numWALBytes.get());
+    addCounter(samples, "ryu_wal_syncs", "Number of syncs of the WAL file.", numWALSyncs.get());
+    addHistogram(samples, "ryu_checkpoint_duration_seconds", "Duration of checkpoints.",
+        checkpointDuration);
+    addHistogram(samples, "ryu_checkpoint_wait_duration_seconds",
+        "Time checkpoints waited for active transactions to leave.", checkpointWaitDuration);
+    addGauge(samples, "ryu_active_transactions", "Number of active transactions.",
+        database.getTransactionManager()->getNumActiveTransactions());
+    addCounter(samples, "ryu_committed_transactions", "Number of committed transactions.",
+        numCommittedTransactions.get());
+    addCounter(samples, "ryu_rolled_back_transactions", "Number of rolled back transactions.",
+        numRolledBackTransactions.get());
+    const auto taskScheduler = database.getQueryProcessor()->getTaskScheduler();
+    addGauge(samples, "ryu_task_queue_depth", "Number of tasks waiting in the task queue.",
+        taskScheduler->getNumQueuedTasks());
+    addCounter(samples, "ryu_scheduled_tasks", "Number of tasks scheduled.",
+        taskScheduler->getNumScheduledTasks());
+    return samples;
+}
+
+std::string DatabaseMetrics::exportOpenMetrics(Database& database) const {
+    std::ostringstream result;
+    std::string family;
+    for (auto& sample : collect(database)) {
+        if (sample.family != family) {
+            family = sample.family;
+            result << "# TYPE " << family << " " << sample.type << "\n";
+            result << "# HELP " << family << " " << sample.help << "\n";
+        }
+        result << sample.name << sample.labels << " ";
+        if (sample.value == std::floor(sample.value) && sample.value < (double)(1ull << 53)) {
+            result << (uint64_t)sample.value;
+        } else {
+            result << sample.value;
+        }
+        result << "\n";
+    }
+    result << "# EOF\n";
+    return result.str();
+}
+
+} // namespace main
+} // namespace ryu
@@ -21,18 +21,32 @@ static ConfigurationOption options[] = { // NOLINT(cert-err58-cpp):
     GET_CONFIGURATION(ProgressBarSetting), GET_CONFIGURATION(RecursivePatternSemanticSetting),
     GET_CONFIGURATION(RecursivePatternFactorSetting), GET_CONFIGURATION(EnableMVCCSetting),
     GET_CONFIGURATION(CheckpointThresholdSetting), GET_CONFIGURATION(AutoCheckpointSetting),
+    GET_CONFIGURATION(DeferAutoCheckpointSetting),
     GET_CONFIGURATION(ForceCheckpointClosingDBSetting), GET_CONFIGURATION(SpillToDiskSetting),
-    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting)};
+    GET_CONFIGURATION(EnableOptimizerSetting), GET_CONFIGURATION(EnableInternalCatalogSetting),
+    GET_CONFIGURATION(GroupCommitSetting), GET_CONFIGURATION(GroupCommitDelaySetting),
+    GET_CONFIGURATION(WSPDeltaSetting), GET_CONFIGURATION(EnableAdaptiveJoinOrderSetting),
+    GET_CONFIGURATION(SortStringPrefixLengthSetting), GET_CONFIGURATION(ColdStoragePathSetting),
+    GET_CONFIGURATION(EnableHardwareCountersSetting), GET_CONFIGURATION(QueryTracePathSetting),
+    GET_CONFIGURATION(SlowQueryLogPathSetting), GET_CONFIGURATION(SlowQueryThresholdSetting),
+    GET_CONFIGURATION(AutoAnalyzeSetting), GET_CONFIGURATION(EnableQueryResultCacheSetting)};
 
 DBConfig::DBConfig(const SystemConfig& systemConfig)
     : bufferPoolSize{systemConfig.bufferPoolSize}, maxNumThreads{systemConfig.maxNumThreads},
       enableCompression{systemConfig.enableCompression}, readOnly{systemConfig.readOnly},
       maxDBSize{systemConfig.maxDBSize}, enableMultiWrites{false},
-      autoCheckpoint{systemConfig.autoCheckpoint},
+      enableGroupCommit{false}, groupCommitDelayInMicros{0},
+      autoCheckpoint{systemConfig.autoCheckpoint}, deferAutoCheckpoint{false},
       checkpointThreshold{systemConfig.checkpointThreshold},
       forceCheckpointOnClose{systemConfig.forceCheckpointOnClose},
       throwOnWalReplayFailure(systemConfig.throwOnWalReplayFailure),
-      enableChecksums(systemConfig.enableChecksums), enableSpillingToDisk{true} {
+      enableChecksums(systemConfig.enableChecksums), enableSpillingToDisk{true},
+      enableWorkStealing{systemConfig.enableWorkStealing},
+      enableScanResistantEviction{systemConfig.enableScanResistantEviction},
+      enableHugePages{systemConfig.enableHugePages},
+      enableNUMAPartitioning{systemConfig.enableNUMAPartitioning},
+      enableReadReplica{systemConfig.enableReadReplica},
+      enableBufferPoolPrewarm{systemConfig.enableBufferPoolPrewarm} {
 #if defined(__APPLE__)
     this->threadQos = systemConfig.threadQos;
 #endif
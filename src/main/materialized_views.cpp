@@ -0,0 +1,138 @@
+#include "main/materialized_views.h"
+
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/node_table_catalog_entry.h"
+#include "common/string_format.h"
+#include "common/string_utils.h"
+#include "storage/storage_manager.h"
+
+using namespace ryu::catalog;
+using namespace ryu::common;
+
+namespace ryu {
+namespace main {
+
+bool MaterializedViews::isView(const TableCatalogEntry& entry) {
+    return entry.getComment().starts_with(COMMENT_PREFIX);
+}
+
+std::string MaterializedViews::getDefiningQuery(const TableCatalogEntry& entry) {
+    KU_ASSERT(isView(entry));
+    return entry.getComment().substr(std::string_view{COMMENT_PREFIX}.size());
+}
+
+std::string MaterializedViews::normalizeQuery(std::string_view query) {
+    auto normalized = StringUtils::rtrim(StringUtils::ltrim(query));
+    while (normalized.ends_with(';')) {
+        normalized = StringUtils::rtrim(normalized.substr(0, normalized.size() - 1));
+    }
+    return std::string{normalized};
+}
+
+NodeTableCatalogEntry* MaterializedViews::findView(const ClientContext& context,
+    const transaction::Transaction* transaction, std::string_view query) {
+    const auto normalizedQuery = normalizeQuery(query);
+    std::unique_lock lck{mtx};
+    if (!viewsByQuery.has_value()) {
+        registerViews(context, transaction);
+        return findRegisteredView(context, transaction, normalizedQuery);
+    }
+    if (!viewsByQuery->contains(normalizedQuery)) {
+        return nullptr;
+    }
+    if (const auto viewEntry = findRegisteredView(context, transaction, normalizedQuery)) {
+        return viewEntry;
+    }
+    // The view was dropped or altered, but another view may have the same defining query.
+    registerViews(context, transaction);
+    return findRegisteredView(context, transaction, normalizedQuery);
+}
+
+NodeTableCatalogEntry* MaterializedViews::findRegisteredView(const ClientContext& context,
+    const transaction::Transaction* transaction, const std::string& normalizedQuery) {
+    const auto it = viewsByQuery->find(normalizedQuery);
+    if (it == viewsByQuery->end()) {
+        return nullptr;
+    }
+    const auto catalog = Catalog::Get(context);
+    if (catalog->containsTable(transaction, it->second, false)) {
+        const auto entry = catalog->getTableCatalogEntry(transaction, it->second);
+        if (entry->getTableType() == TableType::NODE && isView(*entry) &&
+            getDefiningQuery(*entry) == normalizedQuery) {
+            return entry->ptrCast<NodeTableCatalogEntry>();
+        }
+    }
+    viewsByQuery->erase(it);
+    return nullptr;
+}
+
+void MaterializedViews::registerViews(const ClientContext& context,
+    const transaction::Transaction* transaction) {
+    viewsByQuery.emplace();
+    for (const auto entry : Catalog::Get(context)->getNodeTableEntries(transaction, false)) {
+        if (isView(*entry)) {
+            viewsByQuery->emplace(getDefiningQuery(*entry), entry->getTableID());
+        }
+    }
+}
+
+std::string MaterializedViews::getScanQuery(const NodeTableCatalogEntry& viewEntry) {
+    std::string columns;
+    for (auto& property : viewEntry.getProperties()) {
+        if (property.getName() == viewEntry.getPrimaryKeyName()) {
+            continue;
+        }
+        if (!columns.empty()) {
+            columns += ", ";
+        }
+        columns += stringFormat("v.`{}` AS `{}`", property.getName(), property.getName());
+    }
+    return stringFormat("MATCH (v:`{}`) RETURN {};", viewEntry.getName(), columns);
+}
+
+void MaterializedViews::beginRefresh(const ClientContext& context,
+    const transaction::Transaction* transaction, const NodeTableCatalogEntry& viewEntry) {
+    auto versions = getBaseTableVersions(context, transaction);
+    const auto viewTableID = viewEntry.getTableID();
+    std::unique_lock lck{mtx};
+    // The rows of the view are replaced by separate transactions, which readers mustn't see.
+    refreshedVersions.erase(viewTableID);
+    pendingVersions[viewTableID] = std::move(versions);
+    if (viewsByQuery.has_value()) {
+        (*viewsByQuery)[getDefiningQuery(viewEntry)] = viewTableID;
+    }
+}
+
+void MaterializedViews::finishRefresh(table_id_t viewTableID) {
+    std::unique_lock lck{mtx};
+    const auto it = pendingVersions.find(viewTableID);
+    if (it == pendingVersions.end()) {
+        return;
+    }
+    refreshedVersions[viewTableID] = std::move(it->second);
+    pendingVersions.erase(it);
+}
+
+bool MaterializedViews::isFresh(const ClientContext& context,
+    const transaction::Transaction* transaction, table_id_t viewTableID) {
+    const auto versions = getBaseTableVersions(context, transaction);
+    std::unique_lock lck{mtx};
+    const auto it = refreshedVersions.find(viewTableID);
+    return it != refreshedVersions.end() && it->second == versions;
+}
+
+MaterializedViews::write_versions_t MaterializedViews::getBaseTableVersions(
+    const ClientContext& context, const transaction::Transaction* transaction) {
+    auto versions = storage::StorageManager::Get(context)->getTableWriteVersions();
+    // Views are refreshed from their base tables only, so writes to them (including their own
+    // refreshes) don't make other views stale.
+    for (const auto entry : Catalog::Get(context)->getNodeTableEntries(transaction, false)) {
+        if (isView(*entry)) {
+            versions.erase(entry->getTableID());
+        }
+    }
+    return versions;
+}
+
+} // namespace main
+} // namespace ryu
@@ -0,0 +1,43 @@
+#include "main/parsed_statement_cache.h"
+
+#include "parser/statement.h"
+
+namespace ryu {
+namespace main {
+
+bool ParsedStatementCache::lookup(std::string_view query, statements_t& statements) {
+    std::unique_lock lck{mtx};
+    auto it = entryMap.find(query);
+    if (it == entryMap.end()) {
+        return false;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    statements = it->second->statements;
+    return true;
+}
+
+void ParsedStatementCache::insert(std::string_view query, statements_t statements) {
+    if (query.size() > MAX_QUERY_LENGTH) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (entryMap.contains(query)) {
+        return;
+    }
+    if (entries.size() == CAPACITY) {
+        entryMap.erase(entries.back().query);
+        entries.pop_back();
+    }
+    entries.push_front(Entry{std::string(query), std::move(statements)});
+    // The key views the query owned by the list entry, which doesn't move.
+    entryMap.emplace(entries.front().query, entries.begin());
+}
+
+void ParsedStatementCache::clear() {
+    std::unique_lock lck{mtx};
+    entryMap.clear();
+    entries.clear();
+}
+
+} // namespace main
+} // namespace ryu
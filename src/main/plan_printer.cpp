@@ -421,6 +421,9 @@ std::string PlanPrinter::getOperatorParams(const LogicalOperator* logicalOperato
 nlohmann::json PlanPrinter::toJson(const PhysicalOperator* physicalOperator, Profiler& profiler_) {
     auto json = nlohmann::json();
     json["Name"] = getOperatorName(physicalOperator);
+    if (const auto estimatedCardinality = physicalOperator->getEstimatedCardinality()) {
+        json["EstimatedCardinality"] = *estimatedCardinality;
+    }
     if (profiler_.enabled) {
         for (auto& [key, val] : physicalOperator->getProfilerKeyValAttributes(profiler_)) {
             json[key] = val;
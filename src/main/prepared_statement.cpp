@@ -3,7 +3,8 @@
 #include "binder/expression/expression.h" // IWYU pragma: keep
 #include "common/exception/binder.h"
 #include "common/types/value/value.h"
-#include "planner/operator/logical_plan.h" // IWYU pragma: keep
+#include "planner/join_order/cardinality_feedback.h" // IWYU pragma: keep
+#include "planner/operator/logical_plan.h"             // IWYU pragma: keep
 
 using namespace ryu::common;
 
@@ -0,0 +1,133 @@
+#include "main/query_result/streaming_query_result.h"
+
+#include "common/arrow/arrow_row_batch.h"
+#include "common/exception/runtime.h"
+#include "main/client_context.h"
+#include "processor/result/factorized_table.h"
+#include "processor/result/flat_tuple.h"
+#include "processor/result/result_stream.h"
+
+using namespace ryu::common;
+using namespace ryu::processor;
+
+namespace ryu {
+namespace main {
+
+StreamingQueryResult::StreamingQueryResult(std::vector<std::string> columnNames,
+    std::vector<LogicalType> columnTypes, std::shared_ptr<ResultStream> stream,
+    std::thread executor, ClientContext* clientContext)
+    : QueryResult{type_, std::move(columnNames), std::move(columnTypes)},
+      stream{std::move(stream)}, executor{std::move(executor)}, clientContext{clientContext} {}
+
+StreamingQueryResult::~StreamingQueryResult() {
+    if (executor.joinable()) {
+        // The result was not consumed, so the workers blocked on the stream are released and the
+        // rest of the query is interrupted.
+        stream->close();
+        clientContext->interrupt();
+        executor.join();
+    }
+    if (dbLifeCycleManager && table) {
+        table->setPreventDestruction(dbLifeCycleManager->isDatabaseClosed);
+    }
+}
+
+uint64_t StreamingQueryResult::getNumTuples() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    return numTuplesRead;
+}
+
+bool StreamingQueryResult::hasNext() const {
+    checkDatabaseClosedOrThrow();
+    validateQuerySucceed();
+    // Whether there is a next tuple is only known once the next chunk is produced.
+    return const_cast<StreamingQueryResult*>(this)->fetchNext();
+}
+
+std::shared_ptr<FlatTuple> StreamingQueryResult::getNext() {
+    if (!hasNext()) {
+        throw RuntimeException(
+            "No more tuples in QueryResult, Please check hasNext() before calling getNext().");
+    }
+    numTuplesRead++;
+    if (iterator != nullptr && iterator->hasNext()) {
+        iterator->getNext(*tuple);
+        return tuple;
+    }
+    return finalResult->getNext();
+}
+
+void StreamingQueryResult::resetIterator() {
+    throw RuntimeException("The iterator of a streaming query result cannot be reset.");
+}
+
+std::string StreamingQueryResult::toString() const {
+    checkDatabaseClosedOrThrow();
+    if (!isSuccess()) {
+        return errMsg;
+    }
+    std::string result;
+    for (auto i = 0u; i < columnNames.size(); ++i) {
+        if (i != 0) {
+            result += "|";
+        }
+        result += columnNames[i];
+    }
+    result += "\n";
+    auto mutableThis = const_cast<StreamingQueryResult*>(this);
+    try {
+        while (mutableThis->hasNext()) {
+            result += mutableThis->getNext()->toString();
+        }
+    } catch (Exception& e) {
+        return errMsg;
+    }
+    return result;
+}
+
+bool StreamingQueryResult::hasNextArrowChunk() {
+    return hasNext();
+}
+
+std::unique_ptr<ArrowArray> StreamingQueryResult::getNextArrowChunk(int64_t chunkSize) {
+    auto rowBatch =
+        std::make_unique<ArrowRowBatch>(columnTypes, chunkSize, false /* fallbackExtensionTypes */);
+    auto rowBatchSize = 0u;
+    while (rowBatchSize < chunkSize && hasNext()) {
+        rowBatch->append(*getNext());
+        rowBatchSize++;
+    }
+    return std::make_unique<ArrowArray>(rowBatch->toArray(columnTypes));
+}
+
+bool StreamingQueryResult::fetchNext() {
+    while (iterator == nullptr || !iterator->hasNext()) {
+        if (finalResult != nullptr) {
+            return finalResult->hasNext();
+        }
+        table = stream->pop();
+        if (table == nullptr) {
+            finish();
+            validateQuerySucceed();
+            continue;
+        }
+        iterator = std::make_unique<FactorizedTableIterator>(*table);
+    }
+    return true;
+}
+
+void StreamingQueryResult::finish() {
+    executor.join();
+    finalResult = stream->takeFinalResult();
+    if (!finalResult->isSuccess()) {
+        success = false;
+        errMsg = finalResult->getErrorMessage();
+    }
+    if (finalResult->getQuerySummary() != nullptr) {
+        querySummary = std::make_unique<QuerySummary>(*finalResult->getQuerySummary());
+    }
+}
+
+} // namespace main
+} // namespace ryu
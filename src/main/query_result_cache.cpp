@@ -0,0 +1,209 @@
+#include "main/query_result_cache.h"
+
+#include <map>
+
+#include "binder/expression_visitor.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "common/types/value/value.h"
+#include "main/client_config.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/extend/logical_recursive_extend.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_order_by.h"
+#include "planner/operator/logical_plan.h"
+#include "planner/operator/logical_projection.h"
+#include "planner/operator/logical_unwind.h"
+#include "planner/operator/scan/logical_index_look_up.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+#include "processor/result/factorized_table.h"
+#include "transaction/transaction_manager.h"
+
+using namespace ryu::binder;
+using namespace ryu::catalog;
+using namespace ryu::common;
+using namespace ryu::planner;
+
+namespace ryu {
+namespace main {
+
+std::string QueryResultCache::getKey(std::string_view query, const parameters_t& parameters,
+    const ClientConfig& clientConfig) {
+    // Settings which change what a query returns rather than how it is computed.
+    auto key = std::to_string(clientConfig.varLengthMaxDepth) + '\0' +
+               std::to_string(static_cast<uint8_t>(clientConfig.recursivePatternSemantic)) +
+               std::to_string(clientConfig.disableMapKeyCheck) +
+               std::to_string(clientConfig.enableInternalCatalog) + '\0';
+    key += query;
+    // Parameters are ordered by name, so that the key doesn't depend on the order of the map.
+    std::map<std::string, const Value*> sortedParameters;
+    for (auto& [name, value] : parameters) {
+        sortedParameters.emplace(name, value.get());
+    }
+    for (auto& [name, value] : sortedParameters) {
+        key += '\0' + name + '\0' + value->getDataType().toString() + '\0' + value->toString();
+    }
+    return key;
+}
+
+// Rel tables are written per pair of node tables, so the rel tables of all pairs are read.
+static void addTableIDs(const std::vector<TableCatalogEntry*>& entries,
+    table_id_set_t& tableIDs) {
+    for (const auto entry : entries) {
+        if (entry->getType() == CatalogEntryType::REL_GROUP_ENTRY) {
+            for (auto& info : entry->constCast<RelGroupCatalogEntry>().getRelEntryInfos()) {
+                tableIDs.insert(info.oid);
+            }
+        } else {
+            tableIDs.insert(entry->getTableID());
+        }
+    }
+}
+
+static bool isNonDeterministic(const expression_vector& expressions) {
+    for (auto& expression : expressions) {
+        if (expression != nullptr && ExpressionVisitor::isNonDeterministic(*expression)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Results computed with e.g. rand() or current_timestamp() must not be reused.
+static bool hasNonDeterministicExpression(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::AGGREGATE: {
+        auto& aggregate = op.constCast<LogicalAggregate>();
+        return isNonDeterministic(aggregate.getAllKeys()) ||
+               isNonDeterministic(aggregate.getAggregates());
+    }
+    case LogicalOperatorType::FILTER:
+        return isNonDeterministic({op.constCast<LogicalFilter>().getPredicate()});
+    case LogicalOperatorType::ORDER_BY:
+        return isNonDeterministic(op.constCast<LogicalOrderBy>().getExpressionsToOrderBy());
+    case LogicalOperatorType::PROJECTION:
+        return isNonDeterministic(op.constCast<LogicalProjection>().getExpressionsToProject());
+    case LogicalOperatorType::UNWIND:
+        return isNonDeterministic({op.constCast<LogicalUnwind>().getInExpr()});
+    default:
+        return false;
+    }
+}
+
+static bool collectTableIDs(const LogicalOperator& op, table_id_set_t& tableIDs) {
+    if (hasNonDeterministicExpression(op)) {
+        return false;
+    }
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        for (const auto tableID : op.constCast<LogicalScanNodeTable>().getTableIDs()) {
+            tableIDs.insert(tableID);
+        }
+    } break;
+    case LogicalOperatorType::EXTEND: {
+        auto& extend = op.constCast<LogicalExtend>();
+        addTableIDs(extend.getRel()->getEntries(), tableIDs);
+        addTableIDs(extend.getNbrNode()->getEntries(), tableIDs);
+    } break;
+    case LogicalOperatorType::RECURSIVE_EXTEND: {
+        auto& graphEntry = op.constCast<LogicalRecursiveExtend>().getBindData().graphEntry;
+        addTableIDs(graphEntry.getNodeEntries(), tableIDs);
+        addTableIDs(graphEntry.getRelEntries(), tableIDs);
+    } break;
+    case LogicalOperatorType::INDEX_LOOK_UP: {
+        auto& lookup = op.constCast<LogicalPrimaryKeyLookup>();
+        for (auto i = 0u; i < lookup.getNumInfos(); i++) {
+            tableIDs.insert(lookup.getInfo(i).nodeTableID);
+        }
+    } break;
+    case LogicalOperatorType::ACCUMULATE:
+    case LogicalOperatorType::AGGREGATE:
+    case LogicalOperatorType::CROSS_PRODUCT:
+    case LogicalOperatorType::DISTINCT:
+    case LogicalOperatorType::DUMMY_SCAN:
+    case LogicalOperatorType::EMPTY_RESULT:
+    case LogicalOperatorType::EXPRESSIONS_SCAN:
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT:
+    case LogicalOperatorType::LIMIT:
+    case LogicalOperatorType::MULTIPLICITY_REDUCER:
+    case LogicalOperatorType::NODE_LABEL_FILTER:
+    case LogicalOperatorType::NOOP:
+    case LogicalOperatorType::ORDER_BY:
+    case LogicalOperatorType::PATH_PROPERTY_PROBE:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::SEMI_MASKER:
+    case LogicalOperatorType::UNION_ALL:
+    case LogicalOperatorType::UNWIND:
+        break;
+    default:
+        // E.g. table functions, whose output doesn't only depend on tables, or updates.
+        return false;
+    }
+    for (auto i = 0u; i < op.getNumChildren(); i++) {
+        if (!collectTableIDs(*op.getChild(i), tableIDs)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::optional<std::vector<table_id_t>> QueryResultCache::getTableIDs(const LogicalPlan& plan) {
+    table_id_set_t tableIDs;
+    if (!collectTableIDs(plan.getLastOperatorRef(), tableIDs)) {
+        return std::nullopt;
+    }
+    return std::vector<table_id_t>{tableIDs.begin(), tableIDs.end()};
+}
+
+std::shared_ptr<const QueryResultCache::Entry> QueryResultCache::lookup(const std::string& key,
+    transaction::TransactionManager& transactionManager) {
+    std::unique_lock lck{mtx};
+    auto it = entryMap.find(key);
+    if (it == entryMap.end()) {
+        return nullptr;
+    }
+    auto entry = it->second->second;
+    if (transactionManager.hasCommitsSince(entry->timestamp, entry->tableIDs)) {
+        eraseNoLock(it->second);
+        return nullptr;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    return entry;
+}
+
+void QueryResultCache::insert(const std::string& key, std::shared_ptr<const Entry> entry) {
+    if (entry->memoryUsage > capacity / MAX_ENTRY_FRACTION) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (const auto it = entryMap.find(key); it != entryMap.end()) {
+        eraseNoLock(it->second);
+    }
+    while (!entries.empty() && memoryUsage + entry->memoryUsage > capacity) {
+        eraseNoLock(std::prev(entries.end()));
+    }
+    memoryUsage += entry->memoryUsage;
+    entries.emplace_front(key, std::move(entry));
+    // The key views the string owned by the list entry, which doesn't move.
+    entryMap.emplace(entries.front().first, entries.begin());
+}
+
+void QueryResultCache::clear() {
+    std::unique_lock lck{mtx};
+    entryMap.clear();
+    entries.clear();
+    memoryUsage = 0;
+}
+
+void QueryResultCache::eraseNoLock(
+    std::list<std::pair<std::string, std::shared_ptr<const Entry>>>::iterator it) {
+    memoryUsage -= it->second->memoryUsage;
+    entryMap.erase(it->first);
+    entries.erase(it);
+}
+
+} // namespace main
+} // namespace ryu
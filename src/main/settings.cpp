@@ -1,6 +1,8 @@
 #include "main/settings.h"
 
+#include "common/constants.h"
 #include "common/exception/runtime.h"
+#include "common/string_format.h"
 #include "common/task_system/progress_bar.h"
 #include "main/client_context.h"
 #include "main/db_config.h"
@@ -68,6 +70,19 @@ common::Value SparseFrontierThresholdSetting::getSetting(const ClientContext* co
     return common::Value(context->getClientConfig()->sparseFrontierThreshold);
 }
 
+void WSPDeltaSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto delta = parameter.getValue<double>();
+    if (delta < 0) {
+        throw common::RuntimeException("Delta of weighted shortest paths must be non-negative.");
+    }
+    context->getClientConfigUnsafe()->wspDelta = delta;
+}
+
+common::Value WSPDeltaSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->wspDelta);
+}
+
 void EnableSemiMaskSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getClientConfigUnsafe()->enableSemiMask = parameter.getValue<bool>();
@@ -159,6 +174,28 @@ common::Value CheckpointThresholdSetting::getSetting(const ClientContext* contex
     return common::Value(context->getDBConfig()->checkpointThreshold);
 }
 
+void GroupCommitSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getDBConfigUnsafe()->enableGroupCommit = parameter.getValue<bool>();
+}
+
+common::Value GroupCommitSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getDBConfig()->enableGroupCommit);
+}
+
+void GroupCommitDelaySetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto delay = parameter.getValue<int64_t>();
+    if (delay < 0) {
+        throw common::RuntimeException("Group commit delay must be non-negative.");
+    }
+    context->getDBConfigUnsafe()->groupCommitDelayInMicros = delay;
+}
+
+common::Value GroupCommitDelaySetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getDBConfig()->groupCommitDelayInMicros);
+}
+
 void AutoCheckpointSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getDBConfigUnsafe()->autoCheckpoint = parameter.getValue<bool>();
@@ -168,6 +205,16 @@ common::Value AutoCheckpointSetting::getSetting(const ClientContext* context) {
     return common::Value(context->getDBConfig()->autoCheckpoint);
 }
 
+void DeferAutoCheckpointSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getDBConfigUnsafe()->deferAutoCheckpoint = parameter.getValue<bool>();
+}
+
+common::Value DeferAutoCheckpointSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getDBConfig()->deferAutoCheckpoint);
+}
+
 void ForceCheckpointClosingDBSetting::setContext(ClientContext* context,
     const common::Value& parameter) {
     parameter.validateType(inputType);
@@ -197,6 +244,16 @@ common::Value EnableInternalCatalogSetting::getSetting(const ClientContext* cont
     return common::Value::createValue(context->getClientConfig()->enableInternalCatalog);
 }
 
+void EnableAdaptiveJoinOrderSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enableAdaptiveJoinOrder = parameter.getValue<bool>();
+}
+
+common::Value EnableAdaptiveJoinOrderSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->enableAdaptiveJoinOrder);
+}
+
 void SpillToDiskSetting::setContext(ClientContext* context, const common::Value& parameter) {
     parameter.validateType(inputType);
     context->getDBConfigUnsafe()->enableSpillingToDisk = parameter.getValue<bool>();
@@ -223,5 +280,98 @@ common::Value SpillToDiskSetting::getSetting(const ClientContext* context) {
     return common::Value::createValue(context->getDBConfig()->enableSpillingToDisk);
 }
 
+void SortStringPrefixLengthSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto length = parameter.getValue<int64_t>();
+    if (length <= 0 || length > (int64_t)common::OrderByConstants::MAX_STRING_PREFIX_LENGTH) {
+        throw common::RuntimeException(
+            common::stringFormat("Sort string prefix length must be between 1 and {}.",
+                common::OrderByConstants::MAX_STRING_PREFIX_LENGTH));
+    }
+    context->getClientConfigUnsafe()->sortStringPrefixLength = length;
+}
+
+common::Value SortStringPrefixLengthSetting::getSetting(const ClientContext* context) {
+    return common::Value((int64_t)context->getClientConfig()->sortStringPrefixLength);
+}
+
+void EnableHardwareCountersSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enableHardwareCounters = parameter.getValue<bool>();
+}
+
+common::Value EnableHardwareCountersSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->enableHardwareCounters);
+}
+
+void QueryTracePathSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->queryTracePath = parameter.getValue<std::string>();
+}
+
+common::Value QueryTracePathSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->queryTracePath);
+}
+
+void SlowQueryLogPathSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->slowQueryLogPath = parameter.getValue<std::string>();
+}
+
+common::Value SlowQueryLogPathSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->slowQueryLogPath);
+}
+
+void SlowQueryThresholdSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->slowQueryThresholdInMS = parameter.getValue<uint64_t>();
+}
+
+common::Value SlowQueryThresholdSetting::getSetting(const ClientContext* context) {
+    return common::Value(context->getClientConfig()->slowQueryThresholdInMS);
+}
+
+void AutoAnalyzeSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->autoAnalyze = parameter.getValue<bool>();
+}
+
+common::Value AutoAnalyzeSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->autoAnalyze);
+}
+
+void EnableQueryResultCacheSetting::setContext(ClientContext* context,
+    const common::Value& parameter) {
+    parameter.validateType(inputType);
+    context->getClientConfigUnsafe()->enableQueryResultCache = parameter.getValue<bool>();
+}
+
+common::Value EnableQueryResultCacheSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getClientConfig()->enableQueryResultCache);
+}
+
+void ColdStoragePathSetting::setContext(ClientContext* context, const common::Value& parameter) {
+    parameter.validateType(inputType);
+    const auto path = parameter.getValue<std::string>();
+    if (!path.empty()) {
+        if (context->isInMemory()) {
+            throw common::RuntimeException(
+                "Cannot set cold_storage_path for an in-memory database!");
+        }
+        if (context->getDBConfig()->readOnly) {
+            throw common::RuntimeException(
+                "Cannot set cold_storage_path for a read only database!");
+        }
+    }
+    context->getDBConfigUnsafe()->coldStoragePath = path;
+}
+
+common::Value ColdStoragePathSetting::getSetting(const ClientContext* context) {
+    return common::Value::createValue(context->getDBConfig()->coldStoragePath);
+}
+
 } // namespace main
 } // namespace ryu
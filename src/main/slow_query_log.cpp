@@ -0,0 +1,90 @@
+#include "main/slow_query_log.h"
+
+#include <algorithm>
+
+#include "common/file_system/virtual_file_system.h"
+#include "common/profiler.h"
+#include "common/types/timestamp_t.h"
+#include "common/types/value/value.h"
+#include "json.hpp"
+#include "main/plan_printer.h"
+#include "processor/physical_plan.h"
+
+using namespace ryu::common;
+using namespace ryu::processor;
+
+namespace ryu {
+namespace main {
+
+struct SlowQueryTotals {
+    uint64_t bytesRead = 0;
+    uint64_t pageMisses = 0;
+    // Largest factor by which the estimated cardinality of an operator is off from its actual one.
+    double maxCardinalityError = 1;
+};
+
+static uint64_t getAttribute(const nlohmann::json& op, const char* key) {
+    return op.contains(key) ? std::stoull(op[key].get<std::string>()) : 0;
+}
+
+static void collectTotals(const nlohmann::json& op, SlowQueryTotals& totals) {
+    totals.bytesRead += getAttribute(op, "BytesRead");
+    totals.pageMisses += getAttribute(op, "PageMisses");
+    if (op.contains("EstimatedCardinality") && op.contains("NumOutputTuples")) {
+        const auto estimated = std::max<double>(op["EstimatedCardinality"].get<uint64_t>(), 1);
+        const auto actual = std::max<double>(getAttribute(op, "NumOutputTuples"), 1);
+        totals.maxCardinalityError = std::max(totals.maxCardinalityError,
+            std::max(estimated, actual) / std::min(estimated, actual));
+    }
+    for (auto i = 0u; op.contains("Child" + std::to_string(i)); i++) {
+        collectTotals(op["Child" + std::to_string(i)], totals);
+    }
+}
+
+std::string SlowQueryLog::createEntry(const SlowQueryInfo& info,
+    const PhysicalPlan& physicalPlan, Profiler& profiler) {
+    auto entry = nlohmann::json();
+    entry["Timestamp"] = Timestamp::toString(Timestamp::getCurrentTimestamp());
+    entry["Query"] = info.query;
+    auto parameters = nlohmann::json::object();
+    if (info.parameters != nullptr) {
+        for (auto& [name, value] : *info.parameters) {
+            parameters[name] = value->toString();
+        }
+    }
+    entry["Parameters"] = std::move(parameters);
+    entry["CompilingTime"] = info.compilingTimeInMS;
+    entry["ExecutionTime"] = info.executionTimeInMS;
+    entry["PeakMemory"] = info.peakMemory;
+    auto plan = PlanPrinter::printPlanToJson(&physicalPlan, &profiler);
+    SlowQueryTotals totals;
+    collectTotals(plan, totals);
+    entry["BytesRead"] = totals.bytesRead;
+    entry["PageMisses"] = totals.pageMisses;
+    entry["MaxCardinalityError"] = totals.maxCardinalityError;
+    entry["Plan"] = std::move(plan);
+    return entry.dump();
+}
+
+void SlowQueryLog::append(const std::string& path, const std::string& entry,
+    ClientContext* context) {
+    const auto line = entry + "\n";
+    const auto vfs = VirtualFileSystem::GetUnsafe(*context);
+    std::unique_lock lck{mtx};
+    auto fileInfo = vfs->openFile(path,
+        FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_IF_NOT_EXISTS), context);
+    auto fileSize = fileInfo->getFileSize();
+    if (fileSize > 0 && fileSize + line.size() > MAX_FILE_SIZE) {
+        fileInfo.reset();
+        const auto rotatedPath = path + ".1";
+        vfs->removeFileIfExists(rotatedPath, context);
+        vfs->copyFile(path, rotatedPath);
+        fileInfo = vfs->openFile(path,
+            FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS), context);
+        fileSize = 0;
+    }
+    fileInfo->writeFile(reinterpret_cast<const uint8_t*>(line.data()), line.size(), fileSize);
+}
+
+} // namespace main
+} // namespace ryu
@@ -278,7 +278,8 @@ static bool isBuildSideQualified(LogicalOperator* buildRoot) {
 
 static bool tryBuildToProbeHJSIP(LogicalOperator* op) {
     auto& hashJoin = op->cast<LogicalHashJoin>();
-    if (hashJoin.getJoinType() != JoinType::INNER) {
+    // Probe tuples without a match are dropped by inner and semi joins only.
+    if (hashJoin.getJoinType() != JoinType::INNER && hashJoin.getJoinType() != JoinType::SEMI) {
         return false;
     }
     if (hashJoin.getSIPInfo().direction != SIPDirection::FORCE_BUILD_TO_PROBE &&
@@ -1,9 +1,11 @@
 #include "optimizer/agg_key_dependency_optimizer.h"
 
+#include "binder/expression/aggregate_function_expression.h"
 #include "binder/expression/expression_util.h"
 #include "binder/expression/property_expression.h"
 #include "planner/operator/logical_aggregate.h"
 #include "planner/operator/logical_distinct.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
 
 using namespace ryu::binder;
 using namespace ryu::common;
@@ -24,11 +26,67 @@ void AggKeyDependencyOptimizer::visitOperator(planner::LogicalOperator* op) {
     visitOperatorSwitch(op);
 }
 
+// Returns true if the tuples of each node ID come from a scan of that node in the same pipeline,
+// passing only through operators that neither reorder nor materialize tuples.
+static bool isNodeIDClustered(const Expression& nodeID, LogicalOperator* op) {
+    while (true) {
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::SCAN_NODE_TABLE: {
+            auto& scan = op->constCast<LogicalScanNodeTable>();
+            return scan.getNodeID()->getUniqueName() == nodeID.getUniqueName() &&
+                   (scan.getScanType() == LogicalScanNodeTableType::SCAN ||
+                       scan.getScanType() == LogicalScanNodeTableType::PRIMARY_KEY_SCAN);
+        }
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::FILTER:
+        case LogicalOperatorType::NODE_LABEL_FILTER:
+        case LogicalOperatorType::PROJECTION:
+        case LogicalOperatorType::SEMI_MASKER:
+        case LogicalOperatorType::EXTEND:
+        case LogicalOperatorType::INTERSECT:
+        case LogicalOperatorType::CROSS_PRODUCT: {
+            // Follow the probe side, which is the only child in the same pipeline. Hash joins are
+            // not followed, since a partitioned join defers part of its probe side to the end.
+            auto child = op->getChild(0).get();
+            if (!child->getSchema()->isExpressionInScope(nodeID)) {
+                // The node is produced by this operator rather than scanned.
+                return false;
+            }
+            op = child;
+        } break;
+        default:
+            return false;
+        }
+    }
+}
+
+static bool areKeysClustered(const LogicalAggregate& agg) {
+    auto keys = agg.getKeys();
+    if (keys.size() != 1 || keys[0]->expressionType != ExpressionType::PROPERTY ||
+        !keys[0]->constCast<PropertyExpression>().isInternalID()) {
+        return false;
+    }
+    for (auto& aggregate : agg.getAggregates()) {
+        if (aggregate->constCast<AggregateFunctionExpression>().isDistinct()) {
+            return false;
+        }
+    }
+    // Each input tuple must hold a single group.
+    auto childSchema = agg.getChild(0)->getSchema();
+    for (auto& key : agg.getAllKeys()) {
+        if (!childSchema->getGroup(key)->isFlat()) {
+            return false;
+        }
+    }
+    return isNodeIDClustered(*keys[0], agg.getChild(0).get());
+}
+
 void AggKeyDependencyOptimizer::visitAggregate(planner::LogicalOperator* op) {
     auto agg = (LogicalAggregate*)op;
     auto [keys, dependentKeys] = resolveKeysAndDependentKeys(agg->getKeys());
     agg->setKeys(keys);
     agg->setDependentKeys(dependentKeys);
+    agg->setKeysClustered(areKeysClustered(*agg));
 }
 
 void AggKeyDependencyOptimizer::visitDistinct(planner::LogicalOperator* op) {
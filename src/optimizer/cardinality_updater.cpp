@@ -90,8 +90,17 @@ void CardinalityUpdater::visitExtend(planner::LogicalOperator* op) {
 void CardinalityUpdater::visitHashJoin(planner::LogicalOperator* op) {
     auto& hashJoin = op->cast<planner::LogicalHashJoin&>();
     KU_ASSERT(hashJoin.getNumChildren() >= 2);
-    hashJoin.setCardinality(cardinalityEstimator.estimateHashJoin(hashJoin.getJoinConditions(),
-        *hashJoin.getChild(0), *hashJoin.getChild(1)));
+    auto cardinality = cardinalityEstimator.estimateHashJoin(hashJoin.getJoinConditions(),
+        *hashJoin.getChild(0), *hashJoin.getChild(1));
+    switch (hashJoin.getJoinType()) {
+    case common::JoinType::SEMI:
+    case common::JoinType::ANTI: {
+        cardinality = std::min(cardinality, hashJoin.getChild(0)->getCardinality());
+    } break;
+    default:
+        break;
+    }
+    hashJoin.setCardinality(cardinality);
 }
 
 void CardinalityUpdater::visitCrossProduct(planner::LogicalOperator* op) {
@@ -1,15 +1,24 @@
 #include "optimizer/filter_push_down_optimizer.h"
 
 #include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
 #include "binder/expression/property_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/property_index_catalog_entry.h"
+#include "function/internal_id/vector_internal_id_functions.h"
+#include "function/list/vector_list_functions.h"
 #include "main/client_context.h"
 #include "planner/operator/extend/logical_extend.h"
 #include "planner/operator/logical_empty_result.h"
 #include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_table_function_call.h"
+#include "planner/operator/logical_unwind.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
+#include "storage/storage_manager.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
 
 using namespace ryu::binder;
 using namespace ryu::common;
@@ -75,6 +84,79 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitFilterReplace(
     return visitOperator(filter.getChild(0));
 }
 
+static bool isConstantExpression(const std::shared_ptr<Expression> expression) {
+    switch (expression->expressionType) {
+    case ExpressionType::LITERAL:
+    case ExpressionType::PARAMETER: {
+        return true;
+    }
+    // TODO(Xiyang): fold parameter expression in binder.
+    case ExpressionType::FUNCTION: {
+        auto& func = expression->constCast<ScalarFunctionExpression>();
+        if (func.getFunction().name == "CAST") {
+            return isConstantExpression(func.getChild(0));
+        } else {
+            return false;
+        }
+    }
+    default:
+        return false;
+    }
+}
+
+static const LogicalUnwind* findUnwind(const LogicalOperator& op, const Expression& outExpr) {
+    if (op.getOperatorType() == LogicalOperatorType::UNWIND) {
+        auto& unwind = op.constCast<LogicalUnwind>();
+        if (unwind.getOutExpr()->getUniqueName() == outExpr.getUniqueName()) {
+            return &unwind;
+        }
+    }
+    for (auto i = 0u; i < op.getNumChildren(); i++) {
+        if (auto unwind = findUnwind(*op.getChild(i), outExpr)) {
+            return unwind;
+        }
+    }
+    return nullptr;
+}
+
+// E.g. UNWIND $keys AS k MATCH (n:Item {id: k}). If one side of the join only scans the nodes of n
+// and the other side unwinds a constant list into the primary key it is joined with, only the
+// nodes of the keys in the list can join. The scan is then turned into a primary key scan of the
+// list, which looks up all keys at once and scans the found nodes in offset order.
+static void tryScanUnwoundPrimaryKeys(LogicalOperator& scanSide, const Expression& scanKey,
+    const LogicalOperator& unwindSide, const Expression& unwindKey) {
+    std::vector<LogicalOperator*> filters;
+    auto op = &scanSide;
+    while (op->getOperatorType() == LogicalOperatorType::FILTER) {
+        filters.push_back(op);
+        op = op->getChild(0).get();
+    }
+    if (op->getOperatorType() != LogicalOperatorType::SCAN_NODE_TABLE ||
+        scanKey.expressionType != ExpressionType::PROPERTY) {
+        return;
+    }
+    auto& scan = op->cast<LogicalScanNodeTable>();
+    auto& property = scanKey.constCast<PropertyExpression>();
+    if (scan.getScanType() != LogicalScanNodeTableType::SCAN || scan.getTableIDs().size() != 1 ||
+        !property.isPrimaryKey() ||
+        property.getVariableName() !=
+            scan.getNodeID()->constCast<PropertyExpression>().getVariableName()) {
+        return;
+    }
+    auto unwind = findUnwind(unwindSide, unwindKey);
+    if (unwind == nullptr || !isConstantExpression(unwind->getInExpr()) ||
+        unwind->getOutExpr()->getDataType() != scanKey.getDataType()) {
+        return;
+    }
+    scan.setScanType(LogicalScanNodeTableType::PRIMARY_KEY_SCAN);
+    scan.setExtraInfo(
+        std::make_unique<PrimaryKeyScanInfo>(unwind->getInExpr(), true /* isKeyList */));
+    scan.computeFlatSchema();
+    for (auto it = filters.rbegin(); it != filters.rend(); ++it) {
+        (*it)->computeFlatSchema();
+    }
+}
+
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto remainingPSet = PredicateSet();
@@ -121,6 +203,10 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
     if (joinConditions.empty()) { // Nothing to push down. Terminate.
         return finishPushDown(op);
     }
+    for (auto& [probeKey, buildKey] : joinConditions) {
+        tryScanUnwoundPrimaryKeys(*op->getChild(0), *probeKey, *op->getChild(1), *buildKey);
+        tryScanUnwoundPrimaryKeys(*op->getChild(1), *buildKey, *op->getChild(0), *probeKey);
+    }
     auto hashJoin = std::make_shared<LogicalHashJoin>(joinConditions, JoinType::INNER,
         nullptr /* mark */, op->getChild(0), op->getChild(1), 0 /* cardinality */);
     // For non-id based joins, we disable side way information passing.
@@ -136,10 +222,11 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitCrossProductRepla
 }
 
 static ColumnPredicateSet getPredicateSet(const Expression& column,
-    const binder::expression_vector& predicates) {
+    const binder::expression_vector& predicates, bool allowStringPrefix) {
     auto predicateSet = ColumnPredicateSet();
     for (auto& predicate : predicates) {
-        auto columnPredicate = ColumnPredicateUtil::tryConvert(column, *predicate);
+        auto columnPredicate =
+            ColumnPredicateUtil::tryConvert(column, *predicate, allowStringPrefix);
         if (columnPredicate == nullptr) {
             continue;
         }
@@ -149,31 +236,115 @@ static ColumnPredicateSet getPredicateSet(const Expression& column,
 }
 
 static std::vector<ColumnPredicateSet> getColumnPredicateSets(const expression_vector& columns,
-    const expression_vector& predicates) {
+    const expression_vector& predicates, bool allowStringPrefix = true) {
     std::vector<ColumnPredicateSet> predicateSets;
     for (auto& column : columns) {
-        predicateSets.push_back(getPredicateSet(*column, predicates));
+        predicateSets.push_back(getPredicateSet(*column, predicates, allowStringPrefix));
     }
     return predicateSets;
 }
 
-static bool isConstantExpression(const std::shared_ptr<Expression> expression) {
-    switch (expression->expressionType) {
-    case ExpressionType::LITERAL:
-    case ExpressionType::PARAMETER: {
-        return true;
+// The candidates of a property index scan are read through a semi mask, which has to be filled
+// from the index and still visits every node group of the table. The rewrite is only worth it
+// for tables of at least this many rows,
+static constexpr cardinality_t PROPERTY_INDEX_SCAN_MIN_NUM_ROWS = DEFAULT_VECTOR_CAPACITY;
+// and if a key is expected to match at most this share of them, i.e. the property has at least
+// 1 / PROPERTY_INDEX_SCAN_MAX_SELECTIVITY distinct values.
+static constexpr double PROPERTY_INDEX_SCAN_MAX_SELECTIVITY = 0.01;
+
+static bool isPropertyIndexScanSelective(main::ClientContext* context, table_id_t tableID,
+    column_id_t columnID) {
+    const auto stats = storage::StorageManager::Get(*context)
+                           ->getTable(tableID)
+                           ->cast<storage::NodeTable>()
+                           .getStats(transaction::Transaction::Get(*context));
+    if (stats.getTableCard() < PROPERTY_INDEX_SCAN_MIN_NUM_ROWS) {
+        return false;
     }
-    // TODO(Xiyang): fold parameter expression in binder.
-    case ExpressionType::FUNCTION: {
-        auto& func = expression->constCast<ScalarFunctionExpression>();
-        if (func.getFunction().name == "CAST") {
-            return isConstantExpression(func.getChild(0));
-        } else {
-            return false;
+    return stats.getNumDistinctValues(columnID) * PROPERTY_INDEX_SCAN_MAX_SELECTIVITY >= 1;
+}
+
+// Rewrites the scan to read only the rows a property index returns, if one of the equality
+// predicates compares an indexed property of the scanned node with a constant and is selective
+// enough. The predicate is kept, since the index only returns candidates.
+static void tryRewritePropertyIndexScan(main::ClientContext* context, LogicalScanNodeTable& scan,
+    const expression_vector& equalityPredicates) {
+    KU_ASSERT(scan.getTableIDs().size() == 1);
+    const auto tableID = scan.getTableIDs()[0];
+    const auto catalog = catalog::Catalog::Get(*context);
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto indexEntries = catalog->getIndexEntries(transaction, tableID);
+    if (indexEntries.empty()) {
+        return;
+    }
+    const auto tableEntry = catalog->getTableCatalogEntry(transaction, tableID);
+    const auto& variableName = scan.getNodeID()->constCast<PropertyExpression>().getVariableName();
+    for (auto& predicate : equalityPredicates) {
+        for (auto i = 0u; i < 2; i++) {
+            auto property = predicate->getChild(i);
+            auto key = predicate->getChild(1 - i);
+            if (property->expressionType != ExpressionType::PROPERTY ||
+                !isConstantExpression(key)) {
+                continue;
+            }
+            auto& propertyExpr = property->constCast<PropertyExpression>();
+            if (propertyExpr.getVariableName() != variableName ||
+                !propertyExpr.hasProperty(tableID)) {
+                continue;
+            }
+            const auto propertyID = tableEntry->getPropertyID(propertyExpr.getPropertyName());
+            const auto columnID = tableEntry->getColumnID(propertyExpr.getPropertyName());
+            for (const auto indexEntry : indexEntries) {
+                if (indexEntry->getIndexType() == catalog::PropertyIndexCatalogEntry::TYPE_NAME &&
+                    indexEntry->containsPropertyID(propertyID) &&
+                    isPropertyIndexScanSelective(context, tableID, columnID)) {
+                    scan.setScanType(LogicalScanNodeTableType::PROPERTY_INDEX_SCAN);
+                    scan.setExtraInfo(
+                        std::make_unique<PropertyIndexScanInfo>(indexEntry->getIndexName(), key));
+                    return;
+                }
+            }
         }
     }
+}
+
+static std::optional<int64_t> tryGetInt64Value(const Expression& expression) {
+    auto value = Value::createNullValue();
+    switch (expression.expressionType) {
+    case ExpressionType::LITERAL: {
+        value = expression.constCast<LiteralExpression>().getValue();
+    } break;
+    case ExpressionType::PARAMETER: {
+        value = expression.constCast<ParameterExpression>().getValue();
+    } break;
     default:
-        return false;
+        return std::nullopt;
+    }
+    if (value.isNull() || value.getDataType().getLogicalTypeID() != LogicalTypeID::INT64) {
+        return std::nullopt;
+    }
+    return value.getValue<int64_t>();
+}
+
+// Restricts the scan to the committed node groups of a partition, if a predicate checks that the
+// scanned node is in it. The predicate is kept for the nodes of uncommitted node groups.
+static void tryPartitionScan(LogicalScanNodeTable& scan, const expression_vector& predicates) {
+    for (auto& predicate : predicates) {
+        if (predicate->expressionType != ExpressionType::FUNCTION ||
+            predicate->constCast<ScalarFunctionExpression>().getFunction().name !=
+                function::NodeGroupPartitionFunction::name ||
+            *predicate->getChild(0) != *scan.getNodeID()) {
+            continue;
+        }
+        const auto partitionIdx = tryGetInt64Value(*predicate->getChild(1));
+        const auto numPartitions = tryGetInt64Value(*predicate->getChild(2));
+        // Invalid partitions are reported when the predicate is evaluated.
+        if (!partitionIdx || !numPartitions || *numPartitions <= 0 || *partitionIdx < 0 ||
+            *partitionIdx >= *numPartitions) {
+            continue;
+        }
+        scan.setNodeGroupPartition(*partitionIdx, *numPartitions);
+        return;
     }
 }
 
@@ -203,6 +374,19 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
             // Cannot rewrite and add predicate back.
             predicateSet.addPredicate(primaryKeyEqualityComparison);
         }
+    } else if (tableIDs.size() == 1) {
+        if (auto primaryKeyInList = predicateSet.popNodePKInListComparison(*nodeID)) {
+            scan.setScanType(LogicalScanNodeTableType::PRIMARY_KEY_SCAN);
+            scan.setExtraInfo(std::make_unique<PrimaryKeyScanInfo>(primaryKeyInList->getChild(0),
+                true /* isKeyList */));
+            scan.computeFlatSchema();
+        }
+    }
+    if (tableIDs.size() == 1 && scan.getScanType() == LogicalScanNodeTableType::SCAN) {
+        tryRewritePropertyIndexScan(context, scan, predicateSet.equalityPredicates);
+    }
+    if (scan.getScanType() == LogicalScanNodeTableType::SCAN) {
+        tryPartitionScan(scan, predicateSet.getAllPredicates());
     }
     return finishPushDown(op);
 }
@@ -210,8 +394,9 @@ std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitScanNodeTableRepl
 std::shared_ptr<LogicalOperator> FilterPushDownOptimizer::visitTableFunctionCallReplace(
     const std::shared_ptr<LogicalOperator>& op) {
     auto& tableFunctionCall = op->cast<LogicalTableFunctionCall>();
+    // Table functions may render the predicates into the SQL of an external database.
     auto columnPredicates = getColumnPredicateSets(tableFunctionCall.getBindData()->columns,
-        predicateSet.getAllPredicates());
+        predicateSet.getAllPredicates(), false /* allowStringPrefix */);
     tableFunctionCall.setColumnPredicates(std::move(columnPredicates));
     return finishPushDown(op);
 }
@@ -321,6 +506,27 @@ std::shared_ptr<Expression> PredicateSet::popNodePKEqualityComparison(const Expr
     return nullptr;
 }
 
+std::shared_ptr<Expression> PredicateSet::popNodePKInListComparison(const Expression& nodeID) {
+    for (auto i = 0u; i < nonEqualityPredicates.size(); ++i) {
+        auto predicate = nonEqualityPredicates[i];
+        if (predicate->expressionType != ExpressionType::FUNCTION ||
+            predicate->constCast<ScalarFunctionExpression>().getFunction().name !=
+                function::ListContainsFunction::name) {
+            continue;
+        }
+        auto list = predicate->getChild(0);
+        auto key = predicate->getChild(1);
+        // The keys are looked up in the index as they are, so they must have the type of the key.
+        if (!isNodePrimaryKey(*key, nodeID) || !isConstantExpression(list) ||
+            ListType::getChildType(list->getDataType()) != key->getDataType()) {
+            continue;
+        }
+        nonEqualityPredicates.erase(nonEqualityPredicates.begin() + i);
+        return predicate;
+    }
+    return nullptr;
+}
+
 expression_vector PredicateSet::getAllPredicates() {
     expression_vector result;
     result.insert(result.end(), equalityPredicates.begin(), equalityPredicates.end());
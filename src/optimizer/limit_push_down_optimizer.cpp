@@ -6,6 +6,7 @@
 #include "planner/operator/logical_distinct.h"
 #include "planner/operator/logical_hash_join.h"
 #include "planner/operator/logical_limit.h"
+#include "planner/operator/logical_table_function_call.h"
 
 using namespace ryu::binder;
 using namespace ryu::common;
@@ -69,6 +70,13 @@ void LimitPushDownOptimizer::visitOperator(planner::LogicalOperator* op) {
         }
         return;
     }
+    case LogicalOperatorType::TABLE_FUNCTION_CALL: {
+        if (limitNumber == INVALID_LIMIT) {
+            return;
+        }
+        op->cast<LogicalTableFunctionCall>().setLimitNum(skipNumber + limitNumber);
+        return;
+    }
     case LogicalOperatorType::UNION_ALL: {
         for (auto i = 0u; i < op->getNumChildren(); ++i) {
             auto optimizer = LimitPushDownOptimizer();
@@ -1,6 +1,7 @@
 #include "optimizer/remove_unnecessary_join_optimizer.h"
 
 #include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_projection.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 
 using namespace ryu::common;
@@ -24,32 +25,53 @@ std::shared_ptr<LogicalOperator> RemoveUnnecessaryJoinOptimizer::visitOperator(
     return result;
 }
 
+// A side of a join is trivial if it only produces the IDs of the nodes joined on, i.e. it scans a
+// node table without properties, possibly under projections which only pass expressions through.
+// Since rels only connect existing nodes and the other side already filters the node labels,
+// joining with such a side drops nothing.
+static bool isTrivialSide(const LogicalOperator* op, const LogicalHashJoin& hashJoin) {
+    while (op->getOperatorType() == LogicalOperatorType::PROJECTION) {
+        auto childSchema = op->getChild(0)->getSchema();
+        for (auto& expression : op->constPtrCast<LogicalProjection>()->getExpressionsToProject()) {
+            if (!childSchema->isExpressionInScope(*expression)) {
+                return false;
+            }
+        }
+        op = op->getChild(0).get();
+    }
+    if (op->getOperatorType() != LogicalOperatorType::SCAN_NODE_TABLE) {
+        return false;
+    }
+    auto& scan = op->constCast<LogicalScanNodeTable>();
+    if (scan.getScanType() != LogicalScanNodeTableType::SCAN || !scan.getProperties().empty()) {
+        return false;
+    }
+    auto joinNodeIDs = hashJoin.getJoinNodeIDs();
+    return LogicalHashJoin::isNodeIDOnlyJoin(hashJoin.getJoinConditions()) &&
+           joinNodeIDs.size() == 1 && *joinNodeIDs[0] == *scan.getNodeID();
+}
+
 std::shared_ptr<LogicalOperator> RemoveUnnecessaryJoinOptimizer::visitHashJoinReplace(
     std::shared_ptr<LogicalOperator> op) {
     auto hashJoin = (LogicalHashJoin*)op.get();
     switch (hashJoin->getJoinType()) {
     case JoinType::MARK:
-    case JoinType::LEFT: {
+    case JoinType::LEFT:
+    case JoinType::SEMI:
+    case JoinType::ANTI: {
         // Do not prune no-trivial join type
         return op;
     }
     default:
         break;
     }
-    // TODO(Xiyang): Double check on these changes here.
-    if (op->getChild(1)->getOperatorType() == LogicalOperatorType::SCAN_NODE_TABLE) {
-        const auto scanNode = ku_dynamic_cast<LogicalScanNodeTable*>(op->getChild(1).get());
-        if (scanNode->getProperties().empty()) {
-            // Build side is trivial. Prune build side.
-            return op->getChild(0);
-        }
+    if (isTrivialSide(op->getChild(1).get(), *hashJoin)) {
+        // Build side is trivial. Prune build side.
+        return op->getChild(0);
     }
-    if (op->getChild(0)->getOperatorType() == LogicalOperatorType::SCAN_NODE_TABLE) {
-        const auto scanNode = ku_dynamic_cast<LogicalScanNodeTable*>(op->getChild(0).get());
-        if (scanNode->getProperties().empty()) {
-            // Probe side is trivial. Prune probe side.
-            return op->getChild(1);
-        }
+    if (isTrivialSide(op->getChild(0).get(), *hashJoin)) {
+        // Probe side is trivial. Prune probe side.
+        return op->getChild(1);
     }
     return op;
 }
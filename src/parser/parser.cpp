@@ -1,5 +1,8 @@
 #include "parser/parser.h"
 
+#include <atomic>
+#include <mutex>
+
 // ANTLR4 generates code with unused parameters.
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -50,5 +53,37 @@ std::vector<std::shared_ptr<Statement>> Parser::parseQuery(std::string_view quer
     return transformer.transform();
 }
 
+static std::atomic<bool> warmedUp{false};
+
+void Parser::warmUp() {
+    static std::once_flag warmUpFlag;
+    std::call_once(warmUpFlag, [] {
+        static constexpr const char* queries[] = {
+            "MATCH (a:A)-[e:E]->(b:B) WHERE a.id = $id AND b.x > 1 RETURN a.name, count(*) AS c "
+            "ORDER BY c DESC LIMIT 10;",
+            "MATCH (a:A {id: 1}) WITH a, a.x + 1 AS y UNWIND [1, 2] AS z RETURN DISTINCT y, z;",
+            "OPTIONAL MATCH (a:A)-[:E*1..2]-(b) RETURN a, b SKIP 1;",
+            "CREATE (a:A {id: 1, name: 'a'});",
+            "MATCH (a:A), (b:B) WHERE a.id = 1 AND b.id = 2 CREATE (a)-[:E {w: 1.5}]->(b);",
+            "MERGE (a:A {id: $id}) ON CREATE SET a.x = 1 ON MATCH SET a.x = a.x + 1;",
+            "MATCH (a:A) WHERE a.id IN [1, 2] SET a.name = 'b' RETURN a;",
+            "MATCH (a:A) WHERE a.id = 1 DETACH DELETE a;",
+            "CALL show_tables() RETURN *;",
+        };
+        for (auto query : queries) {
+            try {
+                parseQuery(query);
+            } catch (common::Exception&) { // LCOV_EXCL_START
+                // Warming up is best effort.
+            } // LCOV_EXCL_STOP
+        }
+        warmedUp = true;
+    });
+}
+
+bool Parser::isWarmedUp() {
+    return warmedUp;
+}
+
 } // namespace parser
 } // namespace ryu
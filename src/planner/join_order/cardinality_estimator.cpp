@@ -1,6 +1,8 @@
 #include "planner/join_order/cardinality_estimator.h"
 
+#include "binder/expression/literal_expression.h"
 #include "binder/expression/property_expression.h"
+#include "common/type_utils.h"
 #include "main/client_context.h"
 #include "planner/join_order/join_order_util.h"
 #include "planner/operator/logical_aggregate.h"
@@ -150,41 +152,145 @@ static bool isSingleLabelledProperty(const Expression& expression) {
     return expression.constCast<PropertyExpression>().isSingleLabel();
 }
 
-static std::optional<cardinality_t> getTableStatsIfPossible(main::ClientContext* context,
-    const Expression& predicate,
-    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
-    KU_ASSERT(predicate.getNumChildren() >= 1);
-    if (isSingleLabelledProperty(*predicate.getChild(0))) {
-        auto& propertyExpr = predicate.getChild(0)->cast<PropertyExpression>();
+static const storage::TableStats* getTableStatsIfPossible(main::ClientContext* context,
+    const Expression& expression,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats,
+    column_id_t& columnID) {
+    if (isSingleLabelledProperty(expression)) {
+        auto& propertyExpr = expression.constCast<PropertyExpression>();
         auto tableID = propertyExpr.getSingleTableID();
         if (nodeTableStats.contains(tableID) && propertyExpr.hasProperty(tableID)) {
             auto transaction = Transaction::Get(*context);
             auto entry =
                 catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction, tableID);
-            auto columnID = entry->getColumnID(propertyExpr.getPropertyName());
+            columnID = entry->getColumnID(propertyExpr.getPropertyName());
             if (columnID != INVALID_COLUMN_ID && columnID != ROW_IDX_COLUMN_ID) {
-                auto& stats = nodeTableStats.at(tableID);
-                return atLeastOne(stats.getNumDistinctValues(columnID));
+                return &nodeTableStats.at(tableID);
             }
         }
     }
-    return {};
+    return nullptr;
+}
+
+static std::optional<cardinality_t> getNumDistinctValuesIfPossible(main::ClientContext* context,
+    const Expression& predicate,
+    const std::unordered_map<common::table_id_t, storage::TableStats>& nodeTableStats) {
+    KU_ASSERT(predicate.getNumChildren() >= 1);
+    column_id_t columnID = INVALID_COLUMN_ID;
+    const auto stats =
+        getTableStatsIfPossible(context, *predicate.getChild(0), nodeTableStats, columnID);
+    if (stats == nullptr) {
+        return {};
+    }
+    return atLeastOne(stats->getNumDistinctValues(columnID));
+}
+
+// Converts a literal to the domain values of a column of the given type are sampled in.
+static std::optional<double> getSampleDomainValue(const Value& value,
+    const LogicalType& columnType) {
+    if (value.isNull()) {
+        return {};
+    }
+    const auto& valueType = value.getDataType();
+    const auto bothNumerical = LogicalTypeUtils::isNumerical(valueType) &&
+                               LogicalTypeUtils::isNumerical(columnType) &&
+                               valueType.getLogicalTypeID() != LogicalTypeID::DECIMAL;
+    if (!bothNumerical && valueType.getLogicalTypeID() != columnType.getLogicalTypeID()) {
+        return {};
+    }
+    return TypeUtils::visit(valueType, [&]<typename T>(T) -> std::optional<double> {
+        if constexpr (std::is_same_v<T, date_t>) {
+            return value.getValue<T>().days;
+        } else if constexpr (std::is_same_v<T, timestamp_t>) {
+            return value.getValue<T>().value;
+        } else if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+            return static_cast<double>(value.getValue<T>());
+        } else {
+            return std::nullopt;
+        }
+    });
+}
+
+std::optional<double> CardinalityEstimator::estimateSelectivityFromSample(
+    const Expression& predicate) const {
+    if (!ExpressionTypeUtil::isComparison(predicate.expressionType)) {
+        return {};
+    }
+    auto comparison = predicate.expressionType;
+    auto property = predicate.getChild(0);
+    auto literal = predicate.getChild(1);
+    if (property->expressionType == ExpressionType::LITERAL) {
+        std::swap(property, literal);
+        comparison = ExpressionTypeUtil::reverseComparisonDirection(comparison);
+    }
+    if (literal->expressionType != ExpressionType::LITERAL) {
+        return {};
+    }
+    column_id_t columnID = INVALID_COLUMN_ID;
+    const auto stats = getTableStatsIfPossible(context, *property, nodeTableStats, columnID);
+    if (stats == nullptr) {
+        return {};
+    }
+    const auto& columnStats = stats->getColumnStats(columnID);
+    const auto sample = columnStats.getSample();
+    if (sample == nullptr || sample->getNumValues() == 0) {
+        return {};
+    }
+    const auto value = getSampleDomainValue(literal->constCast<LiteralExpression>().getValue(),
+        property->getDataType());
+    if (!value.has_value()) {
+        return {};
+    }
+    const auto histogram = sample->getHistogram();
+    // Comparisons with nulls never evaluate to true.
+    const auto nonNullFraction = std::min(1.0,
+        static_cast<double>(sample->getNumValues()) / atLeastOne(stats->getTableCard()));
+    double selectivity = 0;
+    switch (comparison) {
+    case ExpressionType::EQUALS: {
+        selectivity =
+            histogram.estimateEqualsSelectivity(*value, columnStats.getNumDistinctValues());
+    } break;
+    case ExpressionType::NOT_EQUALS: {
+        selectivity =
+            1 - histogram.estimateEqualsSelectivity(*value, columnStats.getNumDistinctValues());
+    } break;
+    case ExpressionType::LESS_THAN: {
+        selectivity = histogram.estimateLessThanSelectivity(*value, false /* inclusive */);
+    } break;
+    case ExpressionType::LESS_THAN_EQUALS: {
+        selectivity = histogram.estimateLessThanSelectivity(*value, true /* inclusive */);
+    } break;
+    case ExpressionType::GREATER_THAN: {
+        selectivity = 1 - histogram.estimateLessThanSelectivity(*value, true /* inclusive */);
+    } break;
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        selectivity = 1 - histogram.estimateLessThanSelectivity(*value, false /* inclusive */);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+    return std::clamp(selectivity, 0.0, 1.0) * nonNullFraction;
 }
 
 uint64_t CardinalityEstimator::estimateFilter(const LogicalOperator& childPlan,
     const Expression& predicate) const {
+    if (predicate.expressionType == ExpressionType::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
+    }
+    const auto selectivity = estimateSelectivityFromSample(predicate);
+    if (selectivity.has_value()) {
+        return atLeastOne(childPlan.getCardinality() * selectivity.value());
+    }
     if (predicate.expressionType == ExpressionType::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
-        } else {
-            const auto numDistinctValues =
-                getTableStatsIfPossible(context, predicate, nodeTableStats);
-            if (numDistinctValues.has_value()) {
-                return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
-            }
-            return atLeastOne(
-                childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+        const auto numDistinctValues =
+            getNumDistinctValuesIfPossible(context, predicate, nodeTableStats);
+        if (numDistinctValues.has_value()) {
+            return atLeastOne(childPlan.getCardinality() / numDistinctValues.value());
         }
+        return atLeastOne(
+            childPlan.getCardinality() * PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
     } else {
         return atLeastOne(
             childPlan.getCardinality() * PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
@@ -211,6 +317,50 @@ uint64_t CardinalityEstimator::getNumRels(const Transaction* transaction,
     return atLeastOne(numRels);
 }
 
+storage::DegreeStats CardinalityEstimator::getDegreeStats(const RelExpression& rel,
+    const NodeExpression& boundNode) const {
+    std::vector<RelDataDirection> directions;
+    if (rel.getDirectionType() == RelDirectionType::BOTH) {
+        directions = {RelDataDirection::FWD, RelDataDirection::BWD};
+    } else if (boundNode == *rel.getSrcNode()) {
+        directions = {RelDataDirection::FWD};
+    } else {
+        directions = {RelDataDirection::BWD};
+    }
+    storage::DegreeStats result;
+    auto storageManager = storage::StorageManager::Get(*context);
+    for (auto tableID : rel.getInnerRelTableIDs()) {
+        auto& relTable = storageManager->getTable(tableID)->cast<storage::RelTable>();
+        const auto storageDirections = relTable.getStorageDirections();
+        for (auto direction : directions) {
+            if (std::find(storageDirections.begin(), storageDirections.end(), direction) !=
+                storageDirections.end()) {
+                result.merge(relTable.getDirectedTableData(direction)->getDegreeStats());
+            }
+        }
+    }
+    return result;
+}
+
+double CardinalityEstimator::getRecursiveExtensionRate(const RelExpression& rel,
+    const NodeExpression& boundNode, double oneHopExtensionRate) const {
+    const auto numHops = std::max<uint16_t>(rel.getRecursiveInfo()->bindData->upperBound, 1);
+    // Only the first hop starts from the bound nodes. Later hops start from nodes reached through
+    // rels, which are biased towards high degree nodes, so on skewed graphs they fan out more.
+    const auto laterHopRate =
+        std::max(oneHopExtensionRate, getDegreeStats(rel, boundNode).getSizeBiasedDegree());
+    return oneHopExtensionRate + (numHops - 1) * laterHopRate;
+}
+
+cardinality_t CardinalityEstimator::estimateNumReachedNodes(const RelExpression& rel,
+    const NodeExpression& boundNode, cardinality_t numSources,
+    const Transaction* transaction) const {
+    const auto numPathNodes =
+        getNumNodes(transaction, rel.getRecursiveInfo()->node->getTableIDs());
+    return std::min(multiply(getExtensionRate(rel, boundNode, transaction), numSources),
+        numPathNodes);
+}
+
 double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     const NodeExpression& boundNode, const Transaction* transaction) const {
     auto numBoundNodes = static_cast<double>(getNumNodes(transaction, boundNode.getTableIDs()));
@@ -224,8 +374,7 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     case QueryRelType::VARIABLE_LENGTH_WALK:
     case QueryRelType::VARIABLE_LENGTH_TRAIL:
     case QueryRelType::VARIABLE_LENGTH_ACYCLIC: {
-        auto rate = oneHopExtensionRate *
-                    std::max<uint16_t>(rel.getRecursiveInfo()->bindData->upperBound, 1);
+        auto rate = getRecursiveExtensionRate(rel, boundNode, oneHopExtensionRate);
         return rate * context->getClientConfig()->recursivePatternCardinalityScaleFactor;
     }
     case QueryRelType::SHORTEST:
@@ -233,9 +382,7 @@ double CardinalityEstimator::getExtensionRate(const RelExpression& rel,
     case QueryRelType::WEIGHTED_SHORTEST:
     case QueryRelType::ALL_WEIGHTED_SHORTEST: {
         auto rate = std::min<double>(
-            oneHopExtensionRate *
-                std::max<uint16_t>(rel.getRecursiveInfo()->bindData->upperBound, 1),
-            numRels);
+            getRecursiveExtensionRate(rel, boundNode, oneHopExtensionRate), numRels);
         return rate * context->getClientConfig()->recursivePatternCardinalityScaleFactor;
     }
     default:
@@ -0,0 +1,58 @@
+#include "planner/join_order/cardinality_feedback.h"
+
+#include <algorithm>
+
+using namespace ryu::binder;
+using namespace ryu::common;
+
+namespace ryu {
+namespace planner {
+
+std::string CardinalityFeedback::getKey(const QueryGraph& queryGraph,
+    const SubqueryGraph& subgraph) {
+    // Unique names are assigned deterministically by the binder, so the key of a subgraph is the
+    // same each time a statement is planned.
+    std::vector<std::string> names;
+    for (auto i = 0u; i < queryGraph.getNumQueryNodes(); ++i) {
+        if (subgraph.queryNodesSelector[i]) {
+            names.push_back(queryGraph.getQueryNode(i)->getUniqueName());
+        }
+    }
+    for (auto i = 0u; i < queryGraph.getNumQueryRels(); ++i) {
+        if (subgraph.queryRelsSelector[i]) {
+            names.push_back(queryGraph.getQueryRel(i)->getUniqueName());
+        }
+    }
+    std::sort(names.begin(), names.end());
+    std::string key;
+    for (auto& name : names) {
+        key += name;
+        key += ',';
+    }
+    return key;
+}
+
+std::pair<cardinality_t, cardinality_t> CardinalityFeedback::getAcceptedRange(
+    cardinality_t estimated) {
+    const auto estimate = static_cast<double>(estimated);
+    const auto min = estimated < MIN_CARDINALITY_TO_REOPTIMIZE ?
+                         0 :
+                         static_cast<cardinality_t>(estimate / REOPTIMIZATION_RATIO);
+    const auto max = std::max(static_cast<double>(MIN_CARDINALITY_TO_REOPTIMIZE),
+        std::max(estimate, 1.0) * REOPTIMIZATION_RATIO);
+    // Doubles beyond the range of cardinality_t would overflow on conversion.
+    if (max >= static_cast<double>(UINT64_MAX)) {
+        return {min, UINT64_MAX};
+    }
+    return {min, static_cast<cardinality_t>(max)};
+}
+
+std::optional<cardinality_t> CardinalityFeedback::get(const std::string& key) const {
+    if (!observedCardinalities.contains(key)) {
+        return std::nullopt;
+    }
+    return observedCardinalities.at(key);
+}
+
+} // namespace planner
+} // namespace ryu
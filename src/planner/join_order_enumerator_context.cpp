@@ -18,6 +18,17 @@ void JoinOrderEnumeratorContext::init(const QueryGraph* queryGraph_,
     currentLevel = 1;
 }
 
+void JoinOrderEnumeratorContext::addPlan(const SubqueryGraph& subqueryGraph, LogicalPlan plan) {
+    if (cardinalityFeedback != nullptr) {
+        auto cardinality =
+            cardinalityFeedback->get(CardinalityFeedback::getKey(*queryGraph, subqueryGraph));
+        if (cardinality.has_value()) {
+            plan.getLastOperator()->setCardinality(cardinality.value());
+        }
+    }
+    subPlansTable->addPlan(subqueryGraph, std::move(plan));
+}
+
 SubqueryGraph JoinOrderEnumeratorContext::getFullyMatchedSubqueryGraph() const {
     auto subqueryGraph = SubqueryGraph(*queryGraph);
     for (auto i = 0u; i < queryGraph->getNumQueryNodes(); ++i) {
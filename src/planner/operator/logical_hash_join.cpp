@@ -81,6 +81,9 @@ void LogicalHashJoin::computeFactorizedSchema() {
         auto markPos = *probeSideKeyGroupPositions.begin();
         schema->insertToGroupAndScope(mark, markPos);
     } break;
+    case JoinType::SEMI:
+    case JoinType::ANTI:
+        break;
     default:
         KU_UNREACHABLE;
     }
@@ -105,6 +108,9 @@ void LogicalHashJoin::computeFlatSchema() {
     case JoinType::MARK: {
         schema->insertToGroupAndScope(mark, 0);
     } break;
+    case JoinType::SEMI:
+    case JoinType::ANTI:
+        break;
     default:
         KU_UNREACHABLE;
     }
@@ -124,7 +130,9 @@ binder::expression_vector LogicalHashJoin::getExpressionsToMaterialize() const {
     case JoinType::COUNT: {
         return children[1]->getSchema()->getExpressionsInScope();
     }
-    case JoinType::MARK: {
+    case JoinType::MARK:
+    case JoinType::SEMI:
+    case JoinType::ANTI: {
         return binder::expression_vector{};
     }
     default:
@@ -136,6 +144,8 @@ std::unique_ptr<LogicalOperator> LogicalHashJoin::copy() {
     auto op = std::make_unique<LogicalHashJoin>(joinConditions, joinType, mark, children[0]->copy(),
         children[1]->copy(), cardinality);
     op->sipInfo = sipInfo;
+    op->buildSubgraphKey = buildSubgraphKey;
+    op->estimatedBuildCardinality = estimatedBuildCardinality;
     return op;
 }
 
@@ -195,11 +205,19 @@ bool LogicalHashJoin::requireFlatProbeKeys() const {
     if (joinType == JoinType::LEFT || joinType == JoinType::COUNT) {
         return true; // TODO(Guodong): fix this. We shouldn't require flatten.
     }
+    // Flatten for anti join, which keeps the tuples of null keys.
+    if (joinType == JoinType::ANTI) {
+        return true;
+    }
     auto& [probeKey, buildKey] = joinConditions[0];
     // Flatten for non-ID-based join.
     if (probeKey->dataType.getLogicalTypeID() != LogicalTypeID::INTERNAL_ID) {
         return true;
     }
+    // A semi join only needs to find whether a key has a match, not all of its matches.
+    if (joinType == JoinType::SEMI) {
+        return false;
+    }
     return !JoinNodeIDUniquenessAnalyzer::isUnique(children[1].get(), *buildKey);
 }
 
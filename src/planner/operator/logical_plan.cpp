@@ -1,6 +1,7 @@
 #include "planner/operator/logical_plan.h"
 
 #include "planner/operator/logical_explain.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
 
 namespace ryu {
 namespace planner {
@@ -15,5 +16,32 @@ bool LogicalPlan::hasUpdate() const {
     return lastOperator->hasUpdateRecursive();
 }
 
+static bool isPointQueryOperator(const LogicalOperator& op) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op.constCast<LogicalScanNodeTable>();
+        return scan.getScanType() == LogicalScanNodeTableType::PRIMARY_KEY_SCAN &&
+               !scan.getExtraInfo()->constCast<PrimaryKeyScanInfo>().isKeyList;
+    }
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::LIMIT:
+    case LogicalOperatorType::PROJECTION:
+        break;
+    default:
+        return false;
+    }
+    for (auto& child : op.getChildren()) {
+        if (!isPointQueryOperator(*child)) {
+            return false;
+        }
+    }
+    return op.getNumChildren() > 0;
+}
+
+bool LogicalPlan::isPointQuery() const {
+    return isPointQueryOperator(*lastOperator);
+}
+
 } // namespace planner
 } // namespace ryu
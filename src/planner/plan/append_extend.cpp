@@ -111,10 +111,23 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     auto resultColumns = recursiveInfo->function->getResultColumns(*bindData);
     auto recursiveExtend = std::make_shared<LogicalRecursiveExtend>(recursiveInfo->function->copy(),
         *recursiveInfo->bindData, resultColumns);
+    auto transaction = Transaction::Get(*clientContext);
     if (recursiveInfo->nodePredicate != nullptr) {
-        auto p = getNodeSemiMaskPlan(SemiMaskTargetType::RECURSIVE_EXTEND_PATH_NODE,
-            *recursiveInfo->node, recursiveInfo->nodePredicate);
-        recursiveExtend->addChild(p.getLastOperator());
+        // The semi mask is computed by scanning all path nodes before the traversal starts. If the
+        // traversal only reaches a small part of them, e.g. from a single source node, looking up
+        // the nodes which paths go through is cheaper.
+        const auto numReachedNodes = cardinalityEstimator.estimateNumReachedNodes(*rel,
+            *boundNode, plan.getLastOperator()->getCardinality(), transaction);
+        const auto numPathNodes =
+            cardinalityEstimator.getNumNodes(transaction, recursiveInfo->node->getTableIDs());
+        if (numReachedNodes * PlannerKnobs::NODE_LOOKUP_PENALTY < numPathNodes) {
+            recursiveExtend->setLazyNodePredicate(recursiveInfo->node,
+                recursiveInfo->nodePredicate);
+        } else {
+            auto p = getNodeSemiMaskPlan(SemiMaskTargetType::RECURSIVE_EXTEND_PATH_NODE,
+                *recursiveInfo->node, recursiveInfo->nodePredicate);
+            recursiveExtend->addChild(p.getLastOperator());
+        }
     }
     recursiveExtend->computeFactorizedSchema();
     auto probePlan = LogicalPlan();
@@ -148,7 +161,6 @@ void Planner::appendRecursiveExtend(const std::shared_ptr<NodeExpression>& bound
     pathPropertyProbe->pathNodeIDs = recursiveInfo->bindData->pathNodeIDsExpr;
     pathPropertyProbe->pathEdgeIDs = recursiveInfo->bindData->pathEdgeIDsExpr;
     pathPropertyProbe->computeFactorizedSchema();
-    auto transaction = Transaction::Get(*clientContext);
     auto extensionRate = cardinalityEstimator.getExtensionRate(*rel, *boundNode, transaction);
     auto resultCard =
         cardinalityEstimator.multiply(extensionRate, plan.getLastOperator()->getCardinality());
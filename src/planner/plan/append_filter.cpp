@@ -13,6 +13,9 @@ void Planner::appendFilters(const expression_vector& predicates, LogicalPlan& pl
 }
 
 void Planner::appendFilter(const std::shared_ptr<Expression>& predicate, LogicalPlan& plan) {
+    if (tryPlanExistsFilter(predicate, plan)) {
+        return;
+    }
     planSubqueryIfNecessary(predicate, plan);
     auto filter = make_shared<LogicalFilter>(predicate, plan.getLastOperator());
     appendFlattens(filter->getGroupsPosToFlatten(), plan);
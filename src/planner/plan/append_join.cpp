@@ -42,8 +42,13 @@ void Planner::appendHashJoin(const std::vector<expression_pair>& joinConditions,
         hashJoin->getSIPInfoUnsafe().position = SemiMaskPosition::PROHIBIT_PROBE_TO_BUILD;
     }
     // Update cost
-    hashJoin->setCardinality(cardinalityEstimator.estimateHashJoin(joinConditions,
-        probePlan.getLastOperatorRef(), buildPlan.getLastOperatorRef()));
+    auto cardinality = cardinalityEstimator.estimateHashJoin(joinConditions,
+        probePlan.getLastOperatorRef(), buildPlan.getLastOperatorRef());
+    if (joinType == JoinType::SEMI || joinType == JoinType::ANTI) {
+        // Each probe tuple is kept at most once.
+        cardinality = std::min(cardinality, probePlan.getCardinality());
+    }
+    hashJoin->setCardinality(cardinality);
     resultPlan.setCost(CostModel::computeHashJoinCost(joinConditions, probePlan, buildPlan));
     resultPlan.setLastOperator(std::move(hashJoin));
 }
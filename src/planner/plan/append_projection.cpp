@@ -1,14 +1,163 @@
+#include "binder/expression/scalar_function_expression.h"
 #include "binder/expression_visitor.h"
 #include "planner/operator/factorization/flatten_resolver.h"
 #include "planner/operator/logical_projection.h"
 #include "planner/planner.h"
 
 using namespace ryu::binder;
+using namespace ryu::common;
 
 namespace ryu {
 namespace planner {
 
+static bool isComputedExpression(const Expression& expression) {
+    switch (expression.expressionType) {
+    case ExpressionType::OR:
+    case ExpressionType::XOR:
+    case ExpressionType::AND:
+    case ExpressionType::NOT:
+    case ExpressionType::EQUALS:
+    case ExpressionType::NOT_EQUALS:
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS:
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS:
+    case ExpressionType::IS_NULL:
+    case ExpressionType::IS_NOT_NULL:
+    case ExpressionType::FUNCTION:
+    case ExpressionType::CASE_ELSE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Whether the expression can be projected on its own before the projection that uses it.
+static bool canProjectSeparately(const Expression& expression, const Schema& schema) {
+    if (schema.isExpressionInScope(expression)) {
+        return true;
+    }
+    switch (expression.expressionType) {
+    case ExpressionType::AGGREGATE_FUNCTION:
+    case ExpressionType::SUBQUERY:
+    case ExpressionType::LAMBDA:
+        return false;
+    case ExpressionType::FUNCTION: {
+        // Sharing a non-deterministic function would change how often it is called.
+        if (ExpressionVisitor::isNonDeterministicFunction(
+                expression.constCast<ScalarFunctionExpression>().getFunction().name)) {
+            return false;
+        }
+    } break;
+    default:
+        break;
+    }
+    for (auto& child : ExpressionChildrenCollector::collectChildren(expression)) {
+        if (!canProjectSeparately(*child, schema)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void countComputedExpressions(const std::shared_ptr<Expression>& expression,
+    const Schema& schema, std::unordered_map<std::string, uint32_t>& counts) {
+    if (schema.isExpressionInScope(*expression) || !isComputedExpression(*expression)) {
+        return;
+    }
+    counts[expression->getUniqueName()]++;
+    // Alternatives of a CASE are only evaluated for the tuples that reach them, so evaluating them
+    // for all tuples could raise errors the query would not raise otherwise.
+    if (expression->expressionType == ExpressionType::CASE_ELSE) {
+        return;
+    }
+    for (auto& child : expression->getChildren()) {
+        countComputedExpressions(child, schema, counts);
+    }
+}
+
+static void collectCommonExpressions(const std::shared_ptr<Expression>& expression,
+    const Schema& schema, const std::unordered_map<std::string, uint32_t>& counts,
+    expression_vector& result, expression_set& resultSet) {
+    if (schema.isExpressionInScope(*expression) || !isComputedExpression(*expression)) {
+        return;
+    }
+    if (counts.at(expression->getUniqueName()) > 1 && canProjectSeparately(*expression, schema)) {
+        if (!resultSet.contains(expression)) {
+            resultSet.insert(expression);
+            result.push_back(expression);
+        }
+        return;
+    }
+    if (expression->expressionType == ExpressionType::CASE_ELSE) {
+        return;
+    }
+    for (auto& child : expression->getChildren()) {
+        collectCommonExpressions(child, schema, counts, result, resultSet);
+    }
+}
+
+// Returns the largest computed subexpressions that occur more than once among the expressions,
+// e.g. a.x + 1 for RETURN a.x + 1 AS y, (a.x + 1) * 2 AS z.
+static expression_vector getCommonExpressions(const expression_vector& expressions,
+    const Schema& schema) {
+    std::unordered_map<std::string, uint32_t> counts;
+    for (auto& expression : expressions) {
+        countComputedExpressions(expression, schema, counts);
+    }
+    expression_vector result;
+    expression_set resultSet;
+    for (auto& expression : expressions) {
+        collectCommonExpressions(expression, schema, counts, result, resultSet);
+    }
+    return result;
+}
+
+static void collectInScopeExpressions(const std::shared_ptr<Expression>& expression,
+    const Schema& schema, expression_vector& result, expression_set& resultSet) {
+    if (schema.isExpressionInScope(*expression)) {
+        if (!resultSet.contains(expression)) {
+            resultSet.insert(expression);
+            result.push_back(expression);
+        }
+        return;
+    }
+    for (auto& child : ExpressionChildrenCollector::collectChildren(*expression)) {
+        collectInScopeExpressions(child, schema, result, resultSet);
+    }
+}
+
+// Projects the common subexpressions of the expressions together with the expressions in scope
+// they depend on, so that the common subexpressions are evaluated once and only referenced later.
+static void appendCommonExpressionsProjection(Planner& planner,
+    const expression_vector& expressions, LogicalPlan& plan) {
+    auto& schema = *plan.getSchema();
+    for (auto& expression : expressions) {
+        auto collector = SubqueryExprCollector();
+        collector.visit(expression);
+        if (collector.hasSubquery()) {
+            return;
+        }
+    }
+    auto commonExpressions = getCommonExpressions(expressions, schema);
+    if (commonExpressions.empty()) {
+        return;
+    }
+    expression_vector expressionsToProject;
+    expression_set expressionsToProjectSet;
+    for (auto& expression : expressions) {
+        collectInScopeExpressions(expression, schema, expressionsToProject,
+            expressionsToProjectSet);
+    }
+    expressionsToProject.insert(expressionsToProject.end(), commonExpressions.begin(),
+        commonExpressions.end());
+    planner.appendProjection(expressionsToProject, plan);
+}
+
 void Planner::appendProjection(const expression_vector& expressionsToProject, LogicalPlan& plan) {
+    if (!plan.isEmpty()) {
+        appendCommonExpressionsProjection(*this, expressionsToProject, plan);
+    }
     for (auto& expression : expressionsToProject) {
         planSubqueryIfNecessary(expression, plan);
     }
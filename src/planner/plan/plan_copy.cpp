@@ -80,6 +80,14 @@ LogicalPlan Planner::planCopyNodeFrom(const BoundCopyFromInfo* info) {
     default:
         KU_UNREACHABLE;
     }
+    // Sorting the input fills node groups with consecutive ranges of the key. The sorted rows are
+    // read back by a single thread, which keeps their order across node groups.
+    if (info->extraInfo) {
+        const auto& clusterKey = info->extraInfo->constCast<ExtraBoundCopyNodeInfo>().clusterKey;
+        if (clusterKey) {
+            appendOrderBy({clusterKey}, {true /* isAscOrder */}, plan);
+        }
+    }
     appendCopyFrom(*info, plan);
     return plan;
 }
@@ -7,6 +7,7 @@
 #include "planner/join_order/cost_model.h"
 #include "planner/join_order/join_plan_solver.h"
 #include "planner/join_order/join_tree_constructor.h"
+#include "planner/operator/logical_hash_join.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "planner/planner.h"
 
@@ -172,6 +173,12 @@ void Planner::planLevelExactly(uint32_t level) {
 }
 
 void Planner::planLevelApproximately(uint32_t level) {
+    // Cyclic patterns beyond triangles, e.g. 4-cliques or diamonds, only close their cycles at
+    // approximate levels. Intersecting all rels closing on a node is what keeps their
+    // intermediate results small, so wcoj is still enumerated here.
+    for (auto numRels = 2u; numRels <= level / 2; ++numRels) {
+        planWCOJoin(numRels, level - numRels);
+    }
     planInnerJoin(1, level - 1);
 }
 
@@ -463,7 +470,7 @@ void Planner::planWCOJoin(const SubqueryGraph& subgraph,
         for (auto& predicate : predicates) {
             appendFilter(predicate, leftPlanCopy);
         }
-        context.subPlansTable->addPlan(newSubgraph, std::move(leftPlanCopy));
+        context.addPlan(newSubgraph, std::move(leftPlanCopy));
     }
 }
 
@@ -572,6 +579,7 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanBuildCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, leftPlanProbeCopy, rightPlanBuildCopy,
                     leftPlanProbeCopy);
+                setBuildSubgraphKeyIfAdaptive(otherSubgraph, *leftPlanProbeCopy.getLastOperator());
                 appendFilters(predicates, leftPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(leftPlanProbeCopy));
             }
@@ -582,6 +590,7 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
                 auto rightPlanProbeCopy = rightPlan.copy();
                 appendHashJoin(joinNodeIDs, JoinType::INNER, rightPlanProbeCopy, leftPlanBuildCopy,
                     rightPlanProbeCopy);
+                setBuildSubgraphKeyIfAdaptive(subgraph, *rightPlanProbeCopy.getLastOperator());
                 appendFilters(predicates, rightPlanProbeCopy);
                 context.addPlan(newSubgraph, std::move(rightPlanProbeCopy));
             }
@@ -589,6 +598,21 @@ void Planner::planInnerHashJoin(const SubqueryGraph& subgraph, const SubqueryGra
     }
 }
 
+void Planner::setBuildSubgraphKeyIfAdaptive(const SubqueryGraph& buildSubgraph,
+    LogicalOperator& hashJoin) {
+    const auto feedback = context.cardinalityFeedback;
+    if (feedback == nullptr || !feedback->canReoptimize()) {
+        return;
+    }
+    auto key = CardinalityFeedback::getKey(*context.getQueryGraph(), buildSubgraph);
+    // Cardinalities observed before are not checked again, which bounds re-planning.
+    if (feedback->contains(key)) {
+        return;
+    }
+    hashJoin.cast<LogicalHashJoin>().setBuildSubgraph(std::move(key),
+        hashJoin.getChild(1)->getCardinality());
+}
+
 static bool isExpressionNewlyMatched(const std::vector<SubqueryGraph>& prevs,
     const SubqueryGraph& newSubgraph, const std::shared_ptr<Expression>& expression) {
     auto collector = DependentVarNameCollector();
@@ -249,17 +249,40 @@ void Planner::planSubquery(const std::shared_ptr<Expression>& expression, Logica
         return;
     }
     // Plan correlated subquery
+    auto joinConditions = planCorrelatedSubquery(*subquery, correlatedExprs, outerPlan, innerPlan);
+    switch (subquery->getSubqueryType()) {
+    case common::SubqueryType::EXISTS: {
+        appendMarkJoin(joinConditions, expression, outerPlan, innerPlan, outerPlan);
+    } break;
+    case common::SubqueryType::COUNT: {
+        expression_vector hashKeys;
+        for (auto& joinCondition : joinConditions) {
+            hashKeys.push_back(joinCondition.second);
+        }
+        appendAggregate(hashKeys, expression_vector{subquery->getProjectionExpr()}, innerPlan);
+        appendHashJoin(joinConditions, common::JoinType::COUNT, nullptr, outerPlan, innerPlan,
+            outerPlan);
+    } break;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+std::vector<expression_pair> Planner::planCorrelatedSubquery(const SubqueryExpression& subquery,
+    const expression_vector& correlatedExprs, LogicalPlan& outerPlan, LogicalPlan& innerPlan) {
+    auto predicates = subquery.getPredicatesSplitOnAnd();
+    auto info = QueryGraphPlanningInfo();
+    info.hint = subquery.getHint();
     info.corrExprsCard = outerPlan.getCardinality();
     auto analyzer = SubqueryPredicatePullUpAnalyzer(*outerPlan.getSchema(),
-        *subquery->getQueryGraphCollection());
+        *subquery.getQueryGraphCollection());
     std::vector<expression_pair> joinConditions;
     if (analyzer.analyze(predicates)) {
         // Unnest as inner join
         info.subqueryType = SubqueryPlanningType::UNNEST_CORRELATED;
         info.corrExprs = analyzer.getCorrelatedInternalIDs();
         info.predicates = analyzer.getNonCorrelatedPredicates();
-        innerPlan =
-            planQueryGraphCollectionInNewContext(*subquery->getQueryGraphCollection(), info);
+        innerPlan = planQueryGraphCollectionInNewContext(*subquery.getQueryGraphCollection(), info);
         joinConditions = analyzer.getJoinConditions();
     } else {
         // Unnest as expression scan + distinct & inner join
@@ -269,26 +292,37 @@ void Planner::planSubquery(const std::shared_ptr<Expression>& expression, Logica
         for (auto& expr : correlatedExprs) {
             joinConditions.emplace_back(expr, expr);
         }
-        innerPlan =
-            planQueryGraphCollectionInNewContext(*subquery->getQueryGraphCollection(), info);
+        innerPlan = planQueryGraphCollectionInNewContext(*subquery.getQueryGraphCollection(), info);
         appendAccumulate(correlatedExprs, outerPlan);
     }
-    switch (subquery->getSubqueryType()) {
-    case common::SubqueryType::EXISTS: {
-        appendMarkJoin(joinConditions, expression, outerPlan, innerPlan, outerPlan);
-    } break;
-    case common::SubqueryType::COUNT: {
-        expression_vector hashKeys;
-        for (auto& joinCondition : joinConditions) {
-            hashKeys.push_back(joinCondition.second);
-        }
-        appendAggregate(hashKeys, expression_vector{subquery->getProjectionExpr()}, innerPlan);
-        appendHashJoin(joinConditions, common::JoinType::COUNT, nullptr, outerPlan, innerPlan,
-            outerPlan);
-    } break;
-    default:
-        KU_UNREACHABLE;
+    return joinConditions;
+}
+
+bool Planner::tryPlanExistsFilter(const std::shared_ptr<Expression>& predicate,
+    LogicalPlan& outerPlan) {
+    auto expression = predicate;
+    auto joinType = JoinType::SEMI;
+    if (predicate->expressionType == ExpressionType::NOT) {
+        expression = predicate->getChild(0);
+        joinType = JoinType::ANTI;
+    }
+    if (expression->expressionType != ExpressionType::SUBQUERY ||
+        outerPlan.getSchema()->isExpressionInScope(*expression)) {
+        return false;
     }
+    auto& subquery = expression->constCast<SubqueryExpression>();
+    if (subquery.getSubqueryType() != SubqueryType::EXISTS) {
+        return false;
+    }
+    // Uncorrelated subqueries are evaluated once and cross producted.
+    auto correlatedExprs = getDependentExprs(expression, *outerPlan.getSchema());
+    if (correlatedExprs.empty()) {
+        return false;
+    }
+    LogicalPlan innerPlan;
+    auto joinConditions = planCorrelatedSubquery(subquery, correlatedExprs, outerPlan, innerPlan);
+    appendHashJoin(joinConditions, joinType, nullptr /* mark */, outerPlan, innerPlan, outerPlan);
+    return true;
 }
 
 void Planner::planSubqueryIfNecessary(std::shared_ptr<Expression> expression, LogicalPlan& plan) {
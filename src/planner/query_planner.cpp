@@ -52,6 +52,7 @@ expression_vector Planner::getProperties(const Expression& pattern) const {
 JoinOrderEnumeratorContext Planner::enterNewContext() {
     auto prevContext = std::move(context);
     context = JoinOrderEnumeratorContext();
+    context.cardinalityFeedback = prevContext.cardinalityFeedback;
     return prevContext;
 }
 
@@ -12,7 +12,8 @@ namespace processor {
 
 std::unique_ptr<PhysicalOperator> PlanMapper::createFTableScan(const expression_vector& exprs,
     std::vector<ft_col_idx_t> colIndices, const Schema* schema,
-    std::shared_ptr<FactorizedTable> table, uint64_t maxMorselSize, physical_op_vector_t children) {
+    std::shared_ptr<FactorizedTable> table, uint64_t maxMorselSize, physical_op_vector_t children,
+    std::optional<ft_col_idx_t> multiplicityColIdx) {
     std::vector<DataPos> outPosV;
     if (!exprs.empty()) {
         KU_ASSERT(schema);
@@ -21,6 +22,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createFTableScan(const expression_
     auto function = FTableScan::getFunction();
     auto bindData =
         std::make_unique<FTableScanBindData>(table, std::move(colIndices), maxMorselSize);
+    bindData->multiplicityColIdx = multiplicityColIdx;
     auto info = TableFunctionCallInfo();
     info.function = *function->copy();
     info.bindData = std::move(bindData);
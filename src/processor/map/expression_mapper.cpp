@@ -12,6 +12,7 @@
 #include "common/string_format.h"
 #include "expression_evaluator/case_evaluator.h"
 #include "expression_evaluator/function_evaluator.h"
+#include "expression_evaluator/fused_evaluator.h"
 #include "expression_evaluator/lambda_evaluator.h"
 #include "expression_evaluator/literal_evaluator.h"
 #include "expression_evaluator/path_evaluator.h"
@@ -82,10 +83,12 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getEvaluator(
 
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getConstantEvaluator(
     std::shared_ptr<Expression> expression) {
-    KU_ASSERT(ConstantExpressionVisitor::isConstant(*expression));
+    KU_ASSERT(ConstantExpressionVisitor::isConstant(*expression, true /* allowParameter */));
     auto expressionType = expression->expressionType;
     if (ExpressionType::LITERAL == expressionType) {
         return getLiteralEvaluator(std::move(expression));
+    } else if (ExpressionType::PARAMETER == expressionType) {
+        return getParameterEvaluator(std::move(expression));
     } else if (ExpressionType::CASE_ELSE == expressionType) {
         return getCaseEvaluator(std::move(expression));
     } else if (canEvaluateAsFunction(expressionType)) {
@@ -156,11 +159,36 @@ std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getFunctionEvaluator(
             recursiveExprMapper.getEvaluator(lambdaExpr.getFunctionExpr()));
         return result;
     }
+    if (auto fusedEvaluator = getFusedEvaluator(expression)) {
+        return fusedEvaluator;
+    }
     childrenEvaluators = getEvaluators(expression->getChildren());
     return std::make_unique<FunctionExpressionEvaluator>(std::move(expression),
         std::move(childrenEvaluators));
 }
 
+// Chains of at least two numeric functions with constant operands are fused into one evaluator.
+// A chain stops at the first function that is computed already.
+std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getFusedEvaluator(
+    const std::shared_ptr<Expression>& expression) {
+    std::vector<FusedStep> steps;
+    auto input = expression;
+    while (steps.empty() || schema == nullptr || !schema->isExpressionInScope(*input)) {
+        auto step = FusedStep::get(*input, steps.empty() /* isRoot */);
+        if (!step.has_value()) {
+            break;
+        }
+        input = input->getChild(step->getInputIdx());
+        steps.push_back(std::move(*step));
+    }
+    if (steps.size() < 2) {
+        return nullptr;
+    }
+    std::reverse(steps.begin(), steps.end());
+    return std::make_unique<FusedExpressionEvaluator>(expression, getEvaluator(input),
+        std::move(steps));
+}
+
 std::unique_ptr<ExpressionEvaluator> ExpressionMapper::getNodeEvaluator(
     std::shared_ptr<Expression> expression) {
     auto node = expression->constPtrCast<NodeExpression>();
@@ -6,8 +6,10 @@
 #include "processor/operator/aggregate/hash_aggregate_scan.h"
 #include "processor/operator/aggregate/simple_aggregate.h"
 #include "processor/operator/aggregate/simple_aggregate_scan.h"
+#include "processor/operator/aggregate/streaming_aggregate.h"
 #include "processor/plan_mapper.h"
 #include "processor/result/result_set_descriptor.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace ryu::binder;
 using namespace ryu::common;
@@ -112,6 +114,10 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapAggregate(const LogicalOperator
     auto child = agg.getChild(0).get();
     auto inSchema = child->getSchema();
     auto prevOperator = mapOperator(child);
+    if (agg.areKeysClustered()) {
+        return createStreamingAggregate(agg.getAllKeys(), aggregates, inSchema, outSchema,
+            std::move(prevOperator));
+    }
     if (agg.hasKeys()) {
         return createHashAggregate(agg.getKeys(), agg.getDependentKeys(), aggregates, inSchema,
             outSchema, std::move(prevOperator));
@@ -223,5 +229,40 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(const expressi
     return scan;
 }
 
+std::unique_ptr<PhysicalOperator> PlanMapper::createStreamingAggregate(
+    const expression_vector& keys, const expression_vector& aggregates, Schema* inSchema,
+    Schema* outSchema, std::unique_ptr<PhysicalOperator> prevOperator) {
+    auto aggFunctions = getAggFunctions(aggregates);
+    auto aggregateInputInfos = getAggregateInputInfos(keys, aggregates, *inSchema);
+    auto tableSchema = FactorizedTableSchema();
+    std::vector<LogicalType> aggregateTypes;
+    for (auto& key : keys) {
+        auto size = LogicalTypeUtils::getRowLayoutSize(key->dataType);
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* groupID */, size));
+    }
+    for (auto& aggregate : aggregates) {
+        auto size = LogicalTypeUtils::getRowLayoutSize(aggregate->dataType);
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* groupID */, size));
+        aggregateTypes.push_back(aggregate->getDataType().copy());
+    }
+    auto table = std::make_shared<FactorizedTable>(storage::MemoryManager::Get(*clientContext),
+        tableSchema.copy());
+    auto sharedState = std::make_shared<StreamingAggregateSharedState>(table);
+    StreamingAggregateInfo info{getDataPos(keys, *inSchema), std::move(aggregateTypes),
+        getMoveAggResultToVectorFuncs(aggFunctions), std::move(tableSchema)};
+    auto printInfo = std::make_unique<HashAggregatePrintInfo>(keys, aggregates);
+    auto aggregate = std::make_unique<StreamingAggregate>(std::move(sharedState), std::move(info),
+        std::move(aggFunctions), std::move(aggregateInputInfos), std::move(prevOperator),
+        getOperatorID(), std::move(printInfo));
+    aggregate->setDescriptor(std::make_unique<ResultSetDescriptor>(inSchema));
+    expression_vector outputExpressions;
+    outputExpressions.insert(outputExpressions.end(), keys.begin(), keys.end());
+    outputExpressions.insert(outputExpressions.end(), aggregates.begin(), aggregates.end());
+    physical_op_vector_t children;
+    children.push_back(std::move(aggregate));
+    return createFTableScanAligned(outputExpressions, outSchema, table, DEFAULT_VECTOR_CAPACITY,
+        std::move(children));
+}
+
 } // namespace processor
 } // namespace ryu
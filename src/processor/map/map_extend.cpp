@@ -18,7 +18,7 @@ using namespace ryu::catalog;
 namespace ryu {
 namespace processor {
 
-static ScanRelTableInfo getRelTableScanInfo(const TableCatalogEntry& tableEntry,
+static ScanRelTableInfo getRelTableScanInfo(const RelGroupCatalogEntry& tableEntry,
     RelDataDirection direction, RelTable* relTable, bool shouldScanNbrID,
     const expression_vector& properties, const std::vector<ColumnPredicateSet>& columnPredicates,
     main::ClientContext* clientContext) {
@@ -28,6 +28,7 @@ static ScanRelTableInfo getRelTableScanInfo(const TableCatalogEntry& tableEntry,
         columnPredicateSets.insert(columnPredicateSets.begin(), ColumnPredicateSet());
     }
     auto tableInfo = ScanRelTableInfo(relTable, std::move(columnPredicateSets), direction);
+    tableInfo.sortColumnID = tableEntry.getSortColumnID();
     // We always should scan nbrID from relTable. This is not a property in the schema label, so
     // cannot be bound to a column in the front-end.
     auto nbrColumnID = shouldScanNbrID ? NBR_ID_COLUMN_ID : INVALID_COLUMN_ID;
@@ -1,8 +1,14 @@
 #include "binder/expression/expression_util.h"
+#include "planner/join_order/cardinality_feedback.h"
+#include "planner/operator/logical_filter.h"
 #include "planner/operator/logical_hash_join.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+#include "processor/operator/filter.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 
 using namespace ryu::binder;
@@ -59,6 +65,153 @@ HashJoinBuildInfo PlanMapper::createHashBuildInfo(const Schema& buildSideSchema,
         std::move(tableSchema));
 }
 
+// A hash join is partitioned, so that its build side can be spilled to disk, if the build side is
+// expected to take a large share of the buffer pool and spilling is enabled. Partitioned joins
+// only support inner joins with flat probe keys and tuples without overflow data on both sides.
+static bool shouldPartitionHashJoin(const LogicalHashJoin& hashJoin,
+    const FactorizedTableSchema& buildTableSchema, const expression_vector& buildExpressions,
+    const storage::MemoryManager& mm) {
+    if (hashJoin.getJoinType() != JoinType::INNER || !hashJoin.requireFlatProbeKeys()) {
+        return false;
+    }
+    auto hasSpiller = false;
+    mm.getBufferManager()->getSpillerOrSkip([&](storage::Spiller&) { hasSpiller = true; });
+    if (!hasSpiller) {
+        return false;
+    }
+    auto estimatedBuildSize =
+        hashJoin.getChild(1)->getCardinality() * buildTableSchema.getNumBytesPerTuple();
+    if (estimatedBuildSize < mm.getBufferManager()->getMemoryLimit() / 4) {
+        return false;
+    }
+    for (auto i = 0u; i < buildTableSchema.getNumColumns(); i++) {
+        if (!buildTableSchema.getColumn(i)->isFlat()) {
+            return false;
+        }
+    }
+    for (auto& expression : buildExpressions) {
+        if (!PlanMapper::isFixedSize(expression->dataType)) {
+            return false;
+        }
+    }
+    for (auto& expression : hashJoin.getChild(0)->getSchema()->getExpressionsInScope()) {
+        if (!PlanMapper::isFixedSize(expression->dataType)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Probe side expressions are materialized at their positions in the output schema.
+static void initDeferredProbeInfo(const Schema& probeSchema, const Schema& outSchema,
+    ProbeDataInfo& probeDataInfo) {
+    for (auto& expression : probeSchema.getExpressionsInScope()) {
+        auto pos = DataPos(outSchema.getExpressionPos(*expression));
+        if (outSchema.getGroup(pos.dataChunkPos)->isFlat()) {
+            probeDataInfo.deferredSchema.appendColumn(ColumnSchema(false /* isUnFlat */,
+                pos.dataChunkPos, LogicalTypeUtils::getRowLayoutSize(expression->dataType)));
+        } else {
+            probeDataInfo.deferredSchema.appendColumn(
+                ColumnSchema(true /* isUnFlat */, pos.dataChunkPos, sizeof(overflow_value_t)));
+        }
+        probeDataInfo.deferredPos.push_back(pos);
+    }
+}
+
+bool PlanMapper::canEvaluateRuntimeFilter(const LogicalOperator& op, const Expression& key) {
+    switch (op.getOperatorType()) {
+    case LogicalOperatorType::SCAN_NODE_TABLE: {
+        auto& scan = op.constCast<LogicalScanNodeTable>();
+        if (scan.getScanType() != LogicalScanNodeTableType::SCAN) {
+            return false;
+        }
+        auto properties = scan.getProperties();
+        return std::any_of(properties.begin(), properties.end(),
+            [&](const auto& property) { return property->getUniqueName() == key.getUniqueName(); });
+    }
+    case LogicalOperatorType::FILTER: {
+        auto& filter = op.constCast<LogicalFilter>();
+        auto inSchema = filter.getChild(0)->getSchema();
+        return inSchema->isExpressionInScope(key) &&
+               inSchema->getGroupPos(key) == filter.getGroupPosToSelect();
+    }
+    default:
+        return false;
+    }
+}
+
+// Finds the deepest operator in the probe pipeline of a hash join which can drop probe tuples by a
+// runtime join filter on the given key. Only operators through which a tuple whose key finds no
+// match can never produce a tuple which finds one are passed, and only within the same pipeline,
+// since the build side must be finished before the target operator runs.
+static const LogicalOperator* getRuntimeJoinFilterTarget(const LogicalOperator* probeRoot,
+    const Expression& key) {
+    const LogicalOperator* target = nullptr;
+    auto op = probeRoot;
+    while (true) {
+        if (PlanMapper::canEvaluateRuntimeFilter(*op, key)) {
+            target = op;
+        }
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::FILTER:
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::PROJECTION:
+        case LogicalOperatorType::EXTEND:
+        case LogicalOperatorType::NODE_LABEL_FILTER: {
+            op = op->getChild(0).get();
+        } break;
+        case LogicalOperatorType::HASH_JOIN: {
+            auto sipInfo = op->constCast<LogicalHashJoin>().getSIPInfo();
+            if (sipInfo.dependency == SIPDependency::BUILD_DEPENDS_ON_PROBE ||
+                sipInfo.direction == SIPDirection::PROBE_TO_BUILD) {
+                return target;
+            }
+            op = op->getChild(0).get();
+        } break;
+        default:
+            return target;
+        }
+    }
+}
+
+// Pushes a filter on the build keys into the probe side for inner and semi joins on a single
+// property key. Joins on node IDs are already covered by semi masks.
+void PlanMapper::mapRuntimeJoinFilter(const LogicalHashJoin& hashJoin,
+    HashJoinSharedState& sharedState) {
+    auto joinType = hashJoin.getJoinType();
+    if ((joinType != JoinType::INNER && joinType != JoinType::SEMI) ||
+        hashJoin.getJoinConditions().size() != 1 ||
+        hashJoin.getSIPInfo().dependency == SIPDependency::BUILD_DEPENDS_ON_PROBE ||
+        hashJoin.getSIPInfo().direction == SIPDirection::PROBE_TO_BUILD ||
+        sharedState.isPartitioned()) {
+        return;
+    }
+    auto& [probeKey, buildKey] = hashJoin.getJoinConditions()[0];
+    if (probeKey->dataType.getLogicalTypeID() == LogicalTypeID::INTERNAL_ID ||
+        probeKey->dataType != buildKey->dataType) {
+        return;
+    }
+    auto target = getRuntimeJoinFilterTarget(hashJoin.getChild(0).get(), *probeKey);
+    if (target == nullptr || !logicalOpToPhysicalOpMap.contains(target)) {
+        return;
+    }
+    auto filter = std::make_shared<RuntimeJoinFilter>(probeKey->dataType.copy());
+    auto physicalOp = logicalOpToPhysicalOpMap.at(target);
+    switch (physicalOp->getOperatorType()) {
+    case PhysicalOperatorType::SCAN_NODE_TABLE: {
+        auto keyPos = getDataPos(*probeKey, *target->getSchema());
+        physicalOp->ptrCast<ScanNodeTable>()->addRuntimeJoinFilter({filter, keyPos});
+    } break;
+    case PhysicalOperatorType::FILTER: {
+        auto keyPos = getDataPos(*probeKey, *target->getChild(0)->getSchema());
+        physicalOp->ptrCast<Filter>()->addRuntimeJoinFilter({filter, keyPos});
+    } break;
+    default:
+        return;
+    }
+    sharedState.setRuntimeJoinFilter(std::move(filter));
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator* logicalOperator) {
     auto hashJoin = logicalOperator->constPtrCast<LogicalHashJoin>();
     auto outSchema = hashJoin->getSchema();
@@ -84,10 +237,34 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
         ExpressionUtil::excludeExpressions(hashJoin->getExpressionsToMaterialize(), probeKeys);
     // Create build
     auto buildInfo = createHashBuildInfo(*buildSchema, buildKeys, payloads);
-    auto globalHashTable =
-        std::make_unique<JoinHashTable>(*storage::MemoryManager::Get(*clientContext),
-            LogicalType::copy(buildKeyTypes), buildInfo.tableSchema.copy());
-    auto sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    auto mm = storage::MemoryManager::Get(*clientContext);
+    auto globalHashTable = std::make_unique<JoinHashTable>(*mm, LogicalType::copy(buildKeyTypes),
+        buildInfo.tableSchema.copy());
+    auto buildExpressions = buildKeys;
+    buildExpressions.insert(buildExpressions.end(), payloads.begin(), payloads.end());
+    auto partitioned =
+        shouldPartitionHashJoin(*hashJoin, buildInfo.tableSchema, buildExpressions, *mm);
+    std::shared_ptr<HashJoinSharedState> sharedState;
+    if (partitioned) {
+        std::vector<std::unique_ptr<JoinHashTable>> partitionHashTables;
+        for (auto i = 0u; i < HashJoinSharedState::NUM_PARTITIONS; i++) {
+            partitionHashTables.push_back(std::make_unique<JoinHashTable>(*mm,
+                LogicalType::copy(buildKeyTypes), buildInfo.tableSchema.copy()));
+        }
+        sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable),
+            std::move(partitionHashTables));
+    } else {
+        globalHashTable->allowDirectAccess();
+        sharedState = std::make_shared<HashJoinSharedState>(std::move(globalHashTable));
+    }
+    mapRuntimeJoinFilter(*hashJoin, *sharedState);
+    // Partitioned builds keep their tuples in the partitions and are not checked.
+    if (!hashJoin->getBuildSubgraphKey().empty() && !partitioned) {
+        auto [minCardinality, maxCardinality] =
+            CardinalityFeedback::getAcceptedRange(hashJoin->getEstimatedBuildCardinality());
+        sharedState->setBuildCardinalityCheck(
+            {hashJoin->getBuildSubgraphKey(), minCardinality, maxCardinality});
+    }
     auto buildPrintInfo = std::make_unique<HashJoinBuildPrintInfo>(buildKeys, payloads);
     auto hashJoinBuild = std::make_unique<HashJoinBuild>(PhysicalOperatorType::HASH_JOIN_BUILD,
         sharedState, std::move(buildInfo), std::move(buildSidePrevOperator), getOperatorID(),
@@ -110,11 +287,19 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapHashJoin(const LogicalOperator*
     } else {
         probeDataInfo.markDataPos = DataPos::getInvalidPos();
     }
+    if (partitioned) {
+        initDeferredProbeInfo(*hashJoin->getChild(0)->getSchema(), *outSchema, probeDataInfo);
+    }
     auto probePrintInfo = std::make_unique<HashJoinProbePrintInfo>(probeKeys);
     auto hashJoinProbe = make_unique<HashJoinProbe>(sharedState, hashJoin->getJoinType(),
         hashJoin->requireFlatProbeKeys(), probeDataInfo, std::move(probeSidePrevOperator),
         getOperatorID(), probePrintInfo->copy());
-    hashJoinProbe->addChild(std::move(hashJoinBuild));
+    // Hash slots are built by a separate pipeline so that all threads take part in it.
+    sharedState->setFinalizedInParallel();
+    auto finalizer =
+        std::make_unique<HashJoinFinalize>(sharedState, getOperatorID(), buildPrintInfo->copy());
+    finalizer->addChild(std::move(hashJoinBuild));
+    hashJoinProbe->addChild(std::move(finalizer));
     if (hashJoin->getSIPInfo().direction == SIPDirection::PROBE_TO_BUILD) {
         mapSIPJoin(hashJoinProbe.get());
     }
@@ -1,13 +1,21 @@
 #include "binder/expression/expression_util.h"
+#include "binder/expression/property_expression.h"
 #include "common/exception/message.h"
 #include "common/exception/runtime.h"
+#include "common/type_utils.h"
+#include "main/client_context.h"
 #include "planner/operator/logical_order_by.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
+#include "processor/operator/filter.h"
 #include "processor/operator/order_by/order_by.h"
 #include "processor/operator/order_by/order_by_merge.h"
 #include "processor/operator/order_by/order_by_scan.h"
 #include "processor/operator/order_by/top_k.h"
 #include "processor/operator/order_by/top_k_scanner.h"
+#include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace ryu::binder;
 using namespace ryu::common;
@@ -16,6 +24,106 @@ using namespace ryu::planner;
 namespace ryu {
 namespace processor {
 
+// An ORDER BY is sorted externally, so that its sorted runs can be spilled to disk, if its input is
+// expected to take a large share of the buffer pool and spilling is enabled. Like partitioned hash
+// joins, external sorts only support flat tuples without overflow data. Returns the size of a run,
+// or 0 if the input is sorted in memory.
+static uint64_t getExternalSortRunSize(const LogicalOrderBy& orderBy,
+    const OrderByDataInfo& orderByDataInfo, const storage::MemoryManager& mm, uint64_t numThreads) {
+    auto hasSpiller = false;
+    mm.getBufferManager()->getSpillerOrSkip([&](storage::Spiller&) { hasSpiller = true; });
+    if (!hasSpiller) {
+        return 0;
+    }
+    auto& payloadSchema = orderByDataInfo.payloadTableSchema;
+    auto numBytesPerTuple = payloadSchema.getNumBytesPerTuple();
+    for (auto& type : orderByDataInfo.keyTypes) {
+        numBytesPerTuple +=
+            OrderByKeyEncoder::getEncodingSize(type, orderByDataInfo.strPrefixLength);
+    }
+    auto memoryLimit = mm.getBufferManager()->getMemoryLimit();
+    if (orderBy.getChild(0)->getCardinality() * numBytesPerTuple < memoryLimit / 4) {
+        return 0;
+    }
+    for (auto i = 0u; i < payloadSchema.getNumColumns(); i++) {
+        if (!payloadSchema.getColumn(i)->isFlat()) {
+            return 0;
+        }
+    }
+    for (auto& type : orderByDataInfo.payloadTypes) {
+        if (!PlanMapper::isFixedSize(type)) {
+            return 0;
+        }
+    }
+    // Threads fill their runs concurrently, so together they hold a quarter of the buffer pool.
+    return std::max<uint64_t>(memoryLimit / (4 * numThreads), TEMP_PAGE_SIZE);
+}
+
+// Finds the deepest operator below a top-k which can drop tuples by the boundary of the top-k on
+// the given key. Only operators which pass the key of a tuple on unchanged to the tuples produced
+// from it are passed.
+static const LogicalOperator* getTopKFilterTarget(const LogicalOperator* root,
+    const Expression& key) {
+    const LogicalOperator* target = nullptr;
+    auto op = root;
+    while (true) {
+        if (PlanMapper::canEvaluateRuntimeFilter(*op, key)) {
+            target = op;
+        }
+        switch (op->getOperatorType()) {
+        case LogicalOperatorType::FILTER:
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::PROJECTION:
+        case LogicalOperatorType::EXTEND:
+        case LogicalOperatorType::NODE_LABEL_FILTER:
+        case LogicalOperatorType::HASH_JOIN: {
+            op = op->getChild(0).get();
+        } break;
+        default:
+            return target;
+        }
+    }
+}
+
+// Pushes the boundary of a top-k on its first key into the operator below which can evaluate it
+// earliest. Scans also skip node groups by the zone maps of the key.
+void PlanMapper::mapTopKFilter(const LogicalOrderBy& orderBy, TopK& topK) {
+    auto& key = *orderBy.getExpressionsToOrderBy()[0];
+    auto isNumeric = TypeUtils::visit(
+        key.dataType.getPhysicalType(), []<NumericTypes T>(T) { return true; },
+        [](auto) { return false; });
+    if (!isNumeric) {
+        return;
+    }
+    auto target = getTopKFilterTarget(orderBy.getChild(0).get(), key);
+    if (target == nullptr || !logicalOpToPhysicalOpMap.contains(target)) {
+        return;
+    }
+    auto bound = std::make_shared<storage::DynamicBound>(orderBy.getIsAscOrders()[0] ?
+                                                             ExpressionType::LESS_THAN_EQUALS :
+                                                             ExpressionType::GREATER_THAN_EQUALS);
+    auto physicalOp = logicalOpToPhysicalOpMap.at(target);
+    switch (physicalOp->getOperatorType()) {
+    case PhysicalOperatorType::SCAN_NODE_TABLE: {
+        auto properties = target->constCast<LogicalScanNodeTable>().getProperties();
+        auto propertyIdx = 0u;
+        while (properties[propertyIdx]->getUniqueName() != key.getUniqueName()) {
+            propertyIdx++;
+        }
+        auto keyPos = getDataPos(key, *target->getSchema());
+        physicalOp->ptrCast<ScanNodeTable>()->addTopKFilter({bound, keyPos}, propertyIdx,
+            key.constCast<PropertyExpression>().getPropertyName());
+    } break;
+    case PhysicalOperatorType::FILTER: {
+        auto keyPos = getDataPos(key, *target->getChild(0)->getSchema());
+        physicalOp->ptrCast<Filter>()->addTopKFilter({bound, keyPos});
+    } break;
+    default:
+        return;
+    }
+    topK.setBound(std::move(bound));
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator* logicalOperator) {
     auto& logicalOrderBy = logicalOperator->constCast<LogicalOrderBy>();
     auto outSchema = logicalOrderBy.getSchema();
@@ -60,7 +168,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator*
     }
     auto orderByDataInfo = OrderByDataInfo(keysPos, payloadsPos, LogicalType::copy(keyTypes),
         LogicalType::copy(payloadTypes), logicalOrderBy.getIsAscOrders(), std::move(payloadSchema),
-        std::move(keyInPayloadPos));
+        std::move(keyInPayloadPos), clientContext->getClientConfig()->sortStringPrefixLength);
     if (logicalOrderBy.hasLimitNum()) {
         auto limitExpr = logicalOrderBy.getLimitNum();
         if (!ExpressionUtil::canEvaluateAsLiteral(*limitExpr)) {
@@ -83,12 +191,20 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOrderBy(const LogicalOperator*
         auto topK = make_unique<TopK>(std::move(orderByDataInfo), topKSharedState, skipNum,
             limitNum, std::move(prevOperator), getOperatorID(), printInfo->copy());
         topK->setDescriptor(std::make_unique<ResultSetDescriptor>(inSchema));
+        if (skipNum + limitNum > 0) {
+            mapTopKFilter(logicalOrderBy, *topK);
+        }
         auto scan =
             std::make_unique<TopKScan>(outPos, topKSharedState, getOperatorID(), printInfo->copy());
         scan->addChild(std::move(topK));
         return scan;
     }
     auto orderBySharedState = std::make_shared<SortSharedState>();
+    auto runSize = getExternalSortRunSize(logicalOrderBy, orderByDataInfo,
+        *storage::MemoryManager::Get(*clientContext), clientContext->getMaxNumThreadForExec());
+    if (runSize != 0) {
+        orderBySharedState->enableExternalSort(runSize);
+    }
     auto printInfo = std::make_unique<OrderByPrintInfo>(keyExpressions, payloadExpressions);
     auto orderBy = make_unique<OrderBy>(std::move(orderByDataInfo), orderBySharedState,
         std::move(prevOperator), getOperatorID(), printInfo->copy());
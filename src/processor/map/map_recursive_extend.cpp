@@ -2,6 +2,7 @@
 #include "graph/on_disk_graph.h"
 #include "planner/operator/extend/logical_recursive_extend.h"
 #include "planner/operator/sip/logical_semi_masker.h"
+#include "processor/operator/path_node_predicate_mask.h"
 #include "processor/operator/recursive_extend.h"
 #include "processor/plan_mapper.h"
 
@@ -29,6 +30,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(
     auto& bindData = extend.getBindData();
     auto columns = extend.getResultColumns();
     auto tableSchema = createFlatFTableSchema(columns, *extend.getSchema());
+    auto writeMultiplicity = extend.getFunction().writeMultiplicity();
+    if (writeMultiplicity) {
+        // The multiplicity column isn't scanned into any vector, so its group is irrelevant.
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* groupID */,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::UINT64())));
+    }
     auto table = std::make_shared<FactorizedTable>(storage::MemoryManager::Get(*clientContext),
         tableSchema.copy());
     auto graph = std::make_unique<OnDiskGraph>(clientContext, bindData.graphEntry.copy());
@@ -61,12 +68,26 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapRecursiveExtend(
         auto root = mapOperator(logicalRoot.get());
         recursiveExtend->addChild(std::move(root));
         eraseOperatorMapping(logicalOperator);
+    } else if (extend.hasLazyNodePredicate()) {
+        auto maskMap = std::make_unique<NodeOffsetMaskMap>();
+        auto& pathNode = extend.getPathNode();
+        for (auto tableID : pathNode.getTableIDs()) {
+            maskMap->addMask(tableID, std::make_unique<PathNodePredicateMask>(clientContext,
+                                          pathNode, tableID, extend.getLazyNodePredicate()));
+        }
+        sharedState->setPathNodeMask(std::move(maskMap));
     }
     logicalOpToPhysicalOpMap.insert({logicalOperator, recursiveExtend.get()});
     physical_op_vector_t children;
     children.push_back(std::move(recursiveExtend));
-    return createFTableScanAligned(columns, extend.getSchema(), table, DEFAULT_VECTOR_CAPACITY,
-        std::move(children));
+    std::vector<ft_col_idx_t> colIndices;
+    for (auto i = 0u; i < columns.size(); ++i) {
+        colIndices.push_back(i);
+    }
+    auto multiplicityColIdx =
+        writeMultiplicity ? std::make_optional<ft_col_idx_t>(columns.size()) : std::nullopt;
+    return createFTableScan(columns, std::move(colIndices), extend.getSchema(), table,
+        DEFAULT_VECTOR_CAPACITY, std::move(children), multiplicityColIdx);
 }
 
 } // namespace processor
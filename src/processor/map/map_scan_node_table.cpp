@@ -2,11 +2,13 @@
 #include "binder/expression/property_expression.h"
 #include "binder/expression_binder.h"
 #include "common/mask.h"
+#include "expression_evaluator/expression_evaluator_utils.h"
 #include "planner/operator/scan/logical_scan_node_table.h"
 #include "processor/expression_mapper.h"
 #include "processor/operator/scan/primary_key_scan_node_table.h"
 #include "processor/operator/scan/scan_node_table.h"
 #include "processor/plan_mapper.h"
+#include "storage/index/property_index.h"
 #include "storage/storage_manager.h"
 
 using namespace ryu::binder;
@@ -16,6 +18,27 @@ using namespace ryu::planner;
 namespace ryu {
 namespace processor {
 
+// Restricts the scan of the committed rows to the candidates the index returns for the key. Rows in
+// local storage are not indexed, but they are not subject to the mask either.
+static void maskPropertyIndexCandidates(const PropertyIndexScanInfo& info,
+    const storage::NodeTable& table, SemiMask& semiMask, main::ClientContext* context) {
+    auto index = table.getIndex(info.indexName);
+    auto key = evaluator::ExpressionEvaluatorUtils::evaluateConstantExpression(info.key, context);
+    // Fall back to scanning all rows if the index has been dropped since planning, or if the key
+    // has a different type than the property.
+    if (!index.has_value() ||
+        index.value()->getIndexInfo().indexType != catalog::PropertyIndexCatalogEntry::TYPE_NAME ||
+        key.getDataType().getPhysicalType() != index.value()->getIndexInfo().keyDataTypes[0]) {
+        return;
+    }
+    for (auto offset : index.value()->cast<storage::PropertyIndex>().lookup(context, key)) {
+        if (offset < semiMask.getMaxOffset()) {
+            semiMask.mask(offset);
+        }
+    }
+    semiMask.enable();
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
     const LogicalOperator* logicalOperator) {
     auto storageManager = storage::StorageManager::Get(*clientContext);
@@ -63,14 +86,22 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
     for (auto& tableID : tableIDs) {
         auto table = storageManager->getTable(tableID)->ptrCast<storage::NodeTable>();
         auto semiMask = SemiMaskUtil::createMask(table->getNumTotalRows(transaction));
-        sharedStates.push_back(std::make_shared<ScanNodeTableSharedState>(std::move(semiMask)));
+        sharedStates.push_back(std::make_shared<ScanNodeTableSharedState>(std::move(semiMask),
+            scan.getPartitionIdx(), scan.getNumPartitions()));
     }
     auto alias = scan.getNodeID()->cast<PropertyExpression>().getRawVariableName();
     std::unique_ptr<PhysicalOperator> result;
     switch (scan.getScanType()) {
+    case LogicalScanNodeTableType::PROPERTY_INDEX_SCAN:
     case LogicalScanNodeTableType::SCAN: {
-        auto printInfo =
-            std::make_unique<ScanNodeTablePrintInfo>(tableNames, alias, scan.getProperties());
+        if (scan.getScanType() == LogicalScanNodeTableType::PROPERTY_INDEX_SCAN) {
+            KU_ASSERT(tableInfos.size() == 1);
+            maskPropertyIndexCandidates(scan.getExtraInfo()->constCast<PropertyIndexScanInfo>(),
+                tableInfos[0].table->cast<storage::NodeTable>(), *sharedStates[0]->getSemiMask(),
+                clientContext);
+        }
+        auto printInfo = std::make_unique<ScanNodeTablePrintInfo>(tableNames, alias,
+            scan.getProperties(), scan.getPartitionIdx(), scan.getNumPartitions());
         auto progressSharedState = std::make_shared<ScanNodeTableProgressSharedState>();
         return std::make_unique<ScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
             std::move(sharedStates), getOperatorID(), std::move(printInfo), progressSharedState);
@@ -83,7 +114,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapScanNodeTable(
         auto printInfo = std::make_unique<PrimaryKeyScanPrintInfo>(scan.getProperties(),
             primaryKeyScanInfo.key->toString(), alias);
         return std::make_unique<PrimaryKeyScanNodeTable>(std::move(scanInfo), std::move(tableInfos),
-            std::move(evaluator), std::move(sharedState), getOperatorID(), std::move(printInfo));
+            std::move(evaluator), primaryKeyScanInfo.isKeyList, std::move(sharedState),
+            getOperatorID(), std::move(printInfo));
     }
     default:
         KU_UNREACHABLE;
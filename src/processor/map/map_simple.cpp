@@ -93,6 +93,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapExportDatabase(
     for (auto child : exportDatabase->getChildren()) {
         sink->addChild(mapOperator(child.get()));
     }
+    // The COPY TO pipelines of the tables are independent. ExportDB runs after all of them.
+    sink->setMaxNumConcurrentChildren(exportDatabase->getParallelism());
     exportDatabaseCollectParallelFlags(sink);
     return sink;
 }
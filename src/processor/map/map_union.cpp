@@ -1,28 +1,257 @@
+#include "binder/expression/aggregate_function_expression.h"
+#include "binder/expression/expression_util.h"
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
+#include "binder/expression/property_expression.h"
+#include "binder/expression/rel_expression.h"
+#include "binder/expression/scalar_function_expression.h"
+#include "binder/expression_visitor.h"
+#include "common/string_format.h"
 #include "common/system_config.h"
+#include "planner/operator/extend/logical_extend.h"
+#include "planner/operator/logical_aggregate.h"
+#include "planner/operator/logical_cross_product.h"
+#include "planner/operator/logical_distinct.h"
+#include "planner/operator/logical_filter.h"
+#include "planner/operator/logical_hash_join.h"
+#include "planner/operator/logical_intersect.h"
+#include "planner/operator/logical_limit.h"
+#include "planner/operator/logical_order_by.h"
+#include "planner/operator/logical_projection.h"
 #include "planner/operator/logical_union.h"
+#include "planner/operator/scan/logical_scan_node_table.h"
 #include "processor/operator/table_scan/union_all_scan.h"
 #include "processor/plan_mapper.h"
 
+using namespace ryu::binder;
 using namespace ryu::common;
 using namespace ryu::planner;
 
 namespace ryu {
 namespace processor {
 
+// Digest of a union branch, which is equal for branches computing the same result. Branches bind
+// their own variables, so expressions are numbered in the order in which they appear instead of
+// being identified by their unique names.
+class UnionBranchDigest {
+public:
+    // Returns an empty string if the branch has an operator or expression which isn't digested.
+    static std::string compute(const LogicalOperator& op, const Schema& schema) {
+        UnionBranchDigest digest;
+        digest.appendOperator(op);
+        digest.appendExpressions(schema.getExpressionsInScope());
+        return digest.valid ? std::move(digest.digest) : std::string{};
+    }
+
+private:
+    void appendOperator(const LogicalOperator& op) {
+        digest += LogicalOperatorUtils::logicalOperatorTypeToString(op.getOperatorType()) + "(";
+        switch (op.getOperatorType()) {
+        case LogicalOperatorType::SCAN_NODE_TABLE: {
+            auto& scan = op.constCast<LogicalScanNodeTable>();
+            if (scan.getScanType() != LogicalScanNodeTableType::SCAN) {
+                valid = false;
+            }
+            appendTableIDs(scan.getTableIDs());
+            appendExpression(*scan.getNodeID());
+            appendExpressions(scan.getProperties());
+        } break;
+        case LogicalOperatorType::EXTEND: {
+            auto& extend = op.constCast<LogicalExtend>();
+            digest += std::to_string(static_cast<uint8_t>(extend.getDirection()));
+            appendExpression(*extend.getBoundNode());
+            appendExpression(*extend.getNbrNode());
+            appendExpression(*extend.getRel());
+            appendExpressions(extend.getProperties());
+        } break;
+        case LogicalOperatorType::FILTER: {
+            appendExpression(*op.constCast<LogicalFilter>().getPredicate());
+        } break;
+        case LogicalOperatorType::PROJECTION: {
+            appendExpressions(op.constCast<LogicalProjection>().getExpressionsToProject());
+        } break;
+        case LogicalOperatorType::HASH_JOIN: {
+            auto& hashJoin = op.constCast<LogicalHashJoin>();
+            digest += std::to_string(static_cast<uint8_t>(hashJoin.getJoinType()));
+            for (auto& [probeKey, buildKey] : hashJoin.getJoinConditions()) {
+                appendExpression(*probeKey);
+                appendExpression(*buildKey);
+            }
+            if (hashJoin.hasMark()) {
+                appendExpression(*hashJoin.getMark());
+            }
+        } break;
+        case LogicalOperatorType::INTERSECT: {
+            auto& intersect = op.constCast<LogicalIntersect>();
+            appendExpression(*intersect.getIntersectNodeID());
+            appendExpressions(intersect.getKeyNodeIDs());
+        } break;
+        case LogicalOperatorType::CROSS_PRODUCT: {
+            auto& crossProduct = op.constCast<LogicalCrossProduct>();
+            digest += std::to_string(static_cast<uint8_t>(crossProduct.getAccumulateType()));
+            if (crossProduct.getMark() != nullptr) {
+                appendExpression(*crossProduct.getMark());
+            }
+        } break;
+        case LogicalOperatorType::AGGREGATE: {
+            auto& aggregate = op.constCast<LogicalAggregate>();
+            appendExpressions(aggregate.getAllKeys());
+            appendExpressions(aggregate.getAggregates());
+        } break;
+        case LogicalOperatorType::DISTINCT: {
+            auto& distinct = op.constCast<LogicalDistinct>();
+            appendExpressions(distinct.getKeys());
+            appendExpressions(distinct.getPayloads());
+            digest += stringFormat("{},{}", distinct.getSkipNum(), distinct.getLimitNum());
+        } break;
+        case LogicalOperatorType::LIMIT: {
+            auto& limit = op.constCast<LogicalLimit>();
+            appendExpressions({limit.getSkipNum(), limit.getLimitNum()});
+        } break;
+        case LogicalOperatorType::ORDER_BY: {
+            auto& orderBy = op.constCast<LogicalOrderBy>();
+            appendExpressions(orderBy.getExpressionsToOrderBy());
+            for (const auto isAsc : orderBy.getIsAscOrders()) {
+                digest += isAsc ? "A" : "D";
+            }
+            appendExpressions({orderBy.getSkipNum(), orderBy.getLimitNum()});
+        } break;
+        // Operators which don't change the result.
+        case LogicalOperatorType::FLATTEN:
+        case LogicalOperatorType::MULTIPLICITY_REDUCER:
+        case LogicalOperatorType::SEMI_MASKER:
+            break;
+        default:
+            valid = false;
+        }
+        for (auto i = 0u; valid && i < op.getNumChildren(); i++) {
+            appendOperator(*op.getChild(i));
+        }
+        digest += ")";
+    }
+
+    void appendExpressions(const expression_vector& expressions) {
+        for (auto& expression : expressions) {
+            if (expression == nullptr) {
+                digest += "()";
+            } else {
+                appendExpression(*expression);
+            }
+        }
+    }
+
+    void appendExpression(const Expression& expression) {
+        auto [it, inserted] =
+            expressionIDs.emplace(expression.getUniqueName(), expressionIDs.size());
+        digest += stringFormat("({}#{}:{}", ExpressionTypeUtil::toString(expression.expressionType),
+            it->second, expression.getDataType().toString());
+        // Expressions with the same number have been digested before.
+        if (inserted) {
+            appendExpressionContent(expression);
+        }
+        digest += ")";
+    }
+
+    void appendExpressionContent(const Expression& expression) {
+        switch (expression.expressionType) {
+        case ExpressionType::PROPERTY: {
+            auto& property = expression.constCast<PropertyExpression>();
+            digest += property.getPropertyName();
+            appendName(property.getVariableName());
+            return;
+        }
+        case ExpressionType::PATTERN: {
+            if (ExpressionUtil::isRecursiveRelPattern(expression)) {
+                valid = false;
+                return;
+            }
+            if (ExpressionUtil::isRelPattern(expression)) {
+                digest += std::to_string(
+                    static_cast<uint8_t>(expression.constCast<RelExpression>().getDirectionType()));
+            }
+            appendTableIDs(expression.constCast<NodeOrRelExpression>().getTableIDs());
+            return;
+        }
+        case ExpressionType::LITERAL: {
+            digest += expression.constCast<LiteralExpression>().getValue().toString();
+            return;
+        }
+        case ExpressionType::PARAMETER: {
+            digest += expression.constCast<ParameterExpression>().getValue().toString();
+            return;
+        }
+        case ExpressionType::VARIABLE:
+            return;
+        case ExpressionType::FUNCTION: {
+            auto& name = expression.constCast<ScalarFunctionExpression>().getFunction().name;
+            // Branches calling a non-deterministic function may compute different results.
+            if (ExpressionVisitor::isNonDeterministicFunction(name)) {
+                valid = false;
+                return;
+            }
+            digest += name;
+        } break;
+        case ExpressionType::AGGREGATE_FUNCTION: {
+            auto& aggregate = expression.constCast<AggregateFunctionExpression>();
+            digest += aggregate.getFunction().name + (aggregate.isDistinct() ? "D" : "");
+        } break;
+        default: {
+            // Boolean, comparison and null operators are functions of their children.
+            if (!ExpressionTypeUtil::isBoolean(expression.expressionType) &&
+                !ExpressionTypeUtil::isComparison(expression.expressionType) &&
+                !ExpressionTypeUtil::isNullOperator(expression.expressionType)) {
+                valid = false;
+                return;
+            }
+        }
+        }
+        for (auto& child : expression.getChildren()) {
+            appendExpression(*child);
+        }
+    }
+
+    void appendName(const std::string& uniqueName) {
+        auto [it, _] = expressionIDs.emplace(uniqueName, expressionIDs.size());
+        digest += "#" + std::to_string(it->second);
+    }
+
+    void appendTableIDs(const std::vector<table_id_t>& tableIDs) {
+        for (const auto tableID : tableIDs) {
+            digest += std::to_string(tableID) + ",";
+        }
+    }
+
+private:
+    std::string digest;
+    std::unordered_map<std::string, uint64_t> expressionIDs;
+    bool valid = true;
+};
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapUnionAll(const LogicalOperator* logicalOperator) {
     auto& logicalUnionAll = logicalOperator->constCast<LogicalUnion>();
     auto outSchema = logicalUnionAll.getSchema();
     // append result collectors to each child
     std::vector<std::unique_ptr<PhysicalOperator>> prevOperators;
     std::vector<std::shared_ptr<FactorizedTable>> tables;
+    // Branches computing the same result are executed once, and their table is scanned once per
+    // branch.
+    std::unordered_map<std::string, std::shared_ptr<FactorizedTable>> digestToTable;
     for (auto i = 0u; i < logicalOperator->getNumChildren(); ++i) {
         auto child = logicalOperator->getChild(i);
         auto childSchema = logicalUnionAll.getSchemaBeforeUnion(i);
+        auto digest = UnionBranchDigest::compute(*child, *childSchema);
+        if (!digest.empty() && digestToTable.contains(digest)) {
+            tables.push_back(digestToTable.at(digest));
+            continue;
+        }
         auto prevOperator = mapOperator(child.get());
         auto resultCollector = createResultCollector(AccumulateType::REGULAR,
             childSchema->getExpressionsInScope(), childSchema, std::move(prevOperator));
         tables.push_back(resultCollector->getResultFTable());
         prevOperators.push_back(std::move(resultCollector));
+        if (!digest.empty()) {
+            digestToTable.emplace(std::move(digest), tables.back());
+        }
     }
     // append union all
     std::vector<DataPos> outputPositions;
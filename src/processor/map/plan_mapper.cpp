@@ -23,18 +23,23 @@ PlanMapper::PlanMapper(ExecutionContext* executionContext)
 
 std::unique_ptr<PhysicalPlan> PlanMapper::getPhysicalPlan(const LogicalPlan* logicalPlan,
     const expression_vector& expressions, main::QueryResultType resultType,
-    ArrowResultConfig arrowConfig) {
+    ArrowResultConfig arrowConfig, std::shared_ptr<ResultStream> resultStream) {
     auto root = mapOperator(logicalPlan->getLastOperator().get());
     if (!root->isSink()) {
         if (resultType == main::QueryResultType::ARROW) {
             root = createArrowResultCollector(arrowConfig, expressions, logicalPlan->getSchema(),
                 std::move(root));
         } else {
-            root = createResultCollector(AccumulateType::REGULAR, expressions,
+            auto resultCollector = createResultCollector(AccumulateType::REGULAR, expressions,
                 logicalPlan->getSchema(), std::move(root));
+            if (resultStream != nullptr) {
+                resultCollector->setResultStream(std::move(resultStream));
+            }
+            root = std::move(resultCollector);
         }
     }
     auto physicalPlan = std::make_unique<PhysicalPlan>(std::move(root));
+    physicalPlan->isPointQuery = logicalPlan->isPointQuery();
     if (logicalPlan->isProfile()) {
         physicalPlan->lastOperator->ptrCast<Profile>()->setPhysicalPlan(physicalPlan.get());
     }
@@ -197,6 +202,7 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapOperator(const LogicalOperator*
     default:
         KU_UNREACHABLE;
     }
+    physicalOperator->setEstimatedCardinality(logicalOperator->getCardinality());
     if (!logicalOpToPhysicalOpMap.contains(logicalOperator)) {
         logicalOpToPhysicalOpMap.insert({logicalOperator, physicalOperator.get()});
     }
@@ -224,6 +230,19 @@ FactorizedTableSchema PlanMapper::createFlatFTableSchema(const expression_vector
     return tableSchema;
 }
 
+bool PlanMapper::isFixedSize(const LogicalType& type) {
+    switch (type.getPhysicalType()) {
+    case PhysicalTypeID::STRING:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::ARRAY:
+    case PhysicalTypeID::STRUCT:
+    case PhysicalTypeID::POINTER:
+        return false;
+    default:
+        return true;
+    }
+}
+
 std::unique_ptr<SemiMask> PlanMapper::createSemiMask(table_id_t tableID) const {
     auto table = StorageManager::Get(*clientContext)->getTable(tableID)->ptrCast<NodeTable>();
     return SemiMaskUtil::createMask(
@@ -775,13 +775,21 @@ uint64_t PartitioningAggregateHashTable::append(const std::vector<ValueVector*>&
     uint64_t resultSetMultiplicity) {
     const auto numFlatTuples = leadingState->getSelVector().getSelSize();
 
+    if (directAccess && !reserveDirectSlots(*keyVectors[0])) {
+        disableDirectAccess();
+    }
     mergeIfFull(numFlatTuples);
 
     // mergeAll makes use of the hashVector, so it needs to be called before computeVectorHashes
     computeVectorHashes(keyVectors);
     KU_ASSERT(
         hashVector->getSelVectorPtr()->getSelSize() == leadingState->getSelVector().getSelSize());
-    findHashSlots(keyVectors, dependentKeyVectors, leadingState);
+    if (directAccess) {
+        findDirectSlots(keyVectors, dependentKeyVectors);
+    } else {
+        findHashSlots(keyVectors, dependentKeyVectors, leadingState);
+    }
+    numInputTuples += numFlatTuples;
     // Don't update distinct states since they can't be merged into the global hash tables.
     // Instead we'll calculate them from scratch when merging.
     updateAggStates(keyVectors, aggregateInputs, resultSetMultiplicity, leadingState);
@@ -795,13 +803,19 @@ bool outOfSpace(const AggregateHashTable& hashTable, uint64_t newNumTuples) {
 }
 
 void PartitioningAggregateHashTable::mergeIfFull(uint64_t tuplesToAdd, bool mergeAll) {
-    if (mergeAll || outOfSpace(*this, tuplesToAdd)) {
+    // A direct access table has a slot for every group it can hold, so it is never full.
+    if (mergeAll || (!directAccess && outOfSpace(*this, tuplesToAdd))) {
+        auto numGroups = getNumEntries();
         partitioningData->appendTuples(*factorizedTable,
             tableSchema.getColOffset(tableSchema.getNumColumns() - 1));
         // Move overflow data into the shared state so that it isn't obliterated when we clear
         // the factorized table
         partitioningData->appendOverflow(std::move(*factorizedTable->getInMemOverflowBuffer()));
         clear();
+        if (!mergeAll) {
+            adaptSize(numGroups);
+        }
+        numInputTuples = 0;
     }
     bool anyToMerge = mergeAll;
     if (!mergeAll) {
@@ -869,11 +883,158 @@ void PartitioningAggregateHashTable::mergeIfFull(uint64_t tuplesToAdd, bool merg
     }
 }
 
+void PartitioningAggregateHashTable::adaptSize(uint64_t numGroups) {
+    if (numInputTuples == 0) {
+        return;
+    }
+    auto reductionRatio = static_cast<double>(numGroups) / static_cast<double>(numInputTuples);
+    if (reductionRatio >= PASS_THROUGH_REDUCTION_RATIO) {
+        if (!isPassThrough()) {
+            resize(PASS_THROUGH_NUM_HASH_SLOTS);
+        }
+    } else if (isPassThrough()) {
+        // The input got more duplicates since switching to pass-through.
+        resize(defaultNumHashSlots);
+    } else if (reductionRatio <= GROW_REDUCTION_RATIO && maxNumHashSlots < MAX_NUM_HASH_SLOTS) {
+        resize(maxNumHashSlots * 2);
+    }
+}
+
+void PartitioningAggregateHashTable::initDirectAccess() {
+    if (keyTypes.size() != 1) {
+        return;
+    }
+    switch (keyTypes[0].getLogicalTypeID()) {
+    case LogicalTypeID::BOOL: {
+        setMaxNumHashSlots(3);
+    } break;
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::UINT8: {
+        setMaxNumHashSlots(1 + (1 << 8));
+    } break;
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::UINT16: {
+        setMaxNumHashSlots(1 + (1 << 16));
+        addDataBlocksIfNecessary(maxNumHashSlots);
+    } break;
+    case LogicalTypeID::INTERNAL_ID: {
+        // Starts with the default number of slots and grows with the largest offset seen.
+    } break;
+    default:
+        return;
+    }
+    directAccess = true;
+}
+
+uint64_t PartitioningAggregateHashTable::getDirectSlotIdx(const ValueVector& keyVector,
+    uint32_t pos) const {
+    if (keyVector.isNull(pos)) {
+        return 0;
+    }
+    switch (keyVector.dataType.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+        return 1 + keyVector.getValue<bool>(pos);
+    case LogicalTypeID::INT8:
+        return 1 + static_cast<uint8_t>(keyVector.getValue<int8_t>(pos));
+    case LogicalTypeID::UINT8:
+        return 1 + keyVector.getValue<uint8_t>(pos);
+    case LogicalTypeID::INT16:
+        return 1 + static_cast<uint16_t>(keyVector.getValue<int16_t>(pos));
+    case LogicalTypeID::UINT16:
+        return 1 + keyVector.getValue<uint16_t>(pos);
+    case LogicalTypeID::INTERNAL_ID:
+        return 1 + keyVector.getValue<internalID_t>(pos).offset;
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+uint64_t PartitioningAggregateHashTable::getDirectSlotIdx(const uint8_t* entry) const {
+    // Only node IDs are resized, so only they are read back from the entries.
+    KU_ASSERT(keyTypes[0].getLogicalTypeID() == LogicalTypeID::INTERNAL_ID);
+    if (factorizedTable->isNonOverflowColNull(entry + getTableSchema()->getNullMapOffset(),
+            0 /* colIdx */)) {
+        return 0;
+    }
+    return 1 + reinterpret_cast<const internalID_t*>(entry)->offset;
+}
+
+bool PartitioningAggregateHashTable::reserveDirectSlots(const ValueVector& keyVector) {
+    if (keyVector.dataType.getLogicalTypeID() != LogicalTypeID::INTERNAL_ID) {
+        // The slots cover the whole domain of the type.
+        return true;
+    }
+    offset_t maxOffset = 0;
+    bool singleTable = true;
+    keyVector.state->getSelVector().forEach([&](auto pos) {
+        if (keyVector.isNull(pos)) {
+            return;
+        }
+        auto nodeID = keyVector.getValue<internalID_t>(pos);
+        if (directTableID == INVALID_TABLE_ID) {
+            directTableID = nodeID.tableID;
+        }
+        singleTable &= nodeID.tableID == directTableID;
+        maxOffset = std::max(maxOffset, nodeID.offset);
+    });
+    if (!singleTable || maxOffset + 1 >= MAX_NUM_HASH_SLOTS) {
+        return false;
+    }
+    if (maxOffset + 1 >= maxNumHashSlots) {
+        resizeDirectSlots(nextPowerOfTwo(maxOffset + 2));
+    }
+    return true;
+}
+
+void PartitioningAggregateHashTable::resizeDirectSlots(uint64_t newSize) {
+    setMaxNumHashSlots(newSize);
+    addDataBlocksIfNecessary(maxNumHashSlots);
+    for (auto& block : hashSlotsBlocks) {
+        block->resetToZero();
+    }
+    factorizedTable->forEach([&](auto entry) {
+        *getHashSlot(getDirectSlotIdx(entry)) =
+            HashSlot(*(hash_t*)(entry + hashColOffsetInFT), entry);
+    });
+}
+
+void PartitioningAggregateHashTable::disableDirectAccess() {
+    directAccess = false;
+    // Rehashes the groups found so far, leaving room for the next vector.
+    auto numSlotsNeeded = static_cast<uint64_t>(
+        static_cast<double>(getNumEntries() + DEFAULT_VECTOR_CAPACITY) * DEFAULT_HT_LOAD_FACTOR);
+    resize(std::max(defaultNumHashSlots, nextPowerOfTwo(numSlotsNeeded)));
+}
+
+void PartitioningAggregateHashTable::findDirectSlots(const std::vector<ValueVector*>& keyVectors,
+    const std::vector<ValueVector*>& dependentKeyVectors) {
+    auto& keyVector = *keyVectors[0];
+    uint64_t numFTEntriesToInitialize = 0;
+    keyVector.state->getSelVector().forEach([&](auto pos) {
+        auto slot = getHashSlot(getDirectSlotIdx(keyVector, pos));
+        if (slot->getEntry() == nullptr) {
+            entryIdxesToInitialize[numFTEntriesToInitialize++] = pos;
+            auto hash = hashVector->getValue<hash_t>(pos);
+            *slot = HashSlot(hash, factorizedTable->appendEmptyTuple());
+        }
+        hashSlotsToUpdateAggState[pos] = slot;
+    });
+    initializeFTEntries(keyVectors, dependentKeyVectors, numFTEntriesToInitialize);
+}
+
 void AggregateHashTable::clear() {
     factorizedTable->clear();
-    // Clear hash table
+    // Clear hash table. Slots past maxNumHashSlots are left over from a larger table and are
+    // never read, so they are zeroed when the table grows again.
+    auto numBytesToClear = maxNumHashSlots * sizeof(HashSlot);
     for (auto& block : hashSlotsBlocks) {
-        block->resetToZero();
+        if (numBytesToClear == 0) {
+            break;
+        }
+        auto data = block->getSizedData();
+        auto numBytes = std::min<uint64_t>(numBytesToClear, data.size());
+        memset(data.data(), 0, numBytes);
+        numBytesToClear -= numBytes;
     }
 }
 
@@ -58,7 +58,10 @@ void BaseAggregateSharedState::HashTableQueue::appendTuple(std::span<uint8_t> tu
         auto posToWrite = block->numTuplesReserved++;
         if (posToWrite < numTuplesPerBlock) {
             memcpy(block->table.getTuple(posToWrite), tuple.data(), tuple.size());
-            block->numTuplesWritten++;
+            if (++block->numTuplesWritten == numTuplesPerBlock) {
+                // No more tuples are written to a full block until it is merged.
+                block->spillableTable->unpin();
+            }
             return;
         } else {
             // No more space in the block, allocate and replace it
@@ -85,10 +88,12 @@ void BaseAggregateSharedState::HashTableQueue::mergeInto(AggregateHashTable& has
     while (queuedTuples.pop(partitionToMerge)) {
         KU_ASSERT(
             partitionToMerge->numTuplesWritten == partitionToMerge->table.getNumTuplesPerBlock());
+        partitionToMerge->spillableTable->pin();
         hashTable.merge(std::move(partitionToMerge->table));
         delete partitionToMerge;
     }
     if (headBlock->numTuplesWritten > 0) {
+        headBlock->spillableTable->pin();
         headBlock->table.resize(headBlock->numTuplesWritten);
         hashTable.merge(std::move(headBlock->table));
     }
@@ -11,6 +11,7 @@
 #include "processor/operator/aggregate/aggregate_input.h"
 #include "processor/operator/aggregate/base_aggregate.h"
 #include "processor/result/factorized_table_schema.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 
 using namespace ryu::common;
@@ -44,15 +45,23 @@ HashAggregateInfo::HashAggregateInfo(const HashAggregateInfo& other)
     : flatKeysPos{other.flatKeysPos}, unFlatKeysPos{other.unFlatKeysPos},
       dependentKeysPos{other.dependentKeysPos}, tableSchema{other.tableSchema.copy()} {}
 
+static size_t getNumPartitions(main::ClientContext* context) {
+    auto numPartitions = getNumPartitionsForParallelism(context);
+    MemoryManager::Get(*context)->getBufferManager()->getSpillerOrSkip([&](Spiller&) {
+        numPartitions = std::max(numPartitions,
+            HashAggregateSharedState::MIN_NUM_PARTITIONS_FOR_SPILLING);
+    });
+    return numPartitions;
+}
+
 HashAggregateSharedState::HashAggregateSharedState(main::ClientContext* context,
     HashAggregateInfo hashAggInfo,
     const std::vector<function::AggregateFunction>& aggregateFunctions,
     std::span<AggregateInfo> aggregateInfos, std::vector<LogicalType> keyTypes,
     std::vector<LogicalType> payloadTypes)
-    : BaseAggregateSharedState{aggregateFunctions, getNumPartitionsForParallelism(context)},
+    : BaseAggregateSharedState{aggregateFunctions, getNumPartitions(context)},
       aggInfo{std::move(hashAggInfo)}, limitNumber{common::INVALID_LIMIT},
-      memoryManager{MemoryManager::Get(*context)},
-      globalPartitions{getNumPartitionsForParallelism(context)} {
+      memoryManager{MemoryManager::Get(*context)}, globalPartitions{getNumPartitions(context)} {
     std::vector<LogicalType> distinctAggregateKeyTypes;
     for (auto& aggInfo : aggregateInfos) {
         distinctAggregateKeyTypes.push_back(aggInfo.distinctAggKeyType.copy());
@@ -127,7 +136,8 @@ std::pair<uint64_t, uint64_t> HashAggregateSharedState::getNextRangeToRead() {
     }
     // FactorizedTable::lookup resets the ValueVector and writes to the beginning,
     // so we can't support scanning from multiple partitions at once
-    auto [table, tableStartOffset] = getPartitionForOffset(startOffset);
+    auto [partitionIdx, tableStartOffset] = getPartitionForOffset(startOffset);
+    auto table = globalPartitions[partitionIdx].hashTable->getFactorizedTable();
     auto range = std::min(std::min(DEFAULT_VECTOR_CAPACITY, numTuples - startOffset),
         table->getNumTuples() + tableStartOffset - startOffset);
     currentOffset += range;
@@ -162,25 +172,32 @@ void HashAggregateSharedState::finalizePartitions() {
         partition.hashTable->mergeDistinctAggregateInfo();
 
         partition.hashTable->finalizeAggregateStates();
+        // The hash slots aren't used for scanning.
+        partition.hashTable->releaseHashSlots();
+        partition.spillableTable =
+            std::make_unique<SpillableFactorizedTable>(*partition.hashTable->getFactorizedTable());
+        partition.spillableTable->pin(false /* loadSpilledBlocks */);
+        partition.spillableTable->unpin();
     });
 }
 
-std::tuple<const FactorizedTable*, offset_t> HashAggregateSharedState::getPartitionForOffset(
+std::tuple<idx_t, offset_t> HashAggregateSharedState::getPartitionForOffset(
     offset_t offset) const {
-    auto factorizedTableStartOffset = 0;
-    auto partitionIdx = 0;
+    offset_t factorizedTableStartOffset = 0;
+    idx_t partitionIdx = 0;
     const auto* table = globalPartitions[partitionIdx].hashTable->getFactorizedTable();
     while (factorizedTableStartOffset + table->getNumTuples() <= offset) {
         factorizedTableStartOffset += table->getNumTuples();
         table = globalPartitions[++partitionIdx].hashTable->getFactorizedTable();
     }
-    return std::make_tuple(table, factorizedTableStartOffset);
+    return std::make_tuple(partitionIdx, factorizedTableStartOffset);
 }
 
 void HashAggregateSharedState::scan(std::span<uint8_t*> entries,
     std::vector<common::ValueVector*>& keyVectors, offset_t startOffset, offset_t numTuplesToScan,
     std::vector<uint32_t>& columnIndices) {
-    auto [table, tableStartOffset] = getPartitionForOffset(startOffset);
+    auto [partitionIdx, tableStartOffset] = getPartitionForOffset(startOffset);
+    auto table = &globalPartitions[partitionIdx].spillableTable->pin();
     // Due to the way FactorizedTable::lookup works, it's necessary to read one partition
     // at a time.
     KU_ASSERT(startOffset - tableStartOffset + numTuplesToScan <= table->getNumTuples());
@@ -192,6 +209,11 @@ void HashAggregateSharedState::scan(std::span<uint8_t*> entries,
     KU_ASSERT(true);
 }
 
+void HashAggregateSharedState::finishScan(offset_t startOffset) {
+    auto partitionIdx = std::get<0>(getPartitionForOffset(startOffset));
+    globalPartitions[partitionIdx].spillableTable->unpin();
+}
+
 void HashAggregateSharedState::assertFinalized() const {
     RUNTIME_CHECK(for (const auto& partition
                        : globalPartitions) {
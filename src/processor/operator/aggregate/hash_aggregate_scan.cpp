@@ -34,6 +34,7 @@ bool HashAggregateScan::getNextTuplesInternal(ExecutionContext* /*context*/) {
             offset += aggState->getStateSize();
         }
     }
+    sharedState->finishScan(startOffset);
     metrics->numOutputTuple.increase(numRowsToScan);
     return true;
 }
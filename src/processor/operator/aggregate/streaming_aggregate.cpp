@@ -0,0 +1,130 @@
+#include "processor/operator/aggregate/streaming_aggregate.h"
+
+#include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace ryu::common;
+using namespace ryu::function;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace processor {
+
+void StreamingAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    auto mm = MemoryManager::Get(*context->clientContext);
+    groupsChunk = std::make_unique<DataChunk>(info.keysPos.size() + info.aggregateTypes.size());
+    auto vectorIdx = 0u;
+    for (auto& pos : info.keysPos) {
+        auto vector = resultSet->getValueVector(pos).get();
+        KU_ASSERT(vector->state->isFlat());
+        keyVectors.push_back(vector);
+        groupsChunk->insert(vectorIdx++,
+            std::make_shared<ValueVector>(vector->dataType.copy(), mm));
+    }
+    for (auto& type : info.aggregateTypes) {
+        groupsChunk->insert(vectorIdx++, std::make_shared<ValueVector>(type.copy(), mm));
+    }
+    for (auto i = 0u; i < vectorIdx; i++) {
+        groupVectors.push_back(&groupsChunk->getValueVectorMutable(i));
+    }
+    for (auto& aggInfo : aggInfos) {
+        auto aggregateInput = AggregateInput();
+        if (aggInfo.aggVectorPos.dataChunkPos != INVALID_DATA_CHUNK_POS) {
+            aggregateInput.aggregateVector = resultSet->getValueVector(aggInfo.aggVectorPos).get();
+        }
+        for (auto dataChunkPos : aggInfo.multiplicityChunksPos) {
+            aggregateInput.multiplicityChunks.push_back(
+                resultSet->getDataChunk(dataChunkPos).get());
+        }
+        aggInputs.push_back(std::move(aggregateInput));
+    }
+    for (auto& function : aggregateFunctions) {
+        aggregateStates.push_back(function.createInitialNullAggregateState());
+    }
+    overflowBuffer = std::make_unique<InMemOverflowBuffer>(mm);
+    localTable = std::make_unique<FactorizedTable>(mm, info.tableSchema.copy());
+}
+
+void StreamingAggregate::executeInternal(ExecutionContext* context) {
+    while (children[0]->getNextTuple(context)) {
+        if (hasGroup && !isCurrentGroup()) {
+            finishGroup();
+        }
+        if (!hasGroup) {
+            startGroup();
+        }
+        updateAggregateStates();
+    }
+    if (hasGroup) {
+        finishGroup();
+    }
+    flushGroups();
+    metrics->numOutputTuple.increase(localTable->getNumTuples());
+    sharedState->mergeLocalTable(*localTable);
+}
+
+bool StreamingAggregate::isCurrentGroup() const {
+    auto& keyVector = *keyVectors[0];
+    auto nodeID = keyVector.getValue<internalID_t>(keyVector.state->getSelVector()[0]);
+    return nodeID == groupVectors[0]->getValue<internalID_t>(numGroups);
+}
+
+void StreamingAggregate::startGroup() {
+    for (auto i = 0u; i < keyVectors.size(); i++) {
+        auto pos = keyVectors[i]->state->getSelVector()[0];
+        groupVectors[i]->copyFromVectorData(numGroups, keyVectors[i], pos);
+    }
+    hasGroup = true;
+}
+
+void StreamingAggregate::updateAggregateStates() {
+    for (auto i = 0u; i < aggregateFunctions.size(); i++) {
+        auto& input = aggInputs[i];
+        auto state = reinterpret_cast<uint8_t*>(aggregateStates[i].get());
+        auto multiplicity = resultSet->multiplicity;
+        for (auto dataChunk : input.multiplicityChunks) {
+            multiplicity *= dataChunk->state->getSelVector().getSelSize();
+        }
+        if (input.aggregateVector && input.aggregateVector->state->isFlat()) {
+            auto pos = input.aggregateVector->state->getSelVector()[0];
+            if (!input.aggregateVector->isNull(pos)) {
+                aggregateFunctions[i].updatePosState(state, input.aggregateVector, multiplicity,
+                    pos, overflowBuffer.get());
+            }
+        } else {
+            aggregateFunctions[i].updateAllState(state, input.aggregateVector, multiplicity,
+                overflowBuffer.get());
+        }
+    }
+}
+
+void StreamingAggregate::finishGroup() {
+    for (auto i = 0u; i < aggregateFunctions.size(); i++) {
+        auto state = aggregateStates[i].get();
+        aggregateFunctions[i].finalizeState(reinterpret_cast<uint8_t*>(state));
+        info.moveAggResultToVectorFuncs[i](*groupVectors[keyVectors.size() + i], numGroups,
+            state);
+        aggregateStates[i] = aggregateFunctions[i].createInitialNullAggregateState();
+    }
+    // The results are copied into the output vectors, so no state refers to the buffer anymore.
+    overflowBuffer->resetBuffer();
+    hasGroup = false;
+    if (++numGroups == DEFAULT_VECTOR_CAPACITY) {
+        flushGroups();
+    }
+}
+
+void StreamingAggregate::flushGroups() {
+    if (numGroups == 0) {
+        return;
+    }
+    groupsChunk->state->getSelVectorUnsafe().setSelSize(numGroups);
+    localTable->append(groupVectors);
+    for (auto vector : groupVectors) {
+        vector->resetAuxiliaryBuffer();
+    }
+    numGroups = 0;
+}
+
+} // namespace processor
+} // namespace ryu
@@ -23,12 +23,19 @@ bool CrossProduct::getNextTuplesInternal(ExecutionContext* context) {
         if (!children[0]->getNextTuple(context)) {      // fetch a new left tuple
             return false;
         }
+        // Operators on top restore the states they modify before asking for the next tuples, so
+        // the vectors scanned for the previous left tuple still hold the whole right table.
+        if (localState.scannedAtOnce) {
+            metrics->numOutputTuple.increase(table->getNumTuples());
+            return true;
+        }
         localState.startIdx = 0; // reset right table scanning for a new left tuple
     }
     // scan from right table if there is tuple left
     auto numTuplesToScan =
         std::min(localState.maxMorselSize, table->getNumTuples() - localState.startIdx);
     table->scan(vectorsToScan, localState.startIdx, numTuplesToScan, info.colIndicesToScan);
+    localState.scannedAtOnce = numTuplesToScan == table->getNumTuples();
     localState.startIdx += numTuplesToScan;
     metrics->numOutputTuple.increase(numTuplesToScan);
     return true;
@@ -125,6 +125,16 @@ static bool checkDropPropertyConflicts(const TableCatalogEntry& tableEntry,
                 "Cannot drop property {} in table {} because it is used as primary key.",
                 propertyName, tableEntry.getName()));
         }
+        // Check sort property constraint
+        if (tableEntry.getTableType() == TableType::REL) {
+            auto& relGroupEntry = tableEntry.constCast<RelGroupCatalogEntry>();
+            if (relGroupEntry.hasSortProperty() &&
+                relGroupEntry.getPropertyID(relGroupEntry.getSortPropertyName()) == propertyID) {
+                throw BinderException(stringFormat(
+                    "Cannot drop property {} in table {} because it is used as sort property.",
+                    propertyName, tableEntry.getName()));
+            }
+        }
         // Check secondary index constraints
         auto catalog = Catalog::Get(context);
         auto transaction = transaction::Transaction::Get(context);
@@ -2,6 +2,7 @@
 
 #include "binder/expression/expression.h" // IWYU pragma: keep
 #include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
 
 using namespace ryu::common;
 
@@ -21,6 +22,28 @@ void Filter::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* cont
     } else {
         state = resultSet->dataChunks[dataChunkToSelectPos]->state;
     }
+    for (auto& info : runtimeJoinFilterInfos) {
+        runtimeJoinFilterProbers.emplace_back(info.filter,
+            resultSet->getValueVector(info.keyPos).get(),
+            storage::MemoryManager::Get(*context->clientContext));
+    }
+    for (auto& info : topKFilterInfos) {
+        topKFilterProbers.emplace_back(info.bound, resultSet->getValueVector(info.keyPos).get());
+    }
+}
+
+bool Filter::applyRuntimeFilters() {
+    for (auto& prober : runtimeJoinFilterProbers) {
+        if (!prober.select()) {
+            return false;
+        }
+    }
+    for (auto& prober : topKFilterProbers) {
+        if (!prober.select()) {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool Filter::getNextTuplesInternal(ExecutionContext* context) {
@@ -32,7 +55,8 @@ bool Filter::getNextTuplesInternal(ExecutionContext* context) {
         }
         saveSelVector(*state);
         hasAtLeastOneSelectedValue =
-            expressionEvaluator->select(state->getSelVectorUnsafe(), !state->isFlat());
+            expressionEvaluator->select(state->getSelVectorUnsafe(), !state->isFlat()) &&
+            applyRuntimeFilters();
     } while (!hasAtLeastOneSelectedValue);
     metrics->numOutputTuple.increase(state->getSelVector().getSelSize());
     return true;
@@ -1,6 +1,7 @@
 #include "processor/operator/hash_join/hash_join_build.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/exception/reoptimize.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
 
@@ -20,11 +21,132 @@ std::string HashJoinBuildPrintInfo::toString() const {
     return result;
 }
 
+HashJoinPartition::HashJoinPartition(std::unique_ptr<JoinHashTable> hashTable)
+    : hashTable{std::move(hashTable)} {
+    spillableTable =
+        std::make_unique<SpillableFactorizedTable>(*this->hashTable->getFactorizedTable());
+}
+
+HashJoinSharedState::HashJoinSharedState(std::unique_ptr<JoinHashTable> hashTable,
+    std::vector<std::unique_ptr<JoinHashTable>> partitionHashTables)
+    : hashTable{std::move(hashTable)} {
+    KU_ASSERT(partitionHashTables.size() == NUM_PARTITIONS);
+    for (auto& partitionHashTable : partitionHashTables) {
+        partitions.push_back(std::make_unique<HashJoinPartition>(std::move(partitionHashTable)));
+    }
+}
+
 void HashJoinSharedState::mergeLocalHashTable(JoinHashTable& localHashTable) {
+    if (isPartitioned()) {
+        appendToPartitions(localHashTable);
+        return;
+    }
     std::unique_lock lck(mtx);
     hashTable->merge(localHashTable);
 }
 
+void HashJoinSharedState::appendToPartitions(JoinHashTable& localHashTable) {
+    std::vector<std::vector<const uint8_t*>> partitionTuples(NUM_PARTITIONS);
+    auto localTable = localHashTable.getFactorizedTable();
+    localTable->forEach([&](const uint8_t* tuple) {
+        partitionTuples[getPartitionIdx(localHashTable.getHash(tuple))].push_back(tuple);
+    });
+    for (auto i = 0u; i < NUM_PARTITIONS; i++) {
+        if (partitionTuples[i].empty()) {
+            continue;
+        }
+        auto& partition = *partitions[i];
+        std::unique_lock lck{partition.mtx};
+        // Appending doesn't need the spilled tuples, so they are not loaded back.
+        auto& table = partition.spillableTable->pin(false /* loadSpilledBlocks */);
+        table.mergeMayContainNulls(*localTable);
+        partition.hashTable->appendFlatTuples(partitionTuples[i]);
+        partition.spillableTable->unpin();
+    }
+    localHashTable.clear();
+}
+
+void HashJoinSharedState::finalizePartitions() {
+    for (auto& partition : partitions) {
+        std::unique_lock lck{partition->mtx, std::try_to_lock};
+        if (!lck.owns_lock() || partition->finalized) {
+            // Claimed by another thread.
+            continue;
+        }
+        partition->finalized = true;
+        auto& table = partition->spillableTable->pin(false /* loadSpilledBlocks */);
+        if (table.hasSpilledBlocks()) {
+            partition->spillableTable->unpin();
+            continue;
+        }
+        partition->hashTable->allocateHashSlots(table.getNumTuples());
+        partition->hashTable->buildHashSlots();
+        partition->resident = true;
+    }
+}
+
+void HashJoinSharedState::prepareHashSlots() {
+    KU_ASSERT(!isPartitioned());
+    auto numTuples = hashTable->getNumEntries();
+    checkBuildCardinality(numTuples);
+    hashTable->allocateHashSlots(numTuples);
+    if (runtimeJoinFilter != nullptr) {
+        runtimeJoinFilter->init(numTuples);
+    }
+}
+
+void HashJoinSharedState::buildHashSlots() {
+    auto& blocks = hashTable->getFactorizedTable()->getTupleDataBlocks();
+    while (true) {
+        auto blockIdx = nextBlockIdxToBuild.fetch_add(1);
+        if (blockIdx >= blocks.size()) {
+            return;
+        }
+        hashTable->buildHashSlots(*blocks[blockIdx]);
+        if (runtimeJoinFilter != nullptr) {
+            runtimeJoinFilter->insert(*hashTable, *blocks[blockIdx]);
+        }
+    }
+}
+
+void HashJoinSharedState::finishFinalize() {
+    if (runtimeJoinFilter != nullptr && !isPartitioned()) {
+        runtimeJoinFilter->finalize();
+    }
+}
+
+void HashJoinSharedState::checkBuildCardinality(cardinality_t cardinality) const {
+    if (!buildCardinalityCheck.has_value()) {
+        return;
+    }
+    if (cardinality < buildCardinalityCheck->minCardinality ||
+        cardinality > buildCardinalityCheck->maxCardinality) {
+        throw ReoptimizeException(buildCardinalityCheck->subgraphKey, cardinality);
+    }
+}
+
+JoinHashTable* HashJoinSharedState::pinSpilledPartition(idx_t partitionIdx) {
+    auto& partition = *partitions[partitionIdx];
+    KU_ASSERT(!partition.resident);
+    std::unique_lock lck{partition.mtx};
+    if (partition.numProbers++ == 0) {
+        auto& table = partition.spillableTable->pin();
+        partition.hashTable->allocateHashSlots(table.getNumTuples());
+        partition.hashTable->buildHashSlots();
+    }
+    return partition.hashTable.get();
+}
+
+void HashJoinSharedState::unpinSpilledPartition(idx_t partitionIdx) {
+    auto& partition = *partitions[partitionIdx];
+    std::unique_lock lck{partition.mtx};
+    KU_ASSERT(partition.numProbers > 0);
+    if (--partition.numProbers == 0) {
+        partition.hashTable->releaseHashSlots();
+        partition.spillableTable->unpin();
+    }
+}
+
 void HashJoinBuild::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     std::vector<LogicalType> keyTypes;
     for (auto i = 0u; i < info.keysPos.size(); ++i) {
@@ -54,9 +176,29 @@ void HashJoinBuild::setKeyState(common::DataChunkState* state) {
 }
 
 void HashJoinBuild::finalizeInternal(ExecutionContext* /*context*/) {
-    auto numTuples = sharedState->getHashTable()->getNumEntries();
-    sharedState->getHashTable()->allocateHashSlots(numTuples);
-    sharedState->getHashTable()->buildHashSlots();
+    if (!sharedState->isPartitioned()) {
+        sharedState->prepareHashSlots();
+    }
+    if (sharedState->isFinalizedInParallel()) {
+        return;
+    }
+    if (sharedState->isPartitioned()) {
+        sharedState->finalizePartitions();
+    } else {
+        sharedState->buildHashSlots();
+    }
+    sharedState->finishFinalize();
+}
+
+void HashJoinBuild::flushLocalHashTableIfNecessary() {
+    if (!sharedState->isPartitioned()) {
+        return;
+    }
+    auto localTableSize =
+        hashTable->getNumEntries() * hashTable->getTableSchema()->getNumBytesPerTuple();
+    if (localTableSize >= HashJoinSharedState::LOCAL_TABLE_FLUSH_THRESHOLD) {
+        sharedState->appendToPartitions(*hashTable);
+    }
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -67,6 +209,7 @@ void HashJoinBuild::executeInternal(ExecutionContext* context) {
             numAppended += appendVectors();
         }
         metrics->numOutputTuple.increase(numAppended);
+        flushLocalHashTableIfNecessary();
     }
     // Merge with global hash table once local tuples are all appended.
     sharedState->mergeLocalHashTable(*hashTable);
@@ -40,6 +40,22 @@ void HashJoinProbe::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     if (keyVectors.size() > 1) {
         tmpHashVector = std::make_unique<ValueVector>(LogicalType::HASH(), mm);
     }
+    probeHashTable = sharedState->getHashTable();
+    if (sharedState->isPartitioned()) {
+        KU_ASSERT(flatProbe && joinType == JoinType::INNER);
+        for (auto& dataPos : probeDataInfo.deferredPos) {
+            deferredVectors.push_back(resultSet->getValueVector(dataPos).get());
+        }
+        deferredState = std::make_unique<DeferredProbeState>();
+        for (auto i = 0u; i < HashJoinSharedState::NUM_PARTITIONS; i++) {
+            auto table = std::make_unique<FactorizedTable>(mm, probeDataInfo.deferredSchema.copy());
+            // Unflat columns point into the unflat tuple blocks, which can't be spilled.
+            deferredState->spillableTables.push_back(
+                table->hasUnflatCol() ? nullptr :
+                                        std::make_unique<SpillableFactorizedTable>(*table));
+            deferredState->tables.push_back(std::move(table));
+        }
+    }
 }
 
 bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
@@ -52,20 +68,115 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         // which changes the selected position.
         // TODO(Guodong): we have potential bugs here because all keys' states should be restored.
         restoreSelVector(*keyVectors[0]->state);
-        if (!children[0]->getNextTuple(context)) {
-            return false;
+        if (sharedState->isPartitioned()) {
+            if (!probePartitionedFlatKey(context)) {
+                return false;
+            }
+        } else {
+            if (!children[0]->getNextTuple(context)) {
+                return false;
+            }
+            saveSelVector(*keyVectors[0]->state);
+            probeHashTable->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
+                probeState->probedTuples.get());
         }
-        saveSelVector(*keyVectors[0]->state);
-        sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
-            probeState->probedTuples.get());
     }
-    auto numMatchedTuples = sharedState->getHashTable()->matchFlatKeys(keyVectors,
-        probeState->probedTuples.get(), probeState->matchedTuples.get());
+    sel_t maxNumMatches = DEFAULT_VECTOR_CAPACITY;
+    if (joinType == JoinType::MARK || joinType == JoinType::SEMI || joinType == JoinType::ANTI) {
+        // Only whether the key has a match is needed.
+        maxNumMatches = 1;
+    }
+    auto numMatchedTuples = probeHashTable->matchFlatKeys(keyVectors,
+        probeState->probedTuples.get(), probeState->matchedTuples.get(), maxNumMatches);
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
     return true;
 }
 
+bool HashJoinProbe::probePartitionedFlatKey(ExecutionContext* context) {
+    if (!deferredState->replaying) {
+        if (children[0]->getNextTuple(context)) {
+            saveSelVector(*keyVectors[0]->state);
+            if (!JoinHashTable::computeProbeHashes(keyVectors, *hashVector, hashSelVec,
+                    tmpHashVector.get())) {
+                // Null keys have no match.
+                return true;
+            }
+            auto partitionIdx =
+                HashJoinSharedState::getPartitionIdx(hashVector->getValue<hash_t>(hashSelVec[0]));
+            if (sharedState->isPartitionResident(partitionIdx)) {
+                probeHashTable = sharedState->getPartitionHashTable(partitionIdx);
+                probeHashTable->lookupHashSlots(*hashVector, hashSelVec,
+                    probeState->probedTuples.get());
+            } else {
+                deferProbeTuple(partitionIdx);
+            }
+            return true;
+        }
+        deferredState->replaying = true;
+    }
+    return probeNextDeferredTuple();
+}
+
+void HashJoinProbe::deferProbeTuple(idx_t partitionIdx) {
+    auto& spillableTable = deferredState->spillableTables[partitionIdx];
+    if (spillableTable) {
+        spillableTable->pin(false /* loadSpilledBlocks */).append(deferredVectors);
+        spillableTable->unpin();
+    } else {
+        deferredState->tables[partitionIdx]->append(deferredVectors);
+    }
+}
+
+bool HashJoinProbe::probeNextDeferredTuple() {
+    auto& state = *deferredState;
+    while (state.partitionIdx < HashJoinSharedState::NUM_PARTITIONS) {
+        auto& table = *state.tables[state.partitionIdx];
+        auto& spillableTable = state.spillableTables[state.partitionIdx];
+        if (state.nextTupleIdx < table.getNumTuples()) {
+            if (state.nextTupleIdx == 0) {
+                probeHashTable = sharedState->pinSpilledPartition(state.partitionIdx);
+                if (spillableTable) {
+                    spillableTable->pin();
+                }
+            }
+            restoreDeferredTuple(table, state.nextTupleIdx++);
+            saveSelVector(*keyVectors[0]->state);
+            // Null keys are never deferred, but the hashes have to be recomputed.
+            JoinHashTable::computeProbeHashes(keyVectors, *hashVector, hashSelVec,
+                tmpHashVector.get());
+            probeHashTable->lookupHashSlots(*hashVector, hashSelVec,
+                probeState->probedTuples.get());
+            return true;
+        }
+        if (state.nextTupleIdx > 0) {
+            // All matches of the last deferred tuple have been read into the output vectors.
+            table.clear();
+            if (spillableTable) {
+                spillableTable->unpin();
+            }
+            sharedState->unpinSpilledPartition(state.partitionIdx);
+        }
+        state.partitionIdx++;
+        state.nextTupleIdx = 0;
+    }
+    return false;
+}
+
+void HashJoinProbe::restoreDeferredTuple(const FactorizedTable& table, ft_tuple_idx_t tupleIdx) {
+    for (auto i = 0u; i < deferredVectors.size(); i++) {
+        auto state = deferredVectors[i]->state.get();
+        if (table.getTableSchema()->getColumn(i)->isFlat()) {
+            state->setToFlat();
+            state->getSelVectorUnsafe().setToUnfiltered(1);
+        } else {
+            state->setToUnflat();
+            state->getSelVectorUnsafe().setToUnfiltered();
+        }
+    }
+    table.scan(deferredVectors, tupleIdx, 1 /* numTuplesToScan */);
+}
+
 bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
     KU_ASSERT(keyVectors.size() == 1);
     auto keyVector = keyVectors[0];
@@ -74,10 +185,10 @@ bool HashJoinProbe::getMatchedTuplesForUnFlatKey(ExecutionContext* context) {
         return false;
     }
     saveSelVector(*keyVector->state);
-    sharedState->getHashTable()->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
+    probeHashTable->probe(keyVectors, *hashVector, hashSelVec, tmpHashVector.get(),
         probeState->probedTuples.get());
     auto numMatchedTuples =
-        sharedState->getHashTable()->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
+        probeHashTable->matchUnFlatKey(keyVector, probeState->probedTuples.get(),
             probeState->matchedTuples.get(), probeState->matchedSelVector);
     probeState->matchedSelVector.setSelSize(numMatchedTuples);
     probeState->nextMatchedTupleIdx = 0;
@@ -89,7 +200,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForFlatKey() {
         return 0;
     }
     auto numTuplesToRead = 1;
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    probeHashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -109,7 +220,7 @@ uint64_t HashJoinProbe::getInnerJoinResultForUnFlatKey() {
         }
         keySelVector.setToFiltered(numTuplesToRead);
     }
-    sharedState->getHashTable()->lookup(vectorsToReadInto, columnIdxsToReadFrom,
+    probeHashTable->lookup(vectorsToReadInto, columnIdxsToReadFrom,
         probeState->matchedTuples.get(), probeState->nextMatchedTupleIdx, numTuplesToRead);
     probeState->nextMatchedTupleIdx += numTuplesToRead;
     return numTuplesToRead;
@@ -171,6 +282,41 @@ uint64_t HashJoinProbe::getMarkJoinResult() {
     return 1;
 }
 
+uint64_t HashJoinProbe::getSemiJoinResult() {
+    auto numMatchedTuples = probeState->matchedSelVector.getSelSize();
+    // Skip the rest of the chain.
+    probeState->probedTuples[0] = nullptr;
+    probeState->nextMatchedTupleIdx = numMatchedTuples;
+    if (flatProbe || numMatchedTuples == 0) {
+        return numMatchedTuples;
+    }
+    auto& keySelVector = keyVectors[0]->state->getSelVectorUnsafe();
+    if (keySelVector.getSelSize() != numMatchedTuples) {
+        auto buffer = keySelVector.getMutableBuffer();
+        for (auto i = 0u; i < numMatchedTuples; i++) {
+            buffer[i] = probeState->matchedSelVector[i];
+        }
+        keySelVector.setToFiltered(numMatchedTuples);
+    }
+    return numMatchedTuples;
+}
+
+uint64_t HashJoinProbe::getAntiJoinResult() {
+    KU_ASSERT(flatProbe);
+    auto hasMatch = probeState->matchedSelVector.getSelSize() != 0;
+    probeState->probedTuples[0] = nullptr;
+    probeState->nextMatchedTupleIdx = probeState->matchedSelVector.getSelSize();
+    if (hasMatch) {
+        return 0;
+    }
+    // Null keys are discarded from the key vectors for probing, but have no match either.
+    for (auto& vector : keyVectors) {
+        KU_ASSERT(vector->state->isFlat());
+        vector->state->getSelVectorUnsafe().setSelSize(1);
+    }
+    return 1;
+}
+
 uint64_t HashJoinProbe::getJoinResult() {
     switch (joinType) {
     case JoinType::LEFT: {
@@ -185,6 +331,12 @@ uint64_t HashJoinProbe::getJoinResult() {
     case JoinType::INNER: {
         return getInnerJoinResult();
     }
+    case JoinType::SEMI: {
+        return getSemiJoinResult();
+    }
+    case JoinType::ANTI: {
+        return getAntiJoinResult();
+    }
     default:
         throw InternalException("Unimplemented join type for HashJoinProbe::getJoinResult()");
     }
@@ -1,5 +1,8 @@
 #include "processor/operator/hash_join/join_hash_table.h"
 
+#include <array>
+#include <atomic>
+
 #include "common/utils.h"
 #include "function/hash/vector_hash_functions.h"
 #include "processor/result/factorized_table.h"
@@ -11,9 +14,34 @@ using namespace ryu::function;
 namespace ryu {
 namespace processor {
 
+void NodeIDKeyRange::update(nodeID_t nodeID) {
+    if (isEmpty()) {
+        tableID = nodeID.tableID;
+    } else if (tableID != nodeID.tableID) {
+        singleTable = false;
+    }
+    minOffset = std::min(minOffset, nodeID.offset);
+    maxOffset = std::max(maxOffset, nodeID.offset);
+}
+
+void NodeIDKeyRange::merge(const NodeIDKeyRange& other) {
+    if (other.isEmpty()) {
+        return;
+    }
+    if (isEmpty()) {
+        *this = other;
+        return;
+    }
+    singleTable = singleTable && other.singleTable && tableID == other.tableID;
+    minOffset = std::min(minOffset, other.minOffset);
+    maxOffset = std::max(maxOffset, other.maxOffset);
+}
+
 JoinHashTable::JoinHashTable(MemoryManager& memoryManager, logical_type_vec_t keyTypes,
     FactorizedTableSchema tableSchema)
     : BaseHashTable{memoryManager, std::move(keyTypes)} {
+    trackKeyRange = this->keyTypes.size() == 1 &&
+                    this->keyTypes[0].getLogicalTypeID() == LogicalTypeID::INTERNAL_ID;
     auto numSlotsPerBlock = HASH_BLOCK_SIZE / sizeof(uint8_t*);
     initSlotConstant(numSlotsPerBlock);
     // Prev pointer is always the last column in the table.
@@ -35,6 +63,11 @@ static bool discardNullFromKeys(const std::vector<ValueVector*>& vectors) {
 uint64_t JoinHashTable::appendVectors(const std::vector<ValueVector*>& keyVectors,
     const std::vector<ValueVector*>& payloadVectors, DataChunkState* keyState) {
     discardNullFromKeys(keyVectors);
+    if (trackKeyRange) {
+        keyVectors[0]->state->getSelVector().forEach([&](auto pos) {
+            keyRange.update(keyVectors[0]->getValue<nodeID_t>(pos));
+        });
+    }
     auto numTuplesToAppend = keyState->getSelVector().getSelSize();
     auto appendInfos = factorizedTable->allocateFlatTupleBlocks(numTuplesToAppend);
     computeVectorHashes(keyVectors);
@@ -74,6 +107,8 @@ static void sortSelectedPos(ValueVector* nodeIDVector) {
 
 uint64_t JoinHashTable::appendVectorWithSorting(ValueVector* keyVector,
     std::vector<ValueVector*> payloadVectors) {
+    // Tuples appended here are looked up by hash.
+    KU_ASSERT(!directAccessAllowed);
     auto numTuplesToAppend = 1;
     KU_ASSERT(keyVector->state->getSelVector().getSelSize() == 1);
     // Based on the way we are planning, we assume that the first and second vectors are both
@@ -105,7 +140,14 @@ uint64_t JoinHashTable::appendVectorWithSorting(ValueVector* keyVector,
 }
 
 void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
-    setMaxNumHashSlots(nextPowerOfTwo(numTuples * 2));
+    auto numSlots = nextPowerOfTwo(numTuples * 2);
+    // A direct access table never takes more slots than the hash table it replaces.
+    directAccess = directAccessAllowed && trackKeyRange && !keyRange.isEmpty() &&
+                   keyRange.singleTable && keyRange.maxOffset - keyRange.minOffset < numSlots;
+    if (directAccess) {
+        numSlots = keyRange.maxOffset - keyRange.minOffset + 1;
+    }
+    setMaxNumHashSlots(numSlots);
     auto numSlotsPerBlock = (uint64_t)1 << numSlotsPerBlockLog2;
     auto numBlocksNeeded = (maxNumHashSlots + numSlotsPerBlock - 1) / numSlotsPerBlock;
     while (hashSlotsBlocks.size() < numBlocksNeeded) {
@@ -126,15 +168,65 @@ void JoinHashTable::buildHashSlots() {
     }
 }
 
+void JoinHashTable::buildHashSlots(const DataBlock& block) {
+    uint8_t* tuple = block.getData();
+    for (auto i = 0u; i < block.numTuples; i++) {
+        // Other threads may insert into the same slot, so the chain head is swapped atomically.
+        std::atomic_ref<uint8_t*> slot{*findHashSlot(tuple)};
+        auto prevTuple = slot.load(std::memory_order_relaxed);
+        do {
+            *getPrevTuple(tuple) = prevTuple;
+        } while (!slot.compare_exchange_weak(prevTuple, tuple, std::memory_order_relaxed));
+        tuple += getTableSchema()->getNumBytesPerTuple();
+    }
+}
+
+void JoinHashTable::appendFlatTuples(const std::vector<const uint8_t*>& tuples) {
+    KU_ASSERT(!factorizedTable->hasUnflatCol());
+    // Tuples appended here are looked up by hash.
+    KU_ASSERT(!directAccessAllowed);
+    if (tuples.empty()) {
+        return;
+    }
+    auto numBytesPerTuple = getTableSchema()->getNumBytesPerTuple();
+    auto appendInfos = factorizedTable->allocateFlatTupleBlocks(tuples.size());
+    auto tupleIdx = 0u;
+    for (auto& appendInfo : appendInfos) {
+        for (auto i = 0u; i < appendInfo.numTuplesToAppend; i++) {
+            memcpy(appendInfo.data + i * numBytesPerTuple, tuples[tupleIdx++], numBytesPerTuple);
+        }
+    }
+    factorizedTable->numTuples += tuples.size();
+}
+
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVector& hashVector,
     SelectionVector& hashSelVec, ValueVector* tmpHashResultVector, uint8_t** probedTuples) {
     KU_ASSERT(keyVectors.size() == keyTypes.size());
     if (getNumEntries() == 0) {
         return;
     }
-    if (!discardNullFromKeys(keyVectors)) {
+    if (directAccess) {
+        if (!discardNullFromKeys(keyVectors)) {
+            return;
+        }
+        auto& selVector = keyVectors[0]->state->getSelVector();
+        for (auto i = 0u; i < selVector.getSelSize(); i++) {
+            probedTuples[i] = getTupleForKey(keyVectors[0]->getValue<nodeID_t>(selVector[i]));
+            prefetchForRead(probedTuples[i]);
+        }
         return;
     }
+    if (!computeProbeHashes(keyVectors, hashVector, hashSelVec, tmpHashResultVector)) {
+        return;
+    }
+    lookupHashSlots(hashVector, hashSelVec, probedTuples);
+}
+
+bool JoinHashTable::computeProbeHashes(const std::vector<ValueVector*>& keyVectors,
+    ValueVector& hashVector, SelectionVector& hashSelVec, ValueVector* tmpHashResultVector) {
+    if (!discardNullFromKeys(keyVectors)) {
+        return false;
+    }
     hashSelVec.setSelSize(keyVectors[0]->state->getSelVector().getSelSize());
     VectorHashFunction::computeHash(*keyVectors[0], keyVectors[0]->state->getSelVector(),
         hashVector, hashSelVec);
@@ -145,20 +237,42 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, ValueVect
         VectorHashFunction::combineHash(hashVector, hashSelVec, *tmpHashResultVector, hashSelVec,
             hashVector, hashSelVec);
     }
+    return true;
+}
+
+void JoinHashTable::lookupHashSlots(const ValueVector& hashVector,
+    const SelectionVector& hashSelVec, uint8_t** probedTuples) {
+    KU_ASSERT(!directAccess);
+    if (getNumEntries() == 0) {
+        for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
+            probedTuples[i] = nullptr;
+        }
+        return;
+    }
+    // Slots of a large table are spread over memory, so all slots of the batch are prefetched
+    // before the first one is read, and likewise the chain heads before they are compared. The
+    // slot addresses are kept in probedTuples in between.
     for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
         KU_ASSERT(i < DEFAULT_VECTOR_CAPACITY);
-        probedTuples[i] = getTupleForHash(hashVector.getValue<hash_t>(hashSelVec[i]));
+        auto slot = getSlot(getSlotIdxForHash(hashVector.getValue<hash_t>(hashSelVec[i])));
+        prefetchForRead(slot);
+        probedTuples[i] = reinterpret_cast<uint8_t*>(slot);
+    }
+    for (auto i = 0u; i < hashSelVec.getSelSize(); i++) {
+        probedTuples[i] = *reinterpret_cast<uint8_t**>(probedTuples[i]);
+        prefetchForRead(probedTuples[i]);
     }
 }
 
 sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
-    uint8_t** probedTuples, uint8_t** matchedTuples) {
-    auto numMatchedTuples = 0;
+    uint8_t** probedTuples, uint8_t** matchedTuples, sel_t maxNumMatches) {
+    auto numMatchedTuples = 0u;
     while (probedTuples[0]) {
-        if (numMatchedTuples == DEFAULT_VECTOR_CAPACITY) {
+        if (numMatchedTuples == maxNumMatches) {
             break;
         }
         auto currentTuple = probedTuples[0];
+        prefetchForRead(*getPrevTuple(currentTuple));
         matchedTuples[numMatchedTuples] = currentTuple;
         numMatchedTuples += matchFlatVecWithEntry(keyVectors, currentTuple);
         probedTuples[0] = *getPrevTuple(currentTuple);
@@ -166,31 +280,74 @@ sel_t JoinHashTable::matchFlatKeys(const std::vector<ValueVector*>& keyVectors,
     return numMatchedTuples;
 }
 
+// Walks the chains of all keys one hop at a time until each key either matched the tuple left in
+// probedTuples or reached the end of its chain. Advancing every unresolved key before comparing
+// any of them again overlaps the cache misses of the next hops.
+template<typename IsMatch>
+static void resolveChains(const JoinHashTable& hashTable, const SelectionVector& selVector,
+    uint8_t** probedTuples, IsMatch&& isMatch) {
+    std::array<sel_t, DEFAULT_VECTOR_CAPACITY> unresolved{};
+    sel_t numUnresolved = 0;
+    for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+        if (probedTuples[i]) {
+            unresolved[numUnresolved++] = i;
+        }
+    }
+    while (numUnresolved > 0) {
+        sel_t numLeft = 0;
+        for (auto j = 0u; j < numUnresolved; ++j) {
+            auto i = unresolved[j];
+            if (isMatch(selVector[i], probedTuples[i])) {
+                continue;
+            }
+            probedTuples[i] = *hashTable.getPrevTuple(probedTuples[i]);
+            if (probedTuples[i]) {
+                prefetchForRead(probedTuples[i]);
+                unresolved[numLeft++] = i;
+            }
+        }
+        numUnresolved = numLeft;
+    }
+}
+
 sel_t JoinHashTable::matchUnFlatKey(ValueVector* keyVector, uint8_t** probedTuples,
     uint8_t** matchedTuples, SelectionVector& matchedTuplesSelVector) {
+    auto& selVector = keyVector->state->getSelVector();
+    if (trackKeyRange) {
+        // Node ID keys are the first column and are compared inline.
+        resolveChains(*this, selVector, probedTuples, [&](sel_t pos, const uint8_t* tuple) {
+            return *reinterpret_cast<const nodeID_t*>(tuple) == keyVector->getValue<nodeID_t>(pos);
+        });
+    } else {
+        resolveChains(*this, selVector, probedTuples, [&](sel_t pos, const uint8_t* tuple) {
+            return compareEntryFuncs[0](keyVector, pos, tuple);
+        });
+    }
     auto numMatchedTuples = 0;
-    for (auto i = 0u; i < keyVector->state->getSelVector().getSelSize(); ++i) {
-        auto pos = keyVector->state->getSelVector()[i];
-        while (probedTuples[i]) {
-            auto currentTuple = probedTuples[i];
-            auto entryCompareResult = compareEntryFuncs[0](keyVector, pos, currentTuple);
-            if (entryCompareResult) {
-                matchedTuples[numMatchedTuples] = currentTuple;
-                matchedTuplesSelVector[numMatchedTuples] = pos;
-                numMatchedTuples++;
-                break;
-            }
-            probedTuples[i] = *getPrevTuple(currentTuple);
+    for (auto i = 0u; i < selVector.getSelSize(); ++i) {
+        if (probedTuples[i]) {
+            matchedTuples[numMatchedTuples] = probedTuples[i];
+            matchedTuplesSelVector[numMatchedTuples] = selVector[i];
+            numMatchedTuples++;
         }
     }
     return numMatchedTuples;
 }
 
+uint8_t* JoinHashTable::getTupleForKey(nodeID_t key) const {
+    if (key.tableID != keyRange.tableID || key.offset < keyRange.minOffset ||
+        key.offset > keyRange.maxOffset) {
+        return nullptr;
+    }
+    return *getSlot(key.offset - keyRange.minOffset);
+}
+
 uint8_t** JoinHashTable::findHashSlot(const uint8_t* tuple) const {
-    auto hash = *(hash_t*)(tuple + getHashValueColOffset());
-    auto slotIdx = getSlotIdxForHash(hash);
-    return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
-                       (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
+    if (directAccess) {
+        // The key is the first column of the tuple.
+        return getSlot(((const nodeID_t*)tuple)->offset - keyRange.minOffset);
+    }
+    return getSlot(getSlotIdxForHash(getHash(tuple)));
 }
 
 uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
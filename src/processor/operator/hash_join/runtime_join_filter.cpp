@@ -0,0 +1,151 @@
+#include "processor/operator/hash_join/runtime_join_filter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+#include "common/utils.h"
+#include "function/hash/vector_hash_functions.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace ryu::common;
+using namespace ryu::function;
+
+namespace ryu {
+namespace processor {
+
+static bool isSignedInteger(PhysicalTypeID physicalType) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT8:
+    case PhysicalTypeID::INT16:
+    case PhysicalTypeID::INT32:
+    case PhysicalTypeID::INT64:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static int64_t readSignedInteger(PhysicalTypeID physicalType, const uint8_t* value) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT8:
+        return *reinterpret_cast<const int8_t*>(value);
+    case PhysicalTypeID::INT16:
+        return *reinterpret_cast<const int16_t*>(value);
+    case PhysicalTypeID::INT32:
+        return *reinterpret_cast<const int32_t*>(value);
+    case PhysicalTypeID::INT64:
+        return *reinterpret_cast<const int64_t*>(value);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+RuntimeJoinFilter::RuntimeJoinFilter(LogicalType keyType)
+    : keyType{std::move(keyType)},
+      rangeSupported{isSignedInteger(this->keyType.getPhysicalType())} {}
+
+void RuntimeJoinFilter::init(uint64_t numKeys) {
+    KU_ASSERT(!built && words.empty());
+    const auto numWords = std::min<uint64_t>(
+        nextPowerOfTwo(std::max<uint64_t>(numKeys * NUM_BITS_PER_KEY / 64, 1)),
+        uint64_t(1) << MAX_NUM_WORDS_LOG2);
+    words.resize(numWords, 0);
+    wordIdxShift = 64 - std::countr_zero(numWords);
+    minValue = INT64_MAX;
+    maxValue = INT64_MIN;
+}
+
+void RuntimeJoinFilter::insert(const JoinHashTable& hashTable, const DataBlock& block) {
+    KU_ASSERT(!built && !words.empty());
+    const auto numWords = words.size();
+    const auto physicalType = keyType.getPhysicalType();
+    // The key is the first column of the hash table. Tuples with null keys are never inserted.
+    const auto keyOffset = hashTable.getTableSchema()->getColOffset(0);
+    const auto numBytesPerTuple = hashTable.getTableSchema()->getNumBytesPerTuple();
+    auto blockMin = INT64_MAX;
+    auto blockMax = INT64_MIN;
+    const uint8_t* tuple = block.getData();
+    for (auto i = 0u; i < block.numTuples; i++, tuple += numBytesPerTuple) {
+        const auto hash = hashTable.getHash(tuple);
+        // Shifting a 64-bit value by 64 is undefined, which happens if there is a single word.
+        const auto wordIdx = numWords == 1 ? 0 : hash >> wordIdxShift;
+        std::atomic_ref<uint64_t>{words[wordIdx]}.fetch_or(getMask(hash),
+            std::memory_order_relaxed);
+        if (rangeSupported) {
+            const auto value = readSignedInteger(physicalType, tuple + keyOffset);
+            blockMin = std::min(blockMin, value);
+            blockMax = std::max(blockMax, value);
+        }
+    }
+    if (rangeSupported) {
+        std::unique_lock lck{mtx};
+        minValue = std::min(minValue, blockMin);
+        maxValue = std::max(maxValue, blockMax);
+    }
+}
+
+bool RuntimeJoinFilter::mayContainHash(hash_t hash) const {
+    const auto wordIdx = words.size() == 1 ? 0 : hash >> wordIdxShift;
+    const auto mask = getMask(hash);
+    return (words[wordIdx] & mask) == mask;
+}
+
+RuntimeJoinFilterProber::RuntimeJoinFilterProber(std::shared_ptr<RuntimeJoinFilter> filter,
+    ValueVector* keyVector, storage::MemoryManager* memoryManager)
+    : filter{std::move(filter)}, keyVector{keyVector} {
+    hashVector = std::make_unique<ValueVector>(LogicalType::HASH(), memoryManager);
+}
+
+bool RuntimeJoinFilterProber::mayMatch(sel_t hashPos, sel_t keyPos) const {
+    if (filter->hasRange() &&
+        !filter->mayContainInRange(readSignedInteger(keyVector->dataType.getPhysicalType(),
+            keyVector->getData() + keyPos * keyVector->getNumBytesPerValue()))) {
+        return false;
+    }
+    return filter->mayContainHash(hashVector->getValue<hash_t>(hashPos));
+}
+
+bool RuntimeJoinFilterProber::select() {
+    if (!enabled || !filter->isBuilt()) {
+        return true;
+    }
+    auto& state = *keyVector->state;
+    if (state.isFlat()) {
+        // Positions of flat states are owned by the operators flattening them, so a flat key is
+        // only checked.
+        const auto pos = state.getSelVector()[0];
+        if (keyVector->isNull(pos)) {
+            return false;
+        }
+        hashSelVec.setSelSize(1);
+        VectorHashFunction::computeHash(*keyVector, state.getSelVector(), *hashVector, hashSelVec);
+        return mayMatch(0, pos);
+    }
+    // Null keys never find a match in an inner join.
+    if (!ValueVector::discardNull(*keyVector)) {
+        return false;
+    }
+    auto& selVector = state.getSelVectorUnsafe();
+    const auto numKeys = selVector.getSelSize();
+    hashSelVec.setSelSize(numKeys);
+    VectorHashFunction::computeHash(*keyVector, selVector, *hashVector, hashSelVec);
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < numKeys; i++) {
+        const auto pos = selVector[i];
+        buffer[numSelected] = pos;
+        numSelected += mayMatch(i, pos);
+    }
+    selVector.setToFiltered(numSelected);
+    numProbed += numKeys;
+    numDropped += numKeys - numSelected;
+    if (numProbed >= NUM_TUPLES_TO_SAMPLE &&
+        static_cast<double>(numDropped) < MIN_DROPPED_FRACTION * static_cast<double>(numProbed)) {
+        enabled = false;
+    }
+    return numSelected > 0;
+}
+
+} // namespace processor
+} // namespace ryu
@@ -62,6 +62,21 @@ void Intersect::probeHTs() {
     }
 }
 
+// Returns the first position in [position, size) whose node ID is not smaller than target. Probes
+// positions at exponentially growing distances first so that skipping a long run of a large list
+// costs logarithmic rather than linear time.
+static sel_t seek(const nodeID_t* nodeIDs, sel_t position, sel_t size, nodeID_t target) {
+    sel_t step = 1;
+    auto low = position;
+    auto high = position;
+    while (high < size && nodeIDs[high] < target) {
+        low = high + 1;
+        high = std::min<sel_t>(high + step, size);
+        step *= 2;
+    }
+    return std::lower_bound(nodeIDs + low, nodeIDs + high, target) - nodeIDs;
+}
+
 void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
     nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     KU_ASSERT(lSelVector.getSelSize() <= rSelVector.getSelSize());
@@ -75,7 +90,8 @@ void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVect
         if (leftNodeID < rightNodeID) {
             leftPosition++;
         } else if (leftNodeID > rightNodeID) {
-            rightPosition++;
+            rightPosition = seek(rightNodeIDs, rightPosition + 1, rSelVector.getSelSize(),
+                leftNodeID);
         } else {
             leftPositionBuffer[outputValuePosition] = leftPosition;
             rightPositionBuffer[outputValuePosition] = rightPosition;
@@ -100,20 +116,20 @@ static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
     return listsToIntersect;
 }
 
-static std::vector<uint32_t> swapSmallestListToFront(std::vector<overflow_value_t>& lists) {
+// Orders lists by ascending size so that the running intersection shrinks as early as possible and
+// every later list is only seeked into. Returns the original index of each list.
+static std::vector<uint32_t> sortListsBySize(std::vector<overflow_value_t>& lists) {
     KU_ASSERT(lists.size() >= 2);
     std::vector<uint32_t> listIdxes(lists.size());
     iota(listIdxes.begin(), listIdxes.end(), 0);
-    uint32_t smallestListIdx = 0;
-    for (auto i = 1u; i < lists.size(); i++) {
-        if (lists[i].numElements < lists[smallestListIdx].numElements) {
-            smallestListIdx = i;
-        }
-    }
-    if (smallestListIdx != 0) {
-        std::swap(lists[smallestListIdx], lists[0]);
-        std::swap(listIdxes[smallestListIdx], listIdxes[0]);
+    std::stable_sort(listIdxes.begin(), listIdxes.end(), [&](uint32_t a, uint32_t b) {
+        return lists[a].numElements < lists[b].numElements;
+    });
+    std::vector<overflow_value_t> sortedLists(lists.size());
+    for (auto i = 0u; i < listIdxes.size(); i++) {
+        sortedLists[i] = lists[listIdxes[i]];
     }
+    lists = std::move(sortedLists);
     return listIdxes;
 }
 
@@ -211,7 +227,7 @@ bool Intersect::getNextTuplesInternal(ExecutionContext* context) {
         }
         auto listsToIntersect =
             fetchListsToIntersectFromTuples(flatTuplesToIntersect, isIntersectListAFlatValue);
-        auto listIdxes = swapSmallestListToFront(listsToIntersect);
+        auto listIdxes = sortListsBySize(listsToIntersect);
         intersectLists(listsToIntersect);
         if (outKeyVector->state->getSelVector().getSelSize() != 0) {
             populatePayloads(flatTuplesToIntersect, listIdxes);
@@ -209,10 +209,8 @@ bool KeyBlockMerger::compareTuplePtrWithStringCol(uint8_t* leftTuplePtr,
             // they must equal to each other (since there are no other characters to compare for
             // them). If one string is long string and the other string is short string, the
             // long string must be greater than the short string.
-            bool isLeftStrLong =
-                OrderByKeyEncoder::isLongStr(leftStrColPtr, strKeyColInfo.isAscOrder);
-            bool isRightStrLong =
-                OrderByKeyEncoder::isLongStr(rightStrColPtr, strKeyColInfo.isAscOrder);
+            bool isLeftStrLong = strKeyColInfo.isLongStr(leftTuplePtr);
+            bool isRightStrLong = strKeyColInfo.isLongStr(rightTuplePtr);
             if (!isLeftStrLong && !isRightStrLong) {
                 continue;
             } else if (isLeftStrLong && !isRightStrLong) {
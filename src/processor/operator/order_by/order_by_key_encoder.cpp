@@ -19,8 +19,8 @@ OrderByKeyEncoder::OrderByKeyEncoder(const OrderByDataInfo& orderByDataInfo,
     MemoryManager* memoryManager, uint8_t ftIdx, uint32_t numTuplesPerBlockInFT,
     uint32_t numBytesPerTuple)
     : memoryManager{memoryManager}, isAscOrder{orderByDataInfo.isAscOrder},
-      numBytesPerTuple{numBytesPerTuple}, ftIdx{ftIdx},
-      numTuplesPerBlockInFT{numTuplesPerBlockInFT}, swapBytes{isLittleEndian()} {
+      strPrefixLength{orderByDataInfo.strPrefixLength}, numBytesPerTuple{numBytesPerTuple},
+      ftIdx{ftIdx}, numTuplesPerBlockInFT{numTuplesPerBlockInFT}, swapBytes{isLittleEndian()} {
     if (numTuplesPerBlockInFT > MAX_FT_BLOCK_OFFSET) {
         throw RuntimeException(
             "The number of tuples per block of factorizedTable exceeds the maximum blockOffset!");
@@ -36,7 +36,7 @@ OrderByKeyEncoder::OrderByKeyEncoder(const OrderByDataInfo& orderByDataInfo,
     encodeFunctions.reserve(orderByDataInfo.keysPos.size());
     for (auto& type : orderByDataInfo.keyTypes) {
         encode_function_t encodeFunction;
-        getEncodingFunction(type.getPhysicalType(), encodeFunction);
+        getEncodingFunction(type.getPhysicalType(), strPrefixLength, encodeFunction);
         encodeFunctions.push_back(std::move(encodeFunction));
     }
 }
@@ -54,7 +54,7 @@ void OrderByKeyEncoder::encodeKeys(const std::vector<common::ValueVector*>& orde
         for (auto keyColIdx = 0u; keyColIdx < orderByKeys.size(); keyColIdx++) {
             encodeVector(orderByKeys[keyColIdx], tuplePtr + tuplePtrOffset, encodedTuples,
                 numEntriesToEncode, keyColIdx);
-            tuplePtrOffset += getEncodingSize(orderByKeys[keyColIdx]->dataType);
+            tuplePtrOffset += getEncodingSize(orderByKeys[keyColIdx]->dataType, strPrefixLength);
         }
         encodeFTIdx(numEntriesToEncode, tuplePtr + tuplePtrOffset);
         encodedTuples += numEntriesToEncode;
@@ -63,21 +63,23 @@ void OrderByKeyEncoder::encodeKeys(const std::vector<common::ValueVector*>& orde
     }
 }
 
-uint32_t OrderByKeyEncoder::getNumBytesPerTuple(const std::vector<ValueVector*>& keyVectors) {
+uint32_t OrderByKeyEncoder::getNumBytesPerTuple(const std::vector<ValueVector*>& keyVectors,
+    uint32_t strPrefixLength) {
     uint32_t result = 0u;
     for (auto& vector : keyVectors) {
-        result += getEncodingSize(vector->dataType);
+        result += getEncodingSize(vector->dataType, strPrefixLength);
     }
     result += 8;
     return result;
 }
 
-uint32_t OrderByKeyEncoder::getEncodingSize(const LogicalType& dataType) {
+uint32_t OrderByKeyEncoder::getEncodingSize(const LogicalType& dataType,
+    uint32_t strPrefixLength) {
     // Add one more byte for null flag.
     switch (dataType.getPhysicalType()) {
     case PhysicalTypeID::STRING:
-        // 1 byte for null flag + 1 byte to indicate long/short string + 12 bytes for string prefix
-        return 2 + ku_string_t::SHORT_STR_LENGTH;
+        // 1 byte for null flag + 1 byte to indicate long/short string + string prefix
+        return 2 + strPrefixLength;
     default:
         return 1 + storage::StorageUtils::getDataTypeSize(dataType);
     }
@@ -86,7 +88,7 @@ uint32_t OrderByKeyEncoder::getEncodingSize(const LogicalType& dataType) {
 void OrderByKeyEncoder::flipBytesIfNecessary(uint32_t keyColIdx, uint8_t* tuplePtr,
     uint32_t numEntriesToEncode, LogicalType& type) {
     if (!isAscOrder[keyColIdx]) {
-        auto encodingSize = getEncodingSize(type);
+        auto encodingSize = getEncodingSize(type, strPrefixLength);
         // If the current column is in desc order, flip all bytes.
         for (auto i = 0u; i < numEntriesToEncode; i++) {
             for (auto byte = 0u; byte < encodingSize; ++byte) {
@@ -101,7 +103,7 @@ void OrderByKeyEncoder::encodeFlatVector(ValueVector* vector, uint8_t* tuplePtr,
     uint32_t keyColIdx) {
     auto pos = vector->state->getSelVector()[0];
     if (vector->isNull(pos)) {
-        for (auto j = 0u; j < getEncodingSize(vector->dataType); j++) {
+        for (auto j = 0u; j < getEncodingSize(vector->dataType, strPrefixLength); j++) {
             *(tuplePtr + j) = UINT8_MAX;
         }
     } else {
@@ -125,7 +127,7 @@ void OrderByKeyEncoder::encodeUnflatVector(ValueVector* vector, uint8_t* tuplePt
         } else {
             for (auto i = 0u; i < numEntriesToEncode; i++) {
                 if (vector->isNull(encodedTuples + i)) {
-                    for (auto j = 0u; j < getEncodingSize(vector->dataType); j++) {
+                    for (auto j = 0u; j < getEncodingSize(vector->dataType, strPrefixLength); j++) {
                         *(tuplePtr + j) = UINT8_MAX;
                     }
                 } else {
@@ -150,7 +152,7 @@ void OrderByKeyEncoder::encodeUnflatVector(ValueVector* vector, uint8_t* tuplePt
             for (auto i = 0u; i < numEntriesToEncode; i++) {
                 auto pos = vector->state->getSelVector()[i + encodedTuples];
                 if (vector->isNull(pos)) {
-                    for (auto j = 0u; j < getEncodingSize(vector->dataType); j++) {
+                    for (auto j = 0u; j < getEncodingSize(vector->dataType, strPrefixLength); j++) {
                         *(tuplePtr + j) = UINT8_MAX;
                     }
                 } else {
@@ -195,13 +197,21 @@ void OrderByKeyEncoder::encodeFTIdx(uint32_t numEntriesToEncode, uint8_t* tupleI
     }
 }
 
+void OrderByKeyEncoder::reset() {
+    keyBlocks.clear();
+    keyBlocks.emplace_back(std::make_shared<DataBlock>(memoryManager, DATA_BLOCK_SIZE));
+    ftBlockIdx = 0;
+    ftBlockOffset = 0;
+}
+
 void OrderByKeyEncoder::allocateMemoryIfFull() {
     if (getNumTuplesInCurBlock() == maxNumTuplesPerBlock) {
         keyBlocks.emplace_back(std::make_shared<DataBlock>(memoryManager, DATA_BLOCK_SIZE));
     }
 }
 
-void OrderByKeyEncoder::getEncodingFunction(PhysicalTypeID physicalType, encode_function_t& func) {
+void OrderByKeyEncoder::getEncodingFunction(PhysicalTypeID physicalType, uint32_t strPrefixLength,
+    encode_function_t& func) {
     switch (physicalType) {
     case PhysicalTypeID::BOOL: {
         func = encodeTemplate<bool>;
@@ -252,7 +262,9 @@ void OrderByKeyEncoder::getEncodingFunction(PhysicalTypeID physicalType, encode_
         return;
     }
     case PhysicalTypeID::STRING: {
-        func = encodeTemplate<ku_string_t>;
+        func = [strPrefixLength](const uint8_t* data, uint8_t* resultPtr, bool /*swapBytes*/) {
+            encodeString(*(ku_string_t*)data, resultPtr, strPrefixLength);
+        };
         return;
     }
     case PhysicalTypeID::INTERVAL: {
@@ -383,15 +395,14 @@ void OrderByKeyEncoder::encodeData(interval_t data, uint8_t* resultPtr, bool swa
     encodeData(micros, resultPtr, swapBytes);
 }
 
-template<>
-void OrderByKeyEncoder::encodeData(ku_string_t data, uint8_t* resultPtr, bool /*swapBytes*/) {
+void OrderByKeyEncoder::encodeString(const ku_string_t& data, uint8_t* resultPtr,
+    uint32_t strPrefixLength) {
     // Only encode the prefix of ku_string.
-    memcpy(resultPtr, (void*)data.getAsString().c_str(),
-        std::min((uint32_t)ku_string_t::SHORT_STR_LENGTH, data.len));
-    if (ku_string_t::isShortString(data.len)) {
-        memset(resultPtr + data.len, '\0', ku_string_t::SHORT_STR_LENGTH + 1 - data.len);
+    memcpy(resultPtr, data.getData(), std::min(strPrefixLength, data.len));
+    if (data.len <= strPrefixLength) {
+        memset(resultPtr + data.len, '\0', strPrefixLength + 1 - data.len);
     } else {
-        resultPtr[12] = UINT8_MAX;
+        resultPtr[strPrefixLength] = UINT8_MAX;
     }
 }
 
@@ -12,11 +12,19 @@ void OrderByScanLocalState::init(std::vector<DataPos>& outVectorPos, SortSharedS
     for (auto& dataPos : outVectorPos) {
         vectorsToRead.push_back(resultSet.getValueVector(dataPos).get());
     }
-    payloadScanner = std::make_unique<PayloadScanner>(sharedState.getMergedKeyBlock(),
-        sharedState.getPayloadTables());
     numTuples = 0;
-    for (auto& table : sharedState.getPayloadTables()) {
-        numTuples += table->getNumTuples();
+    if (sharedState.isExternal()) {
+        runMerger = std::make_unique<SortedRunMerger>(sharedState.getSortedRuns(),
+            sharedState.getPayloadTables()[0]);
+        for (auto& run : sharedState.getSortedRuns()) {
+            numTuples += run->getNumTuples();
+        }
+    } else {
+        payloadScanner = std::make_unique<PayloadScanner>(sharedState.getMergedKeyBlock(),
+            sharedState.getPayloadTables());
+        for (auto& table : sharedState.getPayloadTables()) {
+            numTuples += table->getNumTuples();
+        }
     }
     numTuplesRead = 0;
 }
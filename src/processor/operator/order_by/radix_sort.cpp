@@ -2,6 +2,7 @@
 
 #include <algorithm>
 
+#include "common/constants.h"
 #include "common/system_config.h"
 #include "function/comparison/comparison_functions.h"
 
@@ -35,7 +36,7 @@ void RadixSort::sortSingleKeyBlock(const DataBlock& keyBlock) {
         for (auto j = 0u; j < numOfTies; j++) {
             auto keyBlockTie = ties.front();
             ties.pop();
-            radixSort(keyBlock.getData() + keyBlockTie.startingTupleIdx * numBytesPerTuple,
+            sortTuples(keyBlock.getData() + keyBlockTie.startingTupleIdx * numBytesPerTuple,
                 keyBlockTie.getNumTuples(), numBytesSorted, numBytesToSort);
 
             auto newTiesInKeyBlock =
@@ -58,12 +59,22 @@ void RadixSort::sortSingleKeyBlock(const DataBlock& keyBlock) {
         while (!ties.empty()) {
             auto tie = ties.front();
             ties.pop();
-            radixSort(keyBlock.getData() + tie.startingTupleIdx * numBytesPerTuple,
+            sortTuples(keyBlock.getData() + tie.startingTupleIdx * numBytesPerTuple,
                 tie.getNumTuples(), numBytesSorted, numBytesToRadixSort - numBytesSorted);
         }
     }
 }
 
+void RadixSort::sortTuples(uint8_t* keyBlockPtr, uint32_t numTuplesToSort,
+    uint32_t numBytesSorted, uint32_t numBytesToSort) {
+    if (numTuplesToSort < OrderByConstants::MIN_NUM_TUPLES_TO_RADIX_SORT ||
+        numBytesToSort > OrderByConstants::MAX_NUM_BYTES_TO_RADIX_SORT) {
+        comparisonSort(keyBlockPtr, numTuplesToSort, numBytesSorted, numBytesToSort);
+    } else {
+        radixSort(keyBlockPtr, numTuplesToSort, numBytesSorted, numBytesToSort);
+    }
+}
+
 void RadixSort::radixSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32_t numBytesSorted,
     uint32_t numBytesToSort) {
     // We use radixSortLSD which sorts from the least significant byte to the most significant byte.
@@ -109,6 +120,18 @@ void RadixSort::radixSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort, uint32
     }
 }
 
+void RadixSort::comparisonSort(uint8_t* keyBlockPtr, uint32_t numTuplesToSort,
+    uint32_t numBytesSorted, uint32_t numBytesToSort) {
+    auto tie = TieRange(0, numTuplesToSort - 1);
+    fillTmpTuplePtrSortingBlock(tie, keyBlockPtr);
+    auto tmpTuplePtrSortingBlockPtr = (uint8_t**)tmpTuplePtrSortingBlock->getData();
+    std::sort(tmpTuplePtrSortingBlockPtr, tmpTuplePtrSortingBlockPtr + numTuplesToSort,
+        [numBytesSorted, numBytesToSort](const uint8_t* leftPtr, const uint8_t* rightPtr) {
+            return memcmp(leftPtr + numBytesSorted, rightPtr + numBytesSorted, numBytesToSort) < 0;
+        });
+    reOrderKeyBlock(tie, keyBlockPtr);
+}
+
 std::vector<TieRange> RadixSort::findTies(uint8_t* keyBlockPtr, uint32_t numTuplesToFindTies,
     uint32_t numBytesToSort, uint32_t baseTupleIdx) const {
     std::vector<TieRange> newTiesInKeyBlock;
@@ -160,8 +183,7 @@ void RadixSort::findStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
             iTuplePtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
         // This variable will only be used when the current column is a string column. Otherwise,
         // we just set this variable to false.
-        bool isIStringLong = OrderByKeyEncoder::isLongStr(
-            iTuplePtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
+        bool isIStringLong = keyColInfo.isLongStr(iTuplePtr);
         TYPE iValue =
             isIValNull ?
                 TYPE() :
@@ -190,8 +212,7 @@ void RadixSort::findStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
                 // tuples from factorizedTable. If both left and right string are short, they
                 // must equal to each other (since they have the same prefix). If one string is
                 // short and the other string is long, then they must not equal to each other.
-                bool isJStringLong = OrderByKeyEncoder::isLongStr(
-                    jTuplePtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
+                bool isJStringLong = keyColInfo.isLongStr(jTuplePtr);
                 if (!isIStringLong && !isJStringLong) {
                     jTupleInfoPtr += numBytesPerTuple;
                     continue;
@@ -244,10 +265,8 @@ void RadixSort::solveStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
 
             // We only need to fetch the actual strings from the
             // factorizedTable when both left and right strings are long string.
-            auto isLeftLongStr = OrderByKeyEncoder::isLongStr(
-                leftPtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
-            auto isRightLongStr = OrderByKeyEncoder::isLongStr(
-                rightPtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
+            auto isLeftLongStr = keyColInfo.isLongStr(leftPtr);
+            auto isRightLongStr = keyColInfo.isLongStr(rightPtr);
             if (!isLeftLongStr && !isRightLongStr) {
                 // If left and right are both short string and have the same prefix, we can't
                 // conclude that the left string is smaller than the right string.
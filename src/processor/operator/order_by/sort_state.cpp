@@ -1,5 +1,6 @@
 #include "processor/operator/order_by/sort_state.h"
 
+#include <algorithm>
 #include <mutex>
 
 #include "common/constants.h"
@@ -19,9 +20,11 @@ void SortSharedState::init(const OrderByDataInfo& orderByDataInfo) {
             // column.
             auto ftColIdx = orderByDataInfo.keyInPayloadPos[i];
             strKeyColsInfo.emplace_back(orderByDataInfo.payloadTableSchema.getColOffset(ftColIdx),
-                encodedKeyBlockColOffset, orderByDataInfo.isAscOrder[i]);
+                encodedKeyBlockColOffset, orderByDataInfo.isAscOrder[i],
+                orderByDataInfo.strPrefixLength);
         }
-        encodedKeyBlockColOffset += OrderByKeyEncoder::getEncodingSize(dataType);
+        encodedKeyBlockColOffset +=
+            OrderByKeyEncoder::getEncodingSize(dataType, orderByDataInfo.strPrefixLength);
     }
     numBytesPerTuple = encodedKeyBlockColOffset + OrderByConstants::NUM_BYTES_FOR_PAYLOAD_IDX;
 }
@@ -48,6 +51,20 @@ void SortSharedState::combineFTHasNoNullGuarantee() {
     }
 }
 
+void SortSharedState::appendSortedRun(std::unique_ptr<SortedRun> run) {
+    std::unique_lock lck{mtx};
+    sortedRuns.push_back(std::move(run));
+}
+
+std::vector<SortedRun*> SortSharedState::getSortedRuns() const {
+    std::vector<SortedRun*> result;
+    result.reserve(sortedRuns.size());
+    for (auto& run : sortedRuns) {
+        result.push_back(run.get());
+    }
+    return result;
+}
+
 std::vector<FactorizedTable*> SortSharedState::getPayloadTables() const {
     std::vector<FactorizedTable*> payloadTablesToReturn;
     payloadTablesToReturn.reserve(payloadTables.size());
@@ -59,6 +76,8 @@ std::vector<FactorizedTable*> SortSharedState::getPayloadTables() const {
 
 void SortLocalState::init(const OrderByDataInfo& orderByDataInfo, SortSharedState& sharedState,
     storage::MemoryManager* memoryManager) {
+    this->sharedState = &sharedState;
+    this->memoryManager = memoryManager;
     auto [idx, table] =
         sharedState.getLocalPayloadTable(*memoryManager, orderByDataInfo.payloadTableSchema);
     globalIdx = idx;
@@ -73,9 +92,63 @@ void SortLocalState::append(const std::vector<common::ValueVector*>& keyVectors,
     const std::vector<common::ValueVector*>& payloadVectors) {
     orderByKeyEncoder->encodeKeys(keyVectors);
     payloadTable->append(payloadVectors);
+    if (sharedState->isExternal()) {
+        auto numBytesPerTuple = payloadTable->getTableSchema()->getNumBytesPerTuple() +
+                                orderByKeyEncoder->getNumBytesPerTuple();
+        if (payloadTable->getNumTuples() * numBytesPerTuple >= sharedState->getRunSize()) {
+            flushRun();
+        }
+    }
+}
+
+void SortLocalState::flushRun() {
+    auto numBytesPerTuple = orderByKeyEncoder->getNumBytesPerTuple();
+    auto numBytesPerKey = numBytesPerTuple - OrderByConstants::NUM_BYTES_FOR_PAYLOAD_IDX;
+    // Key blocks are sorted one by one and then merged into the run through a min-heap over the
+    // next key of each block.
+    std::vector<std::pair<uint8_t*, uint8_t*>> blockCursors;
+    for (auto& keyBlock : orderByKeyEncoder->getKeyBlocks()) {
+        if (keyBlock->numTuples > 0) {
+            radixSorter->sortSingleKeyBlock(*keyBlock);
+            blockCursors.emplace_back(keyBlock->getData(),
+                keyBlock->getData() + keyBlock->numTuples * numBytesPerTuple);
+        }
+    }
+    auto isAfter = [&](const auto& left, const auto& right) {
+        return memcmp(left.first, right.first, numBytesPerKey) > 0;
+    };
+    std::make_heap(blockCursors.begin(), blockCursors.end(), isAfter);
+    auto run = std::make_unique<SortedRun>(*memoryManager, numBytesPerKey,
+        payloadTable->getTableSchema()->getNumBytesPerTuple());
+    while (!blockCursors.empty()) {
+        std::pop_heap(blockCursors.begin(), blockCursors.end(), isAfter);
+        auto& cursor = blockCursors.back();
+        auto payloadInfo = cursor.first + numBytesPerKey;
+        auto tupleIdx = OrderByKeyEncoder::getEncodedFTBlockIdx(payloadInfo) *
+                            payloadTable->getNumTuplesPerBlock() +
+                        OrderByKeyEncoder::getEncodedFTBlockOffset(payloadInfo);
+        run->append(cursor.first, payloadTable->getTuple(tupleIdx));
+        cursor.first += numBytesPerTuple;
+        if (cursor.first == cursor.second) {
+            blockCursors.pop_back();
+        } else {
+            std::push_heap(blockCursors.begin(), blockCursors.end(), isAfter);
+        }
+    }
+    run->finish();
+    sharedState->appendSortedRun(std::move(run));
+    payloadTable->clear();
+    orderByKeyEncoder->reset();
 }
 
 void SortLocalState::finalize(ryu::processor::SortSharedState& sharedState) {
+    if (sharedState.isExternal()) {
+        if (payloadTable->getNumTuples() > 0) {
+            flushRun();
+        }
+        orderByKeyEncoder->clear();
+        return;
+    }
     for (auto& keyBlock : orderByKeyEncoder->getKeyBlocks()) {
         if (keyBlock->numTuples > 0) {
             radixSorter->sortSingleKeyBlock(*keyBlock);
@@ -0,0 +1,137 @@
+#include "processor/operator/order_by/sorted_run.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "common/exception/runtime.h"
+#include "common/string_format.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
+
+using namespace ryu::common;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace processor {
+
+SortedRun::SortedRun(MemoryManager& memoryManager, uint32_t numBytesPerKey,
+    uint32_t numBytesPerPayload)
+    : memoryManager{memoryManager}, numBytesPerKey{numBytesPerKey},
+      numBytesPerTuple{numBytesPerKey + numBytesPerPayload}, numTuples{0}, numBlocksReached{0} {
+    numTuplesPerBlock = TEMP_PAGE_SIZE / numBytesPerTuple;
+    if (numTuplesPerBlock == 0) {
+        throw RuntimeException(
+            stringFormat("TupleSize({} bytes) is larger than the TEMP_PAGE_SIZE({} bytes)",
+                numBytesPerTuple, TEMP_PAGE_SIZE));
+    }
+}
+
+SortedRun::~SortedRun() {
+    memoryManager.getBufferManager()->getSpillerOrSkip(
+        [&](auto& spiller) { spiller.clearUnusedChunk(this); });
+}
+
+void SortedRun::append(const uint8_t* key, const uint8_t* payload) {
+    if (blocks.empty() || blocks.back()->numTuples == numTuplesPerBlock) {
+        blocks.push_back(std::make_unique<DataBlock>(&memoryManager, TEMP_PAGE_SIZE));
+    }
+    auto& block = *blocks.back();
+    auto tuple = block.getData() + block.numTuples * numBytesPerTuple;
+    memcpy(tuple, key, numBytesPerKey);
+    memcpy(tuple + numBytesPerKey, payload, numBytesPerTuple - numBytesPerKey);
+    block.numTuples++;
+    block.freeSize -= numBytesPerTuple;
+    numTuples++;
+}
+
+void SortedRun::finish() {
+    memoryManager.getBufferManager()->getSpillerOrSkip(
+        [&](auto& spiller) { spiller.addUnusedChunk(this); });
+}
+
+uint8_t* SortedRun::getTuple(uint64_t tupleIdx) {
+    KU_ASSERT(tupleIdx < numTuples);
+    auto blockIdx = tupleIdx / numTuplesPerBlock;
+    if (blockIdx >= numBlocksReached) {
+        {
+            std::unique_lock lck{mtx};
+            numBlocksReached = blockIdx + 1;
+        }
+        // Loading allocates memory, which may spill other objects, so it is done without holding
+        // mtx. The block can't be spilled anymore once it has been reached.
+        auto& block = *blocks[blockIdx];
+        if (block.isSpilled()) {
+            memoryManager.getBufferManager()->getSpillerOrSkip(
+                [&](auto& spiller) { block.loadFromDisk(spiller); });
+        }
+    }
+    return blocks[blockIdx]->getData() + (tupleIdx % numTuplesPerBlock) * numBytesPerTuple;
+}
+
+void SortedRun::releaseBlocksBefore(uint64_t tupleIdx) {
+    auto numBlocksToRelease = std::min<uint64_t>(tupleIdx / numTuplesPerBlock, numBlocksReached);
+    for (auto i = 0u; i < numBlocksToRelease; i++) {
+        blocks[i].reset();
+    }
+}
+
+SpillResult SortedRun::spillToDisk() {
+    std::unique_lock lck{mtx};
+    SpillResult result;
+    memoryManager.getBufferManager()->getSpillerOrSkip([&](auto& spiller) {
+        for (auto i = numBlocksReached; i < blocks.size(); i++) {
+            result += blocks[i]->spillToDisk(spiller);
+        }
+    });
+    return result;
+}
+
+SortedRunMerger::SortedRunMerger(std::vector<SortedRun*> runs, FactorizedTable* payloadTable)
+    : payloadTable{payloadTable}, numBytesPerKey{0} {
+    for (auto run : runs) {
+        if (run->getNumTuples() > 0) {
+            numBytesPerKey = run->getNumBytesPerKey();
+            cursors.push_back(RunCursor{run, 0 /* nextTupleIdx */, run->getTuple(0)});
+        }
+    }
+    std::make_heap(cursors.begin(), cursors.end(),
+        [&](const auto& left, const auto& right) { return isAfter(left, right); });
+    colsToScan = std::vector<uint32_t>(payloadTable->getTableSchema()->getNumColumns());
+    std::iota(colsToScan.begin(), colsToScan.end(), 0);
+    tuplesToRead = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+}
+
+uint64_t SortedRunMerger::scan(std::vector<ValueVector*> vectorsToRead) {
+    // Rows returned by the previous scan have been read into the vectors, so the blocks holding
+    // them can be freed.
+    for (auto& cursor : cursors) {
+        cursor.run->releaseBlocksBefore(cursor.nextTupleIdx);
+    }
+    auto maxNumTuplesToRead = DEFAULT_VECTOR_CAPACITY;
+    for (auto& vector : vectorsToRead) {
+        if (vector->state->isFlat()) {
+            maxNumTuplesToRead = 1;
+        }
+    }
+    auto isAfterFunc = [&](const auto& left, const auto& right) { return isAfter(left, right); };
+    auto numTuplesRead = 0u;
+    while (numTuplesRead < maxNumTuplesToRead && !cursors.empty()) {
+        std::pop_heap(cursors.begin(), cursors.end(), isAfterFunc);
+        auto& cursor = cursors.back();
+        tuplesToRead[numTuplesRead++] = cursor.tuple + numBytesPerKey;
+        if (++cursor.nextTupleIdx == cursor.run->getNumTuples()) {
+            cursors.pop_back();
+        } else {
+            cursor.tuple = cursor.run->getTuple(cursor.nextTupleIdx);
+            std::push_heap(cursors.begin(), cursors.end(), isAfterFunc);
+        }
+    }
+    if (numTuplesRead > 0) {
+        payloadTable->lookup(vectorsToRead, colsToScan, tuplesToRead.get(), 0, numTuplesRead);
+    }
+    return numTuplesRead;
+}
+
+} // namespace processor
+} // namespace ryu
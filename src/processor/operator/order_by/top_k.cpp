@@ -81,11 +81,11 @@ void TopKBuffer::append(const std::vector<common::ValueVector*>& keyVectors,
     keyVectors[0]->state->setSelVector(originalSelState);
 }
 
-void TopKBuffer::reduce() {
+bool TopKBuffer::reduce() {
     auto reduceThreshold = std::max(OrderByConfig::MIN_SIZE_TO_REDUCE,
         OrderByConstants::MIN_LIMIT_RATIO_TO_REDUCE * (limit + skip));
     if (sortState->getNumTuples() < reduceThreshold) {
-        return;
+        return false;
     }
     sortState->finalize();
     auto newSortState = std::make_unique<TopKSortState>();
@@ -102,6 +102,7 @@ void TopKBuffer::reduce() {
         std::swap(keyVecsToScan, lastKeyVecsToScan);
     }
     sortState = std::move(newSortState);
+    return true;
 }
 
 void TopKBuffer::merge(TopKBuffer* other) {
@@ -246,22 +247,27 @@ void TopKBuffer::appendSelState(common::SelectionVector* selVector,
 
 void TopKLocalState::init(const OrderByDataInfo& orderByDataInfo,
     storage::MemoryManager* memoryManager, ResultSet& /*resultSet*/, uint64_t skipNumber,
-    uint64_t limitNumber) {
+    uint64_t limitNumber, std::shared_ptr<storage::DynamicBound> bound_) {
     buffer = std::make_unique<TopKBuffer>(orderByDataInfo);
     buffer->init(memoryManager, skipNumber, limitNumber);
+    bound = std::move(bound_);
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
 void TopKLocalState::append(const std::vector<common::ValueVector*>& keyVectors,
     const std::vector<common::ValueVector*>& payloadVectors) {
     buffer->append(keyVectors, payloadVectors);
-    buffer->reduce();
+    // The local buffer holds at least skip + limit tuples up to its boundary, so tuples after the
+    // boundary can't be among the global top tuples either.
+    if (buffer->reduce() && bound != nullptr && buffer->hasBoundaryValue) {
+        bound->tighten(*buffer->getBoundaryValue());
+    }
 }
 
 void TopK::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     localState = TopKLocalState();
     localState.init(info, storage::MemoryManager::Get(*context->clientContext), *resultSet,
-        skipNumber, limitNumber);
+        skipNumber, limitNumber, bound);
     for (auto& dataPos : info.payloadsPos) {
         payloadVectors.push_back(resultSet->getValueVector(dataPos).get());
     }
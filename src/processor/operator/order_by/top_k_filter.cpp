@@ -0,0 +1,49 @@
+#include "processor/operator/order_by/top_k_filter.h"
+
+#include "common/type_utils.h"
+
+using namespace ryu::common;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace processor {
+
+template<typename T>
+static bool selectInBound(ValueVector& keyVector, ExpressionType expressionType, T bound) {
+    auto& state = *keyVector.state;
+    if (state.isFlat()) {
+        // Positions of flat states are owned by the operators flattening them, so a flat key is
+        // only checked.
+        const auto pos = state.getSelVector()[0];
+        return keyVector.isNull(pos) ||
+               DynamicBound::satisfies(expressionType, keyVector.getValue<T>(pos), bound);
+    }
+    auto& selVector = state.getSelVectorUnsafe();
+    const auto numKeys = selVector.getSelSize();
+    auto buffer = selVector.getMutableBuffer();
+    sel_t numSelected = 0;
+    for (auto i = 0u; i < numKeys; i++) {
+        const auto pos = selVector[i];
+        buffer[numSelected] = pos;
+        numSelected += keyVector.isNull(pos) ||
+                       DynamicBound::satisfies(expressionType, keyVector.getValue<T>(pos), bound);
+    }
+    selVector.setToFiltered(numSelected);
+    return numSelected > 0;
+}
+
+bool TopKFilterProber::select() {
+    auto value = bound->getValue();
+    if (value == nullptr) {
+        return true;
+    }
+    auto expressionType = bound->getExpressionType();
+    return TypeUtils::visit(
+        keyVector->dataType.getPhysicalType(),
+        [&]<NumericTypes T>(
+            T) { return selectInBound(*keyVector, expressionType, value->getValue<T>()); },
+        [](auto) { return true; });
+}
+
+} // namespace processor
+} // namespace ryu
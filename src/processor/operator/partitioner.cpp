@@ -171,14 +171,23 @@ void Partitioner::copyDataToPartitions(MemoryManager& memoryManager,
     for (auto j = 0u; j < chunkToCopyFrom.getNumValueVectors(); j++) {
         vectorsToAppend.push_back(&chunkToCopyFrom.getValueVectorMutable(j));
     }
-    for (auto i = 0u; i < chunkToCopyFrom.state->getSelVector().getSelSize(); i++) {
-        const auto posToCopyFrom = chunkToCopyFrom.state->getSelVector()[i];
-        const auto partitionIdx = partitionIdxes->getValue<partition_idx_t>(posToCopyFrom);
+    const auto& selVector = chunkToCopyFrom.state->getSelVector();
+    const auto numRows = selVector.getSelSize();
+    // Rels are usually grouped by their bound node, so consecutive rows tend to go to the same
+    // partition. Each run of them is appended at once instead of row by row.
+    for (auto i = 0u; i < numRows;) {
+        const auto partitionIdx = partitionIdxes->getValue<partition_idx_t>(selVector[i]);
+        auto runEnd = i + 1;
+        while (runEnd < numRows &&
+               partitionIdxes->getValue<partition_idx_t>(selVector[runEnd]) == partitionIdx) {
+            runEnd++;
+        }
         KU_ASSERT(
             partitionIdx < localState->getPartitioningBuffer(partitioningIdx)->partitions.size());
         const auto& partition =
             localState->getPartitioningBuffer(partitioningIdx)->partitions[partitionIdx];
-        partition->append(memoryManager, vectorsToAppend, i, 1);
+        partition->append(memoryManager, vectorsToAppend, i, runEnd - i);
+        i = runEnd;
     }
 }
 
@@ -0,0 +1,100 @@
+#include "processor/operator/path_node_predicate_mask.h"
+
+#include "binder/expression/expression_util.h"
+#include "binder/expression/property_expression.h"
+#include "binder/expression_visitor.h"
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "processor/expression_mapper.h"
+#include "processor/result/result_set_descriptor.h"
+#include "storage/storage_manager.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::binder;
+using namespace ryu::common;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace processor {
+
+static NodeTable& getNodeTable(const main::ClientContext& context, table_id_t tableID) {
+    return StorageManager::Get(context)->getTable(tableID)->cast<NodeTable>();
+}
+
+PathNodePredicateMask::PathNodePredicateMask(main::ClientContext* context,
+    const NodeExpression& node, table_id_t tableID, const std::shared_ptr<Expression>& predicate)
+    : SemiMask{getNodeTable(*context, tableID).getNumTotalRows(
+          transaction::Transaction::Get(*context))},
+      context{context}, table{getNodeTable(*context, tableID)} {
+    auto collector = PropertyExprCollector();
+    collector.visit(predicate);
+    const auto properties = ExpressionUtil::removeDuplication(collector.getPropertyExprs());
+    // Nodes are looked up one at a time.
+    const auto groupPos = schema.createGroup();
+    schema.setGroupAsSingleState(groupPos);
+    schema.insertToGroupAndScope(node.getInternalID(), groupPos);
+    schema.insertToGroupAndScope(properties, groupPos);
+    auto descriptor = ResultSetDescriptor(&schema);
+    resultSet = std::make_unique<ResultSet>(&descriptor, MemoryManager::Get(*context));
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto tableEntry = catalog::Catalog::Get(*context)->getTableCatalogEntry(transaction,
+        tableID);
+    std::vector<column_id_t> columnIDs;
+    std::vector<ValueVector*> outVectors;
+    for (auto& property : properties) {
+        auto& propertyExpr = property->constCast<PropertyExpression>();
+        columnIDs.push_back(propertyExpr.hasProperty(tableID) ?
+                                tableEntry->getColumnID(propertyExpr.getPropertyName()) :
+                                INVALID_COLUMN_ID);
+        outVectors.push_back(
+            resultSet->getValueVector(DataPos(schema.getExpressionPos(*property))).get());
+    }
+    const auto nodeIDVector =
+        resultSet->getValueVector(DataPos(schema.getExpressionPos(*node.getInternalID())));
+    scanState = std::make_unique<NodeTableScanState>(nodeIDVector.get(), std::move(outVectors),
+        nodeIDVector->state);
+    scanState->setToTable(transaction, &table, std::move(columnIDs));
+    predicateEvaluator = ExpressionMapper(&schema).getEvaluator(predicate);
+    predicateEvaluator->init(*resultSet, context);
+    enable();
+}
+
+bool PathNodePredicateMask::isMasked(offset_t nodeOffset) {
+    std::unique_lock lck{mtx};
+    if (const auto it = results.find(nodeOffset); it != results.end()) {
+        return it->second;
+    }
+    const auto result = evaluate(nodeOffset);
+    results.emplace(nodeOffset, result);
+    return result;
+}
+
+uint64_t PathNodePredicateMask::getNumMaskedNodes() const {
+    std::unique_lock lck{mtx};
+    uint64_t numMaskedNodes = 0;
+    for (auto& [nodeOffset, result] : results) {
+        numMaskedNodes += result;
+    }
+    return numMaskedNodes;
+}
+
+bool PathNodePredicateMask::evaluate(offset_t nodeOffset) {
+    const auto transaction = transaction::Transaction::Get(*context);
+    const auto tableID = table.getTableID();
+    scanState->nodeIDVector->setValue<nodeID_t>(0, nodeID_t{nodeOffset, tableID});
+    for (auto& vector : scanState->outputVectors) {
+        vector->resetAuxiliaryBuffer();
+    }
+    table.initScanState(transaction, *scanState, tableID, nodeOffset);
+    // Deleted nodes don't satisfy any predicate.
+    if (!table.lookup(transaction, *scanState)) {
+        return false;
+    }
+    predicateEvaluator->evaluate();
+    const auto& resultVector = *predicateEvaluator->resultVector;
+    const auto pos = resultVector.state->getSelVector()[0];
+    return !resultVector.isNull(pos) && resultVector.getValue<bool>(pos);
+}
+
+} // namespace processor
+} // namespace ryu
@@ -1,7 +1,12 @@
 #include "processor/operator/persistent/copy_rel_batch_insert.h"
 
+#include <algorithm>
+
+#include "common/type_utils.h"
+#include "storage/buffer_manager/memory_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/table/csr_chunked_node_group.h"
+#include "storage/table/csr_node_group.h"
 
 namespace ryu {
 namespace processor {
@@ -15,44 +20,67 @@ static void setOffsetToWithinNodeGroup(storage::ColumnChunkData& chunk,
     }
 }
 
+template<typename FUNC>
+static void forEachChunkedGroup(storage::MemoryManager& mm,
+    storage::InMemChunkedNodeGroupCollection& partition, FUNC func) {
+    for (auto& chunkedGroup : partition.getChunkedGroups()) {
+        chunkedGroup->loadFromDisk(mm);
+        func(*chunkedGroup);
+        chunkedGroup->setUnused(mm);
+    }
+}
+
+CopyRelBatchInsertExecutionState::~CopyRelBatchInsertExecutionState() {
+    if (!partitioningBuffer) {
+        return;
+    }
+    // Groups which haven't been written because of an error may still be spilled otherwise.
+    for (auto& chunkedGroup : partitioningBuffer->getChunkedGroups()) {
+        if (chunkedGroup) {
+            chunkedGroup->clearUnused(*mm);
+        }
+    }
+}
+
 std::unique_ptr<RelBatchInsertExecutionState> CopyRelBatchInsert::initExecutionState(
     const PartitionerSharedState& partitionerSharedState, const RelBatchInsertInfo& relInfo,
     common::node_group_idx_t nodeGroupIdx) {
     auto executionState = std::make_unique<CopyRelBatchInsertExecutionState>();
+    auto& copySharedState = partitionerSharedState.constCast<CopyPartitionerSharedState>();
     executionState->partitioningBuffer =
-        partitionerSharedState.constCast<CopyPartitionerSharedState>().getPartitionBuffer(
-            relInfo.partitioningIdx, nodeGroupIdx);
-    const auto startNodeOffset = storage::StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
-    for (auto& chunkedGroup : executionState->partitioningBuffer->getChunkedGroups()) {
-        setOffsetToWithinNodeGroup(chunkedGroup->getColumnChunk(relInfo.boundNodeOffsetColumnID),
-            startNodeOffset);
-    }
+        copySharedState.getPartitionBuffer(relInfo.partitioningIdx, nodeGroupIdx);
+    executionState->mm = &copySharedState.mm;
+    executionState->startNodeOffset =
+        storage::StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
     return executionState;
 }
 
-void CopyRelBatchInsert::populateCSRLengthsInternal(const storage::InMemChunkedCSRHeader& csrHeader,
-    common::offset_t numNodes, storage::InMemChunkedNodeGroupCollection& partition,
-    common::column_id_t boundNodeOffsetColumn) {
+void CopyRelBatchInsert::populateCSRLengthsInternal(storage::MemoryManager& mm,
+    const storage::InMemChunkedCSRHeader& csrHeader, common::offset_t numNodes,
+    storage::InMemChunkedNodeGroupCollection& partition, common::column_id_t boundNodeOffsetColumn,
+    common::offset_t startNodeOffset) {
     KU_ASSERT(numNodes == csrHeader.length->getNumValues() &&
               numNodes == csrHeader.offset->getNumValues());
     const auto lengthData = reinterpret_cast<common::length_t*>(csrHeader.length->getData());
     std::fill(lengthData, lengthData + numNodes, 0);
-    for (auto& chunkedGroup : partition.getChunkedGroups()) {
-        auto& offsetChunk = chunkedGroup->getColumnChunk(boundNodeOffsetColumn);
+    forEachChunkedGroup(mm, partition, [&](storage::InMemChunkedNodeGroup& chunkedGroup) {
+        auto& offsetChunk = chunkedGroup.getColumnChunk(boundNodeOffsetColumn);
+        setOffsetToWithinNodeGroup(offsetChunk, startNodeOffset);
         for (auto i = 0u; i < offsetChunk.getNumValues(); i++) {
             const auto nodeOffset = offsetChunk.getValue<common::offset_t>(i);
             KU_ASSERT(nodeOffset < numNodes);
             lengthData[nodeOffset]++;
         }
-    }
+    });
 }
 
 void CopyRelBatchInsert::populateCSRLengths(RelBatchInsertExecutionState& executionState,
     storage::InMemChunkedCSRHeader& csrHeader, common::offset_t numNodes,
     const RelBatchInsertInfo& relInfo) {
     auto& copyRelExecutionState = executionState.cast<CopyRelBatchInsertExecutionState>();
-    populateCSRLengthsInternal(csrHeader, numNodes, *copyRelExecutionState.partitioningBuffer,
-        relInfo.boundNodeOffsetColumnID);
+    populateCSRLengthsInternal(*copyRelExecutionState.mm, csrHeader, numNodes,
+        *copyRelExecutionState.partitioningBuffer, relInfo.boundNodeOffsetColumnID,
+        copyRelExecutionState.startNodeOffset);
 }
 
 void CopyRelBatchInsert::setRowIdxFromCSROffsets(storage::ColumnChunkData& rowIdxChunk,
@@ -67,21 +95,86 @@ void CopyRelBatchInsert::setRowIdxFromCSROffsets(storage::ColumnChunkData& rowId
     }
 }
 
+namespace {
+struct PartitionedRel {
+    common::idx_t chunkedGroupIdx;
+    common::row_idx_t rowIdx;
+    common::offset_t nodeOffset;
+};
+} // namespace
+
+void CopyRelBatchInsert::setRowIdxFromSortedCSROffsets(storage::MemoryManager& mm,
+    storage::InMemChunkedNodeGroupCollection& partition, common::column_id_t boundNodeOffsetColumn,
+    common::column_id_t sortColumn, storage::ColumnChunkData& csrOffsetChunk) {
+    auto& chunkedGroups = partition.getChunkedGroups();
+    if (chunkedGroups.empty()) {
+        return;
+    }
+    // Sorting reads the keys of all rels in random order, so the whole partition is loaded.
+    partition.loadFromDisk(mm);
+    std::vector<PartitionedRel> rels;
+    for (auto i = 0u; i < chunkedGroups.size(); i++) {
+        auto& offsetChunk = chunkedGroups[i]->getColumnChunk(boundNodeOffsetColumn);
+        for (auto row = 0u; row < offsetChunk.getNumValues(); row++) {
+            rels.push_back(PartitionedRel{i, row, offsetChunk.getValue<common::offset_t>(row)});
+        }
+    }
+    const auto sortKeyType =
+        chunkedGroups[0]->getColumnChunk(sortColumn).getDataType().getPhysicalType();
+    common::TypeUtils::visit(
+        sortKeyType,
+        [&]<storage::CSRSortKey T>(T) {
+            auto readKey = [&](const PartitionedRel& rel) {
+                return storage::CSRSortKeyValue<T>::read(
+                    chunkedGroups[rel.chunkedGroupIdx]->getColumnChunk(sortColumn), rel.rowIdx);
+            };
+            // Stable so that rels with equal keys keep the order in which they were copied.
+            std::stable_sort(rels.begin(), rels.end(), [&](const auto& a, const auto& b) {
+                if (a.nodeOffset != b.nodeOffset) {
+                    return a.nodeOffset < b.nodeOffset;
+                }
+                return readKey(a) < readKey(b);
+            });
+        },
+        [](auto) { KU_UNREACHABLE; });
+    for (auto& rel : rels) {
+        const auto csrOffset = csrOffsetChunk.getValue<common::offset_t>(rel.nodeOffset);
+        chunkedGroups[rel.chunkedGroupIdx]
+            ->getColumnChunk(boundNodeOffsetColumn)
+            .setValue<common::offset_t>(csrOffset, rel.rowIdx);
+        csrOffsetChunk.setValue<common::offset_t>(csrOffset + 1, rel.nodeOffset);
+    }
+    for (auto& chunkedGroup : chunkedGroups) {
+        chunkedGroup->setUnused(mm);
+    }
+}
+
 void CopyRelBatchInsert::finalizeStartCSROffsets(RelBatchInsertExecutionState& executionState,
     storage::InMemChunkedCSRHeader& csrHeader, const RelBatchInsertInfo& relInfo) {
     auto& copyRelExecutionState = executionState.cast<CopyRelBatchInsertExecutionState>();
-    for (auto& chunkedGroup : copyRelExecutionState.partitioningBuffer->getChunkedGroups()) {
-        auto& offsetChunk = chunkedGroup->getColumnChunk(relInfo.boundNodeOffsetColumnID);
-        // We reuse bound node offset column to store row idx for each rel in the node group.
-        setRowIdxFromCSROffsets(offsetChunk, *csrHeader.offset);
+    if (relInfo.sortColumnID != common::INVALID_COLUMN_ID) {
+        setRowIdxFromSortedCSROffsets(*copyRelExecutionState.mm,
+            *copyRelExecutionState.partitioningBuffer, relInfo.boundNodeOffsetColumnID,
+            relInfo.sortColumnID, *csrHeader.offset);
+        return;
     }
+    forEachChunkedGroup(*copyRelExecutionState.mm, *copyRelExecutionState.partitioningBuffer,
+        [&](storage::InMemChunkedNodeGroup& chunkedGroup) {
+            auto& offsetChunk = chunkedGroup.getColumnChunk(relInfo.boundNodeOffsetColumnID);
+            // We reuse bound node offset column to store row idx for each rel in the node group.
+            setRowIdxFromCSROffsets(offsetChunk, *csrHeader.offset);
+        });
 }
 
 void CopyRelBatchInsert::writeToTable(RelBatchInsertExecutionState& executionState,
     const storage::InMemChunkedCSRHeader&, const RelBatchInsertLocalState& localState,
     BatchInsertSharedState& sharedState, const RelBatchInsertInfo& relInfo) {
     auto& copyRelExecutionState = executionState.cast<CopyRelBatchInsertExecutionState>();
-    for (auto& chunkedGroup : copyRelExecutionState.partitioningBuffer->getChunkedGroups()) {
+    auto& partition = *copyRelExecutionState.partitioningBuffer;
+    for (auto i = 0u; i < partition.getNumChunkedGroups(); i++) {
+        // This is the last pass over the group, so it is freed once written.
+        const auto chunkedGroup = partition.moveChunkedGroup(i);
+        chunkedGroup->loadFromDisk(*copyRelExecutionState.mm);
         sharedState.incrementNumRows(chunkedGroup->getNumRows());
         // we reused the bound node offset column to store row idx
         // the row idx column determines which rows to write each entry in the chunked group to
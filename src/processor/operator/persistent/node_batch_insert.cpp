@@ -1,9 +1,15 @@
 #include "processor/operator/persistent/node_batch_insert.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+
 #include "catalog/catalog_entry/node_table_catalog_entry.h"
 #include "common/cast.h"
+#include "common/copy_constructors.h"
 #include "common/finally_wrapper.h"
 #include "common/string_format.h"
+#include "common/task_system/task_scheduler.h"
 #include "processor/execution_context.h"
 #include "processor/operator/persistent/index_builder.h"
 #include "processor/result/factorized_table_util.h"
@@ -23,6 +29,101 @@ using namespace ryu::transaction;
 namespace ryu {
 namespace processor {
 
+// Writes a full node group of a COPY thread on a worker of the task scheduler.
+class NodeGroupWriteTask final : public Task {
+public:
+    using write_func_t = std::function<void(std::unique_ptr<InMemChunkedNodeGroup>&)>;
+
+    NodeGroupWriteTask(const write_func_t& writeFunc,
+        std::unique_ptr<InMemChunkedNodeGroup> nodeGroup)
+        : Task{1 /* maxNumThreads */}, writeFunc{writeFunc}, nodeGroup{std::move(nodeGroup)} {}
+
+    void run() override {
+        if (!cancelled) {
+            writeFunc(nodeGroup);
+        }
+    }
+    std::string getTraceName() const override { return "NodeGroupWrite"; }
+
+    void cancel() { cancelled = true; }
+    std::unique_ptr<InMemChunkedNodeGroup> moveNodeGroup() { return std::move(nodeGroup); }
+
+private:
+    write_func_t writeFunc;
+    std::unique_ptr<InMemChunkedNodeGroup> nodeGroup;
+    std::atomic<bool> cancelled{false};
+};
+
+// Hands the full node groups of a COPY thread to the task scheduler, so that compressing and
+// flushing a node group and inserting its keys into the primary key index overlap with scanning
+// and evaluating the rows of the next node group whenever a worker is idle. A write that no worker
+// has picked up by the time the next node group is full is done by the COPY thread itself. Only
+// one node group is written at a time, which bounds the memory of a COPY thread to two node
+// groups.
+class NodeGroupWriter {
+public:
+    NodeGroupWriter(NodeGroupWriteTask::write_func_t writeFunc, ExecutionContext* context)
+        : writeFunc{std::move(writeFunc)}, context{context},
+          taskScheduler{TaskScheduler::Get(*context->clientContext)} {}
+    DELETE_COPY_AND_MOVE(NodeGroupWriter);
+
+    ~NodeGroupWriter() { cancel(); }
+
+    // Hands over a node group to be written. Returns an empty node group to append the next rows
+    // into, or nullptr if no written node group can be reused yet.
+    std::unique_ptr<InMemChunkedNodeGroup> write(std::unique_ptr<InMemChunkedNodeGroup> nodeGroup) {
+#ifdef __SINGLE_THREADED__
+        writeFunc(nodeGroup);
+        return nodeGroup;
+#else
+        auto writtenGroup = wait();
+        task = std::make_shared<NodeGroupWriteTask>(writeFunc, std::move(nodeGroup));
+        scheduledTask = taskScheduler->scheduleTask(task, context);
+        return writtenGroup;
+#endif
+    }
+
+    // Waits until the node group handed over last has been written and returns it.
+    std::unique_ptr<InMemChunkedNodeGroup> wait() {
+#ifdef __SINGLE_THREADED__
+        return nullptr;
+#else
+        if (task == nullptr) {
+            return nullptr;
+        }
+        auto writeTask = std::move(task);
+        auto scheduledWriteTask = std::move(scheduledTask);
+        taskScheduler->runOrWaitTaskOrError(scheduledWriteTask);
+        return writeTask->moveNodeGroup();
+#endif
+    }
+
+    // Skips the node group handed over last unless its write already started, and waits for it.
+    // Used when the COPY fails, so that nothing is written after the failure.
+    void cancel() {
+        if (task == nullptr) {
+            return;
+        }
+        task->cancel();
+        try {
+            wait();
+        } catch (...) {} // NOLINT
+    }
+
+private:
+    NodeGroupWriteTask::write_func_t writeFunc;
+    ExecutionContext* context;
+    TaskScheduler* taskScheduler;
+    std::shared_ptr<NodeGroupWriteTask> task;
+    std::shared_ptr<ScheduledTask> scheduledTask;
+};
+
+NodeBatchInsertLocalState::NodeBatchInsertLocalState(
+    std::span<common::LogicalType> outputDataTypes)
+    : stats{outputDataTypes} {}
+
+NodeBatchInsertLocalState::~NodeBatchInsertLocalState() = default;
+
 std::string NodeBatchInsertPrintInfo::toString() const {
     std::string result = "Table Name: ";
     result += tableName;
@@ -95,6 +196,47 @@ void NodeBatchInsert::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
             nodeInfo->columnTypes, info->compressionEnabled, StorageConfig::NODE_GROUP_SIZE, 0);
     KU_ASSERT(resultSet->dataChunks[0]);
     nodeLocalState->columnState = resultSet->dataChunks[0]->state;
+    if (nodeInfo->updateOnConflict) {
+        initUpsertState(context);
+    }
+    const auto transaction = Transaction::Get(*context->clientContext);
+    const auto mm = MemoryManager::Get(*context->clientContext);
+    nodeLocalState->nodeGroupWriter = std::make_unique<NodeGroupWriter>(
+        [this, transaction, mm, nodeLocalState](std::unique_ptr<InMemChunkedNodeGroup>& nodeGroup) {
+            // Rows which don't fit into the last node group of the table are written to the next
+            // one right away, so that the node group can be reused once it is empty.
+            while (nodeGroup->getNumRows() > 0) {
+                writeAndResetNodeGroup(transaction, nodeGroup, nodeLocalState->localIndexBuilder,
+                    mm, *nodeLocalState->optimisticAllocator);
+            }
+        },
+        context);
+}
+
+void NodeBatchInsert::initUpsertState(ExecutionContext* context) const {
+    const auto nodeInfo = info->ptrCast<NodeBatchInsertInfo>();
+    const auto nodeSharedState = sharedState->ptrCast<NodeBatchInsertSharedState>();
+    const auto nodeLocalState = localState->ptrCast<NodeBatchInsertLocalState>();
+    const auto& nodeTable = sharedState->table->cast<NodeTable>();
+    const auto mm = MemoryManager::Get(*context->clientContext);
+    const auto upsertState = DataChunkState::getSingleValueDataChunkState();
+    nodeLocalState->upsertNodeIDVector =
+        std::make_unique<ValueVector>(LogicalType::INTERNAL_ID(), mm);
+    nodeLocalState->upsertNodeIDVector->setState(upsertState);
+    for (auto i = 0u; i < nodeInfo->outputDataColumns.size(); i++) {
+        auto propertyVector = std::make_unique<ValueVector>(nodeInfo->columnTypes[i].copy(), mm);
+        propertyVector->setState(upsertState);
+        std::unique_ptr<NodeTableUpdateState> updateState;
+        // The primary key of an existing node is the key being matched, so it is left as is
+        if (nodeInfo->insertColumnIDs[i] != nodeSharedState->pkColumnID) {
+            updateState = std::make_unique<NodeTableUpdateState>(nodeInfo->insertColumnIDs[i],
+                *nodeLocalState->upsertNodeIDVector, *propertyVector);
+            nodeTable.initUpdateState(context->clientContext, *updateState);
+        }
+        nodeLocalState->upsertPropertyVectors.push_back(std::move(propertyVector));
+        nodeLocalState->upsertUpdateStates.push_back(std::move(updateState));
+    }
+    nodeLocalState->insertSelVector = std::make_shared<SelectionVector>(DEFAULT_VECTOR_CAPACITY);
 }
 
 void NodeBatchInsert::executeInternal(ExecutionContext* context) {
@@ -105,6 +247,8 @@ void NodeBatchInsert::executeInternal(ExecutionContext* context) {
         token = nodeLocalState->localIndexBuilder->getProducerToken();
     }
     auto transaction = Transaction::Get(*clientContext);
+    // Nothing may be written in the background once the COPY failed.
+    FinallyWrapper writerCanceller{[&] { nodeLocalState->nodeGroupWriter->cancel(); }};
     while (children[0]->getNextTuple(context)) {
         const auto originalSelVector = nodeLocalState->columnState->getSelVectorShared();
         // Evaluate expressions if needed.
@@ -113,6 +257,7 @@ void NodeBatchInsert::executeInternal(ExecutionContext* context) {
         copyToNodeGroup(transaction, MemoryManager::Get(*clientContext)),
             nodeLocalState->columnState->setSelVector(originalSelVector);
     }
+    nodeLocalState->nodeGroupWriter->wait();
     if (nodeLocalState->chunkedGroup->getNumRows() > 0) {
         appendIncompleteNodeGroup(transaction, std::move(nodeLocalState->chunkedGroup),
             nodeLocalState->localIndexBuilder, MemoryManager::Get(*context->clientContext));
@@ -150,6 +295,10 @@ void NodeBatchInsert::copyToNodeGroup(transaction::Transaction* transaction,
     MemoryManager* mm) const {
     auto numAppendedTuples = 0ul;
     const auto nodeLocalState = ku_dynamic_cast<NodeBatchInsertLocalState*>(localState.get());
+    const auto nodeInfo = info->ptrCast<NodeBatchInsertInfo>();
+    if (nodeInfo->updateOnConflict) {
+        sharedState->incrementNumRows(updateExistingNodes(transaction));
+    }
     const auto numTuplesToAppend = nodeLocalState->columnState->getSelVector().getSelSize();
     while (numAppendedTuples < numTuplesToAppend) {
         const auto numAppendedTuplesInNodeGroup =
@@ -157,15 +306,102 @@ void NodeBatchInsert::copyToNodeGroup(transaction::Transaction* transaction,
                 numTuplesToAppend - numAppendedTuples);
         numAppendedTuples += numAppendedTuplesInNodeGroup;
         if (nodeLocalState->chunkedGroup->isFull()) {
-            writeAndResetNodeGroup(transaction, nodeLocalState->chunkedGroup,
-                nodeLocalState->localIndexBuilder, mm, *nodeLocalState->optimisticAllocator);
+            writeNodeGroupInBackground(mm);
         }
     }
-    const auto nodeInfo = info->ptrCast<NodeBatchInsertInfo>();
     nodeLocalState->stats.update(nodeLocalState->columnVectors, nodeInfo->outputDataColumns.size());
     sharedState->incrementNumRows(numAppendedTuples);
 }
 
+void NodeBatchInsert::writeNodeGroupInBackground(MemoryManager* mm) const {
+    const auto nodeLocalState = localState->ptrCast<NodeBatchInsertLocalState>();
+    auto nodeGroup =
+        nodeLocalState->nodeGroupWriter->write(std::move(nodeLocalState->chunkedGroup));
+    if (!nodeGroup) {
+        const auto nodeInfo = info->ptrCast<NodeBatchInsertInfo>();
+        nodeGroup = std::make_unique<InMemChunkedNodeGroup>(*mm, nodeInfo->columnTypes,
+            nodeInfo->compressionEnabled, StorageConfig::NODE_GROUP_SIZE, 0);
+    }
+    KU_ASSERT(nodeGroup->getNumRows() == 0);
+    nodeLocalState->chunkedGroup = std::move(nodeGroup);
+}
+
+uint64_t NodeBatchInsert::updateExistingNodes(Transaction* transaction) const {
+    const auto nodeSharedState = sharedState->ptrCast<NodeBatchInsertSharedState>();
+    const auto nodeLocalState = localState->ptrCast<NodeBatchInsertLocalState>();
+    auto& nodeTable = sharedState->table->cast<NodeTable>();
+    const auto& selVector = nodeLocalState->columnState->getSelVector();
+    const auto pkVector = nodeLocalState->columnVectors[nodeSharedState->pkColumnID];
+    // Probe the primary key index for the whole batch to split it into the rows to insert and the
+    // existing nodes to update. Each COPY thread probes its own batches, so probing is parallel.
+    // Null keys are left to the insertion path, which reports them.
+    std::vector<sel_t> keyPositions;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        if (!pkVector->isNull(selVector[i])) {
+            keyPositions.push_back(selVector[i]);
+        }
+    }
+    std::vector<offset_t> nodeOffsets(keyPositions.size());
+    nodeTable.lookupPKs(transaction, pkVector, keyPositions, nodeOffsets);
+    std::vector<std::pair<sel_t, offset_t>> rowsToUpdate;
+    const auto insertPositions = nodeLocalState->insertSelVector->getMutableBuffer();
+    sel_t numRowsToInsert = 0;
+    auto keyIdx = 0u;
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (!pkVector->isNull(pos)) {
+            const auto nodeOffset = nodeOffsets[keyIdx++];
+            if (nodeOffset != INVALID_OFFSET) {
+                rowsToUpdate.emplace_back(pos, nodeOffset);
+                continue;
+            }
+        }
+        insertPositions[numRowsToInsert++] = pos;
+    }
+    if (rowsToUpdate.empty()) {
+        return 0;
+    }
+    // Updates are applied in node offset order. If a batch updates the same node more than once,
+    // its last row wins, as it would if the rows were applied one by one.
+    std::stable_sort(rowsToUpdate.begin(), rowsToUpdate.end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
+    std::vector<offset_t> offsetsToUpdate;
+    std::vector<sel_t> positionsToUpdate;
+    for (auto i = 0u; i < rowsToUpdate.size(); i++) {
+        if (i + 1 < rowsToUpdate.size() && rowsToUpdate[i + 1].second == rowsToUpdate[i].second) {
+            continue;
+        }
+        positionsToUpdate.push_back(rowsToUpdate[i].first);
+        offsetsToUpdate.push_back(rowsToUpdate[i].second);
+    }
+    // Each column is updated with the whole batch at once, straight from the copied vector.
+    // Columns with indexes are updated row by row, since index updates take one row at a time.
+    auto& nodeIDVector = *nodeLocalState->upsertNodeIDVector;
+    for (auto columnIdx = 0u; columnIdx < nodeLocalState->upsertUpdateStates.size(); columnIdx++) {
+        const auto& updateState = nodeLocalState->upsertUpdateStates[columnIdx];
+        if (!updateState) {
+            continue;
+        }
+        const auto columnVector = nodeLocalState->columnVectors[columnIdx];
+        if (!updateState->needToUpdateAnyIndex()) {
+            nodeTable.update(transaction, updateState->columnID, offsetsToUpdate, *columnVector,
+                positionsToUpdate);
+            continue;
+        }
+        auto& propertyVector = *nodeLocalState->upsertPropertyVectors[columnIdx];
+        for (auto i = 0u; i < offsetsToUpdate.size(); i++) {
+            const auto nodeID = nodeID_t{offsetsToUpdate[i], nodeTable.getTableID()};
+            nodeIDVector.setValue<nodeID_t>(0, nodeID);
+            propertyVector.resetAuxiliaryBuffer();
+            propertyVector.copyFromVectorData(0, columnVector, positionsToUpdate[i]);
+            nodeTable.update(transaction, *updateState);
+        }
+    }
+    nodeLocalState->insertSelVector->setToFiltered(numRowsToInsert);
+    nodeLocalState->columnState->setSelVector(nodeLocalState->insertSelVector);
+    return rowsToUpdate.size();
+}
+
 NodeBatchInsertErrorHandler NodeBatchInsert::createErrorHandler(ExecutionContext* context) const {
     const auto nodeSharedState = ku_dynamic_cast<NodeBatchInsertSharedState*>(sharedState.get());
     auto* nodeTable = ku_dynamic_cast<NodeTable*>(sharedState->table);
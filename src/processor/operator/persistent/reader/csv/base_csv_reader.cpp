@@ -1,5 +1,7 @@
 #include "processor/operator/persistent/reader/csv/base_csv_reader.h"
 
+#include <bit>
+#include <cstring>
 #include <vector>
 
 #include "common/file_system/virtual_file_system.h"
@@ -267,6 +269,55 @@ static std::optional<WarningDataWithColumnInfo> getOptionalWarningData(
     return warningData;
 }
 
+// Finds the first byte equal to any of four characters, testing eight bytes at a time. Values are
+// separated by few characters to look for, so most bytes are skipped without branching on them.
+class CSVCharFinder {
+    static constexpr uint64_t LOW_BITS = 0x7F7F7F7F7F7F7F7FULL;
+    static constexpr uint64_t BYTES_OF_ONE = 0x0101010101010101ULL;
+
+public:
+    CSVCharFinder(char c0, char c1, char c2, char c3)
+        : c0{c0}, c1{c1}, c2{c2}, c3{c3}, pattern0{broadcast(c0)}, pattern1{broadcast(c1)},
+          pattern2{broadcast(c2)}, pattern3{broadcast(c3)} {}
+
+    // Returns the position of the first matching byte in [position, end), or end if there is none.
+    uint64_t find(const char* data, uint64_t position, uint64_t end) const {
+        for (; position + sizeof(uint64_t) <= end; position += sizeof(uint64_t)) {
+            uint64_t word = 0;
+            memcpy(&word, data + position, sizeof(uint64_t));
+            auto mask = zeroBytes(word ^ pattern0) | zeroBytes(word ^ pattern1) |
+                        zeroBytes(word ^ pattern2) | zeroBytes(word ^ pattern3);
+            if (mask != 0) {
+                if constexpr (std::endian::native == std::endian::little) {
+                    return position + std::countr_zero(mask) / 8;
+                } else {
+                    return position + std::countl_zero(mask) / 8;
+                }
+            }
+        }
+        for (; position < end; position++) {
+            auto c = data[position];
+            if (c == c0 || c == c1 || c == c2 || c == c3) {
+                return position;
+            }
+        }
+        return end;
+    }
+
+private:
+    static uint64_t broadcast(char c) { return BYTES_OF_ONE * static_cast<uint8_t>(c); }
+    // Sets the high bit of exactly the bytes of the word that are zero. Unlike the usual
+    // (x - 0x01..) & ~x test, no borrow carries into the next byte, so the lowest set bit always
+    // belongs to the first zero byte.
+    static uint64_t zeroBytes(uint64_t word) {
+        return ~(((word & LOW_BITS) + LOW_BITS) | word | LOW_BITS);
+    }
+
+private:
+    char c0, c1, c2, c3;
+    uint64_t pattern0, pattern1, pattern2, pattern3;
+};
+
 WarningSourceData BaseCSVReader::getWarningSourceData() const {
     return WarningSourceData::constructFrom(currentBlockIdx, getRowOffsetInCurrentBlock(),
         lineContext.startByteOffset, lineContext.endByteOffset, fileIdx);
@@ -279,6 +330,10 @@ BaseCSVReader::parse_result_t BaseCSVReader::parseCSV(Driver& driver) {
     // used for parsing algorithm
     curRowIdx = 0;
     numErrors = 0;
+    // Characters ending an unquoted value, and characters to handle within a quoted value. The
+    // newline characters are repeated to fill the four characters to look for.
+    const CSVCharFinder unquotedFinder{option.delimiter, '\n', '\r', '\n'};
+    const CSVCharFinder quotedFinder{option.quoteChar, option.escapeChar, '\n', '\r'};
 
     while (true) {
         column_id_t column = 0;
@@ -315,11 +370,12 @@ BaseCSVReader::parse_result_t BaseCSVReader::parseCSV(Driver& driver) {
         // this state parses the remainder of a non-quoted value until we reach a delimiter or
         // newline
         do {
-            for (; position < bufferSize; position++) {
+            position = unquotedFinder.find(buffer.get(), position, bufferSize);
+            if (position < bufferSize) {
                 if (buffer[position] == option.delimiter) {
                     // delimiter: end the value and add it to the chunk
                     goto add_value;
-                } else if (isNewLine(buffer[position])) {
+                } else {
                     // newline: add row
                     goto add_row;
                 }
@@ -389,11 +445,13 @@ BaseCSVReader::parse_result_t BaseCSVReader::parseCSV(Driver& driver) {
         // this state parses the remainder of a quoted value.
         position++;
         do {
-            for (; position < bufferSize; position++) {
-                if (driver.driverType == DriverType::SNIFF_CSV_DIALECT) {
-                    auto& sniffDriver = reinterpret_cast<SniffCSVDialectDriver&>(driver);
-                    sniffDriver.setEverQuoted();
-                }
+            if (driver.driverType == DriverType::SNIFF_CSV_DIALECT && position < bufferSize) {
+                auto& sniffDriver = reinterpret_cast<SniffCSVDialectDriver&>(driver);
+                sniffDriver.setEverQuoted();
+            }
+            for (position = quotedFinder.find(buffer.get(), position, bufferSize);
+                 position < bufferSize;
+                 position = quotedFinder.find(buffer.get(), position + 1, bufferSize)) {
                 if (buffer[position] == option.quoteChar) {
                     // quote: move to unquoted state
                     goto unquote;
@@ -401,7 +459,8 @@ BaseCSVReader::parse_result_t BaseCSVReader::parseCSV(Driver& driver) {
                     // escape: store the escaped position and move to handle_escape state
                     escapePositions.push_back(position - start);
                     goto handle_escape;
-                } else if (isNewLine(buffer[position])) {
+                } else {
+                    // newline
                     [[unlikely]] if (!handleQuotedNewline()) { goto ignore_error; }
                 }
             }
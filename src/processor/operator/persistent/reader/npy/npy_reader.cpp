@@ -68,6 +68,9 @@ NpyReader::NpyReader(const std::string& filePath)
     if (mmapRegion == MAP_FAILED) {
         throw CopyException("Failed to mmap NPY file.");
     }
+    // Blocks are scanned in increasing order, so let the kernel read ahead aggressively. This is
+    // only a hint, failing to apply it is not an error.
+    madvise(mmapRegion, fileSize, MADV_SEQUENTIAL);
 #endif
     parseHeader();
 }
@@ -225,13 +228,19 @@ void NpyReader::readBlock(block_idx_t blockIdx, ValueVector* vectorToRead) const
         const auto& rowType = vectorToRead->dataType;
         if (rowType.getLogicalTypeID() == LogicalTypeID::ARRAY) {
             auto numValuesPerRow = ArrayType::getNumElements(rowType);
+            // Rows are stored contiguously in the file, so the whole block is copied into the data
+            // vector at once after reserving space for it, which avoids repeatedly growing (and
+            // copying) the data vector while adding lists.
+            auto dataVector = ListVector::getDataVector(vectorToRead);
+            auto startOffset = ListVector::getDataVectorSize(vectorToRead);
+            ListVector::reserveDataVector(vectorToRead,
+                startOffset + numRowsToRead * numValuesPerRow);
             for (auto i = 0u; i < numRowsToRead; i++) {
                 auto listEntry = ListVector::addList(vectorToRead, numValuesPerRow);
                 vectorToRead->setValue(i, listEntry);
             }
-            auto dataVector = ListVector::getDataVector(vectorToRead);
-            memcpy(dataVector->getData(), rowPointer,
-                numRowsToRead * numValuesPerRow * dataVector->getNumBytesPerValue());
+            memcpy(dataVector->getData() + startOffset * dataVector->getNumBytesPerValue(),
+                rowPointer, numRowsToRead * numValuesPerRow * dataVector->getNumBytesPerValue());
             vectorToRead->state->getSelVectorUnsafe().setSelSize(numRowsToRead);
         } else {
             memcpy(vectorToRead->getData(), rowPointer,
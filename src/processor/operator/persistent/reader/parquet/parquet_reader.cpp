@@ -1,5 +1,7 @@
 #include "processor/operator/persistent/reader/parquet/parquet_reader.h"
 
+#include <cmath>
+
 #include "binder/binder.h"
 #include "common/exception/binder.h"
 #include "common/exception/copy.h"
@@ -14,6 +16,8 @@
 #include "processor/operator/persistent/reader/parquet/thrift_tools.h"
 #include "processor/operator/persistent/reader/reader_bind_utils.h"
 #include "processor/warning_context.h"
+#include "storage/predicate/constant_predicate.h"
+#include "storage/table/column_chunk_stats.h"
 
 using namespace ryu_parquet::format;
 
@@ -581,10 +585,137 @@ uint64_t ParquetReader::getGroupOffset(ParquetReaderScanState& state) {
     return minOffset;
 }
 
+template<typename T>
+static std::optional<storage::StorageValue> decodeStatValue(const std::string& bytes) {
+    T value;
+    if (bytes.size() != sizeof(T)) {
+        return std::nullopt;
+    }
+    memcpy(&value, bytes.data(), sizeof(T));
+    if constexpr (std::floating_point<T>) {
+        if (std::isnan(value)) {
+            return std::nullopt;
+        }
+    }
+    return storage::StorageValue(value);
+}
+
+// The deprecated min and max fields are ordered as signed values, which is only correct for signed
+// integers and floating point values.
+template<typename T>
+static void decodeMinMax(const Statistics& statistics, bool allowDeprecated,
+    storage::ColumnChunkStats& stats) {
+    if (statistics.__isset.min_value && statistics.__isset.max_value) {
+        stats.min = decodeStatValue<T>(statistics.min_value);
+        stats.max = decodeStatValue<T>(statistics.max_value);
+    } else if (allowDeprecated && statistics.__isset.min && statistics.__isset.max) {
+        stats.min = decodeStatValue<T>(statistics.min);
+        stats.max = decodeStatValue<T>(statistics.max);
+    }
+}
+
+static storage::ColumnChunkStats getMinMaxStats(const ColumnMetaData& metadata,
+    const LogicalType& type) {
+    storage::ColumnChunkStats stats{};
+    auto& statistics = metadata.statistics;
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::INT64: {
+        if (metadata.type == Type::INT64) {
+            decodeMinMax<int64_t>(statistics, true /* allowDeprecated */, stats);
+        }
+    } break;
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT8: {
+        if (metadata.type == Type::INT32) {
+            decodeMinMax<int32_t>(statistics, true /* allowDeprecated */, stats);
+        }
+    } break;
+    case LogicalTypeID::UINT64: {
+        if (metadata.type == Type::INT64) {
+            decodeMinMax<uint64_t>(statistics, false /* allowDeprecated */, stats);
+        }
+    } break;
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT8: {
+        if (metadata.type == Type::INT32) {
+            decodeMinMax<uint32_t>(statistics, false /* allowDeprecated */, stats);
+        }
+    } break;
+    case LogicalTypeID::DOUBLE: {
+        if (metadata.type == Type::DOUBLE) {
+            decodeMinMax<double>(statistics, true /* allowDeprecated */, stats);
+        }
+    } break;
+    case LogicalTypeID::FLOAT: {
+        if (metadata.type == Type::FLOAT) {
+            decodeMinMax<float>(statistics, true /* allowDeprecated */, stats);
+        }
+    } break;
+    case LogicalTypeID::STRING: {
+        // Bounds of strings may be truncated, but their prefixes still bound the prefixes of the
+        // strings in the column.
+        if (metadata.type == Type::BYTE_ARRAY && statistics.__isset.min_value &&
+            statistics.__isset.max_value) {
+            stats.min = storage::StorageValue(
+                storage::StringPrefixStats::getPrefix(statistics.min_value));
+            stats.max = storage::StorageValue(
+                storage::StringPrefixStats::getPrefix(statistics.max_value));
+        }
+    } break;
+    default:
+        break;
+    }
+    return stats;
+}
+
+// The statistics are those of the values stored in the file, so they can only be compared with
+// constants of the same type.
+static bool canCheckStats(const storage::ColumnPredicate& predicate, const LogicalType& type) {
+    if (!ExpressionTypeUtil::isComparison(predicate.getExpressionType())) {
+        return true;
+    }
+    auto& value = predicate.constCast<storage::ColumnConstantPredicate>().getValue();
+    return !value.isNull() && value.getDataType() == type;
+}
+
+bool ParquetReader::canSkipRowGroup(uint64_t groupIdx,
+    const std::vector<storage::ColumnPredicateSet>& columnPredicates) const {
+    auto& group = metadata->row_groups[groupIdx];
+    // Statistics are kept per leaf column, which only line up with the scanned columns if no column
+    // is nested.
+    if (group.columns.size() != columnTypes.size()) {
+        return false;
+    }
+    for (auto colIdx = 0u; colIdx < columnPredicates.size() && colIdx < columnTypes.size();
+         colIdx++) {
+        auto& columnChunk = group.columns[colIdx];
+        if (columnPredicates[colIdx].isEmpty() || !columnChunk.__isset.meta_data ||
+            !columnChunk.meta_data.__isset.statistics) {
+            continue;
+        }
+        auto& statistics = columnChunk.meta_data.statistics;
+        auto hasNullCount = statistics.__isset.null_count;
+        auto stats = storage::MergedColumnChunkStats(
+            getMinMaxStats(columnChunk.meta_data, columnTypes[colIdx]),
+            hasNullCount && statistics.null_count == 0,
+            hasNullCount && statistics.null_count == group.num_rows);
+        for (auto& predicate : columnPredicates[colIdx].getPredicates()) {
+            if (canCheckStats(*predicate, columnTypes[colIdx]) &&
+                predicate->checkZoneMap(stats) == ZoneMapCheckResult::SKIP_SCAN) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 ParquetScanSharedState::ParquetScanSharedState(FileScanInfo fileScanInfo, uint64_t numRows,
-    main::ClientContext* context, std::vector<bool> columnSkips)
+    main::ClientContext* context, std::vector<bool> columnSkips,
+    std::vector<storage::ColumnPredicateSet> columnPredicates)
     : ScanFileWithProgressSharedState{std::move(fileScanInfo), numRows, context},
-      columnSkips{columnSkips} {
+      columnSkips{columnSkips}, columnPredicates{std::move(columnPredicates)} {
     readers.push_back(std::make_unique<ParquetReader>(this->fileScanInfo.filePaths[fileIdx],
         columnSkips, context));
     totalRowsGroups = 0;
@@ -604,6 +735,11 @@ static bool parquetSharedStateNext(ParquetScanLocalState& localState,
             return false;
         }
         if (sharedState.blockIdx < sharedState.readers[sharedState.fileIdx]->getNumRowsGroups()) {
+            if (sharedState.readers[sharedState.fileIdx]->canSkipRowGroup(sharedState.blockIdx,
+                    sharedState.columnPredicates)) {
+                sharedState.blockIdx++;
+                continue;
+            }
             localState.reader = sharedState.readers[sharedState.fileIdx].get();
             localState.reader->initializeScan(*localState.state, {sharedState.blockIdx},
                 VirtualFileSystem::GetUnsafe(*sharedState.context));
@@ -710,7 +846,8 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(
     const TableFuncInitSharedStateInput& input) {
     auto bindData = input.bindData->constPtrCast<ScanFileBindData>();
     return std::make_unique<ParquetScanSharedState>(bindData->fileScanInfo.copy(),
-        bindData->numRows, bindData->context, bindData->getColumnSkips());
+        bindData->numRows, bindData->context, bindData->getColumnSkips(),
+        copyVector(bindData->getColumnPredicates()));
 }
 
 static std::unique_ptr<TableFuncLocalState> initLocalState(
@@ -16,6 +16,7 @@
 #include "storage/table/column_chunk_data.h"
 #include "storage/table/csr_chunked_node_group.h"
 #include "storage/table/rel_table.h"
+#include "transaction/transaction.h"
 
 using namespace ryu::catalog;
 using namespace ryu::common;
@@ -73,6 +74,11 @@ void RelBatchInsert::initGlobalStateInternal(ExecutionContext* context) {
     info->insertColumnIDs.push_back(0);
     info->outputDataColumns.push_back(dataColumnIdx++);
     for (auto& property : relGroupEntry.getProperties()) {
+        if (relGroupEntry.hasSortProperty() &&
+            property.getName() == relGroupEntry.getSortPropertyName()) {
+            // Partitioned data additionally holds the bound node offsets in front of the columns.
+            relBatchInsertInfo->sortColumnID = dataColumnIdx + 1;
+        }
         info->columnTypes.push_back(property.getType().copy());
         info->insertColumnIDs.push_back(relGroupEntry.getColumnID(property.getName()));
         info->outputDataColumns.push_back(dataColumnIdx++);
@@ -135,6 +141,7 @@ static void appendNewChunkedGroup(MemoryManager& mm, transaction::Transaction* t
     // in the node group)
     relTable.pushInsertInfo(transaction, direction, nodeGroup, chunkedGroup.getNumRows(), source);
     if (isNewNodeGroup) {
+        const auto degreeStats = chunkedGroup.getCSRHeader().computeDegreeStats();
         auto flushedChunkedGroup = chunkedGroup.flush(transaction, pageAllocator);
 
         // If there are deleted columns that haven't been vacuumed yet
@@ -143,7 +150,7 @@ static void appendNewChunkedGroup(MemoryManager& mm, transaction::Transaction* t
         auto persistentChunkedGroup = std::make_unique<ChunkedCSRNodeGroup>(mm,
             flushedChunkedGroup->cast<ChunkedCSRNodeGroup>(), nodeGroup.getDataTypes(), columnIDs);
 
-        nodeGroup.setPersistentChunkedGroup(std::move(persistentChunkedGroup));
+        nodeGroup.setPersistentChunkedGroup(std::move(persistentChunkedGroup), degreeStats);
     } else {
         nodeGroup.appendChunkedCSRGroup(transaction, columnIDs, chunkedGroup);
     }
@@ -163,7 +170,7 @@ void RelBatchInsert::appendNodeGroup(const RelGroupCatalogEntry& relGroupEntry,
     // There is no benefit of leaving gaps for existing node groups, which is kept in memory.
     const auto leaveGaps = nodeGroup.isEmpty();
     populateCSRHeader(relGroupEntry, *executionState, startNodeOffset, relInfo, localState,
-        numNodes, leaveGaps);
+        numNodes, leaveGaps, nodeGroup.getPackedCSRInfo().packedDensity);
     const auto& csrHeader =
         ku_dynamic_cast<InMemChunkedCSRNodeGroup&>(*localState.chunkedGroup).getCSRHeader();
     impl->writeToTable(*executionState, csrHeader, localState, *sharedState, relInfo);
@@ -205,14 +212,15 @@ void RelBatchInsertImpl::finalizeStartCSROffsets(RelBatchInsertExecutionState&,
 void RelBatchInsert::populateCSRHeader(const RelGroupCatalogEntry& relGroupEntry,
     RelBatchInsertExecutionState& executionState, offset_t startNodeOffset,
     const RelBatchInsertInfo& relInfo, const RelBatchInsertLocalState& localState,
-    offset_t numNodes, bool leaveGaps) {
+    offset_t numNodes, bool leaveGaps, double packedDensity) {
     auto& csrNodeGroup = ku_dynamic_cast<InMemChunkedCSRNodeGroup&>(*localState.chunkedGroup);
     auto& csrHeader = csrNodeGroup.getCSRHeader();
     csrHeader.setNumValues(numNodes);
     // Populate lengths for each node and check multiplicity constraint.
     impl->populateCSRLengths(executionState, csrHeader, numNodes, relInfo);
     checkRelMultiplicityConstraint(relGroupEntry, csrHeader, startNodeOffset, relInfo);
-    const auto rightCSROffsetOfRegions = csrHeader.populateStartCSROffsetsFromLength(leaveGaps);
+    const auto rightCSROffsetOfRegions =
+        csrHeader.populateStartCSROffsetsFromLength(leaveGaps, packedDensity);
     impl->finalizeStartCSROffsets(executionState, csrHeader, relInfo);
     csrHeader.finalizeCSRRegionEndOffsets(rightCSROffsetOfRegions);
     // Resize csr data column chunks.
@@ -261,6 +269,8 @@ void RelBatchInsert::finalizeInternal(ExecutionContext* context) {
     }
     sharedState->numRows.store(0);
     sharedState->table->cast<RelTable>().setHasChanges();
+    sharedState->table->increaseWriteVersion(
+        transaction::Transaction::Get(*context->clientContext));
     partitionerSharedState->resetState(relInfo->partitioningIdx);
 }
 
@@ -6,6 +6,7 @@
 #include "processor/operator/persistent/reader/parquet/parquet_rle_bp_decoder.h"
 #include "processor/operator/persistent/writer//parquet/parquet_rle_bp_encoder.h"
 #include "processor/operator/persistent/writer/parquet/parquet_writer.h"
+#include "protocol/TCompactProtocol.h"
 
 namespace ryu {
 namespace processor {
@@ -116,42 +117,62 @@ void BasicColumnWriter::write(ColumnWriterState& writerState, common::ValueVecto
     }
 }
 
-void BasicColumnWriter::finalizeWrite(ColumnWriterState& writerState) {
+void BasicColumnWriter::finalizeChunk(ColumnWriterState& writerState) {
     auto& state = reinterpret_cast<BasicColumnWriterState&>(writerState);
     auto& columnChunk = state.rowGroup.columns[state.colIdx];
 
     // Flush the last page (if any remains).
     flushPage(state);
 
-    auto startOffset = writer.getOffset();
-    auto pageOffset = startOffset;
     // Flush the dictionary.
-    if (hasDictionary(state)) {
+    auto hasDictionaryPage = hasDictionary(state);
+    if (hasDictionaryPage) {
         columnChunk.meta_data.statistics.distinct_count = dictionarySize(state);
         columnChunk.meta_data.statistics.__isset.distinct_count = true;
-        columnChunk.meta_data.dictionary_page_offset = pageOffset;
+        columnChunk.meta_data.dictionary_page_offset = 0;
         columnChunk.meta_data.__isset.dictionary_page_offset = true;
         flushDictionary(state, state.statsState.get());
-        pageOffset += state.writeInfo[0].compressedSize;
     }
-
-    // Record the start position of the pages for this column.
-    columnChunk.meta_data.data_page_offset = pageOffset;
+    columnChunk.meta_data.data_page_offset = 0;
     setParquetStatistics(state, columnChunk);
 
-    // write the individual pages to disk
+    // Serialize the individual pages into memory. Offsets are relative to the start of the chunk
+    // until finalizeWrite knows where the chunk goes in the file.
+    state.chunkBuffer = std::make_unique<BufferWriter>();
+    ryu_apache::thrift::protocol::TCompactProtocolT<ParquetBufferTransport> protocol{
+        std::make_shared<ParquetBufferTransport>(*state.chunkBuffer)};
     uint64_t totalUncompressedSize = 0;
-    for (auto& write_info : state.writeInfo) {
+    for (auto i = 0u; i < state.writeInfo.size(); i++) {
+        auto& write_info = state.writeInfo[i];
         KU_ASSERT(write_info.pageHeader.uncompressed_page_size > 0);
-        auto header_start_offset = writer.getOffset();
-        write_info.pageHeader.write(writer.getProtocol());
+        auto header_start_offset = state.chunkBuffer->getSize();
+        write_info.pageHeader.write(&protocol);
         // total uncompressed size in the column chunk includes the header size (!)
-        totalUncompressedSize += writer.getOffset() - header_start_offset;
+        totalUncompressedSize += state.chunkBuffer->getSize() - header_start_offset;
         totalUncompressedSize += write_info.pageHeader.uncompressed_page_size;
-        writer.write(write_info.compressedData, write_info.compressedSize);
+        state.chunkBuffer->write(write_info.compressedData, write_info.compressedSize);
+        if (hasDictionaryPage && i == 0) {
+            // Record the start position of the data pages for this column.
+            columnChunk.meta_data.data_page_offset = state.chunkBuffer->getSize();
+        }
     }
-    columnChunk.meta_data.total_compressed_size = writer.getOffset() - startOffset;
+    columnChunk.meta_data.total_compressed_size = state.chunkBuffer->getSize();
     columnChunk.meta_data.total_uncompressed_size = totalUncompressedSize;
+    // The pages have been copied into the chunk buffer.
+    state.writeInfo.clear();
+}
+
+void BasicColumnWriter::finalizeWrite(ColumnWriterState& writerState) {
+    auto& state = reinterpret_cast<BasicColumnWriterState&>(writerState);
+    auto& columnChunk = state.rowGroup.columns[state.colIdx];
+    KU_ASSERT(state.chunkBuffer != nullptr);
+    auto startOffset = writer.getOffset();
+    columnChunk.meta_data.data_page_offset += startOffset;
+    if (columnChunk.meta_data.__isset.dictionary_page_offset) {
+        columnChunk.meta_data.dictionary_page_offset += startOffset;
+    }
+    writer.write(state.chunkBuffer->getBlobData(), state.chunkBuffer->getSize());
+    state.chunkBuffer.reset();
 }
 
 void BasicColumnWriter::writeLevels(Serializer& serializer, const std::vector<uint16_t>& levels,
@@ -270,7 +291,7 @@ void BasicColumnWriter::writeDictionary(BasicColumnWriterState& state,
 void BasicColumnWriter::setParquetStatistics(BasicColumnWriterState& state,
     ryu_parquet::format::ColumnChunk& column) {
     if (maxRepeat == 0) {
-        column.meta_data.statistics.null_count = nullCount;
+        column.meta_data.statistics.null_count = state.nullCount;
         column.meta_data.statistics.__isset.null_count = true;
         column.meta_data.__isset.statistics = true;
     }
@@ -253,6 +253,12 @@ void ParquetWriter::prepareRowGroup(FactorizedTable& ft, PreparedRowGroup& resul
         }
     }
 
+    // Compression and serialization of the column chunks happen here, outside of the lock, so
+    // only appending the bytes to the file is serialized across threads.
+    for (auto i = 0u; i < columnWriters.size(); i++) {
+        columnWriters[i]->finalizeChunk(*writerStates[i]);
+    }
+
     for (auto& write_state : writerStates) {
         states.push_back(std::move(write_state));
     }
@@ -2,9 +2,13 @@
 
 #include "common/exception/interrupt.h"
 #include "common/exception/runtime.h"
+#include "common/hardware_counters.h"
+#include "common/memory_tracker.h"
+#include "common/profiler.h"
 #include "common/task_system/progress_bar.h"
 #include "main/client_context.h"
 #include "processor/execution_context.h"
+#include "storage/buffer_manager/buffer_manager.h"
 
 using namespace ryu::common;
 
@@ -57,6 +61,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "FLATTEN";
     case PhysicalOperatorType::HASH_JOIN_BUILD:
         return "HASH_JOIN_BUILD";
+    case PhysicalOperatorType::HASH_JOIN_FINALIZE:
+        return "HASH_JOIN_FINALIZE";
     case PhysicalOperatorType::HASH_JOIN_PROBE:
         return "HASH_JOIN_PROBE";
     case PhysicalOperatorType::IMPORT_DATABASE:
@@ -105,6 +111,8 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
         return "SKIP";
     case PhysicalOperatorType::STANDALONE_CALL:
         return "STANDALONE_CALL";
+    case PhysicalOperatorType::STREAMING_AGGREGATE:
+        return "STREAMING_AGGREGATE";
     case PhysicalOperatorType::TABLE_FUNCTION_CALL:
         return "TABLE_FUNCTION_CALL";
     case PhysicalOperatorType::TOP_K:
@@ -171,6 +179,7 @@ void PhysicalOperator::initGlobalState(ExecutionContext* context) {
     if (!isSource()) {
         children[0]->initGlobalState(context);
     }
+    MemoryTrackerScope memoryScope{getMemoryTracker(context->profiler)};
     initGlobalStateInternal(context);
 }
 
@@ -180,6 +189,7 @@ void PhysicalOperator::initLocalState(ResultSet* resultSet_, ExecutionContext* c
     }
     resultSet = resultSet_;
     registerProfilingMetrics(context->profiler);
+    MemoryTrackerScope memoryScope{metrics->memoryTracker};
     initLocalStateInternal(resultSet_, context);
 }
 
@@ -199,10 +209,13 @@ bool PhysicalOperator::getNextTuple(ExecutionContext* context) {
         }
     }
 #endif
+    MemoryTrackerScope memoryScope{metrics->memoryTracker};
     metrics->executionTime.start();
+    metrics->startCounters();
     auto result = getNextTuplesInternal(context);
     ProgressBar::Get(*context->clientContext)
         ->updateProgress(context->queryID, getProgress(context));
+    metrics->stopCounters();
     metrics->executionTime.stop();
     return result;
 }
@@ -211,6 +224,7 @@ void PhysicalOperator::finalize(ExecutionContext* context) {
     if (!isSource()) {
         children[0]->finalize(context);
     }
+    MemoryTrackerScope memoryScope{getMemoryTracker(context->profiler)};
     finalizeInternal(context);
 }
 
@@ -218,6 +232,29 @@ void PhysicalOperator::registerProfilingMetrics(Profiler* profiler) {
     auto executionTime = profiler->registerTimeMetric(getTimeMetricKey());
     auto numOutputTuple = profiler->registerNumericMetric(getNumTupleMetricKey());
     metrics = std::make_unique<OperatorMetrics>(*executionTime, *numOutputTuple);
+    metrics->memoryTracker = getMemoryTracker(profiler);
+    if (!profiler->enabled) {
+        return;
+    }
+    auto numCounters = static_cast<uint32_t>(OperatorCounter::CYCLES);
+    if (profiler->enableHardwareCounters) {
+        metrics->hardwareCounters = HardwareCounters::getThreadLocal();
+        if (metrics->hardwareCounters != nullptr) {
+            numCounters = OperatorMetrics::NUM_COUNTERS;
+        }
+    }
+    for (auto i = 0u; i < numCounters; i++) {
+        metrics->counters[i] =
+            profiler->registerNumericMetric(getCounterMetricKey(static_cast<OperatorCounter>(i)));
+    }
+}
+
+MemoryTracker* PhysicalOperator::getMemoryTracker(Profiler* profiler) const {
+    if (profiler->memoryTracker == nullptr) {
+        return nullptr;
+    }
+    return profiler->memoryTracker->getOperatorTracker(id,
+        PhysicalOperatorUtils::operatorTypeToString(operatorType));
 }
 
 double PhysicalOperator::getExecutionTime(Profiler& profiler) const {
@@ -232,11 +269,38 @@ uint64_t PhysicalOperator::getNumOutputTuples(Profiler& profiler) const {
     return profiler.sumAllNumericMetricsWithKey(getNumTupleMetricKey());
 }
 
+uint64_t PhysicalOperator::getCounter(Profiler& profiler, OperatorCounter counter) const {
+    auto value = profiler.sumAllNumericMetricsWithKey(getCounterMetricKey(counter));
+    if (!isSource()) {
+        const auto childValue =
+            profiler.sumAllNumericMetricsWithKey(children[0]->getCounterMetricKey(counter));
+        value = value > childValue ? value - childValue : 0;
+    }
+    return value;
+}
+
 std::unordered_map<std::string, std::string> PhysicalOperator::getProfilerKeyValAttributes(
     Profiler& profiler) const {
     std::unordered_map<std::string, std::string> result;
     result.insert({"ExecutionTime", std::to_string(getExecutionTime(profiler))});
     result.insert({"NumOutputTuples", std::to_string(getNumOutputTuples(profiler))});
+    result.insert({"PageAccesses",
+        std::to_string(getCounter(profiler, OperatorCounter::PAGE_ACCESSES))});
+    result.insert(
+        {"PageMisses", std::to_string(getCounter(profiler, OperatorCounter::PAGE_MISSES))});
+    result.insert(
+        {"BytesRead", std::to_string(getCounter(profiler, OperatorCounter::BYTES_READ))});
+    if (profiler.memoryTracker != nullptr) {
+        result.insert(
+            {"PeakMemory", std::to_string(profiler.memoryTracker->getOperatorPeakUsage(id))});
+    }
+    if (profiler.metrics.contains(getCounterMetricKey(OperatorCounter::CYCLES))) {
+        result.insert({"Cycles", std::to_string(getCounter(profiler, OperatorCounter::CYCLES))});
+        result.insert({"Instructions",
+            std::to_string(getCounter(profiler, OperatorCounter::INSTRUCTIONS))});
+        result.insert(
+            {"LLCMisses", std::to_string(getCounter(profiler, OperatorCounter::LLC_MISSES))});
+    }
     return result;
 }
 
@@ -248,6 +312,41 @@ std::vector<std::string> PhysicalOperator::getProfilerAttributes(Profiler& profi
     return result;
 }
 
+std::array<uint64_t, OperatorMetrics::NUM_COUNTERS> OperatorMetrics::readCounters() const {
+    std::array<uint64_t, NUM_COUNTERS> values{};
+    const auto& stats = storage::BufferManager::getThreadStats();
+    values[static_cast<uint8_t>(OperatorCounter::PAGE_ACCESSES)] = stats.numPageAccesses;
+    values[static_cast<uint8_t>(OperatorCounter::PAGE_MISSES)] = stats.numPageMisses;
+    values[static_cast<uint8_t>(OperatorCounter::BYTES_READ)] = stats.numBytesRead;
+    if (hardwareCounters != nullptr) {
+        const auto hardwareValues = hardwareCounters->read();
+        values[static_cast<uint8_t>(OperatorCounter::CYCLES)] = hardwareValues.numCycles;
+        values[static_cast<uint8_t>(OperatorCounter::INSTRUCTIONS)] =
+            hardwareValues.numInstructions;
+        values[static_cast<uint8_t>(OperatorCounter::LLC_MISSES)] = hardwareValues.numLLCMisses;
+    }
+    return values;
+}
+
+void OperatorMetrics::startCounters() {
+    if (counters[0] == nullptr) {
+        return;
+    }
+    startValues = readCounters();
+}
+
+void OperatorMetrics::stopCounters() {
+    if (counters[0] == nullptr) {
+        return;
+    }
+    const auto values = readCounters();
+    for (auto i = 0u; i < NUM_COUNTERS; i++) {
+        if (counters[i] != nullptr) {
+            counters[i]->increase(values[i] - startValues[i]);
+        }
+    }
+}
+
 double PhysicalOperator::getProgress(ExecutionContext* /*context*/) const {
     return 0;
 }
@@ -72,6 +72,56 @@ static double getRJProgress(offset_t totalNumNodes, offset_t completedNumNodes)
     return (double)completedNumNodes / totalNumNodes;
 }
 
+void RecursiveExtend::runMultiSource(ExecutionContext* context,
+    std::vector<nodeID_t> sourceNodeIDs) {
+    auto graph = sharedState->graph.get();
+    auto computeState = MSBFSLanes::getComputeState(context, graph);
+    for (auto& sourceNodeID : sourceNodeIDs) {
+        computeState->initSource(sourceNodeID);
+    }
+    auto lanes = computeState->auxiliaryState->ptrCast<MSBFSLanes>();
+    auto writer = function->getMultiSourceOutputWriter(context, *lanes, std::move(sourceNodeIDs),
+        sharedState.get());
+    auto vertexCompute = RJVertexCompute(storage::MemoryManager::Get(*context->clientContext),
+        sharedState.get(), std::move(writer),
+        bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
+    auto frontierPair = computeState->frontierPair.get();
+    // Each iteration is followed by writing the nodes it reaches, since only the lanes of the
+    // last iteration are kept.
+    while (frontierPair->continueNextIter(bindData.upperBound)) {
+        lanes->beginNewIteration();
+        GDSUtils::runAlgorithmEdgeCompute(context, *computeState, graph, bindData.extendDirection,
+            frontierPair->getCurrentIter() + 1 /* maxIteration */);
+        GDSUtils::runVertexCompute(context, GDSDensityState::DENSE, graph, vertexCompute);
+        if (sharedState->exceedLimit()) {
+            break;
+        }
+    }
+}
+
+// Returns the only node the output is restricted to, or an invalid node ID if there isn't one.
+static nodeID_t getSingleOutputNodeID(const NodeOffsetMaskMap* outputNodeMask,
+    const table_id_set_t& outputTableIDSet) {
+    auto result = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    if (outputNodeMask == nullptr || outputNodeMask->getNumMaskedNode() != 1) {
+        return result;
+    }
+    for (auto& tableID : outputTableIDSet) {
+        if (!outputNodeMask->containsTableID(tableID)) {
+            return {INVALID_OFFSET, INVALID_TABLE_ID};
+        }
+        auto mask = outputNodeMask->getOffsetMask(tableID);
+        // A disabled mask doesn't restrict the output.
+        if (!mask->isEnabled()) {
+            return {INVALID_OFFSET, INVALID_TABLE_ID};
+        }
+        if (mask->getNumMaskedNodes() == 1) {
+            result = nodeID_t{mask->collectMaskedNodes(1)[0], tableID};
+        }
+    }
+    return result;
+}
+
 static bool requireRelID(const RJAlgorithm& function) {
     if (function.getFunctionName() == WeightedSPPathsFunction::name ||
         function.getFunctionName() == SingleSPPathsFunction::name ||
@@ -83,6 +133,26 @@ static bool requireRelID(const RJAlgorithm& function) {
     return false;
 }
 
+// Under walk semantics without node predicates, every node a variable length join activates in an
+// iteration within the bounds is the end of at least one distinct walk, i.e. of an output row, as
+// long as it belongs to an output table. So once the limit is reached by the activated nodes, the
+// traversal can stop and only output the shorter paths it found.
+static bool canStopTraversalAtLimit(const RJAlgorithm& function, const RJBindData& bindData,
+    const RecursiveExtendSharedState& sharedState, const table_id_set_t& outputTableIDSet) {
+    if (sharedState.counter == nullptr ||
+        function.getFunctionName() != VarLenJoinsFunction::name ||
+        bindData.semantic != PathSemantic::WALK || sharedState.getPathNodeMaskMap() != nullptr ||
+        sharedState.getOutputNodeMaskMap() != nullptr) {
+        return false;
+    }
+    for (auto& tableID : sharedState.graph->getNodeTableIDs()) {
+        if (!outputTableIDSet.contains(tableID)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void RecursiveExtend::executeInternal(ExecutionContext* context) {
     auto clientContext = context->clientContext;
     auto transaction = transaction::Transaction::Get(*clientContext);
@@ -107,6 +177,15 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
     }
     offset_t completedNumNodes = 0;
     auto inputNodeTableIDSet = bindData.nodeInput->constCast<NodeExpression>().getTableIDsSet();
+    // Single-pair queries search from both ends.
+    auto dstNodeID = nodeID_t{INVALID_OFFSET, INVALID_TABLE_ID};
+    if (function->supportBidirectional() && bindData.semantic == PathSemantic::WALK &&
+        sharedState->getPathNodeMaskMap() == nullptr) {
+        dstNodeID = getSingleOutputNodeID(sharedState->getOutputNodeMaskMap(),
+            bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
+    }
+    auto stopAtLimit = canStopTraversalAtLimit(*function, bindData, *sharedState,
+        bindData.nodeOutput->constCast<NodeExpression>().getTableIDsSet());
     for (auto& tableID : graph->getNodeTableIDs()) {
         // Input node table IDs could be different from graph node table IDs, e.g.
         // Given schema, student-knows->student, teacher-knows->teacher
@@ -115,14 +194,24 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
         if (!inputNodeTableIDSet.contains(tableID)) {
             continue;
         }
-        auto calcFunc = [tableID, propertyNames, graph, context, this](offset_t offset) {
+        auto calcFunc = [tableID, propertyNames, graph, context, dstNodeID, stopAtLimit, this](
+                            offset_t offset) {
             auto clientContext = context->clientContext;
-            auto computeState = function->getComputeState(context, bindData, sharedState.get());
             auto sourceNodeID = nodeID_t{offset, tableID};
-            computeState->initSource(sourceNodeID);
-            GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
-                bindData.extendDirection, bindData.upperBound, sharedState->getOutputNodeMaskMap(),
-                propertyNames);
+            std::unique_ptr<GDSComputeState> computeState;
+            if (dstNodeID.offset != INVALID_OFFSET) {
+                computeState = function->runBidirectional(context, bindData, sharedState.get(),
+                    sourceNodeID, dstNodeID, propertyNames);
+            } else {
+                computeState = function->getComputeState(context, bindData, sharedState.get());
+                computeState->initSource(sourceNodeID);
+                auto numOutputsToStop =
+                    stopAtLimit ? sharedState->counter->getNumRemaining() : INVALID_LIMIT;
+                GDSUtils::runRecursiveJoinEdgeCompute(context, *computeState, graph,
+                    bindData.extendDirection, bindData.upperBound,
+                    sharedState->getOutputNodeMaskMap(), propertyNames, bindData.lowerBound,
+                    numOutputsToStop);
+            }
             auto writer = function->getOutputWriter(context, bindData, *computeState, sourceNodeID,
                 sharedState.get());
             auto vertexCompute = std::make_unique<RJVertexCompute>(
@@ -132,9 +221,47 @@ void RecursiveExtend::executeInternal(ExecutionContext* context) {
                 *vertexCompute);
         };
         auto maxOffset = graph->getMaxOffset(transaction, tableID);
-        if (inputNodeMaskMap && inputNodeMaskMap->getOffsetMask(tableID)->isEnabled()) {
-            for (const auto& offset :
-                inputNodeMaskMap->getOffsetMask(tableID)->range(0, maxOffset)) {
+        auto inputMask = inputNodeMaskMap && inputNodeMaskMap->getOffsetMask(tableID)->isEnabled() ?
+                             inputNodeMaskMap->getOffsetMask(tableID) :
+                             nullptr;
+        auto numSources = inputMask != nullptr ? inputMask->getNumMaskedNodes() : maxOffset;
+        if (function->supportMultiSource() && numSources >= MIN_NUM_SOURCES_FOR_MULTI_SOURCE) {
+            std::vector<nodeID_t> sourceNodeIDs;
+            auto runBatch = [&]() {
+                auto numSourcesInBatch = sourceNodeIDs.size();
+                runMultiSource(context, std::move(sourceNodeIDs));
+                sourceNodeIDs.clear();
+                completedNumNodes += numSourcesInBatch;
+                progressBar->updateProgress(context->queryID,
+                    getRJProgress(totalNumNodes, completedNumNodes));
+            };
+            auto addSource = [&](offset_t offset) {
+                sourceNodeIDs.push_back({offset, tableID});
+                if (sourceNodeIDs.size() == MSBFSLanes::MAX_NUM_SOURCES) {
+                    runBatch();
+                }
+                return !sharedState->exceedLimit();
+            };
+            if (inputMask != nullptr) {
+                for (const auto& offset : inputMask->range(0, maxOffset)) {
+                    if (!addSource(offset)) {
+                        break;
+                    }
+                }
+            } else {
+                for (auto offset = 0u; offset < maxOffset; ++offset) {
+                    if (!addSource(offset)) {
+                        break;
+                    }
+                }
+            }
+            if (!sourceNodeIDs.empty() && !sharedState->exceedLimit()) {
+                runBatch();
+            }
+            continue;
+        }
+        if (inputMask != nullptr) {
+            for (const auto& offset : inputMask->range(0, maxOffset)) {
                 calcFunc(offset);
                 progressBar->updateProgress(context->queryID,
                     getRJProgress(totalNumNodes, completedNumNodes++));
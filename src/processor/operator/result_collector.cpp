@@ -1,6 +1,7 @@
 #include "processor/operator/result_collector.h"
 
 #include "binder/expression/expression_util.h"
+#include "main/client_context.h"
 #include "main/query_result/materialized_query_result.h"
 #include "processor/execution_context.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -43,18 +44,42 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
         info.tableSchema.copy());
 }
 
+bool ResultCollector::pushLocalTable(ExecutionContext* context) {
+    metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+    if (!sharedState->getStream()->push(std::move(localTable))) {
+        // Nobody consumes the result anymore, so the other pipelines are stopped as well.
+        context->clientContext->interrupt();
+        return false;
+    }
+    localTable = std::make_unique<FactorizedTable>(MemoryManager::Get(*context->clientContext),
+        info.tableSchema.copy());
+    return true;
+}
+
 void ResultCollector::executeInternal(ExecutionContext* context) {
+    auto stream = sharedState->getStream();
     while (children[0]->getNextTuple(context)) {
         if (!payloadVectors.empty()) {
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(payloadAndMarkVectors);
             }
+            if (stream != nullptr && localTable->getNumTuples() >= DEFAULT_VECTOR_CAPACITY &&
+                !pushLocalTable(context)) {
+                return;
+            }
         }
     }
-    if (!payloadVectors.empty()) {
-        metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
-        sharedState->mergeLocalTable(*localTable);
+    if (payloadVectors.empty()) {
+        return;
+    }
+    if (stream != nullptr) {
+        if (!localTable->isEmpty()) {
+            pushLocalTable(context);
+        }
+        return;
     }
+    metrics->numOutputTuple.increase(localTable->getTotalNumFlatTuples());
+    sharedState->mergeLocalTable(*localTable);
 }
 
 void ResultCollector::finalizeInternal(ExecutionContext* context) {
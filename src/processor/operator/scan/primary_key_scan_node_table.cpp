@@ -1,5 +1,7 @@
 #include "processor/operator/scan/primary_key_scan_node_table.h"
 
+#include <algorithm>
+
 #include "binder/expression/expression_util.h"
 #include "processor/execution_context.h"
 
@@ -39,6 +41,9 @@ void PrimaryKeyScanNodeTable::initLocalStateInternal(ResultSet* resultSet,
 }
 
 bool PrimaryKeyScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
+    if (isKeyList) {
+        return getNextKeyListTuple(context);
+    }
     auto transaction = transaction::Transaction::Get(*context->clientContext);
     auto tableIdx = sharedState->getTableIdx();
     if (tableIdx >= tableInfos.size()) {
@@ -60,7 +65,62 @@ bool PrimaryKeyScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
     if (!table.lookupPK(transaction, indexVector, pos, nodeOffset)) {
         return false;
     }
+    return scanNode(context, tableInfo, nodeOffset);
+}
+
+bool PrimaryKeyScanNodeTable::getNextKeyListTuple(ExecutionContext* context) {
+    while (true) {
+        if (nextKeyListOffsetIdx < keyListOffsets.size()) {
+            if (scanNode(context, tableInfos[keyListTableIdx],
+                    keyListOffsets[nextKeyListOffsetIdx++])) {
+                return true;
+            }
+            continue;
+        }
+        keyListTableIdx = sharedState->getTableIdx();
+        if (keyListTableIdx >= tableInfos.size()) {
+            return false;
+        }
+        lookupKeyList(context, keyListTableIdx);
+    }
+}
+
+void PrimaryKeyScanNodeTable::lookupKeyList(ExecutionContext* context, idx_t tableIdx) {
+    keyListOffsets.clear();
+    nextKeyListOffsetIdx = 0;
+    indexEvaluator->evaluate();
+    auto listVector = indexEvaluator->resultVector.get();
+    auto pos = listVector->state->getSelVector()[0];
+    if (listVector->isNull(pos)) {
+        return;
+    }
+    auto& list = listVector->getValue<list_entry_t>(pos);
+    auto keyVector = ListVector::getDataVector(listVector);
+    std::vector<sel_t> keyPositions;
+    for (auto i = 0u; i < list.size; i++) {
+        if (!keyVector->isNull(list.offset + i)) {
+            keyPositions.push_back(list.offset + i);
+        }
+    }
+    std::vector<offset_t> offsets(keyPositions.size());
+    tableInfos[tableIdx].table->cast<NodeTable>().lookupPKs(
+        transaction::Transaction::Get(*context->clientContext), keyVector, keyPositions, offsets);
+    for (const auto offset : offsets) {
+        if (offset != INVALID_OFFSET) {
+            keyListOffsets.push_back(offset);
+        }
+    }
+    std::sort(keyListOffsets.begin(), keyListOffsets.end());
+    keyListOffsets.erase(std::unique(keyListOffsets.begin(), keyListOffsets.end()),
+        keyListOffsets.end());
+}
+
+bool PrimaryKeyScanNodeTable::scanNode(ExecutionContext* context, ScanNodeTableInfo& tableInfo,
+    offset_t nodeOffset) {
+    auto transaction = transaction::Transaction::Get(*context->clientContext);
+    auto& table = tableInfo.table->cast<NodeTable>();
     auto nodeID = nodeID_t{nodeOffset, table.getTableID()};
+    auto pos = scanState->nodeIDVector->state->getSelVector()[0];
     scanState->nodeIDVector->setValue<nodeID_t>(pos, nodeID);
     // Look up properties
     tableInfo.initScanState(*scanState, outVectors, context->clientContext);
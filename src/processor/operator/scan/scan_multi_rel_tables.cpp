@@ -20,11 +20,23 @@ bool DirectionInfo::needFlip(RelDataDirection relDataDirection) const {
     return false;
 }
 
-bool RelTableCollectionScanner::scan(main::ClientContext* context, RelTableScanState& scanState,
-    const std::vector<ValueVector*>& outVectors) {
+void RelTableCollectionScanner::initScanStates(main::ClientContext* context,
+    ValueVector* boundNodeIDVector, const std::vector<ValueVector*>& outVectors) {
+    auto& mm = *MemoryManager::Get(*context);
+    scanStates.clear();
+    for (auto& relInfo : relInfos) {
+        auto scanState = std::make_unique<RelTableScanState>(mm, boundNodeIDVector, outVectors,
+            outVectors[0]->state);
+        relInfo.initScanState(*scanState, outVectors, context);
+        scanStates.push_back(std::move(scanState));
+    }
+}
+
+bool RelTableCollectionScanner::scan(main::ClientContext* context) {
     auto transaction = Transaction::Get(*context);
     while (true) {
         auto& relInfo = relInfos[currentTableIdx];
+        auto& scanState = *scanStates[currentTableIdx];
         if (relInfo.table->scan(transaction, scanState)) {
             auto& selVector = scanState.outState->getSelVector();
             if (directionVector != nullptr) {
@@ -41,9 +53,8 @@ bool RelTableCollectionScanner::scan(main::ClientContext* context, RelTableScanS
             if (currentTableIdx == relInfos.size()) {
                 return false;
             }
-            auto& currentInfo = relInfos[currentTableIdx];
-            currentInfo.initScanState(scanState, outVectors, context);
-            currentInfo.table->initScanState(transaction, scanState, currentTableIdx == 0);
+            relInfos[currentTableIdx].table->initScanState(transaction,
+                *scanStates[currentTableIdx]);
             nextTableIdx++;
         }
     }
@@ -51,12 +62,9 @@ bool RelTableCollectionScanner::scan(main::ClientContext* context, RelTableScanS
 
 void ScanMultiRelTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     ScanTable::initLocalStateInternal(resultSet, context);
-    auto clientContext = context->clientContext;
     boundNodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
-    auto nbrNodeIDVector = outVectors[0];
-    scanState = std::make_unique<RelTableScanState>(*MemoryManager::Get(*clientContext),
-        boundNodeIDVector, outVectors, nbrNodeIDVector->state);
     for (auto& [_, scanner] : scanners) {
+        scanner.initScanStates(context->clientContext, boundNodeIDVector, outVectors);
         for (auto& relInfo : scanner.relInfos) {
             if (directionInfo.directionPos.isValid()) {
                 scanner.directionVector =
@@ -71,8 +79,8 @@ void ScanMultiRelTable::initLocalStateInternal(ResultSet* resultSet, ExecutionCo
 bool ScanMultiRelTable::getNextTuplesInternal(ExecutionContext* context) {
     while (true) {
         if (currentScanner != nullptr &&
-            currentScanner->scan(context->clientContext, *scanState, outVectors)) {
-            metrics->numOutputTuple.increase(scanState->outState->getSelVector().getSelSize());
+            currentScanner->scan(context->clientContext)) {
+            metrics->numOutputTuple.increase(outVectors[0]->state->getSelVector().getSelSize());
             return true;
         }
         if (!children[0]->getNextTuple(context)) {
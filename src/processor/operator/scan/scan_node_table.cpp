@@ -1,9 +1,12 @@
 #include "processor/operator/scan/scan_node_table.h"
 
 #include "binder/expression/expression_util.h"
+#include "common/string_format.h"
 #include "processor/execution_context.h"
+#include "storage/buffer_manager/memory_manager.h"
 #include "storage/local_storage/local_node_table.h"
 #include "storage/local_storage/local_storage.h"
+#include "storage/storage_utils.h"
 
 using namespace ryu::common;
 using namespace ryu::storage;
@@ -27,6 +30,9 @@ std::string ScanNodeTablePrintInfo::toString() const {
         result += ",Properties: ";
         result += binder::ExpressionUtil::toString(properties);
     }
+    if (numPartitions > 1) {
+        result += stringFormat(",Partition: {} of {}", partitionIdx, numPartitions);
+    }
     return result;
 }
 
@@ -49,6 +55,12 @@ void ScanNodeTableSharedState::initialize(const transaction::Transaction* transa
 void ScanNodeTableSharedState::nextMorsel(NodeTableScanState& scanState,
     ScanNodeTableProgressSharedState& progressSharedState) {
     std::unique_lock lck{mtx};
+    if (semiMask && semiMask->isEnabled()) {
+        skipUnmaskedNodeGroups(progressSharedState);
+    }
+    if (numPartitions > 1) {
+        skipNodeGroupsOfOtherPartitions(progressSharedState);
+    }
     if (currentCommittedGroupIdx < numCommittedNodeGroups) {
         scanState.nodeGroupIdx = currentCommittedGroupIdx++;
         progressSharedState.numGroupsScanned++;
@@ -63,6 +75,32 @@ void ScanNodeTableSharedState::nextMorsel(NodeTableScanState& scanState,
     scanState.source = TableScanSource::NONE;
 }
 
+void ScanNodeTableSharedState::skipUnmaskedNodeGroups(
+    ScanNodeTableProgressSharedState& progressSharedState) {
+    if (currentCommittedGroupIdx >= numCommittedNodeGroups) {
+        return;
+    }
+    const auto nextMaskedOffset = semiMask->nextMaskedOffset(
+        StorageUtils::getStartOffsetOfNodeGroup(currentCommittedGroupIdx));
+    const auto nextGroupIdx = nextMaskedOffset == INVALID_OFFSET ?
+                                  numCommittedNodeGroups :
+                                  std::min<node_group_idx_t>(numCommittedNodeGroups,
+                                      StorageUtils::getNodeGroupIdx(nextMaskedOffset));
+    // Skipped node groups count as scanned for the progress bar.
+    progressSharedState.numGroupsScanned += nextGroupIdx - currentCommittedGroupIdx;
+    currentCommittedGroupIdx = nextGroupIdx;
+}
+
+void ScanNodeTableSharedState::skipNodeGroupsOfOtherPartitions(
+    ScanNodeTableProgressSharedState& progressSharedState) {
+    // Uncommitted node groups are always scanned, the filter on the partition drops their nodes.
+    while (currentCommittedGroupIdx < numCommittedNodeGroups &&
+           currentCommittedGroupIdx % numPartitions != partitionIdx) {
+        progressSharedState.numGroupsScanned++;
+        currentCommittedGroupIdx++;
+    }
+}
+
 table_id_map_t<SemiMask*> ScanNodeTable::getSemiMasks() const {
     table_id_map_t<SemiMask*> result;
     KU_ASSERT(tableInfos.size() == sharedStates.size());
@@ -83,6 +121,15 @@ void ScanNodeTable::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
     ScanTable::initLocalStateInternal(resultSet, context);
     auto nodeIDVector = resultSet->getValueVector(opInfo.nodeIDPos).get();
     scanState = std::make_unique<NodeTableScanState>(nodeIDVector, outVectors, nodeIDVector->state);
+    scanState->pageAccessPattern = PageAccessPattern::USE_ONCE;
+    for (auto& info : runtimeJoinFilterInfos) {
+        runtimeJoinFilterProbers.emplace_back(info.filter,
+            resultSet->getValueVector(info.keyPos).get(),
+            MemoryManager::Get(*context->clientContext));
+    }
+    for (auto& info : topKFilterInfos) {
+        topKFilterProbers.emplace_back(info.bound, resultSet->getValueVector(info.keyPos).get());
+    }
     currentTableIdx = 0;
     initCurrentTable(context);
 }
@@ -93,6 +140,29 @@ void ScanNodeTable::initCurrentTable(ExecutionContext* context) {
     scanState->semiMask = sharedStates[currentTableIdx]->getSemiMask();
 }
 
+void ScanNodeTable::addTopKFilter(TopKFilterInfo info, idx_t propertyIdx,
+    const std::string& propertyName) {
+    for (auto& tableInfo : tableInfos) {
+        tableInfo.addColumnPredicate(propertyIdx,
+            std::make_unique<ColumnDynamicPredicate>(propertyName, info.bound));
+    }
+    topKFilterInfos.push_back(std::move(info));
+}
+
+bool ScanNodeTable::applyRuntimeFilters() {
+    for (auto& prober : runtimeJoinFilterProbers) {
+        if (!prober.select()) {
+            return false;
+        }
+    }
+    for (auto& prober : topKFilterProbers) {
+        if (!prober.select()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void ScanNodeTable::initGlobalStateInternal(ExecutionContext* context) {
     KU_ASSERT(sharedStates.size() == tableInfos.size());
     for (auto i = 0u; i < tableInfos.size(); i++) {
@@ -106,11 +176,13 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
     while (currentTableIdx < tableInfos.size()) {
         auto& info = tableInfos[currentTableIdx];
         while (info.table->scan(transaction, *scanState)) {
-            const auto outputSize = scanState->outState->getSelVector().getSelSize();
-            if (outputSize > 0) {
+            if (scanState->outState->getSelVector().getSelSize() > 0) {
                 info.castColumns();
                 scanState->outState->setToUnflat();
-                metrics->numOutputTuple.increase(outputSize);
+                if (!applyRuntimeFilters()) {
+                    continue;
+                }
+                metrics->numOutputTuple.increase(scanState->outState->getSelVector().getSelSize());
                 return true;
             }
         }
@@ -122,6 +194,11 @@ bool ScanNodeTable::getNextTuplesInternal(ExecutionContext* context) {
             }
         } else {
             info.table->initScanState(transaction, *scanState);
+            if (scanState->source == TableScanSource::COMMITTED) {
+                // Read ahead the node group after this one while this one is being scanned.
+                info.table->cast<NodeTable>().prefetchNodeGroupAsync(*scanState,
+                    scanState->nodeGroupIdx + 1);
+            }
         }
     }
     return false;
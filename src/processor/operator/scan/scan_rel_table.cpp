@@ -58,6 +58,7 @@ void ScanRelTableInfo::initScanState(TableScanState& scanState,
     const std::vector<ValueVector*>& outVectors, main::ClientContext* context) {
     auto transaction = transaction::Transaction::Get(*context);
     scanState.setToTable(transaction, table, columnIDs, copyVector(columnPredicates), direction);
+    scanState.cast<RelTableScanState>().initSortKeyPredicates(sortColumnID);
     initScanStateVectors(scanState, outVectors, MemoryManager::Get(*context));
 }
 
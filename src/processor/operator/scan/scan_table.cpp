@@ -38,6 +38,17 @@ void ScanTableInfo::addColumnInfo(column_id_t columnID, ColumnCaster caster) {
     columnCasters.push_back(std::move(caster));
 }
 
+void ScanTableInfo::addColumnPredicate(idx_t idx, std::unique_ptr<ColumnPredicate> predicate) {
+    KU_ASSERT(idx < columnIDs.size());
+    if (columnIDs[idx] == INVALID_COLUMN_ID || columnCasters[idx].hasCast()) {
+        return;
+    }
+    if (columnPredicates.empty()) {
+        columnPredicates.resize(columnIDs.size());
+    }
+    columnPredicates[idx].addPredicate(std::move(predicate));
+}
+
 void ScanTableInfo::initScanStateVectors(TableScanState& scanState,
     const std::vector<ValueVector*>& outVectors, MemoryManager* memoryManager) {
     if (!hasColumnCaster) {
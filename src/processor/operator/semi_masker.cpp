@@ -43,6 +43,7 @@ void SemiMaskerSharedState::mergeToGlobal() {
             for (const auto& item : globalVector) {
                 auto mask64 = static_cast<Roaring64BitmapSemiMask*>(item);
                 mask64->roaring = mergedMask;
+                mask64->finalize();
             }
         } else {
             std::vector<roaring::Roaring*> masks;
@@ -58,6 +59,7 @@ void SemiMaskerSharedState::mergeToGlobal() {
             for (const auto& item : globalVector) {
                 auto mask32 = static_cast<Roaring32BitmapSemiMask*>(item);
                 mask32->roaring = mergedMask;
+                mask32->finalize();
             }
         }
     }
@@ -2,6 +2,7 @@
 
 #include "function/table/simple_table_function.h"
 #include "processor/result/factorized_table.h"
+#include "processor/result/result_set.h"
 
 using namespace ryu::common;
 using namespace ryu::function;
@@ -31,9 +32,16 @@ struct FTableScanSharedState final : public SimpleTableFuncSharedState {
 // a dummy dataChunk during initialization and never use it.
 struct FTableScanTableFuncOutput : TableFuncOutput {
     std::vector<common::ValueVector*> vectors;
+    ResultSet& resultSet;
 
-    explicit FTableScanTableFuncOutput(std::vector<common::ValueVector*> vectors)
-        : TableFuncOutput(common::DataChunk{} /* dummy DataChunk */), vectors{std::move(vectors)} {}
+    FTableScanTableFuncOutput(std::vector<common::ValueVector*> vectors, ResultSet& resultSet)
+        : TableFuncOutput(common::DataChunk{} /* dummy DataChunk */), vectors{std::move(vectors)},
+          resultSet{resultSet} {}
+};
+
+struct FTableScanLocalState final : TableFuncLocalState {
+    // Rest of the morsel when scanning with multiplicities.
+    TableFuncMorsel morsel{0, 0};
 };
 
 static std::unique_ptr<TableFuncOutput> initFTableScanOutput(
@@ -42,18 +50,49 @@ static std::unique_ptr<TableFuncOutput> initFTableScanOutput(
     for (auto i = 0u; i < input.outColumnPositions.size(); ++i) {
         vectors.push_back(input.resultSet.getValueVector(input.outColumnPositions[i]).get());
     }
-    return std::make_unique<FTableScanTableFuncOutput>(std::move(vectors));
+    return std::make_unique<FTableScanTableFuncOutput>(std::move(vectors), input.resultSet);
 }
 
-static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
+static offset_t scanWithMultiplicity(const TableFuncInput& input,
+    FTableScanTableFuncOutput& output) {
     auto sharedState = ku_dynamic_cast<FTableScanSharedState*>(input.sharedState);
     auto bindData = ku_dynamic_cast<FTableScanBindData*>(input.bindData);
+    auto& morsel = ku_dynamic_cast<FTableScanLocalState*>(input.localState)->morsel;
+    if (morsel.endOffset <= morsel.startOffset) {
+        morsel = sharedState->getMorsel();
+        if (morsel.endOffset <= morsel.startOffset) {
+            return 0;
+        }
+    }
+    auto& table = *sharedState->table;
+    auto colOffset = table.getTableSchema()->getColOffset(*bindData->multiplicityColIdx);
+    auto getMultiplicity = [&](offset_t tupleIdx) {
+        return *reinterpret_cast<uint64_t*>(table.getTuple(tupleIdx) + colOffset);
+    };
+    auto multiplicity = getMultiplicity(morsel.startOffset);
+    auto endOffset = morsel.startOffset + 1;
+    while (endOffset < morsel.endOffset && getMultiplicity(endOffset) == multiplicity) {
+        endOffset++;
+    }
+    auto numTuples = endOffset - morsel.startOffset;
+    table.scan(output.vectors, morsel.startOffset, numTuples, bindData->columnIndices);
+    output.resultSet.multiplicity = multiplicity;
+    morsel.startOffset = endOffset;
+    return numTuples;
+}
+
+static offset_t tableFunc(const TableFuncInput& input, TableFuncOutput& output) {
+    auto& output_ = ku_dynamic_cast<FTableScanTableFuncOutput&>(output);
+    auto bindData = ku_dynamic_cast<FTableScanBindData*>(input.bindData);
+    if (bindData->multiplicityColIdx.has_value()) {
+        return scanWithMultiplicity(input, output_);
+    }
+    auto sharedState = ku_dynamic_cast<FTableScanSharedState*>(input.sharedState);
     auto morsel = sharedState->getMorsel();
     if (morsel.endOffset <= morsel.startOffset) {
         return 0;
     }
     auto numTuples = morsel.endOffset - morsel.startOffset;
-    auto& output_ = ku_dynamic_cast<FTableScanTableFuncOutput&>(output);
     sharedState->table->scan(output_.vectors, morsel.startOffset, numTuples,
         bindData->columnIndices);
     return numTuples;
@@ -65,11 +104,15 @@ static std::unique_ptr<TableFuncSharedState> initSharedState(
     return std::make_unique<FTableScanSharedState>(bindData->table, bindData->morselSize);
 }
 
+static std::unique_ptr<TableFuncLocalState> initLocalState(const TableFuncInitLocalStateInput&) {
+    return std::make_unique<FTableScanLocalState>();
+}
+
 std::unique_ptr<TableFunction> FTableScan::getFunction() {
     auto function = std::make_unique<TableFunction>(name, std::vector<LogicalTypeID>{});
     function->tableFunc = tableFunc;
     function->initSharedStateFunc = initSharedState;
-    function->initLocalStateFunc = TableFunction::initEmptyLocalState;
+    function->initLocalStateFunc = initLocalState;
     function->initOutputFunc = initFTableScanOutput;
     return function;
 }
@@ -1,5 +1,7 @@
 #include "processor/operator/unwind.h"
 
+#include <cstring>
+
 #include "binder/expression/expression.h" // IWYU pragma: keep
 #include "common/system_config.h"
 #include "processor/execution_context.h"
@@ -29,19 +31,46 @@ bool Unwind::hasMoreToRead() const {
     return listEntry.offset != INVALID_OFFSET && listEntry.size > startIndex;
 }
 
+static bool canCopyInBulk(const LogicalType& type) {
+    switch (type.getPhysicalType()) {
+    case PhysicalTypeID::STRUCT:
+    case PhysicalTypeID::LIST:
+    case PhysicalTypeID::ARRAY:
+        return false;
+    default:
+        return true;
+    }
+}
+
+// Copies a range of values with a single memcpy. Strings are not copied into the overflow of the
+// output vector. They keep pointing to the overflow of the list, which is not reset before the
+// next list is evaluated, i.e. before all of its elements have been emitted.
+static void copyInBulk(ValueVector& dstVector, const ValueVector& srcVector, uint64_t srcPos,
+    uint64_t numValues) {
+    if (srcVector.hasNoNullsGuarantee()) {
+        dstVector.setNullRange(0, numValues, false);
+    } else {
+        dstVector.setNullFromBits(srcVector.getNullMask().getData(), srcPos, 0, numValues);
+    }
+    const auto numBytesPerValue = srcVector.getNumBytesPerValue();
+    memcpy(dstVector.getData(), srcVector.getData() + srcPos * numBytesPerValue,
+        numValues * numBytesPerValue);
+}
+
 void Unwind::copyTuplesToOutVector(uint64_t startPos, uint64_t endPos) const {
     auto listDataVector = ListVector::getDataVector(expressionEvaluator->resultVector.get());
     auto listPos = listEntry.offset + startPos;
-    for (auto i = 0u; i < endPos - startPos; i++) {
-        outValueVector->copyFromVectorData(i, listDataVector, listPos++);
+    if (canCopyInBulk(listDataVector->dataType)) {
+        copyInBulk(*outValueVector, *listDataVector, listPos, endPos - startPos);
+    } else {
+        for (auto i = 0u; i < endPos - startPos; i++) {
+            outValueVector->copyFromVectorData(i, listDataVector, listPos++);
+        }
     }
     if (idVector != nullptr) {
         KU_ASSERT(listDataVector->dataType.getLogicalTypeID() == common::LogicalTypeID::NODE);
         auto idFieldVector = StructVector::getFieldVector(listDataVector, 0);
-        listPos = listEntry.offset + startPos;
-        for (auto i = 0u; i < endPos - startPos; i++) {
-            idVector->copyFromVectorData(i, idFieldVector.get(), listPos++);
-        }
+        copyInBulk(*idVector, *idFieldVector, listEntry.offset + startPos, endPos - startPos);
     }
 }
 
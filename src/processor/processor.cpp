@@ -5,6 +5,7 @@
 #include "processor/operator/sink.h"
 #include "processor/physical_plan.h"
 #include "processor/processor_task.h"
+#include "transaction/transaction.h"
 
 using namespace ryu::common;
 using namespace ryu::storage;
@@ -13,12 +14,12 @@ namespace ryu {
 namespace processor {
 
 #if defined(__APPLE__)
-QueryProcessor::QueryProcessor(uint64_t numThreads, uint32_t threadQos) {
-    taskScheduler = std::make_unique<TaskScheduler>(numThreads, threadQos);
+QueryProcessor::QueryProcessor(uint64_t numThreads, bool enableWorkStealing, uint32_t threadQos) {
+    taskScheduler = std::make_unique<TaskScheduler>(numThreads, enableWorkStealing, threadQos);
 }
 #else
-QueryProcessor::QueryProcessor(uint64_t numThreads) {
-    taskScheduler = std::make_unique<TaskScheduler>(numThreads);
+QueryProcessor::QueryProcessor(uint64_t numThreads, bool enableWorkStealing) {
+    taskScheduler = std::make_unique<TaskScheduler>(numThreads, enableWorkStealing);
 }
 #endif
 
@@ -34,7 +35,10 @@ std::unique_ptr<main::QueryResult> QueryProcessor::execute(PhysicalPlan* physica
     for (auto i = (int64_t)sink->getNumChildren() - 1; i >= 0; --i) {
         decomposePlanIntoTask(sink->getChild(i), task.get(), context);
     }
-    initTask(task.get());
+    if (sink->getMaxNumConcurrentChildren() > 1) {
+        task->setIndependentChildren(sink->getMaxNumConcurrentChildren());
+    }
+    initTask(task.get(), physicalPlan->isPointQuery);
     auto progressBar = ProgressBar::Get(*context->clientContext);
     progressBar->startProgress(context->queryID);
     taskScheduler->scheduleTaskAndWaitOrError(task, context);
@@ -54,6 +58,13 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
         }
         task->addChildTask(std::move(childTask));
     } else {
+        // The branches of a union are the only children of the pipeline it is the source of. They
+        // don't share state, so they can run concurrently unless they write.
+        if (op->getOperatorType() == PhysicalOperatorType::UNION_ALL_SCAN &&
+            task->children.empty() &&
+            transaction::Transaction::Get(*context->clientContext)->isReadOnly()) {
+            task->setIndependentChildren();
+        }
         // Schedule the right most side (e.g., build side of the hash join) first.
         for (auto i = (int64_t)op->getNumChildren() - 1; i >= 0; --i) {
             decomposePlanIntoTask(op->getChild(i), task, context);
@@ -61,7 +72,7 @@ void QueryProcessor::decomposePlanIntoTask(PhysicalOperator* op, Task* task,
     }
 }
 
-void QueryProcessor::initTask(Task* task) {
+void QueryProcessor::initTask(Task* task, bool isPointQuery) {
     auto processorTask = ku_dynamic_cast<ProcessorTask*>(task);
     PhysicalOperator* op = processorTask->sink;
     while (!op->isSource()) {
@@ -73,8 +84,11 @@ void QueryProcessor::initTask(Task* task) {
     if (!op->isParallel()) {
         task->setSingleThreadedTask();
     }
+    if (isPointQuery) {
+        task->setRunOnCallingThread();
+    }
     for (auto& child : task->children) {
-        initTask(child.get());
+        initTask(child.get(), isPointQuery);
     }
 }
 
@@ -1,5 +1,6 @@
 #include "processor/processor_task.h"
 
+#include "common/string_format.h"
 #include "common/task_system/progress_bar.h"
 #include "main/client_context.h"
 #include "main/settings.h"
@@ -36,6 +37,12 @@ void ProcessorTask::finalize() {
     sink->finalize(executionContext);
 }
 
+std::string ProcessorTask::getTraceName() const {
+    return stringFormat("{} ({})", PhysicalOperatorUtils::operatorTypeToString(
+                                       sink->getOperatorType()),
+        sink->getOperatorID());
+}
+
 bool ProcessorTask::terminate() {
     return sink->terminate();
 }
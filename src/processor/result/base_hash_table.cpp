@@ -28,6 +28,11 @@ void BaseHashTable::setMaxNumHashSlots(uint64_t newSize) {
     maxNumHashSlots = newSize;
 }
 
+void BaseHashTable::releaseHashSlots() {
+    hashSlotsBlocks.clear();
+    maxNumHashSlots = 0;
+}
+
 void BaseHashTable::computeVectorHashes(std::span<const ValueVector*> keyVectors) {
     hashVector->state = keyVectors[0]->state;
     VectorHashFunction::computeHash(*keyVectors[0], keyVectors[0]->state->getSelVector(),
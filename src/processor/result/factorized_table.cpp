@@ -6,7 +6,9 @@
 #include "common/exception/runtime.h"
 #include "common/null_buffer.h"
 #include "common/vector/value_vector.h"
+#include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
 
 using namespace ryu::common;
 using namespace ryu::storage;
@@ -41,6 +43,22 @@ void DataBlock::preventDestruction() {
     block->preventDestruction();
 }
 
+SpillResult DataBlock::spillToDisk(const Spiller& spiller) {
+    if (block->isSpilled()) {
+        return SpillResult{};
+    }
+    freeSize = 0;
+    return spiller.spillToDisk(*block);
+}
+
+void DataBlock::loadFromDisk(const Spiller& spiller) {
+    spiller.loadFromDisk(*block);
+}
+
+bool DataBlock::isSpilled() const {
+    return block->isSpilled();
+}
+
 void DataBlock::copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
     DataBlock* blockToCopyInto, ft_tuple_idx_t tupleIdxToCopyTo, uint32_t numTuplesToCopy,
     uint32_t numBytesPerTuple) {
@@ -265,6 +283,17 @@ uint64_t FactorizedTable::getTotalNumFlatTuples() const {
     return totalNumFlatTuples;
 }
 
+uint64_t FactorizedTable::getMemoryUsage() const {
+    uint64_t memoryUsage = inMemOverflowBuffer->getMemoryUsage();
+    for (auto& block : flatTupleBlockCollection->getBlocks()) {
+        memoryUsage += block->getSizedData().size();
+    }
+    for (auto& block : unFlatTupleBlockCollection->getBlocks()) {
+        memoryUsage += block->getSizedData().size();
+    }
+    return memoryUsage;
+}
+
 uint64_t FactorizedTable::getNumFlatTuples(ft_tuple_idx_t tupleIdx) const {
     std::unordered_map<uint32_t, bool> calculatedGroups;
     uint64_t numFlatTuples = 1;
@@ -346,6 +375,31 @@ void FactorizedTable::setOverflowColNull(uint8_t* nullBuffer, ft_col_idx_t colId
     tableSchema.setMayContainsNullsToTrue(colIdx);
 }
 
+SpillResult FactorizedTable::spillToDisk() {
+    KU_ASSERT(!hasUnflatCol());
+    SpillResult result;
+    memoryManager->getBufferManager()->getSpillerOrSkip([&](auto& spiller) {
+        for (auto& block : flatTupleBlockCollection->getBlocks()) {
+            result += block->spillToDisk(spiller);
+        }
+    });
+    return result;
+}
+
+void FactorizedTable::loadFromDisk() {
+    memoryManager->getBufferManager()->getSpillerOrSkip([&](auto& spiller) {
+        for (auto& block : flatTupleBlockCollection->getBlocks()) {
+            block->loadFromDisk(spiller);
+        }
+    });
+}
+
+bool FactorizedTable::hasSpilledBlocks() const {
+    return std::any_of(flatTupleBlockCollection->getBlocks().begin(),
+        flatTupleBlockCollection->getBlocks().end(),
+        [](const auto& block) { return block->isSpilled(); });
+}
+
 // TODO(Guodong): change this function to not use dataChunkPos in ColumnSchema.
 uint64_t FactorizedTable::computeNumTuplesToAppend(
     const std::vector<ValueVector*>& vectorsToAppend) const {
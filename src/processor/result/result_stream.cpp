@@ -0,0 +1,79 @@
+#include "processor/result/result_stream.h"
+
+#include "main/query_result.h"
+#include "processor/result/factorized_table.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace processor {
+
+void ResultStream::start(std::vector<std::string> columnNames,
+    std::vector<LogicalType> columnTypes) {
+    std::unique_lock lck{mtx};
+    // A query that is reoptimized is executed again with the same columns.
+    if (started) {
+        return;
+    }
+    this->columnNames = std::move(columnNames);
+    this->columnTypes = std::move(columnTypes);
+    started = true;
+    lck.unlock();
+    cv.notify_all();
+}
+
+bool ResultStream::waitUntilStarted() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return started || finished; });
+    return started;
+}
+
+bool ResultStream::push(std::shared_ptr<FactorizedTable> table) {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return tables.size() < CAPACITY || closed; });
+    if (closed) {
+        return false;
+    }
+    tables.push_back(std::move(table));
+    lck.unlock();
+    cv.notify_all();
+    return true;
+}
+
+std::shared_ptr<FactorizedTable> ResultStream::pop() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return !tables.empty() || finished; });
+    if (tables.empty()) {
+        return nullptr;
+    }
+    auto table = std::move(tables.front());
+    tables.pop_front();
+    lck.unlock();
+    cv.notify_all();
+    return table;
+}
+
+void ResultStream::finish(std::unique_ptr<main::QueryResult> result) {
+    std::unique_lock lck{mtx};
+    finalResult = std::move(result);
+    finished = true;
+    lck.unlock();
+    cv.notify_all();
+}
+
+std::unique_ptr<main::QueryResult> ResultStream::takeFinalResult() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return finished; });
+    return std::move(finalResult);
+}
+
+void ResultStream::close() {
+    std::unique_lock lck{mtx};
+    closed = true;
+    tables.clear();
+    lck.unlock();
+    cv.notify_all();
+}
+
+} // namespace processor
+} // namespace ryu
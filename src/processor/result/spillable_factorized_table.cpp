@@ -0,0 +1,53 @@
+#include "processor/result/spillable_factorized_table.h"
+
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/buffer_manager/spiller.h"
+
+using namespace ryu::storage;
+
+namespace ryu {
+namespace processor {
+
+SpillableFactorizedTable::~SpillableFactorizedTable() {
+    table.getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+        [&](auto& spiller) { spiller.clearUnusedChunk(this); });
+}
+
+FactorizedTable& SpillableFactorizedTable::pin(bool loadSpilledBlocks) {
+    {
+        std::unique_lock lck{mtx};
+        if (numPins++ == 0) {
+            table.getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+                [&](auto& spiller) { spiller.clearUnusedChunk(this); });
+        }
+    }
+    if (loadSpilledBlocks) {
+        // Loading allocates memory, which may spill other objects, so it is done without holding
+        // mtx.
+        std::unique_lock lck{loadMtx};
+        table.loadFromDisk();
+    }
+    return table;
+}
+
+void SpillableFactorizedTable::unpin() {
+    std::unique_lock lck{mtx};
+    KU_ASSERT(numPins > 0);
+    if (--numPins == 0) {
+        table.getMemoryManager()->getBufferManager()->getSpillerOrSkip(
+            [&](auto& spiller) { spiller.addUnusedChunk(this); });
+    }
+}
+
+SpillResult SpillableFactorizedTable::spillToDisk() {
+    std::unique_lock lck{mtx};
+    // The table may have been pinned between being picked by the spiller and this call.
+    if (numPins > 0) {
+        return SpillResult{};
+    }
+    return table.spillToDisk();
+}
+
+} // namespace processor
+} // namespace ryu
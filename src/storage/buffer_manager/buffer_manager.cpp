@@ -12,9 +12,13 @@
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/local_file_system.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/numa_utils.h"
 #include "common/types/types.h"
+#include "common/utils.h"
+#include "main/database_metrics.h"
 #include "main/db_config.h"
 #include "storage/buffer_manager/spiller.h"
+#include "storage/cold_storage.h"
 #include "storage/file_handle.h"
 #include "storage/table/column_chunk_data.h"
 #include <span>
@@ -64,13 +68,34 @@ void EvictionQueue::clear(std::atomic<EvictionCandidate>& candidate) {
 }
 
 BufferManager::BufferManager(const std::string& databasePath, const std::string& spillToDiskPath,
-    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly)
-    : bufferPoolSize{bufferPoolSize}, evictionQueue{bufferPoolSize / RYU_PAGE_SIZE},
-      usedMemory{evictionQueue.getCapacity() * sizeof(EvictionCandidate)}, vfs{vfs} {
+    uint64_t bufferPoolSize, uint64_t maxDBSize, VirtualFileSystem* vfs, bool readOnly,
+    EvictionPolicy evictionPolicy, bool enableHugePages, bool enableNUMAPartitioning)
+    : bufferPoolSize{bufferPoolSize}, evictionPolicy{evictionPolicy},
+      enableHugePages{enableHugePages}, vfs{vfs} {
     verifySizeParams(bufferPoolSize, maxDBSize);
+    auto nodeCPUs =
+        enableNUMAPartitioning ? NUMAUtils::getNodeCPUs() : std::vector<std::vector<uint64_t>>{};
+    auto numPartitions = std::max<uint64_t>(nodeCPUs.size(), 1);
+    for (auto nodeIdx = 0u; nodeIdx < nodeCPUs.size(); nodeIdx++) {
+        for (auto cpu : nodeCPUs[nodeIdx]) {
+            if (cpu >= cpuPartitions.size()) {
+                cpuPartitions.resize(cpu + 1, 0);
+            }
+            cpuPartitions[cpu] = nodeIdx;
+        }
+    }
+    // Each page is enqueued into exactly one partition, so the queues only need to hold all pages
+    // that fit into the buffer pool together.
+    auto queueCapacity = ceilDiv(bufferPoolSize / RYU_PAGE_SIZE, numPartitions);
+    uint64_t queueMemory = 0;
+    for (auto i = 0u; i < numPartitions; i++) {
+        partitions.push_back(std::make_unique<BufferPoolPartition>(queueCapacity));
+        queueMemory += partitions.back()->evictionQueue.getCapacity() * sizeof(EvictionCandidate);
+    }
+    partitions[0]->usedMemory = queueMemory;
 #if !BM_MALLOC
-    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize);
-    vmRegions[1] = std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize);
+    vmRegions[0] = std::make_unique<VMRegion>(REGULAR_PAGE, maxDBSize, enableHugePages);
+    vmRegions[1] = std::make_unique<VMRegion>(TEMP_PAGE, bufferPoolSize, enableHugePages);
 #endif
 
     // TODO(bmwinger): It may be better to spill to disk in a different location for remote file
@@ -111,6 +136,12 @@ void BufferManager::verifySizeParams(uint64_t bufferPoolSize, uint64_t maxDBSize
 // (3) If multiple threads are writing to the page, they should coordinate separately because they
 // both get access to the same piece of memory.
 uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
+    PageReadPolicy pageReadPolicy) {
+    recordPageAccess();
+    return pinPage(fileHandle, pageIdx, pageReadPolicy);
+}
+
+uint8_t* BufferManager::pinPage(FileHandle& fileHandle, page_idx_t pageIdx,
     PageReadPolicy pageReadPolicy) {
     auto pageState = fileHandle.getPageState(pageIdx);
     while (true) {
@@ -123,7 +154,7 @@ uint8_t* BufferManager::pin(FileHandle& fileHandle, page_idx_t pageIdx,
                     throw BufferManagerException("Unable to allocate memory! The buffer pool is "
                                                  "full and no memory could be freed!");
                 }
-                if (!evictionQueue.insert(fileHandle.getFileIndex(), pageIdx)) {
+                if (!enqueueEvictionCandidate(fileHandle.getFileIndex(), pageIdx)) {
                     throw BufferManagerException(
                         "Eviction queue is full! This should be impossible.");
                 }
@@ -216,8 +247,12 @@ inline bool try_func(const std::function<void(uint8_t*)>& func, uint8_t* frame,
 }
 
 void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& func) {
+    const std::function<void(uint8_t*)>& func, PageAccessPattern accessPattern) {
+    recordPageAccess();
     auto pageState = fileHandle.getPageState(pageIdx);
+    // Reads of pages which are only used once don't count as a use, so these pages stay MARKED.
+    const bool isUseOnce = evictionPolicy == EvictionPolicy::SCAN_RESISTANT &&
+                           accessPattern == PageAccessPattern::USE_ONCE;
 #if defined(_WIN32)
     // Change the Structured Exception handling just for the scope of this function
     auto translator = ScopedTranslator(handleAccessViolation);
@@ -225,6 +260,16 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
     while (true) {
         auto currStateAndVersion = pageState->getStateAndVersion();
         switch (PageState::getState(currStateAndVersion)) {
+        case PageState::MARKED: {
+            if (!isUseOnce) {
+                // If the page is marked, we try to switch to unlocked.
+                pageState->tryClearMark(currStateAndVersion);
+                continue;
+            }
+            // Otherwise, read the page without clearing its mark. Evicting the page changes its
+            // state, so the version check below detects a concurrent eviction.
+            [[fallthrough]];
+        }
         case PageState::UNLOCKED: {
             if (!try_func(func, getFrame(fileHandle, pageIdx), vmRegions,
                     fileHandle.getPageSizeClass(), pageState)) {
@@ -234,14 +279,13 @@ void BufferManager::optimisticRead(FileHandle& fileHandle, page_idx_t pageIdx,
                 return;
             }
         } break;
-        case PageState::MARKED: {
-            // If the page is marked, we try to switch to unlocked.
-            pageState->tryClearMark(currStateAndVersion);
-            continue;
-        }
         case PageState::EVICTED: {
-            pin(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
-            unpin(fileHandle, pageIdx);
+            pinPage(fileHandle, pageIdx, PageReadPolicy::READ_PAGE);
+            if (isUseOnce) {
+                pageState->unlockAndMark();
+            } else {
+                unpin(fileHandle, pageIdx);
+            }
         } break;
         default: {
             // When locked, continue the spinning.
@@ -256,9 +300,130 @@ void BufferManager::unpin(FileHandle& fileHandle, page_idx_t pageIdx) {
     pageState->unlock();
 }
 
-// evicts up to 64 pages and returns the space reclaimed
+void BufferManager::prefetchPages(FileHandle& fileHandle, page_idx_t startPageIdx,
+    page_idx_t numPages, PageAccessPattern accessPattern) {
+    const bool isUseOnce = evictionPolicy == EvictionPolicy::SCAN_RESISTANT &&
+                           accessPattern == PageAccessPattern::USE_ONCE;
+    auto endPageIdx = std::min(startPageIdx + numPages, fileHandle.getNumPages());
+    const auto coldStorage = fileHandle.getColdStorage();
+    std::vector<page_idx_t> pages;
+    std::vector<page_idx_t> coldPages;
+    std::vector<FileReadRequest> requests;
+    for (auto pageIdx = startPageIdx; pageIdx < endPageIdx;) {
+        pages.clear();
+        coldPages.clear();
+        requests.clear();
+        bool canClaimFrames = true;
+        for (; pageIdx < endPageIdx && pages.size() < MAX_NUM_PAGES_PER_PREFETCH; pageIdx++) {
+            auto pageState = fileHandle.getPageState(pageIdx);
+            auto currStateAndVersion = pageState->getStateAndVersion();
+            if (PageState::getState(currStateAndVersion) != PageState::EVICTED ||
+                !pageState->tryLock(currStateAndVersion)) {
+                continue;
+            }
+            if (!claimAFrame(fileHandle, pageIdx, PageReadPolicy::DONT_READ_PAGE)) {
+                pageState->resetToEvicted();
+                canClaimFrames = false;
+                break;
+            }
+            // The page is released with the rest of the batch if it can't be queued for eviction.
+            pages.push_back(pageIdx);
+            if (!enqueueEvictionCandidate(fileHandle.getFileIndex(), pageIdx)) {
+                releaseClaimedFrames(fileHandle, pages);
+                throw BufferManagerException("Eviction queue is full! This should be impossible.");
+            }
+            // Offloaded pages can't be part of the batch read from the local file.
+            if (coldStorage != nullptr && coldStorage->isColdPage(pageIdx)) {
+                coldPages.push_back(pageIdx);
+                continue;
+            }
+            requests.push_back({getFrame(fileHandle, pageIdx), fileHandle.getPageSize(),
+                static_cast<uint64_t>(pageIdx) * fileHandle.getPageSize()});
+        }
+        try {
+            fileHandle.getFileInfo()->readFromFileBatch(requests);
+            for (auto page : coldPages) {
+                fileHandle.readPageFromDisk(getFrame(fileHandle, page), page);
+            }
+        } catch (...) {
+            releaseClaimedFrames(fileHandle, pages);
+            throw;
+        }
+        recordPageMisses(pages.size(), fileHandle.getPageSize());
+        for (auto page : pages) {
+            if (isUseOnce) {
+                fileHandle.getPageState(page)->unlockAndMark();
+            } else {
+                fileHandle.getPageState(page)->unlock();
+            }
+        }
+        if (!canClaimFrames) {
+            return;
+        }
+    }
+}
+
+BufferManagerThreadStats& BufferManager::getThreadStats() {
+    thread_local BufferManagerThreadStats stats;
+    return stats;
+}
+
+void BufferManager::recordPageAccess() {
+    getThreadStats().numPageAccesses++;
+    if (metrics != nullptr) {
+        metrics->numPageAccesses.increase();
+    }
+}
+
+void BufferManager::recordPageMisses(uint64_t numPages, uint64_t pageSize) {
+    auto& stats = getThreadStats();
+    stats.numPageMisses += numPages;
+    stats.numBytesRead += numPages * pageSize;
+    if (metrics != nullptr) {
+        metrics->numPageMisses.increase(numPages);
+        metrics->numBytesRead.increase(numPages * pageSize);
+    }
+}
+
+BufferPoolPartition& BufferManager::getLocalPartition() const {
+    if (cpuPartitions.empty()) {
+        return *partitions[0];
+    }
+    auto cpu = NUMAUtils::getCurrentCPU();
+    return *partitions[cpu < cpuPartitions.size() ? cpuPartitions[cpu] : 0];
+}
+
+bool BufferManager::enqueueEvictionCandidate(file_idx_t fileIdx, page_idx_t pageIdx) {
+    auto& localPartition = getLocalPartition();
+    if (localPartition.evictionQueue.insert(fileIdx, pageIdx)) {
+        return true;
+    }
+    for (auto& partition : partitions) {
+        if (partition.get() != &localPartition &&
+            partition->evictionQueue.insert(fileIdx, pageIdx)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 uint64_t BufferManager::evictPages() {
+    auto& localPartition = getLocalPartition();
+    // Pages of the local partition were mostly claimed by threads on this node, so their frames
+    // are likely backed by local memory which is reused when the freed frame is touched again.
+    auto claimedMemory = evictPages(localPartition.evictionQueue);
+    for (auto i = 0u; i < partitions.size() && claimedMemory == 0; i++) {
+        if (partitions[i].get() != &localPartition) {
+            claimedMemory = evictPages(partitions[i]->evictionQueue);
+        }
+    }
+    return claimedMemory;
+}
+
+// evicts up to 64 pages and returns the space reclaimed
+uint64_t BufferManager::evictPages(EvictionQueue& evictionQueue) {
     std::array<std::atomic<EvictionCandidate>*, EvictionQueue::BATCH_SIZE> evictionCandidates{};
+    std::array<std::pair<PageState*, uint64_t>, EvictionQueue::BATCH_SIZE> pagesToMark{};
     size_t evictablePages = 0;
     uint64_t claimedMemory = 0;
 
@@ -271,6 +436,7 @@ uint64_t BufferManager::evictPages() {
     auto startCursor = evictionQueue.getEvictionCursor();
     auto failureLimit = evictionQueue.getCapacity() * 2;
     while (evictablePages == 0 && evictionQueue.getEvictionCursor() - startCursor < failureLimit) {
+        size_t numPagesToMark = 0;
         for (auto& candidate : evictionQueue.next()) {
             auto evictionCandidate = candidate.load();
             if (evictionCandidate == EvictionQueue::EMPTY) {
@@ -282,34 +448,44 @@ uint64_t BufferManager::evictPages() {
             auto pageStateAndVersion = pageState->getStateAndVersion();
             if (!evictionCandidate.isEvictable(pageStateAndVersion)) {
                 if (evictionCandidate.isSecondChanceEvictable(pageStateAndVersion)) {
-                    pageState->tryMark(pageStateAndVersion);
+                    pagesToMark[numPagesToMark++] = {pageState, pageStateAndVersion};
                 }
                 continue;
             }
             evictionCandidates[evictablePages++] = &candidate;
         }
+        // With the scan-resistant policy, recently used pages keep their second chance as long as
+        // there are marked pages (e.g. pages only read once by scans) to evict.
+        if (evictionPolicy == EvictionPolicy::CLOCK || evictablePages == 0) {
+            for (size_t i = 0; i < numPagesToMark; i++) {
+                pagesToMark[i].first->tryMark(pagesToMark[i].second);
+            }
+        }
     }
 
     for (size_t i = 0; i < evictablePages; i++) {
-        claimedMemory += tryEvictPage(*evictionCandidates[i]);
+        claimedMemory += tryEvictPage(evictionQueue, *evictionCandidates[i]);
     }
     return claimedMemory;
 }
 
 void BufferManager::removeEvictedCandidates() {
-    auto startCursor = evictionQueue.getEvictionCursor();
-    while (evictionQueue.getEvictionCursor() - startCursor < evictionQueue.getCapacity()) {
-        for (auto& candidate : evictionQueue.next()) {
-            auto evictionCandidate = candidate.load();
-            if (evictionCandidate == EvictionQueue::EMPTY) {
-                continue;
-            }
-            KU_ASSERT(evictionCandidate.fileIdx < fileHandles.size());
-            auto* pageState =
-                fileHandles[evictionCandidate.fileIdx]->getPageState(evictionCandidate.pageIdx);
-            auto pageStateAndVersion = pageState->getStateAndVersion();
-            if (PageState::getState(pageStateAndVersion) == PageState::EVICTED) {
-                evictionQueue.clear(candidate);
+    for (auto& partition : partitions) {
+        auto& evictionQueue = partition->evictionQueue;
+        auto startCursor = evictionQueue.getEvictionCursor();
+        while (evictionQueue.getEvictionCursor() - startCursor < evictionQueue.getCapacity()) {
+            for (auto& candidate : evictionQueue.next()) {
+                auto evictionCandidate = candidate.load();
+                if (evictionCandidate == EvictionQueue::EMPTY) {
+                    continue;
+                }
+                KU_ASSERT(evictionCandidate.fileIdx < fileHandles.size());
+                auto* pageState =
+                    fileHandles[evictionCandidate.fileIdx]->getPageState(evictionCandidate.pageIdx);
+                auto pageStateAndVersion = pageState->getStateAndVersion();
+                if (PageState::getState(pageStateAndVersion) == PageState::EVICTED) {
+                    evictionQueue.clear(candidate);
+                }
             }
         }
     }
@@ -318,7 +494,8 @@ void BufferManager::removeEvictedCandidates() {
 // This function tries to load the given page into a frame. Due to our design of mmap, each page is
 // uniquely mapped to a frame. Thus, claiming a frame is equivalent to ensuring enough physical
 // memory is available.
-// First, we reserve the memory for the page, which increments the atomic counter `usedMemory`.
+// First, we reserve the memory for the page, which increments the `usedMemory` counter of the local
+// partition.
 // Then, we check if there is enough memory available. If not, we evict pages until we have enough
 // or we can find no more pages to be evicted.
 // Lastly, we double check if the needed memory is available. If not, we free the memory we reserved
@@ -346,7 +523,7 @@ bool BufferManager::claimAFrame(FileHandle& fileHandle, page_idx_t pageIdx,
 
 bool BufferManager::reserve(uint64_t sizeToReserve) {
     // Reserve the memory for the page.
-    usedMemory += sizeToReserve;
+    getLocalPartition().usedMemory += sizeToReserve;
     uint64_t totalClaimedMemory = 0;
     uint64_t nonEvictableClaimedMemory = 0;
     const auto needMoreMemory = [&]() {
@@ -356,7 +533,7 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
         // higher than the buffer pool size as we should never actually exceed the buffer pool size.
         return sizeToReserve > totalClaimedMemory &&
                // usedMemory - totalClaimedMemory could underflow
-               usedMemory > bufferPoolSize.load() - totalClaimedMemory;
+               getUsedMemory() > bufferPoolSize.load() - totalClaimedMemory;
     };
     uint8_t failedCount = 0;
     // Evict pages if necessary until we have enough memory.
@@ -364,9 +541,14 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
         uint64_t memoryClaimed = 0;
         // Avoid reducing the evictable memory below 1/2 at first to reduce thrashing if most of the
         // memory is non-evictable
-        if (!spiller || usedMemory - nonEvictableMemory > bufferPoolSize / 2) {
+        const bool preferEviction =
+            !spiller || getUsedMemory() - nonEvictableMemory > bufferPoolSize / 2;
+        if (preferEviction) {
             memoryClaimed = evictPages();
-        } else {
+        }
+        // Also fall back to the spiller if no page could be evicted, e.g. because the evictable
+        // memory is pinned by operators whose state can be spilled.
+        if (spiller && memoryClaimed == 0) {
             auto [_memoryClaimed, nowEvictableMemory] = spiller->claimNextGroup();
             memoryClaimed = _memoryClaimed;
             nonEvictableClaimedMemory += _memoryClaimed;
@@ -400,7 +582,8 @@ bool BufferManager::reserve(uint64_t sizeToReserve) {
     return true;
 }
 
-uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate) {
+uint64_t BufferManager::tryEvictPage(EvictionQueue& evictionQueue,
+    std::atomic<EvictionCandidate>& _candidate) {
     auto candidate = _candidate.load();
     // Page must have been evicted by another thread already
     if (candidate.pageIdx == INVALID_PAGE_IDX) {
@@ -438,6 +621,9 @@ uint64_t BufferManager::tryEvictPage(std::atomic<EvictionCandidate>& _candidate)
     releaseFrameForPage(fileHandle, candidate.pageIdx);
     pageState.resetToEvicted();
     evictionQueue.clear(_candidate);
+    if (metrics != nullptr) {
+        metrics->numEvictedPages.increase();
+    }
     return numBytesFreed;
 }
 
@@ -445,6 +631,9 @@ void BufferManager::cachePageIntoFrame(FileHandle& fileHandle, page_idx_t pageId
     PageReadPolicy pageReadPolicy) {
     auto pageState = fileHandle.getPageState(pageIdx);
     pageState->clearDirty();
+    if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
+        recordPageMisses(1, fileHandle.getPageSize());
+    }
 #if BM_MALLOC
     pageState->allocatePage(fileHandle.getPageSize());
     if (pageReadPolicy == PageReadPolicy::READ_PAGE) {
@@ -473,6 +662,15 @@ void BufferManager::updateFrameIfPageIsInFrameWithoutLock(file_idx_t fileIdx,
     }
 }
 
+void BufferManager::releaseClaimedFrames(FileHandle& fileHandle,
+    std::span<const page_idx_t> pages) {
+    for (auto pageIdx : pages) {
+        releaseFrameForPage(fileHandle, pageIdx);
+        freeUsedMemory(fileHandle.getPageSize());
+        fileHandle.getPageState(pageIdx)->resetToEvicted();
+    }
+}
+
 void BufferManager::removePageFromFrameIfNecessary(FileHandle& fileHandle, page_idx_t pageIdx) {
     if (pageIdx >= fileHandle.getNumPages()) {
         return;
@@ -496,9 +694,20 @@ void BufferManager::removePageFromFrame(FileHandle& fileHandle, page_idx_t pageI
     pageState->resetToEvicted();
 }
 
-uint64_t BufferManager::freeUsedMemory(uint64_t size) {
-    KU_ASSERT(usedMemory.load() >= size);
-    return usedMemory.fetch_sub(size);
+uint64_t BufferManager::getUsedMemory() const {
+    uint64_t usedMemory = 0;
+    for (auto& partition : partitions) {
+        usedMemory += partition->usedMemory.load(std::memory_order_relaxed);
+    }
+    // The counters are read one after another, so memory freed through one partition may be seen
+    // before it was reserved through another one. The sum is only briefly too small then, but it
+    // must not wrap around.
+    return static_cast<int64_t>(usedMemory) < 0 ? 0 : usedMemory;
+}
+
+void BufferManager::freeUsedMemory(uint64_t size) {
+    KU_ASSERT(getUsedMemory() >= size);
+    getLocalPartition().usedMemory.fetch_sub(size);
 }
 
 void BufferManager::resetSpiller(std::string spillPath) {
@@ -1,13 +1,20 @@
 #include "storage/buffer_manager/memory_manager.h"
 
+#include <cstring>
 #include <mutex>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 #include "common/exception/buffer_manager.h"
 #include "common/file_system/virtual_file_system.h"
+#include "common/memory_tracker.h"
 #include "common/types/types.h"
 #include "main/client_context.h"
 #include "main/database.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/vm_region.h"
 #include "storage/file_handle.h"
 
 using namespace ryu::common;
@@ -16,33 +23,55 @@ namespace ryu {
 namespace storage {
 
 MemoryBuffer::MemoryBuffer(MemoryManager* mm, page_idx_t pageIdx, uint8_t* buffer, uint64_t size)
-    : buffer{buffer, static_cast<size_t>(size)}, mm{mm}, pageIdx{pageIdx}, evicted{false} {}
+    : buffer{buffer, static_cast<size_t>(size)}, mm{mm}, pageIdx{pageIdx}, evicted{false} {
+    if (const auto tracker = MemoryTracker::getThreadLocal()) {
+        memoryTracker = tracker->shared_from_this();
+        memoryTracker->allocate(size);
+    }
+}
 
 MemoryBuffer::~MemoryBuffer() {
     if (buffer.data() != nullptr && !evicted) {
         mm->freeBlock(pageIdx, buffer);
         mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
+        if (memoryTracker != nullptr) {
+            memoryTracker->free(buffer.size());
+        }
         buffer = std::span<uint8_t>();
     }
 }
 
 SpillResult MemoryBuffer::setSpilledToDisk(uint64_t filePosition) {
     mm->freeBlock(pageIdx, buffer);
+    if (memoryTracker != nullptr) {
+        memoryTracker->free(buffer.size());
+    }
+    SpillResult result;
+    if (pageIdx == INVALID_PAGE_IDX) {
+        result = SpillResult{buffer.size(), 0};
+    } else {
+        // The page is unpinned and can be evicted and reused by the memory manager. Page-backed
+        // memory is never accounted as non-evictable, so nothing is reported as freed or as now
+        // evictable: the buffer manager evicts the unpinned page if it still needs memory.
+        // The buffer is malloc'ed when loaded back from disk (see prepareLoadFromDisk), so it must
+        // not be treated as a page-backed buffer on destruction.
+        mm->updateUsedMemoryForFreedBlock(pageIdx, buffer);
+        pageIdx = INVALID_PAGE_IDX;
+    }
     // reinterpret_cast isn't allowed here, but we shouldn't leave the invalid pointer and
     // still want to store the size
     buffer = std::span(static_cast<uint8_t*>(nullptr), buffer.size());
     evicted = true;
     this->filePosition = filePosition;
-    if (pageIdx == INVALID_PAGE_IDX) {
-        return SpillResult{buffer.size(), 0};
-    } else {
-        return SpillResult{0, buffer.size()};
-    }
+    return result;
 }
 
 void MemoryBuffer::prepareLoadFromDisk() {
     KU_ASSERT(buffer.data() == nullptr && evicted);
     buffer = mm->mallocBuffer(false, buffer.size());
+    if (memoryTracker != nullptr) {
+        memoryTracker->allocate(buffer.size());
+    }
     evicted = false;
 }
 
@@ -58,6 +87,23 @@ std::span<uint8_t> MemoryManager::mallocBuffer(bool initializeToZero, uint64_t s
     }
     void* buffer = nullptr;
     bm->nonEvictableMemory += size;
+#if defined(__linux__)
+    // Buffers spanning huge pages are aligned to them, so that they can be backed by transparent
+    // huge pages. Memory allocated by aligned_alloc is released with free() as well.
+    if (bm->hugePagesEnabled() && size >= VMRegion::HUGE_PAGE_SIZE) {
+        constexpr auto alignment = VMRegion::HUGE_PAGE_SIZE;
+        buffer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+        if (buffer != nullptr) {
+#ifdef MADV_HUGEPAGE
+            madvise(buffer, size, MADV_HUGEPAGE);
+#endif
+            if (initializeToZero) {
+                memset(buffer, 0, size);
+            }
+            return std::span(static_cast<uint8_t*>(buffer), size);
+        }
+    }
+#endif
     if (initializeToZero) {
         buffer = calloc(size, 1);
     } else {
@@ -107,6 +153,25 @@ void MemoryManager::updateUsedMemoryForFreedBlock(page_idx_t pageIdx, std::span<
     }
 }
 
+std::shared_ptr<QueryMemoryTracker> MemoryManager::createQueryMemoryTracker(uint64_t queryID) {
+    auto tracker = std::make_shared<QueryMemoryTracker>(queryID);
+    std::unique_lock lock{queryMemoryTrackersLock};
+    std::erase_if(queryMemoryTrackers, [](const auto& entry) { return entry.expired(); });
+    queryMemoryTrackers.push_back(tracker);
+    return tracker;
+}
+
+std::vector<std::shared_ptr<QueryMemoryTracker>> MemoryManager::getQueryMemoryTrackers() {
+    std::vector<std::shared_ptr<QueryMemoryTracker>> result;
+    std::unique_lock lock{queryMemoryTrackersLock};
+    for (auto& tracker : queryMemoryTrackers) {
+        if (auto liveTracker = tracker.lock()) {
+            result.push_back(std::move(liveTracker));
+        }
+    }
+    return result;
+}
+
 MemoryManager* MemoryManager::Get(const main::ClientContext& context) {
     return context.getDatabase()->getMemoryManager();
 }
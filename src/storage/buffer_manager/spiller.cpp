@@ -9,7 +9,6 @@
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/file_handle.h"
-#include "storage/table/chunked_node_group.h"
 #include "storage/table/column_chunk_data.h"
 
 namespace ryu {
@@ -17,7 +16,8 @@ namespace storage {
 
 Spiller::Spiller(std::string tmpFilePath, BufferManager& bufferManager,
     common::VirtualFileSystem* vfs)
-    : tmpFilePath{std::move(tmpFilePath)}, bufferManager{bufferManager}, vfs{vfs}, dataFH{nullptr} {
+    : tmpFilePath{std::move(tmpFilePath)}, bufferManager{bufferManager}, vfs{vfs}, dataFH{nullptr},
+      numBytesSpilled{0} {
     // Clear the file if it already existed (e.g. from a previous run which
     // failed to clean up).
     vfs->removeFileIfExists(this->tmpFilePath);
@@ -44,14 +44,14 @@ FileHandle* Spiller::getDataFH() const {
     return nullptr;
 }
 
-void Spiller::addUnusedChunk(InMemChunkedNodeGroup* nodeGroup) {
+void Spiller::addUnusedChunk(SpillableObject* object) {
     std::unique_lock lock(partitionerGroupsMtx);
-    fullPartitionerGroups.insert(nodeGroup);
+    fullPartitionerGroups.insert(object);
 }
 
-void Spiller::clearUnusedChunk(InMemChunkedNodeGroup* nodeGroup) {
+void Spiller::clearUnusedChunk(SpillableObject* object) {
     std::unique_lock lock(partitionerGroupsMtx);
-    auto entry = fullPartitionerGroups.find(nodeGroup);
+    auto entry = fullPartitionerGroups.find(object);
     if (entry != fullPartitionerGroups.end()) {
         fullPartitionerGroups.erase(entry);
     }
@@ -66,18 +66,25 @@ Spiller::~Spiller() {
 }
 
 SpillResult Spiller::spillToDisk(ColumnChunkData& chunk) const {
-    auto& buffer = *chunk.buffer;
+    return spillToDisk(*chunk.buffer);
+}
+
+void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
+    loadFromDisk(*chunk.buffer);
+}
+
+SpillResult Spiller::spillToDisk(MemoryBuffer& buffer) const {
     KU_ASSERT(!buffer.evicted);
     auto dataFH = getOrCreateDataFH();
     auto pageSize = dataFH->getPageSize();
     auto numPages = (buffer.buffer.size_bytes() + pageSize - 1) / pageSize;
     auto startPage = dataFH->addNewPages(numPages);
     dataFH->writePagesToFile(buffer.buffer.data(), buffer.buffer.size_bytes(), startPage);
+    numBytesSpilled.fetch_add(buffer.buffer.size_bytes(), std::memory_order_relaxed);
     return buffer.setSpilledToDisk(startPage * pageSize);
 }
 
-void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
-    auto& buffer = *chunk.buffer;
+void Spiller::loadFromDisk(MemoryBuffer& buffer) const {
     if (buffer.evicted) {
         buffer.prepareLoadFromDisk();
         auto dataFH = getDataFH();
@@ -88,7 +95,7 @@ void Spiller::loadFromDisk(ColumnChunkData& chunk) const {
 }
 
 SpillResult Spiller::claimNextGroup() {
-    InMemChunkedNodeGroup* groupToFlush = nullptr;
+    SpillableObject* groupToFlush = nullptr;
     {
         std::unique_lock lock(partitionerGroupsMtx);
         if (!fullPartitionerGroups.empty()) {
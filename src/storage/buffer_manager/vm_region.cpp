@@ -19,7 +19,8 @@ using namespace ryu::common;
 namespace ryu {
 namespace storage {
 
-VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFrameGroups{0} {
+VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize, bool useHugePages)
+    : numFrameGroups{0} {
     if (maxRegionSize > static_cast<std::size_t>(-1)) {
         throw BufferManagerException("maxRegionSize is beyond the max available mmap region size.");
     }
@@ -27,6 +28,8 @@ VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFra
     const auto numBytesForFrameGroup = frameSize * StorageConstants::PAGE_GROUP_SIZE;
     maxNumFrameGroups = (maxRegionSize + numBytesForFrameGroup - 1) / numBytesForFrameGroup;
 #ifdef _WIN32
+    // Large pages on Windows can't be reserved without committing them, so they are not used.
+    KU_UNUSED(useHugePages);
     region = (uint8_t*)VirtualAlloc(NULL, getMaxRegionSize(), MEM_RESERVE, PAGE_READWRITE);
     if (region == NULL) {
         throw BufferManagerException(stringFormat(
@@ -36,11 +39,28 @@ VMRegion::VMRegion(PageSizeClass pageSizeClass, uint64_t maxRegionSize) : numFra
 #else
     // Create a private anonymous mapping. The mapping is not shared with other processes and not
     // backed by any file, and its content are initialized to zero.
-    region = static_cast<uint8_t*>(mmap(NULL, getMaxRegionSize(), PROT_READ | PROT_WRITE,
+    // Huge pages need an aligned region, so HUGE_PAGE_SIZE more is reserved and the unaligned
+    // head and tail are unmapped again.
+    const auto reservedSize = getMaxRegionSize() + (useHugePages ? HUGE_PAGE_SIZE : 0);
+    auto reserved = static_cast<uint8_t*>(mmap(NULL, reservedSize, PROT_READ | PROT_WRITE,
         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1 /* fd */, 0 /* offset */));
-    if (region == MAP_FAILED) {
-        throw BufferManagerException(
-            "Mmap for size " + std::to_string(getMaxRegionSize()) + " failed.");
+    if (reserved == MAP_FAILED) {
+        throw BufferManagerException("Mmap for size " + std::to_string(reservedSize) + " failed.");
+    }
+    region = reserved;
+    if (useHugePages) {
+        const auto address = reinterpret_cast<uintptr_t>(reserved);
+        region = reinterpret_cast<uint8_t*>(
+            (address + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE);
+        const auto headSize = region - reserved;
+        if (headSize > 0) {
+            munmap(reserved, headSize);
+        }
+        munmap(region + getMaxRegionSize(), HUGE_PAGE_SIZE - headSize);
+#ifdef MADV_HUGEPAGE
+        // Failing means transparent huge pages are unavailable; regular pages are used then.
+        madvise(region, getMaxRegionSize(), MADV_HUGEPAGE);
+#endif
     }
 #endif
 }
@@ -0,0 +1,53 @@
+#include "storage/checkpoint_lock.h"
+
+#include <thread>
+
+#include "common/constants.h"
+#include "common/exception/io.h"
+#include "common/file_system/virtual_file_system.h"
+#include "storage/storage_utils.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace storage {
+
+CheckpointLock::CheckpointLock(const std::string& databasePath, main::ClientContext& context,
+    bool exclusive) {
+    fileInfo = VirtualFileSystem::GetUnsafe(context)->openFile(
+        StorageUtils::getCheckpointLockFilePath(databasePath),
+        FileOpenFlags(FileFlags::READ_ONLY | FileFlags::WRITE | FileFlags::CREATE_IF_NOT_EXISTS),
+        &context);
+    const auto lockType = exclusive ? FileLockType::WRITE_LOCK : FileLockType::READ_LOCK;
+    uint64_t numTimesWaited = 0;
+    while (!fileInfo->tryLock(lockType)) {
+        numTimesWaited++;
+        if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
+            DEFAULT_CHECKPOINT_WAIT_TIMEOUT_IN_MICROS) {
+            throw IOException(
+                stringFormat("Timeout waiting for {} to release the checkpoint lock {}.",
+                    exclusive ? "read replicas" : "a checkpoint", fileInfo->path));
+        }
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
+    }
+}
+
+uint64_t CheckpointLock::getNumCheckpoints() const {
+    uint64_t numCheckpoints = 0;
+    if (fileInfo->getFileSize() >= sizeof(numCheckpoints)) {
+        fileInfo->readFromFile(&numCheckpoints, sizeof(numCheckpoints), 0 /* position */);
+    }
+    return numCheckpoints;
+}
+
+void CheckpointLock::incrementNumCheckpoints() {
+    const auto numCheckpoints = getNumCheckpoints() + 1;
+    // Replicas only compare the number with the one they have seen last, so it doesn't need to be
+    // durable.
+    fileInfo->writeFile(reinterpret_cast<const uint8_t*>(&numCheckpoints), sizeof(numCheckpoints),
+        0 /* offset */);
+}
+
+} // namespace storage
+} // namespace ryu
@@ -10,6 +10,7 @@
 #include "main/client_context.h"
 #include "main/db_config.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/checkpoint_lock.h"
 #include "storage/database_header.h"
 #include "storage/shadow_utils.h"
 #include "storage/storage_manager.h"
@@ -64,6 +65,9 @@ PageRange Checkpointer::serializeMetadata(const catalog::Catalog& catalog,
 
 void Checkpointer::writeCheckpoint() {
     if (isInMemory) {
+        // There is nothing to persist, but full node groups are still compressed so that
+        // in-memory databases get the memory density of on-disk ones.
+        StorageManager::Get(clientContext)->compactInMemoryNodeGroups(&clientContext);
         return;
     }
 
@@ -147,6 +151,8 @@ void Checkpointer::writeDatabaseHeader(const DatabaseHeader& header) {
 void Checkpointer::logCheckpointAndApplyShadowPages() {
     const auto storageManager = StorageManager::Get(clientContext);
     auto& shadowFile = storageManager->getShadowFile();
+    // Pages read by read replicas are about to be overwritten.
+    CheckpointLock lock{clientContext.getDatabasePath(), clientContext, true /* exclusive */};
     // Flush the shadow file.
     shadowFile.flushAll(clientContext);
     auto wal = WAL::Get(clientContext);
@@ -161,6 +167,7 @@ void Checkpointer::logCheckpointAndApplyShadowPages() {
     auto bufferManager = MemoryManager::Get(clientContext)->getBufferManager();
     wal->clear();
     shadowFile.clear(*bufferManager);
+    lock.incrementNumCheckpoints();
 }
 
 void Checkpointer::rollback() {
@@ -175,12 +182,13 @@ void Checkpointer::rollback() {
 
 bool Checkpointer::canAutoCheckpoint(const main::ClientContext& clientContext,
     const transaction::Transaction& transaction) {
-    if (clientContext.isInMemory()) {
-        return false;
-    }
     if (!clientContext.getDBConfig()->autoCheckpoint) {
         return false;
     }
+    if (clientContext.isInMemory()) {
+        return clientContext.getDBConfig()->enableCompression &&
+               StorageManager::Get(clientContext)->hasCompactableNodeGroups();
+    }
     if (transaction.isRecovery()) {
         // Recovery transactions are not allowed to trigger auto checkpoint.
         return false;
@@ -190,6 +198,17 @@ bool Checkpointer::canAutoCheckpoint(const main::ClientContext& clientContext,
     return expectedSize > clientContext.getDBConfig()->checkpointThreshold;
 }
 
+bool Checkpointer::canDeferAutoCheckpoint(const main::ClientContext& clientContext,
+    const transaction::Transaction& transaction) {
+    if (!clientContext.getDBConfig()->deferAutoCheckpoint) {
+        return false;
+    }
+    auto wal = WAL::Get(clientContext);
+    const auto expectedSize = transaction.getLocalWAL().getSize() + wal->getFileSize();
+    return expectedSize <=
+           clientContext.getDBConfig()->checkpointThreshold * MAX_DEFERRED_CHECKPOINT_FACTOR;
+}
+
 void Checkpointer::readCheckpoint() {
     auto storageManager = StorageManager::Get(clientContext);
     storageManager->initDataFileHandle(common::VirtualFileSystem::GetUnsafe(clientContext),
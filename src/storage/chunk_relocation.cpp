@@ -0,0 +1,44 @@
+#include "storage/chunk_relocation.h"
+
+#include "storage/file_handle.h"
+#include "storage/page_manager.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace storage {
+
+ChunkRelocationRollback::ChunkRelocationRollback(FileHandle* fileHandle,
+    const std::vector<ChunkRelocation>& relocations)
+    : PageAllocator{fileHandle}, tableID{INVALID_TABLE_ID}, nodeGroupIdx{INVALID_NODE_GROUP_IDX},
+      columnID{INVALID_COLUMN_ID} {
+    for (auto& relocation : relocations) {
+        oldPageRanges.emplace(chunk_key_t{relocation.tableID, relocation.nodeGroupIdx,
+                                  relocation.columnID, relocation.newPageRange.startPageIdx},
+            relocation.oldPageRange);
+    }
+}
+
+bool ChunkRelocationRollback::hasRelocations(table_id_t tableID_) const {
+    const auto it = oldPageRanges.lower_bound(chunk_key_t{tableID_, 0, 0, 0});
+    return it != oldPageRanges.end() && std::get<0>(it->first) == tableID_;
+}
+
+PageRange ChunkRelocationRollback::allocatePageRange(page_idx_t numPages) {
+    return getDataFH()->getPageManager()->allocatePageRange(numPages);
+}
+
+void ChunkRelocationRollback::reclaimChunkPages(PageRange& pageRange) {
+    const auto it =
+        oldPageRanges.find(chunk_key_t{tableID, nodeGroupIdx, columnID, pageRange.startPageIdx});
+    if (it == oldPageRanges.end()) {
+        return;
+    }
+    // The old pages are no longer freed once the page manager is rolled back.
+    getDataFH()->getPageManager()->returnFreePageRange(pageRange);
+    pageRange = it->second;
+    oldPageRanges.erase(it);
+}
+
+} // namespace storage
+} // namespace ryu
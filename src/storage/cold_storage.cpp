@@ -0,0 +1,209 @@
+#include "storage/cold_storage.h"
+
+#include <algorithm>
+
+#include "common/exception/runtime.h"
+#include "common/file_system/local_file_system.h"
+#include "common/file_system/virtual_file_system.h"
+#include "common/serializer/buffered_file.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/string_format.h"
+#include "main/client_context.h"
+#include "storage/file_handle.h"
+#include "storage/storage_utils.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace storage {
+
+ColdStorage::ColdStorage(const std::string& databasePath, VirtualFileSystem* vfs,
+    main::ClientContext* context)
+    : mapFilePath{StorageUtils::getColdStorageMapFilePath(databasePath)}, vfs{vfs},
+      database{context->getDatabase()}, numColdPages{0} {
+    if (!vfs->fileOrPathExists(mapFilePath, context)) {
+        return;
+    }
+    const auto fileInfo = vfs->openFile(mapFilePath, FileOpenFlags(FileFlags::READ_ONLY), context);
+    Deserializer deSer(std::make_unique<BufferedFileReader>(*fileInfo));
+    deSer.deserializeVector(segmentPaths);
+    deSer.deserializeUnorderedMap(coldPages);
+    segments.resize(segmentPaths.size());
+    numColdPages = coldPages.size();
+}
+
+ColdStorage::~ColdStorage() = default;
+
+bool ColdStorage::isColdPage(page_idx_t pageIdx) const {
+    if (!hasColdPages()) {
+        return false;
+    }
+    std::shared_lock lck{mtx};
+    return coldPages.contains(pageIdx);
+}
+
+bool ColdStorage::tryReadPage(uint8_t* buffer, page_idx_t pageIdx, uint64_t pageSize) {
+    if (!hasColdPages()) {
+        return false;
+    }
+    ColdPage coldPage{};
+    {
+        std::shared_lock lck{mtx};
+        const auto it = coldPages.find(pageIdx);
+        if (it == coldPages.end()) {
+            return false;
+        }
+        coldPage = it->second;
+    }
+    getSegment(coldPage.segmentIdx)
+        ->readFromFile(buffer, pageSize, coldPage.pageIdxInSegment * pageSize);
+    return true;
+}
+
+void ColdStorage::removePages(PageRange pageRange) {
+    if (!hasColdPages()) {
+        return;
+    }
+    auto isCold = [&](const std::unordered_map<page_idx_t, ColdPage>& pages) {
+        for (auto i = 0u; i < pageRange.numPages; i++) {
+            if (pages.contains(pageRange.startPageIdx + i)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    {
+        std::shared_lock lck{mtx};
+        if (!isCold(coldPages)) {
+            return;
+        }
+    }
+    std::unique_lock lck{mtx};
+    for (auto i = 0u; i < pageRange.numPages; i++) {
+        coldPages.erase(pageRange.startPageIdx + i);
+    }
+    numColdPages = coldPages.size();
+    persistNoLock();
+}
+
+void ColdStorage::removePages(std::span<const page_idx_t> pageIdxes) {
+    if (!hasColdPages()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    auto numRemovedPages = 0u;
+    for (const auto pageIdx : pageIdxes) {
+        numRemovedPages += coldPages.erase(pageIdx);
+    }
+    if (numRemovedPages > 0) {
+        numColdPages = coldPages.size();
+        persistNoLock();
+    }
+}
+
+void ColdStorage::offload(main::ClientContext& clientContext, const std::string& segmentPath,
+    std::span<const PageRange> pageRanges, FileHandle& dataFH) {
+    std::vector<page_idx_t> pageIdxes;
+    {
+        std::shared_lock lck{mtx};
+        for (const auto& pageRange : pageRanges) {
+            for (auto i = 0u; i < pageRange.numPages; i++) {
+                if (!coldPages.contains(pageRange.startPageIdx + i)) {
+                    pageIdxes.push_back(pageRange.startPageIdx + i);
+                }
+            }
+        }
+    }
+    if (pageIdxes.empty()) {
+        return;
+    }
+    std::sort(pageIdxes.begin(), pageIdxes.end());
+    pageIdxes.erase(std::unique(pageIdxes.begin(), pageIdxes.end()), pageIdxes.end());
+    // Runs of consecutive pages are copied together. The segment is written sequentially, which
+    // remote file systems require.
+    const auto pageSize = dataFH.getPageSize();
+    const auto buffer = std::make_unique<uint8_t[]>(MAX_NUM_PAGES_PER_COPY * pageSize);
+    auto forEachRun = [&](const std::function<void(uint64_t, uint64_t)>& func) {
+        for (auto i = 0u; i < pageIdxes.size();) {
+            auto numPages = 1u;
+            while (i + numPages < pageIdxes.size() && numPages < MAX_NUM_PAGES_PER_COPY &&
+                   pageIdxes[i + numPages] == pageIdxes[i] + numPages) {
+                numPages++;
+            }
+            func(i, numPages);
+            i += numPages;
+        }
+    };
+    {
+        auto segment = vfs->openFile(segmentPath,
+            FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS),
+            &clientContext);
+        forEachRun([&](uint64_t startIdx, uint64_t numPages) {
+            dataFH.getFileInfo()->readFromFile(buffer.get(), numPages * pageSize,
+                pageIdxes[startIdx] * pageSize);
+            segment->writeFile(buffer.get(), numPages * pageSize, startIdx * pageSize);
+        });
+        if (LocalFileSystem::isLocalPath(segmentPath)) {
+            segment->syncFile();
+        }
+        // Remote segments are completed once the file is closed.
+    }
+    {
+        std::unique_lock lck{mtx};
+        std::lock_guard segmentsLck{segmentsMtx};
+        const auto segmentIdx = static_cast<uint32_t>(segmentPaths.size());
+        segmentPaths.push_back(segmentPath);
+        segments.emplace_back();
+        for (auto i = 0u; i < pageIdxes.size(); i++) {
+            coldPages[pageIdxes[i]] = ColdPage{segmentIdx, static_cast<page_idx_t>(i)};
+        }
+        numColdPages = coldPages.size();
+        persistNoLock();
+    }
+    // The local pages are only released once the map pointing to their copies is persisted.
+    forEachRun([&](uint64_t startIdx, uint64_t numPages) {
+        dataFH.getFileInfo()->punchHole(pageIdxes[startIdx] * pageSize, numPages * pageSize);
+    });
+}
+
+FileInfo* ColdStorage::getSegment(uint32_t segmentIdx) {
+    std::lock_guard lck{segmentsMtx};
+    KU_ASSERT(segmentIdx < segments.size());
+    if (segments[segmentIdx] == nullptr) {
+        if (segmentContext == nullptr) {
+            segmentContext = std::make_unique<main::ClientContext>(database);
+        }
+        segments[segmentIdx] = vfs->openFile(segmentPaths[segmentIdx],
+            FileOpenFlags(FileFlags::READ_ONLY), segmentContext.get());
+    }
+    return segments[segmentIdx].get();
+}
+
+void ColdStorage::copyMapTo(const std::string& databasePath, main::ClientContext* context) const {
+    std::shared_lock lck{mtx};
+    if (coldPages.empty()) {
+        return;
+    }
+    for (const auto& segmentPath : segmentPaths) {
+        if (!vfs->fileOrPathExists(segmentPath, context)) {
+            throw RuntimeException(
+                stringFormat("Cold storage segment {} is not reachable.", segmentPath));
+        }
+    }
+    writeMapNoLock(StorageUtils::getColdStorageMapFilePath(databasePath));
+}
+
+void ColdStorage::writeMapNoLock(const std::string& path) const {
+    const auto fileInfo = vfs->openFile(path,
+        FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS));
+    const auto writer = std::make_shared<BufferedFileWriter>(*fileInfo);
+    Serializer ser(writer);
+    ser.serializeVector(segmentPaths);
+    ser.serializeUnorderedMap(coldPages);
+    writer->flush();
+    writer->sync();
+}
+
+} // namespace storage
+} // namespace ryu
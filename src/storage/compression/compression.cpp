@@ -14,6 +14,7 @@
 #include "common/type_utils.h"
 #include "common/types/ku_string.h"
 #include "common/types/types.h"
+#include "common/utils.h"
 #include "common/vector/value_vector.h"
 #include "fastpfor/bitpackinghelpers.h"
 #include "storage/compression/bitpacking_int128.h"
@@ -108,6 +109,32 @@ std::unique_ptr<ExtraMetadata> ALPMetadata::copy() {
     return std::make_unique<ALPMetadata>(*this);
 }
 
+void RLEMetadata::serialize(common::Serializer& serializer) const {
+    serializer.write(numValuesPerPage);
+}
+
+RLEMetadata RLEMetadata::deserialize(common::Deserializer& deserializer) {
+    RLEMetadata ret;
+    deserializer.deserializeValue(ret.numValuesPerPage);
+    return ret;
+}
+
+std::unique_ptr<ExtraMetadata> RLEMetadata::copy() {
+    return std::make_unique<RLEMetadata>(*this);
+}
+
+void FSSTMetadata::serialize(common::Serializer& serializer) const {
+    symbolTable.serialize(serializer);
+}
+
+FSSTMetadata FSSTMetadata::deserialize(common::Deserializer& deserializer) {
+    return FSSTMetadata(FSSTSymbolTable::deserialize(deserializer));
+}
+
+std::unique_ptr<ExtraMetadata> FSSTMetadata::copy() {
+    return std::make_unique<FSSTMetadata>(*this);
+}
+
 CompressionMetadata::CompressionMetadata(StorageValue min, StorageValue max,
     CompressionType compression, const alp::state& state, StorageValue minEncoded,
     StorageValue maxEncoded, common::PhysicalTypeID physicalType)
@@ -154,6 +181,10 @@ void CompressionMetadata::serialize(Serializer& serializer) const {
 
     if (compression == CompressionType::ALP) {
         floatMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::RLE) {
+        rleMetadata()->serialize(serializer);
+    } else if (compression == CompressionType::FSST) {
+        fsstMetadata()->serialize(serializer);
     }
 
     KU_ASSERT(children.size() == getChildCount(compression));
@@ -175,6 +206,11 @@ CompressionMetadata CompressionMetadata::deserialize(common::Deserializer& deser
     if (compressionType == CompressionType::ALP) {
         auto alpMetadata = std::make_unique<ALPMetadata>(ALPMetadata::deserialize(deserializer));
         ret.extraMetadata = std::move(alpMetadata);
+    } else if (compressionType == CompressionType::RLE) {
+        ret.extraMetadata = std::make_unique<RLEMetadata>(RLEMetadata::deserialize(deserializer));
+    } else if (compressionType == CompressionType::FSST) {
+        ret.extraMetadata =
+            std::make_unique<FSSTMetadata>(FSSTMetadata::deserialize(deserializer));
     }
 
     for (size_t i = 0; i < getChildCount(compressionType); ++i) {
@@ -192,7 +228,10 @@ bool CompressionMetadata::canAlwaysUpdateInPlace() const {
     }
     case CompressionType::CONSTANT:
     case CompressionType::ALP:
-    case CompressionType::INTEGER_BITPACKING: {
+    case CompressionType::INTEGER_BITPACKING:
+    case CompressionType::INTEGER_DELTA:
+    case CompressionType::RLE:
+    case CompressionType::FSST: {
         return false;
     }
     default: {
@@ -281,6 +320,18 @@ bool CompressionMetadata::canUpdateInPlace(const uint8_t* data, uint32_t pos, ui
                 return false;
             });
     }
+    case CompressionType::INTEGER_DELTA: {
+        // Changing any value would change the deltas of every following value in its block
+        return false;
+    }
+    case CompressionType::RLE: {
+        // Changing a value may split a run, which would change the layout of the page
+        return false;
+    }
+    case CompressionType::FSST: {
+        // Encoded lengths depend on the symbol table, and strings are only ever appended
+        return false;
+    }
     default: {
         throw common::StorageException(
             "Unknown compression type with ID " + std::to_string((uint8_t)compression));
@@ -297,7 +348,9 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
     case CompressionType::CONSTANT: {
         return std::numeric_limits<uint64_t>::max();
     }
-    case CompressionType::UNCOMPRESSED: {
+    case CompressionType::UNCOMPRESSED:
+    case CompressionType::FSST: {
+        // Codes are stored unpacked, one per byte
         return Uncompressed::numValues(pageSize, dataType);
     }
     case CompressionType::INTEGER_BITPACKING: {
@@ -330,6 +383,25 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
         }
         }
     }
+    case CompressionType::INTEGER_DELTA: {
+        switch (dataType) {
+        case PhysicalTypeID::INT64:
+            return IntegerDelta<int64_t>::numValues(pageSize, *this);
+        case PhysicalTypeID::INT32:
+            return IntegerDelta<int32_t>::numValues(pageSize, *this);
+        case PhysicalTypeID::INTERNAL_ID:
+        case PhysicalTypeID::UINT64:
+            return IntegerDelta<uint64_t>::numValues(pageSize, *this);
+        case PhysicalTypeID::UINT32:
+            return IntegerDelta<uint32_t>::numValues(pageSize, *this);
+        default: {
+            throw common::StorageException(
+                "Attempted to read from a column chunk which uses integer delta encoding but does "
+                "not have a supported integer physical type: " +
+                PhysicalTypeUtils::toString(dataType));
+        }
+        }
+    }
     case CompressionType::ALP: {
         switch (dataType) {
         case PhysicalTypeID::DOUBLE: {
@@ -347,6 +419,9 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
         }
         }
     }
+    case CompressionType::RLE: {
+        return rleMetadata()->numValuesPerPage;
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return BooleanBitpacking::numValues(pageSize);
     }
@@ -359,7 +434,8 @@ uint64_t CompressionMetadata::numValues(uint64_t pageSize, common::PhysicalTypeI
 
 size_t CompressionMetadata::getChildCount(CompressionType compressionType) {
     switch (compressionType) {
-    case CompressionType::ALP: {
+    case CompressionType::ALP:
+    case CompressionType::INTEGER_DELTA: {
         return 1;
     }
     default: {
@@ -463,6 +539,22 @@ std::string CompressionMetadata::toString(const PhysicalTypeID physicalType) con
             [](auto) -> uint8_t { KU_UNREACHABLE; });
         return stringFormat("INTEGER_BITPACKING[{}]", bitWidth);
     }
+    case CompressionType::INTEGER_DELTA: {
+        uint8_t bitWidth = TypeUtils::visit(
+            physicalType,
+            [&](common::internalID_t) {
+                return IntegerDelta<uint64_t>::getPackingInfo(*this).bitWidth;
+            },
+            [&]<IntegerDeltaType T>(T) { return IntegerDelta<T>::getPackingInfo(*this).bitWidth; },
+            [](auto) -> uint8_t { KU_UNREACHABLE; });
+        return stringFormat("INTEGER_DELTA[{}]", bitWidth);
+    }
+    case CompressionType::RLE: {
+        return stringFormat("RLE[{}]", rleMetadata()->numValuesPerPage);
+    }
+    case CompressionType::FSST: {
+        return stringFormat("FSST[{}]", fsstMetadata()->symbolTable.getNumSymbols());
+    }
     case CompressionType::BOOLEAN_BITPACKING: {
         return "BOOLEAN_BITPACKING";
     }
@@ -740,6 +832,16 @@ uint64_t IntegerBitpacking<T>::compressNextPage(const uint8_t*& srcBuffer,
         return Uncompressed(sizeof(T)).compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
             dstBufferSize, metadata);
     }
+    if (metadata.compression == CompressionType::RLE) {
+        return RunLengthEncoding<T>().compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+            dstBufferSize, metadata);
+    }
+    if constexpr (IntegerDeltaType<T>) {
+        if (metadata.compression == CompressionType::INTEGER_DELTA) {
+            return IntegerDelta<T>().compressNextPage(srcBuffer, numValuesRemaining, dstBuffer,
+                dstBufferSize, metadata);
+        }
+    }
     KU_ASSERT(metadata.compression == CompressionType::INTEGER_BITPACKING);
     auto info = getPackingInfo(metadata);
     auto bitWidth = info.bitWidth;
@@ -843,6 +945,259 @@ template class IntegerBitpacking<uint16_t>;
 template class IntegerBitpacking<uint32_t>;
 template class IntegerBitpacking<uint64_t>;
 
+template<IntegerDeltaType T>
+std::optional<CompressionMetadata> IntegerDelta<T>::getMetadata(std::span<const T> values,
+    StorageValue min, StorageValue max) {
+    if (values.size() < 2) {
+        return std::nullopt;
+    }
+    auto minDelta = std::numeric_limits<U>::max();
+    U maxDelta = 0;
+    for (auto i = 1u; i < values.size(); i++) {
+        if (values[i] < values[i - 1]) {
+            return std::nullopt;
+        }
+        const U delta = static_cast<U>(values[i]) - static_cast<U>(values[i - 1]);
+        minDelta = std::min(minDelta, delta);
+        maxDelta = std::max(maxDelta, delta);
+    }
+    auto metadata = CompressionMetadata(min, max, CompressionType::INTEGER_DELTA);
+    metadata.children.emplace_back(StorageValue(minDelta), StorageValue(maxDelta),
+        CompressionType::INTEGER_BITPACKING);
+    return metadata;
+}
+
+template<IntegerDeltaType T>
+BitpackInfo<typename IntegerDelta<T>::U> IntegerDelta<T>::getPackingInfo(
+    const CompressionMetadata& metadata) {
+    const auto& deltaMetadata = metadata.getChild(DELTA_CHILD_IDX);
+    const auto minDelta = deltaMetadata.min.get<U>();
+    const auto maxDelta = deltaMetadata.max.get<U>();
+    return BitpackInfo<U>{static_cast<uint8_t>(numeric_utils::bitWidth((U)(maxDelta - minDelta))),
+        false, minDelta};
+}
+
+template<IntegerDeltaType T>
+uint64_t IntegerDelta<T>::numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+    const auto bitWidth = getPackingInfo(metadata).bitWidth;
+    const auto numBytesPerBlock = getNumBytesPerBlock(bitWidth);
+    auto numValues = dataSize / numBytesPerBlock * BLOCK_SIZE;
+    // The last block may be partially filled
+    const auto remainingSize = dataSize % numBytesPerBlock;
+    if (bitWidth > 0 && remainingSize > sizeof(U)) {
+        numValues += std::min(BLOCK_SIZE - 1, (remainingSize - sizeof(U)) * 8 / bitWidth);
+    }
+    return numValues;
+}
+
+template<IntegerDeltaType T>
+uint64_t IntegerDelta<T>::compressNextPage(const uint8_t*& srcBuffer, uint64_t numValuesRemaining,
+    uint8_t* dstBuffer, uint64_t dstBufferSize, const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::INTEGER_DELTA);
+    const auto info = getPackingInfo(metadata);
+    const auto numBytesPerBlock = getNumBytesPerBlock(info.bitWidth);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    const auto* src = reinterpret_cast<const U*>(srcBuffer);
+    uint64_t sizeCompressed = 0;
+    U deltas[BLOCK_SIZE];
+    for (uint64_t blockStart = 0; blockStart < numValuesToCompress; blockStart += BLOCK_SIZE) {
+        const auto numValuesInBlock = std::min(BLOCK_SIZE, numValuesToCompress - blockStart);
+        auto* blockCursor = dstBuffer + blockStart / BLOCK_SIZE * numBytesPerBlock;
+        std::memcpy(blockCursor, src + blockStart, sizeof(U));
+        blockCursor += sizeof(U);
+        // The first value of the block is stored in full; its delta slot packs to 0
+        deltas[0] = 0;
+        for (auto i = 1u; i < numValuesInBlock; i++) {
+            deltas[i] = src[blockStart + i] - src[blockStart + i - 1] - info.offset;
+        }
+        if (info.bitWidth > 0) {
+            const auto lastFullChunkEnd =
+                numValuesInBlock - numValuesInBlock % IntegerBitpacking<U>::CHUNK_SIZE;
+            for (auto i = 0u; i < lastFullChunkEnd; i += IntegerBitpacking<U>::CHUNK_SIZE) {
+                fastpack(deltas + i, blockCursor + i * info.bitWidth / 8, info.bitWidth);
+            }
+            for (auto i = lastFullChunkEnd; i < numValuesInBlock; i++) {
+                BitpackingUtils<U>::packSingle(deltas[i], blockCursor, info.bitWidth, i);
+            }
+            blockCursor += ceilDiv(numValuesInBlock * info.bitWidth, uint64_t{8});
+        }
+        sizeCompressed = blockCursor - dstBuffer;
+    }
+    KU_ASSERT(sizeCompressed <= dstBufferSize);
+    srcBuffer += numValuesToCompress * sizeof(U);
+    return sizeCompressed;
+}
+
+template<IntegerDeltaType T>
+void IntegerDelta<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) const {
+    const auto info = getPackingInfo(metadata);
+    const auto numBytesPerBlock = getNumBytesPerBlock(info.bitWidth);
+    auto* dst = reinterpret_cast<U*>(dstBuffer) + dstOffset;
+    U deltas[BLOCK_SIZE];
+    const auto endOffset = srcOffset + numValues;
+    for (auto pos = srcOffset; pos < endOffset;) {
+        const auto* blockCursor = srcBuffer + pos / BLOCK_SIZE * numBytesPerBlock;
+        const auto startPosInBlock = pos % BLOCK_SIZE;
+        const auto endPosInBlock = std::min(BLOCK_SIZE, startPosInBlock + endOffset - pos);
+        U value = 0;
+        std::memcpy(&value, blockCursor, sizeof(U));
+        blockCursor += sizeof(U);
+        // Values are rebuilt from the start of the block, so only unpack the deltas we need
+        if (info.bitWidth == 0) {
+            std::fill(deltas, deltas + endPosInBlock, U{0});
+        } else {
+            const auto lastFullChunkEnd =
+                endPosInBlock - endPosInBlock % IntegerBitpacking<U>::CHUNK_SIZE;
+            for (auto i = 0u; i < lastFullChunkEnd; i += IntegerBitpacking<U>::CHUNK_SIZE) {
+                fastunpack(blockCursor + i * info.bitWidth / 8, deltas + i, info.bitWidth);
+            }
+            for (auto i = lastFullChunkEnd; i < endPosInBlock; i++) {
+                BitpackingUtils<U>::unpackSingle(blockCursor, deltas + i, info.bitWidth, i);
+            }
+        }
+        for (auto i = 1u; i <= startPosInBlock; i++) {
+            value += deltas[i] + info.offset;
+        }
+        *dst++ = value;
+        for (auto i = startPosInBlock + 1; i < endPosInBlock; i++) {
+            value += deltas[i] + info.offset;
+            *dst++ = value;
+        }
+        pos += endPosInBlock - startPosInBlock;
+    }
+}
+
+template class IntegerDelta<int32_t>;
+template class IntegerDelta<int64_t>;
+template class IntegerDelta<uint32_t>;
+template class IntegerDelta<uint64_t>;
+
+template<IntegerBitpackingType T>
+std::optional<CompressionMetadata> RunLengthEncoding<T>::getMetadata(std::span<const T> values,
+    StorageValue min, StorageValue max) {
+    std::vector<uint64_t> runStarts;
+    for (auto i = 0u; i < values.size(); i++) {
+        if (i == 0 || values[i] != values[i - 1]) {
+            runStarts.push_back(i);
+            // Runs shorter than two values on average take more space than the values
+            if (runStarts.size() > values.size() / 2) {
+                return std::nullopt;
+            }
+        }
+    }
+    if (runStarts.empty()) {
+        return std::nullopt;
+    }
+    const auto maxNumRuns = getMaxNumRunsPerPage(RYU_PAGE_SIZE);
+    // Checks that every page has no more runs than fit in a page, if each holds numValuesPerPage
+    auto fitsInPages = [&](uint64_t numValuesPerPage) {
+        uint64_t runIdx = 0;
+        for (uint64_t pageStart = 0; pageStart < values.size(); pageStart += numValuesPerPage) {
+            const auto pageEnd = std::min<uint64_t>(pageStart + numValuesPerPage, values.size());
+            while (runIdx + 1 < runStarts.size() && runStarts[runIdx + 1] <= pageStart) {
+                runIdx++;
+            }
+            auto nextRunIdx = runIdx + 1;
+            while (nextRunIdx < runStarts.size() && runStarts[nextRunIdx] < pageEnd) {
+                nextRunIdx++;
+            }
+            if (nextRunIdx - runIdx > maxNumRuns) {
+                return false;
+            }
+            runIdx = nextRunIdx - 1;
+        }
+        return true;
+    };
+    // Pages of maxNumRuns values always fit, so search for the largest page that does
+    uint64_t numValuesPerPage = std::min<uint64_t>(maxNumRuns, values.size());
+    uint64_t upperBound = std::min<uint64_t>(values.size(), std::numeric_limits<run_end_t>::max());
+    while (numValuesPerPage < upperBound) {
+        const auto mid = numValuesPerPage + (upperBound - numValuesPerPage + 1) / 2;
+        if (fitsInPages(mid)) {
+            numValuesPerPage = mid;
+        } else {
+            upperBound = mid - 1;
+        }
+    }
+    auto metadata = CompressionMetadata(min, max, CompressionType::RLE);
+    metadata.extraMetadata = std::make_unique<RLEMetadata>(numValuesPerPage);
+    return metadata;
+}
+
+template<IntegerBitpackingType T>
+uint64_t RunLengthEncoding<T>::numValues(uint64_t dataSize, const CompressionMetadata& metadata) {
+    // The number of values per page depends on the data, so it is only known for full pages
+    KU_ASSERT(dataSize == RYU_PAGE_SIZE);
+    KU_UNUSED(dataSize);
+    return metadata.rleMetadata()->numValuesPerPage;
+}
+
+template<IntegerBitpackingType T>
+uint64_t RunLengthEncoding<T>::compressNextPage(const uint8_t*& srcBuffer,
+    uint64_t numValuesRemaining, uint8_t* dstBuffer, uint64_t dstBufferSize,
+    const CompressionMetadata& metadata) const {
+    KU_ASSERT(metadata.compression == CompressionType::RLE);
+    const auto numValuesToCompress =
+        std::min(numValuesRemaining, numValues(dstBufferSize, metadata));
+    const auto* src = reinterpret_cast<const T*>(srcBuffer);
+    run_end_t numRuns = 0;
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        if (i == 0 || src[i] != src[i - 1]) {
+            numRuns++;
+        }
+    }
+    KU_ASSERT(numRuns <= getMaxNumRunsPerPage(dstBufferSize));
+    std::memcpy(dstBuffer, &numRuns, sizeof(run_end_t));
+    auto* runEndCursor = dstBuffer + sizeof(run_end_t);
+    auto* valueCursor = runEndCursor + numRuns * sizeof(run_end_t);
+    for (auto i = 0u; i < numValuesToCompress; i++) {
+        if (i + 1 == numValuesToCompress || src[i] != src[i + 1]) {
+            const auto runEnd = static_cast<run_end_t>(i + 1);
+            std::memcpy(runEndCursor, &runEnd, sizeof(run_end_t));
+            std::memcpy(valueCursor, &src[i], sizeof(T));
+            runEndCursor += sizeof(run_end_t);
+            valueCursor += sizeof(T);
+        }
+    }
+    srcBuffer += numValuesToCompress * sizeof(T);
+    return valueCursor - dstBuffer;
+}
+
+template<IntegerBitpackingType T>
+void RunLengthEncoding<T>::decompressFromPage(const uint8_t* srcBuffer, uint64_t srcOffset,
+    uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& /*metadata*/) const {
+    run_end_t numRuns = 0;
+    std::memcpy(&numRuns, srcBuffer, sizeof(run_end_t));
+    const auto* runEnds = reinterpret_cast<const run_end_t*>(srcBuffer + sizeof(run_end_t));
+    const auto* values = srcBuffer + sizeof(run_end_t) + numRuns * sizeof(run_end_t);
+    auto* dst = reinterpret_cast<T*>(dstBuffer) + dstOffset;
+    const auto endOffset = srcOffset + numValues;
+    auto runIdx = std::upper_bound(runEnds, runEnds + numRuns, srcOffset) - runEnds;
+    for (auto pos = srcOffset; pos < endOffset; runIdx++) {
+        KU_ASSERT(runIdx < numRuns);
+        const auto numValuesInRun = std::min<uint64_t>(runEnds[runIdx], endOffset) - pos;
+        T value;
+        std::memcpy(&value, values + runIdx * sizeof(T), sizeof(T));
+        std::fill(dst, dst + numValuesInRun, value);
+        dst += numValuesInRun;
+        pos += numValuesInRun;
+    }
+}
+
+template class RunLengthEncoding<int8_t>;
+template class RunLengthEncoding<int16_t>;
+template class RunLengthEncoding<int32_t>;
+template class RunLengthEncoding<int64_t>;
+template class RunLengthEncoding<int128_t>;
+template class RunLengthEncoding<uint8_t>;
+template class RunLengthEncoding<uint16_t>;
+template class RunLengthEncoding<uint32_t>;
+template class RunLengthEncoding<uint64_t>;
+
 void BooleanBitpacking::setValuesFromUncompressed(const uint8_t* srcBuffer, offset_t srcOffset,
     uint8_t* dstBuffer, offset_t dstOffset, offset_t numValues,
     const CompressionMetadata& /*metadata*/, const NullMask* /*nullMask*/) const {
@@ -879,6 +1234,53 @@ void BooleanBitpacking::copyFromPage(const uint8_t* srcBuffer, uint64_t srcOffse
         reinterpret_cast<uint64_t*>(dstBuffer), dstOffset, numValues);
 }
 
+static void decompressIntegerDelta(PhysicalTypeID physicalType, const uint8_t* frame,
+    uint64_t srcOffset, uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64: {
+        return IntegerDelta<int64_t>().decompressFromPage(frame, srcOffset, dstBuffer, dstOffset,
+            numValues, metadata);
+    }
+    case PhysicalTypeID::INT32: {
+        return IntegerDelta<int32_t>().decompressFromPage(frame, srcOffset, dstBuffer, dstOffset,
+            numValues, metadata);
+    }
+    case PhysicalTypeID::INTERNAL_ID:
+    case PhysicalTypeID::UINT64: {
+        return IntegerDelta<uint64_t>().decompressFromPage(frame, srcOffset, dstBuffer, dstOffset,
+            numValues, metadata);
+    }
+    case PhysicalTypeID::UINT32: {
+        return IntegerDelta<uint32_t>().decompressFromPage(frame, srcOffset, dstBuffer, dstOffset,
+            numValues, metadata);
+    }
+    default: {
+        throw NotImplementedException("INTEGER_DELTA is not implemented for type " +
+                                      PhysicalTypeUtils::toString(physicalType));
+    }
+    }
+}
+
+static void decompressRunLengthEncoded(PhysicalTypeID physicalType, const uint8_t* frame,
+    uint64_t srcOffset, uint8_t* dstBuffer, uint64_t dstOffset, uint64_t numValues,
+    const CompressionMetadata& metadata) {
+    TypeUtils::visit(
+        physicalType,
+        [&](internalID_t) {
+            RunLengthEncoding<uint64_t>().decompressFromPage(frame, srcOffset, dstBuffer,
+                dstOffset, numValues, metadata);
+        },
+        [&]<IntegerBitpackingType T>(T) {
+            RunLengthEncoding<T>().decompressFromPage(frame, srcOffset, dstBuffer, dstOffset,
+                numValues, metadata);
+        },
+        [&](auto) {
+            throw NotImplementedException("RLE is not implemented for type " +
+                                          PhysicalTypeUtils::toString(physicalType));
+        });
+}
+
 void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, PageCursor& pageCursor,
     common::ValueVector* resultVector, uint32_t posInVector, uint64_t numValuesToRead,
     const CompressionMetadata& metadata) {
@@ -887,6 +1289,8 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         return constant.decompressFromPage(frame, pageCursor.elemPosInPage, resultVector->getData(),
             posInVector, numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    // The codes are decoded by the dictionary which owns the string data
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -950,6 +1354,14 @@ void ReadCompressedValuesFromPageToVector::operator()(const uint8_t* frame, Page
         }
         }
     }
+    case CompressionType::INTEGER_DELTA: {
+        return decompressIntegerDelta(physicalType, frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
+    }
+    case CompressionType::RLE: {
+        return decompressRunLengthEncoded(physicalType, frame, pageCursor.elemPosInPage,
+            resultVector->getData(), posInVector, numValuesToRead, metadata);
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         return booleanBitpacking.decompressFromPage(frame, pageCursor.elemPosInPage,
             resultVector->getData(), posInVector, numValuesToRead, metadata);
@@ -966,6 +1378,8 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         return constant.copyFromPage(frame, pageCursor.elemPosInPage, result, startPosInResult,
             numValuesToRead, metadata);
     case CompressionType::UNCOMPRESSED:
+    // The codes are decoded by the dictionary which owns the string data
+    case CompressionType::FSST:
         return uncompressed.decompressFromPage(frame, pageCursor.elemPosInPage, result,
             startPosInResult, numValuesToRead, metadata);
     case CompressionType::ALP: {
@@ -1029,6 +1443,14 @@ void ReadCompressedValuesFromPage::operator()(const uint8_t* frame, PageCursor&
         }
         }
     }
+    case CompressionType::INTEGER_DELTA: {
+        return decompressIntegerDelta(physicalType, frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
+    }
+    case CompressionType::RLE: {
+        return decompressRunLengthEncoded(physicalType, frame, pageCursor.elemPosInPage, result,
+            startPosInResult, numValuesToRead, metadata);
+    }
     case CompressionType::BOOLEAN_BITPACKING:
         // Reading into ColumnChunks should be done without decompressing for booleans
         return booleanBitpacking.copyFromPage(frame, pageCursor.elemPosInPage, result,
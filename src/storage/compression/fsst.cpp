@@ -0,0 +1,196 @@
+#include "storage/compression/fsst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <unordered_map>
+
+#include "common/assert.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+
+namespace ryu {
+namespace storage {
+
+namespace {
+// Building the table is linear in the size of the sample, which is bounded to keep flushes cheap
+static constexpr uint64_t SAMPLE_SIZE = 16 * 1024;
+static constexpr uint64_t NUM_GENERATIONS = 5;
+
+struct Symbol {
+    uint64_t value;
+    uint8_t length;
+
+    bool operator==(const Symbol& other) const = default;
+};
+
+struct SymbolHash {
+    std::size_t operator()(const Symbol& symbol) const {
+        return std::hash<uint64_t>{}(symbol.value * 0x9E3779B97F4A7C15ull + symbol.length);
+    }
+};
+
+uint64_t getSymbolMask(uint64_t length) {
+    return length >= sizeof(uint64_t) ? UINT64_MAX : (uint64_t{1} << (length * 8)) - 1;
+}
+
+uint64_t loadSymbolBytes(const uint8_t* str, uint64_t length) {
+    uint64_t word = 0;
+    memcpy(&word, str, std::min(length, FSSTSymbolTable::MAX_SYMBOL_LENGTH));
+    return word;
+}
+
+std::vector<std::string_view> sampleStrings(std::span<const std::string_view> strings) {
+    uint64_t totalSize = 0;
+    for (auto& str : strings) {
+        totalSize += str.size();
+    }
+    // Take evenly spaced strings so that the sample is representative of the whole chunk
+    const uint64_t stride = std::max<uint64_t>(1, totalSize / SAMPLE_SIZE);
+    std::vector<std::string_view> sample;
+    uint64_t sampleSize = 0;
+    for (uint64_t i = 0; i < strings.size() && sampleSize < SAMPLE_SIZE; i += stride) {
+        sample.push_back(strings[i]);
+        sampleSize += strings[i].size();
+    }
+    return sample;
+}
+} // namespace
+
+FSSTSymbolTable FSSTSymbolTable::build(std::span<const std::string_view> strings) {
+    const auto sample = sampleStrings(strings);
+    FSSTSymbolTable table;
+    // Each generation encodes the sample with the current table and counts how often each symbol
+    // and each pair of adjacent symbols occurs. The symbols with the highest gain (the number of
+    // bytes they would cover) make up the next table, so symbols grow by merging across
+    // generations.
+    for (uint64_t generation = 0; generation < NUM_GENERATIONS; generation++) {
+        std::unordered_map<Symbol, uint64_t, SymbolHash> counts;
+        for (auto& str : sample) {
+            auto data = reinterpret_cast<const uint8_t*>(str.data());
+            std::optional<Symbol> previous;
+            for (uint64_t pos = 0; pos < str.size();) {
+                const auto code = table.findLongestSymbol(data + pos, str.size() - pos);
+                const Symbol current = code == ESCAPE_CODE ?
+                                           Symbol{data[pos], 1} :
+                                           Symbol{table.symbols[code], table.lengths[code]};
+                counts[current]++;
+                if (current.length > 1) {
+                    // Single bytes stay candidates so that they can replace escapes
+                    counts[Symbol{data[pos], 1}]++;
+                }
+                if (previous && previous->length + current.length <= MAX_SYMBOL_LENGTH) {
+                    counts[Symbol{previous->value | (current.value << (previous->length * 8)),
+                        static_cast<uint8_t>(previous->length + current.length)}]++;
+                }
+                previous = current;
+                pos += current.length;
+            }
+        }
+        std::vector<std::pair<uint64_t, Symbol>> candidates;
+        candidates.reserve(counts.size());
+        for (auto& [symbol, count] : counts) {
+            candidates.emplace_back(count * symbol.length, symbol);
+        }
+        const auto numSymbols = std::min<uint64_t>(MAX_NUM_SYMBOLS, candidates.size());
+        // Ties are broken on the symbol itself so that the table does not depend on the hash
+        // table's iteration order
+        std::partial_sort(candidates.begin(), candidates.begin() + numSymbols, candidates.end(),
+            [](const auto& a, const auto& b) {
+                if (a.first != b.first) {
+                    return a.first > b.first;
+                }
+                if (a.second.length != b.second.length) {
+                    return a.second.length > b.second.length;
+                }
+                return a.second.value < b.second.value;
+            });
+        table = FSSTSymbolTable();
+        for (uint64_t i = 0; i < numSymbols; i++) {
+            table.addSymbol(candidates[i].second.value, candidates[i].second.length);
+        }
+    }
+    return table;
+}
+
+void FSSTSymbolTable::addSymbol(uint64_t symbol, uint8_t length) {
+    KU_ASSERT(symbols.size() < MAX_NUM_SYMBOLS);
+    KU_ASSERT(length > 0 && length <= MAX_SYMBOL_LENGTH);
+    const auto code = static_cast<uint8_t>(symbols.size());
+    symbols.push_back(symbol);
+    lengths.push_back(length);
+    auto& codes = codesByFirstByte[symbol & 0xFF];
+    codes.insert(std::upper_bound(codes.begin(), codes.end(), code,
+                     [&](uint8_t a, uint8_t b) { return lengths[a] > lengths[b]; }),
+        code);
+}
+
+uint8_t FSSTSymbolTable::findLongestSymbol(const uint8_t* str, uint64_t length) const {
+    KU_ASSERT(length > 0);
+    const auto word = loadSymbolBytes(str, length);
+    for (const auto code : codesByFirstByte[str[0]]) {
+        if (lengths[code] <= length && (word & getSymbolMask(lengths[code])) == symbols[code]) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+void FSSTSymbolTable::encode(std::string_view str, std::vector<uint8_t>& result) const {
+    auto data = reinterpret_cast<const uint8_t*>(str.data());
+    for (uint64_t pos = 0; pos < str.size();) {
+        const auto code = findLongestSymbol(data + pos, str.size() - pos);
+        result.push_back(code);
+        if (code == ESCAPE_CODE) {
+            result.push_back(data[pos++]);
+        } else {
+            pos += lengths[code];
+        }
+    }
+}
+
+uint64_t FSSTSymbolTable::getDecodedLength(const uint8_t* codes, uint64_t numCodes) const {
+    uint64_t length = 0;
+    for (uint64_t i = 0; i < numCodes; i++) {
+        if (codes[i] == ESCAPE_CODE) {
+            length++;
+            i++;
+        } else {
+            KU_ASSERT(codes[i] < symbols.size());
+            length += lengths[codes[i]];
+        }
+    }
+    return length;
+}
+
+void FSSTSymbolTable::decode(const uint8_t* codes, uint64_t numCodes, uint8_t* dst) const {
+    for (uint64_t i = 0; i < numCodes; i++) {
+        if (codes[i] == ESCAPE_CODE) {
+            *dst++ = codes[++i];
+        } else {
+            memcpy(dst, &symbols[codes[i]], lengths[codes[i]]);
+            dst += lengths[codes[i]];
+        }
+    }
+}
+
+void FSSTSymbolTable::serialize(common::Serializer& serializer) const {
+    serializer.serializeVector(symbols);
+    serializer.serializeVector(lengths);
+}
+
+FSSTSymbolTable FSSTSymbolTable::deserialize(common::Deserializer& deserializer) {
+    std::vector<uint64_t> symbols;
+    std::vector<uint8_t> lengths;
+    deserializer.deserializeVector(symbols);
+    deserializer.deserializeVector(lengths);
+    KU_ASSERT(symbols.size() == lengths.size());
+    FSSTSymbolTable table;
+    for (uint64_t i = 0; i < symbols.size(); i++) {
+        table.addSymbol(symbols[i], lengths[i]);
+    }
+    return table;
+}
+
+} // namespace storage
+} // namespace ryu
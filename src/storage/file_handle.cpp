@@ -3,7 +3,9 @@
 #include <cmath>
 
 #include "common/file_system/virtual_file_system.h"
+#include "common/utils.h"
 #include "storage/buffer_manager/buffer_manager.h"
+#include "storage/cold_storage.h"
 
 using namespace ryu::common;
 
@@ -96,14 +98,14 @@ uint8_t* FileHandle::pinPage(page_idx_t pageIdx, PageReadPolicy readPolicy) {
 }
 
 void FileHandle::optimisticReadPage(page_idx_t pageIdx,
-    const std::function<void(uint8_t*)>& readOp) {
+    const std::function<void(uint8_t*)>& readOp, PageAccessPattern accessPattern) {
     if (isInMemoryMode()) {
         KU_ASSERT(
             PageState::getState(getPageState(pageIdx)->getStateAndVersion()) == PageState::LOCKED);
         const auto frame = bm->getFrame(*this, pageIdx);
         readOp(frame);
     } else {
-        bm->optimisticRead(*this, pageIdx, readOp);
+        bm->optimisticRead(*this, pageIdx, readOp, accessPattern);
     }
 }
 
@@ -111,6 +113,55 @@ void FileHandle::unpinPage(page_idx_t pageIdx) {
     bm->unpin(*this, pageIdx);
 }
 
+void FileHandle::prefetchPages(page_idx_t startPageIdx, page_idx_t numPages,
+    PageAccessPattern accessPattern) {
+    if (isInMemoryMode()) {
+        return;
+    }
+    bm->prefetchPages(*this, startPageIdx, numPages, accessPattern);
+}
+
+void FileHandle::prefetchPagesAsync(const PageRange& pageRange) {
+    if (isInMemoryMode() || pageRange.startPageIdx == INVALID_PAGE_IDX) {
+        return;
+    }
+    const auto endPageIdx = std::min(pageRange.startPageIdx + pageRange.numPages, getNumPages());
+    // Pages which are already in frames don't need to be read, so only the runs of evicted pages
+    // are passed on to the file system.
+    auto runStartPageIdx = pageRange.startPageIdx;
+    for (auto pageIdx = pageRange.startPageIdx; pageIdx <= endPageIdx; pageIdx++) {
+        if (pageIdx < endPageIdx &&
+            PageState::getState(pageStates[pageIdx].getStateAndVersion()) == PageState::EVICTED) {
+            continue;
+        }
+        if (pageIdx > runStartPageIdx) {
+            fileInfo->prefetch(static_cast<uint64_t>(runStartPageIdx) * getPageSize(),
+                static_cast<uint64_t>(pageIdx - runStartPageIdx) * getPageSize());
+        }
+        runStartPageIdx = pageIdx + 1;
+    }
+}
+
+std::vector<PageRange> FileHandle::getCachedPageRanges() {
+    std::vector<PageRange> pageRanges;
+    if (isInMemoryMode()) {
+        return pageRanges;
+    }
+    const auto numPagesInFile = getNumPages();
+    auto runStartPageIdx = 0u;
+    for (auto pageIdx = 0u; pageIdx <= numPagesInFile; pageIdx++) {
+        if (pageIdx < numPagesInFile &&
+            PageState::getState(pageStates[pageIdx].getStateAndVersion()) != PageState::EVICTED) {
+            continue;
+        }
+        if (pageIdx > runStartPageIdx) {
+            pageRanges.push_back({runStartPageIdx, pageIdx - runStartPageIdx});
+        }
+        runStartPageIdx = pageIdx + 1;
+    }
+    return pageRanges;
+}
+
 void FileHandle::resetToZeroPagesAndPageCapacity() {
     removePageIdxAndTruncateIfNecessary(0 /* pageIdx */);
     if (isInMemoryMode()) {
@@ -153,9 +204,16 @@ void FileHandle::flushAllDirtyPagesInFrames() {
     }
 }
 
+bool FileHandle::readPageFromColdStorage(uint8_t* frame, page_idx_t pageIdx) const {
+    return coldStorage->tryReadPage(frame, pageIdx, getPageSize());
+}
+
 void FileHandle::flushPageIfDirtyWithoutLock(page_idx_t pageIdx) {
     auto pageState = getPageState(pageIdx);
     if (!isInMemoryMode() && pageState->isDirty()) {
+        if (coldStorage != nullptr) {
+            coldStorage->removePages(PageRange(pageIdx, 1));
+        }
         fileInfo->writeFile(getFrame(pageIdx), getPageSize(), pageIdx * getPageSize());
         pageState->clearDirtyWithoutLock();
     }
@@ -169,6 +227,9 @@ void FileHandle::writePagesToFile(const uint8_t* buffer, uint64_t size, page_idx
             memcpy(frame, buffer + i, std::min(pageSize, size - i));
         }
     } else {
+        if (coldStorage != nullptr) {
+            coldStorage->removePages(PageRange(startPageIdx, ceilDiv(size, getPageSize())));
+        }
         fileInfo->writeFile(buffer, size, startPageIdx * getPageSize());
     }
 }
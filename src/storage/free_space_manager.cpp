@@ -246,6 +246,16 @@ common::row_idx_t FreeSpaceManager::getNumEntries() const {
     return numEntries;
 }
 
+common::page_idx_t FreeSpaceManager::getNumPages() const {
+    common::page_idx_t numPages = 0;
+    for (const auto& freeList : freeLists) {
+        for (const auto& entry : freeList) {
+            numPages += entry.numPages;
+        }
+    }
+    return numPages;
+}
+
 std::vector<PageRange> FreeSpaceManager::getEntries(common::row_idx_t startOffset,
     common::row_idx_t endOffset) const {
     KU_ASSERT(endOffset >= startOffset);
@@ -36,11 +36,51 @@ HashIndex<T>::HashIndex(MemoryManager& memoryManager, OverflowFileHandle* overfl
     : shadowFile{shadowFile}, headerPageIdx{0}, overflowFileHandle{overflowFileHandle},
       localStorage{std::make_unique<HashIndexLocalStorage<T>>(memoryManager, overflowFileHandle)},
       indexHeaderForReadTrx{indexHeaderForReadTrx}, indexHeaderForWriteTrx{indexHeaderForWriteTrx},
-      memoryManager{memoryManager} {
+      memoryManager{memoryManager}, hasPersistentFilter{false}, numPersistentLookups{0} {
     pSlots = diskArrays.getDiskArray<OnDiskSlotType>(indexPos);
     oSlots = diskArrays.getDiskArray<OnDiskSlotType>(NUM_HASH_INDEXES + indexPos);
 }
 
+template<typename T>
+const HashIndexFilter* HashIndex<T>::getPersistentFilter(const Transaction* transaction,
+    const HashIndexHeader& header, uint64_t numLookups) {
+    if (hasPersistentFilter.load(std::memory_order_acquire)) {
+        return persistentFilter.get();
+    }
+    // The checkpoint transaction sees the index while it is being modified
+    if (transaction->getType() == TransactionType::CHECKPOINT ||
+        (numPersistentLookups.fetch_add(numLookups, std::memory_order_relaxed) + numLookups) *
+                PERSISTENT_SLOT_CAPACITY <
+            header.numEntries) {
+        return nullptr;
+    }
+    std::unique_lock lck{persistentFilterMtx};
+    if (!hasPersistentFilter.load(std::memory_order_relaxed)) {
+        buildPersistentFilter(transaction, header);
+        hasPersistentFilter.store(true, std::memory_order_release);
+    }
+    return persistentFilter.get();
+}
+
+template<typename T>
+void HashIndex<T>::buildPersistentFilter(const Transaction* transaction,
+    const HashIndexHeader& header) {
+    // Leave room for the index to grow before the filter has to be rebuilt
+    auto filter = std::make_unique<HashIndexFilter>(header.numEntries + header.numEntries / 2);
+    const auto numPrimarySlots = pSlots->getNumElements(transaction->getType());
+    for (slot_id_t slotId = 0; slotId < numPrimarySlots; slotId++) {
+        auto iter = getSlotIterator(slotId, transaction);
+        do {
+            for (auto entryPos = 0u; entryPos < PERSISTENT_SLOT_CAPACITY; entryPos++) {
+                if (iter.slot.header.isEntryValid(entryPos)) {
+                    filter->insert(hashStored(transaction, iter.slot.entries[entryPos].key));
+                }
+            }
+        } while (nextChainedSlot(transaction, iter));
+    }
+    persistentFilter = std::move(filter);
+}
+
 template<typename T>
 void HashIndex<T>::deleteFromPersistentIndex(const Transaction* transaction, Key key,
     visible_func isVisible) {
@@ -248,6 +288,9 @@ void HashIndex<T>::sortEntries(const Transaction* transaction,
         for (auto entryPos = 0u; entryPos < numEntries; entryPos++) {
             const auto* entry = &slotToMerge.slot->entries[entryPos];
             const auto hash = hashStored(transaction, entry->key);
+            if (persistentFilter) {
+                persistentFilter->insert(hash);
+            }
             const auto primarySlot =
                 HashIndexUtils::getPrimarySlotIdForHash(indexHeaderForWriteTrx, hash);
             entries.push_back(HashIndexEntryView{primarySlot,
@@ -277,6 +320,13 @@ void HashIndex<T>::mergeBulkInserts(PageAllocator& pageAllocator, const Transact
     // TODO: one pass would also reduce locking when frames are unpinned,
     // which is useful if this can be parallelized
     reserve(pageAllocator, transaction, insertLocalStorage.size());
+    if (persistentFilter && indexHeaderForWriteTrx.numEntries + insertLocalStorage.size() >
+                                persistentFilter->getCapacity()) {
+        // The filter would fill up. It is rebuilt at the right size by later lookups.
+        persistentFilter.reset();
+        hasPersistentFilter = false;
+        numPersistentLookups = 0;
+    }
     // RUNTIME_CHECK(auto originalNumEntries = this->indexHeaderForWriteTrx.numEntries);
 
     // Storing as many slots in-memory as on-disk shouldn't be necessary (for one, it makes memory
@@ -559,6 +609,52 @@ bool PrimaryKeyIndex::lookup(const Transaction* trx, ValueVector* keyVector, uin
     return retVal;
 }
 
+void PrimaryKeyIndex::lookup(const Transaction* trx, ValueVector* keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results, visible_func isVisible) {
+    KU_ASSERT(indexInfo.keyDataTypes.size() == 1);
+    KU_ASSERT(positions.size() == results.size());
+    TypeUtils::visit(
+        indexInfo.keyDataTypes[0],
+        [&]<IndexHashable T>(T) {
+            using Key = HashIndex<HashIndexType<T>>::Key;
+            // Keys are grouped by the hash index they belong to, so that each hash index can
+            // probe its slots in order
+            std::vector<std::pair<uint64_t, idx_t>> keysByIndex;
+            keysByIndex.reserve(positions.size());
+            std::vector<Key> keys;
+            keys.reserve(positions.size());
+            for (auto i = 0u; i < positions.size(); i++) {
+                KU_ASSERT(!keyVector->isNull(positions[i]));
+                const auto& key = keyVector->getValue<T>(positions[i]);
+                if constexpr (std::same_as<T, ku_string_t>) {
+                    keys.push_back(key.getAsStringView());
+                } else {
+                    keys.push_back(key);
+                }
+                keysByIndex.emplace_back(HashIndexUtils::getHashIndexPosition(keys.back()), i);
+            }
+            std::sort(keysByIndex.begin(), keysByIndex.end());
+            std::vector<Key> indexKeys;
+            std::vector<offset_t> indexResults;
+            for (auto start = 0u; start < keysByIndex.size();) {
+                const auto indexPos = keysByIndex[start].first;
+                auto end = start;
+                indexKeys.clear();
+                while (end < keysByIndex.size() && keysByIndex[end].first == indexPos) {
+                    indexKeys.push_back(keys[keysByIndex[end++].second]);
+                }
+                indexResults.resize(indexKeys.size());
+                getTypedHashIndexByPos<HashIndexType<T>>(indexPos)->lookupInternal(trx,
+                    std::span<const Key>{indexKeys}, indexResults, isVisible);
+                for (auto i = start; i < end; i++) {
+                    results[keysByIndex[i].second] = indexResults[i - start];
+                }
+                start = end;
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 void PrimaryKeyIndex::commitInsert(Transaction* transaction, const ValueVector& nodeIDVector,
     const std::vector<ValueVector*>& indexVectors, Index::InsertState& insertState) {
     KU_ASSERT(indexVectors.size() == 1);
@@ -721,6 +817,12 @@ void PrimaryKeyIndex::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void PrimaryKeyIndex::reclaimSlotStorage(PageAllocator& pageAllocator) const {
+    for (auto& hashIndex : hashIndices) {
+        hashIndex->reclaimStorage(pageAllocator);
+    }
+}
+
 page_idx_t PrimaryKeyIndex::getDiskArrayFirstHeaderPage() const {
     const auto firstHeaderPage = getFirstHeaderPage();
     return firstHeaderPage == INVALID_PAGE_IDX ? INVALID_PAGE_IDX :
@@ -0,0 +1,13 @@
+#include "storage/index/hash_index_filter.h"
+
+#include <algorithm>
+
+namespace ryu {
+namespace storage {
+
+HashIndexFilter::HashIndexFilter(uint64_t numEntries)
+    : capacity{std::max<uint64_t>(numEntries, 64)},
+      words((capacity * NUM_BITS_PER_ENTRY + 63) / 64, 0) {}
+
+} // namespace storage
+} // namespace ryu
@@ -0,0 +1,216 @@
+#include "storage/index/property_index.h"
+
+#include <set>
+
+#include "common/type_utils.h"
+#include "storage/storage_manager.h"
+#include "storage/storage_utils.h"
+#include "storage/table/node_table.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::common;
+using namespace ryu::transaction;
+
+namespace ryu {
+namespace storage {
+
+template<typename T>
+concept PropertyIndexKey = std::integral<T> || std::is_same_v<T, ku_string_t>;
+
+class PropertyIndexEntries {
+public:
+    virtual ~PropertyIndexEntries() = default;
+
+    virtual void insert(const ValueVector& keyVector, sel_t pos, offset_t offset) = 0;
+    virtual void lookup(const Value& key, std::vector<offset_t>& result) const = 0;
+};
+
+namespace {
+
+template<PropertyIndexKey T>
+class TypedPropertyIndexEntries final : public PropertyIndexEntries {
+    using key_t = std::conditional_t<std::is_same_v<T, ku_string_t>, std::string, T>;
+
+public:
+    void insert(const ValueVector& keyVector, sel_t pos, offset_t offset) override {
+        if constexpr (std::is_same_v<T, ku_string_t>) {
+            entries.emplace(keyVector.getValue<ku_string_t>(pos).getAsString(), offset);
+        } else {
+            entries.emplace(keyVector.getValue<T>(pos), offset);
+        }
+    }
+
+    void lookup(const Value& key, std::vector<offset_t>& result) const override {
+        const auto typedKey = key.getValue<key_t>();
+        for (auto it = entries.lower_bound({typedKey, 0});
+             it != entries.end() && it->first == typedKey; ++it) {
+            result.push_back(it->second);
+        }
+    }
+
+private:
+    // Ordered by key and then by offset, so that adding the same row twice is a no-op
+    std::set<std::pair<key_t, offset_t>> entries;
+};
+
+struct CommittedRowsIndexer final : IndexScanHelper {
+    CommittedRowsIndexer(NodeTable* table, PropertyIndex* index)
+        : IndexScanHelper{table, index}, nodeIDVector{LogicalType::INTERNAL_ID()},
+          scanState{nullptr} {}
+
+    std::unique_ptr<NodeTableScanState> initScanState(const Transaction* transaction,
+        DataChunk& dataChunk) override {
+        auto state = IndexScanHelper::initScanState(transaction, dataChunk);
+        state->source = TableScanSource::COMMITTED;
+        nodeIDVector.setState(dataChunk.state);
+        scanState = state.get();
+        return state;
+    }
+
+    bool processScanOutput(main::ClientContext* /*context*/, NodeGroupScanResult scanResult,
+        const std::vector<ValueVector*>& scannedVectors) override {
+        if (scanResult == NODE_GROUP_SCAN_EMPTY_RESULT) {
+            return false;
+        }
+        const auto startOffset =
+            StorageUtils::getStartOffsetOfNodeGroup(scanState->nodeGroupIdx) + scanResult.startRow;
+        for (auto i = 0u; i < scanResult.numRows; i++) {
+            nodeIDVector.setValue(i, nodeID_t{startOffset + i, table->getTableID()});
+        }
+        Index::InsertState insertState;
+        index->commitInsert(nullptr /* transaction */, nodeIDVector, scannedVectors, insertState);
+        return true;
+    }
+
+    ValueVector nodeIDVector;
+    NodeTableScanState* scanState;
+};
+
+} // namespace
+
+PropertyIndex::PropertyIndex(IndexInfo indexInfo, NodeTable& table)
+    : Index{std::move(indexInfo), std::make_unique<IndexStorageInfo>()}, table{table},
+      built{false}, numScannedNodeGroups{0} {
+    KU_ASSERT(this->indexInfo.keyDataTypes.size() == 1);
+    TypeUtils::visit(
+        this->indexInfo.keyDataTypes[0],
+        [&]<PropertyIndexKey T>(T) { entries = std::make_unique<TypedPropertyIndexEntries<T>>(); },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+PropertyIndex::~PropertyIndex() = default;
+
+bool PropertyIndex::isIndexable(PhysicalTypeID typeID) {
+    bool result = false;
+    TypeUtils::visit(
+        typeID, [&]<PropertyIndexKey T>(T) { result = true; }, [](auto) {});
+    return result;
+}
+
+void PropertyIndex::build(main::ClientContext* context, const Transaction* transaction,
+    node_group_idx_t startNodeGroupIdx) {
+    CommittedRowsIndexer indexer{&table, this};
+    table.scanCommittedIndexColumns(context, transaction, indexer, startNodeGroupIdx);
+    std::unique_lock lck{mtx};
+    numScannedNodeGroups = std::max(numScannedNodeGroups, table.getNumCommittedNodeGroups());
+    if (startNodeGroupIdx == 0) {
+        built = true;
+    }
+}
+
+void PropertyIndex::buildIfNeeded(main::ClientContext* context) {
+    if (built) {
+        return;
+    }
+    std::unique_lock lck{buildMtx};
+    if (!built) {
+        // Updates of the property build the index first, so the latest committed values are still
+        // those the table was opened with, and no transaction can see any other value.
+        build(context, &DUMMY_CHECKPOINT_TRANSACTION);
+    }
+}
+
+std::vector<offset_t> PropertyIndex::lookup(main::ClientContext* context, const Value& key) {
+    std::vector<offset_t> result;
+    if (key.isNull()) {
+        return result;
+    }
+    buildIfNeeded(context);
+    std::unique_lock lck{mtx};
+    entries->lookup(key, result);
+    return result;
+}
+
+std::unique_ptr<Index::InsertState> PropertyIndex::initInsertState(main::ClientContext*,
+    visible_func) {
+    return std::make_unique<InsertState>();
+}
+
+std::unique_ptr<Index::UpdateState> PropertyIndex::initUpdateState(main::ClientContext* context,
+    column_id_t, visible_func) {
+    // The values being overwritten have to be indexed before they are gone from the table.
+    buildIfNeeded(context);
+    return std::make_unique<UpdateState>();
+}
+
+void PropertyIndex::update(Transaction* transaction, const ValueVector& nodeIDVector,
+    ValueVector& propertyVector, UpdateState&) {
+    const auto pos = nodeIDVector.state->getSelVector()[0];
+    const auto propertyPos = propertyVector.state->getSelVector()[0];
+    if (propertyVector.isNull(propertyPos)) {
+        return;
+    }
+    const auto nodeOffset = nodeIDVector.readNodeOffset(pos);
+    // Rows in local storage are added once they are committed
+    if (transaction->isUnCommitted(indexInfo.tableID, nodeOffset)) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    entries->insert(propertyVector, propertyPos, nodeOffset);
+}
+
+std::unique_ptr<Index::DeleteState> PropertyIndex::initDeleteState(const Transaction*,
+    MemoryManager*, visible_func) {
+    return std::make_unique<DeleteState>();
+}
+
+void PropertyIndex::delete_(Transaction*, const ValueVector&, DeleteState&) {
+    // DO NOTHING. Older transactions may still see the deleted row.
+}
+
+void PropertyIndex::commitInsert(Transaction*, const ValueVector& nodeIDVector,
+    const std::vector<ValueVector*>& indexVectors, InsertState&) {
+    KU_ASSERT(indexVectors.size() == 1);
+    auto& keyVector = *indexVectors[0];
+    auto& selVector = keyVector.state->getSelVector();
+    std::unique_lock lck{mtx};
+    for (auto i = 0u; i < selVector.getSelSize(); i++) {
+        const auto pos = selVector[i];
+        if (!keyVector.isNull(pos)) {
+            entries->insert(keyVector, pos, nodeIDVector.readNodeOffset(pos));
+        }
+    }
+}
+
+void PropertyIndex::finalize(main::ClientContext* context) {
+    // The copied rows are indexed with the rest of the table once the index is built.
+    if (!built) {
+        return;
+    }
+    node_group_idx_t startNodeGroupIdx = 0;
+    {
+        std::unique_lock lck{mtx};
+        startNodeGroupIdx = numScannedNodeGroups == 0 ? 0 : numScannedNodeGroups - 1;
+    }
+    build(context, Transaction::Get(*context), startNodeGroupIdx);
+}
+
+std::unique_ptr<Index> PropertyIndex::load(main::ClientContext*, StorageManager* storageManager,
+    IndexInfo indexInfo, std::span<uint8_t>) {
+    auto& table = storageManager->getTable(indexInfo.tableID)->cast<NodeTable>();
+    // The index is built on first use, so that opening the database doesn't scan the table.
+    return std::make_unique<PropertyIndex>(std::move(indexInfo), table);
+}
+
+} // namespace storage
+} // namespace ryu
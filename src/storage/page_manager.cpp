@@ -21,6 +21,25 @@ PageRange PageManager::allocatePageRange(common::page_idx_t numPages) {
     return PageRange(startPageIdx, numPages);
 }
 
+std::optional<PageRange> PageManager::allocateFreePageRange(common::page_idx_t numPages) {
+    if constexpr (ENABLE_FSM) {
+        common::UniqLock lck{mtx};
+        auto allocatedFreeChunk = freeSpaceManager->popFreePages(numPages);
+        if (allocatedFreeChunk.has_value()) {
+            ++version;
+        }
+        return allocatedFreeChunk;
+    }
+    return std::nullopt;
+}
+
+void PageManager::returnFreePageRange(PageRange entry) {
+    if constexpr (ENABLE_FSM) {
+        common::UniqLock lck{mtx};
+        freeSpaceManager->addFreePages(entry);
+    }
+}
+
 void PageManager::freePageRange(PageRange entry) {
     if constexpr (ENABLE_FSM) {
         common::UniqLock lck{mtx};
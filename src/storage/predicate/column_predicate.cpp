@@ -2,8 +2,10 @@
 
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/scalar_function_expression.h"
+#include "function/string/vector_string_functions.h"
 #include "storage/predicate/constant_predicate.h"
 #include "storage/predicate/null_predicate.h"
+#include "storage/predicate/string_prefix_predicate.h"
 
 using namespace ryu::binder;
 using namespace ryu::common;
@@ -58,6 +60,14 @@ static bool columnMatchesExprChild(const Expression& column, const Expression& e
     return (expr.getNumChildren() > 0 && column == *expr.getChild(0));
 }
 
+// String statistics are prefix bounds of the stored strings, so they can't be compared with a cast
+// column (whose statistics are those of the uncast values)
+static bool canCompareWithStats(const Expression& columnRef, const Value& value) {
+    return value.getDataType().getPhysicalType() != PhysicalTypeID::STRING ||
+           (isColumnRef(columnRef.expressionType) &&
+               columnRef.getDataType().getPhysicalType() == PhysicalTypeID::STRING);
+}
+
 static std::unique_ptr<ColumnPredicate> tryConvertToConstColumnPredicate(const Expression& column,
     const Expression& predicate) {
     if (isColumnRefConstantPair(*predicate.getChild(0), *predicate.getChild(1))) {
@@ -66,6 +76,9 @@ static std::unique_ptr<ColumnPredicate> tryConvertToConstColumnPredicate(const E
             return nullptr;
         }
         auto value = predicate.getChild(1)->constCast<LiteralExpression>().getValue();
+        if (!canCompareWithStats(*predicate.getChild(0), value)) {
+            return nullptr;
+        }
         return std::make_unique<ColumnConstantPredicate>(column.toString(),
             predicate.expressionType, value);
     } else if (isColumnRefConstantPair(*predicate.getChild(1), *predicate.getChild(0))) {
@@ -74,6 +87,9 @@ static std::unique_ptr<ColumnPredicate> tryConvertToConstColumnPredicate(const E
             return nullptr;
         }
         auto value = predicate.getChild(0)->constCast<LiteralExpression>().getValue();
+        if (!canCompareWithStats(*predicate.getChild(1), value)) {
+            return nullptr;
+        }
         auto expressionType =
             ExpressionTypeUtil::reverseComparisonDirection(predicate.expressionType);
         return std::make_unique<ColumnConstantPredicate>(column.toString(), expressionType, value);
@@ -100,8 +116,30 @@ static std::unique_ptr<ColumnPredicate> tryConvertToIsNotNull(const Expression&
     return nullptr;
 }
 
-std::unique_ptr<ColumnPredicate> ColumnPredicateUtil::tryConvert(const Expression& property,
+static std::unique_ptr<ColumnPredicate> tryConvertToStringPrefix(const Expression& column,
     const Expression& predicate) {
+    if (predicate.constCast<ScalarFunctionExpression>().getFunction().name !=
+        function::StartsWithFunction::name) {
+        return nullptr;
+    }
+    KU_ASSERT(predicate.getNumChildren() == 2);
+    const auto& columnRef = *predicate.getChild(0);
+    const auto& prefix = *predicate.getChild(1);
+    if (!isColumnRef(columnRef.expressionType) || column != columnRef ||
+        columnRef.getDataType().getPhysicalType() != PhysicalTypeID::STRING ||
+        prefix.expressionType != ExpressionType::LITERAL) {
+        return nullptr;
+    }
+    const auto& value = prefix.constCast<LiteralExpression>().getValue();
+    if (value.isNull() || value.getDataType().getLogicalTypeID() != LogicalTypeID::STRING) {
+        return nullptr;
+    }
+    return std::make_unique<ColumnStringPrefixPredicate>(column.toString(),
+        value.getValue<std::string>());
+}
+
+std::unique_ptr<ColumnPredicate> ColumnPredicateUtil::tryConvert(const Expression& property,
+    const Expression& predicate, bool allowStringPrefix) {
     if (ExpressionTypeUtil::isComparison(predicate.expressionType)) {
         return tryConvertToConstColumnPredicate(property, predicate);
     }
@@ -110,6 +148,8 @@ std::unique_ptr<ColumnPredicate> ColumnPredicateUtil::tryConvert(const Expressio
         return tryConvertToIsNull(property, predicate);
     case common::ExpressionType::IS_NOT_NULL:
         return tryConvertToIsNotNull(property, predicate);
+    case common::ExpressionType::FUNCTION:
+        return allowStringPrefix ? tryConvertToStringPrefix(property, predicate) : nullptr;
     default:
         return nullptr;
     }
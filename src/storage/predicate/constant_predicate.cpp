@@ -65,9 +65,53 @@ ZoneMapCheckResult checkZoneMapSwitch(const MergedColumnChunkStats& mergedStats,
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+// String stats only bound the prefixes of the strings. Any string which satisfies the predicate
+// has a prefix which is on the same side of (or equal to) the constant's prefix, so the chunk can
+// only be skipped if the constant's prefix is strictly outside the range.
+static ZoneMapCheckResult checkStringZoneMap(const MergedColumnChunkStats& mergedStats,
+    ExpressionType expressionType, const Value& value) {
+    if (!mergedStats.stats.min.has_value() || !mergedStats.stats.max.has_value()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    auto min = mergedStats.stats.min->get<uint64_t>();
+    auto max = mergedStats.stats.max->get<uint64_t>();
+    auto constant = StringPrefixStats::getPrefix(value.getValue<std::string>());
+    switch (expressionType) {
+    case ExpressionType::EQUALS: {
+        if (constant < min || constant > max) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    } break;
+    case ExpressionType::GREATER_THAN:
+    case ExpressionType::GREATER_THAN_EQUALS: {
+        if (constant > max) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    } break;
+    case ExpressionType::LESS_THAN:
+    case ExpressionType::LESS_THAN_EQUALS: {
+        if (constant < min) {
+            return ZoneMapCheckResult::SKIP_SCAN;
+        }
+    } break;
+    default:
+        // Strings with the same prefix may still differ, so NOT_EQUALS can never skip
+        break;
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
 ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(
     const MergedColumnChunkStats& stats) const {
+    return checkZoneMap(stats, expressionType, value);
+}
+
+ZoneMapCheckResult ColumnConstantPredicate::checkZoneMap(const MergedColumnChunkStats& stats,
+    ExpressionType expressionType, const Value& value) {
     auto physicalType = value.getDataType().getPhysicalType();
+    if (physicalType == PhysicalTypeID::STRING) {
+        return checkStringZoneMap(stats, expressionType, value);
+    }
     return TypeUtils::visit(
         physicalType,
         [&]<StorageValueType T>(T) { return checkZoneMapSwitch<T>(stats, expressionType, value); },
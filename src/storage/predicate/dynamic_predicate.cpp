@@ -0,0 +1,58 @@
+#include "storage/predicate/dynamic_predicate.h"
+
+#include "common/type_utils.h"
+#include "storage/predicate/constant_predicate.h"
+#include "storage/table/column_chunk_stats.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace storage {
+
+DynamicBound::DynamicBound(ExpressionType expressionType) : expressionType{expressionType} {
+    KU_ASSERT(expressionType == ExpressionType::LESS_THAN_EQUALS ||
+              expressionType == ExpressionType::GREATER_THAN_EQUALS);
+}
+
+void DynamicBound::tighten(const Value& newValue) {
+    if (newValue.isNull()) {
+        return;
+    }
+    std::unique_lock lck{mtx};
+    if (value != nullptr) {
+        auto isTighter = TypeUtils::visit(
+            newValue.getDataType().getPhysicalType(),
+            [&]<NumericTypes T>(T) {
+                return !satisfies(expressionType, value->getValue<T>(), newValue.getValue<T>());
+            },
+            [](auto) { return false; });
+        if (!isTighter) {
+            return;
+        }
+    }
+    value = std::make_shared<const Value>(newValue);
+}
+
+std::shared_ptr<const Value> DynamicBound::getValue() const {
+    std::unique_lock lck{mtx};
+    return value;
+}
+
+ZoneMapCheckResult ColumnDynamicPredicate::checkZoneMap(const MergedColumnChunkStats& stats) const {
+    // Nulls satisfy the bound, so only chunks without nulls can be skipped.
+    if (!stats.guaranteedNoNulls) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    auto value = bound->getValue();
+    if (value == nullptr) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    return ColumnConstantPredicate::checkZoneMap(stats, expressionType, *value);
+}
+
+std::string ColumnDynamicPredicate::toString() {
+    return stringFormat("{} dynamic bound", ColumnPredicate::toString());
+}
+
+} // namespace storage
+} // namespace ryu
@@ -0,0 +1,38 @@
+#include "storage/predicate/string_prefix_predicate.h"
+
+#include "common/string_format.h"
+#include "storage/table/column_chunk_stats.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace storage {
+
+ZoneMapCheckResult ColumnStringPrefixPredicate::checkZoneMap(
+    const MergedColumnChunkStats& stats) const {
+    if (!stats.stats.min.has_value() || !stats.stats.max.has_value()) {
+        return ZoneMapCheckResult::ALWAYS_SCAN;
+    }
+    // Every string starting with the prefix has a packed prefix within this range, so the chunk
+    // can be skipped if the range doesn't overlap with the chunk's
+    const auto [rangeMin, rangeMax] = StringPrefixStats::getPrefixRange(prefix);
+    if (rangeMax < stats.stats.min->get<uint64_t>() ||
+        rangeMin > stats.stats.max->get<uint64_t>()) {
+        return ZoneMapCheckResult::SKIP_SCAN;
+    }
+    return ZoneMapCheckResult::ALWAYS_SCAN;
+}
+
+std::string ColumnStringPrefixPredicate::toString() {
+    std::string escapedPrefix;
+    for (const auto c : prefix) {
+        if (c == '\'' || c == '\\') {
+            escapedPrefix += '\\';
+        }
+        escapedPrefix += c;
+    }
+    return stringFormat("{} STARTS WITH '{}'", columnName, escapedPrefix);
+}
+
+} // namespace storage
+} // namespace ryu
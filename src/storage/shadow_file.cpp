@@ -1,5 +1,8 @@
 #include "storage/shadow_file.h"
 
+#include <algorithm>
+#include <future>
+
 #include "common/exception/io.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/buffered_file.h"
@@ -9,6 +12,8 @@
 #include "main/db_config.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/checkpoint_lock.h"
+#include "storage/cold_storage.h"
 #include "storage/database_header.h"
 #include "storage/file_db_id_utils.h"
 #include "storage/file_handle.h"
@@ -40,7 +45,8 @@ ShadowFile::ShadowFile(BufferManager& bm, VirtualFileSystem* vfs, const std::str
 }
 
 void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         shadowPagesMap.at(originalFile).erase(originalPage);
         if (shadowPagesMap.at(originalFile).empty()) {
             shadowPagesMap.erase(originalFile);
@@ -49,7 +55,9 @@ void ShadowFile::clearShadowPage(file_idx_t originalFile, page_idx_t originalPag
 }
 
 page_idx_t ShadowFile::getOrCreateShadowPage(file_idx_t originalFile, page_idx_t originalPage) {
-    if (hasShadowPage(originalFile, originalPage)) {
+    // The i-th record belongs to the (i+1)-th shadow page, so both are added under the same lock.
+    std::unique_lock lck{mtx};
+    if (hasShadowPageNoLock(originalFile, originalPage)) {
         return shadowPagesMap[originalFile][originalPage];
     }
     const auto shadowPageIdx = getOrCreateShadowingFH()->addNewPage();
@@ -59,23 +67,60 @@ page_idx_t ShadowFile::getOrCreateShadowPage(file_idx_t originalFile, page_idx_t
 }
 
 page_idx_t ShadowFile::getShadowPage(file_idx_t originalFile, page_idx_t originalPage) const {
-    KU_ASSERT(hasShadowPage(originalFile, originalPage));
+    std::unique_lock lck{mtx};
+    KU_ASSERT(hasShadowPageNoLock(originalFile, originalPage));
     return shadowPagesMap.at(originalFile).at(originalPage);
 }
 
 void ShadowFile::applyShadowPages(ClientContext& context) const {
-    const auto pageBuffer = std::make_unique<uint8_t[]>(RYU_PAGE_SIZE);
-    page_idx_t shadowPageIdx = 1; // Skip header page.
-    auto dataFileInfo = StorageManager::Get(context)->getDataFH()->getFileInfo();
+    auto dataFH = StorageManager::Get(context)->getDataFH();
+    auto dataFileInfo = dataFH->getFileInfo();
+    auto bufferManager = MemoryManager::Get(context)->getBufferManager();
     KU_ASSERT(shadowingFH);
-    for (const auto& record : shadowPageRecords) {
-        shadowingFH->readPageFromDisk(pageBuffer.get(), shadowPageIdx++);
-        dataFileInfo->writeFile(pageBuffer.get(), RYU_PAGE_SIZE,
-            record.originalPageIdx * RYU_PAGE_SIZE);
-        // NOTE: We're not taking lock here, as we assume this is only called with a single thread.
-        MemoryManager::Get(context)->getBufferManager()->updateFrameIfPageIsInFrameWithoutLock(
-            record.originalFileIdx, pageBuffer.get(), record.originalPageIdx);
+    if (const auto coldStorage = dataFH->getColdStorage()) {
+        // Overwritten pages are read from the local file again.
+        std::vector<page_idx_t> originalPageIdxes;
+        for (const auto& record : shadowPageRecords) {
+            originalPageIdxes.push_back(record.originalPageIdx);
+        }
+        coldStorage->removePages(originalPageIdxes);
     }
+    // Every record targets a distinct page, so ranges of records are applied by separate threads
+    // with positional reads and writes.
+    auto applyRecords = [&](uint64_t startIdx, uint64_t endIdx) {
+        const auto pageBuffer = std::make_unique<uint8_t[]>(RYU_PAGE_SIZE);
+        for (auto i = startIdx; i < endIdx; i++) {
+            const auto& record = shadowPageRecords[i];
+            shadowingFH->readPageFromDisk(pageBuffer.get(), i + 1 /* Skip header page. */);
+            dataFileInfo->writeFile(pageBuffer.get(), RYU_PAGE_SIZE,
+                record.originalPageIdx * RYU_PAGE_SIZE);
+            // NOTE: No other thread accesses the buffer manager while shadow pages are applied.
+            bufferManager->updateFrameIfPageIsInFrameWithoutLock(record.originalFileIdx,
+                pageBuffer.get(), record.originalPageIdx);
+        }
+    };
+    const auto numRecords = shadowPageRecords.size();
+#ifndef __SINGLE_THREADED__
+    const auto numThreads = std::clamp<uint64_t>(numRecords / MIN_NUM_RECORDS_PER_THREAD, 1,
+        context.getMaxNumThreadForExec());
+    const auto numRecordsPerThread = (numRecords + numThreads - 1) / numThreads;
+    std::vector<std::future<void>> futures;
+    for (auto i = 1u; i < numThreads; i++) {
+        const auto startIdx = std::min(i * numRecordsPerThread, numRecords);
+        const auto endIdx = std::min(startIdx + numRecordsPerThread, numRecords);
+        futures.push_back(std::async(std::launch::async, applyRecords, startIdx, endIdx));
+    }
+    applyRecords(0, std::min(numRecordsPerThread, numRecords));
+    // All threads are done before the first failure is rethrown.
+    for (auto& future : futures) {
+        future.wait();
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+#else
+    applyRecords(0, numRecords);
+#endif
     dataFileInfo->syncFile();
 }
 
@@ -93,6 +138,7 @@ void ShadowFile::replayShadowPageRecords(ClientContext& context) {
         throw RuntimeException("Couldn't replay shadow pages under read-only mode. Please re-open "
                                "the database with read-write mode to replay shadow pages.");
     }
+    CheckpointLock lock{context.getDatabasePath(), context, true /* exclusive */};
     auto vfs = VirtualFileSystem::GetUnsafe(context);
     auto shadowFilePath = StorageUtils::getShadowFilePath(context.getDatabasePath());
     auto shadowFileInfo = vfs->openFile(shadowFilePath, FileOpenFlags(FileFlags::READ_ONLY));
@@ -126,6 +172,11 @@ void ShadowFile::replayShadowPageRecords(ClientContext& context) {
     reader->resetReadOffset((header.numShadowPages + 1) * RYU_PAGE_SIZE);
     Deserializer deSer(std::move(reader));
     deSer.deserializeVector(shadowPageRecords);
+    std::vector<page_idx_t> originalPageIdxes;
+    for (const auto& record : shadowPageRecords) {
+        originalPageIdxes.push_back(record.originalPageIdx);
+    }
+    ColdStorage(context.getDatabasePath(), vfs, &context).removePages(originalPageIdxes);
 
     const auto pageBuffer = std::make_unique<uint8_t[]>(RYU_PAGE_SIZE);
     page_idx_t shadowPageIdx = 1;
@@ -136,6 +187,7 @@ void ShadowFile::replayShadowPageRecords(ClientContext& context) {
             record.originalPageIdx * RYU_PAGE_SIZE);
         shadowPageIdx++;
     }
+    lock.incrementNumCheckpoints();
 }
 
 void ShadowFile::flushAll(main::ClientContext& context) const {
@@ -1,5 +1,6 @@
 #include "storage/stats/column_stats.h"
 
+#include "common/type_utils.h"
 #include "function/hash/vector_hash_functions.h"
 
 namespace ryu {
@@ -9,6 +10,9 @@ ColumnStats::ColumnStats(const common::LogicalType& dataType) : hashes{nullptr}
     if (!common::LogicalTypeUtils::isNested(dataType)) {
         hll.emplace();
     }
+    if (ValueSample::isSampled(dataType)) {
+        sample.emplace();
+    }
 }
 
 void ColumnStats::update(const common::ValueVector* vector) {
@@ -26,6 +30,40 @@ void ColumnStats::update(const common::ValueVector* vector) {
         hashes->state = nullptr;
         hashes->setAllNonNull();
     }
+    if (sample) {
+        common::TypeUtils::visit(vector->dataType, [&]<typename T>(T) {
+            const auto& selVector = vector->state->getSelVector();
+            for (auto i = 0u; i < selVector.getSelSize(); i++) {
+                const auto pos = selVector[i];
+                if (vector->isNull(pos)) {
+                    continue;
+                }
+                if constexpr (std::is_same_v<T, common::date_t>) {
+                    sample->insert(vector->getValue<T>(pos).days);
+                } else if constexpr (std::is_same_v<T, common::timestamp_t>) {
+                    sample->insert(vector->getValue<T>(pos).value);
+                } else if constexpr (std::is_arithmetic_v<T>) {
+                    sample->insert(static_cast<double>(vector->getValue<T>(pos)));
+                } else {
+                    KU_UNREACHABLE;
+                }
+            }
+        });
+    }
+}
+
+void ColumnStats::extrapolate(double scale, common::row_idx_t numSampledRows) {
+    static constexpr double KEY_DISTINCT_RATIO = 0.9;
+    const auto numSampledValues = sample ? sample->getNumValues() : numSampledRows;
+    if (hll) {
+        const auto numDistinct = hll->count();
+        if (numDistinct >= KEY_DISTINCT_RATIO * numSampledValues) {
+            numDistinctValuesEstimate = static_cast<common::cardinality_t>(numDistinct * scale);
+        }
+    }
+    if (sample) {
+        sample->scaleNumValues(scale);
+    }
 }
 
 } // namespace storage
@@ -0,0 +1,174 @@
+#include "storage/stats/value_sample.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "function/hash/hash_functions.h"
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace storage {
+
+double EquiDepthHistogram::estimateEqualsSelectivity(double value,
+    cardinality_t numDistinctValues) const {
+    for (const auto& mcv : mostCommonValues) {
+        if (mcv.value == value) {
+            return mcv.frequency;
+        }
+    }
+    // Values missing from the sample share the remaining fraction evenly. The sample can miss rare
+    // values, so never estimate zero.
+    const auto remaining = std::max(remainingFraction, 1.0 / ValueSample::CAPACITY);
+    const auto numRemainingDistinctValues =
+        numDistinctValues > mostCommonValues.size() ?
+            numDistinctValues - mostCommonValues.size() :
+            1;
+    return remaining / static_cast<double>(numRemainingDistinctValues);
+}
+
+double EquiDepthHistogram::estimateLessThanSelectivity(double value, bool inclusive) const {
+    double selectivity = 0;
+    for (const auto& mcv : mostCommonValues) {
+        if (mcv.value < value || (inclusive && mcv.value == value)) {
+            selectivity += mcv.frequency;
+        }
+    }
+    if (bounds.size() < 2) {
+        return selectivity;
+    }
+    const auto numBuckets = bounds.size() - 1;
+    double numBucketsBelow = 0;
+    for (auto i = 0u; i < numBuckets; i++) {
+        const auto low = bounds[i];
+        const auto high = bounds[i + 1];
+        if (value > high || (inclusive && value == high)) {
+            numBucketsBelow += 1;
+        } else if (value > low && high > low) {
+            // Assume values are uniformly distributed within a bucket.
+            numBucketsBelow += (value - low) / (high - low);
+        }
+    }
+    return selectivity + remainingFraction * numBucketsBelow / static_cast<double>(numBuckets);
+}
+
+bool ValueSample::isSampled(const LogicalType& dataType) {
+    switch (dataType.getLogicalTypeID()) {
+    case LogicalTypeID::INT8:
+    case LogicalTypeID::INT16:
+    case LogicalTypeID::INT32:
+    case LogicalTypeID::INT64:
+    case LogicalTypeID::UINT8:
+    case LogicalTypeID::UINT16:
+    case LogicalTypeID::UINT32:
+    case LogicalTypeID::UINT64:
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::FLOAT:
+    case LogicalTypeID::DOUBLE:
+    case LogicalTypeID::DATE:
+    case LogicalTypeID::TIMESTAMP:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ValueSample::insert(double value) {
+    const auto priority = function::murmurhash64(std::bit_cast<uint64_t>(value)) ^
+                          function::murmurhash64(numValues);
+    numValues++;
+    insert(Entry{priority, value});
+}
+
+void ValueSample::insert(Entry entry) {
+    static constexpr auto compare = [](const Entry& a, const Entry& b) {
+        return a.priority < b.priority;
+    };
+    if (entries.size() < CAPACITY) {
+        entries.push_back(entry);
+        std::push_heap(entries.begin(), entries.end(), compare);
+    } else if (entry.priority < entries.front().priority) {
+        std::pop_heap(entries.begin(), entries.end(), compare);
+        entries.back() = entry;
+        std::push_heap(entries.begin(), entries.end(), compare);
+    }
+}
+
+void ValueSample::merge(const ValueSample& other) {
+    numValues += other.numValues;
+    for (const auto& entry : other.entries) {
+        insert(entry);
+    }
+}
+
+EquiDepthHistogram ValueSample::getHistogram() const {
+    EquiDepthHistogram histogram;
+    if (entries.empty()) {
+        return histogram;
+    }
+    std::vector<double> values;
+    values.reserve(entries.size());
+    for (const auto& entry : entries) {
+        values.push_back(entry.value);
+    }
+    std::sort(values.begin(), values.end());
+    // Values sampled more than once are most common values.
+    std::vector<std::pair<double, uint64_t>> repeatedValues;
+    for (auto i = 0u; i < values.size();) {
+        auto j = i + 1;
+        while (j < values.size() && values[j] == values[i]) {
+            j++;
+        }
+        if (j - i > 1) {
+            repeatedValues.emplace_back(values[i], j - i);
+        }
+        i = j;
+    }
+    std::stable_sort(repeatedValues.begin(), repeatedValues.end(),
+        [](const auto& a, const auto& b) { return a.second > b.second; });
+    if (repeatedValues.size() > MAX_NUM_MOST_COMMON_VALUES) {
+        repeatedValues.resize(MAX_NUM_MOST_COMMON_VALUES);
+    }
+    const auto sampleSize = static_cast<double>(values.size());
+    std::vector<double> remainingValues;
+    for (const auto value : values) {
+        if (std::none_of(repeatedValues.begin(), repeatedValues.end(),
+                [&](const auto& repeated) { return repeated.first == value; })) {
+            remainingValues.push_back(value);
+        }
+    }
+    for (const auto& [value, count] : repeatedValues) {
+        histogram.mostCommonValues.push_back({value, static_cast<double>(count) / sampleSize});
+    }
+    histogram.remainingFraction = static_cast<double>(remainingValues.size()) / sampleSize;
+    if (!remainingValues.empty()) {
+        const auto numBuckets = std::min<uint64_t>(NUM_HISTOGRAM_BUCKETS, remainingValues.size());
+        for (auto i = 0u; i < numBuckets; i++) {
+            histogram.bounds.push_back(remainingValues[i * remainingValues.size() / numBuckets]);
+        }
+        histogram.bounds.push_back(remainingValues.back());
+    }
+    return histogram;
+}
+
+void ValueSample::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("num_values");
+    serializer.serializeValue(numValues);
+    serializer.writeDebuggingInfo("entries");
+    serializer.serializeVector(entries);
+}
+
+ValueSample ValueSample::deserialize(Deserializer& deserializer) {
+    ValueSample sample;
+    std::string info;
+    deserializer.validateDebuggingInfo(info, "num_values");
+    deserializer.deserializeValue(sample.numValues);
+    deserializer.validateDebuggingInfo(info, "entries");
+    deserializer.deserializeVector(sample.entries);
+    return sample;
+}
+
+} // namespace storage
+} // namespace ryu
@@ -4,14 +4,24 @@
 #include "catalog/catalog_entry/rel_group_catalog_entry.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/random_engine.h"
+#include "common/types/uuid.h"
+#include "common/utils.h"
+#include "common/serializer/buffer_writer.h"
+#include "common/serializer/buffered_file.h"
+#include "common/serializer/deserializer.h"
 #include "common/serializer/in_mem_file_writer.h"
+#include "extension/extension_manager.h"
 #include "main/attached_database.h"
 #include "main/client_context.h"
 #include "main/database.h"
 #include "main/db_config.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/checkpoint_lock.h"
 #include "storage/checkpointer.h"
+#include "storage/chunk_relocation.h"
+#include "storage/cold_storage.h"
+#include "storage/index/property_index.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
 #include "storage/wal/wal_replayer.h"
@@ -26,16 +36,22 @@ namespace storage {
 
 StorageManager::StorageManager(const std::string& databasePath, bool readOnly, bool enableChecksums,
     MemoryManager& memoryManager, bool enableCompression, VirtualFileSystem* vfs)
-    : databasePath{databasePath}, readOnly{readOnly}, dataFH{nullptr}, memoryManager{memoryManager},
-      enableCompression{enableCompression} {
+    : databasePath{databasePath}, readOnly{readOnly}, dataFH{nullptr}, metadataFileOffset{0},
+      memoryManager{memoryManager}, enableCompression{enableCompression}, replicaWALOffset{0},
+      replicaNumCheckpoints{0}, replicaNeedsReload{false} {
     wal = std::make_unique<WAL>(databasePath, readOnly, enableChecksums, vfs);
     shadowFile =
         std::make_unique<ShadowFile>(*memoryManager.getBufferManager(), vfs, this->databasePath);
     inMemory = main::DBConfig::isDBPathInMemory(databasePath);
     registerIndexType(PrimaryKeyIndex::getIndexType());
+    registerIndexType(PropertyIndex::getIndexType());
 }
 
-StorageManager::~StorageManager() = default;
+StorageManager::~StorageManager() {
+    if (dataFH != nullptr) {
+        dataFH->setColdStorage(nullptr);
+    }
+}
 
 void StorageManager::initDataFileHandle(VirtualFileSystem* vfs, main::ClientContext* context) {
     if (inMemory) {
@@ -44,7 +60,10 @@ void StorageManager::initDataFileHandle(VirtualFileSystem* vfs, main::ClientCont
     } else {
         auto flag = readOnly ? FileHandle::O_PERSISTENT_FILE_READ_ONLY :
                                FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS;
-        flag |= FileHandle::O_LOCKED_PERSISTENT_FILE;
+        // Read replicas share the data file with the writing process.
+        if (!context->getDBConfig()->enableReadReplica) {
+            flag |= FileHandle::O_LOCKED_PERSISTENT_FILE;
+        }
         dataFH = memoryManager.getBufferManager()->getFileHandle(databasePath, flag, vfs, context);
         if (dataFH->getNumPages() == 0) {
             if (!readOnly) {
@@ -59,19 +78,43 @@ void StorageManager::initDataFileHandle(VirtualFileSystem* vfs, main::ClientCont
                 dataFH->getFileInfo()->writeFile(headerWriter->getPage(0).data(), RYU_PAGE_SIZE,
                     StorageConstants::DB_HEADER_PAGE_IDX);
                 dataFH->getFileInfo()->syncFile();
+                // Pages offloaded by a previous database at the same path are gone.
+                vfs->removeFileIfExists(StorageUtils::getColdStorageMapFilePath(databasePath),
+                    context);
+                vfs->removeFileIfExists(
+                    StorageUtils::getBufferPoolSnapshotFilePath(databasePath), context);
             }
         }
+        coldStorage = std::make_unique<ColdStorage>(databasePath, vfs, context);
+        dataFH->setColdStorage(coldStorage.get());
     }
 }
 
 Table* StorageManager::getTable(table_id_t tableID) {
     std::lock_guard lck{mtx};
     KU_ASSERT(tables.contains(tableID));
+    loadNodeGroupsNoLock(tableID);
     return tables.at(tableID).get();
 }
 
+bool StorageManager::isTableLoaded(table_id_t tableID) {
+    std::lock_guard lck{mtx};
+    return !unloadedNodeGroups.contains(tableID);
+}
+
 void StorageManager::recover(main::ClientContext& clientContext, bool throwOnWalReplayFailure,
     bool enableChecksums) {
+    if (clientContext.getDBConfig()->enableReadReplica) {
+        // The WAL and shadow file belong to the writing process, so they are only read.
+        CheckpointLock lock{clientContext.getDatabasePath(), clientContext,
+            false /* exclusive */};
+        Checkpointer(clientContext).readCheckpoint();
+        auto storageManager = Get(clientContext);
+        storageManager->replicaNumCheckpoints = lock.getNumCheckpoints();
+        storageManager->replicaWALOffset =
+            WALReplayer(clientContext).tail(0 /* startOffset */, enableChecksums);
+        return;
+    }
     const auto walReplayer = std::make_unique<WALReplayer>(clientContext);
     walReplayer->replay(throwOnWalReplayFailure, enableChecksums);
 }
@@ -125,6 +168,7 @@ void StorageManager::reclaimDroppedTables(const Catalog& catalog) {
         switch (table->getTableType()) {
         case TableType::NODE: {
             if (!catalog.containsTable(&DUMMY_CHECKPOINT_TRANSACTION, tableID, true)) {
+                loadNodeGroupsNoLock(tableID);
                 table->reclaimStorage(*dataFH->getPageManager());
                 droppedTables.push_back(tableID);
             }
@@ -133,6 +177,7 @@ void StorageManager::reclaimDroppedTables(const Catalog& catalog) {
             auto& relTable = table->cast<RelTable>();
             auto relGroupID = relTable.getRelGroupID();
             if (!catalog.containsTable(&DUMMY_CHECKPOINT_TRANSACTION, relGroupID, true)) {
+                loadNodeGroupsNoLock(tableID);
                 table->reclaimStorage(*dataFH->getPageManager());
                 droppedTables.push_back(tableID);
             } else {
@@ -140,6 +185,7 @@ void StorageManager::reclaimDroppedTables(const Catalog& catalog) {
                     catalog.getTableCatalogEntry(&DUMMY_CHECKPOINT_TRANSACTION, relGroupID);
                 if (!relGroupEntry->cast<RelGroupCatalogEntry>().getRelEntryInfo(
                         relTable.getFromNodeTableID(), relTable.getToNodeTableID())) {
+                    loadNodeGroupsNoLock(tableID);
                     table->reclaimStorage(*dataFH->getPageManager());
                     droppedTables.push_back(tableID);
                 }
@@ -181,20 +227,360 @@ bool StorageManager::checkpoint(main::ClientContext* context, PageAllocator& pag
         entry->vacuumColumnIDs(1);
     }
     reclaimDroppedTables(*catalog);
+    hasChanges = compactDataFile() || hasChanges;
     return hasChanges;
 }
 
+void StorageManager::vacuumUpdates(transaction_t oldestActiveTS) {
+    std::lock_guard lck{mtx};
+    for (auto& [_, table] : tables) {
+        table->vacuumUpdates(oldestActiveTS);
+    }
+}
+
+std::vector<std::string> StorageManager::getNodeTablesToAnalyze() {
+    std::lock_guard lck{mtx};
+    std::vector<std::string> tableNames;
+    for (auto& [_, table] : tables) {
+        if (table->getTableType() == TableType::NODE && table->cast<NodeTable>().needsAnalyze()) {
+            tableNames.push_back(table->getTableName());
+        }
+    }
+    return tableNames;
+}
+
+table_id_map_t<uint64_t> StorageManager::getTableWriteVersions() {
+    std::lock_guard lck{mtx};
+    table_id_map_t<uint64_t> versions;
+    for (auto& [tableID, table] : tables) {
+        versions.emplace(tableID, table->getWriteVersion());
+    }
+    return versions;
+}
+
+void StorageManager::compactInMemoryNodeGroups(main::ClientContext* context) {
+    KU_ASSERT(inMemory);
+    std::lock_guard lck{mtx};
+    for (auto& [_, table] : tables) {
+        if (table->getTableType() == TableType::NODE) {
+            table->cast<NodeTable>().compactFullNodeGroups(context, *dataFH->getPageManager());
+        }
+    }
+}
+
+bool StorageManager::hasCompactableNodeGroups() {
+    std::lock_guard lck{mtx};
+    return std::ranges::any_of(tables, [](const auto& entry) {
+        return entry.second->getTableType() == TableType::NODE &&
+               entry.second->template cast<NodeTable>().hasCompactableNodeGroups();
+    });
+}
+
+namespace {
+
+// Collects the page ranges which a table would free when reclaiming its storage.
+class PageRangeCollector final : public PageAllocator {
+public:
+    explicit PageRangeCollector(FileHandle* fileHandle) : PageAllocator{fileHandle} {}
+
+    PageRange allocatePageRange(page_idx_t numPages) override {
+        return getDataFH()->getPageManager()->allocatePageRange(numPages);
+    }
+    void freePageRange(PageRange pageRange) override { pageRanges.push_back(pageRange); }
+
+    std::vector<PageRange> pageRanges;
+};
+
+// Moves column chunks at or after a page index into free page ranges before them. The moved
+// chunks' old pages are freed as usual, and truncated once they are at the end of the file. Each
+// move is recorded, so that it can be undone if the checkpoint is rolled back.
+class ChunkRelocator final : public PageAllocator {
+public:
+    ChunkRelocator(FileHandle* fileHandle, const ShadowFile& shadowFile,
+        page_idx_t firstPageIdxToMove, std::vector<ChunkRelocation>& relocations)
+        : PageAllocator{fileHandle}, fileHandle{fileHandle}, shadowFile{shadowFile},
+          firstPageIdxToMove{firstPageIdxToMove}, numMovedPages{0}, relocations{relocations},
+          tableID{INVALID_TABLE_ID}, nodeGroupIdx{INVALID_NODE_GROUP_IDX},
+          columnID{INVALID_COLUMN_ID} {}
+
+    void setTableID(table_id_t tableID_) { tableID = tableID_; }
+
+    PageRange allocatePageRange(page_idx_t numPages) override {
+        return fileHandle->getPageManager()->allocatePageRange(numPages);
+    }
+    // Other pages, e.g. the ones of indexes, stay where they are.
+    void freePageRange(PageRange /*pageRange*/) override {}
+    void setChunkNodeGroupIdx(node_group_idx_t nodeGroupIdx_) override {
+        nodeGroupIdx = nodeGroupIdx_;
+    }
+    void setChunkColumnID(column_id_t columnID_) override { columnID = columnID_; }
+
+    void reclaimChunkPages(PageRange& pageRange) override {
+        if (!canMove(pageRange)) {
+            return;
+        }
+        auto pageManager = fileHandle->getPageManager();
+        const auto newPageRange = pageManager->allocateFreePageRange(pageRange.numPages);
+        if (!newPageRange.has_value()) {
+            return;
+        }
+        if (newPageRange->startPageIdx >= pageRange.startPageIdx) {
+            pageManager->returnFreePageRange(*newPageRange);
+            return;
+        }
+        const auto pageSize = fileHandle->getPageSize();
+        const auto buffer = std::make_unique<uint8_t[]>(pageRange.numPages * pageSize);
+        fileHandle->getFileInfo()->readFromFile(buffer.get(), pageRange.numPages * pageSize,
+            pageRange.startPageIdx * pageSize);
+        fileHandle->writePagesToFile(buffer.get(), pageRange.numPages * pageSize,
+            newPageRange->startPageIdx);
+        pageManager->freePageRange(pageRange);
+        relocations.push_back({tableID, nodeGroupIdx, columnID, pageRange, *newPageRange});
+        pageRange = *newPageRange;
+        numMovedPages += pageRange.numPages;
+    }
+
+    page_idx_t getNumMovedPages() const { return numMovedPages; }
+
+private:
+    bool canMove(const PageRange& pageRange) const {
+        if (pageRange.startPageIdx < firstPageIdxToMove ||
+            numMovedPages + pageRange.numPages >
+                StorageConstants::MAX_NUM_PAGES_TO_COMPACT_PER_CHECKPOINT) {
+            return false;
+        }
+        // Pages updated in this checkpoint are only in the shadow file yet, and offloaded pages
+        // don't take space in the data file.
+        const auto coldStorage = fileHandle->getColdStorage();
+        for (auto i = 0u; i < pageRange.numPages; i++) {
+            const auto pageIdx = pageRange.startPageIdx + i;
+            if (shadowFile.hasShadowPage(fileHandle->getFileIndex(), pageIdx) ||
+                (coldStorage != nullptr && coldStorage->isColdPage(pageIdx))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    FileHandle* fileHandle;
+    const ShadowFile& shadowFile;
+    page_idx_t firstPageIdxToMove;
+    page_idx_t numMovedPages;
+    std::vector<ChunkRelocation>& relocations;
+    table_id_t tableID;
+    node_group_idx_t nodeGroupIdx;
+    column_id_t columnID;
+};
+
+} // namespace
+
+bool StorageManager::compactDataFile() {
+    const auto numPages = dataFH->getNumPages();
+    const auto numFreePages = dataFH->getPageManager()->getNumFreePages();
+    if (numPages == 0 ||
+        static_cast<double>(numFreePages) / numPages <
+            StorageConstants::MIN_FREE_PAGE_RATIO_TO_COMPACT) {
+        return false;
+    }
+    // Once compacted, the file needs no more than its pages in use, so chunks after that are
+    // moved. Tables whose node groups haven't been loaded are left as they are.
+    ChunkRelocator relocator{dataFH, *shadowFile, numPages - numFreePages, chunkRelocations};
+    std::lock_guard lck{mtx};
+    for (auto& [tableID, table] : tables) {
+        if (unloadedNodeGroups.contains(tableID)) {
+            continue;
+        }
+        relocator.setTableID(tableID);
+        if (table->getTableType() == TableType::NODE) {
+            table->cast<NodeTable>().reclaimColumnStorage(relocator);
+        } else {
+            table->reclaimStorage(relocator);
+        }
+    }
+    return relocator.getNumMovedPages() > 0;
+}
+
+void StorageManager::offloadColdPages(main::ClientContext& context) {
+    auto coldStoragePath = context.getDBConfig()->coldStoragePath;
+    if (coldStorage == nullptr || coldStoragePath.empty()) {
+        return;
+    }
+    if (coldStoragePath.ends_with('/')) {
+        coldStoragePath.pop_back();
+    }
+    std::lock_guard lck{mtx};
+    // Rel tables hold most of the data of a graph and their chunks are rewritten rather than
+    // updated in place, so their pages rarely become local again once offloaded.
+    PageRangeCollector collector{dataFH};
+    for (auto& [tableID, table] : tables) {
+        if (table->getTableType() == TableType::REL) {
+            loadNodeGroupsNoLock(tableID);
+            table->reclaimStorage(collector);
+        }
+    }
+    // Snapshots keep the database ID and share the segments, so segment names are made unique
+    // rather than numbered per database.
+    const auto segmentPath = stringFormat("{}/{}-{}.{}", coldStoragePath,
+        UUID::toString(databaseHeader->databaseID),
+        UUID::toString(UUID::generateRandomUUID(RandomEngine::Get(context)).value),
+        StorageConstants::COLD_SEGMENT_SUFFIX);
+    // Offloaded pages are released in the local data file, which read replicas may still read.
+    CheckpointLock lock{databasePath, context, true /* exclusive */};
+    coldStorage->offload(context, segmentPath, collector.pageRanges, *dataFH);
+    lock.incrementNumCheckpoints();
+}
+
+void StorageManager::saveBufferPoolSnapshot(main::ClientContext& context) {
+    if (inMemory || readOnly || !context.getDBConfig()->enableBufferPoolPrewarm) {
+        return;
+    }
+    const auto pageRanges = dataFH->getCachedPageRanges();
+    const auto vfs = VirtualFileSystem::GetUnsafe(context);
+    const auto fileInfo = vfs->openFile(StorageUtils::getBufferPoolSnapshotFilePath(databasePath),
+        FileOpenFlags(FileFlags::WRITE | FileFlags::CREATE_AND_TRUNCATE_IF_EXISTS), &context);
+    const auto writer = std::make_shared<BufferedFileWriter>(*fileInfo);
+    Serializer ser(writer);
+    ser.serializeValue<uint64_t>(pageRanges.size());
+    for (auto& pageRange : pageRanges) {
+        ser.serializeValue(pageRange.startPageIdx);
+        ser.serializeValue(pageRange.numPages);
+    }
+    writer->flush();
+    writer->sync();
+}
+
+std::vector<PageRange> StorageManager::loadBufferPoolSnapshot(
+    main::ClientContext& context) const {
+    std::vector<PageRange> pageRanges;
+    const auto vfs = VirtualFileSystem::GetUnsafe(context);
+    const auto path = StorageUtils::getBufferPoolSnapshotFilePath(databasePath);
+    if (inMemory || !vfs->fileOrPathExists(path, &context)) {
+        return pageRanges;
+    }
+    const auto fileInfo = vfs->openFile(path, FileOpenFlags(FileFlags::READ_ONLY), &context);
+    Deserializer deSer(std::make_unique<BufferedFileReader>(*fileInfo));
+    uint64_t numPageRanges = 0;
+    deSer.deserializeValue(numPageRanges);
+    for (auto i = 0u; i < numPageRanges; i++) {
+        PageRange pageRange;
+        deSer.deserializeValue(pageRange.startPageIdx);
+        deSer.deserializeValue(pageRange.numPages);
+        pageRanges.push_back(pageRange);
+    }
+    return pageRanges;
+}
+
+bool StorageManager::prewarmPages(PageRange pageRange) {
+    const auto bm = memoryManager.getBufferManager();
+    const auto size = static_cast<uint64_t>(pageRange.numPages) * dataFH->getPageSize();
+    if (bm->getUsedMemory() + size > bm->getMemoryLimit()) {
+        return false;
+    }
+    dataFH->prefetchPages(pageRange.startPageIdx, pageRange.numPages);
+    return true;
+}
+
+bool StorageManager::prewarmTable(table_id_t tableID) {
+    const auto table = getTable(tableID);
+    PageRangeCollector collector{dataFH};
+    if (table->getTableType() == TableType::NODE) {
+        const auto& nodeTable = table->cast<NodeTable>();
+        nodeTable.reclaimColumnStorage(collector);
+        nodeTable.getPKIndex()->reclaimSlotStorage(collector);
+    } else {
+        table->reclaimStorage(collector);
+    }
+    for (auto& pageRange : collector.pageRanges) {
+        if (!prewarmPages(pageRange)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StorageManager::refreshReplica(main::ClientContext& context, const CheckpointLock& lock) {
+    KU_ASSERT(context.getDBConfig()->enableReadReplica);
+    // Records are replayed in recovery transactions, which must not be nested in a transaction of
+    // the caller.
+    main::ClientContext replayContext{context.getDatabase()};
+    const auto numCheckpoints = lock.getNumCheckpoints();
+    try {
+        if (replicaNeedsReload || numCheckpoints != replicaNumCheckpoints) {
+            // The writer cleared the WAL after applying its checkpoint to the data file.
+            reloadReplicaCheckpoint(replayContext);
+            replicaWALOffset = 0;
+            replicaNumCheckpoints = numCheckpoints;
+        }
+        replicaWALOffset = WALReplayer(replayContext)
+                               .tail(replicaWALOffset, context.getDBConfig()->enableChecksums);
+        replicaNeedsReload = false;
+    } catch (...) {
+        // Some commits may have been applied already, so they can't be replayed on top.
+        replicaNeedsReload = true;
+        throw;
+    }
+}
+
+void StorageManager::reloadReplicaCheckpoint(main::ClientContext& context) {
+    {
+        std::lock_guard lck{mtx};
+        tables.clear();
+        unloadedNodeGroups.clear();
+        // Cached pages may have been overwritten in place by the checkpoint.
+        auto bufferManager = memoryManager.getBufferManager();
+        bufferManager->removeFilePagesFromFrames(*dataFH);
+        bufferManager->removeEvictedCandidates();
+        dataFH->getPageManager()->resetFreeSpace();
+        const auto numPages = static_cast<page_idx_t>(
+            ceilDiv(dataFH->getFileInfo()->getFileSize(), static_cast<uint64_t>(RYU_PAGE_SIZE)));
+        if (numPages > dataFH->getNumPages()) {
+            dataFH->addNewPages(numPages - dataFH->getNumPages());
+        }
+        dataFH->setColdStorage(nullptr);
+        coldStorage =
+            std::make_unique<ColdStorage>(databasePath, VirtualFileSystem::GetUnsafe(context),
+                &context);
+        dataFH->setColdStorage(coldStorage.get());
+    }
+    const auto catalog = Catalog::Get(context);
+    Checkpointer::readCheckpoint(&context, catalog, this);
+    catalog->resetVersion();
+    extension::ExtensionManager::Get(context)->reloadExtensions(&context);
+}
+
 void StorageManager::finalizeCheckpoint() {
     dataFH->getPageManager()->finalizeCheckpoint();
+    chunkRelocations.clear();
+    if (checkpointedNodeGroups) {
+        // Node groups of unloaded tables are read from the new metadata from now on.
+        for (auto& [tableID, location] : *checkpointedNodeGroups) {
+            if (unloadedNodeGroups.contains(tableID)) {
+                unloadedNodeGroups[tableID] = location;
+            }
+        }
+        metadataFileOffset = databaseHeader->metadataPageRange.startPageIdx * RYU_PAGE_SIZE;
+        checkpointedNodeGroups.reset();
+    }
 }
 
 void StorageManager::rollbackCheckpoint(const Catalog& catalog) {
     std::lock_guard lck{mtx};
+    // Moved chunks go back to their old pages, which are no longer freed once the page manager is
+    // rolled back.
+    ChunkRelocationRollback relocationRollback{dataFH, chunkRelocations};
     const auto nodeTableEntries = catalog.getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION);
     for (const auto tableEntry : nodeTableEntries) {
         KU_ASSERT(tables.contains(tableEntry->getTableID()));
-        tables.at(tableEntry->getTableID())->rollbackCheckpoint();
+        tables.at(tableEntry->getTableID())->rollbackCheckpoint(relocationRollback);
+    }
+    for (auto& [_, table] : tables) {
+        if (table->getTableType() == TableType::REL) {
+            table->rollbackCheckpoint(relocationRollback);
+        }
     }
+    KU_ASSERT(relocationRollback.getNumRemainingRelocations() == 0);
+    chunkRelocations.clear();
+    checkpointedNodeGroups.reset();
     dataFH->getPageManager()->rollbackCheckpoint();
 }
 
@@ -208,6 +594,65 @@ std::optional<std::reference_wrapper<const IndexType>> StorageManager::getIndexT
     return std::nullopt;
 }
 
+void StorageManager::serializeNodeGroupsNoLock(table_id_t tableID, Serializer& ser) {
+    BinaryData data;
+    const auto isUnloaded = unloadedNodeGroups.contains(tableID);
+    if (isUnloaded) {
+        // The node groups are copied from the current metadata, which is only replaced once the
+        // checkpoint is applied.
+        data.size = unloadedNodeGroups.at(tableID).size;
+        data.data = std::make_unique<uint8_t[]>(data.size);
+        readNodeGroupsNoLock(tableID, data.data.get());
+    } else {
+        auto writer = std::make_shared<BufferWriter>();
+        Serializer nodeGroupsSer(writer);
+        tables.at(tableID)->serializeNodeGroups(nodeGroupsSer);
+        data = writer->getData();
+    }
+    ser.writeDebuggingInfo("node_groups_size");
+    ser.write<uint64_t>(data.size);
+    if (isUnloaded) {
+        if (!checkpointedNodeGroups) {
+            checkpointedNodeGroups.emplace();
+        }
+        (*checkpointedNodeGroups)[tableID] = {ser.getWriter()->getSize(), data.size};
+    }
+    ser.write(data.data.get(), data.size);
+}
+
+void StorageManager::skipNodeGroups(table_id_t tableID, Deserializer& deSer) {
+    std::string key;
+    deSer.validateDebuggingInfo(key, "node_groups_size");
+    uint64_t size = 0;
+    deSer.deserializeValue<uint64_t>(size);
+    auto* fileReader = dynamic_cast<BufferedFileReader*>(deSer.getReader());
+    if (fileReader == nullptr) {
+        tables.at(tableID)->deserializeNodeGroups(deSer);
+        return;
+    }
+    const auto offset = fileReader->getReadOffset();
+    unloadedNodeGroups[tableID] = {offset - metadataFileOffset, size};
+    fileReader->resetReadOffset(offset + size);
+}
+
+void StorageManager::loadNodeGroupsNoLock(table_id_t tableID) {
+    if (!unloadedNodeGroups.contains(tableID)) {
+        return;
+    }
+    auto reader = std::make_unique<BufferedFileReader>(*dataFH->getFileInfo());
+    reader->resetReadOffset(metadataFileOffset + unloadedNodeGroups.at(tableID).offset);
+    Deserializer deSer(std::move(reader));
+    tables.at(tableID)->deserializeNodeGroups(deSer);
+    unloadedNodeGroups.erase(tableID);
+}
+
+void StorageManager::readNodeGroupsNoLock(table_id_t tableID, uint8_t* buffer) const {
+    auto& location = unloadedNodeGroups.at(tableID);
+    BufferedFileReader reader{*dataFH->getFileInfo()};
+    reader.resetReadOffset(metadataFileOffset + location.offset);
+    reader.read(buffer, location.size);
+}
+
 void StorageManager::serialize(const Catalog& catalog, Serializer& ser) {
     std::lock_guard lck{mtx};
     auto nodeTableEntries = catalog.getNodeTableEntries(&DUMMY_CHECKPOINT_TRANSACTION);
@@ -223,6 +668,7 @@ void StorageManager::serialize(const Catalog& catalog, Serializer& ser) {
         ser.writeDebuggingInfo("table_id");
         ser.write<table_id_t>(tableEntry->getTableID());
         tables.at(tableEntry->getTableID())->serialize(ser);
+        serializeNodeGroupsNoLock(tableEntry->getTableID(), ser);
     }
     ser.writeDebuggingInfo("num_rel_groups");
     ser.write<uint64_t>(relGroupEntries.size());
@@ -236,12 +682,16 @@ void StorageManager::serialize(const Catalog& catalog, Serializer& ser) {
             KU_ASSERT(tables.contains(info.oid));
             info.serialize(ser);
             tables.at(info.oid)->serialize(ser);
+            serializeNodeGroupsNoLock(info.oid, ser);
         }
     }
 }
 
 void StorageManager::deserialize(main::ClientContext* context, const Catalog* catalog,
     Deserializer& deSer) {
+    if (const auto* fileReader = dynamic_cast<BufferedFileReader*>(deSer.getReader())) {
+        metadataFileOffset = fileReader->getReadOffset();
+    }
     std::string key;
     deSer.validateDebuggingInfo(key, "num_node_tables");
     uint64_t numNodeTables = 0;
@@ -259,6 +709,7 @@ void StorageManager::deserialize(main::ClientContext* context, const Catalog* ca
                               ->ptrCast<NodeTableCatalogEntry>();
         tables[tableID] = std::make_unique<NodeTable>(this, tableEntry, &memoryManager);
         tables[tableID]->deserialize(context, this, deSer);
+        skipNodeGroups(tableID, deSer);
     }
     deSer.validateDebuggingInfo(key, "num_rel_groups");
     uint64_t numRelGroups = 0;
@@ -282,6 +733,7 @@ void StorageManager::deserialize(main::ClientContext* context, const Catalog* ca
             tables[info.oid] = std::make_unique<RelTable>(relGroupEntry, info.nodePair.srcTableID,
                 info.nodePair.dstTableID, this, &memoryManager);
             tables.at(info.oid)->deserialize(context, this, deSer);
+            skipNodeGroups(info.oid, deSer);
         }
     }
 }
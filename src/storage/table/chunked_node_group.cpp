@@ -3,6 +3,7 @@
 #include <exception>
 
 #include "common/assert.h"
+#include "common/exception/runtime.h"
 #include "common/types/types.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
@@ -290,12 +291,25 @@ static ZoneMapCheckResult getZoneMapResult(const TableScanState& scanState,
     return ZoneMapCheckResult::ALWAYS_SCAN;
 }
 
+bool ChunkedNodeGroup::canSkipScan(const TableScanState& scanState,
+    NodeGroupScanState& nodeGroupScanState) const {
+    if (scanState.columnPredicateSets.empty()) {
+        return false;
+    }
+    if (nodeGroupScanState.zoneMapCheckedGroup != this) {
+        nodeGroupScanState.zoneMapCheckedGroup = this;
+        nodeGroupScanState.zoneMapSkipsScan =
+            getZoneMapResult(scanState, chunks) == ZoneMapCheckResult::SKIP_SCAN;
+    }
+    return nodeGroupScanState.zoneMapSkipsScan;
+}
+
 void ChunkedNodeGroup::scan(const Transaction* transaction, const TableScanState& scanState,
-    const NodeGroupScanState& nodeGroupScanState, offset_t rowIdxInGroup,
+    NodeGroupScanState& nodeGroupScanState, offset_t rowIdxInGroup,
     length_t numRowsToScan) const {
     KU_ASSERT(rowIdxInGroup + numRowsToScan <= numRows);
     auto& anchorSelVector = scanState.outState->getSelVectorUnsafe();
-    if (getZoneMapResult(scanState, chunks) == ZoneMapCheckResult::SKIP_SCAN) {
+    if (canSkipScan(scanState, nodeGroupScanState)) {
         anchorSelVector.setToFiltered(0);
         return;
     }
@@ -386,10 +400,39 @@ bool ChunkedNodeGroup::lookup(const Transaction* transaction, const TableScanSta
 
 void ChunkedNodeGroup::update(const Transaction* transaction, row_idx_t rowIdxInChunk,
     column_id_t columnID, const ValueVector& propertyVector) {
+    if (transaction->getType() != TransactionType::DUMMY && versionInfo &&
+        versionInfo->isDeletedByOtherTransaction(transaction, rowIdxInChunk)) {
+        throw RuntimeException(
+            "Write-write conflict: updating a row that is deleted by another transaction.");
+    }
     getColumnChunk(columnID).update(transaction, rowIdxInChunk, propertyVector);
 }
 
+void ChunkedNodeGroup::update(const Transaction* transaction,
+    std::span<const row_idx_t> rowIdxesInChunk, column_id_t columnID,
+    const ValueVector& propertyVector, std::span<const sel_t> valuePositions) {
+    if (transaction->getType() != TransactionType::DUMMY && versionInfo) {
+        for (const auto rowIdxInChunk : rowIdxesInChunk) {
+            if (versionInfo->isDeletedByOtherTransaction(transaction, rowIdxInChunk)) {
+                throw RuntimeException(
+                    "Write-write conflict: updating a row that is deleted by another transaction.");
+            }
+        }
+    }
+    getColumnChunk(columnID).update(transaction, rowIdxesInChunk, propertyVector, valuePositions);
+}
+
 bool ChunkedNodeGroup::delete_(const Transaction* transaction, row_idx_t rowIdxInChunk) {
+    // Concurrent write transactions may delete rows from the same chunked group
+    std::unique_lock lck{deletionMtx};
+    if (transaction->getType() != TransactionType::DUMMY) {
+        for (const auto& chunk : chunks) {
+            if (chunk->isUpdatedByOtherTransaction(transaction, rowIdxInChunk)) {
+                throw RuntimeException(
+                    "Write-write conflict: deleting a row that is updated by another transaction.");
+            }
+        }
+    }
     if (!versionInfo) {
         versionInfo = std::make_unique<VersionInfo>();
     }
@@ -542,10 +585,32 @@ void ChunkedNodeGroup::rollbackDelete(row_idx_t startRow, row_idx_t numRows_, tr
 }
 
 void ChunkedNodeGroup::reclaimStorage(PageAllocator& pageAllocator) const {
+    for (auto columnID = 0u; columnID < chunks.size(); columnID++) {
+        if (chunks[columnID]) {
+            pageAllocator.setChunkColumnID(columnID);
+            chunks[columnID]->reclaimStorage(pageAllocator);
+        }
+    }
+}
+
+void ChunkedNodeGroup::vacuumUpdates(transaction_t oldestActiveTS) const {
     for (auto& columnChunk : chunks) {
         if (columnChunk) {
-            columnChunk->reclaimStorage(pageAllocator);
+            columnChunk->vacuumUpdates(oldestActiveTS);
+        }
+    }
+}
+
+void ChunkedNodeGroup::prefetchPagesAsync(FileHandle& dataFH,
+    const std::vector<column_id_t>& columnIDs) const {
+    if (residencyState != ResidencyState::ON_DISK) {
+        return;
+    }
+    for (const auto columnID : columnIDs) {
+        if (columnID == INVALID_COLUMN_ID || columnID == ROW_IDX_COLUMN_ID) {
+            continue;
         }
+        getColumnChunk(columnID).prefetchPagesAsync(dataFH);
     }
 }
 
@@ -610,6 +675,14 @@ void InMemChunkedNodeGroup::setUnused(const MemoryManager& mm) {
     mm.getBufferManager()->getSpillerOrSkip([&](auto& spiller) { spiller.addUnusedChunk(this); });
 }
 
+void InMemChunkedNodeGroup::clearUnused(const MemoryManager& mm) {
+    mm.getBufferManager()->getSpillerOrSkip([&](auto& spiller) {
+        std::unique_lock lock{spillToDiskMutex};
+        spiller.clearUnusedChunk(this);
+        dataInUse = true;
+    });
+}
+
 void InMemChunkedNodeGroup::loadFromDisk(const MemoryManager& mm) {
     mm.getBufferManager()->getSpillerOrSkip([&](auto& spiller) {
         std::unique_lock lock{spillToDiskMutex};
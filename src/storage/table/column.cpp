@@ -223,6 +223,7 @@ void Column::scanSegment(const SegmentState& state, offset_t startOffsetInSegmen
         return;
     }
     if (!resultVector->state || resultVector->state->getSelVector().isUnfiltered()) {
+        prefetchPages(state, startOffsetInSegment, numValuesToScan);
         columnReadWriter->readCompressedValuesToVector(state, resultVector, offsetInVector,
             startOffsetInSegment, numValuesToScan, readToVectorFunc);
     } else {
@@ -267,6 +268,7 @@ void Column::scanSegment(const SegmentState& state, ColumnChunkData* outputChunk
     }
 
     if (getDataTypeSizeInChunk(dataType) > 0) {
+        prefetchPages(state, offsetInSegment, numValues);
         columnReadWriter->readCompressedValuesToPage(state, outputChunk->getData(),
             outputChunk->getNumValues(), offsetInSegment, numValues, readToPageFunc);
     }
@@ -290,6 +292,24 @@ void Column::scanSegment(const SegmentState& state, offset_t startOffsetInSegmen
         readToPageFunc);
 }
 
+void Column::prefetchPages(const SegmentState& state, offset_t startOffsetInSegment,
+    offset_t numValues) const {
+    if (numValues == 0 || state.numValuesPerPage == 0 ||
+        state.metadata.getStartPageIdx() == INVALID_PAGE_IDX) {
+        return;
+    }
+    uint64_t startPageIdx = startOffsetInSegment / state.numValuesPerPage;
+    uint64_t endPageIdx = (startOffsetInSegment + numValues - 1) / state.numValuesPerPage + 1;
+    endPageIdx =
+        std::min<uint64_t>(endPageIdx, state.metadata.getNumDataPages(dataType.getPhysicalType()));
+    // Reads of a single page gain nothing from being batched.
+    if (endPageIdx <= startPageIdx + 1) {
+        return;
+    }
+    dataFH->prefetchPages(state.metadata.getStartPageIdx() + startPageIdx,
+        endPageIdx - startPageIdx, state.pageAccessPattern);
+}
+
 void Column::lookupValue(const ChunkState& state, offset_t nodeOffset, ValueVector* resultVector,
     uint32_t posInVector) const {
     auto [segmentState, offsetInSegment] = state.findSegment(nodeOffset);
@@ -337,7 +357,8 @@ void Column::updateStatistics(ColumnChunkMetadata& metadata, offset_t maxIndex,
         // If new values are outside of the existing min/max, update them
         if (max->gt(metadata.compMeta.max, dataType.getPhysicalType())) {
             metadata.compMeta.max = *max;
-        } else if (metadata.compMeta.min.gt(*min, dataType.getPhysicalType())) {
+        }
+        if (metadata.compMeta.min.gt(*min, dataType.getPhysicalType())) {
             metadata.compMeta.min = *min;
         }
     }
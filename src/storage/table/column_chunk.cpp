@@ -1,6 +1,7 @@
 #include "storage/table/column_chunk.h"
 
 #include <algorithm>
+#include <array>
 #include <memory>
 
 #include "common/serializer/deserializer.h"
@@ -188,10 +189,48 @@ void ColumnChunk::update(const Transaction* transaction, offset_t offsetInChunk,
 
     const auto vectorIdx = offsetInChunk / DEFAULT_VECTOR_CAPACITY;
     const auto rowIdxInVector = offsetInChunk % DEFAULT_VECTOR_CAPACITY;
-    auto& vectorUpdateInfo = updateInfo.update(data.front()->getMemoryManager(), transaction,
-        vectorIdx, rowIdxInVector, values);
-    transaction->pushVectorUpdateInfo(updateInfo, vectorIdx, vectorUpdateInfo,
-        transaction->getID());
+    const auto [vectorUpdateInfo, isNewVersion] = updateInfo.update(
+        data.front()->getMemoryManager(), transaction, vectorIdx, rowIdxInVector, values);
+    // Commit and rollback apply to the whole version of the vector, so it is recorded once.
+    if (isNewVersion) {
+        transaction->pushVectorUpdateInfo(updateInfo, vectorIdx, *vectorUpdateInfo,
+            transaction->getID());
+    }
+}
+
+void ColumnChunk::update(const Transaction* transaction, std::span<const offset_t> offsetsInChunk,
+    const ValueVector& values, std::span<const sel_t> valuePositions) {
+    KU_ASSERT(offsetsInChunk.size() == valuePositions.size());
+    if (transaction->getType() == TransactionType::DUMMY) {
+        for (auto i = 0u; i < offsetsInChunk.size(); i++) {
+            rangeSegments(offsetsInChunk[i], 1,
+                [&](auto& segment, auto offsetInSegment, auto, auto) {
+                    segment->write(&values, valuePositions[i], offsetInSegment);
+                });
+        }
+        return;
+    }
+
+    std::array<sel_t, DEFAULT_VECTOR_CAPACITY> rowsInVector{};
+    auto i = 0u;
+    while (i < offsetsInChunk.size()) {
+        const auto vectorIdx = offsetsInChunk[i] / DEFAULT_VECTOR_CAPACITY;
+        auto numRows = 0u;
+        while (i + numRows < offsetsInChunk.size() &&
+               offsetsInChunk[i + numRows] / DEFAULT_VECTOR_CAPACITY == vectorIdx) {
+            rowsInVector[numRows] = offsetsInChunk[i + numRows] % DEFAULT_VECTOR_CAPACITY;
+            numRows++;
+        }
+        const auto [vectorUpdateInfo, isNewVersion] = updateInfo.update(
+            data.front()->getMemoryManager(), transaction, vectorIdx,
+            std::span<const sel_t>(rowsInVector.data(), numRows), values,
+            valuePositions.subspan(i, numRows));
+        if (isNewVersion) {
+            transaction->pushVectorUpdateInfo(updateInfo, vectorIdx, *vectorUpdateInfo,
+                transaction->getID());
+        }
+        i += numRows;
+    }
 }
 
 MergedColumnChunkStats ColumnChunk::getMergedColumnChunkStats() const {
@@ -238,6 +277,12 @@ void ColumnChunk::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void ColumnChunk::prefetchPagesAsync(FileHandle& dataFH) const {
+    for (const auto& segment : data) {
+        segment->prefetchPagesAsync(dataFH);
+    }
+}
+
 void ColumnChunk::append(common::ValueVector* vector, const common::SelectionView& selView) {
     data.back()->append(vector, selView);
 }
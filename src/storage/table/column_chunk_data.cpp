@@ -47,6 +47,16 @@ void SegmentState::reclaimAllocatedPages(PageAllocator& pageAllocator) const {
     }
 }
 
+void SegmentState::setPageAccessPattern(PageAccessPattern accessPattern) {
+    pageAccessPattern = accessPattern;
+    if (nullState) {
+        nullState->setPageAccessPattern(accessPattern);
+    }
+    for (auto& child : childrenStates) {
+        child.setPageAccessPattern(accessPattern);
+    }
+}
+
 static std::shared_ptr<CompressionAlg> getCompression(const LogicalType& dataType,
     bool enableCompression) {
     if (!enableCompression) {
@@ -214,7 +224,8 @@ MergedColumnChunkStats ColumnChunkData::getMergedColumnChunkStats() const {
     const auto physicalType = getDataType().getPhysicalType();
     const bool isStorageValueType =
         TypeUtils::visit(physicalType, []<typename T>(T) { return StorageValueType<T>; });
-    if (isStorageValueType) {
+    // The on-disk min and max of string chunks are the bounds of their string prefixes
+    if (isStorageValueType || physicalType == PhysicalTypeID::STRING) {
         stats.update(onDiskMetadata.min, onDiskMetadata.max, physicalType);
     }
     return MergedColumnChunkStats{stats, !nullData || nullData->haveNoNullsGuaranteed(),
@@ -1016,11 +1027,20 @@ void ColumnChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     }
     if (residencyState == ResidencyState::ON_DISK) {
         if (metadata.getStartPageIdx() != INVALID_PAGE_IDX) {
-            pageAllocator.freePageRange(metadata.pageRange);
+            pageAllocator.reclaimChunkPages(metadata.pageRange);
         }
     }
 }
 
+void ColumnChunkData::prefetchPagesAsync(FileHandle& dataFH) const {
+    if (nullData) {
+        nullData->prefetchPagesAsync(dataFH);
+    }
+    if (residencyState == ResidencyState::ON_DISK) {
+        dataFH.prefetchPagesAsync(metadata.pageRange);
+    }
+}
+
 uint64_t ColumnChunkData::getSizeOnDisk() const {
     // Probably could just return the actual size from the metadata if it's on-disk, but it's not
     // currently needed for on-disk segments
@@ -100,7 +100,56 @@ page_idx_t ColumnChunkMetadata::getNumDataPages(PhysicalTypeID dataType) const {
     }
 }
 
-ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /*buffer*/,
+static page_idx_t getNumPagesForValues(const CompressionMetadata& compMeta, uint64_t numValues,
+    const LogicalType& dataType) {
+    const auto numValuesPerPage = compMeta.numValues(RYU_PAGE_SIZE, dataType);
+    return numValuesPerPage == UINT64_MAX ?
+               0 :
+               numValues / numValuesPerPage + (numValues % numValuesPerPage == 0 ? 0 : 1);
+}
+
+template<IntegerDeltaType T>
+static std::optional<CompressionMetadata> getDeltaMetadata(std::span<const uint8_t> buffer,
+    uint64_t numValues, StorageValue min, StorageValue max) {
+    KU_ASSERT(buffer.size() >= numValues * sizeof(T));
+    return IntegerDelta<T>::getMetadata(
+        std::span(reinterpret_cast<const T*>(buffer.data()), numValues), min, max);
+}
+
+static std::optional<CompressionMetadata> getDeltaMetadata(PhysicalTypeID physicalType,
+    std::span<const uint8_t> buffer, uint64_t numValues, StorageValue min, StorageValue max) {
+    switch (physicalType) {
+    case PhysicalTypeID::INT64:
+        return getDeltaMetadata<int64_t>(buffer, numValues, min, max);
+    case PhysicalTypeID::INT32:
+        return getDeltaMetadata<int32_t>(buffer, numValues, min, max);
+    case PhysicalTypeID::INTERNAL_ID:
+    case PhysicalTypeID::UINT64:
+        return getDeltaMetadata<uint64_t>(buffer, numValues, min, max);
+    case PhysicalTypeID::UINT32:
+        return getDeltaMetadata<uint32_t>(buffer, numValues, min, max);
+    default:
+        return std::nullopt;
+    }
+}
+
+static std::optional<CompressionMetadata> getRunLengthMetadata(PhysicalTypeID physicalType,
+    std::span<const uint8_t> buffer, uint64_t numValues, StorageValue min, StorageValue max) {
+    return TypeUtils::visit(
+        physicalType,
+        [&](internalID_t) {
+            return RunLengthEncoding<uint64_t>::getMetadata(
+                std::span(reinterpret_cast<const uint64_t*>(buffer.data()), numValues), min, max);
+        },
+        [&]<IntegerBitpackingType T>(T) {
+            KU_ASSERT(buffer.size() >= numValues * sizeof(T));
+            return RunLengthEncoding<T>::getMetadata(
+                std::span(reinterpret_cast<const T*>(buffer.data()), numValues), min, max);
+        },
+        [](auto) { return std::optional<CompressionMetadata>(); });
+}
+
+ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> buffer,
     uint64_t numValues, StorageValue min, StorageValue max) {
     // For supported types, min and max may be null if all values are null
     // Compression is supported in this case
@@ -119,11 +168,25 @@ ColumnChunkMetadata GetBitpackingMetadata::operator()(std::span<const uint8_t> /
             },
             [&](auto) {});
     }
-    const auto numValuesPerPage = compMeta.numValues(RYU_PAGE_SIZE, dataType);
-    const auto numPages =
-        numValuesPerPage == UINT64_MAX ?
-            0 :
-            numValues / numValuesPerPage + (numValues % numValuesPerPage == 0 ? 0 : 1);
+    auto numPages = getNumPagesForValues(compMeta, numValues, dataType);
+    // Sorted values (e.g. serial keys and internal IDs) usually have small deltas even when their
+    // range is wide, and low-cardinality values often come in long runs. Both are computed from
+    // the raw buffer, null slots included, so that it can be reproduced exactly.
+    if (alg->getCompressionType() == CompressionType::INTEGER_BITPACKING && numPages > 1) {
+        const auto physicalType = dataType.getPhysicalType();
+        auto useIfSmaller = [&](std::optional<CompressionMetadata> candidate) {
+            if (!candidate) {
+                return;
+            }
+            const auto numCandidatePages = getNumPagesForValues(*candidate, numValues, dataType);
+            if (numCandidatePages < numPages) {
+                compMeta = std::move(*candidate);
+                numPages = numCandidatePages;
+            }
+        };
+        useIfSmaller(getDeltaMetadata(physicalType, buffer, numValues, min, max));
+        useIfSmaller(getRunLengthMetadata(physicalType, buffer, numValues, min, max));
+    }
     return ColumnChunkMetadata(INVALID_PAGE_IDX, numPages, numValues, compMeta);
 }
 
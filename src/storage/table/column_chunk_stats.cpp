@@ -1,5 +1,7 @@
 #include "storage/table/column_chunk_stats.h"
 
+#include <cstring>
+
 #include "common/type_utils.h"
 #include "common/types/types.h"
 #include "common/vector/value_vector.h"
@@ -51,6 +53,25 @@ void ColumnChunkStats::reset() {
     *this = {};
 }
 
+uint64_t StringPrefixStats::getPrefix(std::string_view str) {
+    uint8_t bytes[PREFIX_LENGTH]{};
+    memcpy(bytes, str.data(), std::min(str.size(), PREFIX_LENGTH));
+    uint64_t prefix = 0;
+    for (auto byte : bytes) {
+        prefix = (prefix << 8) | byte;
+    }
+    return prefix;
+}
+
+std::pair<uint64_t, uint64_t> StringPrefixStats::getPrefixRange(std::string_view prefix) {
+    const auto min = getPrefix(prefix);
+    if (prefix.size() >= PREFIX_LENGTH) {
+        return {min, min};
+    }
+    // The bytes after the prefix can take any value
+    return {min, min | (UINT64_MAX >> (prefix.size() * 8))};
+}
+
 void MergedColumnChunkStats::merge(const MergedColumnChunkStats& o,
     common::PhysicalTypeID dataType) {
     stats.update(o.stats.min, o.stats.max, dataType);
@@ -123,7 +123,8 @@ bool ChunkedCSRHeader::sanityCheck() const {
     return true;
 }
 
-offset_vec_t ChunkedCSRHeader::populateStartCSROffsetsFromLength(bool leaveGaps) const {
+offset_vec_t ChunkedCSRHeader::populateStartCSROffsetsFromLength(bool leaveGaps,
+    double packedDensity) const {
     const auto numNodes = length->getNumValues();
     const auto numLeafRegions = getNumRegions();
     offset_t leftCSROffset = 0;
@@ -143,7 +144,7 @@ offset_vec_t ChunkedCSRHeader::populateStartCSROffsetsFromLength(bool leaveGaps)
         // Update lastLeftCSROffset for next region.
         leftCSROffset += numRelsInRegion;
         if (leaveGaps) {
-            leftCSROffset += computeGapFromLength(numRelsInRegion);
+            leftCSROffset += computeGapFromLength(numRelsInRegion, packedDensity);
         }
         rightCSROffsetOfRegions.push_back(leftCSROffset);
     }
@@ -178,9 +179,17 @@ idx_t ChunkedCSRHeader::getNumRegions() const {
            StorageConfig::CSR_LEAF_REGION_SIZE;
 }
 
+DegreeStats InMemChunkedCSRHeader::computeDegreeStats() const {
+    DegreeStats stats;
+    for (auto i = 0u; i < length->getNumValues(); i++) {
+        stats.add(getCSRLength(i));
+    }
+    return stats;
+}
+
 void ChunkedCSRHeader::populateRegionCSROffsets(const CSRRegion& region,
     const ChunkedCSRHeader& oldHeader) const {
-    KU_ASSERT(region.level <= CSRNodeGroup::DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight);
+    KU_ASSERT(region.level <= PackedCSRInfo::CALIBRATOR_TREE_HEIGHT);
     const auto leftNodeOffset = region.leftNodeOffset;
     const auto rightNodeOffset = region.rightNodeOffset;
     const auto leftCSROffset = oldHeader.getStartCSROffset(leftNodeOffset);
@@ -202,8 +211,8 @@ void ChunkedCSRHeader::populateEndCSROffsets(const offset_vec_t& gaps) const {
     offset->mapValues<offset_t>([&](offset_t& offset, auto i) { offset = gaps[i]; });
 }
 
-length_t ChunkedCSRHeader::computeGapFromLength(length_t length) {
-    return StorageUtils::divideAndRoundUpTo(length, StorageConstants::PACKED_CSR_DENSITY) - length;
+length_t ChunkedCSRHeader::computeGapFromLength(length_t length, double packedDensity) {
+    return StorageUtils::divideAndRoundUpTo(length, packedDensity) - length;
 }
 
 std::unique_ptr<ChunkedNodeGroup> InMemChunkedCSRNodeGroup::flush(
@@ -225,6 +234,7 @@ std::unique_ptr<ChunkedNodeGroup> InMemChunkedCSRNodeGroup::flush(
 
 void ChunkedCSRNodeGroup ::reclaimStorage(PageAllocator& pageAllocator) const {
     ChunkedNodeGroup::reclaimStorage(pageAllocator);
+    pageAllocator.setChunkColumnID(INVALID_COLUMN_ID);
     if (csrHeader.offset) {
         csrHeader.offset->reclaimStorage(pageAllocator);
     }
@@ -380,7 +390,8 @@ void InMemChunkedCSRHeader::copyFrom(const InMemChunkedCSRHeader& other) const {
     }
 }
 
-offset_vec_t InMemChunkedCSRHeader::populateStartCSROffsetsFromLength(bool leaveGaps) const {
+offset_vec_t InMemChunkedCSRHeader::populateStartCSROffsetsFromLength(bool leaveGaps,
+    double packedDensity) const {
     const auto numNodes = length->getNumValues();
     const auto numLeafRegions = getNumRegions();
     offset_t leftCSROffset = 0;
@@ -398,7 +409,7 @@ offset_vec_t InMemChunkedCSRHeader::populateStartCSROffsetsFromLength(bool leave
         // Update lastLeftCSROffset for next region.
         leftCSROffset += numRelsInRegion;
         if (leaveGaps) {
-            leftCSROffset += computeGapFromLength(numRelsInRegion);
+            leftCSROffset += computeGapFromLength(numRelsInRegion, packedDensity);
         }
         rightCSROffsetOfRegions.push_back(leftCSROffset);
     }
@@ -436,7 +447,7 @@ idx_t InMemChunkedCSRHeader::getNumRegions() const {
 
 void InMemChunkedCSRHeader::populateRegionCSROffsets(const CSRRegion& region,
     const InMemChunkedCSRHeader& oldHeader) const {
-    KU_ASSERT(region.level <= CSRNodeGroup::DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight);
+    KU_ASSERT(region.level <= PackedCSRInfo::CALIBRATOR_TREE_HEIGHT);
     const auto leftNodeOffset = region.leftNodeOffset;
     const auto rightNodeOffset = region.rightNodeOffset;
     const auto leftCSROffset = oldHeader.getStartCSROffset(leftNodeOffset);
@@ -462,8 +473,8 @@ void InMemChunkedCSRHeader::populateEndCSROffsets(const offset_vec_t& gaps) cons
     }
 }
 
-length_t InMemChunkedCSRHeader::computeGapFromLength(length_t length) {
-    return StorageUtils::divideAndRoundUpTo(length, StorageConstants::PACKED_CSR_DENSITY) - length;
+length_t InMemChunkedCSRHeader::computeGapFromLength(length_t length, double packedDensity) {
+    return StorageUtils::divideAndRoundUpTo(length, packedDensity) - length;
 }
 
 } // namespace storage
@@ -1,7 +1,11 @@
 #include "storage/table/csr_node_group.h"
 
 #include "common/constants.h"
+#include "common/serializer/deserializer.h"
+#include "common/serializer/serializer.h"
+#include "common/type_utils.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/predicate/constant_predicate.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column_chunk_data.h"
 #include "storage/table/csr_chunked_node_group.h"
@@ -15,6 +19,45 @@ using namespace ryu::transaction;
 namespace ryu {
 namespace storage {
 
+double PackedCSRInfo::getHighDensity(uint64_t level) {
+    KU_ASSERT(level <= CALIBRATOR_TREE_HEIGHT);
+    if (level == 0) {
+        return StorageConstants::LEAF_HIGH_CSR_DENSITY;
+    }
+    return StorageConstants::PACKED_CSR_DENSITY +
+           HIGH_DENSITY_STEP * static_cast<double>(CALIBRATOR_TREE_HEIGHT - level);
+}
+
+void PackedCSRInfo::recordCheckpoint(bool needRedistribution) {
+    if (!needRedistribution) {
+        numCheckpointsSinceRedistribution++;
+        return;
+    }
+    if (numCheckpointsSinceRedistribution < FREQUENT_REDISTRIBUTION_THRESHOLD) {
+        packedDensity = std::max(MIN_PACKED_DENSITY, packedDensity - PACKED_DENSITY_STEP);
+    } else if (numCheckpointsSinceRedistribution >= RARE_REDISTRIBUTION_THRESHOLD) {
+        packedDensity = std::min(MAX_PACKED_DENSITY, packedDensity + PACKED_DENSITY_STEP);
+    }
+    numCheckpointsSinceRedistribution = 0;
+}
+
+void PackedCSRInfo::serialize(Serializer& serializer) const {
+    serializer.writeDebuggingInfo("packed_density");
+    serializer.write<double>(packedDensity);
+    serializer.writeDebuggingInfo("num_checkpoints_since_redistribution");
+    serializer.write<uint64_t>(numCheckpointsSinceRedistribution);
+}
+
+PackedCSRInfo PackedCSRInfo::deserialize(Deserializer& deSer) {
+    std::string key;
+    PackedCSRInfo info;
+    deSer.validateDebuggingInfo(key, "packed_density");
+    deSer.deserializeValue<double>(info.packedDensity);
+    deSer.validateDebuggingInfo(key, "num_checkpoints_since_redistribution");
+    deSer.deserializeValue<uint64_t>(info.numCheckpointsSinceRedistribution);
+    return info;
+}
+
 bool CSRNodeGroupScanState::tryScanCachedTuples(RelTableScanState& tableScanState) {
     if (numCachedRows == 0 ||
         tableScanState.currBoundNodeIdx >= tableScanState.cachedBoundNodeSelVector.getSelSize()) {
@@ -63,6 +106,8 @@ void CSRNodeGroup::initializeScanState(const Transaction* transaction,
     auto& relScanState = state.cast<RelTableScanState>();
     KU_ASSERT(relScanState.nodeGroupScanState);
     auto& nodeGroupScanState = relScanState.nodeGroupScanState->cast<CSRNodeGroupScanState>();
+    // Zone maps are checked again for the new bound nodes, as the group may have been updated.
+    nodeGroupScanState.zoneMapCheckedGroup = nullptr;
     if (relScanState.nodeGroupIdx != nodeGroupIdx || relScanState.randomLookup) {
         relScanState.nodeGroupIdx = nodeGroupIdx;
         if (persistentChunkGroup) {
@@ -74,6 +119,7 @@ void CSRNodeGroup::initializeScanState(const Transaction* transaction,
         nodeGroupScanState.nextRowToScan = 0;
         nodeGroupScanState.numCachedRows = 0;
         nodeGroupScanState.nextCachedRowToScan = 0;
+        nodeGroupScanState.csrListEndRow = INVALID_ROW_IDX;
         nodeGroupScanState.source = CSRNodeGroupScanSource::COMMITTED_PERSISTENT;
     } else if (csrIndex) {
         initScanForCommittedInMem(relScanState, nodeGroupScanState);
@@ -178,6 +224,30 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedPersistent(const Transaction* tra
     return scanCommittedPersistentWithCache(transaction, tableState, nodeGroupScanState);
 }
 
+// Returns the number of rows to cache from startRow on. The cache window stops at the end of the
+// last csr list of a bound node it overlaps, so columns are not read for the rows of unselected
+// nodes that follow, which matters most for rel tables with many property columns.
+static row_idx_t getNumRowsToCache(const RelTableScanState& tableState,
+    const InMemChunkedCSRHeader& header, row_idx_t startRow, row_idx_t numTotalRows) {
+    const auto windowEndRow = std::min(numTotalRows, startRow + DEFAULT_VECTOR_CAPACITY);
+    auto endRow = startRow + 1;
+    for (auto i = tableState.currBoundNodeIdx; i < tableState.cachedBoundNodeSelVector.getSelSize();
+         i++) {
+        const auto nodeOffset =
+            tableState.nodeIDVector->readNodeOffset(tableState.cachedBoundNodeSelVector[i]);
+        const auto offsetInGroup = nodeOffset % StorageConfig::NODE_GROUP_SIZE;
+        const auto startCSROffset = header.getStartCSROffset(offsetInGroup);
+        if (startCSROffset >= windowEndRow) {
+            break;
+        }
+        endRow = std::max(endRow, startCSROffset + header.getCSRLength(offsetInGroup));
+        if (endRow >= windowEndRow) {
+            break;
+        }
+    }
+    return std::min(endRow, windowEndRow) - startRow;
+}
+
 NodeGroupScanResult CSRNodeGroup::scanCommittedPersistentWithCache(const Transaction* transaction,
     RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const {
     while (true) {
@@ -200,9 +270,8 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedPersistentWithCache(const Transac
             nodeGroupScanState.nextRowToScan = startCSROffset;
         }
         KU_ASSERT(nodeGroupScanState.nextRowToScan <= nodeGroupScanState.numTotalRows);
-        const auto numToScan =
-            std::min(nodeGroupScanState.numTotalRows - nodeGroupScanState.nextRowToScan,
-                DEFAULT_VECTOR_CAPACITY);
+        const auto numToScan = getNumRowsToCache(tableState, *nodeGroupScanState.header,
+            nodeGroupScanState.nextRowToScan, nodeGroupScanState.numTotalRows);
         persistentChunkGroup->scan(transaction, tableState, nodeGroupScanState,
             nodeGroupScanState.nextRowToScan, numToScan);
         nodeGroupScanState.numCachedRows = numToScan;
@@ -227,13 +296,21 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedPersistentWithoutCache(
         tableState.cachedBoundNodeSelVector[tableState.currBoundNodeIdx]);
     const auto offsetInGroup = currNodeOffset % StorageConfig::NODE_GROUP_SIZE;
     const auto csrListLength = nodeGroupScanState.header->getCSRLength(offsetInGroup);
-    if (nodeGroupScanState.nextRowToScan == csrListLength) {
+    const auto csrListStartRow = nodeGroupScanState.header->getStartCSROffset(offsetInGroup);
+    if (nodeGroupScanState.csrListEndRow == INVALID_ROW_IDX) {
+        nodeGroupScanState.csrListEndRow = csrListLength;
+        if (tableState.sortKeyColumnIdx != INVALID_IDX && csrListLength > 0) {
+            narrowScanBySortKey(transaction, tableState, nodeGroupScanState, csrListStartRow,
+                csrListLength);
+        }
+    }
+    if (nodeGroupScanState.nextRowToScan >= nodeGroupScanState.csrListEndRow) {
         return NODE_GROUP_SCAN_EMPTY_RESULT;
     }
-    const auto startRow = nodeGroupScanState.header->getStartCSROffset(offsetInGroup) +
-                          nodeGroupScanState.nextRowToScan;
-    const auto numToScan =
-        std::min(csrListLength - nodeGroupScanState.nextRowToScan, DEFAULT_VECTOR_CAPACITY);
+    const auto startRow = csrListStartRow + nodeGroupScanState.nextRowToScan;
+    const auto numToScan = std::min(
+        nodeGroupScanState.csrListEndRow - nodeGroupScanState.nextRowToScan,
+        DEFAULT_VECTOR_CAPACITY);
     persistentChunkGroup->scan(transaction, tableState, nodeGroupScanState, startRow, numToScan);
     nodeGroupScanState.nextRowToScan += numToScan;
     tableState.setNodeIDVectorToFlat(
@@ -241,6 +318,104 @@ NodeGroupScanResult CSRNodeGroup::scanCommittedPersistentWithoutCache(
     return NodeGroupScanResult{startRow, numToScan};
 }
 
+template<CSRSortKey T>
+static bool isBeforeSortKeyRange(const CSRSortKeyValue<T>& key,
+    const std::vector<const ColumnConstantPredicate*>& predicates) {
+    if (key.isNull) {
+        return false;
+    }
+    for (const auto predicate : predicates) {
+        const auto bound = predicate->getValue().getValue<T>();
+        switch (predicate->getExpressionType()) {
+        case ExpressionType::EQUALS:
+        case ExpressionType::GREATER_THAN_EQUALS: {
+            if (key.value < bound) {
+                return true;
+            }
+        } break;
+        case ExpressionType::GREATER_THAN: {
+            if (key.value <= bound) {
+                return true;
+            }
+        } break;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
+template<CSRSortKey T>
+static bool isAfterSortKeyRange(const CSRSortKeyValue<T>& key,
+    const std::vector<const ColumnConstantPredicate*>& predicates) {
+    // Nulls are sorted last and never satisfy a predicate.
+    if (key.isNull) {
+        return true;
+    }
+    for (const auto predicate : predicates) {
+        const auto bound = predicate->getValue().getValue<T>();
+        switch (predicate->getExpressionType()) {
+        case ExpressionType::EQUALS:
+        case ExpressionType::LESS_THAN_EQUALS: {
+            if (key.value > bound) {
+                return true;
+            }
+        } break;
+        case ExpressionType::LESS_THAN: {
+            if (key.value >= bound) {
+                return true;
+            }
+        } break;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
+void CSRNodeGroup::narrowScanBySortKey(const Transaction* transaction,
+    const RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState,
+    row_idx_t startRow, length_t csrListLength) const {
+    const auto columnIdx = tableState.sortKeyColumnIdx;
+    const auto& keyChunk = persistentChunkGroup->getColumnChunk(tableState.columnIDs[columnIdx]);
+    const auto& chunkState = nodeGroupScanState.chunkStates[columnIdx];
+    const auto& keyType = tableState.columns[columnIdx]->getDataType();
+    ValueVector keyVector{keyType.copy(), &mm};
+    keyVector.setState(DataChunkState::getSingleValueDataChunkState());
+    TypeUtils::visit(
+        keyType.getPhysicalType(),
+        [&]<CSRSortKey T>(T) {
+            const auto readKey = [&](row_idx_t rowInList) {
+                keyChunk.lookup(transaction, chunkState, startRow + rowInList, keyVector, 0);
+                if (keyVector.isNull(0)) {
+                    return CSRSortKeyValue<T>{};
+                }
+                return CSRSortKeyValue<T>{false, keyVector.getValue<T>(0)};
+            };
+            // Returns the first row in [low, high) for which pred doesn't hold, given that pred
+            // holds for a prefix of the rows.
+            const auto partitionPoint = [&](row_idx_t low, row_idx_t high, auto pred) {
+                while (low < high) {
+                    const auto mid = low + (high - low) / 2;
+                    if (pred(readKey(mid))) {
+                        low = mid + 1;
+                    } else {
+                        high = mid;
+                    }
+                }
+                return low;
+            };
+            const auto& predicates = tableState.sortKeyPredicates;
+            const auto beginRow = partitionPoint(0, csrListLength,
+                [&](const auto& key) { return isBeforeSortKeyRange<T>(key, predicates); });
+            const auto endRow = partitionPoint(beginRow, csrListLength,
+                [&](const auto& key) { return !isAfterSortKeyRange<T>(key, predicates); });
+            nodeGroupScanState.nextRowToScan = beginRow;
+            nodeGroupScanState.csrListEndRow = endRow;
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
 NodeGroupScanResult CSRNodeGroup::scanCommittedInMem(const Transaction* transaction,
     RelTableScanState& tableState, CSRNodeGroupScanState& nodeGroupScanState) const {
     while (true) {
@@ -461,6 +636,10 @@ void CSRNodeGroup::serialize(Serializer& serializer) {
     if (persistentChunkGroup) {
         serializer.writeDebuggingInfo("checkpointed_data");
         persistentChunkGroup->serialize(serializer);
+        serializer.writeDebuggingInfo("packed_csr_info");
+        packedCSRInfo.serialize(serializer);
+        serializer.writeDebuggingInfo("degree_stats");
+        degreeStats.serialize(serializer);
     }
 }
 
@@ -481,6 +660,13 @@ void CSRNodeGroup::reclaimStorage(PageAllocator& pageAllocator, const UniqLock&
     }
 }
 
+void CSRNodeGroup::vacuumUpdates(transaction_t oldestActiveTS, const UniqLock& lock) const {
+    NodeGroup::vacuumUpdates(oldestActiveTS, lock);
+    if (persistentChunkGroup) {
+        persistentChunkGroup->vacuumUpdates(oldestActiveTS);
+    }
+}
+
 static std::unique_ptr<ChunkedCSRNodeGroup> createNewPersistentChunkGroup(
     ChunkedCSRNodeGroup& oldPersistentChunkGroup, CSRNodeGroupCheckpointState& csrState) {
     auto newGroup =
@@ -517,10 +703,13 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
         }
         return;
     }
-    if (regionsToCheckpoint.size() == 1 &&
-        regionsToCheckpoint[0].level > DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight) {
+    const auto needRedistribution =
+        regionsToCheckpoint.size() == 1 &&
+        regionsToCheckpoint[0].level > PackedCSRInfo::CALIBRATOR_TREE_HEIGHT;
+    packedCSRInfo.recordCheckpoint(needRedistribution);
+    if (needRedistribution) {
         // Need to re-distribute all CSR regions in the node group.
-        redistributeCSRRegions(csrState, leafRegions);
+        redistributeCSRRegions(csrState, leafRegions, packedCSRInfo.packedDensity);
     } else {
         for (auto& region : regionsToCheckpoint) {
             csrState.newHeader->populateRegionCSROffsets(region, *csrState.oldHeader);
@@ -540,14 +729,21 @@ void CSRNodeGroup::checkpointInMemAndOnDisk(const UniqLock& lock, NodeGroupCheck
     if (numTuplesAfterCheckpoint == 0) {
         reclaimStorage(csrState.pageAllocator, lock);
         persistentChunkGroup = nullptr;
+        degreeStats = DegreeStats{};
     } else {
         KU_ASSERT(csrState.newHeader->sanityCheck());
+        csr_sorted_merges_t sortedMerges;
+        if (csrState.sortColumnID != INVALID_COLUMN_ID && csrIndex) {
+            sortInMemCSRLists(lock, csrState);
+            sortedMerges = planSortedMerges(lock, csrState, regionsToCheckpoint);
+        }
         for (const auto columnID : csrState.columnIDs) {
-            checkpointColumn(lock, columnID, csrState, regionsToCheckpoint);
+            checkpointColumn(lock, columnID, csrState, regionsToCheckpoint, sortedMerges);
         }
         checkpointCSRHeaderColumns(csrState);
         persistentChunkGroup = createNewPersistentChunkGroup(
             persistentChunkGroup->cast<ChunkedCSRNodeGroup>(), csrState);
+        degreeStats = csrState.newHeader->computeDegreeStats();
     }
     finalizeCheckpoint(lock);
 }
@@ -567,20 +763,21 @@ std::vector<CSRRegion> CSRNodeGroup::collectLeafRegionsAndCSRLength(const UniqLo
 }
 
 void CSRNodeGroup::redistributeCSRRegions(const CSRNodeGroupCheckpointState& csrState,
-    const std::vector<CSRRegion>& leafRegions) {
+    const std::vector<CSRRegion>& leafRegions, double packedDensity) {
     KU_ASSERT(std::is_sorted(leafRegions.begin(), leafRegions.end(),
         [](const auto& a, const auto& b) { return a.regionIdx < b.regionIdx; }));
     KU_ASSERT(std::all_of(leafRegions.begin(), leafRegions.end(),
         [](const CSRRegion& region) { return region.level == 0; }));
     KU_UNUSED(leafRegions);
     const auto rightCSROffsetOfRegions =
-        csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGaps */);
+        csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGaps */, packedDensity);
     csrState.newHeader->populateEndCSROffsetFromStartAndLength();
     csrState.newHeader->finalizeCSRRegionEndOffsets(rightCSROffsetOfRegions);
 }
 
 void CSRNodeGroup::checkpointColumn(const UniqLock& lock, column_id_t columnID,
-    const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions) const {
+    const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions,
+    const csr_sorted_merges_t& sortedMerges) const {
     std::vector<ChunkCheckpointState> chunkCheckpointStates;
     chunkCheckpointStates.reserve(regions.size());
     for (auto& region : regions) {
@@ -588,7 +785,8 @@ void CSRNodeGroup::checkpointColumn(const UniqLock& lock, column_id_t columnID,
             // Skip checkpoint for the column if it has no changes in the region.
             continue;
         }
-        auto regionCheckpointStates = checkpointColumnInRegion(lock, columnID, csrState, region);
+        auto regionCheckpointStates =
+            checkpointColumnInRegion(lock, columnID, csrState, region, sortedMerges);
         // If there are no rows to write for the region, we don't aggressively reclaim the space in
         // the region, but keep deleted rows as gaps. This can happen when all rows are deleted
         // within the region.
@@ -803,8 +1001,8 @@ static void fillCSRGaps(CheckpointReadCursor& readCursor, CheckpointWriteCursor&
 }
 
 std::vector<ChunkCheckpointState> CSRNodeGroup::checkpointColumnInRegion(const UniqLock& lock,
-    column_id_t columnID, const CSRNodeGroupCheckpointState& csrState,
-    const CSRRegion& region) const {
+    column_id_t columnID, const CSRNodeGroupCheckpointState& csrState, const CSRRegion& region,
+    const csr_sorted_merges_t& sortedMerges) const {
     const auto leftCSROffset = csrState.oldHeader->getStartCSROffset(region.leftNodeOffset);
     KU_ASSERT(leftCSROffset == csrState.newHeader->getStartCSROffset(region.leftNodeOffset));
     const auto rightCSROffset = csrState.oldHeader->getEndCSROffset(region.rightNodeOffset);
@@ -824,6 +1022,12 @@ std::vector<ChunkCheckpointState> CSRNodeGroup::checkpointColumnInRegion(const U
 
     CheckpointReadCursor readCursor{oldChunkScanner, leftCSROffset};
     CheckpointWriteCursor writeCursor{leftCSROffset, *csrState.mm, column->getDataType(), ret};
+    const auto writeInMemRow = [&](row_idx_t row) {
+        auto [chunkIdx, rowInChunk] =
+            StorageUtils::getQuotientRemainder(row, StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+        writeInMemoryCSRInsertion(writeCursor, *chunkedGroups.getGroup(lock, chunkIdx),
+            rowInChunk, columnID, chunkState);
+    };
 
     // Copy per csr list from old chunk and merge with new insertions into the newChunkData.
     for (auto nodeOffset = region.leftNodeOffset; nodeOffset <= region.rightNodeOffset;
@@ -833,27 +1037,39 @@ std::vector<ChunkCheckpointState> CSRNodeGroup::checkpointColumnInRegion(const U
         KU_ASSERT(csrState.newHeader->getStartCSROffset(nodeOffset) == writeCursor.getCSROffset());
         KU_ASSERT(csrState.oldHeader->getStartCSROffset(nodeOffset) == readCursor.getCSROffset());
 
-        // Copy old csr list with updates into the new chunk.
-        if (!region.hasPersistentDeletions) {
-            writeCSRListNoPersistentDeletions(readCursor, writeCursor, oldCSRLength);
+        if (const auto sortedMerge = sortedMerges.find(nodeOffset);
+            sortedMerge != sortedMerges.end()) {
+            // Interleave the old csr list with the in-memory insertions in sort key order.
+            const auto rows = csrIndex->indices[nodeOffset].getRows();
+            auto nextInMemRow = 0u;
+            for (const auto fromPersistent : sortedMerge->second) {
+                if (fromPersistent) {
+                    writeCSRListWithPersistentDeletions(readCursor, writeCursor, 1,
+                        *persistentChunkGroup);
+                } else {
+                    writeInMemRow(rows[nextInMemRow++]);
+                }
+            }
+            KU_ASSERT(nextInMemRow == rows.size());
         } else {
-            writeCSRListWithPersistentDeletions(readCursor, writeCursor, oldCSRLength,
-                *persistentChunkGroup);
-        }
-        // Merge in-memory insertions into the new chunk.
-        if (csrIndex) {
-            auto rows = csrIndex->indices[nodeOffset].getRows();
-            // TODO(Guodong): Optimize here. if no deletions and has sequential rows, scan in
-            // range.
-            for (const auto row : rows) {
-                if (row == INVALID_ROW_IDX) {
-                    continue;
+            // Copy old csr list with updates into the new chunk.
+            if (!region.hasPersistentDeletions) {
+                writeCSRListNoPersistentDeletions(readCursor, writeCursor, oldCSRLength);
+            } else {
+                writeCSRListWithPersistentDeletions(readCursor, writeCursor, oldCSRLength,
+                    *persistentChunkGroup);
+            }
+            // Merge in-memory insertions into the new chunk.
+            if (csrIndex) {
+                auto rows = csrIndex->indices[nodeOffset].getRows();
+                // TODO(Guodong): Optimize here. if no deletions and has sequential rows, scan in
+                // range.
+                for (const auto row : rows) {
+                    if (row == INVALID_ROW_IDX) {
+                        continue;
+                    }
+                    writeInMemRow(row);
                 }
-                auto [chunkIdx, rowInChunk] = StorageUtils::getQuotientRemainder(row,
-                    StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
-                const auto chunkedGroup = chunkedGroups.getGroup(lock, chunkIdx);
-                writeInMemoryCSRInsertion(writeCursor, *chunkedGroup, rowInChunk, columnID,
-                    chunkState);
             }
         }
 
@@ -1002,10 +1218,15 @@ void CSRNodeGroup::checkpointInMemOnly(const UniqLock& lock, NodeGroupCheckpoint
     const auto numNodes = csrIndex->getMaxOffsetWithRels() + 1;
     csrState.newHeader->setNumValues(numNodes);
     populateCSRLengthInMemOnly(lock, numNodes, csrState);
+    if (csrState.sortColumnID != INVALID_COLUMN_ID) {
+        sortInMemCSRLists(lock, csrState);
+    }
     const auto rightCSROffsetsOfRegions =
-        csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGap */);
+        csrState.newHeader->populateStartCSROffsetsFromLength(true /* leaveGap */,
+            packedCSRInfo.packedDensity);
     csrState.newHeader->populateEndCSROffsetFromStartAndLength();
     csrState.newHeader->finalizeCSRRegionEndOffsets(rightCSROffsetsOfRegions);
+    degreeStats = csrState.newHeader->computeDegreeStats();
 
     // Init scan chunk and scan state.
     const auto numColumnsToCheckpoint = csrState.columnIDs.size();
@@ -1125,6 +1346,123 @@ void CSRNodeGroup::populateCSRLengthInMemOnly(const UniqLock& lock, offset_t num
     }
 }
 
+void CSRNodeGroup::sortInMemCSRLists(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState) const {
+    KU_ASSERT(csrState.sortColumnID != INVALID_COLUMN_ID && csrIndex);
+    const auto sortColumnID = csrState.sortColumnID;
+    const auto keyChunk = ColumnChunkFactory::createColumnChunkData(*csrState.mm,
+        dataTypes[sortColumnID].copy(), false, 1, ResidencyState::IN_MEMORY);
+    TypeUtils::visit(
+        dataTypes[sortColumnID].getPhysicalType(),
+        [&]<CSRSortKey T>(T) {
+            std::vector<std::pair<CSRSortKeyValue<T>, row_idx_t>> keyedRows;
+            for (auto& index : csrIndex->indices) {
+                if (index.isEmpty()) {
+                    continue;
+                }
+                keyedRows.clear();
+                for (const auto row : index.getRows()) {
+                    if (row == INVALID_ROW_IDX) {
+                        continue;
+                    }
+                    auto [chunkIdx, rowInChunk] = StorageUtils::getQuotientRemainder(row,
+                        StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+                    ChunkState chunkState;
+                    keyChunk->resetToEmpty();
+                    chunkedGroups.getGroup(lock, chunkIdx)
+                        ->getColumnChunk(sortColumnID)
+                        .scanCommitted<ResidencyState::IN_MEMORY>(&DUMMY_CHECKPOINT_TRANSACTION,
+                            chunkState, *keyChunk, rowInChunk, 1);
+                    keyedRows.emplace_back(CSRSortKeyValue<T>::read(*keyChunk, 0), row);
+                }
+                // Stable so that rels with equal keys keep the order in which they were inserted.
+                std::stable_sort(keyedRows.begin(), keyedRows.end(),
+                    [](const auto& a, const auto& b) { return a.first < b.first; });
+                index.isSequential = false;
+                index.rowIndices.clear();
+                for (const auto& [key, row] : keyedRows) {
+                    index.rowIndices.push_back(row);
+                }
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+}
+
+csr_sorted_merges_t CSRNodeGroup::planSortedMerges(const UniqLock& lock,
+    const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& regions) const {
+    KU_ASSERT(csrState.sortColumnID != INVALID_COLUMN_ID && csrIndex);
+    csr_sorted_merges_t sortedMerges;
+    const auto sortColumnID = csrState.sortColumnID;
+    const auto& persistentChunk = persistentChunkGroup->getColumnChunk(sortColumnID);
+    const auto keyChunk = ColumnChunkFactory::createColumnChunkData(*csrState.mm,
+        dataTypes[sortColumnID].copy(), false, 1, ResidencyState::IN_MEMORY);
+    TypeUtils::visit(
+        dataTypes[sortColumnID].getPhysicalType(),
+        [&]<CSRSortKey T>(T) {
+            const auto readInMemKey = [&](row_idx_t row) {
+                auto [chunkIdx, rowInChunk] = StorageUtils::getQuotientRemainder(row,
+                    StorageConfig::CHUNKED_NODE_GROUP_CAPACITY);
+                ChunkState chunkState;
+                keyChunk->resetToEmpty();
+                chunkedGroups.getGroup(lock, chunkIdx)
+                    ->getColumnChunk(sortColumnID)
+                    .scanCommitted<ResidencyState::IN_MEMORY>(&DUMMY_CHECKPOINT_TRANSACTION,
+                        chunkState, *keyChunk, rowInChunk, 1);
+                return CSRSortKeyValue<T>::read(*keyChunk, 0);
+            };
+            for (auto& region : regions) {
+                if (!region.hasInsertions) {
+                    continue;
+                }
+                const auto leftCSROffset =
+                    csrState.oldHeader->getStartCSROffset(region.leftNodeOffset);
+                const auto numOldRowsInRegion =
+                    csrState.oldHeader->getEndCSROffset(region.rightNodeOffset) - leftCSROffset;
+                // Old keys of the region are only scanned once a list needs to be merged.
+                std::unique_ptr<ColumnChunkData> oldKeys;
+                for (auto nodeOffset = region.leftNodeOffset; nodeOffset <= region.rightNodeOffset;
+                     nodeOffset++) {
+                    const auto oldCSRLength = csrState.oldHeader->getCSRLength(nodeOffset);
+                    const auto rows = csrIndex->indices[nodeOffset].getRows();
+                    if (rows.empty() || oldCSRLength == 0) {
+                        // In-memory insertions can simply be appended to the old csr list.
+                        continue;
+                    }
+                    if (!oldKeys) {
+                        oldKeys = ColumnChunkFactory::createColumnChunkData(*csrState.mm,
+                            dataTypes[sortColumnID].copy(), false, numOldRowsInRegion,
+                            ResidencyState::IN_MEMORY);
+                        ChunkState chunkState;
+                        persistentChunk.initializeScanState(chunkState,
+                            csrState.columns[sortColumnID]);
+                        persistentChunk.scanCommitted<ResidencyState::ON_DISK>(
+                            &DUMMY_CHECKPOINT_TRANSACTION, chunkState, *oldKeys, leftCSROffset,
+                            numOldRowsInRegion);
+                    }
+                    const auto oldStartRow =
+                        csrState.oldHeader->getStartCSROffset(nodeOffset) - leftCSROffset;
+                    auto& sortedMerge = sortedMerges[nodeOffset];
+                    sortedMerge.reserve(oldCSRLength + rows.size());
+                    length_t numOldRowsMerged = 0;
+                    for (const auto row : rows) {
+                        const auto key = readInMemKey(row);
+                        // Old rows go first on equal keys, as they were inserted earlier.
+                        while (numOldRowsMerged < oldCSRLength &&
+                               !(key < CSRSortKeyValue<T>::read(*oldKeys,
+                                          oldStartRow + numOldRowsMerged))) {
+                            sortedMerge.push_back(true);
+                            numOldRowsMerged++;
+                        }
+                        sortedMerge.push_back(false);
+                    }
+                    sortedMerge.resize(sortedMerge.size() + oldCSRLength - numOldRowsMerged, true);
+                }
+            }
+        },
+        [](auto) { KU_UNREACHABLE; });
+    return sortedMerges;
+}
+
 std::vector<CSRRegion> CSRNodeGroup::mergeRegionsToCheckpoint(
     const CSRNodeGroupCheckpointState& csrState, const std::vector<CSRRegion>& leafRegions) {
     KU_ASSERT(std::all_of(leafRegions.begin(), leafRegions.end(),
@@ -1144,7 +1482,7 @@ std::vector<CSRRegion> CSRNodeGroup::mergeRegionsToCheckpoint(
         }
         while (!isWithinDensityBound(*csrState.oldHeader, leafRegions, region)) {
             region = CSRRegion::upgradeLevel(leafRegions, region);
-            if (region.level > DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight) {
+            if (region.level > PackedCSRInfo::CALIBRATOR_TREE_HEIGHT) {
                 // Hit the top level already. Need to re-distribute.
                 return {region};
             }
@@ -1163,17 +1501,6 @@ std::vector<CSRRegion> CSRNodeGroup::mergeRegionsToCheckpoint(
     return mergedRegions;
 }
 
-static double getHighDensity(uint64_t level) {
-    KU_ASSERT(level <= CSRNodeGroup::DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight);
-    if (level == 0) {
-        return StorageConstants::LEAF_HIGH_CSR_DENSITY;
-    }
-    return StorageConstants::PACKED_CSR_DENSITY +
-           CSRNodeGroup::DEFAULT_PACKED_CSR_INFO.highDensityStep *
-               static_cast<double>(
-                   CSRNodeGroup::DEFAULT_PACKED_CSR_INFO.calibratorTreeHeight - level);
-}
-
 bool CSRNodeGroup::isWithinDensityBound(const InMemChunkedCSRHeader& header,
     const std::vector<CSRRegion>& leafRegions, const CSRRegion& region) {
     int64_t oldSize = 0;
@@ -1191,7 +1518,7 @@ bool CSRNodeGroup::isWithinDensityBound(const InMemChunkedCSRHeader& header,
     const auto capacity = header.getEndCSROffset(region.rightNodeOffset) -
                           header.getStartCSROffset(region.leftNodeOffset);
     const double ratio = static_cast<double>(newSize) / static_cast<double>(capacity);
-    return ratio <= getHighDensity(region.level);
+    return ratio <= PackedCSRInfo::getHighDensity(region.level);
 }
 
 void CSRNodeGroup::finalizeCheckpoint(const UniqLock& lock) {
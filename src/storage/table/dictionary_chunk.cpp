@@ -3,6 +3,7 @@
 #include "common/constants.h"
 #include "common/serializer/deserializer.h"
 #include "common/serializer/serializer.h"
+#include "common/utils.h"
 #include "storage/enums/residency_state.h"
 #include <bit>
 
@@ -101,10 +102,66 @@ uint64_t DictionaryChunk::getEstimatedMemoryUsage() const {
 }
 
 void DictionaryChunk::flush(PageAllocator& pageAllocator) {
-    stringDataChunk->flush(pageAllocator);
+    if (auto compressed = compressStringData()) {
+        // The index table hashes the decoded strings and is only needed for appending
+        indexTable.clear();
+        stringDataChunk = std::move(compressed->stringDataChunk);
+        offsetChunk = std::move(compressed->offsetChunk);
+        stringDataChunk->flush(pageAllocator);
+        compressed->setStringDataCompression(stringDataChunk->getMetadata());
+    } else {
+        stringDataChunk->flush(pageAllocator);
+    }
     offsetChunk->flush(pageAllocator);
 }
 
+std::unique_ptr<DictionaryChunk> DictionaryChunk::compressStringData() const {
+    const auto numStrings = offsetChunk->getNumValues();
+    const auto dataSize = stringDataChunk->getNumValues();
+    // Data smaller than a page would take a full page either way
+    if (!enableCompression || symbolTable || numStrings == 0 || dataSize <= RYU_PAGE_SIZE) {
+        return nullptr;
+    }
+    std::vector<std::string_view> strings;
+    strings.reserve(numStrings);
+    for (string_index_t i = 0; i < numStrings; i++) {
+        strings.push_back(getString(i));
+    }
+    auto table = FSSTSymbolTable::build(strings);
+    std::vector<uint8_t> encodedData;
+    encodedData.reserve(dataSize);
+    std::vector<string_offset_t> encodedOffsets(numStrings);
+    for (string_index_t i = 0; i < numStrings; i++) {
+        encodedOffsets[i] = encodedData.size();
+        table.encode(strings[i], encodedData);
+    }
+    const auto getNumPages = [](uint64_t size) { return ceilDiv<uint64_t>(size, RYU_PAGE_SIZE); };
+    if (getNumPages(encodedData.size()) >= getNumPages(dataSize)) {
+        return nullptr;
+    }
+    auto compressed = std::make_unique<DictionaryChunk>(stringDataChunk->getMemoryManager(),
+        numStrings, enableCompression, ResidencyState::IN_MEMORY);
+    compressed->stringDataChunk->resize(encodedData.size());
+    memcpy(compressed->stringDataChunk->getData(), encodedData.data(), encodedData.size());
+    compressed->stringDataChunk->setNumValues(encodedData.size());
+    compressed->offsetChunk->resize(numStrings);
+    for (string_index_t i = 0; i < numStrings; i++) {
+        compressed->offsetChunk->setValue<string_offset_t>(encodedOffsets[i], i);
+    }
+    compressed->symbolTable = std::move(table);
+    return compressed;
+}
+
+void DictionaryChunk::setStringDataCompression(ColumnChunkMetadata& stringDataMetadata) const {
+    if (!symbolTable) {
+        return;
+    }
+    auto& compMeta = stringDataMetadata.compMeta;
+    KU_ASSERT(compMeta.compression == CompressionType::UNCOMPRESSED);
+    compMeta.compression = CompressionType::FSST;
+    compMeta.extraMetadata = std::make_unique<FSSTMetadata>(*symbolTable);
+}
+
 void DictionaryChunk::serialize(Serializer& serializer) const {
     serializer.writeDebuggingInfo("offset_chunk");
     offsetChunk->serialize(serializer);
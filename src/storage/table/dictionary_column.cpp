@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <vector>
 
 #include "common/types/ku_string.h"
 #include "common/types/types.h"
@@ -40,16 +41,23 @@ void DictionaryColumn::scan(const SegmentState& state, DictionaryChunk& dictChun
     auto initialDictSize = offsetChunk->getNumValues();
     auto initialDictDataSize = stringDataChunk->getNumValues();
 
-    auto& dataMetadata =
-        StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA).metadata;
+    auto& dataState = StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA);
+    auto& dataMetadata = dataState.metadata;
+    std::vector<uint8_t> encodedData;
+    uint64_t dataSize = dataMetadata.numValues;
+    if (isEncoded(dataState)) {
+        encodedData.resize(dataMetadata.numValues);
+        dataColumn->scanSegment(dataState, 0, dataMetadata.numValues, encodedData.data());
+        dataSize = getSymbolTable(dataState).getDecodedLength(encodedData.data(),
+            encodedData.size());
+    }
     // Make sure that the chunk is large enough
-    if (stringDataChunk->getNumValues() + dataMetadata.numValues > stringDataChunk->getCapacity()) {
-        stringDataChunk->resize(
-            std::bit_ceil(stringDataChunk->getNumValues() + dataMetadata.numValues));
+    if (stringDataChunk->getNumValues() + dataSize > stringDataChunk->getCapacity()) {
+        stringDataChunk->resize(std::bit_ceil(stringDataChunk->getNumValues() + dataSize));
+    }
+    if (!isEncoded(dataState)) {
+        dataColumn->scanSegment(dataState, stringDataChunk, 0, dataMetadata.numValues);
     }
-    dataColumn->scanSegment(StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA),
-        stringDataChunk, 0,
-        StringColumn::getChildState(state, StringColumn::ChildStateIndex::DATA).metadata.numValues);
 
     auto& offsetMetadata =
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET).metadata;
@@ -61,6 +69,24 @@ void DictionaryColumn::scan(const SegmentState& state, DictionaryChunk& dictChun
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET), offsetChunk, 0,
         StringColumn::getChildState(state, StringColumn::ChildStateIndex::OFFSET)
             .metadata.numValues);
+    if (isEncoded(dataState)) {
+        // Decode each string after the existing data, replacing its offset into the encoded data
+        // with the offset of the decoded string
+        auto& symbolTable = getSymbolTable(dataState);
+        auto dst = stringDataChunk->getData<uint8_t>() + initialDictDataSize;
+        for (row_idx_t i = initialDictSize; i < offsetChunk->getNumValues(); i++) {
+            auto start = offsetChunk->getValue<string_offset_t>(i);
+            auto end = i + 1 < offsetChunk->getNumValues() ?
+                           offsetChunk->getValue<string_offset_t>(i + 1) :
+                           encodedData.size();
+            offsetChunk->setValue<string_offset_t>(
+                dst - stringDataChunk->getData<uint8_t>(), i);
+            symbolTable.decode(encodedData.data() + start, end - start, dst);
+            dst += symbolTable.getDecodedLength(encodedData.data() + start, end - start);
+        }
+        stringDataChunk->setNumValues(initialDictDataSize + dataSize);
+        return;
+    }
     // Each offset needs to be incremented by the initial size of the dictionary data chunk
     for (row_idx_t i = initialDictSize; i < offsetChunk->getNumValues(); i++) {
         offsetChunk->setValue<string_offset_t>(
@@ -87,11 +113,6 @@ void DictionaryColumn::scan(const SegmentState& offsetState, const SegmentState&
         firstOffsetToScan = min->first;
         lastOffsetToScan = max->first;
     }
-    // TODO(bmwinger): scan batches of adjacent values.
-    // Ideally we scan values together until we reach empty pages
-    // This would also let us use the same optimization for the data column,
-    // where the worst case for the current method is much worse
-
     // Note that the list will contain duplicates when indices are duplicated.
     // Each distinct value is scanned once, and re-used when writing to each output value
     auto numOffsetsToScan = lastOffsetToScan - firstOffsetToScan + 1;
@@ -100,29 +121,15 @@ void DictionaryColumn::scan(const SegmentState& offsetState, const SegmentState&
     scanOffsets(offsetState, offsets.data(), firstOffsetToScan, numOffsetsToScan,
         dataState.metadata.numValues);
 
-    if constexpr (std::same_as<Result, ColumnChunkData>) {
-        auto& offsetChunk = *result->getDictionaryChunk()->getOffsetChunk();
-        if (offsetChunk.getNumValues() + offsetsToScan.size() > offsetChunk.getCapacity()) {
-            offsetChunk.resize(std::bit_ceil(offsetChunk.getNumValues() + offsetsToScan.size()));
-        }
-    }
-
-    for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
-        auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
-        auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
-        auto lengthToScan = endOffset - startOffset;
-        KU_ASSERT(endOffset >= startOffset);
-        scanValue(dataState, startOffset, lengthToScan, result, offsetsToScan[pos].second);
-        // For each string which has the same index in the dictionary as the one we scanned,
-        // copy the scanned string to its position in the result vector
-        if constexpr (std::same_as<Result, ValueVector>) {
-            auto& scannedString = result->template getValue<ku_string_t>(offsetsToScan[pos].second);
-            while (pos + 1 < offsetsToScan.size() &&
-                   offsetsToScan[pos + 1].first == offsetsToScan[pos].first) {
-                pos++;
-                result->template setValue<ku_string_t>(offsetsToScan[pos].second, scannedString);
-            }
-        } else {
+    if constexpr (std::same_as<Result, ValueVector>) {
+        scanValues(dataState, offsets, firstOffsetToScan, offsetsToScan, result);
+    } else {
+        for (auto pos = 0u; pos < offsetsToScan.size(); pos++) {
+            auto startOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan];
+            auto endOffset = offsets[offsetsToScan[pos].first - firstOffsetToScan + 1];
+            auto lengthToScan = endOffset - startOffset;
+            KU_ASSERT(endOffset >= startOffset);
+            scanValue(dataState, startOffset, lengthToScan, result, offsetsToScan[pos].second);
             // When scanning to chunks de-duplication should be done prior to this function such
             // that you can have multiple positions in the string index chunk pointing to one string
             // in this dictionary chunk.
@@ -135,6 +142,50 @@ void DictionaryColumn::scan(const SegmentState& offsetState, const SegmentState&
     }
 }
 
+// The data of strings with adjacent indices in the dictionary is adjacent too, so runs of them are
+// read with a single scan of the data column, instead of a scan, with its page lookups, per string.
+// Runs are bounded so that the buffer stays small when strings are long.
+void DictionaryColumn::scanValues(const SegmentState& dataState,
+    const std::vector<string_offset_t>& offsets, string_index_t firstOffsetToScan,
+    const std::vector<std::pair<string_index_t, uint64_t>>& offsetsToScan,
+    ValueVector* resultVector) const {
+    static constexpr uint64_t MAX_RUN_DATA_SIZE = 16 * RYU_PAGE_SIZE;
+    std::vector<uint8_t> runData;
+    auto runStart = 0u;
+    while (runStart < offsetsToScan.size()) {
+        const auto runStartOffset = offsets[offsetsToScan[runStart].first - firstOffsetToScan];
+        auto runEnd = runStart + 1;
+        while (runEnd < offsetsToScan.size()) {
+            const auto prevIndex = offsetsToScan[runEnd - 1].first;
+            const auto index = offsetsToScan[runEnd].first;
+            if ((index != prevIndex && index != prevIndex + 1) ||
+                offsets[index - firstOffsetToScan + 1] - runStartOffset > MAX_RUN_DATA_SIZE) {
+                break;
+            }
+            runEnd++;
+        }
+        const auto runEndOffset = offsets[offsetsToScan[runEnd - 1].first - firstOffsetToScan + 1];
+        KU_ASSERT(runEndOffset >= runStartOffset);
+        runData.resize(runEndOffset - runStartOffset);
+        dataColumn->scanSegment(dataState, runStartOffset, runData.size(), runData.data());
+        for (auto pos = runStart; pos < runEnd; pos++) {
+            const auto [index, offsetInVector] = offsetsToScan[pos];
+            // Strings with the same index in the dictionary share the string that was copied first
+            if (pos > runStart && offsetsToScan[pos - 1].first == index) {
+                resultVector->setValue<ku_string_t>(offsetInVector,
+                    resultVector->getValue<ku_string_t>(offsetsToScan[pos - 1].second));
+                continue;
+            }
+            const auto startOffset = offsets[index - firstOffsetToScan];
+            const auto endOffset = offsets[index - firstOffsetToScan + 1];
+            KU_ASSERT(endOffset >= startOffset);
+            copyValue(dataState, runData.data() + (startOffset - runStartOffset),
+                endOffset - startOffset, resultVector, offsetInVector);
+        }
+        runStart = runEnd;
+    }
+}
+
 template void DictionaryColumn::scan<common::ValueVector>(const SegmentState& offsetState,
     const SegmentState& dataState,
     std::vector<std::pair<DictionaryChunk::string_index_t, uint64_t>>& offsetsToScan,
@@ -168,12 +219,30 @@ void DictionaryColumn::scanOffsets(const SegmentState& state,
     }
 }
 
-void DictionaryColumn::scanValue(const SegmentState& dataState, uint64_t startOffset,
-    uint64_t length, ValueVector* resultVector, uint64_t offsetInVector) const {
-    // Add string to vector first and read directly into the vector
+bool DictionaryColumn::isEncoded(const SegmentState& dataState) {
+    return dataState.metadata.compMeta.compression == CompressionType::FSST;
+}
+
+const FSSTSymbolTable& DictionaryColumn::getSymbolTable(const SegmentState& dataState) {
+    KU_ASSERT(isEncoded(dataState));
+    return dataState.metadata.compMeta.fsstMetadata()->symbolTable;
+}
+
+void DictionaryColumn::copyValue(const SegmentState& dataState, const uint8_t* data,
+    uint64_t length, ValueVector* resultVector, uint64_t offsetInVector) {
+    if (isEncoded(dataState)) {
+        auto& symbolTable = getSymbolTable(dataState);
+        auto& kuString = StringVector::reserveString(resultVector, offsetInVector,
+            symbolTable.getDecodedLength(data, length));
+        symbolTable.decode(data, length, (uint8_t*)kuString.getData());
+        if (!ku_string_t::isShortString(kuString.len)) {
+            memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
+        }
+        return;
+    }
     auto& kuString = StringVector::reserveString(resultVector, offsetInVector, length);
-    dataColumn->scanSegment(dataState, startOffset, length, (uint8_t*)kuString.getData());
-    // Update prefix to match the scanned string data
+    memcpy((uint8_t*)kuString.getData(), data, length);
+    // Update prefix to match the copied string data
     if (!ku_string_t::isShortString(kuString.len)) {
         memcpy(kuString.prefix, kuString.getData(), ku_string_t::PREFIX_LENGTH);
     }
@@ -184,6 +253,12 @@ void DictionaryColumn::scanValue(const SegmentState& dataState, uint64_t startOf
     auto& stringDataChunk = *result->getDictionaryChunk().getStringDataChunk();
     auto& offsetChunk = *result->getDictionaryChunk().getOffsetChunk();
     auto& indexChunk = *result->getIndexColumnChunk();
+    std::vector<uint8_t> codes;
+    if (isEncoded(dataState)) {
+        codes.resize(length);
+        dataColumn->scanSegment(dataState, startOffset, length, codes.data());
+        length = getSymbolTable(dataState).getDecodedLength(codes.data(), codes.size());
+    }
     if (stringDataChunk.getCapacity() < stringDataChunk.getNumValues() + length) {
         stringDataChunk.resize(std::bit_ceil(stringDataChunk.getNumValues() + length));
     }
@@ -193,8 +268,13 @@ void DictionaryColumn::scanValue(const SegmentState& dataState, uint64_t startOf
     if (offsetInResult >= indexChunk.getCapacity()) {
         indexChunk.resize(std::bit_ceil(offsetInResult + 1));
     }
-    dataColumn->scanSegment(dataState, startOffset, length,
-        stringDataChunk.getData<uint8_t>() + stringDataChunk.getNumValues());
+    if (isEncoded(dataState)) {
+        getSymbolTable(dataState).decode(codes.data(), codes.size(),
+            stringDataChunk.getData<uint8_t>() + stringDataChunk.getNumValues());
+    } else {
+        dataColumn->scanSegment(dataState, startOffset, length,
+            stringDataChunk.getData<uint8_t>() + stringDataChunk.getNumValues());
+    }
     indexChunk.setValue<string_index_t>(offsetChunk.getNumValues(), offsetInResult);
     offsetChunk.setValue<string_offset_t>(stringDataChunk.getNumValues(),
         offsetChunk.getNumValues());
@@ -219,7 +299,11 @@ bool DictionaryColumn::canCommitInPlace(const SegmentState& state, uint64_t numN
 
 bool DictionaryColumn::canDataCommitInPlace(const SegmentState& dataState,
     uint64_t totalStringLengthToAdd) {
-    // Make sure there is sufficient space in the data chunk (not currently compressed)
+    // New strings would have to be encoded, and the symbol table may not cover them well
+    if (isEncoded(dataState)) {
+        return false;
+    }
+    // Make sure there is sufficient space in the data chunk
     auto totalStringDataAfterUpdate = dataState.metadata.numValues + totalStringLengthToAdd;
     if (totalStringDataAfterUpdate > dataState.metadata.getNumPages() * RYU_PAGE_SIZE) {
         // Data cannot be updated in place
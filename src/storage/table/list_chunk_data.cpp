@@ -442,6 +442,13 @@ void ListChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     dataColumnChunk->reclaimStorage(pageAllocator);
     offsetColumnChunk->reclaimStorage(pageAllocator);
 }
+
+void ListChunkData::prefetchPagesAsync(FileHandle& dataFH) const {
+    ColumnChunkData::prefetchPagesAsync(dataFH);
+    sizeColumnChunk->prefetchPagesAsync(dataFH);
+    dataColumnChunk->prefetchPagesAsync(dataFH);
+    offsetColumnChunk->prefetchPagesAsync(dataFH);
+}
 uint64_t ListChunkData::getSizeOnDisk() const {
     return ColumnChunkData::getSizeOnDisk() + sizeColumnChunk->getSizeOnDisk() +
            dataColumnChunk->getSizeOnDisk() + offsetColumnChunk->getSizeOnDisk();
@@ -211,17 +211,15 @@ void ListColumn::scanUnfiltered(const SegmentState& state, ValueVector* resultVe
             startListOffsetInStorage, endListOffsetInStorage - startListOffsetInStorage, dataVector,
             static_cast<uint64_t>(startOffsetInDataVector /* offsetInVector */));
     } else {
-        offsetInDataVector = startOffsetInDataVector;
+        std::vector<std::pair<offset_t, list_size_t>> lists;
         for (auto i = 0u; i < numValuesToScan; i++) {
             // Nulls are scanned to the resultVector first
             if (!resultVector->isNull(i)) {
-                auto startListOffsetInStorage = listOffsetInfoInStorage.getListStartOffset(i);
-                auto appendSize = listOffsetInfoInStorage.getListSize(i);
-                dataColumn->scanSegment(state.childrenStates[DATA_COLUMN_CHILD_READ_STATE_IDX],
-                    startListOffsetInStorage, appendSize, dataVector, offsetInDataVector);
-                offsetInDataVector += appendSize;
+                lists.emplace_back(listOffsetInfoInStorage.getListStartOffset(i),
+                    listOffsetInfoInStorage.getListSize(i));
             }
         }
+        scanListData(state, dataVector, startOffsetInDataVector, lists);
     }
 }
 
@@ -243,23 +241,47 @@ void ListColumn::scanFiltered(const SegmentState& state, offset_t startOffsetInS
         }
     }
     ListVector::resizeDataVector(resultVector, offsetInDataVector);
-    offsetInDataVector = startOffsetInDataVector;
+    // If there is a selection vector for the dataVector, its selected positions are not
+    // being updated at all for this specific segment
+    KU_ASSERT(!dataVector->state || dataVector->state->getSelVector().isUnfiltered());
+    std::vector<std::pair<offset_t, list_size_t>> lists;
     for (auto i = 0u; i < resultVector->state->getSelVector().getSelSize(); i++) {
         auto pos = resultVector->state->getSelVector()[i];
         // Nulls are scanned to the resultVector first
         if (pos >= offsetInResult &&
             startOffsetInSegment + pos - offsetInResult < state.metadata.numValues &&
             !resultVector->isNull(pos)) {
-            auto startOffsetInStorageToScan =
-                listOffsetSizeInfo.getListStartOffset(pos - offsetInResult);
-            auto appendSize = listOffsetSizeInfo.getListSize(pos - offsetInResult);
-            // If there is a selection vector for the dataVector, its selected positions are not
-            // being updated at all for this specific segment
-            KU_ASSERT(!dataVector->state || dataVector->state->getSelVector().isUnfiltered());
-            dataColumn->scanSegment(state.childrenStates[DATA_COLUMN_CHILD_READ_STATE_IDX],
-                startOffsetInStorageToScan, appendSize, dataVector, offsetInDataVector);
-            offsetInDataVector += resultVector->getValue<list_entry_t>(pos).size;
+            lists.emplace_back(listOffsetSizeInfo.getListStartOffset(pos - offsetInResult),
+                listOffsetSizeInfo.getListSize(pos - offsetInResult));
+        }
+    }
+    scanListData(state, dataVector, startOffsetInDataVector, lists);
+}
+
+void ListColumn::scanListData(const SegmentState& state, ValueVector* dataVector,
+    offset_t offsetInDataVector, const std::vector<std::pair<offset_t, list_size_t>>& lists) const {
+    const auto& dataState = state.childrenStates[DATA_COLUMN_CHILD_READ_STATE_IDX];
+    offset_t runStartInStorage = 0;
+    uint64_t runSize = 0;
+    for (const auto& [startInStorage, size] : lists) {
+        if (size == 0) {
+            continue;
+        }
+        if (runSize > 0 && runStartInStorage + runSize == startInStorage) {
+            runSize += size;
+            continue;
         }
+        if (runSize > 0) {
+            dataColumn->scanSegment(dataState, runStartInStorage, runSize, dataVector,
+                offsetInDataVector);
+            offsetInDataVector += runSize;
+        }
+        runStartInStorage = startInStorage;
+        runSize = size;
+    }
+    if (runSize > 0) {
+        dataColumn->scanSegment(dataState, runStartInStorage, runSize, dataVector,
+            offsetInDataVector);
     }
 }
 
@@ -157,10 +157,12 @@ void NodeGroup::initializeScanState(const Transaction* transaction, TableScanSta
 static void initializeScanStateForChunkedGroup(const TableScanState& state,
     const ChunkedNodeGroup* chunkedGroup) {
     KU_ASSERT(chunkedGroup);
+    auto& nodeGroupScanState = *state.nodeGroupScanState;
+    // The group may have changed since its zone maps were checked, e.g. by a checkpoint.
+    nodeGroupScanState.zoneMapCheckedGroup = nullptr;
     if (chunkedGroup->getResidencyState() != ResidencyState::ON_DISK) {
         return;
     }
-    auto& nodeGroupScanState = *state.nodeGroupScanState;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
         KU_ASSERT(i < state.columnIDs.size());
         KU_ASSERT(i < nodeGroupScanState.chunkStates.size());
@@ -171,6 +173,11 @@ static void initializeScanStateForChunkedGroup(const TableScanState& state,
         auto& chunk = chunkedGroup->getColumnChunk(columnID);
         auto& chunkState = nodeGroupScanState.chunkStates[i];
         chunk.initializeScanState(chunkState, state.columns[i]);
+        if (state.pageAccessPattern != PageAccessPattern::NORMAL) {
+            for (auto& segmentState : chunkState.segmentStates) {
+                segmentState.setPageAccessPattern(state.pageAccessPattern);
+            }
+        }
     }
 }
 
@@ -235,12 +242,30 @@ NodeGroupScanResult NodeGroup::scan(const Transaction* transaction, TableScanSta
         nodeGroupScanState.nextRowToScan - chunkedGroupToScan.getStartRowIdx();
     const auto numRowsToScan =
         std::min(chunkedGroupToScan.getNumRows() - rowIdxInChunkToScan, DEFAULT_VECTOR_CAPACITY);
+    const auto endRowOfChunkedGroup =
+        chunkedGroupToScan.getStartRowIdx() + chunkedGroupToScan.getNumRows();
+    // Zone maps cover the whole chunked group, so when they rule out the predicates of the scan,
+    // all of its remaining vectors are skipped at once instead of being checked one by one.
+    if (chunkedGroupToScan.canSkipScan(state, nodeGroupScanState)) {
+        state.outState->getSelVectorUnsafe().setToFiltered(0);
+        nodeGroupScanState.nextRowToScan = endRowOfChunkedGroup;
+        return NodeGroupScanResult{endRowOfChunkedGroup, 0};
+    }
     bool enableSemiMask =
         state.source == TableScanSource::COMMITTED && state.semiMask && state.semiMask->isEnabled();
     if (enableSemiMask) {
         applySemiMaskFilter(state, numRowsToScan, state.outState->getSelVectorUnsafe());
         if (state.outState->getSelVector().getSelSize() == 0) {
-            state.nodeGroupScanState->nextRowToScan += numRowsToScan;
+            // Skip the following vectors without masked nodes of the chunked group as well.
+            const auto startOffsetOfGroup =
+                StorageUtils::getStartOffsetOfNodeGroup(state.nodeGroupIdx);
+            const auto nextMaskedOffset = state.semiMask->nextMaskedOffset(
+                startOffsetOfGroup + nodeGroupScanState.nextRowToScan + numRowsToScan);
+            nodeGroupScanState.nextRowToScan =
+                nextMaskedOffset == INVALID_OFFSET ?
+                    endRowOfChunkedGroup :
+                    std::clamp<row_idx_t>(nextMaskedOffset - startOffsetOfGroup,
+                        nodeGroupScanState.nextRowToScan + numRowsToScan, endRowOfChunkedGroup);
             return NodeGroupScanResult{nodeGroupScanState.nextRowToScan, 0};
         }
     }
@@ -366,6 +391,34 @@ void NodeGroup::update(const Transaction* transaction, row_idx_t rowIdxInGroup,
     chunkedGroupToUpdate->update(transaction, rowIdxInChunkedGroup, columnID, propertyVector);
 }
 
+void NodeGroup::update(const Transaction* transaction,
+    std::span<const row_idx_t> rowIdxesInGroup, column_id_t columnID,
+    const ValueVector& propertyVector, std::span<const sel_t> valuePositions) {
+    KU_ASSERT(rowIdxesInGroup.size() == valuePositions.size());
+    std::vector<row_idx_t> rowIdxesInChunkedGroup;
+    rowIdxesInChunkedGroup.reserve(rowIdxesInGroup.size());
+    auto i = 0u;
+    while (i < rowIdxesInGroup.size()) {
+        ChunkedNodeGroup* chunkedGroupToUpdate = nullptr;
+        {
+            const auto lock = chunkedGroups.lock();
+            chunkedGroupToUpdate = findChunkedGroupFromRowIdx(lock, rowIdxesInGroup[i]);
+        }
+        KU_ASSERT(chunkedGroupToUpdate);
+        const auto startRowIdx = chunkedGroupToUpdate->getStartRowIdx();
+        const auto endRowIdx = startRowIdx + chunkedGroupToUpdate->getNumRows();
+        rowIdxesInChunkedGroup.clear();
+        while (i + rowIdxesInChunkedGroup.size() < rowIdxesInGroup.size() &&
+               rowIdxesInGroup[i + rowIdxesInChunkedGroup.size()] < endRowIdx) {
+            rowIdxesInChunkedGroup.push_back(
+                rowIdxesInGroup[i + rowIdxesInChunkedGroup.size()] - startRowIdx);
+        }
+        chunkedGroupToUpdate->update(transaction, rowIdxesInChunkedGroup, columnID,
+            propertyVector, valuePositions.subspan(i, rowIdxesInChunkedGroup.size()));
+        i += rowIdxesInChunkedGroup.size();
+    }
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
 bool NodeGroup::delete_(const Transaction* transaction, row_idx_t rowIdxInGroup) {
     ChunkedNodeGroup* groupToDelete = nullptr;
@@ -411,11 +464,38 @@ void NodeGroup::reclaimStorage(PageAllocator& pageAllocator) const {
 }
 
 void NodeGroup::reclaimStorage(PageAllocator& pageAllocator, const UniqLock& lock) const {
+    pageAllocator.setChunkNodeGroupIdx(nodeGroupIdx);
     for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
         chunkedGroup->reclaimStorage(pageAllocator);
     }
 }
 
+void NodeGroup::vacuumUpdates(transaction_t oldestActiveTS) const {
+    vacuumUpdates(oldestActiveTS, chunkedGroups.lock());
+}
+
+void NodeGroup::vacuumUpdates(transaction_t oldestActiveTS, const UniqLock& lock) const {
+    for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
+        chunkedGroup->vacuumUpdates(oldestActiveTS);
+    }
+}
+
+void NodeGroup::prefetchPagesAsync(FileHandle& dataFH,
+    const std::vector<column_id_t>& columnIDs) const {
+    const auto lock = chunkedGroups.lock();
+    for (auto& chunkedGroup : chunkedGroups.getAllGroups(lock)) {
+        chunkedGroup->prefetchPagesAsync(dataFH, columnIDs);
+    }
+}
+
+bool NodeGroup::isFullAndInMemoryOnly() const {
+    if (!isFull()) {
+        return false;
+    }
+    const auto lock = chunkedGroups.lock();
+    return chunkedGroups.getFirstGroup(lock)->getResidencyState() == ResidencyState::IN_MEMORY;
+}
+
 void NodeGroup::checkpoint(MemoryManager& memoryManager, NodeGroupCheckpointState& state) {
     const auto lock = chunkedGroups.lock();
     KU_ASSERT(chunkedGroups.getNumGroups(lock) >= 1);
@@ -613,8 +693,12 @@ std::unique_ptr<NodeGroup> NodeGroup::deserialize(MemoryManager& mm, Deserialize
     case NodeGroupDataFormat::CSR: {
         if (hasCheckpointedData) {
             chunkedNodeGroup = ChunkedCSRNodeGroup::deserialize(mm, deSer);
+            deSer.validateDebuggingInfo(key, "packed_csr_info");
+            auto packedCSRInfo = PackedCSRInfo::deserialize(deSer);
+            deSer.validateDebuggingInfo(key, "degree_stats");
+            auto degreeStats = DegreeStats::deserialize(deSer);
             return std::make_unique<CSRNodeGroup>(mm, nodeGroupIdx, enableCompression,
-                std::move(chunkedNodeGroup));
+                std::move(chunkedNodeGroup), packedCSRInfo, degreeStats);
         } else {
             return std::make_unique<CSRNodeGroup>(mm, nodeGroupIdx, enableCompression,
                 copyVector(columnTypes));
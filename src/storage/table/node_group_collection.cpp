@@ -1,5 +1,9 @@
 #include "storage/table/node_group_collection.h"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include "common/vector/value_vector.h"
 #include "storage/table/chunked_node_group.h"
 #include "storage/table/csr_node_group.h"
@@ -203,8 +207,41 @@ void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
     NodeGroupCheckpointState& state) {
     KU_ASSERT(residency == ResidencyState::ON_DISK);
     const auto lock = nodeGroups.lock();
-    for (const auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
-        nodeGroup->checkpoint(memoryManager, state);
+    const auto& groups = nodeGroups.getAllGroups(lock);
+    // Node groups are checkpointed independently of each other. Pages are allocated and shadowed
+    // under the locks of the page manager and the shadow file, so groups can be handed out to
+    // multiple threads. The first exception is rethrown once all threads are done.
+    std::atomic<uint64_t> nextGroupIdx = 0;
+    std::mutex exceptionMtx;
+    std::exception_ptr exception;
+    auto checkpointGroups = [&]() {
+        try {
+            for (auto i = nextGroupIdx++; i < groups.size(); i = nextGroupIdx++) {
+                groups[i]->checkpoint(memoryManager, state);
+            }
+        } catch (...) {
+            std::unique_lock lck{exceptionMtx};
+            if (!exception) {
+                exception = std::current_exception();
+            }
+            nextGroupIdx = groups.size();
+        }
+    };
+#ifndef __SINGLE_THREADED__
+    std::vector<std::thread> threads;
+    const auto numThreads = std::min<uint64_t>(state.maxNumThreads, groups.size());
+    for (auto i = 1u; i < numThreads; i++) {
+        threads.emplace_back(checkpointGroups);
+    }
+#endif
+    checkpointGroups();
+#ifndef __SINGLE_THREADED__
+    for (auto& thread : threads) {
+        thread.join();
+    }
+#endif
+    if (exception) {
+        std::rethrow_exception(exception);
     }
     std::vector<LogicalType> typesAfterCheckpoint;
     for (auto i = 0u; i < state.columnIDs.size(); i++) {
@@ -213,6 +250,33 @@ void NodeGroupCollection::checkpoint(MemoryManager& memoryManager,
     types = std::move(typesAfterCheckpoint);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
+void NodeGroupCollection::compactFullGroups(MemoryManager& memoryManager,
+    NodeGroupCheckpointState& state) {
+    KU_ASSERT(residency == ResidencyState::ON_DISK);
+    const auto lock = nodeGroups.lock();
+    // Groups with flushed data are skipped, as checkpointing them may overwrite existing pages,
+    // which requires shadowing.
+    for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+        if (nodeGroup->isFullAndInMemoryOnly()) {
+            nodeGroup->checkpoint(memoryManager, state);
+        }
+    }
+}
+
+bool NodeGroupCollection::hasCompactableGroups() const {
+    const auto lock = nodeGroups.lock();
+    // Rows are only appended to the last node group, so a group that became full since the last
+    // compaction is one of the last two groups.
+    const auto numGroups = nodeGroups.getNumGroups(lock);
+    for (auto i = numGroups < 2 ? 0 : numGroups - 2; i < numGroups; i++) {
+        if (nodeGroups.getGroup(lock, i)->isFullAndInMemoryOnly()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void NodeGroupCollection::reclaimStorage(PageAllocator& pageAllocator) const {
     const auto lock = nodeGroups.lock();
     for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
@@ -220,6 +284,13 @@ void NodeGroupCollection::reclaimStorage(PageAllocator& pageAllocator) const {
     }
 }
 
+void NodeGroupCollection::vacuumUpdates(transaction_t oldestActiveTS) const {
+    const auto lock = nodeGroups.lock();
+    for (auto& nodeGroup : nodeGroups.getAllGroups(lock)) {
+        nodeGroup->vacuumUpdates(oldestActiveTS);
+    }
+}
+
 void NodeGroupCollection::rollbackInsert(row_idx_t numRows_, bool updateNumRows) {
     const auto lock = nodeGroups.lock();
 
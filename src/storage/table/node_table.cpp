@@ -223,8 +223,7 @@ NodeTable::NodeTable(const StorageManager* storageManager,
     const NodeTableCatalogEntry* nodeTableEntry, MemoryManager* mm)
     : Table{nodeTableEntry, storageManager, mm},
       pkColumnID{nodeTableEntry->getColumnID(nodeTableEntry->getPrimaryKeyName())},
-      versionRecordHandler(this) {
-    auto* dataFH = storageManager->getDataFH();
+      dataFH{storageManager->getDataFH()}, versionRecordHandler(this) {
     auto& pageAllocator = *dataFH->getPageManager();
     const auto maxColumnID = nodeTableEntry->getMaxColumnID();
     columns.resize(maxColumnID + 1);
@@ -297,6 +296,14 @@ void NodeTable::initScanState(Transaction* transaction, TableScanState& scanStat
     initScanState(transaction, scanState);
 }
 
+void NodeTable::prefetchNodeGroupAsync(const TableScanState& scanState,
+    node_group_idx_t nodeGroupIdx) const {
+    if (nodeGroupIdx >= nodeGroups->getNumNodeGroups()) {
+        return;
+    }
+    nodeGroups->getNodeGroup(nodeGroupIdx)->prefetchPagesAsync(*dataFH, scanState.columnIDs);
+}
+
 bool NodeTable::scanInternal(Transaction* transaction, TableScanState& scanState) {
     scanState.resetOutVectors();
     return scanState.scanNext(transaction);
@@ -444,6 +451,7 @@ void NodeTable::insert(Transaction* transaction, TableInsertState& insertState)
             insertState.propertyVectors);
     }
     hasChanges = true;
+    increaseWriteVersion(transaction);
 }
 
 void NodeTable::initUpdateState(main::ClientContext* context, TableUpdateState& updateState) const {
@@ -497,6 +505,7 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
         nodeGroups->getNodeGroup(nodeGroupIdx)
             ->update(transaction, rowIdxInGroup, nodeUpdateState.columnID,
                 nodeUpdateState.propertyVector);
+        numChangesSinceAnalyze++;
     }
     if (updateState.logToWAL && transaction->shouldLogToWAL()) {
         KU_ASSERT(transaction->isWriteTransaction());
@@ -505,6 +514,79 @@ void NodeTable::update(Transaction* transaction, TableUpdateState& updateState)
             &nodeUpdateState.propertyVector);
     }
     hasChanges = true;
+    increaseWriteVersion(transaction);
+}
+
+// Splits increasing row indices into runs within the same node group. func is called with the node
+// group index, the row indices within the node group and the value positions of each run.
+template<typename Func>
+static void forEachNodeGroupRun(std::span<const row_idx_t> rowIdxes,
+    std::span<const sel_t> valuePositions, Func&& func) {
+    std::vector<row_idx_t> rowIdxesInGroup;
+    auto i = 0u;
+    while (i < rowIdxes.size()) {
+        const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(rowIdxes[i]);
+        const auto startRowIdx = StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx);
+        rowIdxesInGroup.clear();
+        while (i + rowIdxesInGroup.size() < rowIdxes.size() &&
+               StorageUtils::getNodeGroupIdx(rowIdxes[i + rowIdxesInGroup.size()]) ==
+                   nodeGroupIdx) {
+            rowIdxesInGroup.push_back(rowIdxes[i + rowIdxesInGroup.size()] - startRowIdx);
+        }
+        func(nodeGroupIdx, std::span<const row_idx_t>(rowIdxesInGroup),
+            valuePositions.subspan(i, rowIdxesInGroup.size()));
+        i += rowIdxesInGroup.size();
+    }
+}
+
+void NodeTable::update(Transaction* transaction, column_id_t columnID,
+    std::span<const offset_t> nodeOffsets, const ValueVector& propertyVector,
+    std::span<const sel_t> valuePositions) {
+    KU_ASSERT(nodeOffsets.size() == valuePositions.size());
+    KU_ASSERT(std::is_sorted(nodeOffsets.begin(), nodeOffsets.end()));
+    if (columnID == pkColumnID && getPKIndex()) {
+        throw RuntimeException("Cannot update pk.");
+    }
+    // Nodes inserted by the transaction have larger offsets than all committed nodes.
+    const auto numCommitted = static_cast<idx_t>(
+        std::partition_point(nodeOffsets.begin(), nodeOffsets.end(),
+            [&](offset_t offset) { return !transaction->isUnCommitted(tableID, offset); }) -
+        nodeOffsets.begin());
+    forEachNodeGroupRun(nodeOffsets.first(numCommitted), valuePositions.first(numCommitted),
+        [&](node_group_idx_t nodeGroupIdx, auto rowIdxes, auto positions) {
+            nodeGroups->getNodeGroup(nodeGroupIdx)
+                ->update(transaction, rowIdxes, columnID, propertyVector, positions);
+        });
+    numChangesSinceAnalyze += numCommitted;
+    if (numCommitted < nodeOffsets.size()) {
+        const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID);
+        KU_ASSERT(localTable);
+        const auto& localNodeTable = localTable->cast<LocalNodeTable>();
+        std::vector<row_idx_t> localRowIdxes;
+        localRowIdxes.reserve(nodeOffsets.size() - numCommitted);
+        for (const auto offset : nodeOffsets.subspan(numCommitted)) {
+            localRowIdxes.push_back(transaction->getLocalRowIdx(tableID, offset));
+        }
+        forEachNodeGroupRun(localRowIdxes, valuePositions.subspan(numCommitted),
+            [&](node_group_idx_t nodeGroupIdx, auto rowIdxes, auto positions) {
+                localNodeTable.getNodeGroup(nodeGroupIdx)
+                    ->update(&DUMMY_TRANSACTION, rowIdxes, columnID, propertyVector, positions);
+            });
+    }
+    if (transaction->shouldLogToWAL()) {
+        KU_ASSERT(transaction->isWriteTransaction());
+        // Node update records hold a single value each.
+        ValueVector walVector(propertyVector.dataType.copy(), memoryManager);
+        walVector.setState(DataChunkState::getSingleValueDataChunkState());
+        auto& wal = transaction->getLocalWAL();
+        for (auto i = 0u; i < nodeOffsets.size(); i++) {
+            walVector.resetAuxiliaryBuffer();
+            walVector.copyFromVectorData(0, &propertyVector, valuePositions[i]);
+            wal.logNodeUpdate(tableID, columnID, nodeOffsets[i], &walVector);
+        }
+    }
+    hasChanges = true;
+    increaseWriteVersion(transaction);
 }
 
 bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState) {
@@ -533,9 +615,13 @@ bool NodeTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
         if (transaction->shouldAppendToUndoBuffer()) {
             transaction->pushDeleteInfo(nodeGroupIdx, rowIdxInGroup, 1, &versionRecordHandler);
         }
+        if (isDeleted) {
+            numChangesSinceAnalyze++;
+        }
     }
     if (isDeleted) {
         hasChanges = true;
+        increaseWriteVersion(transaction);
         if (deleteState.logToWAL && transaction->shouldLogToWAL()) {
             KU_ASSERT(transaction->isWriteTransaction());
             auto& wal = transaction->getLocalWAL();
@@ -565,6 +651,7 @@ std::pair<offset_t, offset_t> NodeTable::appendToLastNodeGroup(Transaction* tran
     const std::vector<column_id_t>& columnIDs, InMemChunkedNodeGroup& chunkedGroup,
     PageAllocator& pageAllocator) {
     hasChanges = true;
+    increaseWriteVersion(transaction);
     return nodeGroups->appendToLastNodeGroupAndFlushWhenFull(transaction, columnIDs, chunkedGroup,
         pageAllocator);
 }
@@ -636,7 +723,7 @@ void NodeTable::commit(main::ClientContext* context, TableCatalogEntry* tableEnt
             getVisibleFunc(transaction)};
         // We need to scan from local storage here because some tuples in local node groups might
         // have been deleted.
-        scanIndexColumns(context, indexInserter, localNodeTable.getNodeGroups());
+        scanIndexColumns(context, transaction, indexInserter, localNodeTable.getNodeGroups());
     }
 
     // 4. Clear local table.
@@ -669,6 +756,7 @@ bool NodeTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tabl
 
         NodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator,
             memoryManager};
+        state.maxNumThreads = context->getMaxNumThreadForExec();
         nodeGroups->checkpoint(*memoryManager, state);
         for (auto& index : indexes) {
             index.checkpoint(context, pageAllocator);
@@ -679,13 +767,32 @@ bool NodeTable::checkpoint(main::ClientContext* context, TableCatalogEntry* tabl
     return ret;
 }
 
+void NodeTable::compactFullNodeGroups(main::ClientContext* context,
+    PageAllocator& pageAllocator) {
+    // Unlike checkpoints, dropped columns are kept so that compacted and uncompacted node groups
+    // still have the same columns.
+    std::vector<column_id_t> columnIDs;
+    std::vector<Column*> columnPtrs;
+    for (auto columnID = 0u; columnID < columns.size(); columnID++) {
+        if (!columns[columnID]) {
+            return;
+        }
+        columnIDs.push_back(columnID);
+        columnPtrs.push_back(columns[columnID].get());
+    }
+    NodeGroupCheckpointState state{std::move(columnIDs), std::move(columnPtrs), pageAllocator,
+        memoryManager};
+    state.maxNumThreads = context->getMaxNumThreadForExec();
+    nodeGroups->compactFullGroups(*memoryManager, state);
+}
+
 void NodeTable::rollbackPKIndexInsert(main::ClientContext* context, row_idx_t startRow,
     row_idx_t numRows_, node_group_idx_t nodeGroupIdx_) {
     const row_idx_t startNodeOffset =
         startRow + StorageUtils::getStartOffsetOfNodeGroup(nodeGroupIdx_);
 
     RollbackPKDeleter pkDeleter{startNodeOffset, numRows_, this, getPKIndex()};
-    scanIndexColumns(context, pkDeleter, *nodeGroups);
+    scanIndexColumns(context, transaction::Transaction::Get(*context), pkDeleter, *nodeGroups);
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): Semantically non-const.
@@ -693,10 +800,14 @@ void NodeTable::rollbackGroupCollectionInsert(row_idx_t numRows_) {
     nodeGroups->rollbackInsert(numRows_);
 }
 
-void NodeTable::rollbackCheckpoint() {
+void NodeTable::rollbackCheckpoint(ChunkRelocationRollback& relocationRollback) {
     for (auto& index : indexes) {
         index.rollbackCheckpoint();
     }
+    if (relocationRollback.hasRelocations(tableID)) {
+        relocationRollback.setTableID(tableID);
+        reclaimColumnStorage(relocationRollback);
+    }
 }
 
 void NodeTable::reclaimStorage(PageAllocator& pageAllocator) const {
@@ -713,6 +824,16 @@ TableStats NodeTable::getStats(const Transaction* transaction) const {
     return stats;
 }
 
+bool NodeTable::needsAnalyze() const {
+    static constexpr row_idx_t MIN_NUM_CHANGES = 1000;
+    static constexpr double MIN_CHANGE_RATIO = 0.2;
+    const auto numChanges = numChangesSinceAnalyze.load();
+    if (numChanges < MIN_NUM_CHANGES) {
+        return false;
+    }
+    return numChanges >= MIN_CHANGE_RATIO * nodeGroups->getStats().getTableCard();
+}
+
 bool NodeTable::isVisible(const Transaction* transaction, offset_t offset) const {
     auto [nodeGroupIdx, offsetInGroup] = StorageUtils::getNodeGroupIdxAndOffsetInChunk(offset);
     const auto* nodeGroup = getNodeGroup(nodeGroupIdx);
@@ -741,14 +862,45 @@ bool NodeTable::lookupPK(const Transaction* transaction, ValueVector* keyVector,
         [&](offset_t offset) { return isVisibleNoLock(transaction, offset); });
 }
 
-void NodeTable::scanIndexColumns(main::ClientContext* context, IndexScanHelper& scanHelper,
-    const NodeGroupCollection& nodeGroups_) const {
+void NodeTable::lookupPKs(const Transaction* transaction, ValueVector* keyVector,
+    std::span<const sel_t> positions, std::span<offset_t> results) const {
+    KU_ASSERT(positions.size() == results.size());
+    const LocalNodeTable* localTable = nullptr;
+    if (transaction->getLocalStorage()) {
+        if (const auto table = transaction->getLocalStorage()->getLocalTable(tableID)) {
+            localTable = &table->cast<LocalNodeTable>();
+        }
+    }
+    // Keys inserted by this transaction are found in its local table, the rest are looked up in
+    // the primary key index as one batch
+    std::vector<sel_t> indexPositions;
+    std::vector<idx_t> indexResultIdxes;
+    for (auto i = 0u; i < positions.size(); i++) {
+        if (localTable && localTable->lookupPK(transaction, keyVector, positions[i], results[i])) {
+            continue;
+        }
+        indexPositions.push_back(positions[i]);
+        indexResultIdxes.push_back(i);
+    }
+    if (indexPositions.empty()) {
+        return;
+    }
+    std::vector<offset_t> indexResults(indexPositions.size());
+    getPKIndex()->lookup(transaction, keyVector, indexPositions, indexResults,
+        [&](offset_t offset) { return isVisibleNoLock(transaction, offset); });
+    for (auto i = 0u; i < indexResultIdxes.size(); i++) {
+        results[indexResultIdxes[i]] = indexResults[i];
+    }
+}
+
+void NodeTable::scanIndexColumns(main::ClientContext* context, const Transaction* transaction,
+    IndexScanHelper& scanHelper, const NodeGroupCollection& nodeGroups_,
+    node_group_idx_t startNodeGroupIdx) const {
     auto dataChunk = constructDataChunkForColumns(scanHelper.index->getIndexInfo().columnIDs);
-    const auto scanState =
-        scanHelper.initScanState(transaction::Transaction::Get(*context), dataChunk);
+    const auto scanState = scanHelper.initScanState(transaction, dataChunk);
 
     const auto numNodeGroups = nodeGroups_.getNumNodeGroups();
-    for (node_group_idx_t nodeGroupToScan = 0u; nodeGroupToScan < numNodeGroups;
+    for (node_group_idx_t nodeGroupToScan = startNodeGroupIdx; nodeGroupToScan < numNodeGroups;
          ++nodeGroupToScan) {
         scanState->nodeGroup = nodeGroups_.getNodeGroupNoLock(nodeGroupToScan);
 
@@ -757,11 +909,9 @@ void NodeTable::scanIndexColumns(main::ClientContext* context, IndexScanHelper&
         if (scanState->nodeGroup->getNumChunkedGroups() > 0) {
             scanState->nodeGroupIdx = nodeGroupToScan;
             KU_ASSERT(scanState->nodeGroup);
-            scanState->nodeGroup->initializeScanState(transaction::Transaction::Get(*context),
-                *scanState);
+            scanState->nodeGroup->initializeScanState(transaction, *scanState);
             while (true) {
-                if (const auto scanResult = scanState->nodeGroup->scan(
-                        transaction::Transaction::Get(*context), *scanState);
+                if (const auto scanResult = scanState->nodeGroup->scan(transaction, *scanState);
                     !scanHelper.processScanOutput(context, scanResult, scanState->outputVectors)) {
                     break;
                 }
@@ -814,7 +964,6 @@ std::optional<Index*> NodeTable::getIndex(const std::string& name) const {
 }
 
 void NodeTable::serialize(Serializer& serializer) const {
-    nodeGroups->serialize(serializer);
     serializer.write<uint64_t>(indexes.size());
     for (auto i = 0u; i < indexes.size(); ++i) {
         indexes[i].serialize(serializer);
@@ -823,7 +972,6 @@ void NodeTable::serialize(Serializer& serializer) const {
 
 void NodeTable::deserialize(main::ClientContext* context, StorageManager* storageManager,
     Deserializer& deSer) {
-    nodeGroups->deserialize(deSer, *memoryManager);
     std::vector<IndexInfo> indexInfos;
     std::vector<length_t> storageInfoBufferSizes;
     std::vector<std::unique_ptr<uint8_t[]>> storageInfoBuffers;
@@ -10,6 +10,7 @@
 #include "storage/local_storage/local_rel_table.h"
 #include "storage/local_storage/local_storage.h"
 #include "storage/local_storage/local_table.h"
+#include "storage/predicate/constant_predicate.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/table/column_chunk.h"
@@ -53,6 +54,44 @@ void RelTableScanState::setToTable(const Transaction* transaction, Table* table_
     }
 }
 
+void RelTableScanState::initSortKeyPredicates(column_id_t sortColumnID) {
+    sortKeyColumnIdx = INVALID_IDX;
+    sortKeyPredicates.clear();
+    if (sortColumnID == INVALID_COLUMN_ID || columnPredicateSets.empty()) {
+        return;
+    }
+    KU_ASSERT(columnPredicateSets.size() == columnIDs.size());
+    for (auto i = 0u; i < columnIDs.size(); i++) {
+        if (columnIDs[i] != sortColumnID) {
+            continue;
+        }
+        const auto keyType = columns[i]->getDataType().getPhysicalType();
+        for (auto& predicate : columnPredicateSets[i].getPredicates()) {
+            const auto constantPredicate =
+                dynamic_cast<const ColumnConstantPredicate*>(predicate.get());
+            if (constantPredicate == nullptr || constantPredicate->getValue().isNull() ||
+                constantPredicate->getValue().getDataType().getPhysicalType() != keyType) {
+                continue;
+            }
+            switch (constantPredicate->getExpressionType()) {
+            case ExpressionType::EQUALS:
+            case ExpressionType::GREATER_THAN:
+            case ExpressionType::GREATER_THAN_EQUALS:
+            case ExpressionType::LESS_THAN:
+            case ExpressionType::LESS_THAN_EQUALS: {
+                sortKeyPredicates.push_back(constantPredicate);
+            } break;
+            default:
+                break;
+            }
+        }
+        if (!sortKeyPredicates.empty()) {
+            sortKeyColumnIdx = i;
+        }
+        return;
+    }
+}
+
 void RelTableScanState::initState(Transaction* transaction, NodeGroup* nodeGroup,
     bool resetCachedBoundNodeIDs) {
     this->nodeGroup = nodeGroup;
@@ -211,6 +250,7 @@ void RelTable::insert(Transaction* transaction, TableInsertState& insertState) {
             relInsertState.srcNodeIDVector.state->getSelVector().getSelSize(), vectorsToLog);
     }
     hasChanges = true;
+    increaseWriteVersion(transaction);
 }
 
 void RelTable::update(Transaction* transaction, TableUpdateState& updateState) {
@@ -237,6 +277,7 @@ void RelTable::update(Transaction* transaction, TableUpdateState& updateState) {
             &relUpdateState.propertyVector);
     }
     hasChanges = true;
+    increaseWriteVersion(transaction);
 }
 
 bool RelTable::delete_(Transaction* transaction, TableDeleteState& deleteState) {
@@ -261,6 +302,7 @@ bool RelTable::delete_(Transaction* transaction, TableDeleteState& deleteState)
     }
     if (isDeleted) {
         hasChanges = true;
+        increaseWriteVersion(transaction);
         if (deleteState.logToWAL && transaction->shouldLogToWAL()) {
             KU_ASSERT(transaction->isWriteTransaction());
             auto& wal = transaction->getLocalWAL();
@@ -288,8 +330,8 @@ void RelTable::detachDelete(Transaction* transaction, RelTableDeleteState* delet
         std::make_unique<RelTableScanState>(*memoryManager, &deleteState->srcNodeIDVector,
             std::vector{&deleteState->dstNodeIDVector, &deleteState->relIDVector},
             deleteState->dstNodeIDVector.state, true /*randomLookup*/);
-    relReadState->setToTable(transaction, this, {NBR_ID_COLUMN_ID, REL_ID_COLUMN_ID}, {},
-        direction);
+    relReadState->setToTable(transaction, this,
+        {NBR_ID_COLUMN_ID, REL_ID_COLUMN_ID, ROW_IDX_COLUMN_ID}, {}, direction);
     initScanState(transaction, *relReadState);
     detachDeleteForCSRRels(transaction, tableData, reverseTableData, relReadState.get(),
         deleteState);
@@ -299,6 +341,7 @@ void RelTable::detachDelete(Transaction* transaction, RelTableDeleteState* delet
         wal.logRelDetachDelete(tableID, direction, &deleteState->srcNodeIDVector);
     }
     hasChanges = true;
+    increaseWriteVersion(transaction);
 }
 
 std::vector<RelDataDirection> RelTable::getStorageDirections() const {
@@ -335,8 +378,27 @@ void RelTable::detachDeleteForCSRRels(Transaction* transaction, RelTableData* ta
     RelTableDeleteState* deleteState) {
     const auto localTable = transaction->getLocalStorage()->getLocalTable(tableID);
     const auto tempState = deleteState->dstNodeIDVector.state.get();
+    const auto srcNodeIDPos = deleteState->srcNodeIDVector.state->getSelVector()[0];
+    const auto nodeGroupIdx = StorageUtils::getNodeGroupIdx(
+        deleteState->srcNodeIDVector.getValue<nodeID_t>(srcNodeIDPos).offset);
+    std::vector<row_idx_t> rowIndices;
     while (scan(transaction, *relDataReadState)) {
         const auto numRelsScanned = tempState->getSelVector().getSelSize();
+        // The scan already located the rows of the node's own list, so they are deleted directly
+        // instead of being looked up again by rel ID, which would rescan the list for every rel.
+        rowIndices.clear();
+        for (auto i = 0u; i < numRelsScanned; i++) {
+            const auto pos = tempState->getSelVector()[i];
+            if (deleteState->relIDVector.readNodeOffset(pos) <
+                StorageConstants::MAX_NUM_ROWS_IN_TABLE) {
+                rowIndices.push_back(relDataReadState->rowIdxVector->getValue<row_idx_t>(pos));
+            }
+        }
+        if (!rowIndices.empty()) {
+            tableData->deleteRows(transaction, nodeGroupIdx,
+                relDataReadState->nodeGroupScanState->cast<CSRNodeGroupScanState>().source,
+                rowIndices);
+        }
 
         // rel table data delete_() expects the input to be flat
         // so we manually flatten the scanned rels here
@@ -358,12 +420,9 @@ void RelTable::detachDeleteForCSRRels(Transaction* transaction, RelTableData* ta
                 localTable->delete_(transaction, *deleteState);
                 continue;
             }
-            [[maybe_unused]] const auto deleted = tableData->delete_(transaction,
-                deleteState->srcNodeIDVector, deleteState->relIDVector);
             if (reverseTableData) {
-                [[maybe_unused]] const auto reverseDeleted = reverseTableData->delete_(transaction,
-                    deleteState->dstNodeIDVector, deleteState->relIDVector);
-                KU_ASSERT(deleted == reverseDeleted);
+                reverseTableData->delete_(transaction, deleteState->dstNodeIDVector,
+                    deleteState->relIDVector);
             }
         }
         tempState->getSelVectorUnsafe().setToUnfiltered();
@@ -451,12 +510,25 @@ void RelTable::commit(main::ClientContext* context, TableCatalogEntry* tableEntr
     localRelTable.clear(*MemoryManager::Get(*context));
 }
 
+void RelTable::rollbackCheckpoint(ChunkRelocationRollback& relocationRollback) {
+    if (relocationRollback.hasRelocations(tableID)) {
+        relocationRollback.setTableID(tableID);
+        reclaimStorage(relocationRollback);
+    }
+}
+
 void RelTable::reclaimStorage(PageAllocator& pageAllocator) const {
     for (auto& relData : directedRelData) {
         relData->reclaimStorage(pageAllocator);
     }
 }
 
+void RelTable::vacuumUpdates(transaction_t oldestActiveTS) const {
+    for (auto& relData : directedRelData) {
+        relData->vacuumUpdates(oldestActiveTS);
+    }
+}
+
 void RelTable::updateRelOffsets(const LocalRelTable& localRelTable) {
     auto& localNodeGroup = localRelTable.getLocalNodeGroup();
     const offset_t maxCommittedOffset = reserveRelOffsets(localNodeGroup.getNumRows());
@@ -511,8 +583,9 @@ bool RelTable::checkpoint(main::ClientContext*, TableCatalogEntry* tableEntry,
         for (auto& property : tableEntry->getProperties()) {
             columnIDs.push_back(tableEntry->getColumnID(property.getName()));
         }
+        const auto sortColumnID = tableEntry->cast<RelGroupCatalogEntry>().getSortColumnID();
         for (auto& directedRelData : directedRelData) {
-            directedRelData->checkpoint(columnIDs, pageAllocator);
+            directedRelData->checkpoint(columnIDs, sortColumnID, pageAllocator);
         }
         hasChanges = false;
     }
@@ -530,15 +603,21 @@ row_idx_t RelTable::getNumTotalRows(const Transaction* transaction) {
 void RelTable::serialize(Serializer& ser) const {
     ser.writeDebuggingInfo("next_rel_offset");
     ser.write<offset_t>(nextRelOffset);
-    for (auto& directedRelData : directedRelData) {
-        directedRelData->serialize(ser);
-    }
 }
 
 void RelTable::deserialize(main::ClientContext*, StorageManager*, Deserializer& deSer) {
     std::string key;
     deSer.validateDebuggingInfo(key, "next_rel_offset");
     deSer.deserializeValue<offset_t>(nextRelOffset);
+}
+
+void RelTable::serializeNodeGroups(Serializer& ser) const {
+    for (auto& directedRelData : directedRelData) {
+        directedRelData->serialize(ser);
+    }
+}
+
+void RelTable::deserializeNodeGroups(Deserializer& deSer) {
     for (auto i = 0u; i < directedRelData.size(); i++) {
         directedRelData[i]->deserialize(deSer, *memoryManager);
     }
@@ -144,6 +144,34 @@ bool RelTableData::delete_(Transaction* transaction, ValueVector& boundNodeIDVec
     return isDeleted;
 }
 
+void RelTableData::deleteRows(Transaction* transaction, node_group_idx_t nodeGroupIdx,
+    CSRNodeGroupScanSource source, const std::vector<row_idx_t>& rowIndices) {
+    auto& csrNodeGroup = getNodeGroup(nodeGroupIdx)->cast<CSRNodeGroup>();
+    row_idx_t runStartRow = INVALID_ROW_IDX;
+    row_idx_t numRowsInRun = 0;
+    const auto finishRun = [&] {
+        if (numRowsInRun > 0 && transaction->shouldAppendToUndoBuffer()) {
+            transaction->pushDeleteInfo(nodeGroupIdx, runStartRow, numRowsInRun,
+                getVersionRecordHandler(source));
+        }
+        numRowsInRun = 0;
+    };
+    for (const auto rowIdx : rowIndices) {
+        if (!csrNodeGroup.delete_(transaction, source, rowIdx)) {
+            finishRun();
+            continue;
+        }
+        if (numRowsInRun > 0 && runStartRow + numRowsInRun == rowIdx) {
+            numRowsInRun++;
+            continue;
+        }
+        finishRun();
+        runStartRow = rowIdx;
+        numRowsInRun = 1;
+    }
+    finishRun();
+}
+
 void RelTableData::addColumn(TableAddColumnState& addColumnState, PageAllocator& pageAllocator) {
     auto& definition = addColumnState.propertyDefinition;
     columns.push_back(ColumnFactory::createColumn(definition.getName(), definition.getType().copy(),
@@ -243,7 +271,7 @@ void RelTableData::pushInsertInfo(const Transaction* transaction, const CSRNodeG
 }
 
 void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
-    PageAllocator& pageAllocator) {
+    column_id_t sortColumnID, PageAllocator& pageAllocator) {
     std::vector<std::unique_ptr<Column>> checkpointColumns;
     for (auto i = 0u; i < columnIDs.size(); i++) {
         const auto columnID = columnIDs[i];
@@ -258,6 +286,7 @@ void RelTableData::checkpoint(const std::vector<column_id_t>& columnIDs,
 
     CSRNodeGroupCheckpointState state{columnIDs, std::move(checkpointColumnPtrs), pageAllocator, mm,
         csrHeaderColumns.offset.get(), csrHeaderColumns.length.get()};
+    state.sortColumnID = sortColumnID;
     nodeGroups->checkpoint(*mm, state);
 }
 
@@ -284,6 +313,14 @@ void RelTableData::rollbackGroupCollectionInsert(row_idx_t numRows_, bool isPers
     nodeGroups->rollbackInsert(numRows_, !isPersistent);
 }
 
+DegreeStats RelTableData::getDegreeStats() const {
+    DegreeStats stats;
+    for (auto i = 0u; i < getNumNodeGroups(); i++) {
+        stats.merge(getNodeGroup(i)->cast<CSRNodeGroup>().getDegreeStats());
+    }
+    return stats;
+}
+
 void RelTableData::reclaimStorage(PageAllocator& pageAllocator) const {
     nodeGroups->reclaimStorage(pageAllocator);
 }
@@ -7,6 +7,7 @@
 #include "common/vector/value_vector.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "storage/table/column_chunk_data.h"
+#include "storage/table/column_chunk_stats.h"
 #include "storage/table/dictionary_chunk.h"
 #include "storage/table/string_column.h"
 
@@ -219,6 +220,26 @@ void StringChunkData::appendStringColumnChunk(const StringChunkData* other,
 void StringChunkData::setValueFromString(std::string_view value, uint64_t pos) {
     auto index = dictionaryChunk->appendString(value);
     indexColumnChunk->setValue<DictionaryChunk::string_index_t>(index, pos);
+    inMemoryStats.update(StorageValue(StringPrefixStats::getPrefix(value)),
+        PhysicalTypeID::STRING);
+}
+
+ColumnChunkMetadata StringChunkData::getMetadataToFlush() const {
+    auto metadata = ColumnChunkData::getMetadataToFlush();
+    // The main chunk stores no data of its own, so its min and max are used to store the range
+    // of the string prefixes. The dictionary may contain strings which are no longer referenced,
+    // which only makes the range wider.
+    ColumnChunkStats prefixStats;
+    const auto numStrings = dictionaryChunk->getOffsetChunk()->getNumValues();
+    for (DictionaryChunk::string_index_t i = 0; i < numStrings; i++) {
+        const auto prefix = StringPrefixStats::getPrefix(dictionaryChunk->getString(i));
+        prefixStats.update(StorageValue(prefix), PhysicalTypeID::STRING);
+    }
+    if (prefixStats.min && prefixStats.max) {
+        metadata.compMeta.min = *prefixStats.min;
+        metadata.compMeta.max = *prefixStats.max;
+    }
+    return metadata;
 }
 
 void StringChunkData::resetNumValuesFromMetadata() {
@@ -262,6 +283,13 @@ void StringChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     dictionaryChunk->getStringDataChunk()->reclaimStorage(pageAllocator);
 }
 
+void StringChunkData::prefetchPagesAsync(FileHandle& dataFH) const {
+    ColumnChunkData::prefetchPagesAsync(dataFH);
+    indexColumnChunk->prefetchPagesAsync(dataFH);
+    dictionaryChunk->getOffsetChunk()->prefetchPagesAsync(dataFH);
+    dictionaryChunk->getStringDataChunk()->prefetchPagesAsync(dataFH);
+}
+
 uint64_t StringChunkData::getSizeOnDisk() const {
     return ColumnChunkData::getSizeOnDisk() + indexColumnChunk->getSizeOnDisk() +
            dictionaryChunk->getOffsetChunk()->getSizeOnDisk() +
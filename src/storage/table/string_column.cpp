@@ -55,11 +55,14 @@ std::unique_ptr<ColumnChunkData> StringColumn::flushChunkData(const ColumnChunkD
     auto& stringChunk = chunkData.cast<StringChunkData>();
     flushedStringData.setIndexChunk(
         Column::flushChunkData(*stringChunk.getIndexColumnChunk(), pageAllocator));
-    auto& dictChunk = stringChunk.getDictionaryChunk();
+    const auto compressedDictChunk = stringChunk.getDictionaryChunk().compressStringData();
+    auto& dictChunk =
+        compressedDictChunk ? *compressedDictChunk : stringChunk.getDictionaryChunk();
     flushedStringData.getDictionaryChunk().setOffsetChunk(
         Column::flushChunkData(*dictChunk.getOffsetChunk(), pageAllocator));
-    flushedStringData.getDictionaryChunk().setStringDataChunk(
-        Column::flushChunkData(*dictChunk.getStringDataChunk(), pageAllocator));
+    auto flushedDataChunk = Column::flushChunkData(*dictChunk.getStringDataChunk(), pageAllocator);
+    dictChunk.setStringDataCompression(flushedDataChunk->getMetadata());
+    flushedStringData.getDictionaryChunk().setStringDataChunk(std::move(flushedDataChunk));
     return flushedChunkData;
 }
 
@@ -84,6 +87,7 @@ void StringColumn::writeSegment(ColumnChunkData& persistentChunk, SegmentState&
     auto& strChunkToWriteFrom = data.cast<StringChunkData>();
     std::vector<string_index_t> indices;
     indices.resize(numValues);
+    ColumnChunkStats prefixStats;
     for (auto i = 0u; i < numValues; i++) {
         if (strChunkToWriteFrom.getNullData()->isNull(i + srcOffset)) {
             indices[i] = 0;
@@ -92,6 +96,8 @@ void StringColumn::writeSegment(ColumnChunkData& persistentChunk, SegmentState&
         const auto strVal = strChunkToWriteFrom.getValue<std::string_view>(i + srcOffset);
         indices[i] = dictionary.append(persistentChunk.cast<StringChunkData>().getDictionaryChunk(),
             state, strVal);
+        prefixStats.update(StorageValue(StringPrefixStats::getPrefix(strVal)),
+            PhysicalTypeID::STRING);
     }
     NullMask nullMask(numValues);
     nullMask.copyFromNullBits(data.getNullData()->getNullMask().getData(), srcOffset,
@@ -103,8 +109,9 @@ void StringColumn::writeSegment(ColumnChunkData& persistentChunk, SegmentState&
     auto [min, max] = std::minmax_element(indices.begin(), indices.end());
     auto minWritten = StorageValue(*min);
     auto maxWritten = StorageValue(*max);
-    updateStatistics(persistentChunk.getMetadata(), dstOffsetInSegment + numValues - 1, minWritten,
-        maxWritten);
+    // The main chunk's statistics are the bounds of the string prefixes
+    updateStatistics(persistentChunk.getMetadata(), dstOffsetInSegment + numValues - 1,
+        prefixStats.min, prefixStats.max);
     indexColumn->updateStatistics(stringPersistentChunk.getIndexColumnChunk()->getMetadata(),
         dstOffsetInSegment + numValues - 1, minWritten, maxWritten);
 }
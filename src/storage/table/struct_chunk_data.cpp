@@ -94,6 +94,13 @@ void StructChunkData::reclaimStorage(PageAllocator& pageAllocator) {
     }
 }
 
+void StructChunkData::prefetchPagesAsync(FileHandle& dataFH) const {
+    ColumnChunkData::prefetchPagesAsync(dataFH);
+    for (const auto& childChunk : childChunks) {
+        childChunk->prefetchPagesAsync(dataFH);
+    }
+}
+
 uint64_t StructChunkData::getSizeOnDisk() const {
     uint64_t size = ColumnChunkData::getSizeOnDisk();
     for (const auto& childChunk : childChunks) {
@@ -3,6 +3,7 @@
 #include "storage/storage_manager.h"
 #include "storage/table/node_table.h"
 #include "storage/table/rel_table.h"
+#include "transaction/transaction.h"
 
 using namespace ryu::common;
 
@@ -52,6 +53,11 @@ bool Table::scan(transaction::Transaction* transaction, TableScanState& scanStat
     return scanInternal(transaction, scanState);
 }
 
+void Table::increaseWriteVersion(transaction::Transaction* transaction) {
+    writeVersion.fetch_add(1);
+    transaction->addWrittenTable(tableID);
+}
+
 DataChunk Table::constructDataChunk(MemoryManager* mm, std::vector<LogicalType> types) {
     DataChunk dataChunk(types.size());
     for (auto i = 0u; i < types.size(); i++) {
@@ -1,5 +1,6 @@
 #include "storage/table/update_info.h"
 
+#include <algorithm>
 #include <bitset>
 
 #include "common/exception/runtime.h"
@@ -14,8 +15,19 @@ using namespace ryu::common;
 namespace ryu {
 namespace storage {
 
-VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transaction* transaction,
-    const idx_t vectorIdx, const sel_t rowIdxInVector, const ValueVector& values) {
+std::pair<VectorUpdateInfo*, bool> UpdateInfo::update(MemoryManager& memoryManager,
+    const Transaction* transaction, const idx_t vectorIdx, const sel_t rowIdxInVector,
+    const ValueVector& values) {
+    const auto valuePos = values.state->getSelVector()[0];
+    return update(memoryManager, transaction, vectorIdx, std::span(&rowIdxInVector, 1), values,
+        std::span(&valuePos, 1));
+}
+
+std::pair<VectorUpdateInfo*, bool> UpdateInfo::update(MemoryManager& memoryManager,
+    const Transaction* transaction, const idx_t vectorIdx, std::span<const sel_t> rowsInVector,
+    const ValueVector& values, std::span<const sel_t> valuePositions) {
+    KU_ASSERT(!rowsInVector.empty() && rowsInVector.size() == valuePositions.size());
+    KU_ASSERT(std::is_sorted(rowsInVector.begin(), rowsInVector.end()));
     UpdateNode& header = getOrCreateUpdateNode(vectorIdx);
     // We always lock the head of the chain of vectorUpdateInfo to ensure that we can safely
     // read/write to any part of the chain.
@@ -33,14 +45,16 @@ VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transac
             // Potentially there can be conflicts. `current` can be uncommitted transaction (version
             // is transaction ID) or committed transaction started after this transaction.
             for (auto i = 0u; i < current->numRowsUpdated; i++) {
-                if (current->rowsInVector[i] == rowIdxInVector) {
+                if (std::binary_search(rowsInVector.begin(), rowsInVector.end(),
+                        current->rowsInVector[i])) {
                     throw RuntimeException("Write-write conflict of updating the same row.");
                 }
             }
         }
         current = current->prev.get();
     }
-    if (!vecUpdateInfo) {
+    const auto isNewVersion = vecUpdateInfo == nullptr;
+    if (isNewVersion) {
         // Create a new version here if not found in the chain.
         auto newInfo = std::make_unique<VectorUpdateInfo>(memoryManager, transaction->getID(),
             values.dataType.copy());
@@ -53,24 +67,31 @@ VectorUpdateInfo& UpdateInfo::update(MemoryManager& memoryManager, const Transac
         header.info = std::move(newInfo);
     }
     KU_ASSERT(vecUpdateInfo);
-    // Check if the row is already updated in this transaction.
-    idx_t idxInUpdateData = INVALID_IDX;
-    for (auto i = 0u; i < vecUpdateInfo->numRowsUpdated; i++) {
-        if (vecUpdateInfo->rowsInVector[i] == rowIdxInVector) {
-            idxInUpdateData = i;
-            break;
+    for (auto i = 0u; i < rowsInVector.size(); i++) {
+        const auto rowIdxInVector = rowsInVector[i];
+        // Check if the row is already updated in this transaction. Bulk updates visit the rows of
+        // a vector in increasing order, so a row past every updated one is new and needs no
+        // search.
+        idx_t idxInUpdateData = INVALID_IDX;
+        const auto numRowsUpdated = vecUpdateInfo->numRowsUpdated;
+        const auto isAppend =
+            numRowsUpdated == 0 || vecUpdateInfo->maxRowUpdated < rowIdxInVector;
+        for (auto j = 0u; !isAppend && j < numRowsUpdated; j++) {
+            if (vecUpdateInfo->rowsInVector[j] == rowIdxInVector) {
+                idxInUpdateData = j;
+                break;
+            }
+        }
+        if (idxInUpdateData != INVALID_IDX) {
+            // Overwrite existing update value.
+            vecUpdateInfo->data->write(&values, valuePositions[i], idxInUpdateData);
+        } else {
+            // Append new value and update `rowsInVector`.
+            vecUpdateInfo->data->write(&values, valuePositions[i], vecUpdateInfo->numRowsUpdated);
+            vecUpdateInfo->appendRow(rowIdxInVector);
         }
     }
-    if (idxInUpdateData != INVALID_IDX) {
-        // Overwrite existing update value.
-        vecUpdateInfo->data->write(&values, values.state->getSelVector()[0], idxInUpdateData);
-    } else {
-        // Append new value and update `rowsInVector`.
-        vecUpdateInfo->rowsInVector[vecUpdateInfo->numRowsUpdated] = rowIdxInVector;
-        vecUpdateInfo->data->write(&values, values.state->getSelVector()[0],
-            vecUpdateInfo->numRowsUpdated++);
-    }
-    return *vecUpdateInfo;
+    return {vecUpdateInfo, isNewVersion};
 }
 
 void UpdateInfo::scan(const Transaction* transaction, ValueVector& output, offset_t offsetInChunk,
@@ -200,6 +221,66 @@ void UpdateInfo::rollback(idx_t vectorIdx, transaction_t version) {
     }
 }
 
+// Versions visible to every active and future transaction are merged into the newest of them,
+// keeping the value of the newest version for each row. Versions in between that are not visible
+// to everyone stay in the chain. Merging stops at an old version sharing a row with one of those,
+// as its value can't move ahead of the newer value.
+static void vacuumVersionChain(UpdateNode& node, transaction_t oldestActiveTS) {
+    VectorUpdateInfo* target = nullptr;
+    std::bitset<DEFAULT_VECTOR_CAPACITY> targetRows;
+    std::bitset<DEFAULT_VECTOR_CAPACITY> skippedRows;
+    auto current = node.info.get();
+    while (current) {
+        const auto older = current->getPrev();
+        if (current->version > oldestActiveTS) {
+            // Uncommitted versions are tagged with transaction IDs, which are larger than any
+            // timestamp.
+            if (target) {
+                for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                    skippedRows[current->rowsInVector[i]] = true;
+                }
+            }
+        } else if (!target) {
+            target = current;
+            for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                targetRows[current->rowsInVector[i]] = true;
+            }
+        } else {
+            for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                const auto row = current->rowsInVector[i];
+                if (skippedRows[row] && !targetRows[row]) {
+                    return;
+                }
+            }
+            for (auto i = 0u; i < current->numRowsUpdated; i++) {
+                const auto row = current->rowsInVector[i];
+                if (targetRows[row]) {
+                    continue;
+                }
+                target->data->write(current->data.get(), i, target->numRowsUpdated, 1);
+                target->appendRow(row);
+                targetRows[row] = true;
+            }
+            // Unlink the merged version from the chain, which also frees it.
+            const auto newer = current->getNext();
+            auto olderVersion = current->movePrev();
+            if (olderVersion) {
+                olderVersion->setNext(newer);
+            }
+            newer->setPrev(std::move(olderVersion));
+        }
+        current = older;
+    }
+}
+
+void UpdateInfo::vacuum(transaction_t oldestActiveTS) {
+    std::shared_lock lock{mtx};
+    for (auto& node : updates) {
+        std::unique_lock chainLock{node->mtx};
+        vacuumVersionChain(*node, oldestActiveTS);
+    }
+}
+
 row_idx_t UpdateInfo::getNumUpdatedRows(const Transaction* transaction) const {
     std::unordered_set<row_idx_t> updatedRows;
     for (auto vectorIdx = 0u; vectorIdx < updates.size(); vectorIdx++) {
@@ -220,6 +301,33 @@ bool UpdateInfo::hasUpdates(const Transaction* transaction, row_idx_t startRow,
     return hasUpdates;
 }
 
+bool UpdateInfo::isUpdatedByOtherTransaction(const Transaction* transaction,
+    row_idx_t rowInChunk) const {
+    auto [vectorIdx, rowInVector] =
+        StorageUtils::getQuotientRemainder(rowInChunk, DEFAULT_VECTOR_CAPACITY);
+    const UpdateNode* head = nullptr;
+    {
+        std::shared_lock lock{mtx};
+        if (vectorIdx >= updates.size() || !updates[vectorIdx]->isEmpty()) {
+            return false;
+        }
+        head = updates[vectorIdx].get();
+    }
+    std::shared_lock chainLock{head->mtx};
+    for (auto current = head->info.get(); current; current = current->getPrev()) {
+        if (current->version == transaction->getID() ||
+            current->version <= transaction->getStartTS()) {
+            continue;
+        }
+        for (auto i = 0u; i < current->numRowsUpdated; i++) {
+            if (current->rowsInVector[i] == rowInVector) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 UpdateNode& UpdateInfo::getUpdateNode(idx_t vectorIdx) {
     std::shared_lock lock{mtx};
     if (vectorIdx >= updates.size()) {
@@ -53,6 +53,7 @@ struct VectorVersionInfo {
 
     // Given startTS and transactionID, if the row is deleted to the transaction, return true.
     bool isDeleted(transaction_t startTS, transaction_t transactionID, row_idx_t rowIdx) const;
+    bool isDeletedByOtherTransaction(transaction_t transactionID, row_idx_t rowIdx) const;
     // Given startTS and transactionID, if the row is readable to the transaction, return true.
     bool isInserted(transaction_t startTS, transaction_t transactionID, row_idx_t rowIdx) const;
 
@@ -189,6 +190,20 @@ void VectorVersionInfo::getSelVectorForScan(const transaction_t startTS,
     }
 }
 
+bool VectorVersionInfo::isDeletedByOtherTransaction(const transaction_t transactionID,
+    const row_idx_t rowIdx) const {
+    if (deletionStatus == DeletionStatus::NO_DELETED) {
+        return false;
+    }
+    transaction_t deletion = INVALID_TRANSACTION;
+    if (isSameDeletionVersion()) {
+        deletion = sameDeletionVersion;
+    } else if (deletedVersions) {
+        deletion = deletedVersions->operator[](rowIdx);
+    }
+    return deletion != INVALID_TRANSACTION && deletion != transactionID;
+}
+
 bool VectorVersionInfo::isDeleted(const transaction_t startTS, const transaction_t transactionID,
     const row_idx_t rowIdx) const {
     switch (deletionStatus) {
@@ -572,6 +587,17 @@ bool VersionInfo::isDeleted(const transaction::Transaction* transaction,
     return false;
 }
 
+bool VersionInfo::isDeletedByOtherTransaction(const transaction::Transaction* transaction,
+    row_idx_t rowInChunk) const {
+    auto [vectorIdx, rowInVector] =
+        StorageUtils::getQuotientRemainder(rowInChunk, DEFAULT_VECTOR_CAPACITY);
+    const auto vectorVersion = getVectorVersionInfo(vectorIdx);
+    if (!vectorVersion) {
+        return false;
+    }
+    return vectorVersion->isDeletedByOtherTransaction(transaction->getID(), rowInVector);
+}
+
 bool VersionInfo::isInserted(const transaction::Transaction* transaction,
     row_idx_t rowInChunk) const {
     auto [vectorIdx, rowInVector] =
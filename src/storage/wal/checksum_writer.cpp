@@ -27,6 +27,7 @@ void ChecksumWriter::write(const uint8_t* data, uint64_t size) {
     if (currentEntrySize.has_value()) {
         resizeBufferIfNeeded(entryBuffer, *currentEntrySize + size);
         std::memcpy(entryBuffer->getData() + *currentEntrySize, data, size);
+        currentEntryChecksum.update(data, size);
         *currentEntrySize += size;
     } else {
         // The data we are writing does not need to be checksummed
@@ -45,11 +46,12 @@ void ChecksumWriter::flush() {
 
 void ChecksumWriter::onObjectBegin() {
     currentEntrySize.emplace(0);
+    currentEntryChecksum = common::IncrementalChecksum{};
 }
 
 void ChecksumWriter::onObjectEnd() {
     KU_ASSERT(currentEntrySize.has_value());
-    const auto checksum = common::checksum(entryBuffer->getData(), *currentEntrySize);
+    const auto checksum = currentEntryChecksum.finish();
     outputSerializer.write(entryBuffer->getData(), *currentEntrySize);
     outputSerializer.serializeValue(checksum);
     currentEntrySize.reset();
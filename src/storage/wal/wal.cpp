@@ -1,11 +1,14 @@
 #include "storage/wal/wal.h"
 
+#include <thread>
+
 #include "common/file_system/file_info.h"
 #include "common/file_system/virtual_file_system.h"
 #include "common/serializer/buffered_file.h"
 #include "common/serializer/in_mem_file_writer.h"
 #include "main/client_context.h"
 #include "main/database.h"
+#include "main/database_metrics.h"
 #include "main/db_config.h"
 #include "storage/file_db_id_utils.h"
 #include "storage/storage_manager.h"
@@ -30,28 +33,83 @@ void WAL::logCommittedWAL(LocalWAL& localWAL, main::ClientContext* context) {
     if (inMemory || localWAL.getSize() == 0) {
         return; // No need to log empty WAL.
     }
+    const auto metrics = context->getDatabase()->getMetrics();
+    metrics->numWALBytes.increase(localWAL.getSize());
     std::unique_lock lck{mtx};
     initWriter(context);
     localWAL.inMemWriter->flush(*serializer->getWriter());
-    flushAndSyncNoLock();
+    numAppendedCommits++;
+    if (!context->getDBConfig()->enableGroupCommit) {
+        flushAndSyncNoLock();
+        metrics->numWALSyncs.increase();
+    }
+}
+
+uint64_t WAL::getLastCommitNumber() {
+    std::unique_lock lck{mtx};
+    return numAppendedCommits;
+}
+
+void WAL::waitForCommitDurable(uint64_t commitNumber, main::ClientContext* context) {
+    std::unique_lock lck{mtx};
+    while (numSyncedCommits < commitNumber) {
+        if (syncInProgress) {
+            syncCV.wait(lck);
+            continue;
+        }
+        syncInProgress = true;
+        const auto delay = context->getDBConfig()->groupCommitDelayInMicros;
+        if (delay > 0) {
+            lck.unlock();
+            std::this_thread::sleep_for(std::chrono::microseconds(delay));
+            lck.lock();
+        }
+        const auto batchEnd = numAppendedCommits;
+        try {
+            serializer->getWriter()->flush();
+            // Other committers only append to the writer's buffer, so they can keep appending to
+            // the next batch while this one is being synced. The writer can't be cleared or reset
+            // until syncInProgress is unset.
+            lck.unlock();
+            serializer->getWriter()->sync();
+            context->getDatabase()->getMetrics()->numWALSyncs.increase();
+            lck.lock();
+        } catch (...) {
+            if (!lck.owns_lock()) {
+                lck.lock();
+            }
+            syncInProgress = false;
+            syncCV.notify_all();
+            throw;
+        }
+        numSyncedCommits = std::max(numSyncedCommits, batchEnd);
+        syncInProgress = false;
+        syncCV.notify_all();
+    }
 }
 
 void WAL::logAndFlushCheckpoint(main::ClientContext* context) {
     std::unique_lock lck{mtx};
+    waitForSyncToFinishNoLock(lck);
     initWriter(context);
     CheckpointRecord walRecord;
     addNewWALRecordNoLock(walRecord);
     flushAndSyncNoLock();
+    context->getDatabase()->getMetrics()->numWALSyncs.increase();
 }
 
 // NOLINTNEXTLINE(readability-make-member-function-const): semantically non-const function.
 void WAL::clear() {
     std::unique_lock lck{mtx};
+    waitForSyncToFinishNoLock(lck);
     serializer->getWriter()->clear();
+    numSyncedCommits = numAppendedCommits;
 }
 
 void WAL::reset() {
     std::unique_lock lck{mtx};
+    waitForSyncToFinishNoLock(lck);
+    numSyncedCommits = numAppendedCommits;
     fileInfo.reset();
     serializer.reset();
     vfs->removeFileIfExists(walPath);
@@ -61,6 +119,11 @@ void WAL::reset() {
 void WAL::flushAndSyncNoLock() {
     serializer->getWriter()->flush();
     serializer->getWriter()->sync();
+    numSyncedCommits = numAppendedCommits;
+}
+
+void WAL::waitForSyncToFinishNoLock(std::unique_lock<std::mutex>& lck) {
+    syncCV.wait(lck, [&] { return !syncInProgress; });
 }
 
 uint64_t WAL::getFileSize() {
@@ -68,6 +131,15 @@ uint64_t WAL::getFileSize() {
     return serializer->getWriter()->getSize();
 }
 
+void WAL::copyTo(const std::string& path) {
+    std::unique_lock lck{mtx};
+    waitForSyncToFinishNoLock(lck);
+    if (serializer != nullptr) {
+        serializer->getWriter()->flush();
+    }
+    vfs->copyFile(walPath, path);
+}
+
 void WAL::writeHeader(main::ClientContext& context) {
     serializer->getWriter()->onObjectBegin();
     FileDBIDUtils::writeDatabaseID(*serializer,
@@ -1,10 +1,17 @@
 #include "storage/wal/wal_replayer.h"
 
+#include <deque>
+#ifndef __SINGLE_THREADED__
+#include <condition_variable>
+#include <thread>
+#endif
+
 #include "binder/binder.h"
 #include "catalog/catalog_entry/scalar_macro_catalog_entry.h"
 #include "catalog/catalog_entry/sequence_catalog_entry.h"
 #include "catalog/catalog_entry/table_catalog_entry.h"
 #include "catalog/catalog_entry/type_catalog_entry.h"
+#include "common/copy_constructors.h"
 #include "common/file_system/file_info.h"
 #include "common/file_system/file_system.h"
 #include "common/file_system/virtual_file_system.h"
@@ -52,11 +59,9 @@ static WALHeader readWALHeader(Deserializer& deserializer) {
     return header;
 }
 
-static Deserializer initDeserializer(FileInfo& fileInfo, main::ClientContext& clientContext,
-    bool enableChecksums) {
+static Deserializer initDeserializer(FileInfo& fileInfo, bool enableChecksums) {
     if (enableChecksums) {
-        return Deserializer{std::make_unique<ChecksumReader>(fileInfo,
-            *MemoryManager::Get(clientContext), checksumMismatchMessage)};
+        return Deserializer{std::make_unique<ChecksumReader>(fileInfo, checksumMismatchMessage)};
     } else {
         return Deserializer{std::make_unique<BufferedFileReader>(fileInfo)};
     }
@@ -81,6 +86,128 @@ static uint64_t getReadOffset(Deserializer& deSer, bool enableChecksums) {
     }
 }
 
+static void resetReadOffset(Deserializer& deSer, uint64_t offset, bool enableChecksums) {
+    if (enableChecksums) {
+        deSer.getReader()->cast<ChecksumReader>()->resetReadOffset(offset);
+    } else {
+        deSer.getReader()->cast<BufferedFileReader>()->resetReadOffset(offset);
+    }
+}
+
+namespace {
+// Reads the WAL records up to a given offset ahead of the thread applying them. Reading the file,
+// verifying checksums and deserializing records is done on a separate thread, so that it overlaps
+// with applying the previous records. Records are applied in order by the caller, since records of
+// different tables still depend on each other (e.g. rel insertions on node offsets and DDL on
+// earlier records), and the recovery transaction's local storage is not thread-safe.
+class WALRecordPrefetcher {
+    // Bounds the memory used by records which have been read but not applied yet
+    static constexpr uint64_t MAX_NUM_BUFFERED_RECORDS = 16;
+
+public:
+    WALRecordPrefetcher(Deserializer& deserializer, main::ClientContext& clientContext,
+        bool enableChecksums, uint64_t endOffset)
+        : deserializer{deserializer}, clientContext{clientContext},
+          enableChecksums{enableChecksums}, endOffset{endOffset} {
+#ifndef __SINGLE_THREADED__
+        readerThread = std::thread([this] { readRecords(); });
+#endif
+    }
+    DELETE_COPY_AND_MOVE(WALRecordPrefetcher);
+
+    ~WALRecordPrefetcher() {
+#ifndef __SINGLE_THREADED__
+        {
+            std::unique_lock lck{mtx};
+            stopped = true;
+        }
+        cv.notify_all();
+        readerThread.join();
+#endif
+    }
+
+    // Returns the next record, or nullptr once all records up to endOffset have been returned. The
+    // previously returned record must have been applied when this is called.
+    std::unique_ptr<WALRecord> next() {
+#ifdef __SINGLE_THREADED__
+        if (getReadOffset(deserializer, enableChecksums) >= endOffset) {
+            return nullptr;
+        }
+        return WALRecord::deserialize(deserializer, clientContext);
+#else
+        std::unique_lock lck{mtx};
+        numAppliedRecords = numReturnedRecords;
+        cv.notify_all();
+        cv.wait(lck, [&] { return !records.empty() || finished; });
+        if (records.empty()) {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return nullptr;
+        }
+        auto record = std::move(records.front());
+        records.pop_front();
+        numReturnedRecords++;
+        cv.notify_all();
+        return record;
+#endif
+    }
+
+private:
+#ifndef __SINGLE_THREADED__
+    void readRecords() {
+        try {
+            uint64_t numReadRecords = 0;
+            while (getReadOffset(deserializer, enableChecksums) < endOffset) {
+                KU_ASSERT(!deserializer.finished());
+                auto record = WALRecord::deserialize(deserializer, clientContext);
+                // Later records may depend on the extension being loaded, so they are only read
+                // once it has been applied
+                const bool isBarrier = record->type == WALRecordType::LOAD_EXTENSION_RECORD;
+                numReadRecords++;
+                std::unique_lock lck{mtx};
+                cv.wait(lck, [&] { return records.size() < MAX_NUM_BUFFERED_RECORDS || stopped; });
+                if (stopped) {
+                    return;
+                }
+                records.push_back(std::move(record));
+                cv.notify_all();
+                if (isBarrier) {
+                    cv.wait(lck, [&] { return numAppliedRecords >= numReadRecords || stopped; });
+                    if (stopped) {
+                        return;
+                    }
+                }
+            }
+        } catch (...) {
+            std::unique_lock lck{mtx};
+            exception = std::current_exception();
+        }
+        std::unique_lock lck{mtx};
+        finished = true;
+        cv.notify_all();
+    }
+#endif
+
+private:
+    Deserializer& deserializer;
+    main::ClientContext& clientContext;
+    bool enableChecksums;
+    uint64_t endOffset;
+#ifndef __SINGLE_THREADED__
+    std::thread readerThread;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<std::unique_ptr<WALRecord>> records;
+    uint64_t numReturnedRecords = 0;
+    uint64_t numAppliedRecords = 0;
+    bool finished = false;
+    bool stopped = false;
+    std::exception_ptr exception;
+#endif
+};
+} // namespace
+
 void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) const {
     auto vfs = VirtualFileSystem::GetUnsafe(clientContext);
     Checkpointer checkpointer(clientContext);
@@ -109,7 +236,7 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
         // First, we dry run the replay to find out the offset of the last record that was
         // CHECKPOINT or COMMIT.
         auto [offsetDeserialized, isLastRecordCheckpoint] =
-            dryReplay(*fileInfo, throwOnWalReplayFailure, enableChecksums);
+            dryReplay(*fileInfo, 0 /* startOffset */, throwOnWalReplayFailure, enableChecksums);
         if (isLastRecordCheckpoint) {
             // If the last record is a checkpoint, we resume by replaying the shadow file.
             ShadowFile::replayShadowPageRecords(clientContext);
@@ -122,52 +249,98 @@ void WALReplayer::replay(bool throwOnWalReplayFailure, bool enableChecksums) con
             // Read the checkpointed data from the disk.
             checkpointer.readCheckpoint();
             // Resume by replaying the WAL file from the beginning until the last COMMIT record.
-            Deserializer deserializer = initDeserializer(*fileInfo, clientContext, enableChecksums);
-
-            if (offsetDeserialized > 0) {
-                // Make sure the WAL file is for the current database
-                deserializer.getReader()->onObjectBegin();
-                const auto walHeader = readWALHeader(deserializer);
-                FileDBIDUtils::verifyDatabaseID(*fileInfo,
-                    StorageManager::Get(clientContext)->getOrInitDatabaseID(clientContext),
-                    walHeader.databaseID);
-                deserializer.getReader()->onObjectEnd();
-            }
-
-            while (getReadOffset(deserializer, enableChecksums) < offsetDeserialized) {
-                KU_ASSERT(!deserializer.finished());
-                auto walRecord = WALRecord::deserialize(deserializer, clientContext);
-                replayWALRecord(*walRecord);
-            }
+            replayCommittedRecords(*fileInfo, 0 /* startOffset */, offsetDeserialized,
+                enableChecksums);
             // After replaying all the records, we should truncate the WAL file to the last
             // COMMIT/CHECKPOINT record.
             truncateWALFile(*fileInfo, offsetDeserialized);
         }
     } catch (const std::exception&) {
-        auto transactionContext = TransactionContext::Get(clientContext);
-        if (transactionContext->hasActiveTransaction()) {
-            // Handle the case that some transaction went during replaying. We should roll back
-            // under this case. Usually this shouldn't happen, but it is possible if we have a bug
-            // with the replay logic. This is to handle cases like that so we don't corrupt
-            // transactions that have been replayed.
-            transactionContext->rollback();
-        }
+        rollbackActiveTransaction();
         throw;
     }
 }
 
-WALReplayer::WALReplayInfo WALReplayer::dryReplay(FileInfo& fileInfo, bool throwOnWalReplayFailure,
-    bool enableChecksums) const {
-    uint64_t offsetDeserialized = 0;
-    bool isLastRecordCheckpoint = false;
+uint64_t WALReplayer::tail(uint64_t startOffset, bool enableChecksums) const {
+    auto vfs = VirtualFileSystem::GetUnsafe(clientContext);
+    if (!vfs->fileOrPathExists(walPath, &clientContext)) {
+        return startOffset;
+    }
+    auto fileInfo = openWALFile();
+    if (fileInfo->getFileSize() <= startOffset) {
+        return startOffset;
+    }
     try {
-        Deserializer deserializer = initDeserializer(fileInfo, clientContext, enableChecksums);
+        // The writer may be appending a transaction, so the records after the last COMMIT record
+        // are expected to be incomplete.
+        auto [offsetDeserialized, isLastRecordCheckpoint] = dryReplay(*fileInfo, startOffset,
+            false /* throwOnWalReplayFailure */, enableChecksums);
+        if (isLastRecordCheckpoint) {
+            throw RuntimeException(
+                "Cannot refresh the read replica while the database has an unfinished checkpoint. "
+                "Please re-open the database in read-write mode to recover it.");
+        }
+        if (offsetDeserialized <= startOffset) {
+            return startOffset;
+        }
+        replayCommittedRecords(*fileInfo, startOffset, offsetDeserialized, enableChecksums);
+        return offsetDeserialized;
+    } catch (const std::exception&) {
+        rollbackActiveTransaction();
+        throw;
+    }
+}
 
-        // Skip the databaseID here, we'll verify it when we actually replay
+void WALReplayer::replayCommittedRecords(FileInfo& fileInfo, uint64_t startOffset,
+    uint64_t endOffset, bool enableChecksums) const {
+    if (endOffset <= startOffset) {
+        return;
+    }
+    Deserializer deserializer = initDeserializer(fileInfo, enableChecksums);
+    if (startOffset == 0) {
+        // Make sure the WAL file is for the current database
         deserializer.getReader()->onObjectBegin();
         const auto walHeader = readWALHeader(deserializer);
-        checkWALHeader(walHeader, enableChecksums);
+        FileDBIDUtils::verifyDatabaseID(fileInfo,
+            StorageManager::Get(clientContext)->getOrInitDatabaseID(clientContext),
+            walHeader.databaseID);
         deserializer.getReader()->onObjectEnd();
+    } else {
+        resetReadOffset(deserializer, startOffset, enableChecksums);
+    }
+    WALRecordPrefetcher prefetcher{deserializer, clientContext, enableChecksums, endOffset};
+    while (auto walRecord = prefetcher.next()) {
+        replayWALRecord(*walRecord);
+    }
+}
+
+void WALReplayer::rollbackActiveTransaction() const {
+    auto transactionContext = TransactionContext::Get(clientContext);
+    if (transactionContext->hasActiveTransaction()) {
+        // Handle the case that some transaction went during replaying. We should roll back
+        // under this case. Usually this shouldn't happen, but it is possible if we have a bug
+        // with the replay logic. This is to handle cases like that so we don't corrupt
+        // transactions that have been replayed.
+        transactionContext->rollback();
+    }
+}
+
+WALReplayer::WALReplayInfo WALReplayer::dryReplay(FileInfo& fileInfo, uint64_t startOffset,
+    bool throwOnWalReplayFailure, bool enableChecksums) const {
+    uint64_t offsetDeserialized = 0;
+    bool isLastRecordCheckpoint = false;
+    try {
+        Deserializer deserializer = initDeserializer(fileInfo, enableChecksums);
+
+        if (startOffset == 0) {
+            // Skip the databaseID here, we'll verify it when we actually replay
+            deserializer.getReader()->onObjectBegin();
+            const auto walHeader = readWALHeader(deserializer);
+            checkWALHeader(walHeader, enableChecksums);
+            deserializer.getReader()->onObjectEnd();
+        } else {
+            resetReadOffset(deserializer, startOffset, enableChecksums);
+        }
 
         bool finishedDeserializing = deserializer.finished();
         while (!finishedDeserializing) {
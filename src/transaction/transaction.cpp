@@ -65,6 +65,7 @@ void Transaction::commit(storage::WAL* wal) {
     undoBuffer->commit(commitTS);
     if (shouldLogToWAL()) {
         KU_ASSERT(localWAL && wal);
+        logSequenceChanges();
         localWAL->logCommit();
         wal->logCommittedWAL(*localWAL, clientContext);
         localWAL->clear();
@@ -82,6 +83,8 @@ void Transaction::rollback(storage::WAL*) {
     undoBuffer->rollback(clientContext);
     localStorage->rollback();
     hasCatalogChanges = false;
+    std::unique_lock lck{sequenceChangesMtx};
+    sequenceChanges.clear();
 }
 
 bool Transaction::isUnCommitted(common::table_id_t tableID, common::offset_t nodeOffset) const {
@@ -97,6 +100,8 @@ void Transaction::pushCreateDropCatalogEntry(CatalogSet& catalogSet, CatalogEntr
         return;
     }
     KU_ASSERT(localWAL);
+    // E.g. a sequence must be advanced before it's dropped when the WAL is replayed.
+    logSequenceChanges();
     const auto newCatalogEntry = catalogEntry.getNext();
     switch (newCatalogEntry->getType()) {
     case CatalogEntryType::INDEX_ENTRY:
@@ -169,17 +174,34 @@ void Transaction::pushAlterCatalogEntry(CatalogSet& catalogSet, CatalogEntry& ca
     hasCatalogChanges = true;
     if (shouldLogToWAL()) {
         KU_ASSERT(localWAL);
+        logSequenceChanges();
         localWAL->logAlterCatalogEntryRecord(&alterInfo);
     }
 }
 
+// A bulk insert into a table with a SERIAL column advances its sequence once per vector. Only the
+// first change of a sequence in a transaction is recorded for rollback, as it has the state to roll
+// back to, and the changes are summed up into one WAL record.
 void Transaction::pushSequenceChange(SequenceCatalogEntry* sequenceEntry, int64_t kCount,
     const SequenceRollbackData& data) {
-    undoBuffer->createSequenceChange(*sequenceEntry, data);
-    hasCatalogChanges = true;
-    if (shouldLogToWAL()) {
-        KU_ASSERT(localWAL);
-        localWAL->logUpdateSequenceRecord(sequenceEntry->getOID(), kCount);
+    std::unique_lock lck{sequenceChangesMtx};
+    const auto [it, isFirstChange] = sequenceChanges.try_emplace(sequenceEntry, 0);
+    if (isFirstChange) {
+        undoBuffer->createSequenceChange(*sequenceEntry, data);
+        hasCatalogChanges = true;
+    }
+    it->second += kCount;
+}
+
+void Transaction::logSequenceChanges() {
+    std::unique_lock lck{sequenceChangesMtx};
+    for (auto& [sequenceEntry, kCount] : sequenceChanges) {
+        if (kCount > 0 && shouldLogToWAL()) {
+            KU_ASSERT(localWAL);
+            localWAL->logUpdateSequenceRecord(sequenceEntry->getOID(), kCount);
+        }
+        // The entry is kept, as its change is already recorded for rollback.
+        kCount = 0;
     }
 }
 
@@ -4,11 +4,14 @@
 
 #include "common/exception/checkpoint.h"
 #include "common/exception/transaction_manager.h"
+#include "common/timer.h"
 #include "main/attached_database.h"
 #include "main/client_context.h"
 #include "main/database.h"
+#include "main/database_metrics.h"
 #include "main/db_config.h"
 #include "storage/checkpointer.h"
+#include "storage/storage_manager.h"
 #include "storage/wal/local_wal.h"
 
 using namespace ryu::common;
@@ -17,18 +20,30 @@ using namespace ryu::storage;
 namespace ryu {
 namespace transaction {
 
+TransactionManager::~TransactionManager() {
+    if (vacuumThread.joinable()) {
+        {
+            std::unique_lock lck{vacuumThreadMtx};
+            stopVacuumThread = true;
+        }
+        vacuumThreadCV.notify_all();
+        vacuumThread.join();
+    }
+}
+
 Transaction* TransactionManager::beginTransaction(main::ClientContext& clientContext,
     TransactionType type) {
+    if (type == TransactionType::READ_ONLY && clientContext.getDBConfig()->enableReadReplica) {
+        return beginReplicaTransaction(clientContext);
+    }
     // We acquire the lock for starting new transactions. In case this cannot be acquired, this
     // ensures calls to other public functions are not restricted.
     std::unique_lock publicFunctionLck{mtxForSerializingPublicFunctionCalls};
     std::unique_lock newTransactionLck{mtxForStartingNewTransactions};
     switch (type) {
     case TransactionType::READ_ONLY: {
-        auto transaction =
-            std::make_unique<Transaction>(clientContext, type, ++lastTransactionID, lastTimestamp);
-        activeTransactions.push_back(std::move(transaction));
-        return activeTransactions.back().get();
+        return addActiveTransactionNoLock(
+            std::make_unique<Transaction>(clientContext, type, ++lastTransactionID, lastTimestamp));
     }
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
@@ -42,8 +57,7 @@ Transaction* TransactionManager::beginTransaction(main::ClientContext& clientCon
         if (transaction->shouldLogToWAL()) {
             transaction->getLocalWAL().logBeginTransaction();
         }
-        activeTransactions.push_back(std::move(transaction));
-        return activeTransactions.back().get();
+        return addActiveTransactionNoLock(std::move(transaction));
     }
         // LCOV_EXCL_START
     default: {
@@ -53,24 +67,81 @@ Transaction* TransactionManager::beginTransaction(main::ClientContext& clientCon
     }
 }
 
+Transaction* TransactionManager::beginReplicaTransaction(main::ClientContext& clientContext) {
+    std::unique_lock replicaLck{mtxForReplica};
+    {
+        std::unique_lock publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+        std::unique_lock newTransactionLck{mtxForStartingNewTransactions};
+        if (replicaCheckpointLock != nullptr) {
+            // Other transactions are active, so this one reads the same state as they do.
+            return addActiveTransactionNoLock(std::make_unique<Transaction>(clientContext,
+                TransactionType::READ_ONLY, ++lastTransactionID, lastTimestamp));
+        }
+    }
+    // Replaying takes the public function mutex itself, so it's not held here.
+    auto checkpointLock = std::make_unique<CheckpointLock>(clientContext.getDatabasePath(),
+        clientContext, false /* exclusive */);
+    StorageManager::Get(clientContext)->refreshReplica(clientContext, *checkpointLock);
+    std::unique_lock publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+    std::unique_lock newTransactionLck{mtxForStartingNewTransactions};
+    replicaCheckpointLock = std::move(checkpointLock);
+    return addActiveTransactionNoLock(std::make_unique<Transaction>(clientContext,
+        TransactionType::READ_ONLY, ++lastTransactionID, lastTimestamp));
+}
+
+bool TransactionManager::hasCommitsSince(transaction_t timestamp,
+    const std::vector<table_id_t>& tableIDs) {
+    std::unique_lock lck{mtxForSerializingPublicFunctionCalls};
+    if (catalogCommitTimestamp > timestamp) {
+        return true;
+    }
+    for (const auto tableID : tableIDs) {
+        const auto it = tableCommitTimestamps.find(tableID);
+        if (it != tableCommitTimestamps.end() && it->second > timestamp) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void TransactionManager::commit(main::ClientContext& clientContext, Transaction* transaction) {
     std::unique_lock lck{mtxForSerializingPublicFunctionCalls};
     clientContext.cleanUp();
     switch (transaction->getType()) {
     case TransactionType::READ_ONLY: {
         clearTransactionNoLock(transaction->getID());
+        if (activeTransactions.empty()) {
+            replicaCheckpointLock.reset();
+        }
+        clientContext.getDatabase()->getMetrics()->numCommittedTransactions.increase();
     } break;
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
-        lastTimestamp++;
-        transaction->commitTS = lastTimestamp;
+        clientContext.getDatabase()->getMetrics()->numCommittedTransactions.increase();
+        // Lock-free readers may see the timestamp before the changes are committed. Transactions
+        // only start once the commit is done, so they still see all changes up to it.
+        const auto commitTS = lastTimestamp.fetch_add(1, std::memory_order_acq_rel) + 1;
+        transaction->commitTS = commitTS;
+        const auto changesCatalog = transaction->changesCatalog();
         transaction->commit(&wal);
+        for (const auto tableID : transaction->getWrittenTables()) {
+            tableCommitTimestamps[tableID] = commitTS;
+        }
+        if (changesCatalog) {
+            catalogCommitTimestamp = commitTS;
+        }
+        const auto commitNumber = wal.getLastCommitNumber();
         auto shouldCheckpoint = transaction->shouldForceCheckpoint() ||
-                                Checkpointer::canAutoCheckpoint(clientContext, *transaction);
+                                (Checkpointer::canAutoCheckpoint(clientContext, *transaction) &&
+                                    !shouldDeferAutoCheckpointNoLock(clientContext, *transaction));
         clearTransactionNoLock(transaction->getID());
         if (shouldCheckpoint) {
             checkpointNoLock(clientContext);
         }
+        // With group commit, the WAL is synced after other transactions are allowed to commit so
+        // that commits which arrive in the meantime can share the same sync.
+        lck.unlock();
+        wal.waitForCommitDurable(commitNumber, &clientContext);
     } break;
         // LCOV_EXCL_START
     default: {
@@ -86,9 +157,13 @@ void TransactionManager::commit(main::ClientContext& clientContext, Transaction*
 void TransactionManager::rollback(main::ClientContext& clientContext, Transaction* transaction) {
     std::unique_lock lck{mtxForSerializingPublicFunctionCalls};
     clientContext.cleanUp();
+    clientContext.getDatabase()->getMetrics()->numRolledBackTransactions.increase();
     switch (transaction->getType()) {
     case TransactionType::READ_ONLY: {
         clearTransactionNoLock(transaction->getID());
+        if (activeTransactions.empty()) {
+            replicaCheckpointLock.reset();
+        }
     } break;
     case TransactionType::RECOVERY:
     case TransactionType::WRITE: {
@@ -103,12 +178,48 @@ void TransactionManager::rollback(main::ClientContext& clientContext, Transactio
 
 void TransactionManager::checkpoint(main::ClientContext& clientContext) {
     UniqLock lck{mtxForSerializingPublicFunctionCalls};
-    if (clientContext.isInMemory()) {
+    if (clientContext.isInMemory() &&
+        !StorageManager::Get(clientContext)->hasCompactableNodeGroups()) {
         return;
     }
     checkpointNoLock(clientContext);
 }
 
+void TransactionManager::startUpdateVacuumer(StorageManager& storageManager) {
+#ifndef __SINGLE_THREADED__
+    KU_ASSERT(!vacuumThread.joinable());
+    vacuumThread = std::thread([this, &storageManager] {
+        std::unique_lock lck{vacuumThreadMtx};
+        while (!vacuumThreadCV.wait_for(lck,
+            std::chrono::microseconds(UPDATE_VACUUM_INTERVAL_IN_MICROS),
+            [this] { return stopVacuumThread; })) {
+            lck.unlock();
+            try {
+                vacuumUpdates(storageManager);
+            } catch (...) {} // NOLINT: Versions are kept until the next try or checkpoint.
+            lck.lock();
+        }
+    });
+#else
+    KU_UNUSED(storageManager);
+#endif
+}
+
+void TransactionManager::vacuumUpdates(StorageManager& storageManager) {
+    std::unique_lock publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+    const auto oldestActiveTS = getOldestActiveStartTSNoLock();
+    // Transactions starting from now on see at least the same versions, so the timestamp stays
+    // valid after new transactions are allowed in again.
+    std::unique_lock vacuumLck{mtxForVacuum};
+    publicFunctionLck.unlock();
+    storageManager.vacuumUpdates(oldestActiveTS);
+}
+
+void TransactionManager::runWithoutCheckpoint(const std::function<void()>& func) {
+    std::unique_lock vacuumLck{mtxForVacuum};
+    func();
+}
+
 TransactionManager* TransactionManager::Get(const main::ClientContext& context) {
     if (context.getAttachedDatabase() != nullptr) {
         context.getAttachedDatabase()->getTransactionManager();
@@ -141,6 +252,18 @@ bool TransactionManager::hasNoActiveTransactions() const {
     return activeTransactions.empty();
 }
 
+bool TransactionManager::shouldDeferAutoCheckpointNoLock(const main::ClientContext& clientContext,
+    const Transaction& transaction) const {
+    // The checkpoint would have to wait for the other transactions to leave, while blocking new
+    // transactions from starting. Leave it to a later commit at which the system is idle instead.
+    const auto hasOtherActiveTransactions = std::ranges::any_of(activeTransactions,
+        [&](const auto& activeTransaction) {
+            return activeTransaction->getID() != transaction.getID();
+        });
+    return hasOtherActiveTransactions &&
+           Checkpointer::canDeferAutoCheckpoint(clientContext, transaction);
+}
+
 bool TransactionManager::hasActiveWriteTransactionNoLock() const {
     return std::ranges::any_of(activeTransactions,
         [](const auto& transaction) { return transaction->isWriteTransaction(); });
@@ -154,6 +277,22 @@ void TransactionManager::clearTransactionNoLock(transaction_t transactionID) {
     std::erase_if(activeTransactions, [transactionID](const auto& activeTransaction) {
         return activeTransaction->getID() == transactionID;
     });
+    numActiveTransactions.store(activeTransactions.size(), std::memory_order_relaxed);
+}
+
+Transaction* TransactionManager::addActiveTransactionNoLock(
+    std::unique_ptr<Transaction> transaction) {
+    activeTransactions.push_back(std::move(transaction));
+    numActiveTransactions.store(activeTransactions.size(), std::memory_order_relaxed);
+    return activeTransactions.back().get();
+}
+
+transaction_t TransactionManager::getOldestActiveStartTSNoLock() const {
+    auto oldestStartTS = lastTimestamp.load(std::memory_order_relaxed);
+    for (const auto& transaction : activeTransactions) {
+        oldestStartTS = std::min(oldestStartTS, transaction->getStartTS());
+    }
+    return oldestStartTS;
 }
 
 std::unique_ptr<Checkpointer> TransactionManager::initCheckpointer(
@@ -169,18 +308,34 @@ void TransactionManager::checkpointNoLock(main::ClientContext& clientContext) {
     // will only return results or error after all threads working on the tasks of a
     // query stop working on the tasks of the query and these tasks are removed from the
     // query.
+    const auto metrics = clientContext.getDatabase()->getMetrics();
+    Timer timer;
+    timer.start();
     try {
         auto lockForStartingTransaction = stopNewTransactionsAndWaitUntilAllTransactionsLeave();
     } catch (std::exception& e) {
         throw CheckpointException{e};
     }
+    timer.stop();
+    metrics->checkpointWaitDuration.observe(timer.getDuration());
+    std::unique_lock vacuumLck{mtxForVacuum};
     auto checkpointer = initCheckpointerFunc(clientContext);
+    timer.start();
     try {
         checkpointer->writeCheckpoint();
     } catch (std::exception& e) {
         checkpointer->rollback();
         throw CheckpointException{e};
     }
+    timer.stop();
+    metrics->checkpointDuration.observe(timer.getDuration());
+    // Pages are offloaded once the checkpoint is complete, so a failed upload doesn't roll it
+    // back. The pages are offloaded by the next checkpoint instead.
+    StorageManager::Get(clientContext)->offloadColdPages(clientContext);
+    // The snapshot only speeds up restarts, so failing to write it doesn't fail the checkpoint.
+    try {
+        StorageManager::Get(clientContext)->saveBufferPoolSnapshot(clientContext);
+    } catch (std::exception&) {} // NOLINT
 }
 
 } // namespace transaction
@@ -3,6 +3,7 @@
 
 #include "main/connection.h"
 #include "main/database.h"
+#include "main/query_result/materialized_query_result.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -12,6 +13,7 @@
 
 #include "api_test/api_test.h"
 #include "common/exception/io.h"
+#include "parser/parser.h"
 
 using namespace ryu::common;
 using namespace ryu::main;
@@ -29,6 +31,119 @@ TEST_F(ApiTest, BasicConnect) {
     assertMatchPersonCountStar(conn.get());
 }
 
+TEST_F(ApiTest, ParsedStatementCacheAcrossConnections) {
+    auto query = "MATCH (t:cacheTest) RETURN COUNT(*)";
+    ASSERT_FALSE(conn->query(query)->isSuccess());
+    auto conn2 = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(conn2->query("CREATE NODE TABLE cacheTest(id INT64 PRIMARY KEY)")->isSuccess());
+    ASSERT_TRUE(conn2->query("CREATE (:cacheTest {id: 1})")->isSuccess());
+    // The statement parsed for the first connection is bound against the new catalog.
+    auto result = conn2->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+}
+
+#ifndef __SINGLE_THREADED__
+TEST_F(ApiTest, ParserWarmUp) {
+    // Opening a database warms up the parser in the background, and closing it waits for the
+    // warm-up to finish.
+    conn.reset();
+    database.reset();
+    ASSERT_TRUE(ryu::parser::Parser::isWarmedUp());
+}
+#endif
+
+TEST_F(ApiTest, QueryResultCache) {
+    ASSERT_TRUE(conn->query("CALL query_result_cache=true")->isSuccess());
+    auto query = "MATCH (a:person) WHERE a.age > 20 RETURN COUNT(*)";
+    auto getTable = [](const QueryResult& result) {
+        return &result.constCast<MaterializedQueryResult>().getFactorizedTable();
+    };
+    auto result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 6);
+    auto cachedResult = conn->query(query);
+    ASSERT_EQ(getTable(*cachedResult), getTable(*result));
+    ASSERT_EQ(cachedResult->getNext()->getValue(0)->getValue<int64_t>(), 6);
+    // Commits which don't write to person keep the result.
+    auto conn2 = std::make_unique<Connection>(database.get());
+    ASSERT_TRUE(conn2->query("MATCH (o:organisation) DETACH DELETE o")->isSuccess());
+    ASSERT_EQ(getTable(*conn->query(query)), getTable(*result));
+    ASSERT_TRUE(conn2->query("MATCH (a:person) WHERE a.ID = 0 DETACH DELETE a")->isSuccess());
+    auto newResult = conn->query(query);
+    ASSERT_NE(getTable(*newResult), getTable(*result));
+    ASSERT_EQ(newResult->getNext()->getValue(0)->getValue<int64_t>(), 5);
+    // Connections which don't enable the cache don't use it.
+    ASSERT_NE(getTable(*conn2->query(query)), getTable(*newResult));
+    // Results of non-deterministic functions are not reused.
+    auto randQuery = "MATCH (a:person) RETURN SUM(a.age * rand())";
+    auto randResult = conn->query(randQuery);
+    ASSERT_TRUE(randResult->isSuccess());
+    ASSERT_NE(getTable(*conn->query(randQuery)), getTable(*randResult));
+    // Results depend on the settings of the connection.
+    auto pathQuery = "MATCH (a:person)-[:knows*]->(b:person) RETURN COUNT(*)";
+    ASSERT_TRUE(conn->query("CALL var_length_extend_max_depth=1")->isSuccess());
+    auto pathResult = conn->query(pathQuery);
+    ASSERT_TRUE(pathResult->isSuccess()) << pathResult->getErrorMessage();
+    ASSERT_TRUE(conn->query("CALL var_length_extend_max_depth=2")->isSuccess());
+    auto longerPathResult = conn->query(pathQuery);
+    ASSERT_NE(getTable(*longerPathResult), getTable(*pathResult));
+    ASSERT_GT(longerPathResult->getNext()->getValue(0)->getValue<int64_t>(),
+        pathResult->getNext()->getValue(0)->getValue<int64_t>());
+}
+
+// The cache is shared by the local database, so it must not return the rows of the local database
+// for a query against an attached one.
+TEST_F(ApiTest, QueryResultCacheAttachedDatabase) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    const auto otherPath = databasePath + "_other";
+    {
+        auto otherDatabase = std::make_unique<Database>(otherPath, *systemConfig);
+        Connection otherConn{otherDatabase.get()};
+        ASSERT_TRUE(
+            otherConn.query("CREATE NODE TABLE person(ID INT64, age INT64, PRIMARY KEY(ID))")
+                ->isSuccess());
+        ASSERT_TRUE(otherConn.query("CREATE (:person {ID: 0, age: 50})")->isSuccess());
+        ASSERT_TRUE(otherConn.query("CHECKPOINT")->isSuccess());
+    }
+    ASSERT_TRUE(conn->query("CALL query_result_cache=true")->isSuccess());
+    auto query = "MATCH (a:person) WHERE a.age > 20 RETURN COUNT(*)";
+    ASSERT_EQ(conn->query(query)->getNext()->getValue(0)->getValue<int64_t>(), 6);
+    auto result = conn->query("ATTACH '" + otherPath + "' AS other (dbtype ryu)");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_TRUE(conn->query("USE other")->isSuccess());
+    result = conn->query(query);
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1);
+    ASSERT_TRUE(conn->query("DETACH other")->isSuccess());
+    ASSERT_EQ(conn->query(query)->getNext()->getValue(0)->getValue<int64_t>(), 6);
+}
+
+// A snapshot holds the last checkpoint and the commits since, which are replayed when it is opened.
+TEST_F(ApiTest, OpenSnapshotDatabase) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 1000, fName: 'Checkpointed'})")->isSuccess());
+    ASSERT_TRUE(conn->query("CHECKPOINT")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 1001, fName: 'Logged'})")->isSuccess());
+    const auto snapshotPath = databasePath + "_snapshot";
+    ASSERT_TRUE(conn->query("CALL snapshot_database('" + snapshotPath + "')")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 1002, fName: 'Later'})")->isSuccess());
+    auto snapshot = std::make_unique<Database>(snapshotPath, *systemConfig);
+    Connection snapshotConn{snapshot.get()};
+    auto result =
+        snapshotConn.query("MATCH (p:person) WHERE p.ID >= 1000 RETURN p.fName ORDER BY p.ID");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(TestHelper::convertResultToString(*result, true /* checkOutputOrder */),
+        (std::vector<std::string>{"Checkpointed", "Logged"}));
+}
+
 #ifndef __SINGLE_THREADED__
 // The following two tests are disabled in single-threaded mode because they
 // require multiple threads to run.
@@ -89,6 +204,50 @@ TEST_F(ApiTest, Interrupt) {
     finished_executing = true;
     interruptingThread.join();
 }
+
+TEST_F(ApiTest, QueryAsync) {
+    auto future = conn->queryAsync("MATCH (a:person) RETURN COUNT(*)");
+    auto result = future.get();
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8);
+    // A running asynchronous query is cancelled by interrupting the connection.
+    future = conn->queryAsync(
+        "UNWIND RANGE(1,100000) AS x UNWIND RANGE(1, 100000) AS y RETURN COUNT(x + y);");
+    while (future.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready) {
+        conn->interrupt();
+    }
+    result = future.get();
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(), "Interrupted.");
+}
+
+TEST_F(ApiTest, QueryAsStream) {
+    auto result = conn->queryAsStream("UNWIND RANGE(1, 100000) AS x RETURN x");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getType(), QueryResultType::STREAM);
+    int64_t sum = 0;
+    while (result->hasNext()) {
+        sum += result->getNext()->getValue(0)->getValue<int64_t>();
+    }
+    ASSERT_EQ(sum, 5000050000);
+    ASSERT_EQ(result->getNumTuples(), 100000);
+    result = conn->queryAsStream("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_TRUE(result->hasNext());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8);
+    ASSERT_FALSE(result->hasNext());
+    // Destroying a result that is not consumed interrupts the query.
+    result = conn->queryAsStream("UNWIND RANGE(1, 100000) AS x UNWIND RANGE(1, 100000) AS y "
+                                 "RETURN x + y");
+    ASSERT_TRUE(result->hasNext());
+    result.reset();
+    ASSERT_TRUE(conn->query("MATCH (a:person) RETURN COUNT(*)")->isSuccess());
+    result = conn->queryAsStream("MATCH (a:person) RETURN a.foo");
+    ASSERT_FALSE(result->isSuccess());
+    result = conn->queryAsStream("RETURN 1; RETURN 2;");
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(),
+        "Streaming query results are only supported for a single statement.");
+}
 #endif
 
 TEST_F(ApiTest, CommitRollbackRemoveActiveTransaction) {
@@ -120,6 +279,111 @@ TEST_F(ApiTest, Profile) {
     ASSERT_TRUE(result->isSuccess());
 }
 
+TEST_F(ApiTest, ProfileCounters) {
+    auto result = conn->query("PROFILE MATCH (a:person)-[:knows]->(b:person) RETURN b.fName");
+    ASSERT_TRUE(result->isSuccess());
+    auto plan = result->getNext()->getValue(0)->toString();
+    ASSERT_NE(plan.find("PageAccesses"), std::string::npos);
+    ASSERT_NE(plan.find("PageMisses"), std::string::npos);
+    ASSERT_NE(plan.find("BytesRead"), std::string::npos);
+    ASSERT_EQ(plan.find("Cycles"), std::string::npos);
+    ASSERT_TRUE(conn->query("CALL enable_hardware_counters=true")->isSuccess());
+    result = conn->query("PROFILE MATCH (a:person)-[:knows]->(b:person) RETURN b.fName");
+    ASSERT_TRUE(result->isSuccess());
+    plan = result->getNext()->getValue(0)->toString();
+    ASSERT_NE(plan.find("PageAccesses"), std::string::npos);
+    // Hardware counters are only reported where the kernel allows reading them.
+    if (plan.find("Cycles") != std::string::npos) {
+        ASSERT_NE(plan.find("Instructions"), std::string::npos);
+        ASSERT_NE(plan.find("LLCMisses"), std::string::npos);
+    }
+}
+
+TEST_F(ApiTest, ExplainStreamingAggregate) {
+    // Tuples of each a arrive one after another from the scan of a, so no hash table is needed.
+    auto result = conn->query("EXPLAIN MATCH (a:person)-[:knows]->(b:person) WITH a, COUNT(*) AS c "
+                              "RETURN a.fName, c");
+    ASSERT_TRUE(result->isSuccess());
+    auto plan = result->getNext()->getValue(0)->toString();
+    ASSERT_NE(plan.find("STREAMING_AGGREGATE"), std::string::npos);
+    // Tuples with the same property value don't.
+    result = conn->query("EXPLAIN MATCH (a:person) RETURN a.gender, COUNT(*)");
+    ASSERT_TRUE(result->isSuccess());
+    plan = result->getNext()->getValue(0)->toString();
+    ASSERT_EQ(plan.find("STREAMING_AGGREGATE"), std::string::npos);
+}
+
+TEST_F(ApiTest, ExplainNodeGroupPartition) {
+    auto result = conn->query(
+        "EXPLAIN MATCH (a:person) WHERE node_group_partition(id(a), 1, 4) RETURN a.fName");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_NE(result->getNext()->getValue(0)->toString().find("Partition: 1 of 4"),
+        std::string::npos);
+    // The scanned nodes are only partitioned if the partition is known when planning.
+    result = conn->query("EXPLAIN UNWIND [1] AS p MATCH (a:person) "
+                         "WHERE node_group_partition(id(a), p, 4) RETURN a.fName");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->toString().find("Partition:"), std::string::npos);
+}
+
+TEST_F(ApiTest, ExportMetrics) {
+    ASSERT_TRUE(conn->query("MATCH (a:person) RETURN COUNT(*)")->isSuccess());
+    auto metrics = database->exportMetrics();
+    ASSERT_NE(metrics.find("# TYPE ryu_buffer_manager_page_accesses counter\n"),
+        std::string::npos);
+    ASSERT_NE(metrics.find("ryu_committed_transactions_total "), std::string::npos);
+    ASSERT_NE(metrics.find("ryu_checkpoint_duration_seconds_bucket{le=\"+Inf\"} "),
+        std::string::npos);
+    ASSERT_EQ(metrics.substr(metrics.size() - 6), "# EOF\n");
+}
+
+TEST_F(ApiTest, QueryTrace) {
+    auto tracePath = TestHelper::getTempDir("query_trace") + "/trace.json";
+    ASSERT_TRUE(conn->query("CALL query_trace_path='" + tracePath + "'")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:person) RETURN a.fName ORDER BY a.ID")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL query_trace_path=''")->isSuccess());
+    std::ifstream file{tracePath};
+    std::string trace{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    ASSERT_EQ(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+    ASSERT_NE(trace.find("\"name\":\"thread_name\""), std::string::npos);
+    ASSERT_NE(trace.find("\"cat\":\"task\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(trace.find("\"cat\":\"finalize\""), std::string::npos);
+}
+
+TEST_F(ApiTest, QueryMemoryUsage) {
+    auto result = conn->query("PROFILE MATCH (a:person) RETURN a.fName ORDER BY a.fName");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_NE(result->getNext()->getValue(0)->toString().find("PeakMemory"), std::string::npos);
+    // The memory of a query stays listed while its result is alive.
+    auto sortResult = conn->query("MATCH (a:person) RETURN a.fName ORDER BY a.fName");
+    ASSERT_TRUE(sortResult->isSuccess());
+    result = conn->query("CALL query_memory_usage() WHERE operator_name = 'ORDER_BY' RETURN "
+                         "MAX(peak_memory_usage) > 0");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->toString(), "True");
+    result = conn->query("CALL query_memory_usage() WHERE operator_id IS NULL RETURN COUNT(*) > 0");
+    ASSERT_EQ(result->getNext()->getValue(0)->toString(), "True");
+}
+
+TEST_F(ApiTest, SlowQueryLog) {
+    auto logPath = TestHelper::getTempDir("slow_query_log") + "/slow_queries.log";
+    ASSERT_TRUE(conn->query("CALL slow_query_threshold=0")->isSuccess());
+    ASSERT_TRUE(conn->query("CALL slow_query_log_path='" + logPath + "'")->isSuccess());
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.age > $age RETURN a.fName");
+    ASSERT_TRUE(conn->execute(preparedStatement.get(), std::make_pair(std::string("age"), 30))
+                    ->isSuccess());
+    ASSERT_TRUE(conn->query("CALL slow_query_log_path=''")->isSuccess());
+    std::ifstream file{logPath};
+    std::string entry;
+    ASSERT_TRUE(std::getline(file, entry));
+    ASSERT_NE(entry.find("\"Query\":\"MATCH (a:person) WHERE a.age > $age RETURN a.fName\""),
+        std::string::npos);
+    ASSERT_NE(entry.find("\"Parameters\":{\"age\":\"30\"}"), std::string::npos);
+    ASSERT_NE(entry.find("\"EstimatedCardinality\":"), std::string::npos);
+    ASSERT_NE(entry.find("\"NumOutputTuples\":"), std::string::npos);
+    ASSERT_NE(entry.find("\"MaxCardinalityError\":"), std::string::npos);
+}
+
 TEST_F(ApiTest, TimeOut) {
     conn->setQueryTimeOut(1000 /* timeoutInMS */);
     auto result = conn->query(
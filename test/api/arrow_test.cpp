@@ -78,3 +78,27 @@ TEST_F(ArrowTest, getArrowSchema) {
     ASSERT_EQ(std::string(schema->children[0]->name), "NAME");
     schema->release(schema.get());
 }
+
+TEST_F(ArrowTest, getArrowArrayStream) {
+    auto query = "MATCH (a:person) RETURN a.ID ORDER BY a.ID";
+    auto result = conn->query(query);
+    auto stream = result->getArrowArrayStream(3);
+    ArrowSchema schema;
+    ASSERT_EQ(stream->get_schema(stream.get(), &schema), 0);
+    ASSERT_EQ(schema.n_children, 1);
+    schema.release(&schema);
+    std::vector<int64_t> lengths;
+    while (true) {
+        ArrowArray array;
+        ASSERT_EQ(stream->get_next(stream.get(), &array), 0);
+        if (array.release == nullptr) {
+            break;
+        }
+        lengths.push_back(array.length);
+        array.release(&array);
+    }
+    ASSERT_EQ(lengths, (std::vector<int64_t>{3, 3, 2}));
+    ASSERT_EQ(stream->get_last_error(stream.get()), nullptr);
+    stream->release(stream.get());
+    ASSERT_EQ(stream->release, nullptr);
+}
@@ -258,3 +258,46 @@ TEST_F(ApiTest, ParameterWith) {
     auto groupTruth = std::vector<std::string>{"abc"};
     ASSERT_EQ(groupTruth, TestHelper::convertResultToString(*result));
 }
+
+TEST_F(ApiTest, ExecuteBatch) {
+    conn->query("CREATE NODE TABLE U(id INT64, name STRING, PRIMARY KEY(id));");
+    auto preparedStatement = conn->prepare("CREATE (:U {id: $id, name: $name})");
+    std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>> batch;
+    for (auto i = 0; i < 3; i++) {
+        std::unordered_map<std::string, std::unique_ptr<Value>> params;
+        params["id"] = std::make_unique<Value>((int64_t)i);
+        params["name"] = std::make_unique<Value>("u" + std::to_string(i));
+        batch.push_back(std::move(params));
+    }
+    auto result = conn->executeBatch(preparedStatement.get(), std::move(batch));
+    ASSERT_TRUE(result->isSuccess());
+    result = conn->query("MATCH (u:U) RETURN u.id, u.name ORDER BY u.id");
+    ASSERT_EQ(TestHelper::convertResultToString(*result),
+        std::vector<std::string>({"0|u0", "1|u1", "2|u2"}));
+    // A duplicate primary key fails the batch and rolls back all of its executions.
+    batch.clear();
+    for (auto id : {3, 0}) {
+        std::unordered_map<std::string, std::unique_ptr<Value>> params;
+        params["id"] = std::make_unique<Value>((int64_t)id);
+        params["name"] = std::make_unique<Value>("v");
+        batch.push_back(std::move(params));
+    }
+    result = conn->executeBatch(preparedStatement.get(), std::move(batch));
+    ASSERT_FALSE(result->isSuccess());
+    result = conn->query("MATCH (u:U) RETURN COUNT(*)");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>({"3"}));
+    // Results of a read-only statement are chained in the order of the parameter sets.
+    preparedStatement = conn->prepare("MATCH (u:U {id: $id}) RETURN u.name");
+    batch.clear();
+    for (auto id : {2, 1}) {
+        std::unordered_map<std::string, std::unique_ptr<Value>> params;
+        params["id"] = std::make_unique<Value>((int64_t)id);
+        batch.push_back(std::move(params));
+    }
+    result = conn->executeBatch(preparedStatement.get(), std::move(batch));
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>({"u2"}));
+    ASSERT_TRUE(result->hasNextQueryResult());
+    ASSERT_EQ(TestHelper::convertResultToString(*result->getNextQueryResult()),
+        std::vector<std::string>({"u1"}));
+}
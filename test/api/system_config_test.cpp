@@ -1,6 +1,7 @@
 #include "api_test/api_test.h"
 #include "common/exception/buffer_manager.h"
 #include "common/system_config.h"
+#include "storage/buffer_manager/buffer_manager.h"
 
 using namespace ryu::common;
 using namespace ryu::testing;
@@ -105,3 +106,247 @@ TEST_F(SystemConfigTest, testBufferPoolSize) {
     systemConfig->bufferPoolSize = TestHelper::DEFAULT_BUFFER_POOL_SIZE_FOR_TESTING;
     EXPECT_NO_THROW(auto db = std::make_unique<Database>(databasePath, *systemConfig));
 }
+
+TEST_F(SystemConfigTest, testWorkStealingScheduler) {
+    systemConfig->enableWorkStealing = true;
+    systemConfig->maxNumThreads = 4;
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, PRIMARY KEY(id))"));
+    assertQuery(*con->query("UNWIND range(1, 10000) AS i CREATE (:Person1 {id: i})"));
+    auto result = con->query("MATCH (p:Person1) RETURN SUM(p.id)");
+    assertQuery(*result);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 50005000);
+    // Errors raised by one of the workers must still be rethrown to the user thread.
+    ASSERT_FALSE(con->query("MATCH (p:Person1) RETURN CAST('abc' AS INT64) + p.id")->isSuccess());
+    db.reset();
+}
+
+TEST_F(SystemConfigTest, testScanResistantEviction) {
+    systemConfig->enableScanResistantEviction = true;
+    systemConfig->bufferPoolSize = 32 * 1024 * 1024;
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, val INT64, PRIMARY KEY(id))"));
+    assertQuery(
+        *con->query("UNWIND range(1, 1000000) AS i CREATE (:Person1 {id: i, val: i * 2})"));
+    // Pages read by scans stay marked for eviction, and lookups must still see the same data.
+    for (auto i = 0u; i < 2; i++) {
+        auto result = con->query("MATCH (p:Person1) RETURN SUM(p.val)");
+        assertQuery(*result);
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1000001000000);
+        result = con->query("MATCH (p:Person1) WHERE p.id = 4242 RETURN p.val");
+        assertQuery(*result);
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8484);
+    }
+    db.reset();
+}
+
+TEST_F(SystemConfigTest, testHugePages) {
+    systemConfig->enableHugePages = true;
+    systemConfig->bufferPoolSize = 64 * 1024 * 1024;
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, val INT64, PRIMARY KEY(id))"));
+    assertQuery(
+        *con->query("UNWIND range(1, 1000000) AS i CREATE (:Person1 {id: i, val: i * 2})"));
+    // Huge pages fall back to regular pages where unavailable, so results must be the same.
+    auto result = con->query("MATCH (p:Person1) RETURN SUM(p.val)");
+    assertQuery(*result);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1000001000000);
+    result = con->query("MATCH (p:Person1) WHERE p.id = 4242 RETURN p.val");
+    assertQuery(*result);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8484);
+    db.reset();
+}
+
+TEST_F(SystemConfigTest, testInMemoryNodeGroupCompaction) {
+    systemConfig->autoCheckpoint = false;
+    auto db = std::make_unique<Database>(":memory:", *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, val INT64, PRIMARY KEY(id))"));
+    assertQuery(
+        *con->query("UNWIND range(1, 300000) AS i CREATE (:Person1 {id: i, val: i % 10})"));
+    auto* bm = getBufferManager(*db);
+    auto memoryBeforeCompaction = bm->getUsedMemory();
+    // Full node groups are compressed into pages of the in-memory data file.
+    assertQuery(*con->query("CHECKPOINT"));
+    ASSERT_LT(bm->getUsedMemory(), memoryBeforeCompaction);
+    auto result = con->query("MATCH (p:Person1) RETURN SUM(p.val)");
+    assertQuery(*result);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1350000);
+    // Compacted node groups can still be updated.
+    assertQuery(*con->query("MATCH (p:Person1) WHERE p.id = 4242 SET p.val = 100"));
+    result = con->query("MATCH (p:Person1) WHERE p.id = 4242 RETURN p.val");
+    assertQuery(*result);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 100);
+    db.reset();
+}
+
+TEST_F(SystemConfigTest, testNUMAPartitioning) {
+    systemConfig->enableNUMAPartitioning = true;
+    systemConfig->enableWorkStealing = true;
+    systemConfig->bufferPoolSize = 32 * 1024 * 1024;
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, val INT64, PRIMARY KEY(id))"));
+    // The buffer pool is too small for the table, so pages are evicted across partitions.
+    assertQuery(
+        *con->query("UNWIND range(1, 1000000) AS i CREATE (:Person1 {id: i, val: i * 2})"));
+    for (auto i = 0u; i < 2; i++) {
+        auto result = con->query("MATCH (p:Person1) RETURN SUM(p.val)");
+        assertQuery(*result);
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 1000001000000);
+        result = con->query("MATCH (p:Person1) WHERE p.id = 4242 RETURN p.val");
+        assertQuery(*result);
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8484);
+    }
+    db.reset();
+}
+
+TEST_F(SystemConfigTest, testColdStorage) {
+    if (databasePath == "" || databasePath == ":memory:") {
+        return;
+    }
+    systemConfig->autoCheckpoint = false;
+    const auto coldStoragePath = databasePath + "_cold";
+    std::filesystem::create_directories(coldStoragePath);
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CALL cold_storage_path='" + coldStoragePath + "'"));
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, PRIMARY KEY(id))"));
+    assertQuery(*con->query("CREATE REL TABLE Knows1(FROM Person1 TO Person1, w INT64)"));
+    assertQuery(*con->query("UNWIND range(1, 10000) AS i CREATE (:Person1 {id: i})"));
+    assertQuery(*con->query("MATCH (a:Person1), (b:Person1) WHERE b.id = a.id % 10000 + 1 "
+                            "CREATE (a)-[:Knows1 {w: a.id}]->(b)"));
+    // Checkpointed rel table pages are copied into a segment of the cold storage.
+    assertQuery(*con->query("CHECKPOINT"));
+    ASSERT_TRUE(std::filesystem::exists(databasePath + ".cold"));
+    ASSERT_FALSE(std::filesystem::is_empty(coldStoragePath));
+    auto checkSum = [&](int64_t expected) {
+        auto result = con->query("MATCH ()-[k:Knows1]->() RETURN SUM(k.w)");
+        assertQuery(*result);
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), expected);
+    };
+    checkSum(50005000);
+    // Offloaded pages become local again once they are overwritten.
+    assertQuery(*con->query("MATCH (a:Person1)-[k:Knows1]->() WHERE a.id = 1 SET k.w = 10001"));
+    assertQuery(*con->query("CHECKPOINT"));
+    checkSum(50015000);
+    con.reset();
+    db.reset();
+    db = std::make_unique<Database>(databasePath, *systemConfig);
+    con = std::make_unique<Connection>(db.get());
+    checkSum(50015000);
+    con.reset();
+    db.reset();
+    std::filesystem::remove_all(coldStoragePath);
+}
+
+// A snapshot has holes where pages were offloaded and reads them from the segments of the
+// database.
+TEST_F(SystemConfigTest, testSnapshotColdStorage) {
+    if (databasePath == "" || databasePath == ":memory:") {
+        return;
+    }
+    systemConfig->autoCheckpoint = false;
+    const auto coldStoragePath = databasePath + "_cold";
+    const auto snapshotPath = databasePath + "_snapshot";
+    std::filesystem::create_directories(coldStoragePath);
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CALL cold_storage_path='" + coldStoragePath + "'"));
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, PRIMARY KEY(id))"));
+    assertQuery(*con->query("CREATE REL TABLE Knows1(FROM Person1 TO Person1, w INT64)"));
+    assertQuery(*con->query("UNWIND range(1, 10000) AS i CREATE (:Person1 {id: i})"));
+    assertQuery(*con->query("MATCH (a:Person1), (b:Person1) WHERE b.id = a.id % 10000 + 1 "
+                            "CREATE (a)-[:Knows1 {w: a.id}]->(b)"));
+    assertQuery(*con->query("CHECKPOINT"));
+    ASSERT_FALSE(std::filesystem::is_empty(coldStoragePath));
+    assertQuery(*con->query("CALL snapshot_database('" + snapshotPath + "')"));
+    ASSERT_TRUE(std::filesystem::exists(snapshotPath + ".cold"));
+    // Offloading pages of the database after the snapshot must not overwrite its segments.
+    assertQuery(*con->query("MATCH (a:Person1)-[k:Knows1]->() SET k.w = 1"));
+    assertQuery(*con->query("CHECKPOINT"));
+    con.reset();
+    db.reset();
+    auto snapshot = std::make_unique<Database>(snapshotPath, *systemConfig);
+    auto snapshotCon = std::make_unique<Connection>(snapshot.get());
+    auto result = snapshotCon->query("MATCH ()-[k:Knows1]->() RETURN SUM(k.w)");
+    assertQuery(*result);
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 50005000);
+    snapshotCon.reset();
+    snapshot.reset();
+    std::filesystem::remove_all(coldStoragePath);
+}
+
+TEST_F(SystemConfigTest, testReadReplica) {
+    if (databasePath == "" || databasePath == ":memory:") {
+        return;
+    }
+    systemConfig->autoCheckpoint = false;
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, PRIMARY KEY(id))"));
+    assertQuery(*con->query("UNWIND range(1, 100) AS i CREATE (:Person1 {id: i})"));
+    auto replicaConfig = *systemConfig;
+    replicaConfig.readOnly = true;
+    replicaConfig.enableReadReplica = true;
+    auto replica = std::make_unique<Database>(databasePath, replicaConfig);
+    auto replicaCon = std::make_unique<Connection>(replica.get());
+    auto checkCount = [&](int64_t expected) {
+        auto result = replicaCon->query("MATCH (p:Person1) RETURN COUNT(*), SUM(p.id)");
+        assertQuery(*result);
+        auto tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), expected);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), expected * (expected + 1) / 2);
+    };
+    checkCount(100);
+    // Commits of the writer are applied by the replica before its next transaction.
+    assertQuery(*con->query("UNWIND range(101, 200) AS i CREATE (:Person1 {id: i})"));
+    checkCount(200);
+    // After a checkpoint, the replica reads the checkpointed data again.
+    assertQuery(*con->query("CHECKPOINT"));
+    checkCount(200);
+    assertQuery(*con->query("UNWIND range(201, 300) AS i CREATE (:Person1 {id: i})"));
+    checkCount(300);
+    ASSERT_FALSE(replicaCon->query("CREATE (:Person1 {id: 301})")->isSuccess());
+    replicaCon.reset();
+    replica.reset();
+    replicaConfig.readOnly = false;
+    EXPECT_THROW(auto db2 = std::make_unique<Database>(databasePath, replicaConfig), Exception);
+}
+
+TEST_F(SystemConfigTest, testBufferPoolPrewarm) {
+    if (databasePath == "" || databasePath == ":memory:") {
+        return;
+    }
+    systemConfig->enableBufferPoolPrewarm = true;
+    auto db = std::make_unique<Database>(databasePath, *systemConfig);
+    auto con = std::make_unique<Connection>(db.get());
+    assertQuery(*con->query("CREATE NODE TABLE Person1(id INT64, PRIMARY KEY(id))"));
+    assertQuery(*con->query("CREATE REL TABLE Knows1(FROM Person1 TO Person1, w INT64)"));
+    assertQuery(*con->query("UNWIND range(1, 10000) AS i CREATE (:Person1 {id: i})"));
+    assertQuery(*con->query("MATCH (a:Person1), (b:Person1) WHERE b.id = a.id % 10000 + 1 "
+                            "CREATE (a)-[:Knows1 {w: a.id}]->(b)"));
+    assertQuery(*con->query("CHECKPOINT"));
+    auto checkSum = [&] {
+        auto result = con->query("MATCH ()-[k:Knows1]->() RETURN SUM(k.w)");
+        assertQuery(*result);
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 50005000);
+    };
+    checkSum();
+    con.reset();
+    db.reset();
+    // The cached pages are recorded on close, and read back in the background after reopening.
+    ASSERT_TRUE(std::filesystem::exists(databasePath + ".bufferpool"));
+    db = std::make_unique<Database>(databasePath, *systemConfig);
+    con = std::make_unique<Connection>(db.get());
+    checkSum();
+    assertQuery(*con->query("CALL prewarm('Person1')"));
+    assertQuery(*con->query("CALL prewarm('Knows1')"));
+    checkSum();
+    ASSERT_FALSE(con->query("CALL prewarm('NotExist')")->isSuccess());
+    con.reset();
+    db.reset();
+}
@@ -0,0 +1,150 @@
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "api_test/api_test.h"
+#include "common/exception/interrupt.h"
+#include "common/exception/runtime.h"
+#include "common/task_system/task_scheduler.h"
+#include "main/client_context.h"
+
+using namespace ryu::common;
+using namespace ryu::processor;
+
+namespace ryu {
+namespace testing {
+
+#ifndef __SINGLE_THREADED__
+class ThreadRecordingTask final : public Task {
+public:
+    explicit ThreadRecordingTask(std::function<void()> func = {}, uint64_t maxNumThreads = 1)
+        : Task{maxNumThreads}, func{std::move(func)} {}
+
+    void run() override {
+        {
+            std::unique_lock lck{mtx};
+            threadID = std::this_thread::get_id();
+        }
+        if (func) {
+            func();
+        }
+    }
+
+    std::mutex mtx;
+    std::thread::id threadID;
+    std::function<void()> func;
+};
+
+class TaskSchedulerTest : public ApiTest {
+public:
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        systemConfig->maxNumThreads = 4;
+        createDBAndConn();
+        initGraph();
+        clientContext = conn->getClientContext();
+        executionContext = std::make_unique<ExecutionContext>(nullptr /* profiler */,
+            clientContext, 0 /* queryID */);
+        scheduler = TaskScheduler::Get(*clientContext);
+    }
+
+public:
+    main::ClientContext* clientContext = nullptr;
+    std::unique_ptr<ExecutionContext> executionContext;
+    TaskScheduler* scheduler = nullptr;
+};
+
+TEST_F(TaskSchedulerTest, RunPointQueryTaskOnCallingThread) {
+    auto task = std::make_shared<ThreadRecordingTask>();
+    task->setRunOnCallingThread();
+    scheduler->scheduleTaskAndWaitOrError(task, executionContext.get());
+    ASSERT_EQ(task->threadID, std::this_thread::get_id());
+}
+
+TEST_F(TaskSchedulerTest, RunOtherTasksOnWorkers) {
+    auto task = std::make_shared<ThreadRecordingTask>();
+    scheduler->scheduleTaskAndWaitOrError(task, executionContext.get());
+    ASSERT_NE(task->threadID, std::this_thread::get_id());
+}
+
+TEST_F(TaskSchedulerTest, RethrowExceptionOfTaskOnCallingThread) {
+    auto task = std::make_shared<ThreadRecordingTask>(
+        [] { throw RuntimeException("Task on the calling thread failed."); });
+    task->setRunOnCallingThread();
+    try {
+        scheduler->scheduleTaskAndWaitOrError(task, executionContext.get());
+        FAIL();
+    } catch (RuntimeException& e) {
+        ASSERT_STREQ(e.what(), "Runtime exception: Task on the calling thread failed.");
+    }
+    ASSERT_EQ(task->threadID, std::this_thread::get_id());
+}
+
+TEST_F(TaskSchedulerTest, InterruptTaskOnCallingThread) {
+    auto task = std::make_shared<ThreadRecordingTask>([&] {
+        while (!clientContext->interrupted()) {
+            std::this_thread::yield();
+        }
+        throw InterruptException{};
+    });
+    task->setRunOnCallingThread();
+    auto interrupter = std::thread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        conn->interrupt();
+    });
+    ASSERT_THROW(scheduler->scheduleTaskAndWaitOrError(task, executionContext.get()),
+        InterruptException);
+    interrupter.join();
+    ASSERT_EQ(task->threadID, std::this_thread::get_id());
+}
+
+// Each query may use up to as many workers as the threads setting of its connection allows, so a
+// query scheduled after another one still gets workers.
+TEST_F(TaskSchedulerTest, ConcurrentQueriesShareWorkers) {
+    ASSERT_TRUE(conn->query("CALL threads=2")->isSuccess());
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t numThreads[2] = {0, 0};
+    auto makeTask = [&](uint64_t queryIdx) {
+        auto func = [&, queryIdx] {
+            std::unique_lock lck{mtx};
+            numThreads[queryIdx]++;
+            cv.notify_all();
+            // Threads stay active until both queries have two of them.
+            cv.wait_for(lck, std::chrono::seconds(10),
+                [&] { return numThreads[0] >= 2 && numThreads[1] >= 2; });
+        };
+        return std::make_shared<ThreadRecordingTask>(func, 4 /* maxNumThreads */);
+    };
+    auto runQuery = [&](uint64_t queryIdx) {
+        auto task = makeTask(queryIdx);
+        ExecutionContext context{nullptr /* profiler */, clientContext, queryIdx + 1};
+        scheduler->scheduleTaskAndWaitOrError(task, &context);
+    };
+    auto firstQuery = std::thread(runQuery, 0);
+    {
+        std::unique_lock lck{mtx};
+        cv.wait(lck, [&] { return numThreads[0] > 0; });
+    }
+    auto secondQuery = std::thread(runQuery, 1);
+    firstQuery.join();
+    secondQuery.join();
+    ASSERT_EQ(numThreads[0], 2);
+    ASSERT_EQ(numThreads[1], 2);
+}
+#endif
+
+// Errors of point queries, whose pipelines run on the calling thread, are returned as usual.
+TEST_F(ApiTest, PointQueryError) {
+    auto result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<std::string>(), "Alice");
+    result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.age / 0");
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(), "Runtime exception: Divide by zero.");
+}
+
+} // namespace testing
+} // namespace ryu
@@ -120,6 +120,35 @@ TEST_F(CApiConnectionTest, Execute) {
     ryu_query_result_destroy(&result);
 }
 
+TEST_F(CApiConnectionTest, ExecuteBatch) {
+    ryu_prepared_statement statement;
+    ryu_query_result result;
+    ryu_state state;
+    auto connection = getConnection();
+    auto query = "MATCH (a:person) WHERE a.isStudent = $1 RETURN COUNT(*)";
+    state = ryu_connection_prepare(connection, query, &statement);
+    ASSERT_EQ(state, RyuSuccess);
+    ASSERT_NE(statement._batched_values, nullptr);
+    ryu_prepared_statement_bind_bool(&statement, "1", true);
+    ASSERT_EQ(ryu_prepared_statement_add_batch(&statement), RyuSuccess);
+    ryu_prepared_statement_bind_bool(&statement, "1", false);
+    ASSERT_EQ(ryu_prepared_statement_add_batch(&statement), RyuSuccess);
+    state = ryu_connection_execute_batch(connection, &statement, &result);
+    ASSERT_EQ(state, RyuSuccess);
+    auto resultCpp = static_cast<QueryResult*>(result._query_result);
+    ASSERT_TRUE(resultCpp->isSuccess());
+    ASSERT_EQ(resultCpp->getNext()->getValue(0)->getValue<int64_t>(), 3);
+    ASSERT_TRUE(resultCpp->hasNextQueryResult());
+    auto nextResultCpp = resultCpp->getNextQueryResult();
+    ASSERT_EQ(nextResultCpp->getNext()->getValue(0)->getValue<int64_t>(), 5);
+    ASSERT_FALSE(nextResultCpp->hasNextQueryResult());
+    ryu_query_result_destroy(&result);
+    // The batch is cleared by the execution.
+    ASSERT_EQ(ryu_connection_execute_batch(connection, &statement, &result), RyuError);
+    ryu_query_result_destroy(&result);
+    ryu_prepared_statement_destroy(&statement);
+}
+
 TEST_F(CApiConnectionTest, ExecuteError) {
     ryu_prepared_statement preparedStatement;
     ryu_state state;
@@ -184,4 +213,26 @@ TEST_F(CApiConnectionTest, Interrupt) {
     ryu_query_result_destroy(&result);
     t.join();
 }
+
+TEST_F(CApiConnectionTest, QueryAsync) {
+    ryu_query_future future;
+    ryu_query_result result;
+    std::atomic<bool> notified = false;
+    auto connection = getConnection();
+    auto callback = [](void* user_data) {
+        static_cast<std::atomic<bool>*>(user_data)->store(true);
+    };
+    ASSERT_EQ(ryu_connection_query_async(connection, "MATCH (a:person) RETURN COUNT(*)", callback,
+                  &notified, &future),
+        RyuSuccess);
+    ASSERT_EQ(ryu_query_future_get(&future, &result), RyuSuccess);
+    ASSERT_TRUE(ryu_query_future_is_ready(&future));
+    auto resultCpp = static_cast<QueryResult*>(result._query_result);
+    ASSERT_EQ(resultCpp->getNext()->getValue(0)->getValue<int64_t>(), 8);
+    ryu_query_result_destroy(&result);
+    // The result can only be retrieved once.
+    ASSERT_EQ(ryu_query_future_get(&future, &result), RyuError);
+    ryu_query_future_destroy(&future);
+    ASSERT_TRUE(notified);
+}
 #endif
@@ -1777,6 +1777,44 @@ TEST_F(CApiValueTest, GetBlob) {
     ryu_value_destroy(badValue);
 }
 
+TEST_F(CApiValueTest, GetStringView) {
+    ryu_query_result result;
+    ryu_flat_tuple flatTuple;
+    ryu_state state;
+    auto connection = getConnection();
+    state = ryu_connection_query(connection,
+        (char*)R"(MATCH (a:person) RETURN a.fName, BLOB('\xAA\x00\xCD') ORDER BY a.ID)", &result);
+    ASSERT_EQ(state, RyuSuccess);
+    ASSERT_TRUE(ryu_query_result_is_success(&result));
+    const char* data;
+    uint64_t length;
+    ryu_value value;
+    ASSERT_EQ(ryu_query_result_get_next(&result, &flatTuple), RyuSuccess);
+    ASSERT_EQ(ryu_flat_tuple_get_value(&flatTuple, 0, &value), RyuSuccess);
+    ASSERT_EQ(ryu_value_get_string_view(&value, &data, &length), RyuSuccess);
+    ASSERT_EQ(std::string(data, length), "Alice");
+    ryu_value_destroy(&value);
+    ASSERT_EQ(ryu_flat_tuple_get_value(&flatTuple, 1, &value), RyuSuccess);
+    ASSERT_EQ(ryu_value_get_string_view(&value, &data, &length), RyuSuccess);
+    ASSERT_EQ(length, 3);
+    ASSERT_EQ((uint8_t)data[0], 0xAA);
+    ASSERT_EQ((uint8_t)data[1], 0x00);
+    ASSERT_EQ((uint8_t)data[2], 0xCD);
+    ryu_value_destroy(&value);
+    // The value of the flat tuple is overwritten by the next tuple.
+    ASSERT_EQ(ryu_query_result_get_next(&result, &flatTuple), RyuSuccess);
+    ASSERT_EQ(ryu_flat_tuple_get_value(&flatTuple, 0, &value), RyuSuccess);
+    ASSERT_EQ(ryu_value_get_string_view(&value, &data, &length), RyuSuccess);
+    ASSERT_EQ(std::string(data, length), "Bob");
+    ryu_value_destroy(&value);
+    ryu_flat_tuple_destroy(&flatTuple);
+    ryu_query_result_destroy(&result);
+
+    ryu_value* badValue = ryu_value_create_int32(123);
+    ASSERT_EQ(ryu_value_get_string_view(badValue, &data, &length), RyuError);
+    ryu_value_destroy(badValue);
+}
+
 TEST_F(CApiValueTest, GetUUID) {
     ryu_query_result result;
     ryu_flat_tuple flatTuple;
@@ -0,0 +1,27 @@
+#include <vector>
+
+#include "common/checksum.h"
+#include "gtest/gtest.h"
+
+using namespace ryu::common;
+
+TEST(ChecksumTests, IncrementalMatchesWholeBuffer) {
+    std::vector<uint8_t> data(45);
+    for (auto i = 0u; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    for (auto size = 0u; size <= data.size(); size++) {
+        const auto expected = checksum(data.data(), size);
+        for (auto split = 0u; split <= size; split++) {
+            IncrementalChecksum incremental;
+            incremental.update(data.data(), split);
+            incremental.update(data.data() + split, size - split);
+            ASSERT_EQ(incremental.finish(), expected);
+        }
+        IncrementalChecksum byteWise;
+        for (auto i = 0u; i < size; i++) {
+            byteWise.update(data.data() + i, 1);
+        }
+        ASSERT_EQ(byteWise.finish(), expected);
+    }
+}
@@ -15,3 +15,19 @@ TEST(DateTests, FromDateConvertGivesSame) {
     EXPECT_EQ(8, month);
     EXPECT_EQ(28, day);
 }
+
+TEST(DateTests, ISOAndGeneralFormatsParseTheSame) {
+    EXPECT_EQ(Date::fromCString("2020-02-29", 10), Date::fromDate(2020, 2, 29));
+    EXPECT_EQ(Date::fromCString(" 2020-02-29 ", 12), Date::fromDate(2020, 2, 29));
+    EXPECT_EQ(Date::fromCString("2020-2-9", 8), Date::fromDate(2020, 2, 9));
+    EXPECT_EQ(Date::fromCString("2020/02/29", 10), Date::fromDate(2020, 2, 29));
+    date_t result;
+    uint64_t pos = 0;
+    EXPECT_FALSE(Date::tryConvertDate("2021-02-29", 10, pos, result));
+    pos = 0;
+    EXPECT_FALSE(Date::tryConvertDate("2020-01-31T10", 13, pos, result));
+    pos = 0;
+    EXPECT_TRUE(Date::tryConvertDate("2020-01-31T10", 13, pos, result, true /* allowTrailing */));
+    EXPECT_EQ(pos, 10);
+    EXPECT_EQ(result, Date::fromDate(2020, 1, 31));
+}
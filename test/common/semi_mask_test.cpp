@@ -0,0 +1,73 @@
+#include "common/roaring_mask.h"
+#include "gtest/gtest.h"
+
+using namespace ryu::common;
+
+static void checkMask(SemiMask& mask, const offset_vec_t& expected, offset_t maxOffset) {
+    ASSERT_EQ(mask.getNumMaskedNodes(), expected.size());
+    ASSERT_EQ(mask.range(0, maxOffset), expected);
+    auto it = expected.begin();
+    for (auto offset = 0u; offset < maxOffset; offset++) {
+        const auto isExpected = it != expected.end() && *it == offset;
+        ASSERT_EQ(mask.isMasked(offset), isExpected);
+        ASSERT_EQ(mask.nextMaskedOffset(offset), it == expected.end() ? INVALID_OFFSET : *it);
+        if (isExpected) {
+            it++;
+        }
+    }
+    if (!expected.empty()) {
+        ASSERT_EQ(mask.range(expected.front() + 1, expected.back()),
+            offset_vec_t(expected.begin() + 1, expected.end() - 1));
+    }
+}
+
+TEST(SemiMaskTests, SparseMaskUsesSortedArray) {
+    constexpr offset_t maxOffset = 100000;
+    Roaring32BitmapSemiMask mask{maxOffset};
+    offset_vec_t expected;
+    for (auto offset = 7u; offset < maxOffset; offset += 997) {
+        mask.mask(offset);
+        expected.push_back(offset);
+    }
+    checkMask(mask, expected, maxOffset);
+    mask.finalize();
+    ASSERT_EQ(mask.getRepresentation(), SemiMaskRepresentation::SORTED_ARRAY);
+    checkMask(mask, expected, maxOffset);
+    // Masking again goes back to roaring.
+    mask.mask(1);
+    expected.insert(expected.begin(), 1);
+    ASSERT_EQ(mask.getRepresentation(), SemiMaskRepresentation::ROARING);
+    checkMask(mask, expected, maxOffset);
+}
+
+TEST(SemiMaskTests, DenseMaskUsesBitset) {
+    constexpr offset_t maxOffset = 100000;
+    Roaring64BitmapSemiMask mask{maxOffset};
+    offset_vec_t expected;
+    for (auto offset = 3u; offset < maxOffset; offset += 3) {
+        mask.mask(offset);
+        expected.push_back(offset);
+    }
+    mask.finalize();
+    ASSERT_EQ(mask.getRepresentation(), SemiMaskRepresentation::BITSET);
+    checkMask(mask, expected, maxOffset);
+}
+
+TEST(SemiMaskTests, MediumMaskStaysRoaring) {
+    constexpr offset_t maxOffset = 1000000;
+    Roaring32BitmapSemiMask mask{maxOffset};
+    offset_vec_t expected;
+    for (auto offset = 0u; offset < maxOffset; offset += 100) {
+        mask.mask(offset);
+        expected.push_back(offset);
+    }
+    mask.finalize();
+    ASSERT_EQ(mask.getRepresentation(), SemiMaskRepresentation::ROARING);
+    checkMask(mask, expected, maxOffset);
+}
+
+TEST(SemiMaskTests, EmptyMask) {
+    Roaring32BitmapSemiMask mask{1000};
+    mask.finalize();
+    checkMask(mask, {}, 1000);
+}
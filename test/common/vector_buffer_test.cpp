@@ -0,0 +1,77 @@
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "common/system_config.h"
+#include "common/vector/vector_buffer.h"
+#include "gtest/gtest.h"
+
+using namespace ryu::common;
+
+// Thread caches are per thread, so each test runs on a thread of its own.
+static void runOnNewThread(const std::function<void()>& func) {
+    std::thread thread{func};
+    thread.join();
+}
+
+static constexpr uint64_t BUFFER_SIZE = 8 * DEFAULT_VECTOR_CAPACITY;
+
+TEST(VectorBufferTests, ReuseFreedBuffer) {
+    runOnNewThread([] {
+        VectorBufferCache::enableThreadCache();
+        auto buffer = VectorBufferCache::allocate(BUFFER_SIZE);
+        const auto ptr = buffer.get();
+        buffer.reset();
+        ASSERT_EQ(VectorBufferCache::getNumThreadCachedBytes(), BUFFER_SIZE);
+        buffer = VectorBufferCache::allocate(BUFFER_SIZE);
+        ASSERT_EQ(buffer.get(), ptr);
+        ASSERT_EQ(VectorBufferCache::getNumThreadCachedBytes(), 0);
+    });
+}
+
+TEST(VectorBufferTests, ZeroRecycledBuffer) {
+    runOnNewThread([] {
+        VectorBufferCache::enableThreadCache();
+        auto buffer = VectorBufferCache::allocate(BUFFER_SIZE);
+        memset(buffer.get(), 0xff, BUFFER_SIZE);
+        buffer.reset();
+        buffer = VectorBufferCache::allocate(BUFFER_SIZE);
+        ASSERT_EQ(VectorBufferCache::getNumThreadCachedBytes(), 0);
+        for (auto i = 0u; i < BUFFER_SIZE; i++) {
+            ASSERT_EQ(buffer[i], 0);
+        }
+    });
+}
+
+TEST(VectorBufferTests, CapCachedBytes) {
+    runOnNewThread([] {
+        VectorBufferCache::enableThreadCache();
+        const auto numBuffers = 2 * VectorBufferCache::MAX_CACHED_BYTES / BUFFER_SIZE;
+        std::vector<vector_buffer_t> buffers;
+        for (auto i = 0u; i < numBuffers; i++) {
+            buffers.push_back(VectorBufferCache::allocate(BUFFER_SIZE));
+        }
+        buffers.clear();
+        ASSERT_EQ(VectorBufferCache::getNumThreadCachedBytes(),
+            VectorBufferCache::MAX_CACHED_BYTES);
+        VectorBufferCache::releaseThreadCache();
+        ASSERT_EQ(VectorBufferCache::getNumThreadCachedBytes(), 0);
+    });
+}
+
+TEST(VectorBufferTests, DontCacheOtherSizes) {
+    runOnNewThread([] {
+        VectorBufferCache::enableThreadCache();
+        VectorBufferCache::allocate(BUFFER_SIZE + 1).reset();
+        VectorBufferCache::allocate(3 * DEFAULT_VECTOR_CAPACITY).reset();
+        ASSERT_EQ(VectorBufferCache::getNumThreadCachedBytes(), 0);
+    });
+}
+
+TEST(VectorBufferTests, DontCacheOnThreadsWithoutCache) {
+    runOnNewThread([] {
+        VectorBufferCache::allocate(BUFFER_SIZE).reset();
+        ASSERT_EQ(VectorBufferCache::getNumThreadCachedBytes(), 0);
+    });
+}
@@ -209,5 +209,27 @@ TEST_F(OptimizerTest, SubqueryHint) {
     ASSERT_STREQ(getEncodedPlan(q6).c_str(), "Filter()HJ(a._ID){S(a)}{E(a)Filter()S(b)}");
 }
 
+// Cycles beyond triangles only close at approximate levels of the join order enumeration, which
+// still consider intersecting the rels that close on a node.
+TEST_F(OptimizerTest, PlanIntersectForLargerCycles) {
+    auto fourClique = "MATCH (a:person)-[:knows]->(b:person)-[:knows]->(c:person)-[:knows]->"
+                      "(d:person), (a)-[:knows]->(c), (a)-[:knows]->(d), (b)-[:knows]->(d) "
+                      "RETURN COUNT(*)";
+    ASSERT_NE(getEncodedPlan(fourClique).find("I("), std::string::npos);
+    auto diamond = "MATCH (a:person)-[:knows]->(b:person)-[:knows]->(d:person), "
+                   "(a)-[:knows]->(c:person)-[:knows]->(d), (b)-[:knows]->(c) RETURN COUNT(*)";
+    ASSERT_NE(getEncodedPlan(diamond).find("I("), std::string::npos);
+}
+
+TEST_F(OptimizerTest, PointQuery) {
+    ASSERT_TRUE(getRoot("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName")->isPointQuery());
+    ASSERT_TRUE(getRoot("MATCH (a:person {ID: 0}) WHERE a.age > 20 RETURN a.fName LIMIT 1")
+                    ->isPointQuery());
+    ASSERT_FALSE(getRoot("MATCH (a:person) WHERE a.ID IN [0, 2] RETURN a.fName")->isPointQuery());
+    ASSERT_FALSE(getRoot("MATCH (a:person) RETURN a.fName")->isPointQuery());
+    ASSERT_FALSE(
+        getRoot("MATCH (a:person {ID: 0})-[:knows]->(b:person) RETURN b.fName")->isPointQuery());
+}
+
 } // namespace testing
 } // namespace ryu
@@ -43,7 +43,20 @@ TEST_F(CardinalityTest, TestOperators) {
         EXPECT_EQ(planner::LogicalOperatorType::SCAN_NODE_TABLE, source->getOperatorType());
         EXPECT_EQ(8, source->getCardinality());
         EXPECT_EQ(planner::LogicalOperatorType::FILTER, parent->getOperatorType());
-        EXPECT_EQ(4, parent->getCardinality());
+        // 3 of the 8 persons have gender 1.
+        EXPECT_EQ(3, parent->getCardinality());
+    }
+    {
+        auto plan = getRoot("EXPLAIN LOGICAL MATCH (p1: person) WHERE p1.age < 0 RETURN p1.ID");
+        auto [parent, source] = getSource(plan->getLastOperator().get());
+        EXPECT_EQ(planner::LogicalOperatorType::FILTER, parent->getOperatorType());
+        EXPECT_EQ(1, parent->getCardinality());
+    }
+    {
+        auto plan = getRoot("EXPLAIN LOGICAL MATCH (p1: person) WHERE 0 <= p1.age RETURN p1.ID");
+        auto [parent, source] = getSource(plan->getLastOperator().get());
+        EXPECT_EQ(planner::LogicalOperatorType::FILTER, parent->getOperatorType());
+        EXPECT_EQ(8, parent->getCardinality());
     }
 
     // Limit
@@ -111,6 +111,94 @@ TEST_F(EmptyBufferManagerTest, TestSpillToDiskMemoryUsage) {
     }
 }
 
+TEST_F(BufferManagerTest, TestPrefetchPages) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    auto* fh = StorageManager::Get(*getClientContext(*conn))->getDataFH();
+    const auto numPages = std::min<page_idx_t>(fh->getNumPages(), 16);
+    ASSERT_GT(numPages, 0u);
+    reserveAll();
+    for (auto i = 0u; i < numPages; i++) {
+        ASSERT_EQ(fh->getPageState(i)->getState(), PageState::EVICTED);
+    }
+    fh->prefetchPages(0, numPages);
+    std::vector<uint8_t> expected(fh->getPageSize());
+    for (auto i = 0u; i < numPages; i++) {
+        ASSERT_EQ(fh->getPageState(i)->getState(), PageState::UNLOCKED);
+        fh->readPageFromDisk(expected.data(), i);
+        // Pinning a page that is already in its frame returns the frame as it is.
+        auto* frame = fh->pinPage(i, PageReadPolicy::READ_PAGE);
+        ASSERT_EQ(memcmp(frame, expected.data(), fh->getPageSize()), 0);
+        fh->unpinPage(i);
+    }
+    // Prefetched pages are queued for eviction, so they don't keep their frames claimed.
+    reserveAll();
+    for (auto i = 0u; i < numPages; i++) {
+        ASSERT_EQ(fh->getPageState(i)->getState(), PageState::EVICTED);
+    }
+}
+
+class SpillTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        systemConfig->bufferPoolSize = 32 * 1024 * 1024;
+        createDBAndConn();
+    }
+
+    void createTable() {
+        ASSERT_TRUE(conn->query("CREATE NODE TABLE T(id INT64, val INT64, PRIMARY KEY(id));")
+                        ->isSuccess());
+        ASSERT_TRUE(
+            conn->query("UNWIND range(1, 300000) AS i CREATE (:T {id: i, val: i % 7});")
+                ->isSuccess());
+    }
+
+    // Pins half of the buffer pool, so that the query running next can only finish by spilling.
+    std::unique_ptr<MemoryBuffer> pinHalfOfBufferPool() {
+        auto* bm = getBufferManager(*database);
+        return getMemoryManager(*database)->allocateBuffer(false, bm->getMemoryLimit() / 2);
+    }
+
+    uint64_t getNumBytesSpilled() {
+        uint64_t numBytesSpilled = 0;
+        getBufferManager(*database)->getSpillerOrSkip(
+            [&](auto& spiller) { numBytesSpilled = spiller.getNumBytesSpilled(); });
+        return numBytesSpilled;
+    }
+};
+
+TEST_F(SpillTest, HashJoinSpillsBuildSide) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    createTable();
+    auto pinned = pinHalfOfBufferPool();
+    auto numBytesSpilled = getNumBytesSpilled();
+    auto result =
+        conn->query("MATCH (a:T), (b:T) WHERE a.id = b.id RETURN COUNT(*), SUM(a.id), SUM(b.val)");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(TestHelper::convertResultToString(*result),
+        std::vector<std::string>{"300000|45000150000|899998"});
+    ASSERT_GT(getNumBytesSpilled(), numBytesSpilled);
+}
+
+TEST_F(SpillTest, HashAggregateSpillsPartitions) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    createTable();
+    auto pinned = pinHalfOfBufferPool();
+    auto numBytesSpilled = getNumBytesSpilled();
+    auto result = conn->query(
+        "MATCH (a:T) WITH a.id AS id, COUNT(*) AS cnt RETURN COUNT(*), SUM(cnt), SUM(id)");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(TestHelper::convertResultToString(*result),
+        std::vector<std::string>{"300000|300000|45000150000"});
+    ASSERT_GT(getNumBytesSpilled(), numBytesSpilled);
+}
+
 // Simulates the case where we try to evict a page during an optimistic read
 TEST_F(BufferManagerTest, TestBMEvictionSlowRead) {
     if (inMemMode) {
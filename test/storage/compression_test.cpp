@@ -595,3 +595,255 @@ TEST(CompressionTests, OffsetIntegerPackingMultiPageSigned64) {
 
     integerPackingMultiPage(src);
 }
+
+template<typename T>
+void integerDeltaMultiPage(const std::vector<T>& src, PhysicalTypeID physicalType) {
+    auto alg = IntegerDelta<T>();
+    auto pageSize = 4096;
+    const auto& [min, max] = std::minmax_element(src.begin(), src.end());
+    auto metadata = IntegerDelta<T>::getMetadata(src, StorageValue(*min), StorageValue(*max));
+    ASSERT_TRUE(metadata.has_value());
+    testSerializeThenDeserialize(*metadata);
+    auto numValuesPerPage = metadata->numValues(pageSize, physicalType);
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        auto compressedSize = alg.compressNextPage(srcCursor, numValuesRemaining,
+            dest[pageNum++].data(), pageSize, *metadata);
+        ASSERT_LE(compressedSize, pageSize);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    for (auto i = 0u; i < src.size(); i++) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/,
+            *metadata);
+        EXPECT_EQ(src[i], value);
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), *metadata);
+    }
+    ASSERT_EQ(decompressed, src);
+    // Decompress a range spanning several blocks which doesn't start at a block boundary
+    auto numValuesToRead = std::min<uint64_t>(numValuesPerPage, src.size()) / 2;
+    decompressed.assign(numValuesToRead, 0);
+    alg.decompressFromPage(dest[0].data(), numValuesToRead / 3, (uint8_t*)decompressed.data(), 0,
+        numValuesToRead, *metadata);
+    auto expected = std::vector(src.begin() + numValuesToRead / 3,
+        src.begin() + numValuesToRead / 3 + numValuesToRead);
+    EXPECT_EQ(decompressed, expected);
+}
+
+TEST(CompressionTests, IntegerDeltaNotSorted) {
+    std::vector<int64_t> src{1, 5, 3};
+    EXPECT_FALSE(
+        IntegerDelta<int64_t>::getMetadata(src, StorageValue(1), StorageValue(5)).has_value());
+}
+
+TEST(CompressionTests, IntegerDeltaConstantStride) {
+    int64_t numValues = 100000;
+    std::vector<uint64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (uint64_t{1} << 40) + i * 3;
+    }
+    auto metadata = IntegerDelta<uint64_t>::getMetadata(src, StorageValue(src.front()),
+        StorageValue(src.back()));
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(IntegerDelta<uint64_t>::getPackingInfo(*metadata).bitWidth, 0);
+    // A single page only stores the first value of each block
+    EXPECT_GE(metadata->numValues(4096, PhysicalTypeID::UINT64), numValues);
+
+    integerDeltaMultiPage(src, PhysicalTypeID::UINT64);
+}
+
+TEST(CompressionTests, IntegerDeltaMultiPage64) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> src(numValues);
+    int64_t value = -(int64_t{1} << 50);
+    for (int i = 0; i < numValues; i++) {
+        value += (i * 7919) % 13;
+        src[i] = value;
+    }
+
+    integerDeltaMultiPage(src, PhysicalTypeID::INT64);
+}
+
+TEST(CompressionTests, IntegerDeltaMultiPage32) {
+    int64_t numValues = 100000;
+    std::vector<int32_t> src(numValues);
+    int32_t value = -5000000;
+    for (int i = 0; i < numValues; i++) {
+        value += (i * 7919) % 101 + 2;
+        src[i] = value;
+    }
+
+    integerDeltaMultiPage(src, PhysicalTypeID::INT32);
+}
+
+TEST(CompressionTests, IntegerDeltaMultiPageUnsigned32) {
+    int64_t numValues = 10000;
+    std::vector<uint32_t> src(numValues);
+    uint32_t value = 0;
+    for (int i = 0; i < numValues; i++) {
+        value += (i % 97 == 0) ? 100000 : 1;
+        src[i] = value;
+    }
+
+    integerDeltaMultiPage(src, PhysicalTypeID::UINT32);
+}
+
+template<typename T>
+void runLengthEncodingMultiPage(const std::vector<T>& src, PhysicalTypeID physicalType) {
+    auto alg = RunLengthEncoding<T>();
+    auto pageSize = RYU_PAGE_SIZE;
+    const auto& [min, max] = std::minmax_element(src.begin(), src.end());
+    auto metadata = RunLengthEncoding<T>::getMetadata(src, StorageValue(*min), StorageValue(*max));
+    ASSERT_TRUE(metadata.has_value());
+    auto numValuesPerPage = metadata->numValues(pageSize, physicalType);
+    int64_t numValuesRemaining = src.size();
+    const uint8_t* srcCursor = (uint8_t*)src.data();
+    auto pages = src.size() / numValuesPerPage + 1;
+    std::vector<std::vector<uint8_t>> dest(pages, std::vector<uint8_t>(pageSize));
+    size_t pageNum = 0;
+    while (numValuesRemaining > 0) {
+        ASSERT_LT(pageNum, pages);
+        auto compressedSize = alg.compressNextPage(srcCursor, numValuesRemaining,
+            dest[pageNum++].data(), pageSize, *metadata);
+        ASSERT_LE(compressedSize, pageSize);
+        numValuesRemaining -= numValuesPerPage;
+    }
+    ASSERT_EQ(srcCursor, (uint8_t*)(src.data() + src.size()));
+    for (auto i = 0u; i < src.size(); i++) {
+        auto page = i / numValuesPerPage;
+        auto indexInPage = i % numValuesPerPage;
+        T value;
+        alg.decompressFromPage(dest[page].data(), indexInPage, (uint8_t*)&value, 0, 1 /*numValues*/,
+            *metadata);
+        EXPECT_EQ(src[i], value);
+    }
+    std::vector<T> decompressed(src.size());
+    for (auto i = 0u; i < src.size(); i += numValuesPerPage) {
+        auto page = i / numValuesPerPage;
+        alg.decompressFromPage(dest[page].data(), 0, (uint8_t*)decompressed.data(), i,
+            std::min(numValuesPerPage, (uint64_t)src.size() - i), *metadata);
+    }
+    ASSERT_EQ(decompressed, src);
+}
+
+TEST(CompressionTests, RunLengthEncodingMetadataSerializeThenDeserialize) {
+    std::vector<int32_t> src{1, 1, 1, 2, 2, 2};
+    const auto orig =
+        RunLengthEncoding<int32_t>::getMetadata(src, StorageValue(1), StorageValue(2));
+    ASSERT_TRUE(orig.has_value());
+
+    const auto writer = std::make_shared<BufferWriter>();
+    Serializer ser{writer};
+    orig->serialize(ser);
+    Deserializer deser{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    const auto deserialized = CompressionMetadata::deserialize(deser);
+    EXPECT_EQ(deserialized.compression, CompressionType::RLE);
+    EXPECT_EQ(deserialized.rleMetadata()->numValuesPerPage, orig->rleMetadata()->numValuesPerPage);
+}
+
+TEST(CompressionTests, RunLengthEncodingShortRuns) {
+    std::vector<int64_t> src{1, 2, 3, 3, 4};
+    EXPECT_FALSE(
+        RunLengthEncoding<int64_t>::getMetadata(src, StorageValue(1), StorageValue(4)).has_value());
+}
+
+TEST(CompressionTests, RunLengthEncodingMultiPage64) {
+    int64_t numValues = 100000;
+    std::vector<int64_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = ((i / 37) % 11) * 1000000007ll - 5;
+    }
+
+    runLengthEncodingMultiPage(src, PhysicalTypeID::INT64);
+}
+
+TEST(CompressionTests, RunLengthEncodingMultiPageUnevenRuns8) {
+    int64_t numValues = 100000;
+    std::vector<uint8_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        // Runs are much shorter in the middle of the data
+        src[i] = (i > 40000 && i < 45000) ? (i / 2) % 7 : (i / 3000) % 5;
+    }
+
+    runLengthEncodingMultiPage(src, PhysicalTypeID::UINT8);
+}
+
+TEST(CompressionTests, RunLengthEncodingMultiPage128) {
+    int64_t numValues = 10000;
+    std::vector<ryu::common::int128_t> src(numValues);
+    for (int i = 0; i < numValues; i++) {
+        src[i] = (ryu::common::int128_t(i / 100) << 100);
+    }
+
+    runLengthEncodingMultiPage(src, PhysicalTypeID::INT128);
+}
+
+std::vector<std::string> getFSSTTestStrings() {
+    std::vector<std::string> strings;
+    for (int i = 0; i < 5000; i++) {
+        strings.push_back("https://www.example.com/users/" + std::to_string(i * 7919 % 10007) +
+                          (i % 3 == 0 ? "/profile" : "/settings"));
+    }
+    // Bytes which will most likely not be covered by any symbol
+    strings.push_back(std::string("\xff\x00\x01\xfe", 4));
+    strings.push_back("");
+    return strings;
+}
+
+TEST(CompressionTests, FSSTRoundTrip) {
+    const auto strings = getFSSTTestStrings();
+    const std::vector<std::string_view> views(strings.begin(), strings.end());
+    const auto symbolTable = FSSTSymbolTable::build(views);
+    EXPECT_GT(symbolTable.getNumSymbols(), 0);
+    EXPECT_LE(symbolTable.getNumSymbols(), FSSTSymbolTable::MAX_NUM_SYMBOLS);
+
+    uint64_t totalSize = 0;
+    uint64_t totalEncodedSize = 0;
+    for (auto& str : views) {
+        std::vector<uint8_t> codes;
+        symbolTable.encode(str, codes);
+        ASSERT_EQ(symbolTable.getDecodedLength(codes.data(), codes.size()), str.size());
+        std::string decoded(str.size(), '\0');
+        symbolTable.decode(codes.data(), codes.size(), reinterpret_cast<uint8_t*>(decoded.data()));
+        ASSERT_EQ(decoded, str);
+        totalSize += str.size();
+        totalEncodedSize += codes.size();
+    }
+    EXPECT_LT(totalEncodedSize * 2, totalSize);
+}
+
+TEST(CompressionTests, FSSTMetadataSerializeThenDeserialize) {
+    const auto strings = getFSSTTestStrings();
+    const std::vector<std::string_view> views(strings.begin(), strings.end());
+    CompressionMetadata orig{StorageValue{0}, StorageValue{255}, CompressionType::FSST};
+    orig.extraMetadata = std::make_unique<FSSTMetadata>(FSSTSymbolTable::build(views));
+
+    const auto writer = std::make_shared<BufferWriter>();
+    Serializer ser{writer};
+    orig.serialize(ser);
+    Deserializer deser{std::make_unique<BufferReader>(writer->getBlobData(), writer->getSize())};
+    const auto deserialized = CompressionMetadata::deserialize(deser);
+    ASSERT_EQ(deserialized.compression, CompressionType::FSST);
+    const auto& origTable = orig.fsstMetadata()->symbolTable;
+    const auto& deserializedTable = deserialized.fsstMetadata()->symbolTable;
+    EXPECT_EQ(deserializedTable.getNumSymbols(), origTable.getNumSymbols());
+    for (auto& str : views) {
+        std::vector<uint8_t> origCodes, deserializedCodes;
+        origTable.encode(str, origCodes);
+        deserializedTable.encode(str, deserializedCodes);
+        ASSERT_EQ(origCodes, deserializedCodes);
+    }
+}
@@ -0,0 +1,87 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/table_catalog_entry.h"
+#include "graph_test/private_graph_test.h"
+#include "gtest/gtest.h"
+#include "storage/storage_manager.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::common;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace testing {
+
+class LazyLoadTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        createDBAndConn();
+    }
+
+    void query(const std::string& statement) {
+        auto result = conn->query(statement);
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    }
+
+    std::string queryResult(const std::string& statement) {
+        auto result = conn->query(statement);
+        EXPECT_TRUE(result->isSuccess()) << result->getErrorMessage();
+        return result->hasNext() ? result->getNext()->toString() : "";
+    }
+
+    bool isTableLoaded(const std::string& tableName) {
+        auto* context = getClientContext(*conn);
+        auto tableID = catalog::Catalog::Get(*context)
+                           ->getTableCatalogEntry(&transaction::DUMMY_TRANSACTION, tableName)
+                           ->getTableID();
+        return getStorageManager(*database)->isTableLoaded(tableID);
+    }
+
+    void createTables() {
+        query("CREATE NODE TABLE A(id INT64, v INT64, PRIMARY KEY(id));");
+        query("CREATE NODE TABLE B(id INT64, v INT64, PRIMARY KEY(id));");
+        query("UNWIND range(0, 199999) AS i CREATE (:A {id: i, v: i % 10});");
+        query("UNWIND range(0, 199999) AS i CREATE (:B {id: i, v: i % 10});");
+        query("CHECKPOINT;");
+    }
+};
+
+TEST_F(LazyLoadTest, ScanUnloadedTable) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    createTables();
+    createDBAndConn();
+    EXPECT_FALSE(isTableLoaded("A"));
+    EXPECT_FALSE(isTableLoaded("B"));
+    EXPECT_EQ(queryResult("MATCH (a:A) RETURN COUNT(*), SUM(a.v);"), "200000|900000\n");
+    EXPECT_TRUE(isTableLoaded("A"));
+    EXPECT_FALSE(isTableLoaded("B"));
+    EXPECT_EQ(queryResult("MATCH (b:B) WHERE b.id = 150001 RETURN b.v;"), "1\n");
+    EXPECT_TRUE(isTableLoaded("B"));
+}
+
+// Writes to a table that is loaded by the write itself, checkpointed while the other table is
+// still unloaded.
+TEST_F(LazyLoadTest, WriteUnloadedTable) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    createTables();
+    createDBAndConn();
+    query("MATCH (b:B) WHERE b.id >= 131072 AND b.id < 131082 SET b.v = 100;");
+    query("CREATE (:B {id: 200000, v: 5});");
+    query("MATCH (b:B) WHERE b.id < 10 DELETE b;");
+    EXPECT_FALSE(isTableLoaded("A"));
+    query("CHECKPOINT;");
+    EXPECT_FALSE(isTableLoaded("A"));
+
+    createDBAndConn();
+    EXPECT_FALSE(isTableLoaded("A"));
+    EXPECT_FALSE(isTableLoaded("B"));
+    EXPECT_EQ(queryResult("MATCH (b:B) RETURN COUNT(*), SUM(b.v);"), "199991|900915\n");
+    EXPECT_EQ(queryResult("MATCH (a:A) RETURN COUNT(*), SUM(a.v);"), "200000|900000\n");
+}
+
+} // namespace testing
+} // namespace ryu
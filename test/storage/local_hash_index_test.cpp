@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
+#include "storage/index/hash_index_filter.h"
+#include "storage/index/hash_index_utils.h"
 #include "storage/local_storage/local_hash_index.h"
 #include "storage/overflow_file.h"
 
@@ -67,3 +69,18 @@ TEST(LocalHashIndexTests, LocalStringInserts) {
         ASSERT_FALSE(hashIndex->insert(keys[i], i * 2, isVisible));
     }
 }
+
+TEST(HashIndexFilterTests, NoFalseNegatives) {
+    HashIndexFilter filter(100000);
+    for (int64_t i = 0; i < 100000; i++) {
+        filter.insert(HashIndexUtils::hash(i));
+    }
+    for (int64_t i = 0; i < 100000; i++) {
+        ASSERT_TRUE(filter.mayContain(HashIndexUtils::hash(i)));
+    }
+    uint64_t numFalsePositives = 0;
+    for (int64_t i = 100000; i < 200000; i++) {
+        numFalsePositives += filter.mayContain(HashIndexUtils::hash(i));
+    }
+    ASSERT_LT(numFalsePositives, 5000);
+}
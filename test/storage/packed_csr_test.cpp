@@ -0,0 +1,89 @@
+#include "catalog/catalog.h"
+#include "catalog/catalog_entry/rel_group_catalog_entry.h"
+#include "graph_test/private_graph_test.h"
+#include "gtest/gtest.h"
+#include "storage/storage_manager.h"
+#include "storage/table/csr_node_group.h"
+#include "storage/table/rel_table.h"
+#include "transaction/transaction.h"
+
+using namespace ryu::common;
+using namespace ryu::storage;
+
+namespace ryu {
+namespace testing {
+
+class PackedCSRTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        BaseGraphTest::SetUp();
+        createDBAndConn();
+    }
+
+    void query(const std::string& statement) {
+        auto result = conn->query(statement);
+        ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    }
+
+    PackedCSRInfo getPackedCSRInfo() {
+        auto* context = getClientContext(*conn);
+        const auto& entry = catalog::Catalog::Get(*context)
+                                ->getTableCatalogEntry(&transaction::DUMMY_TRANSACTION, "Follows")
+                                ->constCast<catalog::RelGroupCatalogEntry>();
+        auto& table = StorageManager::Get(*context)
+                          ->getTable(entry.getSingleRelEntryInfo().oid)
+                          ->cast<RelTable>();
+        return table.getDirectedTableData(RelDataDirection::FWD)
+            ->getNodeGroup(0)
+            ->cast<CSRNodeGroup>()
+            .getPackedCSRInfo();
+    }
+};
+
+// Node groups redistributed at consecutive checkpoints should get more gaps, and the learned
+// density should survive a restart.
+TEST_F(PackedCSRTest, DensityAdaptsToFrequentRedistribution) {
+    if (inMemMode) {
+        GTEST_SKIP();
+    }
+    query("CREATE NODE TABLE User(id INT64, PRIMARY KEY(id));");
+    query("CREATE REL TABLE Follows(FROM User TO User);");
+    query("UNWIND range(0, 2999) AS i CREATE (:User {id: i});");
+    query("MATCH (a:User), (b:User) WHERE b.id = (a.id + 1) % 3000 CREATE (a)-[:Follows]->(b);");
+    query("CHECKPOINT;");
+    auto info = getPackedCSRInfo();
+    EXPECT_DOUBLE_EQ(info.packedDensity, PackedCSRInfo::MAX_PACKED_DENSITY);
+    EXPECT_EQ(info.numCheckpointsSinceRedistribution, 0);
+
+    // Doubling every list overflows the whole node group, so each of these checkpoints has to
+    // redistribute it.
+    auto expectedDensity = PackedCSRInfo::MAX_PACKED_DENSITY;
+    for (auto i = 0u; i < 3; i++) {
+        query("MATCH (a:User)-[:Follows]->(b:User) CREATE (a)-[:Follows]->(b);");
+        query("CHECKPOINT;");
+        expectedDensity = std::max(PackedCSRInfo::MIN_PACKED_DENSITY,
+            expectedDensity - PackedCSRInfo::PACKED_DENSITY_STEP);
+        info = getPackedCSRInfo();
+        EXPECT_NEAR(info.packedDensity, expectedDensity, 1e-9);
+        EXPECT_EQ(info.numCheckpointsSinceRedistribution, 0);
+    }
+    EXPECT_LT(info.packedDensity, PackedCSRInfo::MAX_PACKED_DENSITY);
+
+    // A single insertion fits into the gaps left by the last redistribution.
+    query("MATCH (a:User {id: 7}), (b:User {id: 8}) CREATE (a)-[:Follows]->(b);");
+    query("CHECKPOINT;");
+    info = getPackedCSRInfo();
+    EXPECT_NEAR(info.packedDensity, expectedDensity, 1e-9);
+    EXPECT_EQ(info.numCheckpointsSinceRedistribution, 1);
+
+    createDBAndConn();
+    info = getPackedCSRInfo();
+    EXPECT_NEAR(info.packedDensity, expectedDensity, 1e-9);
+    EXPECT_EQ(info.numCheckpointsSinceRedistribution, 1);
+    auto result = conn->query("MATCH (:User)-[e:Follows]->(:User) RETURN COUNT(*);");
+    ASSERT_TRUE(result->isSuccess()) << result->getErrorMessage();
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 24001);
+}
+
+} // namespace testing
+} // namespace ryu
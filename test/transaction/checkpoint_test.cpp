@@ -230,6 +230,60 @@ TEST_F(FlakyCheckpointerTest, RecoverFromCheckpointClearingFilesFailure) {
     runTest(flakyCheckpointer);
 }
 
+class FlakyCheckpointerFailsAfterStorage final : public Checkpointer {
+public:
+    FlakyCheckpointerFailsAfterStorage(main::ClientContext& context, bool& hasStorageChanges)
+        : Checkpointer(context), hasStorageChanges{hasStorageChanges} {}
+
+    void serializeCatalogAndMetadata(DatabaseHeader&, bool hasStorageChanges_) override {
+        hasStorageChanges = hasStorageChanges_;
+        throw RuntimeException("checkpoint failed.");
+    }
+
+private:
+    bool& hasStorageChanges;
+};
+
+// Chunks moved to the front of the data file by a failed checkpoint go back to their old pages.
+TEST_F(FlakyCheckpointerTest, RecoverFromCheckpointFailureAfterCompaction) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    conn->query("CALL force_checkpoint_on_close=false;");
+    conn->query("CALL auto_checkpoint=false");
+    conn->query("CREATE NODE TABLE person1(id INT64 PRIMARY KEY, name STRING);");
+    conn->query("CREATE NODE TABLE person2(id INT64 PRIMARY KEY, name STRING);");
+    conn->query("COPY person1 FROM (UNWIND range(1, 500000) AS i RETURN i, concat('person1-', "
+                "cast(i AS STRING)));");
+    conn->query("COPY person2 FROM (UNWIND range(1, 50000) AS i RETURN i, concat('person2-', "
+                "cast(i AS STRING)));");
+    conn->query("DROP TABLE person1;");
+    // The pages of person1 can only be reused after the checkpoint that freed them.
+    ASSERT_TRUE(conn->query("CHECKPOINT;")->isSuccess());
+    bool hasStorageChanges = false;
+    FlakyCheckpointer flakyCheckpointer([&](main::ClientContext& context) {
+        return std::make_unique<FlakyCheckpointerFailsAfterStorage>(context, hasStorageChanges);
+    });
+    flakyCheckpointer.setCheckpointer(*getClientContext(*conn));
+    ASSERT_FALSE(conn->query("CHECKPOINT;")->isSuccess());
+    // Nothing but the compaction changed storage since the last checkpoint.
+    ASSERT_TRUE(hasStorageChanges);
+    const auto query = "MATCH (p:person2) WHERE p.name = concat('person2-', cast(p.id AS STRING)) "
+                       "RETURN COUNT(*), SUM(p.id);";
+    auto checkData = [&] {
+        auto res = conn->query(query);
+        ASSERT_TRUE(res->isSuccess()) << res->getErrorMessage();
+        auto tuple = res->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 50000);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), 1250025000);
+    };
+    checkData();
+    createDBAndConn();
+    checkData();
+    ASSERT_TRUE(conn->query("CHECKPOINT;")->isSuccess());
+    checkData();
+}
+
 // Simulates a situation where a database attempts to replay a shadow file from an older database
 // with the same path
 TEST_F(FlakyCheckpointerTest, ShadowFileDatabaseIDMismatchExistingDB) {
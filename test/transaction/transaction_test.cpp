@@ -4,6 +4,7 @@
 #include "api_test/private_api_test.h"
 #include "storage/storage_utils.h"
 #include "storage/wal/wal.h"
+#include "transaction/transaction_manager.h"
 
 using namespace ryu::common;
 using namespace ryu::testing;
@@ -129,6 +130,60 @@ TEST_F(EmptyDBTransactionTest, DatabaseFilesAfterCheckpoint) {
     conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, name STRING);");
 }
 
+TEST_F(EmptyDBTransactionTest, DeferAutoCheckpointWhileTransactionsAreActive) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    auto walPath = ryu::storage::StorageUtils::getWALFilePath(databasePath);
+    conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, name STRING);");
+    conn->query("CHECKPOINT;");
+    conn->query("CALL defer_auto_checkpoint=true;");
+    ASSERT_TRUE(conn->query("CREATE (:test {id: 0, name: 'a'});")->isSuccess());
+    // The next commit crosses the threshold, but the WAL stays below twice the threshold
+    auto walSize = std::filesystem::file_size(walPath);
+    conn->query(stringFormat("CALL checkpoint_threshold={};", walSize));
+    auto readConn = std::make_unique<ryu::main::Connection>(database.get());
+    ASSERT_TRUE(readConn->query("BEGIN TRANSACTION READ ONLY;")->isSuccess());
+    // The checkpoint is deferred instead of waiting for the read transaction to leave
+    ASSERT_TRUE(conn->query("CREATE (:test {id: 1, name: 'b'});")->isSuccess());
+    ASSERT_TRUE(std::filesystem::exists(walPath));
+    ASSERT_TRUE(std::filesystem::file_size(walPath) > walSize);
+    ASSERT_TRUE(readConn->query("COMMIT;")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE (:test {id: 2, name: 'c'});")->isSuccess());
+    ASSERT_FALSE(std::filesystem::exists(walPath));
+}
+
+static int64_t sumValues(ryu::main::Connection& connection) {
+    auto res = connection.query("MATCH (a:test) RETURN SUM(a.val);");
+    EXPECT_TRUE(res->isSuccess()) << res->getErrorMessage();
+    return res->getNext()->getValue(0)->getValue<int64_t>();
+}
+
+TEST_F(EmptyDBTransactionTest, VacuumUpdatesKeepsVisibleVersions) {
+    conn->query("CALL auto_checkpoint=false;");
+    conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, val INT64);");
+    conn->query("UNWIND range(0, 99) AS i CREATE (:test {id: i, val: 0});");
+    ASSERT_TRUE(conn->query("MATCH (a:test) SET a.val = 1;")->isSuccess());
+    auto readConn = std::make_unique<ryu::main::Connection>(database.get());
+    ASSERT_TRUE(readConn->query("BEGIN TRANSACTION READ ONLY;")->isSuccess());
+    for (auto i = 2; i <= 10; i++) {
+        ASSERT_TRUE(
+            conn->query(stringFormat("MATCH (a:test) WHERE a.id % 2 = 0 SET a.val = {};", i))
+                ->isSuccess());
+    }
+    auto& storageManager = *database->getStorageManager();
+    // Versions committed after the read transaction started must survive the vacuum.
+    getTransactionManager(*database)->vacuumUpdates(storageManager);
+    ASSERT_EQ(sumValues(*readConn), 100);
+    ASSERT_EQ(sumValues(*conn), 50 * 10 + 50 * 1);
+    ASSERT_TRUE(readConn->query("COMMIT;")->isSuccess());
+    // All versions are merged once no transaction needs the older ones anymore.
+    getTransactionManager(*database)->vacuumUpdates(storageManager);
+    ASSERT_EQ(sumValues(*conn), 50 * 10 + 50 * 1);
+    ASSERT_TRUE(conn->query("MATCH (a:test) WHERE a.id < 10 SET a.val = 0;")->isSuccess());
+    ASSERT_EQ(sumValues(*conn), 45 * 10 + 45 * 1);
+}
+
 #ifndef __SINGLE_THREADED__
 static void insertNodes(uint64_t startID, uint64_t num, ryu::main::Database& database) {
     auto conn = std::make_unique<ryu::main::Connection>(&database);
@@ -169,6 +224,37 @@ TEST_F(EmptyDBTransactionTest, ConcurrentNodeInsertions) {
     ASSERT_EQ(sumID, (numTotalInsertions * (numTotalInsertions - 1)) / 2);
 }
 
+TEST_F(EmptyDBTransactionTest, ConcurrentNodeInsertionsWithGroupCommit) {
+    if (inMemMode || systemConfig->checkpointThreshold == 0) {
+        GTEST_SKIP();
+    }
+    conn->query("CALL debug_enable_multi_writes=true;");
+    conn->query("CALL group_commit=true;");
+    conn->query("CALL group_commit_delay=100;");
+    conn->query("CALL force_checkpoint_on_close=false;");
+    auto numThreads = 4;
+    auto numInsertsPerThread = 500;
+    conn->query("CREATE NODE TABLE test(id INT64 PRIMARY KEY, name STRING);");
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < numThreads; ++i) {
+        threads.emplace_back(insertNodes, i * numInsertsPerThread, numInsertsPerThread,
+            std::ref(*database));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // All commits must have been synced to the WAL, so they are recovered by replaying it.
+    createDBAndConn();
+    auto numTotalInsertions = numThreads * numInsertsPerThread;
+    auto res = conn->query("MATCH (a:test) RETURN COUNT(a) AS COUNT, SUM(a.id) AS SUM_ID;");
+    ASSERT_TRUE(res->isSuccess());
+    ASSERT_EQ(res->getNumTuples(), 1);
+    auto tuple = res->getNext();
+    ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), numTotalInsertions);
+    ASSERT_EQ(tuple->getValue(1)->getValue<int128_t>(),
+        (numTotalInsertions * (numTotalInsertions - 1)) / 2);
+}
+
 static void insertNodesWithMixedTypes(uint64_t startID, uint64_t num,
     ryu::main::Database& database) {
     auto conn = std::make_unique<ryu::main::Connection>(&database);
@@ -27,6 +27,7 @@ void Benchmark::loadBenchmark(const std::string& benchmarkPath) {
     preRun = queryConfig->preRun;
     query = queryConfig->query;
     postRun = queryConfig->postRun;
+    edgeCountQuery = queryConfig->edgeCountQuery;
     name = queryConfig->name;
     expectedOutput = queryConfig->expectedTuples;
     compareResult = queryConfig->compareResult;
@@ -41,6 +42,19 @@ std::unique_ptr<QueryResult> Benchmark::runWithProfile() const {
     return conn->query("PROFILE " + query);
 }
 
+uint64_t Benchmark::countEdges() const {
+    if (edgeCountQuery.empty()) {
+        return 0;
+    }
+    auto result = conn->query(edgeCountQuery);
+    if (!result->isSuccess() || !result->hasNext()) {
+        spdlog::error("Failed to count edges of benchmark {}: {}", name,
+            result->getErrorMessage());
+        return 0;
+    }
+    return result->getNext()->getValue(0)->getValue<int64_t>();
+}
+
 void Benchmark::writeLogFile(std::ofstream& log, uint32_t runNum, const QuerySummary& querySummary,
     const std::vector<std::string>& actualOutput) const {
     log << "Run Num: " << runNum << '\n';
@@ -16,9 +16,7 @@
 namespace ryu {
 namespace benchmark {
 
-std::vector<std::unique_ptr<ParsedBenchmark>> BenchmarkParser::parseBenchmarkFile(
-    const std::string& path, bool checkOutputOrder) {
-    std::vector<std::unique_ptr<ParsedBenchmark>> result;
+static void checkFile(const std::string& path) {
     if (access(path.c_str(), 0) != 0) {
         throw common::Exception("Test file not exists! [" + path + "].");
     }
@@ -27,6 +25,12 @@ std::vector<std::unique_ptr<ParsedBenchmark>> BenchmarkParser::parseBenchmarkFil
     if (status.st_mode & S_IFDIR) {
         throw common::Exception("Test file is a directory. [" + path + "].");
     }
+}
+
+std::vector<std::unique_ptr<ParsedBenchmark>> BenchmarkParser::parseBenchmarkFile(
+    const std::string& path, bool checkOutputOrder) {
+    std::vector<std::unique_ptr<ParsedBenchmark>> result;
+    checkFile(path);
     std::ifstream ifs(path);
     std::string line;
     ParsedBenchmark* currentConfig = nullptr;
@@ -48,6 +52,9 @@ std::vector<std::unique_ptr<ParsedBenchmark>> BenchmarkParser::parseBenchmarkFil
             KU_ASSERT(currentConfig);
             replaceVariables(currentConfig->postRun);
             currentConfig->postRun = line.substr(9, line.length());
+        } else if (line.starts_with("-EDGE_COUNT")) {
+            KU_ASSERT(currentConfig);
+            currentConfig->edgeCountQuery = line.substr(12, line.length());
         } else if (line.starts_with("-PARALLELISM")) {
             KU_ASSERT(currentConfig);
             currentConfig->numThreads = stoi(line.substr(13, line.length()));
@@ -73,6 +80,45 @@ std::vector<std::unique_ptr<ParsedBenchmark>> BenchmarkParser::parseBenchmarkFil
     return result;
 }
 
+// A workload file lists the query types of a workload, e.g.
+// -NAME point_read
+// -QUERY MATCH (p:person) WHERE p.id = $id RETURN p.name
+// -RATE 500
+// -PARAM id 0 9999
+std::vector<ParsedWorkloadQuery> BenchmarkParser::parseWorkloadFile(const std::string& path) {
+    std::vector<ParsedWorkloadQuery> result;
+    checkFile(path);
+    std::ifstream ifs(path);
+    std::string line;
+    while (getline(ifs, line)) {
+        if (line.starts_with("-NAME")) {
+            auto& query = result.emplace_back();
+            query.name = line.substr(6, line.length());
+        } else if (line.starts_with("-QUERY")) {
+            KU_ASSERT(!result.empty());
+            result.back().query = line.substr(7, line.length());
+            replaceVariables(result.back().query);
+        } else if (line.starts_with("-RATE")) {
+            KU_ASSERT(!result.empty());
+            result.back().rate = stod(line.substr(6, line.length()));
+        } else if (line.starts_with("-PARAM")) {
+            KU_ASSERT(!result.empty());
+            auto tokens = common::StringUtils::split(line.substr(7, line.length()), " ");
+            if (tokens.size() != 3) {
+                throw common::Exception("Expect -PARAM <name> <min> <max> but got [" + line + "].");
+            }
+            result.back().params.push_back({tokens[0], stoll(tokens[1]), stoll(tokens[2])});
+        }
+    }
+    for (auto& query : result) {
+        if (query.query.empty() || query.rate <= 0) {
+            throw common::Exception(
+                "Workload query " + query.name + " needs a -QUERY and a positive -RATE.");
+        }
+    }
+    return result;
+}
+
 void BenchmarkParser::replaceVariables(std::string& str) const {
     for (auto& variable : variableMap) {
         common::StringUtils::replaceAll(str, "${" + variable.first + "}", variable.second);
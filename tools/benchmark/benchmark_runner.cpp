@@ -61,34 +61,73 @@ double BenchmarkRunner::computeAverageOfLastRuns(const double* runTimes, const i
 }
 
 void BenchmarkRunner::runBenchmark(Benchmark* benchmark) const {
-    spdlog::info(
-        "Running benchmark {} with {} thread", // NOLINT(clang-analyzer-optin.cplusplus.UninitializedObject):
-                                               // spdlog has an unitialized object.
-        benchmark->name, config->numThreads);
     if (!benchmark->preRun.empty()) {
         spdlog::info("Prerun. {}", benchmark->preRun);
         benchmark->conn->query(benchmark->preRun);
     }
-    for (auto i = 0u; i < config->numWarmups; ++i) {
-        spdlog::info("Warm up");
-        benchmark->run();
+    auto numEdges = benchmark->countEdges();
+    std::vector<double> averageTimes;
+    for (auto numThreads : config->threadCounts) {
+        spdlog::info(
+            "Running benchmark {} with {} thread", // NOLINT(clang-analyzer-optin.cplusplus.UninitializedObject):
+                                                   // spdlog has an unitialized object.
+            benchmark->name, numThreads);
+        benchmark->conn->setMaxNumThreadForExec(numThreads);
+        for (auto i = 0u; i < config->numWarmups; ++i) {
+            spdlog::info("Warm up");
+            benchmark->run();
+        }
+        profileQueryIfEnabled(benchmark);
+        std::vector<double> runTimes(config->numRuns);
+        for (auto i = 0u; i < config->numRuns; ++i) {
+            auto queryResult = benchmark->run();
+            benchmark->log(i + 1, *queryResult);
+            runTimes[i] = queryResult->getQuerySummary()->getExecutionTime();
+        }
+        averageTimes.push_back(computeAverageOfLastRuns(&runTimes[0], config->numRuns,
+            config->numRuns /* numRunsToAverage */));
+        spdlog::info("Time Taken (Average of Last {} runs) (ms): {}", config->numRuns,
+            averageTimes.back());
+        if (numEdges > 0) {
+            spdlog::info("Edges per second: {:.0f}", numEdges / (averageTimes.back() / 1000));
+        }
     }
-    profileQueryIfEnabled(benchmark);
-    std::vector<double> runTimes(config->numRuns);
-    for (auto i = 0u; i < config->numRuns; ++i) {
-        auto queryResult = benchmark->run();
-        benchmark->log(i + 1, *queryResult);
-        runTimes[i] = queryResult->getQuerySummary()->getExecutionTime();
+    if (config->threadCounts.size() > 1) {
+        reportScaling(benchmark, averageTimes, numEdges);
     }
-    spdlog::info("Time Taken (Average of Last {} runs) (ms): {}", config->numRuns,
-        computeAverageOfLastRuns(&runTimes[0], config->numRuns,
-            config->numRuns /* numRunsToAverage */));
     if (!benchmark->postRun.empty()) {
         spdlog::info("PostRun. {}", benchmark->postRun);
         benchmark->conn->query(benchmark->postRun);
     }
 }
 
+// Speedup and efficiency are relative to the first thread count. An efficiency of 1 means the
+// benchmark got faster in proportion to the added threads.
+void BenchmarkRunner::reportScaling(Benchmark* benchmark, const std::vector<double>& averageTimes,
+    uint64_t numEdges) const {
+    std::ofstream scalingFile;
+    if (!config->outputPath.empty()) {
+        scalingFile.open(config->outputPath + "/" + benchmark->name + "_scaling.csv");
+        scalingFile << "threads,time_ms,edges_per_second,speedup,efficiency\n";
+    }
+    spdlog::info("Scaling of benchmark {}", benchmark->name);
+    spdlog::info("{:>8} {:>12} {:>16} {:>8} {:>10}", "Threads", "Time (ms)", "Edges/s", "Speedup",
+        "Efficiency");
+    auto baseThreads = config->threadCounts[0];
+    for (auto i = 0u; i < averageTimes.size(); i++) {
+        auto numThreads = config->threadCounts[i];
+        auto edgesPerSecond = numEdges / (averageTimes[i] / 1000);
+        auto speedup = averageTimes[0] / averageTimes[i];
+        auto efficiency = speedup * baseThreads / numThreads;
+        spdlog::info("{:>8} {:>12.1f} {:>16.0f} {:>8.2f} {:>10.2f}", numThreads, averageTimes[i],
+            edgesPerSecond, speedup, efficiency);
+        if (scalingFile.is_open()) {
+            scalingFile << numThreads << ',' << averageTimes[i] << ',' << edgesPerSecond << ','
+                        << speedup << ',' << efficiency << '\n';
+        }
+    }
+}
+
 void BenchmarkRunner::profileQueryIfEnabled(Benchmark* benchmark) const {
     if (config->enableProfile && !config->outputPath.empty()) {
         auto profileInfo = benchmark->runWithProfile();
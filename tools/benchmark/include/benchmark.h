@@ -16,6 +16,8 @@ public:
 
     std::unique_ptr<main::QueryResult> run() const;
     std::unique_ptr<main::QueryResult> runWithProfile() const;
+    // Returns the result of the edge count query, or 0 if the benchmark has none.
+    uint64_t countEdges() const;
     void log(uint32_t runNum, main::QueryResult& queryResult) const;
 
 private:
@@ -31,6 +33,7 @@ public:
     std::string preRun;
     std::string query;
     std::string postRun;
+    std::string edgeCountQuery;
     std::vector<std::string> expectedOutput;
     bool compareResult;
     uint64_t expectedNumTuples;
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace ryu {
 namespace benchmark {
@@ -17,9 +18,15 @@ struct BenchmarkConfig {
     uint32_t numRuns = 5;
     // number of threads to execute benchmark
     uint32_t numThreads = 1;
+    // thread counts to run each benchmark with, to measure how it scales
+    std::vector<uint32_t> threadCounts = {1};
     // output benchmark log to file
     std::string outputPath;
     uint64_t bufferPoolSize = 1 << 23;
+    // number of connections issuing the queries of a workload
+    uint32_t numConnections = 8;
+    // duration of a workload run
+    uint32_t durationInSeconds = 60;
 };
 
 } // namespace benchmark
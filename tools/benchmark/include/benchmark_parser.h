@@ -14,6 +14,8 @@ struct ParsedBenchmark {
     std::string preRun;
     std::string query;
     std::string postRun;
+    // Query returning the number of edges the benchmarked algorithm runs on.
+    std::string edgeCountQuery;
     uint64_t numThreads = 4;
     uint64_t expectedNumTuples = 0;
     std::vector<std::string> expectedTuples;
@@ -21,11 +23,28 @@ struct ParsedBenchmark {
     bool compareResult = true;
 };
 
+// A parameter of a workload query that is drawn uniformly from [min, max] for each execution.
+struct WorkloadParam {
+    std::string name;
+    int64_t min = 0;
+    int64_t max = 0;
+};
+
+struct ParsedWorkloadQuery {
+    std::string name;
+    std::string query;
+    // Number of queries started per second.
+    double rate = 1;
+    std::vector<WorkloadParam> params;
+};
+
 class BenchmarkParser {
 public:
     std::vector<std::unique_ptr<ParsedBenchmark>> parseBenchmarkFile(const std::string& path,
         bool checkOutputOrder = false);
 
+    std::vector<ParsedWorkloadQuery> parseWorkloadFile(const std::string& path);
+
 private:
     void replaceVariables(std::string& str) const;
 
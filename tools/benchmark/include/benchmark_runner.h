@@ -24,6 +24,9 @@ private:
 
     void profileQueryIfEnabled(Benchmark* benchmark) const;
 
+    void reportScaling(Benchmark* benchmark, const std::vector<double>& averageTimes,
+        uint64_t numEdges) const;
+
 public:
     std::unique_ptr<BenchmarkConfig> config;
     std::unique_ptr<main::Database> database;
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "benchmark_config.h"
+#include "benchmark_parser.h"
+#include "main/ryu.h"
+
+namespace ryu {
+namespace benchmark {
+
+/**
+ * Histogram of latencies in microseconds with a relative error of at most 1/16. Values below 16
+ * have a bucket each and every further power of two range is split into 16 buckets.
+ */
+class LatencyHistogram {
+public:
+    void record(uint64_t latencyInUs);
+
+    uint64_t getNumValues() const;
+    // Returns an upper bound of the given percentile, e.g. 99.9.
+    uint64_t getPercentile(double percentile) const;
+
+private:
+    static constexpr uint64_t NUM_SUB_BUCKETS_LOG2 = 4;
+    static constexpr uint64_t NUM_SUB_BUCKETS = 1 << NUM_SUB_BUCKETS_LOG2;
+    static constexpr uint64_t NUM_BUCKETS = NUM_SUB_BUCKETS * (64 - NUM_SUB_BUCKETS_LOG2 + 1);
+
+    static uint64_t getBucketIdx(uint64_t value);
+    static uint64_t getBucketUpperBound(uint64_t bucketIdx);
+
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> counts{};
+};
+
+struct WorkloadQueryStats {
+    LatencyHistogram latencies;
+    std::atomic<uint64_t> numErrors{0};
+    // Number of queries completed in each second of the run.
+    std::vector<std::atomic<uint64_t>> numCompletedPerSecond;
+};
+
+/**
+ * LoadDriver runs a mix of queries from many connections at once. Queries arrive open-loop: their
+ * start times are drawn from a Poisson process with the configured rate of each query type,
+ * independent of how fast earlier queries complete. A query's latency is measured from its
+ * arrival, so time spent waiting for a free connection counts, as it would for a client.
+ */
+class LoadDriver {
+public:
+    LoadDriver(main::Database* database, BenchmarkConfig& config,
+        std::vector<ParsedWorkloadQuery> queries);
+
+    void run();
+
+private:
+    using clock_t = std::chrono::steady_clock;
+
+    struct Arrival {
+        uint32_t queryIdx;
+        clock_t::time_point time;
+    };
+
+    void generateArrivals();
+    void runConnection(uint32_t connectionIdx);
+    bool getNextArrival(Arrival& arrival);
+    void report() const;
+
+private:
+    main::Database* database;
+    BenchmarkConfig& config;
+    std::vector<ParsedWorkloadQuery> queries;
+    std::vector<std::unique_ptr<WorkloadQueryStats>> stats;
+    clock_t::time_point startTime;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<Arrival> arrivals;
+    bool allArrived = false;
+    // Largest number of queries waiting for a free connection.
+    uint64_t maxNumQueuedQueries = 0;
+};
+
+} // namespace benchmark
+} // namespace ryu
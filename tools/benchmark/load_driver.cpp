@@ -0,0 +1,216 @@
+#include "load_driver.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <thread>
+
+#include "spdlog/spdlog.h"
+
+using namespace ryu::common;
+using namespace ryu::main;
+
+namespace ryu {
+namespace benchmark {
+
+uint64_t LatencyHistogram::getBucketIdx(uint64_t value) {
+    if (value < NUM_SUB_BUCKETS) {
+        return value;
+    }
+    auto exponent = std::bit_width(value) - 1;
+    auto shift = exponent - NUM_SUB_BUCKETS_LOG2;
+    return (shift + 1) * NUM_SUB_BUCKETS + ((value >> shift) - NUM_SUB_BUCKETS);
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(uint64_t bucketIdx) {
+    if (bucketIdx < NUM_SUB_BUCKETS) {
+        return bucketIdx;
+    }
+    auto shift = bucketIdx / NUM_SUB_BUCKETS - 1;
+    auto subBucket = bucketIdx % NUM_SUB_BUCKETS + NUM_SUB_BUCKETS;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t latencyInUs) {
+    counts[getBucketIdx(latencyInUs)].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getNumValues() const {
+    uint64_t numValues = 0;
+    for (auto& count : counts) {
+        numValues += count.load(std::memory_order_relaxed);
+    }
+    return numValues;
+}
+
+uint64_t LatencyHistogram::getPercentile(double percentile) const {
+    auto numValues = getNumValues();
+    if (numValues == 0) {
+        return 0;
+    }
+    auto rank = std::max<uint64_t>(1, std::ceil(percentile / 100 * numValues));
+    uint64_t numValuesSeen = 0;
+    for (auto i = 0u; i < NUM_BUCKETS; i++) {
+        numValuesSeen += counts[i].load(std::memory_order_relaxed);
+        if (numValuesSeen >= rank) {
+            return getBucketUpperBound(i);
+        }
+    }
+    return getBucketUpperBound(NUM_BUCKETS - 1);
+}
+
+LoadDriver::LoadDriver(Database* database, BenchmarkConfig& config,
+    std::vector<ParsedWorkloadQuery> queries)
+    : database{database}, config{config}, queries{std::move(queries)} {
+    for (auto i = 0u; i < this->queries.size(); i++) {
+        auto queryStats = std::make_unique<WorkloadQueryStats>();
+        // Queries still running at the end of the run complete within a few extra seconds.
+        queryStats->numCompletedPerSecond =
+            std::vector<std::atomic<uint64_t>>(config.durationInSeconds * 2 + 10);
+        stats.push_back(std::move(queryStats));
+    }
+}
+
+void LoadDriver::run() {
+    spdlog::info("Running {} query types on {} connections for {} seconds", queries.size(),
+        config.numConnections, config.durationInSeconds);
+    startTime = clock_t::now();
+    std::vector<std::thread> connectionThreads;
+    for (auto i = 0u; i < config.numConnections; i++) {
+        connectionThreads.emplace_back([this, i] { runConnection(i); });
+    }
+    generateArrivals();
+    for (auto& thread : connectionThreads) {
+        thread.join();
+    }
+    report();
+}
+
+void LoadDriver::generateArrivals() {
+    std::mt19937_64 random{std::random_device{}()};
+    auto endTime = startTime + std::chrono::seconds(config.durationInSeconds);
+    std::vector<std::exponential_distribution<double>> interArrivalTimes;
+    std::vector<clock_t::time_point> nextArrivals;
+    auto drawNextArrival = [&](uint32_t queryIdx, clock_t::time_point time) {
+        auto seconds = std::chrono::duration<double>(interArrivalTimes[queryIdx](random));
+        return time + std::chrono::duration_cast<clock_t::duration>(seconds);
+    };
+    for (auto i = 0u; i < queries.size(); i++) {
+        interArrivalTimes.emplace_back(queries[i].rate);
+        nextArrivals.push_back(drawNextArrival(i, startTime));
+    }
+    while (true) {
+        auto queryIdx = static_cast<uint32_t>(
+            std::min_element(nextArrivals.begin(), nextArrivals.end()) - nextArrivals.begin());
+        auto arrivalTime = nextArrivals[queryIdx];
+        if (arrivalTime >= endTime) {
+            break;
+        }
+        std::this_thread::sleep_until(arrivalTime);
+        {
+            std::unique_lock lck{mtx};
+            arrivals.push_back(Arrival{queryIdx, arrivalTime});
+            maxNumQueuedQueries = std::max<uint64_t>(maxNumQueuedQueries, arrivals.size());
+        }
+        cv.notify_one();
+        nextArrivals[queryIdx] = drawNextArrival(queryIdx, arrivalTime);
+    }
+    {
+        std::unique_lock lck{mtx};
+        allArrived = true;
+    }
+    cv.notify_all();
+}
+
+bool LoadDriver::getNextArrival(Arrival& arrival) {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return !arrivals.empty() || allArrived; });
+    if (arrivals.empty()) {
+        return false;
+    }
+    arrival = arrivals.front();
+    arrivals.pop_front();
+    return true;
+}
+
+void LoadDriver::runConnection(uint32_t connectionIdx) {
+    Connection conn(database);
+    std::mt19937_64 random{connectionIdx};
+    std::vector<std::unique_ptr<PreparedStatement>> preparedStatements;
+    for (auto& query : queries) {
+        preparedStatements.push_back(conn.prepare(query.query));
+        if (!preparedStatements.back()->isSuccess()) {
+            spdlog::error("Failed to prepare {}: {}", query.name,
+                preparedStatements.back()->getErrorMessage());
+        }
+    }
+    Arrival arrival{};
+    while (getNextArrival(arrival)) {
+        auto& query = queries[arrival.queryIdx];
+        auto& queryStats = *stats[arrival.queryIdx];
+        std::unordered_map<std::string, std::unique_ptr<Value>> params;
+        for (auto& param : query.params) {
+            auto value = std::uniform_int_distribution<int64_t>{param.min, param.max}(random);
+            params.emplace(param.name, std::make_unique<Value>(value));
+        }
+        auto result =
+            conn.executeWithParams(preparedStatements[arrival.queryIdx].get(), std::move(params));
+        auto endTime = clock_t::now();
+        if (!result->isSuccess()) {
+            queryStats.numErrors.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        queryStats.latencies.record(
+            std::chrono::duration_cast<std::chrono::microseconds>(endTime - arrival.time).count());
+        auto second = std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime).count();
+        auto& numCompletedPerSecond = queryStats.numCompletedPerSecond;
+        numCompletedPerSecond[std::min<uint64_t>(second, numCompletedPerSecond.size() - 1)]
+            .fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LoadDriver::report() const {
+    spdlog::info("Max number of queued queries: {}", maxNumQueuedQueries);
+    spdlog::info("{:<24} {:>10} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10}", "Query", "Completed",
+        "Errors", "QPS", "p50 (us)", "p99 (us)", "p999 (us)", "max (us)");
+    for (auto i = 0u; i < queries.size(); i++) {
+        auto& latencies = stats[i]->latencies;
+        auto numCompleted = latencies.getNumValues();
+        spdlog::info("{:<24} {:>10} {:>8} {:>10.1f} {:>10} {:>10} {:>10} {:>10}", queries[i].name,
+            numCompleted, stats[i]->numErrors.load(),
+            static_cast<double>(numCompleted) / config.durationInSeconds,
+            latencies.getPercentile(50), latencies.getPercentile(99),
+            latencies.getPercentile(99.9), latencies.getPercentile(100));
+    }
+    if (config.outputPath.empty()) {
+        return;
+    }
+    // Throughput over time, one row per second and one column per query type.
+    std::ofstream throughputFile(config.outputPath + "/workload_throughput.csv");
+    throughputFile << "second";
+    for (auto& query : queries) {
+        throughputFile << ',' << query.name;
+    }
+    throughputFile << '\n';
+    for (auto second = 0u; second < stats[0]->numCompletedPerSecond.size(); second++) {
+        throughputFile << second;
+        for (auto& queryStats : stats) {
+            throughputFile << ',' << queryStats->numCompletedPerSecond[second].load();
+        }
+        throughputFile << '\n';
+    }
+    std::ofstream latencyFile(config.outputPath + "/workload_latency.csv");
+    latencyFile << "query,completed,errors,p50_us,p99_us,p999_us,max_us\n";
+    for (auto i = 0u; i < queries.size(); i++) {
+        auto& latencies = stats[i]->latencies;
+        latencyFile << queries[i].name << ',' << latencies.getNumValues() << ','
+                    << stats[i]->numErrors.load() << ',' << latencies.getPercentile(50) << ','
+                    << latencies.getPercentile(99) << ',' << latencies.getPercentile(99.9) << ','
+                    << latencies.getPercentile(100) << '\n';
+    }
+}
+
+} // namespace benchmark
+} // namespace ryu
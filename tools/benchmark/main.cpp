@@ -1,5 +1,8 @@
+#include <algorithm>
+
 #include "benchmark_runner.h"
 #include "common/string_utils.h"
+#include "load_driver.h"
 #include "spdlog/spdlog.h"
 
 using namespace ryu::benchmark;
@@ -16,6 +19,7 @@ static std::string getArgumentValue(const std::string& arg) {
 int main(int argc, char** argv) {
     std::string datasetPath;
     std::string benchmarkPath;
+    std::string workloadPath;
     auto config = std::make_unique<BenchmarkConfig>();
     // parse arguments
     for (auto i = 1; i < argc; ++i) {
@@ -24,12 +28,24 @@ int main(int argc, char** argv) {
             datasetPath = getArgumentValue(arg);
         } else if (arg.starts_with("--benchmark")) {
             benchmarkPath = getArgumentValue(arg);
+        } else if (arg.starts_with("--workload")) {
+            workloadPath = getArgumentValue(arg);
+        } else if (arg.starts_with("--connections")) {
+            config->numConnections = stoul(getArgumentValue(arg));
+        } else if (arg.starts_with("--duration")) {
+            config->durationInSeconds = stoul(getArgumentValue(arg));
         } else if (arg.starts_with("--warmup")) {
             config->numWarmups = stoul(getArgumentValue(arg));
         } else if (arg.starts_with("--run")) {
             config->numRuns = stoul(getArgumentValue(arg));
         } else if (arg.starts_with("--thread")) {
-            config->numThreads = stoul(getArgumentValue(arg));
+            // A comma-separated list runs every benchmark with each thread count.
+            config->threadCounts.clear();
+            for (auto& numThreads : StringUtils::split(getArgumentValue(arg), ",")) {
+                config->threadCounts.push_back(stoul(numThreads));
+            }
+            config->numThreads =
+                *std::max_element(config->threadCounts.begin(), config->threadCounts.end());
         } else if (arg.starts_with("--out")) { // save benchmark result to file
             config->outputPath = getArgumentValue(arg);
         } else if (arg.starts_with("--profile")) {
@@ -45,8 +61,21 @@ int main(int argc, char** argv) {
         printf("Missing --dataset input.");
         return 1;
     }
+    if (!workloadPath.empty()) {
+        auto database = std::make_unique<ryu::main::Database>(datasetPath,
+            ryu::main::SystemConfig(config->bufferPoolSize, config->numThreads));
+        try {
+            auto queries = BenchmarkParser().parseWorkloadFile(workloadPath);
+            LoadDriver(database.get(), *config, std::move(queries)).run();
+        } catch (std::exception& e) {
+            spdlog::error("Error encountered while running workload {}: {}.", workloadPath,
+                e.what());
+            return 1;
+        }
+        return 0;
+    }
     if (benchmarkPath.empty()) {
-        printf("Missing --benchmark input");
+        printf("Missing --benchmark or --workload input");
         return 1;
     }
     auto runner = BenchmarkRunner(datasetPath, std::move(config));
@@ -775,6 +775,37 @@ JNIEXPORT jobject JNICALL Java_com_ryugraph_Native_ryuQueryResultGetNext(JNIEnv*
     return jobject();
 }
 
+JNIEXPORT void JNICALL Java_com_ryugraph_Native_ryuQueryResultGetArrowSchema(JNIEnv* env, jclass,
+    jobject thisQR, jlong schemaAddress) {
+    try {
+        QueryResult* qr = getQueryResult(env, thisQR);
+        // The ownership of the schema moves to the caller, who calls its release callback.
+        *reinterpret_cast<ArrowSchema*>(schemaAddress) = *qr->getArrowSchema();
+    } catch (const Exception& e) {
+        throwJNIException(env, e.what());
+    } catch (...) {
+        throwJNIException(env, "Unknown Error");
+    }
+}
+
+JNIEXPORT jboolean JNICALL Java_com_ryugraph_Native_ryuQueryResultGetNextArrowChunk(JNIEnv* env,
+    jclass, jobject thisQR, jlong chunkSize, jlong arrayAddress) {
+    try {
+        QueryResult* qr = getQueryResult(env, thisQR);
+        if (!qr->hasNextArrowChunk()) {
+            return static_cast<jboolean>(false);
+        }
+        // The ownership of the array moves to the caller, who calls its release callback.
+        *reinterpret_cast<ArrowArray*>(arrayAddress) = *qr->getNextArrowChunk(chunkSize);
+        return static_cast<jboolean>(true);
+    } catch (const Exception& e) {
+        throwJNIException(env, e.what());
+    } catch (...) {
+        throwJNIException(env, "Unknown Error");
+    }
+    return jboolean();
+}
+
 JNIEXPORT jboolean JNICALL Java_com_ryugraph_Native_ryuQueryResultHasNextQueryResult(JNIEnv* env,
     jclass, jobject thisQR) {
     try {
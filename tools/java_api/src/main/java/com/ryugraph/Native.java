@@ -142,6 +142,12 @@ public class Native {
 
     protected static native void ryuQueryResultResetIterator(QueryResult queryResult);
 
+    protected static native void ryuQueryResultGetArrowSchema(QueryResult queryResult,
+            long schemaAddress);
+
+    protected static native boolean ryuQueryResultGetNextArrowChunk(QueryResult queryResult,
+            long chunkSize, long arrayAddress);
+
     // FlatTuple
     protected static native void ryuFlatTupleDestroy(FlatTuple flatTuple);
 
@@ -149,6 +149,39 @@ public class QueryResult implements AutoCloseable {
         return Native.ryuQueryResultGetNext(this);
     }
 
+    /**
+     * Export the schema of the query result through the Arrow C data interface.
+     * The schema is written to a caller-allocated ArrowSchema struct, e.g. the
+     * memoryAddress() of an org.apache.arrow.c.ArrowSchema. The caller is
+     * responsible for releasing it.
+     *
+     * @param schemaAddress The address of the ArrowSchema struct to write to.
+     * @throws RuntimeException If the query result has been destroyed.
+     */
+    public void getArrowSchema(long schemaAddress) {
+        checkNotDestroyed();
+        Native.ryuQueryResultGetArrowSchema(this, schemaAddress);
+    }
+
+    /**
+     * Export the next chunkSize tuples of the query result through the Arrow C
+     * data interface, as a struct array with one child per column. Unlike
+     * getNext(), a whole chunk is converted per call, so large results are
+     * transferred without creating Java objects for each value. The array is
+     * written to a caller-allocated ArrowArray struct, e.g. the memoryAddress()
+     * of an org.apache.arrow.c.ArrowArray, which can then be imported with
+     * org.apache.arrow.c.Data. The caller is responsible for releasing it.
+     *
+     * @param chunkSize The maximum number of tuples in the chunk.
+     * @param arrayAddress The address of the ArrowArray struct to write to.
+     * @return False if there are no more tuples, in which case nothing is written.
+     * @throws RuntimeException If the query result has been destroyed.
+     */
+    public boolean getNextArrowChunk(long chunkSize, long arrayAddress) {
+        checkNotDestroyed();
+        return Native.ryuQueryResultGetNextArrowChunk(this, chunkSize, arrayAddress);
+    }
+
     /**
      * Return if the query result has next query result or not.
      *
@@ -1,5 +1,16 @@
 package com.ryugraph;
 
+import org.apache.arrow.c.ArrowArray;
+import org.apache.arrow.c.ArrowSchema;
+import org.apache.arrow.c.CDataDictionaryProvider;
+import org.apache.arrow.c.Data;
+import org.apache.arrow.memory.BufferAllocator;
+import org.apache.arrow.memory.RootAllocator;
+import org.apache.arrow.vector.BigIntVector;
+import org.apache.arrow.vector.FieldVector;
+import org.apache.arrow.vector.VarCharVector;
+import org.apache.arrow.vector.complex.StructVector;
+import org.apache.arrow.vector.types.pojo.Field;
 import org.junit.jupiter.api.Test;
 
 import static org.junit.jupiter.api.Assertions.*;
@@ -33,6 +44,42 @@ public class QueryResultTest extends TestBase {
         }
     }
 
+    @Test
+    void QueryResultGetNextArrowChunk() {
+        try (BufferAllocator allocator = new RootAllocator();
+                QueryResult result = conn.query("MATCH (a:person) RETURN a.ID, a.fName ORDER BY a.ID");
+                ArrowSchema schema = ArrowSchema.allocateNew(allocator)) {
+            result.getArrowSchema(schema.memoryAddress());
+            List<Long> ids = new ArrayList<>();
+            List<String> names = new ArrayList<>();
+            List<Integer> chunkSizes = new ArrayList<>();
+            try (CDataDictionaryProvider provider = new CDataDictionaryProvider()) {
+                Field field = Data.importField(allocator, schema, provider);
+                while (true) {
+                    try (ArrowArray array = ArrowArray.allocateNew(allocator)) {
+                        if (!result.getNextArrowChunk(3, array.memoryAddress())) {
+                            break;
+                        }
+                        try (FieldVector vector = Data.importVector(allocator, array, field, provider)) {
+                            StructVector struct = (StructVector) vector;
+                            BigIntVector idVector = (BigIntVector) struct.getChildByOrdinal(0);
+                            VarCharVector nameVector = (VarCharVector) struct.getChildByOrdinal(1);
+                            chunkSizes.add(struct.getValueCount());
+                            for (int i = 0; i < struct.getValueCount(); i++) {
+                                ids.add(idVector.get(i));
+                                names.add(new String(nameVector.get(i)));
+                            }
+                        }
+                    }
+                }
+            }
+            assertEquals(List.of(3, 3, 2), chunkSizes);
+            assertEquals(List.of(0L, 2L, 3L, 5L, 7L, 8L, 9L, 10L), ids);
+            assertEquals("Alice", names.get(0));
+            assertEquals("Bob", names.get(1));
+        }
+    }
+
     @Test
     void QueryResultGetErrorMessage() {
         try (QueryResult result = conn.query("MATCH (a:person) RETURN COUNT(*)")) {
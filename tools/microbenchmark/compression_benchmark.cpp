@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <random>
+
+#include "benchmark/benchmark.h"
+#include "common/system_config.h"
+#include "storage/compression/compression.h"
+
+using namespace ryu::common;
+using namespace ryu::storage;
+
+static constexpr uint64_t NUM_VALUES = 1 << 20;
+
+static std::vector<int64_t> generateValues(uint64_t maxValue, uint64_t runLength, bool sorted) {
+    std::mt19937_64 random{42};
+    std::vector<int64_t> values(NUM_VALUES);
+    for (auto i = 0u; i < NUM_VALUES; i += runLength) {
+        auto value = static_cast<int64_t>(random() % (maxValue + 1));
+        std::fill_n(values.begin() + i, std::min<uint64_t>(runLength, NUM_VALUES - i), value);
+    }
+    if (sorted) {
+        std::sort(values.begin(), values.end());
+    }
+    return values;
+}
+
+static std::vector<std::vector<uint8_t>> compressPages(const CompressionAlg& alg,
+    const std::vector<int64_t>& values, const CompressionMetadata& metadata) {
+    std::vector<std::vector<uint8_t>> pages;
+    auto src = reinterpret_cast<const uint8_t*>(values.data());
+    auto numValuesPerPage = metadata.numValues(RYU_PAGE_SIZE, PhysicalTypeID::INT64);
+    for (uint64_t numValuesRemaining = values.size(); numValuesRemaining > 0;) {
+        auto& page = pages.emplace_back(RYU_PAGE_SIZE);
+        alg.compressNextPage(src, numValuesRemaining, page.data(), RYU_PAGE_SIZE, metadata);
+        numValuesRemaining -= std::min(numValuesRemaining, numValuesPerPage);
+    }
+    return pages;
+}
+
+static void decompressPages(const CompressionAlg& alg,
+    const std::vector<std::vector<uint8_t>>& pages, const CompressionMetadata& metadata,
+    std::vector<int64_t>& result) {
+    auto numValuesPerPage = metadata.numValues(RYU_PAGE_SIZE, PhysicalTypeID::INT64);
+    auto dst = reinterpret_cast<uint8_t*>(result.data());
+    for (auto i = 0u; i < pages.size(); i++) {
+        auto startIdx = i * numValuesPerPage;
+        alg.decompressFromPage(pages[i].data(), 0 /* srcOffset */, dst, startIdx,
+            std::min(numValuesPerPage, result.size() - startIdx), metadata);
+    }
+}
+
+static CompressionMetadata getBitpackingMetadata(const std::vector<int64_t>& values) {
+    const auto [min, max] = std::minmax_element(values.begin(), values.end());
+    return CompressionMetadata(StorageValue(*min), StorageValue(*max),
+        CompressionType::INTEGER_BITPACKING);
+}
+
+static void BM_BitpackingCompress(benchmark::State& state) {
+    auto values = generateValues(state.range(0), 1 /* runLength */, false /* sorted */);
+    auto metadata = getBitpackingMetadata(values);
+    IntegerBitpacking<int64_t> alg;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(compressPages(alg, values, metadata));
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_VALUES);
+}
+BENCHMARK(BM_BitpackingCompress)->Arg(1)->Arg(1 << 10)->Arg(1 << 20)->Arg(1ull << 40);
+
+static void BM_BitpackingDecompress(benchmark::State& state) {
+    auto values = generateValues(state.range(0), 1 /* runLength */, false /* sorted */);
+    auto metadata = getBitpackingMetadata(values);
+    IntegerBitpacking<int64_t> alg;
+    auto pages = compressPages(alg, values, metadata);
+    std::vector<int64_t> result(NUM_VALUES);
+    for (auto _ : state) {
+        decompressPages(alg, pages, metadata, result);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_VALUES);
+}
+BENCHMARK(BM_BitpackingDecompress)->Arg(1)->Arg(1 << 10)->Arg(1 << 20)->Arg(1ull << 40);
+
+static void BM_DeltaDecompress(benchmark::State& state) {
+    auto values = generateValues(state.range(0), 1 /* runLength */, true /* sorted */);
+    const auto [min, max] = std::minmax_element(values.begin(), values.end());
+    auto metadata =
+        IntegerDelta<int64_t>::getMetadata(values, StorageValue(*min), StorageValue(*max));
+    if (!metadata.has_value()) {
+        state.SkipWithError("Values cannot be delta encoded.");
+        return;
+    }
+    IntegerDelta<int64_t> alg;
+    auto pages = compressPages(alg, values, *metadata);
+    std::vector<int64_t> result(NUM_VALUES);
+    for (auto _ : state) {
+        decompressPages(alg, pages, *metadata, result);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_VALUES);
+}
+BENCHMARK(BM_DeltaDecompress)->Arg(1 << 20)->Arg(1ull << 40);
+
+static void BM_RunLengthDecompress(benchmark::State& state) {
+    auto values = generateValues(1 << 20, state.range(0) /* runLength */, false /* sorted */);
+    const auto [min, max] = std::minmax_element(values.begin(), values.end());
+    auto metadata =
+        RunLengthEncoding<int64_t>::getMetadata(values, StorageValue(*min), StorageValue(*max));
+    if (!metadata.has_value()) {
+        state.SkipWithError("Runs are too short for run-length encoding.");
+        return;
+    }
+    RunLengthEncoding<int64_t> alg;
+    auto pages = compressPages(alg, values, *metadata);
+    std::vector<int64_t> result(NUM_VALUES);
+    for (auto _ : state) {
+        decompressPages(alg, pages, *metadata, result);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_VALUES);
+}
+BENCHMARK(BM_RunLengthDecompress)->Arg(16)->Arg(1024);
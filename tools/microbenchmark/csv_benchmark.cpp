@@ -0,0 +1,61 @@
+#include <filesystem>
+#include <fstream>
+
+#include "benchmark/benchmark.h"
+#include "common/string_format.h"
+#include "main/connection.h"
+#include "main/database.h"
+
+using namespace ryu::common;
+using namespace ryu::main;
+
+static constexpr uint64_t NUM_ROWS = 1 << 20;
+
+// Writes NUM_ROWS rows of an integer, a double and a string column, whose strings are quoted and
+// contain the delimiter if quoted is set.
+static std::string writeCSVFile(bool quoted) {
+    auto path = std::filesystem::temp_directory_path() /
+                (quoted ? "ryu_microbenchmark_quoted.csv" : "ryu_microbenchmark.csv");
+    std::ofstream file{path};
+    for (auto i = 0u; i < NUM_ROWS; i++) {
+        file << i << ',' << i * 0.5 << ',';
+        if (quoted) {
+            file << "\"name, " << i << '"';
+        } else {
+            file << "name" << i;
+        }
+        file << '\n';
+    }
+    return path.string();
+}
+
+// Scans the file with LOAD FROM. The query only counts the rows, so the time is dominated by
+// tokenizing and casting the values of the file.
+static void BM_CSVScan(benchmark::State& state) {
+    auto parallel = state.range(0) == 1;
+    auto quoted = state.range(1) == 1;
+    auto path = writeCSVFile(quoted);
+    Database database(":memory:");
+    Connection conn(&database);
+    auto query = stringFormat("LOAD WITH HEADERS (a INT64, b DOUBLE, c STRING) FROM '{}' "
+                              "(HEADER=false, PARALLEL={}) RETURN COUNT(*)",
+        path, parallel ? "true" : "false");
+    for (auto _ : state) {
+        auto result = conn.query(query);
+        if (!result->isSuccess()) {
+            state.SkipWithError(result->getErrorMessage().c_str());
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_ROWS);
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(path));
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_CSVScan)
+    ->ArgNames({"parallel", "quoted"})
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,81 @@
+#include <random>
+
+#include "benchmark/benchmark.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+#include "storage/local_storage/local_hash_index.h"
+#include "storage/overflow_file.h"
+
+using namespace ryu::common;
+using namespace ryu::storage;
+
+static bool isVisible(offset_t) {
+    return true;
+}
+
+// Builds an index over numKeys keys in an in-memory buffer manager.
+class HashIndexFixture : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State& state) override {
+        bm = std::make_unique<BufferManager>(":memory:", "", 1ull << 30 /* bufferPoolSize */,
+            1ull << 32 /* maxDBSize */, nullptr, true /* readOnly */);
+        memoryManager = std::make_unique<MemoryManager>(bm.get(), nullptr);
+        overflowFile = std::make_unique<InMemOverflowFile>(*memoryManager);
+        numKeys = state.range(0);
+        hashIndex = std::make_unique<LocalHashIndex>(*memoryManager, PhysicalTypeID::INT64,
+            overflowFile->addHandle());
+        for (int64_t i = 0; i < numKeys; i++) {
+            hashIndex->insert(i, i, isVisible);
+        }
+    }
+
+    void TearDown(benchmark::State&) override {
+        hashIndex.reset();
+        overflowFile.reset();
+        memoryManager.reset();
+        bm.reset();
+    }
+
+protected:
+    std::unique_ptr<BufferManager> bm;
+    std::unique_ptr<MemoryManager> memoryManager;
+    std::unique_ptr<InMemOverflowFile> overflowFile;
+    std::unique_ptr<LocalHashIndex> hashIndex;
+    int64_t numKeys = 0;
+};
+
+BENCHMARK_DEFINE_F(HashIndexFixture, LookupHit)(benchmark::State& state) {
+    std::mt19937_64 random{42};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            hashIndex->lookup(static_cast<int64_t>(random() % numKeys), isVisible));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(HashIndexFixture, LookupHit)->Arg(1 << 16)->Arg(1 << 22);
+
+BENCHMARK_DEFINE_F(HashIndexFixture, LookupMiss)(benchmark::State& state) {
+    std::mt19937_64 random{42};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            hashIndex->lookup(numKeys + static_cast<int64_t>(random() % numKeys), isVisible));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(HashIndexFixture, LookupMiss)->Arg(1 << 16)->Arg(1 << 22);
+
+static void BM_HashIndexInsert(benchmark::State& state) {
+    BufferManager bm(":memory:", "", 1ull << 30 /* bufferPoolSize */, 1ull << 32 /* maxDBSize */,
+        nullptr, true /* readOnly */);
+    MemoryManager memoryManager(&bm, nullptr);
+    InMemOverflowFile overflowFile(memoryManager);
+    auto overflowFileHandle = overflowFile.addHandle();
+    for (auto _ : state) {
+        LocalHashIndex hashIndex(memoryManager, PhysicalTypeID::INT64, overflowFileHandle);
+        for (int64_t i = 0; i < state.range(0); i++) {
+            hashIndex.insert(i, i, isVisible);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashIndexInsert)->Arg(1 << 16)->Arg(1 << 20);
@@ -0,0 +1,87 @@
+#include <random>
+
+#include "benchmark/benchmark.h"
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/vector/value_vector.h"
+#include "processor/data_pos.h"
+#include "processor/operator/hash_join/join_hash_table.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace ryu::common;
+using namespace ryu::processor;
+using namespace ryu::storage;
+
+// Builds a join hash table on numKeys distinct INT64 keys without payloads, laid out like the
+// tables of HashJoinBuild: keys, then the hash and the pointer to the previous tuple of the chain.
+class JoinHashTableFixture : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State& state) override {
+        bm = std::make_unique<BufferManager>(":memory:", "", 1ull << 30 /* bufferPoolSize */,
+            1ull << 32 /* maxDBSize */, nullptr, true /* readOnly */);
+        memoryManager = std::make_unique<MemoryManager>(bm.get(), nullptr);
+        numKeys = state.range(0);
+        auto tableSchema = FactorizedTableSchema();
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* groupID */,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::HASH())));
+        tableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, INVALID_DATA_CHUNK_POS,
+            LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+        std::vector<LogicalType> keyTypes;
+        keyTypes.push_back(LogicalType::INT64());
+        hashTable = std::make_unique<JoinHashTable>(*memoryManager, std::move(keyTypes),
+            std::move(tableSchema));
+        auto keyState = std::make_shared<DataChunkState>(DEFAULT_VECTOR_CAPACITY);
+        ValueVector keyVector(LogicalType::INT64(), memoryManager.get(), keyState);
+        for (int64_t startKey = 0; startKey < numKeys; startKey += DEFAULT_VECTOR_CAPACITY) {
+            auto numKeysInBatch = std::min<int64_t>(DEFAULT_VECTOR_CAPACITY, numKeys - startKey);
+            for (auto i = 0; i < numKeysInBatch; i++) {
+                keyVector.setValue<int64_t>(i, startKey + i);
+            }
+            keyState->getSelVectorUnsafe().setToUnfiltered(numKeysInBatch);
+            hashTable->appendVectors({&keyVector}, {} /* payloadVectors */, keyState.get());
+        }
+        hashTable->allocateHashSlots(numKeys);
+        hashTable->buildHashSlots();
+    }
+
+    void TearDown(benchmark::State&) override {
+        hashTable.reset();
+        memoryManager.reset();
+        bm.reset();
+    }
+
+protected:
+    std::unique_ptr<BufferManager> bm;
+    std::unique_ptr<MemoryManager> memoryManager;
+    std::unique_ptr<JoinHashTable> hashTable;
+    int64_t numKeys = 0;
+};
+
+// Probes vectors of random keys of which about half have a match.
+BENCHMARK_DEFINE_F(JoinHashTableFixture, Probe)(benchmark::State& state) {
+    std::mt19937_64 random{42};
+    auto keyState = std::make_shared<DataChunkState>(DEFAULT_VECTOR_CAPACITY);
+    ValueVector keyVector(LogicalType::INT64(), memoryManager.get(), keyState);
+    ValueVector hashVector(LogicalType::HASH(), memoryManager.get());
+    SelectionVector hashSelVec(DEFAULT_VECTOR_CAPACITY);
+    SelectionVector matchedSelVec(DEFAULT_VECTOR_CAPACITY);
+    auto probedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    auto matchedTuples = std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
+    std::vector<ValueVector*> keyVectors{&keyVector};
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto i = 0u; i < DEFAULT_VECTOR_CAPACITY; i++) {
+            keyVector.setValue<int64_t>(i, static_cast<int64_t>(random() % (2 * numKeys)));
+        }
+        keyState->getSelVectorUnsafe().setToUnfiltered(DEFAULT_VECTOR_CAPACITY);
+        state.ResumeTiming();
+        hashTable->probe(keyVectors, hashVector, hashSelVec, nullptr /* tmpHashResultVector */,
+            probedTuples.get());
+        benchmark::DoNotOptimize(hashTable->matchUnFlatKey(&keyVector, probedTuples.get(),
+            matchedTuples.get(), matchedSelVec));
+    }
+    state.SetItemsProcessed(state.iterations() * DEFAULT_VECTOR_CAPACITY);
+}
+BENCHMARK_REGISTER_F(JoinHashTableFixture, Probe)->Arg(1 << 12)->Arg(1 << 20)->Arg(1 << 24);
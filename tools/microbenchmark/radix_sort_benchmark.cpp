@@ -0,0 +1,65 @@
+#include <random>
+
+#include "benchmark/benchmark.h"
+#include "common/constants.h"
+#include "common/data_chunk/data_chunk_state.h"
+#include "common/vector/value_vector.h"
+#include "main/client_config.h"
+#include "processor/operator/order_by/order_by_key_encoder.h"
+#include "processor/operator/order_by/radix_sort.h"
+#include "processor/result/factorized_table.h"
+#include "storage/buffer_manager/buffer_manager.h"
+#include "storage/buffer_manager/memory_manager.h"
+
+using namespace ryu::common;
+using namespace ryu::main;
+using namespace ryu::processor;
+using namespace ryu::storage;
+
+static constexpr uint64_t NUM_TUPLES = 1 << 20;
+
+// Sorts the encoded key blocks of NUM_TUPLES random INT64 keys drawn from range(0) distinct
+// values. Fewer distinct values produce more ties between the radix sort passes.
+static void BM_RadixSortInt64(benchmark::State& state) {
+    BufferManager bm(":memory:", "", 1ull << 30 /* bufferPoolSize */, 1ull << 32 /* maxDBSize */,
+        nullptr, true /* readOnly */);
+    MemoryManager memoryManager(&bm, nullptr);
+    auto payloadTableSchema = FactorizedTableSchema();
+    payloadTableSchema.appendColumn(ColumnSchema(false /* isUnFlat */, 0 /* groupID */,
+        LogicalTypeUtils::getRowLayoutSize(LogicalType::INT64())));
+    FactorizedTable payloadTable(&memoryManager, payloadTableSchema.copy());
+    std::vector<LogicalType> keyTypes;
+    keyTypes.push_back(LogicalType::INT64());
+    std::vector<LogicalType> payloadTypes;
+    payloadTypes.push_back(LogicalType::INT64());
+    OrderByDataInfo info({DataPos(0, 0)}, {DataPos(0, 0)}, std::move(keyTypes),
+        std::move(payloadTypes), {true /* isAscOrder */}, std::move(payloadTableSchema),
+        {0} /* keyInPayloadPos */, ClientConfigDefault::SORT_STRING_PREFIX_LENGTH);
+    auto numBytesPerTuple = OrderByKeyEncoder::getEncodingSize(LogicalType::INT64(),
+                                info.strPrefixLength) +
+                            OrderByConstants::NUM_BYTES_FOR_PAYLOAD_IDX;
+    OrderByKeyEncoder encoder(info, &memoryManager, 0 /* ftIdx */,
+        payloadTable.getNumTuplesPerBlock(), numBytesPerTuple);
+    RadixSort radixSort(&memoryManager, payloadTable, encoder, {} /* strKeyColsInfo */);
+    std::mt19937_64 random{42};
+    auto keyState = std::make_shared<DataChunkState>(DEFAULT_VECTOR_CAPACITY);
+    ValueVector keyVector(LogicalType::INT64(), &memoryManager, keyState);
+    keyState->getSelVectorUnsafe().setToUnfiltered(DEFAULT_VECTOR_CAPACITY);
+    for (auto _ : state) {
+        state.PauseTiming();
+        encoder.reset();
+        for (auto i = 0u; i < NUM_TUPLES; i += DEFAULT_VECTOR_CAPACITY) {
+            for (auto j = 0u; j < DEFAULT_VECTOR_CAPACITY; j++) {
+                keyVector.setValue<int64_t>(j, static_cast<int64_t>(random() % state.range(0)));
+            }
+            encoder.encodeKeys({&keyVector});
+        }
+        state.ResumeTiming();
+        for (auto& keyBlock : encoder.getKeyBlocks()) {
+            radixSort.sortSingleKeyBlock(*keyBlock);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_TUPLES);
+}
+BENCHMARK(BM_RadixSortInt64)->Arg(1 << 8)->Arg(1 << 20)->Arg(1ll << 40);
@@ -12,6 +12,7 @@ using namespace ryu::main;
 
 class NodeQueryResult : public Napi::ObjectWrap<NodeQueryResult> {
     friend class NodeQueryResultGetNextAsyncWorker;
+    friend class NodeQueryResultGetNextBatchAsyncWorker;
     friend class NodeQueryResultGetColumnMetadataAsyncWorker;
     friend class NodeQueryResultGetNextQueryResultAsyncWorker;
     friend class NodeQueryResultGetQuerySummaryAsyncWorker;
@@ -31,6 +32,7 @@ private:
     Napi::Value GetNumTuples(const Napi::CallbackInfo& info);
     Napi::Value GetNextAsync(const Napi::CallbackInfo& info);
     Napi::Value GetNextSync(const Napi::CallbackInfo& info);
+    Napi::Value GetNextBatchAsync(const Napi::CallbackInfo& info);
     Napi::Value GetColumnDataTypesAsync(const Napi::CallbackInfo& info);
     Napi::Value GetColumnDataTypesSync(const Napi::CallbackInfo& info);
     Napi::Value GetColumnNamesAsync(const Napi::CallbackInfo& info);
@@ -136,6 +138,63 @@ private:
     std::shared_ptr<FlatTuple> cppTuple;
 };
 
+// Fetches up to batchSize rows per round trip to the thread pool. The values are copied because the
+// tuple returned by the query result is overwritten by the next call to getNext().
+class NodeQueryResultGetNextBatchAsyncWorker : public Napi::AsyncWorker {
+public:
+    NodeQueryResultGetNextBatchAsyncWorker(Napi::Function& callback,
+        NodeQueryResult* nodeQueryResult, uint64_t batchSize)
+        : AsyncWorker(callback), nodeQueryResult(nodeQueryResult), batchSize(batchSize) {}
+
+    ~NodeQueryResultGetNextBatchAsyncWorker() override = default;
+
+    inline void Execute() override {
+        try {
+            nodeQueryResult->PopulateColumnNames();
+            auto numColumns = nodeQueryResult->columnNames->size();
+            while (values.size() < batchSize * numColumns &&
+                   nodeQueryResult->queryResult->hasNext()) {
+                auto cppTuple = nodeQueryResult->queryResult->getNext();
+                for (auto i = 0u; i < numColumns; ++i) {
+                    values.push_back(cppTuple->getValue(i)->copy());
+                }
+                numRows++;
+            }
+        } catch (const std::exception& exc) {
+            SetError(std::string(exc.what()));
+        }
+    }
+
+    inline void OnOK() override {
+        auto env = Env();
+        auto& columnNames = *nodeQueryResult->columnNames;
+        Napi::Array nodeRows = Napi::Array::New(env, numRows);
+        try {
+            for (auto row = 0u; row < numRows; ++row) {
+                Napi::Object nodeTuple = Napi::Object::New(env);
+                for (auto i = 0u; i < columnNames.size(); ++i) {
+                    auto& value = *values[row * columnNames.size() + i];
+                    nodeTuple.Set(columnNames[i], Util::ConvertToNapiObject(value, env));
+                }
+                nodeRows.Set(row, nodeTuple);
+            }
+        } catch (const std::exception& exc) {
+            auto napiError = Napi::Error::New(env, exc.what());
+            Callback().Call({napiError.Value(), env.Undefined()});
+            return;
+        }
+        Callback().Call({env.Null(), nodeRows});
+    }
+
+    inline void OnError(Napi::Error const& error) override { Callback().Call({error.Value()}); }
+
+private:
+    NodeQueryResult* nodeQueryResult;
+    uint64_t batchSize;
+    uint64_t numRows = 0;
+    std::vector<std::unique_ptr<ryu::common::Value>> values;
+};
+
 class NodeQueryResultGetNextQueryResultAsyncWorker : public Napi::AsyncWorker {
 public:
     NodeQueryResultGetNextQueryResultAsyncWorker(Napi::Function& callback,
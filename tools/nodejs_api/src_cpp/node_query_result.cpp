@@ -19,6 +19,7 @@ Napi::Object NodeQueryResult::Init(Napi::Env env, Napi::Object exports) {
             InstanceMethod("getNumTuples", &NodeQueryResult::GetNumTuples),
             InstanceMethod("getNextSync", &NodeQueryResult::GetNextSync),
             InstanceMethod("getNextAsync", &NodeQueryResult::GetNextAsync),
+            InstanceMethod("getNextBatchAsync", &NodeQueryResult::GetNextBatchAsync),
             InstanceMethod("getColumnDataTypesAsync", &NodeQueryResult::GetColumnDataTypesAsync),
             InstanceMethod("getColumnDataTypesSync", &NodeQueryResult::GetColumnDataTypesSync),
             InstanceMethod("getColumnNamesAsync", &NodeQueryResult::GetColumnNamesAsync),
@@ -123,6 +124,16 @@ Napi::Value NodeQueryResult::GetNextAsync(const Napi::CallbackInfo& info) {
     return info.Env().Undefined();
 }
 
+Napi::Value NodeQueryResult::GetNextBatchAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    Napi::HandleScope scope(env);
+    auto batchSize = info[0].As<Napi::Number>().Int64Value();
+    auto callback = info[1].As<Napi::Function>();
+    auto* asyncWorker = new NodeQueryResultGetNextBatchAsyncWorker(callback, this, batchSize);
+    asyncWorker->Queue();
+    return info.Env().Undefined();
+}
+
 Napi::Value NodeQueryResult::GetNextSync(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
     Napi::HandleScope scope(env);
@@ -2,6 +2,8 @@
 
 const assert = require("assert");
 
+const DEFAULT_BATCH_SIZE = 1024;
+
 class QueryResult {
   /**
    * Internal constructor. Use `Connection.query` or `Connection.execute`
@@ -66,6 +68,40 @@ class QueryResult {
     });
   }
 
+  /**
+   * Get the next rows of the query result. The rows are fetched and converted in a single round trip
+   * to the thread pool, which is much faster than calling `getNext` for each row.
+   * @param {Number} batchSize the maximum number of rows to return. Defaults to 1024.
+   * @returns {Promise<Array<Object>>} a promise that resolves to the next rows of the query result, or to an empty array if there are no more rows. The promise is rejected if there is an error.
+   */
+  getNextBatch(batchSize = DEFAULT_BATCH_SIZE) {
+    this._checkClosed();
+    if (!Number.isInteger(batchSize) || batchSize <= 0) {
+      throw new Error("Batch size must be a positive integer.");
+    }
+    return new Promise((resolve, reject) => {
+      this._queryResult.getNextBatchAsync(batchSize, (err, result) => {
+        if (err) {
+          return reject(err);
+        }
+        return resolve(result);
+      });
+    });
+  }
+
+  /**
+   * Iterate through the remaining rows of the query result with `for await`. Rows are fetched in
+   * batches of `DEFAULT_BATCH_SIZE`.
+   * @returns {AsyncIterator<Object>} an async iterator over the rows of the query result.
+   */
+  async *[Symbol.asyncIterator]() {
+    while (this.hasNext()) {
+      for (const row of await this.getNextBatch()) {
+        yield row;
+      }
+    }
+  }
+
   /**
    * Get the next row of the query result synchronously.
    * @returns {Object} the next row of the query result.
@@ -105,7 +141,9 @@ class QueryResult {
     this._queryResult.resetIterator();
     const result = [];
     while (this.hasNext()) {
-      result.push(await this.getNext());
+      for (const row of await this.getNextBatch()) {
+        result.push(row);
+      }
     }
     return result;
   }
@@ -320,6 +320,18 @@ export class QueryResult {
      */
     getNextSync(): Record<string, RyuValue> | null;
 
+    /**
+     * Get the next rows in a single round trip to the thread pool.
+     * @param batchSize Maximum number of rows to return (default: 1024)
+     * @returns Promise that resolves to the next rows, or to an empty array if no more rows
+     */
+    getNextBatch(batchSize?: number): Promise<Record<string, RyuValue>[]>;
+
+    /**
+     * Iterate through the remaining rows with `for await`, fetching them in batches.
+     */
+    [Symbol.asyncIterator](): AsyncIterator<Record<string, RyuValue>>;
+
     /**
      * Iterate through the query result with callback functions.
      * @param resultCallback Callback function called for each row
@@ -85,6 +85,46 @@ describe("Get next", function () {
   });
 });
 
+describe("Get next batch", function () {
+  it("should return the next tuples in batches", async function () {
+    const queryResult = await conn.query(
+      "MATCH (a:person) RETURN a.ID ORDER BY a.ID"
+    );
+    let tuples = await queryResult.getNextBatch(3);
+    assert.deepEqual(
+      tuples.map((tuple) => tuple["a.ID"]),
+      PERSON_IDS.slice(0, 3)
+    );
+    tuples = await queryResult.getNextBatch(100);
+    assert.deepEqual(
+      tuples.map((tuple) => tuple["a.ID"]),
+      PERSON_IDS.slice(3)
+    );
+    assert.deepEqual(await queryResult.getNextBatch(3), []);
+  });
+
+  it("should throw an error if the batch size is not positive", async function () {
+    const queryResult = await conn.query(
+      "MATCH (a:person) RETURN a.ID ORDER BY a.ID"
+    );
+    assert.throws(
+      () => queryResult.getNextBatch(0),
+      /Batch size must be a positive integer./
+    );
+  });
+
+  it("should iterate through all tuples with for await", async function () {
+    const queryResult = await conn.query(
+      "MATCH (a:person) RETURN a.ID ORDER BY a.ID"
+    );
+    const ids = [];
+    for await (const tuple of queryResult) {
+      ids.push(tuple["a.ID"]);
+    }
+    assert.deepEqual(ids, PERSON_IDS);
+  });
+});
+
 describe("Each", function () {
   it("should iterate through all tuples in order", async function () {
     const queryResult = await conn.query(
@@ -26,6 +26,9 @@ public:
     std::unique_ptr<PyQueryResult> execute(PyPreparedStatement* preparedStatement,
         const py::dict& params);
 
+    std::unique_ptr<PyQueryResult> executeBatch(PyPreparedStatement* preparedStatement,
+        const py::list& batch);
+
     std::unique_ptr<PyQueryResult> query(const std::string& statement);
 
     void setMaxNumThreadForExec(uint64_t numThreads);
@@ -45,7 +48,8 @@ public:
     static bool isPyArrowTable(const py::handle& object);
 
     void createScalarFunction(const std::string& name, const py::function& udf,
-        const py::list& params, const std::string& retval, bool defaultNull, bool catchExceptions);
+        const py::list& params, const std::string& retval, bool defaultNull, bool catchExceptions,
+        bool vectorized);
     void removeScalarFunction(const std::string& name);
 
     static Value transformPythonValue(const py::handle& val);
@@ -36,6 +36,12 @@ public:
 
     ryu::pyarrow::Table getAsArrow(std::int64_t chunkSize, bool fallbackExtensionTypes);
 
+    py::object getArrowSchema(bool fallbackExtensionTypes);
+
+    // Converts the next chunkSize rows into a record batch, or returns None at the end of the
+    // result.
+    py::object getNextArrowBatch(std::int64_t chunkSize, bool fallbackExtensionTypes);
+
     py::list getColumnDataTypes();
 
     py::list getColumnNames();
@@ -55,8 +61,8 @@ public:
 private:
     static py::dict convertNodeIdToPyDict(const ryu::common::nodeID_t& nodeId);
 
-    void getNextArrowChunk(const std::vector<ryu::common::LogicalType>& types,
-        const std::vector<std::string>& names, py::list& batches, std::int64_t chunkSize,
+    py::object getNextArrowChunk(const std::vector<ryu::common::LogicalType>& types,
+        const std::vector<std::string>& names, std::int64_t chunkSize,
         bool fallbackExtensionTypes);
     py::object getArrowChunks(const std::vector<ryu::common::LogicalType>& types,
         const std::vector<std::string>& names, std::int64_t chunkSize, bool fallbackExtensionTypes);
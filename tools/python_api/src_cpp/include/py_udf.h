@@ -20,5 +20,5 @@ class PyUDF {
 public:
     static function_set toFunctionSet(const std::string& name, const py::function& udf,
         const py::list& paramTypes, const std::string& resultType, bool defaultNull,
-        bool catchExceptions, ryu::main::ClientContext* context);
+        bool catchExceptions, bool vectorized, ryu::main::ClientContext* context);
 };
@@ -72,6 +72,10 @@ void pandasBackendScanSwitch(PandasColumnBindData* bindData, uint64_t count, uin
     }
 }
 
+static bool isObjectColumn(const PandasColumnBindData& bindData) {
+    return bindData.npType.type == NumpyNullableType::OBJECT;
+}
+
 offset_t tableFunc(const TableFuncInput& input, const TableFuncOutput& output) {
     auto pandasScanData = input.bindData->constPtrCast<PandasScanFunctionData>();
     auto pandasLocalState = input.localState->ptrCast<PandasScanLocalState>();
@@ -87,10 +91,29 @@ offset_t tableFunc(const TableFuncInput& input, const TableFuncOutput& output) {
     auto numValuesToOutput =
         std::min(DEFAULT_VECTOR_CAPACITY, pandasLocalState->end - pandasLocalState->start);
     auto skips = pandasScanData->getColumnSkips();
+    auto hasObjectColumns = false;
     for (auto i = 0u; i < pandasScanData->getNumColumns(); i++) {
-        if (!skips[i]) {
-            pandasBackendScanSwitch(pandasScanData->columnBindData[i].get(), numValuesToOutput,
-                pandasLocalState->start, &output.dataChunk.getValueVectorMutable(i));
+        if (skips[i]) {
+            continue;
+        }
+        if (isObjectColumn(*pandasScanData->columnBindData[i])) {
+            hasObjectColumns = true;
+            continue;
+        }
+        // Fixed-width columns are copied without the GIL, so threads scan them in parallel.
+        pandasBackendScanSwitch(pandasScanData->columnBindData[i].get(), numValuesToOutput,
+            pandasLocalState->start, &output.dataChunk.getValueVectorMutable(i));
+    }
+    if (hasObjectColumns) {
+        // Object columns are converted through the Python C API. The GIL is acquired once for all
+        // of them instead of once per column.
+        py::gil_scoped_acquire acquire;
+        for (auto i = 0u; i < pandasScanData->getNumColumns(); i++) {
+            if (!skips[i] && isObjectColumn(*pandasScanData->columnBindData[i])) {
+                pandasBackendScanSwitch(pandasScanData->columnBindData[i].get(),
+                    numValuesToOutput, pandasLocalState->start,
+                    &output.dataChunk.getValueVectorMutable(i));
+            }
         }
     }
     output.dataChunk.state->getSelVectorUnsafe().setSelSize(numValuesToOutput);
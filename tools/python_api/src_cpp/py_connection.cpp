@@ -27,6 +27,8 @@ void PyConnection::initialize(py::handle& m) {
         .def("close", &PyConnection::close)
         .def("execute", &PyConnection::execute, py::arg("prepared_statement"),
             py::arg("parameters") = py::dict())
+        .def("execute_batch", &PyConnection::executeBatch, py::arg("prepared_statement"),
+            py::arg("batch"))
         .def("query", &PyConnection::query, py::arg("statement"))
         .def("set_max_threads_for_exec", &PyConnection::setMaxNumThreadForExec,
             py::arg("num_threads"))
@@ -41,7 +43,7 @@ void PyConnection::initialize(py::handle& m) {
             py::arg("dst_table_name"), py::arg("query_batch_size"))
         .def("create_function", &PyConnection::createScalarFunction, py::arg("name"),
             py::arg("udf"), py::arg("params_type"), py::arg("return_value"),
-            py::arg("default_null"), py::arg("catch_exceptions"))
+            py::arg("default_null"), py::arg("catch_exceptions"), py::arg("vectorized") = false)
         .def("remove_function", &PyConnection::removeScalarFunction, py::arg("name"));
     PyDateTime_IMPORT;
 }
@@ -159,6 +161,23 @@ std::unique_ptr<PyQueryResult> PyConnection::execute(PyPreparedStatement* prepar
     return checkAndWrapQueryResult(queryResult);
 }
 
+std::unique_ptr<PyQueryResult> PyConnection::executeBatch(PyPreparedStatement* preparedStatement,
+    const py::list& batch) {
+    std::vector<std::unordered_map<std::string, std::unique_ptr<Value>>> parameterSets;
+    parameterSets.reserve(batch.size());
+    for (auto params : batch) {
+        if (!py::isinstance<py::dict>(params)) {
+            throw std::runtime_error("Each parameter set of a batch must be a dict.");
+        }
+        parameterSets.push_back(transformPythonParameters(params.cast<py::dict>(), conn.get()));
+    }
+    py::gil_scoped_release release;
+    auto queryResult =
+        conn->executeBatch(preparedStatement->preparedStatement.get(), std::move(parameterSets));
+    py::gil_scoped_acquire acquire;
+    return checkAndWrapQueryResult(queryResult);
+}
+
 std::unique_ptr<PyQueryResult> PyConnection::query(const std::string& statement) {
     py::gil_scoped_release release;
     auto queryResult = conn->query(statement);
@@ -760,9 +779,10 @@ std::unique_ptr<PyQueryResult> PyConnection::checkAndWrapQueryResult(
 }
 
 void PyConnection::createScalarFunction(const std::string& name, const py::function& udf,
-    const py::list& params, const std::string& retval, bool defaultNull, bool catchExceptions) {
+    const py::list& params, const std::string& retval, bool defaultNull, bool catchExceptions,
+    bool vectorized) {
     conn->addUDFFunctionSet(name, PyUDF::toFunctionSet(name, udf, params, retval, defaultNull,
-                                      catchExceptions, conn->getClientContext()));
+                                      catchExceptions, vectorized, conn->getClientContext()));
 }
 
 void PyConnection::removeScalarFunction(const std::string& name) {
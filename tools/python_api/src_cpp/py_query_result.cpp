@@ -30,6 +30,8 @@ void PyQueryResult::initialize(py::handle& m) {
         .def("close", &PyQueryResult::close)
         .def("getAsDF", &PyQueryResult::getAsDF)
         .def("getAsArrow", &PyQueryResult::getAsArrow)
+        .def("getArrowSchema", &PyQueryResult::getArrowSchema)
+        .def("getNextArrowBatch", &PyQueryResult::getNextArrowBatch)
         .def("getColumnNames", &PyQueryResult::getColumnNames)
         .def("getColumnDataTypes", &PyQueryResult::getColumnDataTypes)
         .def("resetIterator", &PyQueryResult::resetIterator)
@@ -289,34 +291,48 @@ py::object PyQueryResult::getAsDF() {
     return QueryResultConverter(queryResult).toDF();
 }
 
-void PyQueryResult::getNextArrowChunk(const std::vector<LogicalType>& types,
-    const std::vector<std::string>& names, py::list& batches, std::int64_t chunkSize,
-    bool fallbackExtensionTypes) {
-    auto rowBatch = std::make_unique<ArrowRowBatch>(types, chunkSize, fallbackExtensionTypes);
-    auto rowBatchSize = 0u;
-    while (rowBatchSize < chunkSize) {
-        if (!queryResult->hasNext()) {
-            break;
+py::object PyQueryResult::getNextArrowChunk(const std::vector<LogicalType>& types,
+    const std::vector<std::string>& names, std::int64_t chunkSize, bool fallbackExtensionTypes) {
+    ArrowArray data{};
+    {
+        // Rows are converted without holding the GIL, so that other Python threads, e.g. consumers
+        // of the previous batches, can run in the meantime.
+        py::gil_scoped_release release;
+        auto rowBatch = ArrowRowBatch(types, chunkSize, fallbackExtensionTypes);
+        while (rowBatch.size() < chunkSize && queryResult->hasNext()) {
+            rowBatch.append(*queryResult->getNext());
         }
-        auto tuple = queryResult->getNext();
-        rowBatch->append(*tuple);
-        rowBatchSize++;
+        data = rowBatch.toArray(types);
     }
-    auto data = rowBatch->toArray(types);
     auto batchImportFunc = importCache->pyarrow.lib.RecordBatch._import_from_c();
     auto schema = ArrowConverter::toArrowSchema(types, names, fallbackExtensionTypes);
-    batches.append(batchImportFunc((std::uint64_t)&data, (std::uint64_t)schema.get()));
+    return batchImportFunc((std::uint64_t)&data, (std::uint64_t)schema.get());
 }
 
 py::object PyQueryResult::getArrowChunks(const std::vector<LogicalType>& types,
     const std::vector<std::string>& names, std::int64_t chunkSize, bool fallbackExtensionTypes) {
     py::list batches;
     while (queryResult->hasNext()) {
-        getNextArrowChunk(types, names, batches, chunkSize, fallbackExtensionTypes);
+        batches.append(getNextArrowChunk(types, names, chunkSize, fallbackExtensionTypes));
     }
     return batches;
 }
 
+py::object PyQueryResult::getArrowSchema(bool fallbackExtensionTypes) {
+    auto schema = ArrowConverter::toArrowSchema(queryResult->getColumnDataTypes(),
+        queryResult->getColumnNames(), fallbackExtensionTypes);
+    auto schemaImportFunc = importCache->pyarrow.lib.Schema._import_from_c();
+    return schemaImportFunc((std::uint64_t)schema.get());
+}
+
+py::object PyQueryResult::getNextArrowBatch(std::int64_t chunkSize, bool fallbackExtensionTypes) {
+    if (!queryResult->hasNext()) {
+        return py::none();
+    }
+    return getNextArrowChunk(queryResult->getColumnDataTypes(), queryResult->getColumnNames(),
+        chunkSize, fallbackExtensionTypes);
+}
+
 ryu::pyarrow::Table PyQueryResult::getAsArrow(std::int64_t chunkSize, bool fallbackExtensionTypes) {
     auto types = queryResult->getColumnDataTypes();
     auto names = queryResult->getColumnNames();
@@ -141,15 +141,17 @@ static py::object getSignature(const py::function& udf) {
     }
 }
 
-static PyUDFSignature analyzeSignature(const py::function& udf) {
+// The annotations of a vectorized UDF describe arrays, so its types must be given explicitly.
+static PyUDFSignature analyzeSignature(const py::function& udf, bool vectorized) {
     PyUDFSignature UDFSignature;
     auto signature = getSignature(udf);
     auto parameters = signature.attr("parameters");
     auto returnAnnotation = signature.attr("return_annotation");
-    UDFSignature.resultType = getLogicalType(returnAnnotation);
+    UDFSignature.resultType = vectorized ? LogicalType::ANY() : getLogicalType(returnAnnotation);
     for (const auto& parameter : parameters) {
         auto paramAnnotation = parameters.attr("__getitem__")(parameter).attr("annotation");
-        UDFSignature.paramTypes.push_back(getLogicalType(paramAnnotation));
+        UDFSignature.paramTypes.push_back(
+            vectorized ? LogicalType::ANY() : getLogicalType(paramAnnotation));
     }
     return UDFSignature;
 }
@@ -197,6 +199,173 @@ static scalar_func_exec_t getUDFExecFunc(const py::function& udf, bool defaultNu
     };
 }
 
+template<typename T>
+static py::object toNumpyArray(const ValueVector& vector, const std::vector<sel_t>& positions) {
+    py::array_t<T> data(positions.size());
+    py::array_t<bool> mask(positions.size());
+    auto dataBuffer = data.mutable_data();
+    auto maskBuffer = mask.mutable_data();
+    auto hasNull = false;
+    for (auto i = 0u; i < positions.size(); ++i) {
+        maskBuffer[i] = vector.isNull(positions[i]);
+        hasNull |= maskBuffer[i];
+        dataBuffer[i] = maskBuffer[i] ? T{} : vector.getValue<T>(positions[i]);
+    }
+    if (!hasNull) {
+        return std::move(data);
+    }
+    return importCache->numpyma.masked_array()(data, mask);
+}
+
+// Numeric values are copied into a NumPy array (masked if there are nulls), other values are
+// converted into a list of Python objects.
+static py::object toPyArray(const ValueVector& vector, const std::vector<sel_t>& positions) {
+    switch (vector.dataType.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+        return toNumpyArray<bool>(vector, positions);
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+        return toNumpyArray<int64_t>(vector, positions);
+    case LogicalTypeID::INT32:
+        return toNumpyArray<int32_t>(vector, positions);
+    case LogicalTypeID::INT16:
+        return toNumpyArray<int16_t>(vector, positions);
+    case LogicalTypeID::INT8:
+        return toNumpyArray<int8_t>(vector, positions);
+    case LogicalTypeID::UINT64:
+        return toNumpyArray<uint64_t>(vector, positions);
+    case LogicalTypeID::UINT32:
+        return toNumpyArray<uint32_t>(vector, positions);
+    case LogicalTypeID::UINT16:
+        return toNumpyArray<uint16_t>(vector, positions);
+    case LogicalTypeID::UINT8:
+        return toNumpyArray<uint8_t>(vector, positions);
+    case LogicalTypeID::DOUBLE:
+        return toNumpyArray<double>(vector, positions);
+    case LogicalTypeID::FLOAT:
+        return toNumpyArray<float>(vector, positions);
+    default: {
+        py::list list(positions.size());
+        for (auto i = 0u; i < positions.size(); ++i) {
+            list[i] = PyQueryResult::convertValueToPyObject(*vector.getAsValue(positions[i]));
+        }
+        return std::move(list);
+    }
+    }
+}
+
+template<typename T>
+static void copyFromNumpyArray(const py::handle& pyResult, ValueVector& result,
+    const std::vector<sel_t>& positions) {
+    auto array = py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(pyResult);
+    if (!array) {
+        throw py::error_already_set();
+    }
+    auto data = array.data();
+    for (auto i = 0u; i < positions.size(); ++i) {
+        result.setNull(positions[i], false);
+        result.setValue<T>(positions[i], data[i]);
+    }
+}
+
+// Unmasked NumPy arrays of numeric values are copied directly. Other sequences, e.g. masked
+// arrays, PyArrow arrays or lists, are converted value by value.
+static void copyFromPyArray(const py::handle& pyResult, ValueVector& result,
+    const std::vector<sel_t>& positions) {
+    if (py::len(pyResult) != positions.size()) {
+        throw RuntimeException(stringFormat("Vectorized UDF returned {} values for {} rows.",
+            py::len(pyResult), positions.size()));
+    }
+    if (py::isinstance<py::array>(pyResult) &&
+        !py::isinstance(pyResult, importCache->numpyma.masked_array())) {
+        switch (result.dataType.getLogicalTypeID()) {
+        case LogicalTypeID::BOOL:
+            return copyFromNumpyArray<bool>(pyResult, result, positions);
+        case LogicalTypeID::SERIAL:
+        case LogicalTypeID::INT64:
+            return copyFromNumpyArray<int64_t>(pyResult, result, positions);
+        case LogicalTypeID::INT32:
+            return copyFromNumpyArray<int32_t>(pyResult, result, positions);
+        case LogicalTypeID::INT16:
+            return copyFromNumpyArray<int16_t>(pyResult, result, positions);
+        case LogicalTypeID::INT8:
+            return copyFromNumpyArray<int8_t>(pyResult, result, positions);
+        case LogicalTypeID::UINT64:
+            return copyFromNumpyArray<uint64_t>(pyResult, result, positions);
+        case LogicalTypeID::UINT32:
+            return copyFromNumpyArray<uint32_t>(pyResult, result, positions);
+        case LogicalTypeID::UINT16:
+            return copyFromNumpyArray<uint16_t>(pyResult, result, positions);
+        case LogicalTypeID::UINT8:
+            return copyFromNumpyArray<uint8_t>(pyResult, result, positions);
+        case LogicalTypeID::DOUBLE:
+            return copyFromNumpyArray<double>(pyResult, result, positions);
+        case LogicalTypeID::FLOAT:
+            return copyFromNumpyArray<float>(pyResult, result, positions);
+        default:
+            break;
+        }
+    }
+    // Masked values are converted to None.
+    auto values = py::hasattr(pyResult, "tolist") ? pyResult.attr("tolist")() :
+                                                    py::reinterpret_borrow<py::object>(pyResult);
+    auto i = 0u;
+    for (auto value : values) {
+        result.copyFromValue(positions[i++],
+            PyConnection::transformPythonValueAs(value, result.dataType));
+    }
+}
+
+// Calls the UDF once per chunk with an array per parameter, holding the values of the rows to
+// evaluate. Flat parameters are repeated for each row.
+static scalar_func_exec_t getVectorizedUDFExecFunc(const py::function& udf, bool defaultNull,
+    bool catchExceptions) {
+    return [=](const std::vector<std::shared_ptr<common::ValueVector>>& params,
+               const std::vector<common::SelectionVector*>& paramSelVectors,
+               common::ValueVector& result, common::SelectionVector* resultSelVector,
+               void* /* dataPtr */) -> void {
+        py::gil_scoped_acquire acquire;
+        result.resetAuxiliaryBuffer();
+        std::vector<sel_t> resultPositions;
+        std::vector<std::vector<sel_t>> paramPositions(params.size());
+        for (auto i = 0u; i < resultSelVector->getSelSize(); ++i) {
+            auto resultPos = (*resultSelVector)[i];
+            auto hasNull = false;
+            for (auto j = 0u; j < params.size(); ++j) {
+                auto paramPos = params[j]->state->isFlat() ? (*paramSelVectors[j])[0] : resultPos;
+                hasNull |= params[j]->isNull(paramPos);
+                paramPositions[j].push_back(paramPos);
+            }
+            if (defaultNull && hasNull) {
+                result.setNull(resultPos, true);
+                for (auto& positions : paramPositions) {
+                    positions.pop_back();
+                }
+                continue;
+            }
+            resultPositions.push_back(resultPos);
+        }
+        if (resultPositions.empty()) {
+            return;
+        }
+        py::list pyParams;
+        for (auto j = 0u; j < params.size(); ++j) {
+            pyParams.append(toPyArray(*params[j], paramPositions[j]));
+        }
+        try {
+            auto pyResult = udf(*pyParams);
+            copyFromPyArray(pyResult, result, resultPositions);
+        } catch (py::error_already_set& e) {
+            if (!catchExceptions) {
+                throw common::RuntimeException(e.what());
+            }
+            for (auto pos : resultPositions) {
+                result.setNull(pos, true);
+            }
+        }
+    };
+}
+
 static scalar_bind_func getUDFBindFunc(const PyUDFSignature& signature) {
     return [signature](ScalarBindFuncInput) -> std::unique_ptr<FunctionBindData> {
         return std::make_unique<FunctionBindData>(LogicalType::copy(signature.paramTypes),
@@ -206,8 +375,8 @@ static scalar_bind_func getUDFBindFunc(const PyUDFSignature& signature) {
 
 function_set PyUDF::toFunctionSet(const std::string& name, const py::function& udf,
     const py::list& paramTypes, const std::string& resultType, bool defaultNull,
-    bool catchExceptions, main::ClientContext* context) {
-    auto pySignature = analyzeSignature(udf);
+    bool catchExceptions, bool vectorized, main::ClientContext* context) {
+    auto pySignature = analyzeSignature(udf, vectorized);
     auto explicitParamTypes = pyListToParams(paramTypes, context);
     if (explicitParamTypes.size() > 0) {
         if (explicitParamTypes.size() != pySignature.paramTypes.size()) {
@@ -232,9 +401,11 @@ function_set PyUDF::toFunctionSet(const std::string& name, const py::function& u
             "Return value must be annotated or explicitly given, and cannot be ANY");
     }
 
+    auto execFunc = vectorized ? getVectorizedUDFExecFunc(udf, defaultNull, catchExceptions) :
+                                 getUDFExecFunc(udf, defaultNull, catchExceptions);
     function_set definitions;
     definitions.push_back(std::make_unique<PyUDFScalarFunction>(name, paramIDTypes,
-        pySignature.resultType.getLogicalTypeID(),
-        getUDFExecFunc(udf, defaultNull, catchExceptions), getUDFBindFunc(pySignature)));
+        pySignature.resultType.getLogicalTypeID(), std::move(execFunc),
+        getUDFBindFunc(pySignature)));
     return definitions;
 }
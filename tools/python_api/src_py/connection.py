@@ -145,6 +145,48 @@ class Connection:
             all_query_results.append(QueryResult(self, query_result_internal))
         return all_query_results
 
+    def execute_batch(
+        self,
+        query: str | PreparedStatement,
+        parameters: list[dict[str, Any]],
+    ) -> list[QueryResult]:
+        """
+        Execute a query once for each parameter set.
+
+        Unless there is an active transaction, all executions run in a single
+        transaction that is rolled back if any of them fails.
+
+        Parameters
+        ----------
+        query : str | PreparedStatement
+            A prepared statement or a query string.
+            If a query string is given, a prepared statement will be created
+            automatically.
+
+        parameters : list[dict[str, Any]]
+            Parameter sets for the query.
+
+        Returns
+        -------
+        list[QueryResult]
+            Query results in the order of the parameter sets.
+
+        """
+        self.init_connection()
+        if not isinstance(parameters, list):
+            msg = f"Parameters must be a list of dicts; found {type(parameters)}."
+            raise RuntimeError(msg)  # noqa: TRY004
+
+        prepared_statement = self._prepare(query) if isinstance(query, str) else query
+        query_result_internal = self._connection.execute_batch(prepared_statement._prepared_statement, parameters)
+        if not query_result_internal.isSuccess():
+            raise RuntimeError(query_result_internal.getErrorMessage())
+        all_query_results = [QueryResult(self, query_result_internal)]
+        while query_result_internal.hasNextQueryResult():
+            query_result_internal = query_result_internal.getNextQueryResult()
+            all_query_results.append(QueryResult(self, query_result_internal))
+        return all_query_results
+
     def _prepare(
         self,
         query: str,
@@ -271,6 +313,7 @@ class Connection:
         *,
         default_null_handling: bool = True,
         catch_exceptions: bool = False,
+        vectorized: bool = False,
     ) -> None:
         """
         Set a User Defined Function (UDF) for use in cypher queries.
@@ -295,6 +338,12 @@ class Connection:
         catch_exceptions: Optional[bool]
             if true, when an exception is thrown from python, the function output will be null
             Otherwise, the exception will be rethrown
+
+        vectorized: Optional[bool]
+            if true, the function is called once per batch of rows instead of once per row. Each
+            parameter is passed as a NumPy array (masked if it has nulls) for numeric types, or as a
+            list otherwise, and the function must return a sequence (e.g. a NumPy or PyArrow array)
+            with one value per row. params_type and return_type must be given explicitly
         """
         if params_type is None:
             params_type = []
@@ -309,6 +358,7 @@ class Connection:
             return_value=return_type,
             default_null=default_null_handling,
             catch_exceptions=catch_exceptions,
+            vectorized=vectorized,
         )
 
     def remove_function(self, name: str) -> None:
@@ -220,16 +220,56 @@ class QueryResult:
         """
         self.check_for_query_result_close()
 
+        return self._query_result.getAsArrow(self._get_arrow_chunk_size(chunk_size), fallbackExtensionTypes)
+
+    def get_as_arrow_batches(
+        self, chunk_size: int | None = None, *, fallbackExtensionTypes: bool = False
+    ) -> pa.RecordBatchReader:
+        """
+        Get the query result as a stream of PyArrow record batches.
+
+        Unlike `get_as_arrow`, rows are converted one batch at a time as the reader is consumed, so
+        the whole result is never held in Arrow format at once.
+
+        Parameters
+        ----------
+        chunk_size : Number of rows to include in each batch. Same as for `get_as_arrow`.
+
+        fallbackExtensionTypes : bool
+            Avoid using Arrow extension types for compatibility with Polars
+
+        See Also
+        --------
+        get_as_arrow : Get the query result as a PyArrow Table.
+
+        Returns
+        -------
+        pyarrow.RecordBatchReader
+            Reader over the record batches of the query result.
+        """
+        import pyarrow as pa
+
+        self.check_for_query_result_close()
+
+        chunk_size = self._get_arrow_chunk_size(chunk_size)
+        schema = self._query_result.getArrowSchema(fallbackExtensionTypes)
+
+        def batches() -> Iterator[pa.RecordBatch]:
+            while (batch := self._query_result.getNextArrowBatch(chunk_size, fallbackExtensionTypes)) is not None:
+                yield batch
+
+        return pa.RecordBatchReader.from_batches(schema, batches())
+
+    def _get_arrow_chunk_size(self, chunk_size: int | None) -> int:
         if chunk_size is None:
             # Adaptive; target 10m total elements in each chunk.
             # (eg: if we had 10 cols, this would result in a 1m row chunk_size).
             target_n_elems = 10_000_000
-            chunk_size = max(target_n_elems // len(self.get_column_names()), 10)
-        elif chunk_size <= 0:
+            return max(target_n_elems // len(self.get_column_names()), 10)
+        if chunk_size <= 0:
             # No chunking: return the entire result as a single chunk
-            chunk_size = self.get_num_tuples()
-
-        return self._query_result.getAsArrow(chunk_size, fallbackExtensionTypes)
+            return self.get_num_tuples()
+        return chunk_size
 
     def get_column_data_types(self) -> list[str]:
         """
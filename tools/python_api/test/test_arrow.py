@@ -501,6 +501,17 @@ def test_to_arrow_array(conn_db_readwrite: ConnDB) -> None:
     assert results[1].to_pylist() == [None, [2, 3, 1], None]
 
 
+def test_to_arrow_batches(conn_db_readonly: ConnDB) -> None:
+    conn, _ = conn_db_readonly
+    reader = conn.execute("MATCH (a:person) RETURN a.ID, a.fName ORDER BY a.ID").get_as_arrow_batches(3)
+    assert reader.schema.names == ["a.ID", "a.fName"]
+    batches = list(reader)
+    assert [batch.num_rows for batch in batches] == [3, 3, 2]
+    table = pa.Table.from_batches(batches)
+    assert table["a.ID"].to_pylist() == [0, 2, 3, 5, 7, 8, 9, 10]
+    assert table["a.fName"].to_pylist()[:2] == ["Alice", "Bob"]
+
+
 def test_to_arrow_complex(conn_db_readonly: ConnDB) -> None:
     conn, _ = conn_db_readonly
 
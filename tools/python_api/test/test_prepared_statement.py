@@ -115,3 +115,20 @@ def test_prepare_limit(conn_db_readonly: ConnDB) -> None:
     assert result.get_next() == [0]
     assert result.get_next() == [2]
     assert result.get_next() == [3]
+
+
+def test_execute_batch(conn_db_readwrite: ConnDB) -> None:
+    conn, _ = conn_db_readwrite
+    conn.execute("CREATE NODE TABLE U(id INT64, name STRING, PRIMARY KEY(id))")
+    batch = [{"id": i, "name": f"u{i}"} for i in range(3)]
+    conn.execute_batch("CREATE (:U {id: $id, name: $name})", batch)
+    result = conn.execute("MATCH (u:U) RETURN u.id, u.name ORDER BY u.id")
+    assert result.get_all() == [[0, "u0"], [1, "u1"], [2, "u2"]]
+
+    # A duplicate primary key fails the batch and rolls back all of its executions.
+    with pytest.raises(RuntimeError):
+        conn.execute_batch("CREATE (:U {id: $id, name: $name})", [{"id": 3, "name": "v"}, {"id": 0, "name": "v"}])
+    assert conn.execute("MATCH (u:U) RETURN COUNT(*)").get_next() == [3]
+
+    results = conn.execute_batch("MATCH (u:U {id: $id}) RETURN u.name", [{"id": 2}, {"id": 1}])
+    assert [result.get_all() for result in results] == [[["u2"]], [["u1"]]]
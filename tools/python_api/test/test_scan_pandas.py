@@ -674,3 +674,12 @@ def test_df_with_struct_cast(conn_db_readonly: ConnDB) -> None:
     assert tup[0] == "{'a': 1}"
     tup = res.get_next()
     assert tup[0] == "{'a': '2'}"
+
+
+def test_scan_pandas_mixed_columns_multiple_morsels(conn_db_empty: ConnDB) -> None:
+    conn, _ = conn_db_empty
+    num_rows = 250_000
+    names = [None if i % 1000 == 999 else f"name{i}" for i in range(num_rows)]
+    df = pd.DataFrame({"id": np.arange(num_rows, dtype=np.int64), "name": names})
+    res = conn.execute("LOAD FROM df RETURN count(*), sum(id), count(name), max(name)")
+    assert res.get_next() == [num_rows, num_rows * (num_rows - 1) // 2, num_rows - 250, "name99998"]
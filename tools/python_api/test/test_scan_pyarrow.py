@@ -165,3 +165,20 @@ def test_copy_from_pyarrow_multi_pairs(conn_db_readwrite: ConnDB) -> None:
     assert result.has_next()
     assert result.get_next()[0] == 252
     assert not result.has_next()
+
+
+def test_pyarrow_scan_long_strings(conn_db_readonly: ConnDB) -> None:
+    conn, _ = conn_db_readonly
+    values = [None if i % 7 == 0 else ("s" * (i % 30)) + str(i) for i in range(5000)]
+    tab = pa.Table.from_arrays(
+        [
+            pa.array(range(5000), type=pa.int64()),
+            pa.array(values, type=pa.string()),
+            pa.array(values, type=pa.large_string()),
+        ],
+        names=["id", "str", "large_str"],
+    )
+    result = conn.execute("LOAD FROM tab RETURN id, str, large_str ORDER BY id")
+    for i in range(5000):
+        assert result.get_next() == [i, values[i], values[i]]
+    assert not result.has_next()
@@ -205,3 +205,38 @@ def test_udf_remove(conn_db_readwrite: ConnDB) -> None:
 
     with pytest.raises(RuntimeError, match=r"Catalog exception: function list_create doesn't exist."):
         conn.remove_function("list_create")
+
+
+def test_udf_vectorized(conn_db_readwrite: ConnDB) -> None:
+    conn, _ = conn_db_readwrite
+
+    def add(a, b):
+        return a + b
+
+    conn.create_function("vec_add", add, [Type.INT64, Type.INT64], Type.INT64, vectorized=True)
+    result = conn.execute("UNWIND range(1, 5000) AS x RETURN SUM(vec_add(x, 10))")
+    assert result.get_next() == [sum(range(11, 5011))]
+    assert conn.execute("RETURN vec_add(1, NULL)").get_next() == [None]
+
+    def concat(names, suffix):
+        return pa.array([name + s for name, s in zip(names, suffix)])
+
+    conn.create_function("vec_concat", concat, [Type.STRING, Type.STRING], Type.STRING, vectorized=True)
+    result = conn.execute("UNWIND ['a', 'b'] AS x RETURN vec_concat(x, '!')")
+    assert [row[0] for row in result.get_all()] == ["a!", "b!"]
+
+    def is_null(values):
+        return values.mask if hasattr(values, "mask") else [False] * len(values)
+
+    conn.create_function(
+        "vec_is_null", is_null, [Type.INT64], Type.BOOL, default_null_handling=False, vectorized=True
+    )
+    result = conn.execute("UNWIND [1, NULL, 3] AS x RETURN vec_is_null(x)")
+    assert [row[0] for row in result.get_all()] == [False, True, False]
+
+    def wrong_length(values):
+        return values[:1]
+
+    conn.create_function("vec_wrong_length", wrong_length, [Type.INT64], Type.INT64, vectorized=True)
+    with pytest.raises(RuntimeError, match=r"Vectorized UDF returned 1 values for 2 rows."):
+        conn.execute("UNWIND [1, 2] AS x RETURN vec_wrong_length(x)")
@@ -108,6 +108,12 @@ inline std::unique_ptr<ryu::main::QueryResult> connection_query(ryu::main::Conne
     std::string_view query) {
     return connection.query(query);
 }
+// Connections are synchronized internally, so a query can run through a shared reference while
+// the connection is used by other threads.
+inline std::unique_ptr<ryu::main::QueryResult> connection_query_shared(
+    const ryu::main::Connection& connection, std::string_view query) {
+    return const_cast<ryu::main::Connection&>(connection).query(query);
+}
 
 /* PreparedStatement */
 rust::String prepared_statement_error_message(const ryu::main::PreparedStatement& statement);
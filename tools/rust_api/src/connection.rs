@@ -6,6 +6,11 @@ use crate::value::Value;
 use cxx::UniquePtr;
 use std::cell::UnsafeCell;
 use std::convert::TryInto;
+use std::future::Future;
+use std::pin::Pin;
+use std::sync::{Arc, Mutex};
+use std::task::{Context, Poll, Waker};
+use std::thread::JoinHandle;
 
 /// A prepared stattement is a parameterized query which can avoid planning the same query for
 /// repeated execution
@@ -208,11 +213,91 @@ impl<'a> Connection<'a> {
     }
 }
 
+impl Connection<'static> {
+    /// Executes the given query on a background thread and returns a future which resolves to the
+    /// result.
+    ///
+    /// The future doesn't depend on a specific async runtime. It is woken by the background thread
+    /// once the query has finished, so awaiting it doesn't block the thread polling it.
+    ///
+    /// The background thread keeps its own reference to the connection, so the query keeps
+    /// running if the future is dropped or leaked. This is why the connection has to be shared
+    /// through an [`Arc`], and the database has to live for the rest of the program, e.g. in a
+    /// `static` or by leaking it with [`Box::leak`].
+    ///
+    /// # Arguments
+    /// * `query`: The query to execute. See <https://ryugraph.io/docs/cypher> for details on the
+    ///   query format.
+    pub fn query_async(self: &Arc<Self>, query: &str) -> QueryFuture {
+        let conn = Arc::clone(self);
+        let query = query.to_string();
+        let state = Arc::new(Mutex::new(QueryFutureState {
+            result: None,
+            waker: None,
+        }));
+        let thread_state = Arc::clone(&state);
+        let thread = std::thread::spawn(move || {
+            // Connections are synchronized on the C++ side, so the query runs through a shared
+            // reference rather than aliasing a mutable one used by other threads.
+            let result = ffi::connection_query_shared(
+                unsafe { &*conn.conn.get() },
+                ffi::StringView::new(&query),
+            );
+            let mut state = thread_state.lock().unwrap();
+            state.result = Some(result);
+            if let Some(waker) = state.waker.take() {
+                waker.wake();
+            }
+        });
+        QueryFuture {
+            state,
+            thread: Some(thread),
+        }
+    }
+}
+
+struct QueryFutureState {
+    result: Option<Result<UniquePtr<ffi::QueryResult<'static>>, cxx::Exception>>,
+    waker: Option<Waker>,
+}
+
+/// The result of a query executing on a background thread, returned by
+/// [`Connection::query_async`]
+pub struct QueryFuture {
+    state: Arc<Mutex<QueryFutureState>>,
+    thread: Option<JoinHandle<()>>,
+}
+
+impl Future for QueryFuture {
+    type Output = Result<QueryResult<'static>, Error>;
+
+    fn poll(mut self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
+        let mut state = self.state.lock().unwrap();
+        let Some(result) = state.result.take() else {
+            state.waker = Some(cx.waker().clone());
+            return Poll::Pending;
+        };
+        drop(state);
+        if let Some(thread) = self.thread.take() {
+            thread.join().unwrap();
+        }
+        let result = result?;
+        if result.isSuccess() {
+            Poll::Ready(Ok(QueryResult { result }))
+        } else {
+            Poll::Ready(Err(Error::FailedQuery(
+                ffi::query_result_get_error_message(&result),
+            )))
+        }
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use crate::database::SYSTEM_CONFIG_FOR_TESTS;
     use crate::{Connection, Database, Value};
     use anyhow::{Error, Result};
+    use std::sync::Arc;
 
     #[test]
     fn test_connection_threads() -> Result<()> {
@@ -278,6 +363,54 @@ Invalid input <MATCH (a:Person RETURN>: expected rule oC_SingleQuery (line: 1, o
         Ok(())
     }
 
+    // Minimal executor, so that the tests don't depend on an async runtime
+    fn block_on<F: std::future::Future>(future: F) -> F::Output {
+        struct ThreadWaker(std::thread::Thread);
+        impl std::task::Wake for ThreadWaker {
+            fn wake(self: std::sync::Arc<Self>) {
+                self.0.unpark();
+            }
+        }
+        let waker = std::sync::Arc::new(ThreadWaker(std::thread::current())).into();
+        let mut context = std::task::Context::from_waker(&waker);
+        let mut future = std::pin::pin!(future);
+        loop {
+            if let std::task::Poll::Ready(output) = future.as_mut().poll(&mut context) {
+                return output;
+            }
+            std::thread::park();
+        }
+    }
+
+    #[test]
+    fn test_query_async() -> Result<()> {
+        let temp_dir = tempfile::tempdir()?;
+        let db: &'static Database = Box::leak(Box::new(Database::new(
+            temp_dir.path().join("test"),
+            SYSTEM_CONFIG_FOR_TESTS,
+        )?));
+        let conn = Arc::new(Connection::new(db)?);
+        block_on(
+            conn.query_async(
+                "CREATE NODE TABLE Person(name STRING, age INT16, PRIMARY KEY(name));",
+            ),
+        )?;
+        block_on(conn.query_async("CREATE (:Person {name: 'Alice', age: 25});"))?;
+        let result = block_on(conn.query_async("MATCH (a:Person) RETURN a.name, a.age;"))?;
+        let rows: Vec<_> = result.collect();
+        assert_eq!(
+            rows,
+            vec![vec![Value::String("Alice".to_string()), Value::Int16(25)]]
+        );
+        assert!(block_on(conn.query_async("MATCH (a:Person RETURN a;")).is_err());
+        // The query outlives a dropped or leaked future, since its thread owns the connection
+        std::mem::forget(conn.query_async("MATCH (a:Person) RETURN a.name;"));
+        drop(conn.query_async("MATCH (a:Person) RETURN a.name;"));
+        drop(conn);
+        temp_dir.close()?;
+        Ok(())
+    }
+
     #[test]
     fn test_params() -> Result<()> {
         let temp_dir = tempfile::tempdir()?;
@@ -195,6 +195,12 @@ pub(crate) mod ffi {
             query: StringView<'a>,
         ) -> Result<UniquePtr<QueryResult<'db>>>;
 
+        #[namespace = "ryu_rs"]
+        fn connection_query_shared<'a, 'db>(
+            connection: &Connection<'db>,
+            query: StringView<'a>,
+        ) -> Result<UniquePtr<QueryResult<'db>>>;
+
         fn getMaxNumThreadForExec(self: Pin<&mut Connection>) -> u64;
         fn setMaxNumThreadForExec(self: Pin<&mut Connection>, num_threads: u64);
         fn interrupt(self: Pin<&mut Connection>) -> Result<()>;
@@ -62,7 +62,7 @@
 //! println!("cargo:rustc-link-arg=-rdynamic");
 //! ```
 
-pub use connection::{Connection, PreparedStatement};
+pub use connection::{Connection, PreparedStatement, QueryFuture};
 pub use database::{Database, SystemConfig};
 pub use error::Error;
 pub use logical_type::LogicalType;
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "main/ryu.h"
+
+namespace ryu {
+namespace server {
+
+/**
+ * Every message is a frame of a little-endian uint32 payload length, a uint8 frame type and the
+ * payload. Strings are a uint32 length followed by their bytes. A client may send any number of
+ * requests without waiting for their responses, which are sent in the order of the requests.
+ */
+enum class FrameType : uint8_t {
+    // string query
+    QUERY = 1,
+    // uint32 statement id, string query
+    PREPARE = 2,
+    // uint32 statement id, uint32 number of parameters, (string name, value) per parameter
+    EXECUTE = 3,
+    // uint32 statement id
+    CLOSE_STATEMENT = 4,
+
+    // Response of PREPARE and CLOSE_STATEMENT, without payload.
+    OK = 64,
+    // string message. Ends the response of any request.
+    ERROR = 65,
+    // uint32 number of columns, (string name, string type, uint8 wire type) per column
+    RESULT_HEADER = 66,
+    // uint32 number of rows, then per column a null bitmap of (rows + 7) / 8 bytes and the values.
+    // Fixed-width values take their width even if null, strings are empty if null.
+    RESULT_BATCH = 67,
+    // uint64 number of tuples, uint8 whether the result of the next statement follows.
+    RESULT_END = 68,
+};
+
+/**
+ * Encoding of a column in a result batch, or of a parameter value prefixed with it. Dates are
+ * days and timestamps are microseconds since the epoch. Other types are sent as strings.
+ */
+enum class WireType : uint8_t {
+    BOOL = 0,
+    INT8 = 1,
+    INT16 = 2,
+    INT32 = 3,
+    INT64 = 4,
+    UINT8 = 5,
+    UINT16 = 6,
+    UINT32 = 7,
+    UINT64 = 8,
+    FLOAT = 9,
+    DOUBLE = 10,
+    DATE = 11,
+    TIMESTAMP = 12,
+    STRING = 13,
+    BLOB = 14,
+    // Only used for parameters.
+    NULL_VALUE = 255,
+};
+
+struct WireTypeUtils {
+    static WireType fromLogicalType(const common::LogicalType& type);
+    // Returns 0 for strings and blobs.
+    static uint32_t getFixedWidth(WireType type);
+};
+
+class FrameWriter {
+public:
+    void beginFrame(FrameType type);
+    void endFrame();
+
+    void writeUInt8(uint8_t value) { writeBytes(&value, sizeof(value)); }
+    void writeUInt32(uint32_t value) { writeBytes(&value, sizeof(value)); }
+    void writeUInt64(uint64_t value) { writeBytes(&value, sizeof(value)); }
+    void writeString(std::string_view value);
+    void writeBytes(const void* data, uint64_t size);
+    // Writes the value with the fixed width of the wire type, or as a string.
+    void writeValue(WireType type, const common::Value& value);
+
+    uint64_t getSize() const { return buffer.size(); }
+    const uint8_t* getData() const { return buffer.data(); }
+    void clear() { buffer.clear(); }
+
+private:
+    std::vector<uint8_t> buffer;
+    uint64_t frameStart = 0;
+};
+
+class PayloadReader {
+public:
+    explicit PayloadReader(const std::vector<uint8_t>& payload) : payload{payload} {}
+
+    uint8_t readUInt8();
+    uint32_t readUInt32();
+    uint64_t readUInt64();
+    std::string readString();
+    // Reads a parameter value prefixed with its wire type.
+    std::unique_ptr<common::Value> readValue();
+
+private:
+    void readBytes(void* data, uint64_t size);
+
+private:
+    const std::vector<uint8_t>& payload;
+    uint64_t offset = 0;
+};
+
+} // namespace server
+} // namespace ryu
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "main/ryu.h"
+#include "protocol.h"
+
+namespace ryu {
+namespace server {
+
+struct ServerConfig {
+    std::string host = "127.0.0.1";
+    uint16_t port = 7687;
+    // Number of pooled connections, which is also the number of sessions served concurrently.
+    uint64_t numConnections = 8;
+    uint64_t batchSize = 2048;
+    // Sessions sending a larger frame are closed, so that a client can't make the server allocate
+    // an arbitrary amount of memory.
+    uint32_t maxFrameSize = 64 * 1024 * 1024;
+};
+
+/**
+ * Connections which are pinned to a session for its lifetime, so that its transactions and
+ * prepared statements live on the same connection.
+ */
+class ConnectionPool {
+public:
+    ConnectionPool(main::Database* database, uint64_t numConnections);
+
+    // Blocks until a connection is available.
+    std::unique_ptr<main::Connection> acquire();
+    void release(std::unique_ptr<main::Connection> connection);
+
+private:
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<main::Connection>> connections;
+};
+
+/**
+ * Serves the protocol of protocol.h over TCP. Each accepted socket is served by its own thread on
+ * a connection of the pool. Requests of a session are executed in order, and their responses are
+ * only flushed once no further request is buffered, so pipelined requests share writes.
+ */
+class Server {
+public:
+    Server(std::shared_ptr<main::Database> database, ServerConfig config);
+    // Closes the sockets of all sessions and waits for their threads.
+    ~Server();
+
+    // Binds the listening socket. Returns the bound port, which is useful if the port is 0.
+    uint16_t bind();
+    // Accepts sessions until the listening socket is closed.
+    void run();
+
+private:
+    void serveSession(int socket, std::unique_ptr<main::Connection> connection);
+    void joinFinishedSessions();
+    void stopSessions();
+
+private:
+    std::shared_ptr<main::Database> database;
+    ServerConfig config;
+    ConnectionPool pool;
+    int listenSocket = -1;
+    std::mutex sessionsMtx;
+    // Threads of the running sessions by their socket.
+    std::unordered_map<int, std::thread> sessions;
+    // Threads of closed sessions, which are joined by the accepting thread.
+    std::vector<std::thread> finishedSessions;
+};
+
+} // namespace server
+} // namespace ryu
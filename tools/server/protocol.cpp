@@ -0,0 +1,240 @@
+#include "protocol.h"
+
+#include <cstring>
+
+using namespace ryu::common;
+
+namespace ryu {
+namespace server {
+
+WireType WireTypeUtils::fromLogicalType(const LogicalType& type) {
+    switch (type.getLogicalTypeID()) {
+    case LogicalTypeID::BOOL:
+        return WireType::BOOL;
+    case LogicalTypeID::INT8:
+        return WireType::INT8;
+    case LogicalTypeID::INT16:
+        return WireType::INT16;
+    case LogicalTypeID::INT32:
+        return WireType::INT32;
+    case LogicalTypeID::SERIAL:
+    case LogicalTypeID::INT64:
+        return WireType::INT64;
+    case LogicalTypeID::UINT8:
+        return WireType::UINT8;
+    case LogicalTypeID::UINT16:
+        return WireType::UINT16;
+    case LogicalTypeID::UINT32:
+        return WireType::UINT32;
+    case LogicalTypeID::UINT64:
+        return WireType::UINT64;
+    case LogicalTypeID::FLOAT:
+        return WireType::FLOAT;
+    case LogicalTypeID::DOUBLE:
+        return WireType::DOUBLE;
+    case LogicalTypeID::DATE:
+        return WireType::DATE;
+    case LogicalTypeID::TIMESTAMP:
+        return WireType::TIMESTAMP;
+    case LogicalTypeID::BLOB:
+        return WireType::BLOB;
+    default:
+        return WireType::STRING;
+    }
+}
+
+uint32_t WireTypeUtils::getFixedWidth(WireType type) {
+    switch (type) {
+    case WireType::BOOL:
+    case WireType::INT8:
+    case WireType::UINT8:
+        return 1;
+    case WireType::INT16:
+    case WireType::UINT16:
+        return 2;
+    case WireType::INT32:
+    case WireType::UINT32:
+    case WireType::FLOAT:
+    case WireType::DATE:
+        return 4;
+    case WireType::INT64:
+    case WireType::UINT64:
+    case WireType::DOUBLE:
+    case WireType::TIMESTAMP:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+void FrameWriter::beginFrame(FrameType type) {
+    frameStart = buffer.size();
+    // The length is filled in by endFrame.
+    writeUInt32(0);
+    writeUInt8(static_cast<uint8_t>(type));
+}
+
+void FrameWriter::endFrame() {
+    const auto payloadSize =
+        static_cast<uint32_t>(buffer.size() - frameStart - sizeof(uint32_t) - sizeof(uint8_t));
+    memcpy(buffer.data() + frameStart, &payloadSize, sizeof(payloadSize));
+}
+
+void FrameWriter::writeString(std::string_view value) {
+    writeUInt32(static_cast<uint32_t>(value.size()));
+    writeBytes(value.data(), value.size());
+}
+
+void FrameWriter::writeBytes(const void* data, uint64_t size) {
+    const auto bytes = static_cast<const uint8_t*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+template<typename T>
+static void writeFixed(FrameWriter& writer, const Value& value) {
+    const T fixedValue = value.isNull() ? T{} : value.getValue<T>();
+    writer.writeBytes(&fixedValue, sizeof(T));
+}
+
+void FrameWriter::writeValue(WireType type, const Value& value) {
+    switch (type) {
+    case WireType::BOOL: {
+        writeUInt8(!value.isNull() && value.getValue<bool>());
+    } break;
+    case WireType::INT8: {
+        writeFixed<int8_t>(*this, value);
+    } break;
+    case WireType::INT16: {
+        writeFixed<int16_t>(*this, value);
+    } break;
+    case WireType::INT32: {
+        writeFixed<int32_t>(*this, value);
+    } break;
+    case WireType::INT64: {
+        writeFixed<int64_t>(*this, value);
+    } break;
+    case WireType::UINT8: {
+        writeFixed<uint8_t>(*this, value);
+    } break;
+    case WireType::UINT16: {
+        writeFixed<uint16_t>(*this, value);
+    } break;
+    case WireType::UINT32: {
+        writeFixed<uint32_t>(*this, value);
+    } break;
+    case WireType::UINT64: {
+        writeFixed<uint64_t>(*this, value);
+    } break;
+    case WireType::FLOAT: {
+        writeFixed<float>(*this, value);
+    } break;
+    case WireType::DOUBLE: {
+        writeFixed<double>(*this, value);
+    } break;
+    case WireType::DATE: {
+        const int32_t days = value.isNull() ? 0 : value.getValue<date_t>().days;
+        writeBytes(&days, sizeof(days));
+    } break;
+    case WireType::TIMESTAMP: {
+        const int64_t micros = value.isNull() ? 0 : value.getValue<timestamp_t>().value;
+        writeBytes(&micros, sizeof(micros));
+    } break;
+    case WireType::BLOB: {
+        writeString(value.isNull() ? "" : value.getValue<std::string>());
+    } break;
+    default: {
+        writeString(value.isNull() ? "" : value.toString());
+    }
+    }
+}
+
+void PayloadReader::readBytes(void* data, uint64_t size) {
+    if (offset + size > payload.size()) {
+        throw std::runtime_error("Malformed request: unexpected end of frame.");
+    }
+    memcpy(data, payload.data() + offset, size);
+    offset += size;
+}
+
+uint8_t PayloadReader::readUInt8() {
+    uint8_t value = 0;
+    readBytes(&value, sizeof(value));
+    return value;
+}
+
+uint32_t PayloadReader::readUInt32() {
+    uint32_t value = 0;
+    readBytes(&value, sizeof(value));
+    return value;
+}
+
+uint64_t PayloadReader::readUInt64() {
+    uint64_t value = 0;
+    readBytes(&value, sizeof(value));
+    return value;
+}
+
+std::string PayloadReader::readString() {
+    std::string value(readUInt32(), '\0');
+    readBytes(value.data(), value.size());
+    return value;
+}
+
+template<typename T, typename V = T>
+static std::unique_ptr<Value> readFixedValue(const uint8_t* data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return std::make_unique<Value>(V{value});
+}
+
+std::unique_ptr<Value> PayloadReader::readValue() {
+    const auto type = static_cast<WireType>(readUInt8());
+    if (type == WireType::NULL_VALUE) {
+        return std::make_unique<Value>(Value::createNullValue());
+    }
+    if (type == WireType::STRING) {
+        return std::make_unique<Value>(readString());
+    }
+    if (type == WireType::BLOB) {
+        return std::make_unique<Value>(LogicalType::BLOB(), readString());
+    }
+    const auto width = WireTypeUtils::getFixedWidth(type);
+    if (width == 0) {
+        throw std::runtime_error("Malformed request: unknown parameter type.");
+    }
+    uint8_t data[sizeof(uint64_t)];
+    readBytes(data, width);
+    switch (type) {
+    case WireType::BOOL:
+        return std::make_unique<Value>(data[0] != 0);
+    case WireType::INT8:
+        return readFixedValue<int8_t>(data);
+    case WireType::INT16:
+        return readFixedValue<int16_t>(data);
+    case WireType::INT32:
+        return readFixedValue<int32_t>(data);
+    case WireType::INT64:
+        return readFixedValue<int64_t>(data);
+    case WireType::UINT8:
+        return readFixedValue<uint8_t>(data);
+    case WireType::UINT16:
+        return readFixedValue<uint16_t>(data);
+    case WireType::UINT32:
+        return readFixedValue<uint32_t>(data);
+    case WireType::UINT64:
+        return readFixedValue<uint64_t>(data);
+    case WireType::FLOAT:
+        return readFixedValue<float>(data);
+    case WireType::DOUBLE:
+        return readFixedValue<double>(data);
+    case WireType::DATE:
+        return readFixedValue<int32_t, date_t>(data);
+    case WireType::TIMESTAMP:
+        return readFixedValue<int64_t, timestamp_t>(data);
+    default:
+        KU_UNREACHABLE;
+    }
+}
+
+} // namespace server
+} // namespace ryu
@@ -0,0 +1,391 @@
+#include "server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+
+using namespace ryu::common;
+using namespace ryu::main;
+
+namespace ryu {
+namespace server {
+
+ConnectionPool::ConnectionPool(Database* database, uint64_t numConnections) {
+    for (auto i = 0u; i < numConnections; i++) {
+        connections.push_back(std::make_unique<Connection>(database));
+    }
+}
+
+std::unique_ptr<Connection> ConnectionPool::acquire() {
+    std::unique_lock lck{mtx};
+    cv.wait(lck, [&] { return !connections.empty(); });
+    auto connection = std::move(connections.back());
+    connections.pop_back();
+    return connection;
+}
+
+void ConnectionPool::release(std::unique_ptr<Connection> connection) {
+    {
+        std::unique_lock lck{mtx};
+        connections.push_back(std::move(connection));
+    }
+    cv.notify_one();
+}
+
+namespace {
+
+class SocketStream {
+public:
+    SocketStream(int socket, uint32_t maxFrameSize) : socket{socket}, maxFrameSize{maxFrameSize} {}
+
+    // Returns false if the client closed the socket before the next frame.
+    bool readFrame(FrameType& type, std::vector<uint8_t>& payload) {
+        uint32_t payloadSize = 0;
+        if (!readBytes(&payloadSize, sizeof(payloadSize))) {
+            return false;
+        }
+        if (payloadSize > maxFrameSize) {
+            throw std::runtime_error("Frame of " + std::to_string(payloadSize) +
+                                     " bytes exceeds the maximum frame size of " +
+                                     std::to_string(maxFrameSize) + " bytes.");
+        }
+        uint8_t frameType = 0;
+        payload.resize(payloadSize);
+        if (!readBytes(&frameType, sizeof(frameType)) ||
+            !readBytes(payload.data(), payloadSize)) {
+            throw std::runtime_error("Connection closed in the middle of a frame.");
+        }
+        type = static_cast<FrameType>(frameType);
+        return true;
+    }
+
+    bool hasBufferedInput() const { return readOffset < readBuffer.size(); }
+
+    void write(FrameWriter& writer) {
+        auto data = writer.getData();
+        auto remaining = writer.getSize();
+        while (remaining > 0) {
+            const auto numSent = send(socket, data, remaining, 0);
+            if (numSent <= 0) {
+                throw std::runtime_error("Failed to write to the socket.");
+            }
+            data += numSent;
+            remaining -= numSent;
+        }
+        writer.clear();
+    }
+
+private:
+    bool readBytes(void* data, uint64_t size) {
+        auto out = static_cast<uint8_t*>(data);
+        while (size > 0) {
+            if (readOffset == readBuffer.size()) {
+                readBuffer.resize(READ_BUFFER_SIZE);
+                const auto numRead = recv(socket, readBuffer.data(), readBuffer.size(), 0);
+                if (numRead <= 0) {
+                    readBuffer.clear();
+                    readOffset = 0;
+                    return false;
+                }
+                readBuffer.resize(numRead);
+                readOffset = 0;
+            }
+            const auto numToCopy = std::min<uint64_t>(size, readBuffer.size() - readOffset);
+            memcpy(out, readBuffer.data() + readOffset, numToCopy);
+            readOffset += numToCopy;
+            out += numToCopy;
+            size -= numToCopy;
+        }
+        return true;
+    }
+
+private:
+    static constexpr uint64_t READ_BUFFER_SIZE = 64 * 1024;
+
+    int socket;
+    uint32_t maxFrameSize;
+    std::vector<uint8_t> readBuffer;
+    uint64_t readOffset = 0;
+};
+
+class Session {
+public:
+    Session(int socket, Connection& connection, const ServerConfig& config)
+        : stream{socket, config.maxFrameSize}, connection{connection},
+          batchSize{config.batchSize} {}
+
+    void run() {
+        FrameType type{};
+        std::vector<uint8_t> payload;
+        while (stream.readFrame(type, payload)) {
+            PayloadReader reader{payload};
+            try {
+                handleRequest(type, reader);
+            } catch (std::exception& e) {
+                writeError(e.what());
+            }
+            if (!stream.hasBufferedInput() || writer.getSize() >= FLUSH_THRESHOLD) {
+                stream.write(writer);
+            }
+        }
+        if (writer.getSize() > 0) {
+            stream.write(writer);
+        }
+    }
+
+private:
+    void handleRequest(FrameType type, PayloadReader& reader) {
+        switch (type) {
+        case FrameType::QUERY: {
+            const auto query = reader.readString();
+            writeResult(*connection.query(query));
+        } break;
+        case FrameType::PREPARE: {
+            const auto statementID = reader.readUInt32();
+            const auto query = reader.readString();
+            auto preparedStatement = connection.prepare(query);
+            if (!preparedStatement->isSuccess()) {
+                writeError(preparedStatement->getErrorMessage());
+                return;
+            }
+            preparedStatements.insert_or_assign(statementID, std::move(preparedStatement));
+            writeOK();
+        } break;
+        case FrameType::EXECUTE: {
+            const auto statementID = reader.readUInt32();
+            const auto numParams = reader.readUInt32();
+            std::unordered_map<std::string, std::unique_ptr<Value>> params;
+            for (auto i = 0u; i < numParams; i++) {
+                auto name = reader.readString();
+                params.insert_or_assign(std::move(name), reader.readValue());
+            }
+            const auto it = preparedStatements.find(statementID);
+            if (it == preparedStatements.end()) {
+                writeError(
+                    "Prepared statement " + std::to_string(statementID) + " does not exist.");
+                return;
+            }
+            writeResult(*connection.executeWithParams(it->second.get(), std::move(params)));
+        } break;
+        case FrameType::CLOSE_STATEMENT: {
+            preparedStatements.erase(reader.readUInt32());
+            writeOK();
+        } break;
+        default:
+            writeError("Unknown request type " + std::to_string(static_cast<uint8_t>(type)) + ".");
+        }
+    }
+
+    void writeResult(QueryResult& result) {
+        for (auto current = &result; current != nullptr;) {
+            if (!current->isSuccess()) {
+                writeError(current->getErrorMessage());
+                return;
+            }
+            const auto hasNextResult = current->hasNextQueryResult();
+            writeSingleResult(*current, hasNextResult);
+            current = hasNextResult ? current->getNextQueryResult() : nullptr;
+        }
+    }
+
+    // Rows are sent in columnar batches, each flushed once the buffer is large enough, so the
+    // client can process a large result while the rest of it is read.
+    void writeSingleResult(QueryResult& result, bool hasNextResult) {
+        const auto columnNames = result.getColumnNames();
+        const auto columnTypes = result.getColumnDataTypes();
+        std::vector<WireType> wireTypes;
+        writer.beginFrame(FrameType::RESULT_HEADER);
+        writer.writeUInt32(columnNames.size());
+        for (auto i = 0u; i < columnNames.size(); i++) {
+            wireTypes.push_back(WireTypeUtils::fromLogicalType(columnTypes[i]));
+            writer.writeString(columnNames[i]);
+            writer.writeString(columnTypes[i].toString());
+            writer.writeUInt8(static_cast<uint8_t>(wireTypes.back()));
+        }
+        writer.endFrame();
+        // Values of the current batch, row by row.
+        std::vector<std::vector<Value>> rows;
+        while (result.hasNext()) {
+            const auto tuple = result.getNext();
+            auto& row = rows.emplace_back();
+            for (auto i = 0u; i < tuple->len(); i++) {
+                row.push_back(*tuple->getValue(i));
+            }
+            if (rows.size() == batchSize) {
+                writeBatch(rows, wireTypes);
+                rows.clear();
+            }
+        }
+        if (!rows.empty()) {
+            writeBatch(rows, wireTypes);
+        }
+        writer.beginFrame(FrameType::RESULT_END);
+        writer.writeUInt64(result.getNumTuples());
+        writer.writeUInt8(hasNextResult);
+        writer.endFrame();
+    }
+
+    void writeBatch(const std::vector<std::vector<Value>>& rows,
+        const std::vector<WireType>& wireTypes) {
+        writer.beginFrame(FrameType::RESULT_BATCH);
+        writer.writeUInt32(rows.size());
+        std::vector<uint8_t> nullBitmap((rows.size() + 7) / 8);
+        for (auto column = 0u; column < wireTypes.size(); column++) {
+            std::fill(nullBitmap.begin(), nullBitmap.end(), 0);
+            for (auto row = 0u; row < rows.size(); row++) {
+                if (rows[row][column].isNull()) {
+                    nullBitmap[row / 8] |= 1 << (row % 8);
+                }
+            }
+            writer.writeBytes(nullBitmap.data(), nullBitmap.size());
+            for (auto& row : rows) {
+                writer.writeValue(wireTypes[column], row[column]);
+            }
+        }
+        writer.endFrame();
+        if (writer.getSize() >= FLUSH_THRESHOLD) {
+            stream.write(writer);
+        }
+    }
+
+    void writeOK() {
+        writer.beginFrame(FrameType::OK);
+        writer.endFrame();
+    }
+
+    void writeError(std::string_view message) {
+        writer.beginFrame(FrameType::ERROR);
+        writer.writeString(message);
+        writer.endFrame();
+    }
+
+private:
+    static constexpr uint64_t FLUSH_THRESHOLD = 256 * 1024;
+
+    SocketStream stream;
+    FrameWriter writer;
+    Connection& connection;
+    uint64_t batchSize;
+    std::unordered_map<uint32_t, std::unique_ptr<PreparedStatement>> preparedStatements;
+};
+
+} // namespace
+
+Server::Server(std::shared_ptr<Database> database, ServerConfig config)
+    : database{std::move(database)}, config{std::move(config)},
+      pool{this->database.get(), this->config.numConnections} {}
+
+Server::~Server() {
+    if (listenSocket >= 0) {
+        close(listenSocket);
+    }
+    stopSessions();
+}
+
+uint16_t Server::bind() {
+    listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenSocket < 0) {
+        throw std::runtime_error("Failed to create the listening socket.");
+    }
+    int reuseAddress = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(config.port);
+    if (inet_pton(AF_INET, config.host.c_str(), &address.sin_addr) != 1) {
+        throw std::runtime_error("Invalid host address: " + config.host + ".");
+    }
+    if (::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listenSocket, SOMAXCONN) != 0) {
+        throw std::runtime_error("Failed to listen on " + config.host + ":" +
+                                 std::to_string(config.port) + ": " + strerror(errno) + ".");
+    }
+    socklen_t addressSize = sizeof(address);
+    getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &addressSize);
+    return ntohs(address.sin_port);
+}
+
+void Server::run() {
+    while (true) {
+        // Sessions beyond the size of the pool wait in the backlog of the listening socket.
+        auto connection = pool.acquire();
+        const auto clientSocket = accept(listenSocket, nullptr, nullptr);
+        if (clientSocket < 0) {
+            pool.release(std::move(connection));
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        int noDelay = 1;
+        setsockopt(clientSocket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        joinFinishedSessions();
+        // The session only removes its thread once it is registered here.
+        std::unique_lock lck{sessionsMtx};
+        sessions.emplace(clientSocket,
+            std::thread{[this, clientSocket, connection = std::move(connection)]() mutable {
+                serveSession(clientSocket, std::move(connection));
+            }});
+    }
+}
+
+void Server::serveSession(int socket, std::unique_ptr<Connection> connection) {
+    try {
+        Session{socket, *connection, config}.run();
+    } catch (std::exception& e) {
+        std::cerr << "Session closed: " << e.what() << '\n';
+    }
+    {
+        // The socket is only closed once it is unregistered, so that stopSessions doesn't shut
+        // down a socket of a new session which reuses the descriptor.
+        std::unique_lock lck{sessionsMtx};
+        if (const auto it = sessions.find(socket); it != sessions.end()) {
+            finishedSessions.push_back(std::move(it->second));
+            sessions.erase(it);
+        }
+    }
+    close(socket);
+    // Leave no transaction of the session open on the connection for the next session.
+    connection->query("ROLLBACK;");
+    pool.release(std::move(connection));
+}
+
+void Server::joinFinishedSessions() {
+    std::vector<std::thread> threads;
+    {
+        std::unique_lock lck{sessionsMtx};
+        threads = std::move(finishedSessions);
+        finishedSessions.clear();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void Server::stopSessions() {
+    std::vector<std::thread> threads;
+    {
+        std::unique_lock lck{sessionsMtx};
+        for (auto& [socket, thread] : sessions) {
+            // Wakes up the session if it waits for the next request. A running query finishes
+            // first.
+            shutdown(socket, SHUT_RDWR);
+            threads.push_back(std::move(thread));
+        }
+        sessions.clear();
+    }
+    joinFinishedSessions();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace server
+} // namespace ryu
@@ -0,0 +1,70 @@
+#include <csignal>
+#include <iostream>
+
+#include "args.hxx"
+#include "server.h"
+
+using namespace ryu::main;
+using namespace ryu::server;
+
+int main(int argc, char* argv[]) {
+    args::ArgumentParser parser("Ryu server");
+    args::Positional<std::string> inputDirFlag(parser, "databasePath",
+        "Path to the database. If not given or set to \":memory:\", the database will be opened "
+        "under in-memory mode.");
+    args::HelpFlag help(parser, "help", "Display this help menu", {'h', "help"});
+    args::ValueFlag<std::string> hostFlag(parser, "", "Address to listen on", {"host"},
+        "127.0.0.1");
+    args::ValueFlag<uint16_t> portFlag(parser, "", "Port to listen on, or 0 for any free port",
+        {'p', "port"}, 7687);
+    args::ValueFlag<uint64_t> numConnectionsFlag(parser, "",
+        "Number of pooled connections, each serving one session at a time",
+        {'c', "connections"}, 8);
+    args::ValueFlag<uint64_t> batchSizeFlag(parser, "",
+        "Maximum number of rows per result batch", {"batch_size"}, 2048);
+    args::ValueFlag<uint32_t> maxFrameSizeFlag(parser, "",
+        "Maximum size of a request in bytes. Sessions sending larger requests are closed",
+        {"max_frame_size"}, 64 * 1024 * 1024);
+    args::ValueFlag<uint64_t> bpSizeInMBFlag(parser, "",
+        "Size of buffer pool for default and large page sizes in megabytes",
+        {'d', "default_bp_size"}, -1u);
+    args::Flag readOnlyMode(parser, "read_only", "Open database at read-only mode.",
+        {'r', "read_only"});
+
+    try {
+        parser.ParseCLI(argc, argv);
+    } catch (const args::Help&) {
+        std::cout << parser;
+        return 0;
+    } catch (const args::ParseError& e) {
+        std::cerr << e.what() << '\n';
+        std::cerr << parser;
+        return 1;
+    }
+
+    SystemConfig systemConfig;
+    if (args::get(bpSizeInMBFlag) != -1u) {
+        systemConfig.bufferPoolSize = args::get(bpSizeInMBFlag) << 20;
+    }
+    systemConfig.readOnly = readOnlyMode;
+    ServerConfig serverConfig;
+    serverConfig.host = args::get(hostFlag);
+    serverConfig.port = args::get(portFlag);
+    serverConfig.numConnections = std::max<uint64_t>(args::get(numConnectionsFlag), 1);
+    serverConfig.batchSize = std::max<uint64_t>(args::get(batchSizeFlag), 1);
+    serverConfig.maxFrameSize = args::get(maxFrameSizeFlag);
+
+    // Writes to a session whose client went away fail instead of killing the server.
+    signal(SIGPIPE, SIG_IGN);
+    try {
+        auto database = std::make_shared<Database>(args::get(inputDirFlag), systemConfig);
+        Server server{database, serverConfig};
+        const auto port = server.bind();
+        std::cout << "Listening on " << serverConfig.host << ":" << port << '\n' << std::flush;
+        server.run();
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
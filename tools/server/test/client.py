@@ -0,0 +1,183 @@
+"""Minimal client of the protocol described in tools/server/include/protocol.h."""
+
+from __future__ import annotations
+
+import socket
+import struct
+from typing import Any
+
+QUERY = 1
+PREPARE = 2
+EXECUTE = 3
+CLOSE_STATEMENT = 4
+OK = 64
+ERROR = 65
+RESULT_HEADER = 66
+RESULT_BATCH = 67
+RESULT_END = 68
+
+FIXED_TYPES = {
+    0: "?",
+    1: "b",
+    2: "h",
+    3: "i",
+    4: "q",
+    5: "B",
+    6: "H",
+    7: "I",
+    8: "Q",
+    9: "f",
+    10: "d",
+    11: "i",
+    12: "q",
+}
+STRING = 13
+BLOB = 14
+NULL_VALUE = 255
+
+
+class ServerError(Exception):
+    pass
+
+
+class Result:
+    def __init__(self) -> None:
+        self.column_names: list[str] = []
+        self.column_types: list[str] = []
+        self.columns: list[list[Any]] = []
+        self.num_batches = 0
+        self.num_tuples = 0
+
+    def rows(self) -> list[list[Any]]:
+        return [list(row) for row in zip(*self.columns)]
+
+
+def _pack_string(value: str | bytes) -> bytes:
+    data = value.encode() if isinstance(value, str) else value
+    return struct.pack("<I", len(data)) + data
+
+
+def _pack_value(value: Any) -> bytes:
+    if value is None:
+        return struct.pack("<B", NULL_VALUE)
+    if isinstance(value, bool):
+        return struct.pack("<B?", 0, value)
+    if isinstance(value, int):
+        return struct.pack("<Bq", 4, value)
+    if isinstance(value, float):
+        return struct.pack("<Bd", 10, value)
+    if isinstance(value, bytes):
+        return struct.pack("<B", BLOB) + _pack_string(value)
+    return struct.pack("<B", STRING) + _pack_string(str(value))
+
+
+class Client:
+    def __init__(self, port: int, host: str = "127.0.0.1") -> None:
+        self.socket = socket.create_connection((host, port))
+        self.buffer = b""
+
+    def close(self) -> None:
+        self.socket.close()
+
+    # Requests only send their frame, so several of them can be pipelined before reading the
+    # responses in the same order.
+    def send_query(self, query: str) -> None:
+        self._send(QUERY, _pack_string(query))
+
+    def send_prepare(self, statement_id: int, query: str) -> None:
+        self._send(PREPARE, struct.pack("<I", statement_id) + _pack_string(query))
+
+    def send_execute(self, statement_id: int, params: dict[str, Any]) -> None:
+        payload = struct.pack("<II", statement_id, len(params))
+        for name, value in params.items():
+            payload += _pack_string(name) + _pack_value(value)
+        self._send(EXECUTE, payload)
+
+    def send_close_statement(self, statement_id: int) -> None:
+        self._send(CLOSE_STATEMENT, struct.pack("<I", statement_id))
+
+    def read_ok(self) -> None:
+        frame_type, payload = self._read_frame()
+        self._check_error(frame_type, payload)
+        assert frame_type == OK
+
+    # Returns the results of all statements of the request.
+    def read_results(self) -> list[Result]:
+        results = []
+        while True:
+            frame_type, payload = self._read_frame()
+            self._check_error(frame_type, payload)
+            assert frame_type == RESULT_HEADER
+            result = Result()
+            wire_types = []
+            (num_columns,), offset = struct.unpack_from("<I", payload), 4
+            for _ in range(num_columns):
+                name, offset = self._unpack_string(payload, offset)
+                type_name, offset = self._unpack_string(payload, offset)
+                result.column_names.append(name.decode())
+                result.column_types.append(type_name.decode())
+                wire_types.append(payload[offset])
+                offset += 1
+            result.columns = [[] for _ in range(num_columns)]
+            while True:
+                frame_type, payload = self._read_frame()
+                self._check_error(frame_type, payload)
+                if frame_type == RESULT_END:
+                    result.num_tuples, has_next = struct.unpack("<QB", payload)
+                    break
+                assert frame_type == RESULT_BATCH
+                result.num_batches += 1
+                self._read_batch(payload, wire_types, result.columns)
+            results.append(result)
+            if not has_next:
+                return results
+
+    def query(self, query: str) -> Result:
+        self.send_query(query)
+        return self.read_results()[-1]
+
+    @staticmethod
+    def _read_batch(payload: bytes, wire_types: list[int], columns: list[list[Any]]) -> None:
+        (num_rows,), offset = struct.unpack_from("<I", payload), 4
+        for wire_type, column in zip(wire_types, columns):
+            null_bitmap = payload[offset : offset + (num_rows + 7) // 8]
+            offset += len(null_bitmap)
+            for row in range(num_rows):
+                if wire_type in FIXED_TYPES:
+                    fmt = "<" + FIXED_TYPES[wire_type]
+                    (value,) = struct.unpack_from(fmt, payload, offset)
+                    offset += struct.calcsize(fmt)
+                else:
+                    value, offset = Client._unpack_string(payload, offset)
+                    if wire_type == STRING:
+                        value = value.decode()
+                is_null = null_bitmap[row // 8] & (1 << (row % 8))
+                column.append(None if is_null else value)
+
+    @staticmethod
+    def _unpack_string(payload: bytes, offset: int) -> tuple[bytes, int]:
+        (length,) = struct.unpack_from("<I", payload, offset)
+        offset += 4
+        return payload[offset : offset + length], offset + length
+
+    @staticmethod
+    def _check_error(frame_type: int, payload: bytes) -> None:
+        if frame_type == ERROR:
+            message, _ = Client._unpack_string(payload, 0)
+            raise ServerError(message.decode())
+
+    def _send(self, frame_type: int, payload: bytes) -> None:
+        self.socket.sendall(struct.pack("<IB", len(payload), frame_type) + payload)
+
+    def _read_exactly(self, size: int) -> bytes:
+        while len(self.buffer) < size:
+            data = self.socket.recv(65536)
+            if not data:
+                raise ConnectionError("Server closed the connection.")
+            self.buffer += data
+        data, self.buffer = self.buffer[:size], self.buffer[size:]
+        return data
+
+    def _read_frame(self) -> tuple[int, bytes]:
+        length, frame_type = struct.unpack("<IB", self._read_exactly(5))
+        return frame_type, self._read_exactly(length)
@@ -0,0 +1,30 @@
+from __future__ import annotations
+
+import subprocess
+
+import pytest
+
+from client import Client
+from test_helper import RYU_SERVER_EXEC_PATH
+
+
+@pytest.fixture
+def server():
+    process = subprocess.Popen(
+        [RYU_SERVER_EXEC_PATH, ":memory:", "--port", "0", "--connections", "2", "--batch_size", "100"],
+        stdout=subprocess.PIPE,
+        text=True,
+    )
+    line = process.stdout.readline()
+    assert line.startswith("Listening on "), line
+    port = int(line.strip().rsplit(":", 1)[1])
+    yield port
+    process.terminate()
+    process.wait()
+
+
+@pytest.fixture
+def client(server):
+    conn = Client(server)
+    yield conn
+    conn.close()
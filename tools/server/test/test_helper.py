@@ -0,0 +1,13 @@
+import os
+from pathlib import Path
+
+RYU_ROOT = Path(__file__).parent.parent.parent.parent
+
+RYU_SERVER_EXEC_PATH = os.path.join(
+    RYU_ROOT,
+    "build",
+    "release",
+    "tools",
+    "server",
+    "ryu_server",
+)
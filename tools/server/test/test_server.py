@@ -0,0 +1,76 @@
+from __future__ import annotations
+
+import struct
+
+import pytest
+
+from client import Client, ServerError
+
+
+def test_query(client) -> None:
+    result = client.query("RETURN 1 AS a, 'x' AS b, 1.5 AS c, NULL AS d, true AS e")
+    assert result.column_names == ["a", "b", "c", "d", "e"]
+    assert result.column_types[:3] == ["INT64", "STRING", "DOUBLE"]
+    assert result.rows() == [[1, "x", 1.5, None, True]]
+    assert result.num_tuples == 1
+
+
+def test_streamed_batches(client) -> None:
+    result = client.query("UNWIND range(1, 250) AS i RETURN i")
+    assert result.num_batches == 3
+    assert result.columns[0] == list(range(1, 251))
+
+
+def test_multiple_statements(client) -> None:
+    client.send_query("RETURN 1; RETURN 2;")
+    results = client.read_results()
+    assert [result.rows() for result in results] == [[[1]], [[2]]]
+
+
+def test_error(client) -> None:
+    with pytest.raises(ServerError, match="Binder exception"):
+        client.query("MATCH (a:missing) RETURN a")
+    # The session can still be used after an error.
+    assert client.query("RETURN 1").rows() == [[1]]
+
+
+def test_pipelined_prepared_statements(client) -> None:
+    client.query("CREATE NODE TABLE person(id INT64, name STRING, PRIMARY KEY(id))")
+    client.send_prepare(1, "CREATE (:person {id: $id, name: $name})")
+    for i in range(10):
+        client.send_execute(1, {"id": i, "name": f"p{i}"})
+    client.send_prepare(2, "MATCH (p:person) WHERE p.id < $id RETURN p.name ORDER BY p.id")
+    client.send_execute(2, {"id": 3})
+    client.send_close_statement(1)
+    client.send_execute(1, {"id": 100, "name": "x"})
+    client.read_ok()
+    for _ in range(10):
+        client.read_results()
+    client.read_ok()
+    assert client.read_results()[0].rows() == [["p0"], ["p1"], ["p2"]]
+    client.read_ok()
+    with pytest.raises(ServerError, match="Prepared statement 1 does not exist"):
+        client.read_results()
+
+
+def test_pinned_transactions(server) -> None:
+    first = Client(server)
+    second = Client(server)
+    first.query("CREATE NODE TABLE t(id INT64, PRIMARY KEY(id))")
+    first.query("BEGIN TRANSACTION")
+    first.query("CREATE (:t {id: 1})")
+    assert second.query("MATCH (n:t) RETURN count(*)").rows() == [[0]]
+    first.query("COMMIT")
+    assert second.query("MATCH (n:t) RETURN count(*)").rows() == [[1]]
+    first.close()
+    second.close()
+
+
+def test_frame_too_large(server, client) -> None:
+    # The session is closed instead of allocating the payload of the frame.
+    client.socket.sendall(struct.pack("<IB", 0xFFFFFFFF, 1))
+    assert client.socket.recv(1) == b""
+    # Other sessions are not affected.
+    other = Client(server)
+    assert other.query("RETURN 1").rows() == [[1]]
+    other.close()
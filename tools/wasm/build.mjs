@@ -43,6 +43,18 @@ const ES_BUILD_CONFIG_MULTI = JSON.parse(JSON.stringify(ES_BUILD_CONFIG));
 ES_BUILD_CONFIG_MULTI.outdir = 'package/multithreaded';
 await esbuild.build(ES_BUILD_CONFIG_MULTI);
 
+console.log('Cleaning up...');
+execSync("npm run clean exclude-package", { stdio: "inherit" });
+console.log("Building OPFS version of Ryu WebAssembly module...");
+execSync(`make wasm NUM_THREADS=${THREADS} SINGLE_THREADED=false WASM_OPFS=true`, {
+  cwd: SRC_PATH,
+  stdio: "inherit",
+});
+console.log('Creating esbuild bundle...');
+const ES_BUILD_CONFIG_OPFS = JSON.parse(JSON.stringify(ES_BUILD_CONFIG));
+ES_BUILD_CONFIG_OPFS.outdir = 'package/opfs';
+await esbuild.build(ES_BUILD_CONFIG_OPFS);
+
 console.log('Cleaning up...');
 execSync("npm run clean exclude-package", { stdio: "inherit" });
 console.log("Building Node.js version of Ryu WebAssembly module...");
@@ -8,6 +8,9 @@
 #include "main/ryu.h"
 #include <emscripten/bind.h>
 #include <emscripten/val.h>
+#ifdef __WASM_OPFS__
+#include <emscripten/wasmfs.h>
+#endif
 using namespace emscripten;
 using namespace ryu::main;
 using namespace ryu::common;
@@ -27,6 +30,15 @@ val JsObject = val::global("Object");
 /**
  * Helper functions
  */
+#ifdef __WASM_OPFS__
+// Mounts the origin private file system of the browser at the given path. Files under it are read
+// and written through synchronous access handles, so the buffer manager pages them from disk
+// instead of holding the whole database in memory. Returns 0 on success, or an errno value.
+int mountOPFS(std::string path) {
+    return wasmfs_create_directory(path.c_str(), 0777, wasmfs_create_opfs_backend());
+}
+#endif
+
 QueryResult* connectionQueryWrapper(Connection& conn, std::string query) {
     return conn.query(std::string_view(query)).release();
 }
@@ -452,4 +464,7 @@ EMSCRIPTEN_BINDINGS(ryu_wasm) {
         .function("getAsJsArrayOfObjects", &queryResultGetAsEmscriptenArrayOfObjects);
     function("getVersion", &getVersion);
     function("getStorageVersion", &Version::getStorageVersion);
+#ifdef __WASM_OPFS__
+    function("mountOPFS", &mountOPFS);
+#endif
 }
@@ -140,6 +140,22 @@ class FS {
     }
   }
 
+  /**
+   * Mount a directory as the origin private file system (OPFS) of the browser
+   * (persistent storage). Unlike IDBFS, files are read and written in place
+   * and don't need to be synchronized with `syncfs`. Only supported by the
+   * OPFS build.
+   * @param {String} path the path to the directory.
+   * @throws {Error} if the directory cannot be mounted.
+   */
+  async mountOPFS(path) {
+    const worker = await dispatcher.getWorker();
+    const result = await worker.FSMountOPFS(path);
+    if (!result.isSuccess) {
+      throw new Error(result.error);
+    }
+  }
+
   /**
    * Unmount a mounted filesystem.
    * @param {String} path the path to the filesystem.
@@ -567,6 +567,16 @@ else {
       }
     },
 
+    FSMountOPFS(path) {
+      try {
+        ryuSync.mountOPFS(path);
+        return { isSuccess: true };
+      }
+      catch (e) {
+        return { error: e.message, isSuccess: false }
+      }
+    },
+
     async FSSyncfs(populate) {
       try {
         await new Promise((resolve, reject) => {
@@ -53,6 +53,19 @@ module.exports = {
     return RyuWasm.getFS();
   },
 
+  /**
+   * Mount the origin private file system (OPFS) of the browser at the given
+   * path. Databases created under the path are persistent and paged from disk
+   * instead of being held in memory. Only supported by the OPFS build, and
+   * only in a Web Worker.
+   * @memberof module:ryu-wasm
+   * @param {String} path the path to mount OPFS at.
+   * @throws {Error} if OPFS cannot be mounted.
+   */
+  mountOPFS: (path) => {
+    RyuWasm.mountOPFS(path);
+  },
+
   /**
    * Get the WebAssembly memory. Please refer to the emscripten documentation 
    * for more information.
@@ -33,6 +33,17 @@ class ryu {
     return this._ryu.FS;
   }
 
+  mountOPFS(path) {
+    this.checkInit();
+    if (!this._ryu.mountOPFS) {
+      throw new Error("OPFS is only supported by the OPFS build of the WebAssembly module.");
+    }
+    const errno = this._ryu.mountOPFS(path);
+    if (errno !== 0) {
+      throw new Error(`Failed to mount OPFS at ${path} (errno ${errno}).`);
+    }
+  }
+
   getWasmMemory() {
     this.checkInit();
     return this._ryu.wasmMemory;